@@ -0,0 +1,145 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {@var{results} =} eval_bench ()
+## Microbenchmark suite for the statement evaluator.
+##
+## Runs a set of loop-heavy kernels that stress per-node evaluation
+## overhead (scalar arithmetic, function calls, recursion, indexing,
+## and control flow) and reports the best-of-three wall time for each.
+##
+## If this copy of Octave was built with the VM evaluator
+## (@code{__enable_vm_eval__}), each kernel is also timed with the VM
+## enabled and the speedup over the tree walker is reported, so
+## evaluator regressions are visible from one place.
+## @end deftypefn
+
+function results = eval_bench ()
+
+  kernels = {@bench_scalar_loop, @bench_call_loop, @bench_fib, ...
+             @bench_index_loop, @bench_while_loop};
+
+  have_vm = true;
+  try
+    vm_old = __enable_vm_eval__ ();
+  catch
+    have_vm = false;
+  end_try_catch
+
+  results = struct ("name", {}, "tree_time", {}, "vm_time", {});
+
+  printf ("%-18s %12s", "kernel", "tree (s)");
+  if (have_vm)
+    printf (" %12s %8s", "vm (s)", "speedup");
+  endif
+  printf ("\n");
+
+  for i = 1:numel (kernels)
+    fcn = kernels{i};
+    name = func2str (fcn);
+
+    if (have_vm)
+      __enable_vm_eval__ (false);
+    endif
+    t_tree = best_of_three (fcn);
+
+    t_vm = NaN;
+    if (have_vm)
+      __enable_vm_eval__ (true);
+      t_vm = best_of_three (fcn);
+      __enable_vm_eval__ (vm_old);
+    endif
+
+    results(end+1) = struct ("name", name, "tree_time", t_tree, ...
+                             "vm_time", t_vm);
+
+    printf ("%-18s %12.4f", name, t_tree);
+    if (have_vm)
+      printf (" %12.4f %8.2f", t_vm, t_tree / t_vm);
+    endif
+    printf ("\n");
+  endfor
+
+endfunction
+
+function t = best_of_three (fcn)
+  t = Inf;
+  for k = 1:3
+    id = tic ();
+    fcn ();
+    t = min (t, toc (id));
+  endfor
+endfunction
+
+function s = bench_scalar_loop ()
+  s = 0;
+  for i = 1:1e6
+    s = s + i * 2 - 1;
+  endfor
+endfunction
+
+function s = bench_call_loop ()
+  s = 0;
+  for i = 1:2e5
+    s = s + add_one (s) - s;
+  endfor
+endfunction
+
+function y = add_one (x)
+  y = x + 1;
+endfunction
+
+function y = bench_fib ()
+  y = fib (22);
+endfunction
+
+function y = fib (n)
+  if (n < 2)
+    y = n;
+  else
+    y = fib (n-1) + fib (n-2);
+  endif
+endfunction
+
+function s = bench_index_loop ()
+  x = ones (1, 1e5);
+  s = 0;
+  for i = 1:numel (x)
+    x(i) = x(i) + 1;
+    s = s + x(i);
+  endfor
+endfunction
+
+function s = bench_while_loop ()
+  s = 0;
+  i = 0;
+  while (i < 1e6)
+    i = i + 1;
+    if (mod (i, 2) == 0)
+      s = s + 1;
+    endif
+  endwhile
+endfunction
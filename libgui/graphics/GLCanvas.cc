@@ -39,10 +39,15 @@ OCTAVE_BEGIN_NAMESPACE(octave)
 
 GLWidget::GLWidget (Canvas& parent_canvas, QWidget *parent)
   : QOpenGLWidget (parent), m_parent_canvas (parent_canvas),
-    m_glfcns (), m_renderer (m_glfcns)
+    m_glfcns (), m_renderer (m_glfcns), m_overlay_tainted (true)
 {
   setFocusPolicy (Qt::ClickFocus);
   setFocus ();
+
+  // Keep the previous frame so the renderer can repaint only damaged
+  // regions (see opengl_renderer::enable_partial_redraw).
+
+  setUpdateBehavior (QOpenGLWidget::PartialUpdate);
 }
 
 GLWidget::~GLWidget () { }
@@ -76,6 +81,16 @@ GLWidget::draw (graphics_object go)
       m_renderer.set_viewport (dpr * width (), dpr * height ());
       m_renderer.set_device_pixel_ratio (dpr);
 
+      // A zoom box is drawn on top of the scene after this call
+      // returns, so the frame that contained one (and the frame right
+      // after it, which must erase it) cannot be partially repainted.
+
+      m_renderer.enable_partial_redraw (! m_overlay_tainted);
+      m_overlay_tainted = false;
+
+      unwind_action disable_partial
+        ([this] () { m_renderer.enable_partial_redraw (false); });
+
       m_renderer.draw (go);
     }
 }
@@ -190,6 +205,8 @@ GLWidget::selectFromAxes (const graphics_object& ax, const QPoint& pt)
 void
 GLWidget::drawZoomBox (const QPoint& p1, const QPoint& p2)
 {
+  m_overlay_tainted = true;
+
   Matrix overlaycolor (3, 1);
   overlaycolor(0) = 0.45;
   overlaycolor(1) = 0.62;
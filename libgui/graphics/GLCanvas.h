@@ -83,6 +83,10 @@ private:
 
   QOpenGLContext m_os_context;
   QOffscreenSurface m_os_surface;
+
+  // True when the preserved frame contains an overlay (zoom box) that
+  // the next frame must erase with a full redraw.
+  bool m_overlay_tainted;
 };
 
 class GLCanvas : public Canvas
@@ -388,6 +388,11 @@ public:
     m_glfcns.glScalef (x, y, z);
   }
 
+  void glScissor (GLint x, GLint y, GLsizei width, GLsizei height)
+  {
+    m_glfcns.glScissor (x, y, width, height);
+  }
+
   void glSelectBuffer (GLsizei size, GLuint *buffer)
   {
     m_glfcns.glSelectBuffer (size, buffer);
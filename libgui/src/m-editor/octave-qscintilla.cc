@@ -37,6 +37,7 @@
 #include <QMimeData>
 #include <QPointer>
 #include <QTemporaryFile>
+#include <QTimer>
 #include <QToolTip>
 #include <QVBoxLayout>
 #if defined (HAVE_QSCI_QSCILEXEROCTAVE_H)
@@ -114,7 +115,8 @@ is_end (const QString& candidate, const QString& opening)
 octave_qscintilla::octave_qscintilla (QWidget *p)
   : QsciScintilla (p), m_debug_mode (false), m_word_at_cursor (),
     m_selection (), m_selection_replacement (), m_selection_line (-1),
-    m_selection_col (-1), m_indicator_id (1)
+    m_selection_col (-1), m_indicator_id (1), m_recolor_end (0),
+    m_recolor_pending (false)
 {
   connect (this, SIGNAL (textChanged ()),
            this, SLOT (text_changed ()));
@@ -237,6 +239,67 @@ void octave_qscintilla::setCursorPosition (int line, int col)
   emit update_rowcol_indicator_signal (line, col);
 }
 
+// Maximum number of bytes styled by one recolor step.  Full recolors
+// of larger documents (e.g., when the lexer is attached after loading
+// a big file) are split into chunks run from the event loop so that
+// the GUI stays responsive.  Scintilla records the lexer state at the
+// end of every styled line, so each chunk resumes exactly at the
+// checkpoint left by the previous one, and edits inside already styled
+// text are re-lexed incrementally from the same per-line states.
+
+static const int max_recolor_chunk = 64 * 1024;
+
+void octave_qscintilla::recolor (int start, int end)
+{
+  int doc_length = length ();
+
+  if (end < 0 || end > doc_length)
+    end = doc_length;
+
+  if (start > 0 || end - start <= max_recolor_chunk)
+    {
+      QsciScintilla::recolor (start, end);
+      return;
+    }
+
+  // Style the first chunk immediately: it covers the part that is
+  // visible right after a file was loaded.  Text the user scrolls to
+  // before its chunk has run is styled on demand while painting.
+
+  QsciScintilla::recolor (0, max_recolor_chunk);
+
+  m_recolor_end = end;
+
+  if (! m_recolor_pending)
+    {
+      m_recolor_pending = true;
+      QTimer::singleShot (0, this, SLOT (recolor_chunk ()));
+    }
+}
+
+void octave_qscintilla::recolor_chunk ()
+{
+  int styled = SendScintilla (SCI_GETENDSTYLED);
+  int end = qMin (m_recolor_end, static_cast<int> (length ()));
+
+  if (styled >= end)
+    {
+      m_recolor_pending = false;
+      return;
+    }
+
+  // Stop at a line boundary so the per-line lexer states stored by
+  // scintilla remain valid checkpoints for the next chunk.
+
+  int stop_line = SendScintilla (SCI_LINEFROMPOSITION,
+                                 styled + max_recolor_chunk);
+  int stop_pos = SendScintilla (SCI_GETLINEENDPOSITION, stop_line);
+
+  QsciScintilla::recolor (styled, qMin (stop_pos, end));
+
+  QTimer::singleShot (0, this, SLOT (recolor_chunk ()));
+}
+
 void octave_qscintilla::set_selection_marker_color (const QColor& c)
 {
   QColor ic = c;
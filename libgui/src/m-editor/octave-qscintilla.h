@@ -58,6 +58,7 @@ public:
 
   virtual void contextMenuEvent (QContextMenuEvent *e);
   virtual void setCursorPosition (int line, int col);
+  virtual void recolor (int start = 0, int end = -1);
 
   void context_help_doc (bool);
   void context_edit ();
@@ -123,6 +124,8 @@ private slots:
   void contextmenu_break_condition (bool);
   void contextmenu_break_once (const QPoint&);
 
+  void recolor_chunk ();
+
   void text_changed ();
   void cursor_position_changed (int, int);
 
@@ -155,6 +158,10 @@ private:
   int m_selection_line;
   int m_selection_col;
   int m_indicator_id;
+
+  // State of a chunked full-document recolor (see recolor)
+  int m_recolor_end;
+  bool m_recolor_pending;
 };
 
 OCTAVE_END_NAMESPACE(octave)
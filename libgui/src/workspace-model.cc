@@ -29,6 +29,7 @@
 
 #include <sstream>
 
+#include <QHash>
 #include <QTreeWidget>
 #include <QToolTip>
 
@@ -147,7 +148,7 @@ workspace_model::data (const QModelIndex& idx, int role) const
               break;
 
             case 3:
-              retval = QVariant (m_values[idx.row ()]);
+              retval = QVariant (value_at (idx.row ()));
               break;
 
             case 4:
@@ -178,11 +179,23 @@ workspace_model::data (const QModelIndex& idx, int role) const
   return retval;
 }
 
+QStringList
+workspace_model::get_symbol_values () const
+{
+  // Bulk access: force computation of any still-pending previews.
+
+  for (int i = 0; i < m_values.size (); i++)
+    value_at (i);
+
+  return m_values;
+}
+
 void
 workspace_model::set_workspace (bool top_level, bool /* debug */,
                                 const symbol_info_list& syminfo)
 {
-  clear_data ();
+  // Don't clear_data here: update_table reuses the previews already
+  // computed for variables whose value is unchanged.
 
   m_top_level = top_level;
   m_syminfo_list = syminfo;
@@ -226,11 +239,29 @@ workspace_model::show_symbol_tooltip (const QPoint& pos,
   int symbol_idx = m_symbols.indexOf (symbol);
 
   if (symbol_idx > -1)
-    QToolTip::showText (pos, symbol + " = " + m_values.at (symbol_idx));
+    QToolTip::showText (pos, symbol + " = " + value_at (symbol_idx));
   else
     QToolTip::hideText ();
 }
 
+QString
+workspace_model::value_at (int row) const
+{
+  if (row < 0 || row >= m_values.size ())
+    return QString ();
+
+  if (! m_value_computed.at (row))
+    {
+      std::ostringstream buf;
+      m_value_objects[row].short_disp (buf);
+
+      m_values[row] = QString::fromStdString (buf.str ());
+      m_value_computed[row] = true;
+    }
+
+  return m_values.at (row);
+}
+
 void
 workspace_model::clear_data ()
 {
@@ -240,8 +271,10 @@ workspace_model::clear_data ()
   m_symbols = QStringList ();
   m_class_names = QStringList ();
   m_dimensions = QStringList ();
-  m_values = QStringList ();
   m_complex_flags = QIntList ();
+  m_value_objects.clear ();
+  m_values = QStringList ();
+  m_value_computed.clear ();
 }
 
 void
@@ -249,6 +282,27 @@ workspace_model::update_table ()
 {
   beginResetModel ();
 
+  // Previews already computed for variables whose value is unchanged
+  // can be kept; rep identity is enough since any assignment to a
+  // variable installs a new rep.
+
+  QHash<QString, QPair<const octave_base_value *, QString>> old_previews;
+
+  for (int i = 0; i < m_symbols.size (); i++)
+    if (m_value_computed.at (i))
+      old_previews.insert (m_symbols.at (i),
+                           qMakePair (m_value_objects[i].internal_rep (),
+                                      m_values.at (i)));
+
+  m_scopes = QString ();
+  m_symbols = QStringList ();
+  m_class_names = QStringList ();
+  m_dimensions = QStringList ();
+  m_complex_flags = QIntList ();
+  m_value_objects.clear ();
+  m_values = QStringList ();
+  m_value_computed.clear ();
+
   for (const auto& syminfo : m_syminfo_list)
     {
       std::string nm = syminfo.name ();
@@ -269,16 +323,25 @@ workspace_model::update_table ()
       else if (syminfo.is_persistent ())
         storage = 'p';
 
-      std::ostringstream buf;
-      val.short_disp (buf);
-      std::string short_disp_str = buf.str ();
+      QString sym = QString::fromStdString (nm);
+
+      auto it = old_previews.constFind (sym);
+
+      bool have_preview = (it != old_previews.constEnd ()
+                           && it->first == val.internal_rep ());
 
       m_scopes.append (storage);
-      m_symbols.append (QString::fromStdString (nm));
+      m_symbols.append (sym);
       m_class_names.append (QString::fromStdString (val.class_name ()));
       m_dimensions.append (QString::fromStdString (dv.str ()));
-      m_values.append (QString::fromStdString (short_disp_str));
       m_complex_flags.append (val.iscomplex ());
+
+      // The preview string itself is computed on demand (see value_at)
+      // when the view shows the row.
+
+      m_value_objects.push_back (val);
+      m_values.append (have_preview ? it->second : QString ());
+      m_value_computed.append (have_preview);
     }
 
   endResetModel ();
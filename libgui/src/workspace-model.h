@@ -34,6 +34,8 @@
 #include <QStringList>
 #include <QVector>
 
+#include <vector>
+
 #include "syminfo.h"
 
 // Defined for purposes of sending QList<int> as part of signal.
@@ -72,7 +74,7 @@ public:
   symbol_info_list get_symbol_info () const { return m_syminfo_list; }
 
   QStringList get_symbol_names () const { return m_symbols; }
-  QStringList get_symbol_values () const { return m_values; }
+  QStringList get_symbol_values () const;
 
 signals:
 
@@ -95,15 +97,24 @@ private:
   void clear_data ();
   void update_table ();
 
+  QString value_at (int row) const;
+
   bool m_top_level;
   symbol_info_list m_syminfo_list;
   QString m_scopes;
   QStringList m_symbols;
   QStringList m_class_names;
   QStringList m_dimensions;
-  QStringList m_values;
   QIntList m_complex_flags;
 
+  // Value previews are computed on demand for the rows the view
+  // actually requests (see value_at) and cached until the variable
+  // holds a different value.
+
+  std::vector<octave_value> m_value_objects;
+  mutable QStringList m_values;
+  mutable QVector<bool> m_value_computed;
+
   QStringList m_columnNames;
 
   QList<QColor>  m_storage_class_colors;
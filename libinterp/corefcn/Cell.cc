@@ -27,6 +27,11 @@
 #  include "config.h"
 #endif
 
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
 #include "idx-vector.h"
 
 #include "Cell.h"
@@ -34,6 +39,73 @@
 #include "errwarn.h"
 #include "ovl.h"
 
+// Bulk cellstr construction packs all character data into one shared
+// arena instead of giving every string its own heap block: millions
+// of short strings then cost one allocation for the text plus one
+// small rep object each, and scanning the cell walks memory
+// sequentially.  Each element is an ordinary char matrix whose rep
+// adopts a slice of the arena with a release hook, so everything
+// downstream (copy-on-write, in-place modification of an unshared
+// element, resizing) behaves exactly as it does for separate blocks;
+// an element that outlives the others keeps the whole arena alive,
+// and growing or copying an element migrates it to its own block as
+// usual.
+
+namespace
+{
+  struct cellstr_arena
+  {
+    std::atomic<octave_idx_type> refcount;
+  };
+
+  // Each packed string is preceded by a pointer back to the arena
+  // header, so the release hook can find it from the slice address.
+
+  const std::size_t arena_slot_align = sizeof (cellstr_arena *);
+
+  std::size_t
+  arena_slot_size (std::size_t len)
+  {
+    std::size_t sz = sizeof (cellstr_arena *) + len;
+
+    return (sz + arena_slot_align - 1) / arena_slot_align * arena_slot_align;
+  }
+
+  void
+  release_arena_slice (char *ptr, std::size_t)
+  {
+    cellstr_arena *arena;
+    std::memcpy (&arena, ptr - sizeof (cellstr_arena *), sizeof (arena));
+
+    if (--arena->refcount == 0)
+      std::free (arena);
+  }
+
+  // Append S to the arena at CURSOR and return a char matrix whose
+  // rep adopts the stored copy.
+
+  octave_value
+  pack_string (const std::string& s, cellstr_arena *arena, char *& cursor)
+  {
+    std::size_t len = s.length ();
+
+    std::memcpy (cursor, &arena, sizeof (arena));
+
+    char *data = cursor + sizeof (cellstr_arena *);
+    std::memcpy (data, s.data (), len);
+
+    cursor += arena_slot_size (len);
+
+    ++arena->refcount;
+
+    Array<char> slice (data,
+                       dim_vector (1, static_cast<octave_idx_type> (len)),
+                       release_arena_slice);
+
+    return octave_value (charMatrix (slice), '\'');
+  }
+}
+
 Cell::Cell (const octave_value_list& ovl)
   : Array<octave_value> (ovl.cell_value ())
 { }
@@ -47,6 +119,31 @@ Cell::Cell (const string_vector& sv, bool trim)
     {
       resize (dim_vector (n, 1));
 
+      std::size_t total = sizeof (cellstr_arena);
+
+      for (octave_idx_type i = 0; i < n; i++)
+        {
+          std::size_t len = sv[i].length ();
+
+          if (trim)
+            {
+              std::size_t pos = sv[i].find_last_not_of (' ');
+
+              len = (pos == std::string::npos) ? 0 : pos + 1;
+            }
+
+          if (len > 0)
+            total += arena_slot_size (len);
+        }
+
+      cellstr_arena *arena
+        = static_cast<cellstr_arena *> (std::malloc (total));
+
+      if (arena)
+        new (arena) cellstr_arena {{1}};
+
+      char *cursor = reinterpret_cast<char *> (arena) + sizeof (cellstr_arena);
+
       for (octave_idx_type i = 0; i < n; i++)
         {
           std::string s = sv[i];
@@ -58,8 +155,14 @@ Cell::Cell (const string_vector& sv, bool trim)
               s = (pos == std::string::npos) ? "" : s.substr (0, pos+1);
             }
 
-          elem (i, 0) = s;
+          if (arena && ! s.empty ())
+            elem (i, 0) = pack_string (s, arena, cursor);
+          else
+            elem (i, 0) = s;
         }
+
+      if (arena && --arena->refcount == 0)
+        std::free (arena);
     }
 }
 
@@ -72,11 +175,35 @@ Cell::Cell (const std::list<std::string>& sl)
     {
       resize (dim_vector (n, 1));
 
+      std::size_t total = sizeof (cellstr_arena);
+
+      for (const auto& s : sl)
+        {
+          if (! s.empty ())
+            total += arena_slot_size (s.length ());
+        }
+
+      cellstr_arena *arena
+        = static_cast<cellstr_arena *> (std::malloc (total));
+
+      if (arena)
+        new (arena) cellstr_arena {{1}};
+
+      char *cursor = reinterpret_cast<char *> (arena) + sizeof (cellstr_arena);
+
       octave_value *dst = fortran_vec ();
-      auto p = sl.begin ();
+      octave_idx_type i = 0;
 
-      for (octave_idx_type i = 0; i < n; i++)
-        dst[i] = *p++;
+      for (const auto& s : sl)
+        {
+          if (arena && ! s.empty ())
+            dst[i++] = pack_string (s, arena, cursor);
+          else
+            dst[i++] = s;
+        }
+
+      if (arena && --arena->refcount == 0)
+        std::free (arena);
     }
 }
 
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "oct-locbuf.h"
+#include "oct-parallel.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Map the value V to its 1-based histogram bin, or 0 if it falls
+// outside the bins (including NaN).  The bins are the half-open
+// intervals [EV(k), EV(k+1)) defined by the NB sorted edges EV, except
+// that the last bin also contains values equal to the last edge.
+
+static octave_idx_type
+histc_bin (double v, const double *ev, octave_idx_type nb,
+           bool uniform, double h)
+{
+  if (! (v >= ev[0] && v <= ev[nb-1]))
+    return 0;
+
+  if (v == ev[nb-1])
+    return nb;
+
+  octave_idx_type j;
+
+  if (uniform)
+    {
+      // The arithmetic index can be off by one from rounding; fix it
+      // up against the exact edges.
+      j = static_cast<octave_idx_type> ((v - ev[0]) / h);
+      j = std::min (std::max (j, static_cast<octave_idx_type> (0)), nb-2);
+      while (v < ev[j])
+        j--;
+      while (v >= ev[j+1])
+        j++;
+    }
+  else
+    j = std::upper_bound (ev, ev + nb, v) - ev - 1;
+
+  return j + 1;
+}
+
+DEFUN (__histc__, args, nargout,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {[@var{n}, @var{idx}] =} __histc__ (@var{x}, @var{edges})
+Undocumented internal function.
+
+Count the elements of @var{x} falling in the bins defined by the sorted
+vector @var{edges}, following the conventions of @code{histc}.  @var{n}
+is the column vector of bin counts and @var{idx} maps each element of
+@var{x} to its 1-based bin, or to 0 if it lies outside the bins.
+@seealso{histc}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  if (! args(0).isreal () || ! args(1).isreal ())
+    error ("__histc__: X and EDGES must be real-valued");
+
+  NDArray x = args(0).array_value ();
+  ColumnVector edges = args(1).vector_value ();
+
+  octave_idx_type n = x.numel ();
+  octave_idx_type nb = edges.numel ();
+
+  if (nb == 0)
+    return ovl (Matrix (), Matrix ());
+
+  const double *xv = x.data ();
+  const double *ev = edges.data ();
+
+  // Uniformly spaced edges admit an arithmetic bin index instead of a
+  // binary search per element.
+
+  double h = (nb > 1 ? (ev[nb-1] - ev[0]) / (nb - 1) : 0.0);
+  bool uniform = nb > 1 && h > 0 && std::isfinite (h);
+  if (uniform)
+    {
+      double tol = 4 * std::numeric_limits<double>::epsilon ()
+                   * std::max (std::abs (ev[0]), std::abs (ev[nb-1]));
+      for (octave_idx_type k = 1; k < nb-1 && uniform; k++)
+        uniform = std::abs (ev[k] - (ev[0] + k * h)) <= tol;
+    }
+
+  ColumnVector counts (nb, 0.0);
+  double *cv = counts.fortran_vec ();
+
+  NDArray bin_idx;
+  double *iv = nullptr;
+  if (nargout > 1)
+    {
+      bin_idx = NDArray (x.dims ());
+      iv = bin_idx.fortran_vec ();
+    }
+
+  octave_idx_type nthr = parallel_num_threads ();
+  if (nthr < 1)
+    nthr = 1;
+
+  // Each thread counts a contiguous slice of X into its own array;
+  // the per-thread counts are merged serially afterwards.
+
+  OCTAVE_LOCAL_BUFFER (octave_idx_type, thr_counts, nthr * nb);
+
+  octave_idx_type *tcv = thr_counts;
+
+  chunked_parallel_for
+    (nthr, n,
+     [=] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type t = beg; t < beg + len; t++)
+         {
+           octave_idx_type *c = tcv + t * nb;
+           std::fill_n (c, nb, 0);
+
+           octave_idx_type lo = t * (n / nthr) + std::min (t, n % nthr);
+           octave_idx_type hi = lo + n / nthr + (t < n % nthr ? 1 : 0);
+
+           for (octave_idx_type i = lo; i < hi; i++)
+             {
+               octave_idx_type b = histc_bin (xv[i], ev, nb, uniform, h);
+               if (b)
+                 c[b-1]++;
+               if (iv)
+                 iv[i] = b;
+             }
+         }
+     });
+
+  for (octave_idx_type t = 0; t < nthr; t++)
+    for (octave_idx_type k = 0; k < nb; k++)
+      cv[k] += thr_counts[t * nb + k];
+
+  if (nargout > 1)
+    return ovl (counts, bin_idx);
+  else
+    return ovl (counts);
+}
+
+/*
+%!assert (__histc__ (1:10, [1 5 10]), [4; 5; 1])
+%!assert (__histc__ ([0.5 1 3.5 Inf -Inf NaN], 1:4), [1; 0; 1; 0])
+
+%!test
+%! ## non-uniform edges take the binary search path
+%! e = [0 1 10 100];
+%! [n, idx] = __histc__ ([0.5 5 50 100 -1], e);
+%! assert (n, [1; 1; 1; 1]);
+%! assert (idx, [1 2 3 4 0]);
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cmath>
+#include <map>
+#include <memory>
+
+#include "kdtree.h"
+#include "oct-locbuf.h"
+#include "oct-parallel.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Built trees are kept across calls and referenced by numeric handle,
+// so that a point set indexed once can serve many query batches.
+
+static std::map<octave_idx_type, std::shared_ptr<kdtree>> kdtree_map;
+
+static octave_idx_type kdtree_next_handle = 1;
+
+static std::shared_ptr<kdtree>
+lookup_kdtree (const octave_value& ov)
+{
+  octave_idx_type h = ov.xidx_type_value ("__kdtree__: invalid tree handle");
+
+  auto p = kdtree_map.find (h);
+
+  if (p == kdtree_map.end ())
+    error ("__kdtree__: no k-d tree with handle %" OCTAVE_IDX_TYPE_FORMAT, h);
+
+  return p->second;
+}
+
+DEFUN (__kdtree_build__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{h} =} __kdtree_build__ (@var{x})
+Undocumented internal function.
+
+Build a k-d tree over the rows of the real matrix @var{x} and return a
+numeric handle for use with @code{__kdtree_search__}.  The tree
+persists until passed to @code{__kdtree_delete__}.
+@seealso{__kdtree_search__, __kdtree_delete__}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  if (! args(0).isreal ())
+    error ("__kdtree_build__: X must be a real matrix");
+
+  Matrix x = args(0).matrix_value ();
+
+  octave_idx_type h = kdtree_next_handle++;
+  kdtree_map[h] = std::make_shared<kdtree> (x);
+
+  return ovl (h);
+}
+
+DEFUN (__kdtree_search__, args, nargout,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {[@var{idx}, @var{d}] =} __kdtree_search__ (@var{h}, @var{q}, @var{k})
+Undocumented internal function.
+
+Find the @var{k} nearest neighbors of each row of @var{q} among the
+points indexed by the k-d tree @var{h}.  @var{idx} contains 1-based
+point indices, one row per query, ordered by increasing distance, and
+@var{d} the corresponding Euclidean distances.  Queries are
+distributed across threads.
+@seealso{__kdtree_build__, __kdtree_delete__}
+@end deftypefn */)
+{
+  if (args.length () != 3)
+    print_usage ();
+
+  std::shared_ptr<kdtree> t = lookup_kdtree (args(0));
+
+  if (! args(1).isreal ())
+    error ("__kdtree_search__: Q must be a real matrix");
+
+  Matrix q = args(1).matrix_value ();
+
+  octave_idx_type k = args(2).xidx_type_value ("__kdtree_search__: K must be a positive integer");
+
+  if (k < 1)
+    error ("__kdtree_search__: K must be a positive integer");
+
+  if (q.cols () != t->ndims ())
+    error ("__kdtree_search__: Q must have %" OCTAVE_IDX_TYPE_FORMAT
+           " columns", t->ndims ());
+
+  if (k > t->numel ())
+    k = t->numel ();
+
+  octave_idx_type m = q.rows ();
+  octave_idx_type d = q.cols ();
+
+  Matrix idx (m, k);
+  Matrix dist (m, k);
+
+  const double *qv = q.data ();
+  double *iv = idx.fortran_vec ();
+  double *dv = dist.fortran_vec ();
+
+  const kdtree *tp = t.get ();
+
+  chunked_parallel_for
+    (m, m * t->numel (),
+     [=] (octave_idx_type beg, octave_idx_type len)
+     {
+       OCTAVE_LOCAL_BUFFER (double, qbuf, d);
+       OCTAVE_LOCAL_BUFFER (octave_idx_type, ibuf, k);
+       OCTAVE_LOCAL_BUFFER (double, dbuf, k);
+
+       for (octave_idx_type i = beg; i < beg + len; i++)
+         {
+           for (octave_idx_type c = 0; c < d; c++)
+             qbuf[c] = qv[i + c * m];
+
+           tp->knn (qbuf, k, ibuf, dbuf);
+
+           for (octave_idx_type c = 0; c < k; c++)
+             {
+               iv[i + c * m] = ibuf[c] + 1;
+               dv[i + c * m] = std::sqrt (dbuf[c]);
+             }
+         }
+     });
+
+  if (nargout > 1)
+    return ovl (idx, dist);
+  else
+    return ovl (idx);
+}
+
+DEFUN (__kdtree_delete__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} __kdtree_delete__ (@var{h})
+Undocumented internal function.
+
+Release the k-d tree with handle @var{h}.
+@seealso{__kdtree_build__, __kdtree_search__}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_idx_type h = args(0).xidx_type_value ("__kdtree_delete__: invalid tree handle");
+
+  if (kdtree_map.erase (h) == 0)
+    error ("__kdtree_delete__: no k-d tree with handle %" OCTAVE_IDX_TYPE_FORMAT, h);
+
+  return ovl ();
+}
+
+/*
+%!error __kdtree_search__ ()
+%!error <no k-d tree> __kdtree_delete__ (-1)
+
+%!test
+%! x = [0 0; 1 0; 0 1; 5 5; 5 6];
+%! h = __kdtree_build__ (x);
+%! [idx, d] = __kdtree_search__ (h, [0.1 0.1; 5 5.4], 2);
+%! assert (idx, [1 2; 4 5]);
+%! assert (d(1,1), hypot (0.1, 0.1), 10*eps);
+%! __kdtree_delete__ (h);
+%! fail ("__kdtree_search__ (h, [0 0], 1)", "no k-d tree");
+
+%!test
+%! ## results agree with brute force on random data
+%! x = rand (200, 3);
+%! q = rand (17, 3);
+%! h = __kdtree_build__ (x);
+%! [idx, d] = __kdtree_search__ (h, q, 5);
+%! for i = 1:rows (q)
+%!   dd = sqrt (sumsq (x - q(i,:), 2));
+%!   [ds, is] = sort (dd);
+%!   assert (idx(i,:), is(1:5)', 0);
+%!   assert (d(i,:), ds(1:5)', 100*eps);
+%! endfor
+%! __kdtree_delete__ (h);
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -30,6 +30,7 @@
 #include "lo-ieee.h"
 #include "dNDArray.h"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
 
 #include "defun.h"
 #include "error.h"
@@ -135,56 +136,63 @@ lin_interpn (int n, const octave_idx_type *size, const octave_idx_type *scale,
              octave_idx_type Ni, DT extrapval, const T **x,
              const DT *v, const T **y, DT *vi)
 {
-  bool out = false;
-  int bit;
-
-  OCTAVE_LOCAL_BUFFER (T, coef, 2*n);
-  OCTAVE_LOCAL_BUFFER (octave_idx_type, index, n);
-
-  // loop over all points
-  for (octave_idx_type m = 0; m < Ni; m++)
-    {
-      // loop over all dimensions
-      for (int i = 0; i < n; i++)
-        {
-          index[i] = lookup (x[i], size[i], y[i][m]);
-          out = index[i] == -1;
-
-          if (out)
-            break;
-          else
-            {
-              octave_idx_type j = index[i];
-              coef[2*i+1] = (y[i][m] - x[i][j])/(x[i][j+1] - x[i][j]);
-              coef[2*i] = 1 - coef[2*i+1];
-            }
-        }
-
-      if (out)
-        vi[m] = extrapval;
-      else
-        {
-          vi[m] = 0;
-
-          // loop over all corners of hypercube (1<<n = 2^n)
-          for (int i = 0; i < (1 << n); i++)
-            {
-              T c = 1;
-              octave_idx_type l = 0;
-
-              // loop over all dimensions
-              for (int j = 0; j < n; j++)
-                {
-                  // test if the jth bit in i is set
-                  bit = i >> j & 1;
-                  l += scale[j] * (index[j] + bit);
-                  c *= coef[2*j+bit];
-                }
-
-              vi[m] += c * v[l];
-            }
-        }
-    }
+  // Each query point is looked up and interpolated independently, so
+  // large batches are split across threads.  Every point touches the
+  // 2^n corners of its hypercube, which is what the split is gated on.
+
+  chunked_parallel_for (Ni, Ni * (octave_idx_type (1) << n),
+                        [=] (octave_idx_type start, octave_idx_type len)
+  {
+    OCTAVE_LOCAL_BUFFER (T, coef, 2*n);
+    OCTAVE_LOCAL_BUFFER (octave_idx_type, index, n);
+
+    // loop over all points
+    for (octave_idx_type m = start; m < start + len; m++)
+      {
+        bool out = false;
+
+        // loop over all dimensions
+        for (int i = 0; i < n; i++)
+          {
+            index[i] = lookup (x[i], size[i], y[i][m]);
+            out = index[i] == -1;
+
+            if (out)
+              break;
+            else
+              {
+                octave_idx_type j = index[i];
+                coef[2*i+1] = (y[i][m] - x[i][j])/(x[i][j+1] - x[i][j]);
+                coef[2*i] = 1 - coef[2*i+1];
+              }
+          }
+
+        if (out)
+          vi[m] = extrapval;
+        else
+          {
+            vi[m] = 0;
+
+            // loop over all corners of hypercube (1<<n = 2^n)
+            for (int i = 0; i < (1 << n); i++)
+              {
+                T c = 1;
+                octave_idx_type l = 0;
+
+                // loop over all dimensions
+                for (int j = 0; j < n; j++)
+                  {
+                    // test if the jth bit in i is set
+                    int bit = i >> j & 1;
+                    l += scale[j] * (index[j] + bit);
+                    c *= coef[2*j+bit];
+                  }
+
+                vi[m] += c * v[l];
+              }
+          }
+      }
+  });
 }
 
 template <typename MT, typename DMT, typename DT>
@@ -41,6 +41,8 @@
 #if defined (HAVE_MAGICK)
 #  include <Magick++.h>
 #  include <clocale>
+#  include <thread>
+#  include <vector>
 // FIXME: The following using declaration may be needed to build with
 // ImageMagick.  It doesn't appear to be needed for GraphicsMagick but
 // it also doesn't seem to cause trouble.  A configure test would be
@@ -278,6 +280,45 @@ read_maps (Magick::Image& img)
   return maps;
 }
 
+// Convert the pixels of one frame in parallel blocks of columns.
+// CONVERT is called as convert (col0, col1) and must only touch the
+// destination elements of those columns.  The blocks share the frame's
+// constant pixel cache and write to disjoint ranges of the output, so
+// no locking is needed, and no Magick++ calls may be made from inside
+// CONVERT.  Small frames are converted inline since threads would cost
+// more than they save.
+
+template <typename F>
+static void
+convert_frame_columns (octave_idx_type nRows, octave_idx_type nCols,
+                       F&& convert)
+{
+  static const octave_idx_type small_frame = 1 << 20;
+
+  unsigned int max_threads = std::thread::hardware_concurrency ();
+
+  if (nRows * nCols < small_frame || max_threads < 2)
+    {
+      convert (0, nCols);
+      return;
+    }
+
+  const octave_idx_type nblocks
+    = std::min (static_cast<octave_idx_type> (max_threads), nCols);
+
+  std::vector<std::thread> threads;
+  threads.reserve (nblocks - 1);
+
+  for (octave_idx_type i = 1; i < nblocks; i++)
+    threads.emplace_back (convert, nCols * i / nblocks,
+                          nCols * (i+1) / nblocks);
+
+  convert (0, nCols / nblocks);
+
+  for (auto& thr : threads)
+    thr.join ();
+}
+
 template <typename T>
 static octave_value_list
 read_indexed_images (const std::vector<Magick::Image>& imvec,
@@ -313,7 +354,7 @@ read_indexed_images (const std::vector<Magick::Image>& imvec,
   // When reading PixelPackets from the Image Pixel Cache, they come in
   // row major order.  So we keep moving back and forth there so we can
   // write the image in column major order.
-  octave_idx_type idx = 0;
+  const octave_idx_type col_stride = nRows * row_shift - col_shift;
   for (octave_idx_type frame = 0; frame < nFrames; frame++)
     {
       octave_quit ();
@@ -324,15 +365,24 @@ read_indexed_images (const std::vector<Magick::Image>& imvec,
       const Magick::IndexPacket *pix
         = imvec[frameidx(frame)].getConstIndexes ();
 
-      for (octave_idx_type col = 0; col < nCols; col++)
+      P *fbuf = img_fvec + frame * nRows * nCols;
+
+      convert_frame_columns (nRows, nCols,
+        [=] (octave_idx_type col0, octave_idx_type col1)
         {
-          for (octave_idx_type row = 0; row < nRows; row++)
+          const Magick::IndexPacket *p = pix + col0 * col_stride;
+          octave_idx_type idx = col0 * nRows;
+
+          for (octave_idx_type col = col0; col < col1; col++)
             {
-              img_fvec[idx++] = static_cast<P> (*pix);
-              pix += row_shift;
+              for (octave_idx_type row = 0; row < nRows; row++)
+                {
+                  fbuf[idx++] = static_cast<P> (*p);
+                  p += row_shift;
+                }
+              p -= col_shift;
             }
-          pix -= col_shift;
-        }
+        });
     }
   retval(0) = octave_value (img);
 
@@ -521,6 +571,12 @@ read_images (std::vector<Magick::Image>& imvec,
     }
 
   const octave_idx_type color_stride = nRows * nCols;
+
+  // Net advance of the pixel cache pointer from the top of one output
+  // column to the top of the next, used to start conversion blocks in
+  // the middle of a frame.
+  const octave_idx_type col_stride = nRows * row_shift - col_shift;
+
   switch (type)
     {
     case Magick::BilevelType:           // Monochrome bi-level image
@@ -529,7 +585,6 @@ read_images (std::vector<Magick::Image>& imvec,
         img = T (dim_vector (nRows, nCols, 1, nFrames));
         P *img_fvec = img.fortran_vec ();
 
-        octave_idx_type idx = 0;
         for (octave_idx_type frame = 0; frame < nFrames; frame++)
           {
             octave_quit ();
@@ -538,15 +593,24 @@ read_images (std::vector<Magick::Image>& imvec,
               = imvec[frameidx(frame)].getConstPixels (col_start, row_start,
                   col_cache, row_cache);
 
-            for (octave_idx_type col = 0; col < nCols; col++)
+            P *fbuf = img_fvec + frame * color_stride;
+
+            convert_frame_columns (nRows, nCols,
+              [=] (octave_idx_type col0, octave_idx_type col1)
               {
-                for (octave_idx_type row = 0; row < nRows; row++)
+                const Magick::PixelPacket *p = pix + col0 * col_stride;
+                octave_idx_type idx = col0 * nRows;
+
+                for (octave_idx_type col = col0; col < col1; col++)
                   {
-                    img_fvec[idx++] = pix->red / divisor;
-                    pix += row_shift;
+                    for (octave_idx_type row = 0; row < nRows; row++)
+                      {
+                        fbuf[idx++] = p->red / divisor;
+                        p += row_shift;
+                      }
+                    p -= col_shift;
                   }
-                pix -= col_shift;
-              }
+              });
           }
         break;
       }
@@ -558,7 +622,6 @@ read_images (std::vector<Magick::Image>& imvec,
         P *img_fvec = img.fortran_vec ();
         P *a_fvec   = alpha.fortran_vec ();
 
-        octave_idx_type idx = 0;
         for (octave_idx_type frame = 0; frame < nFrames; frame++)
           {
             octave_quit ();
@@ -567,17 +630,27 @@ read_images (std::vector<Magick::Image>& imvec,
               = imvec[frameidx(frame)].getConstPixels (col_start, row_start,
                   col_cache, row_cache);
 
-            for (octave_idx_type col = 0; col < nCols; col++)
+            P *fbuf = img_fvec + frame * color_stride;
+            P *abuf = a_fvec + frame * color_stride;
+
+            convert_frame_columns (nRows, nCols,
+              [=] (octave_idx_type col0, octave_idx_type col1)
               {
-                for (octave_idx_type row = 0; row < nRows; row++)
+                const Magick::PixelPacket *p = pix + col0 * col_stride;
+                octave_idx_type idx = col0 * nRows;
+
+                for (octave_idx_type col = col0; col < col1; col++)
                   {
-                    img_fvec[idx] = pix->red / divisor;
-                    a_fvec[idx]   = (MaxRGB - pix->opacity) / divisor;
-                    pix += row_shift;
-                    idx++;
+                    for (octave_idx_type row = 0; row < nRows; row++)
+                      {
+                        fbuf[idx] = p->red / divisor;
+                        abuf[idx] = (MaxRGB - p->opacity) / divisor;
+                        p += row_shift;
+                        idx++;
+                      }
+                    p -= col_shift;
                   }
-                pix -= col_shift;
-              }
+              });
           }
         retval(2) = alpha;
         break;
@@ -598,23 +671,29 @@ read_images (std::vector<Magick::Image>& imvec,
               = imvec[frameidx(frame)].getConstPixels (col_start, row_start,
                   col_cache, row_cache);
 
-            octave_idx_type idx = 0;
             P *rbuf = img_fvec;
             P *gbuf = img_fvec + color_stride;
             P *bbuf = img_fvec + color_stride * 2;
 
-            for (octave_idx_type col = 0; col < nCols; col++)
+            convert_frame_columns (nRows, nCols,
+              [=] (octave_idx_type col0, octave_idx_type col1)
               {
-                for (octave_idx_type row = 0; row < nRows; row++)
+                const Magick::PixelPacket *p = pix + col0 * col_stride;
+                octave_idx_type idx = col0 * nRows;
+
+                for (octave_idx_type col = col0; col < col1; col++)
                   {
-                    rbuf[idx] = pix->red   / divisor;
-                    gbuf[idx] = pix->green / divisor;
-                    bbuf[idx] = pix->blue  / divisor;
-                    pix += row_shift;
-                    idx++;
+                    for (octave_idx_type row = 0; row < nRows; row++)
+                      {
+                        rbuf[idx] = p->red   / divisor;
+                        gbuf[idx] = p->green / divisor;
+                        bbuf[idx] = p->blue  / divisor;
+                        p += row_shift;
+                        idx++;
+                      }
+                    p -= col_shift;
                   }
-                pix -= col_shift;
-              }
+              });
             img_fvec += frame_stride;
           }
         break;
@@ -630,9 +709,6 @@ read_images (std::vector<Magick::Image>& imvec,
 
         const octave_idx_type frame_stride = color_stride * 3;
 
-        // Unlike the index for the other channels, this one won't need
-        // to be reset on each frame since it's a separate matrix.
-        octave_idx_type a_idx = 0;
         for (octave_idx_type frame = 0; frame < nFrames; frame++)
           {
             octave_quit ();
@@ -641,24 +717,34 @@ read_images (std::vector<Magick::Image>& imvec,
               = imvec[frameidx(frame)].getConstPixels (col_start, row_start,
                   col_cache, row_cache);
 
-            octave_idx_type idx = 0;
             P *rbuf = img_fvec;
             P *gbuf = img_fvec + color_stride;
             P *bbuf = img_fvec + color_stride * 2;
 
-            for (octave_idx_type col = 0; col < nCols; col++)
+            // The alpha channel is a separate matrix, so its offset
+            // does not restart with each frame.
+            P *abuf = a_fvec + frame * color_stride;
+
+            convert_frame_columns (nRows, nCols,
+              [=] (octave_idx_type col0, octave_idx_type col1)
               {
-                for (octave_idx_type row = 0; row < nRows; row++)
+                const Magick::PixelPacket *p = pix + col0 * col_stride;
+                octave_idx_type idx = col0 * nRows;
+
+                for (octave_idx_type col = col0; col < col1; col++)
                   {
-                    rbuf[idx]     = pix->red     / divisor;
-                    gbuf[idx]     = pix->green   / divisor;
-                    bbuf[idx]     = pix->blue    / divisor;
-                    a_fvec[a_idx++] = (MaxRGB - pix->opacity) / divisor;
-                    pix += row_shift;
-                    idx++;
+                    for (octave_idx_type row = 0; row < nRows; row++)
+                      {
+                        rbuf[idx] = p->red   / divisor;
+                        gbuf[idx] = p->green / divisor;
+                        bbuf[idx] = p->blue  / divisor;
+                        abuf[idx] = (MaxRGB - p->opacity) / divisor;
+                        p += row_shift;
+                        idx++;
+                      }
+                    p -= col_shift;
                   }
-                pix -= col_shift;
-              }
+              });
             img_fvec += frame_stride;
           }
         retval(2) = alpha;
@@ -679,25 +765,31 @@ read_images (std::vector<Magick::Image>& imvec,
               = imvec[frameidx(frame)].getConstPixels (col_start, row_start,
                   col_cache, row_cache);
 
-            octave_idx_type idx = 0;
             P *cbuf = img_fvec;
             P *mbuf = img_fvec + color_stride;
             P *ybuf = img_fvec + color_stride * 2;
             P *kbuf = img_fvec + color_stride * 3;
 
-            for (octave_idx_type col = 0; col < nCols; col++)
+            convert_frame_columns (nRows, nCols,
+              [=] (octave_idx_type col0, octave_idx_type col1)
               {
-                for (octave_idx_type row = 0; row < nRows; row++)
+                const Magick::PixelPacket *p = pix + col0 * col_stride;
+                octave_idx_type idx = col0 * nRows;
+
+                for (octave_idx_type col = col0; col < col1; col++)
                   {
-                    cbuf[idx] = pix->red     / divisor;
-                    mbuf[idx] = pix->green   / divisor;
-                    ybuf[idx] = pix->blue    / divisor;
-                    kbuf[idx] = pix->opacity / divisor;
-                    pix += row_shift;
-                    idx++;
+                    for (octave_idx_type row = 0; row < nRows; row++)
+                      {
+                        cbuf[idx] = p->red     / divisor;
+                        mbuf[idx] = p->green   / divisor;
+                        ybuf[idx] = p->blue    / divisor;
+                        kbuf[idx] = p->opacity / divisor;
+                        p += row_shift;
+                        idx++;
+                      }
+                    p -= col_shift;
                   }
-                pix -= col_shift;
-              }
+              });
             img_fvec += frame_stride;
           }
         break;
@@ -713,9 +805,6 @@ read_images (std::vector<Magick::Image>& imvec,
 
         const octave_idx_type frame_stride = color_stride * 4;
 
-        // Unlike the index for the other channels, this one won't need
-        // to be reset on each frame since it's a separate matrix.
-        octave_idx_type a_idx = 0;
         for (octave_idx_type frame = 0; frame < nFrames; frame++)
           {
             octave_quit ();
@@ -728,26 +817,36 @@ read_images (std::vector<Magick::Image>& imvec,
             const Magick::IndexPacket *apix
               = imvec[frameidx(frame)].getConstIndexes ();
 
-            octave_idx_type idx = 0;
             P *cbuf = img_fvec;
             P *mbuf = img_fvec + color_stride;
             P *ybuf = img_fvec + color_stride * 2;
             P *kbuf = img_fvec + color_stride * 3;
 
-            for (octave_idx_type col = 0; col < nCols; col++)
+            // The alpha channel is a separate matrix, so its offset
+            // does not restart with each frame.
+            P *abuf = a_fvec + frame * color_stride;
+
+            convert_frame_columns (nRows, nCols,
+              [=] (octave_idx_type col0, octave_idx_type col1)
               {
-                for (octave_idx_type row = 0; row < nRows; row++)
+                const Magick::PixelPacket *p = pix + col0 * col_stride;
+                octave_idx_type idx = col0 * nRows;
+
+                for (octave_idx_type col = col0; col < col1; col++)
                   {
-                    cbuf[idx]     = pix->red     / divisor;
-                    mbuf[idx]     = pix->green   / divisor;
-                    ybuf[idx]     = pix->blue    / divisor;
-                    kbuf[idx]     = pix->opacity / divisor;
-                    a_fvec[a_idx++] = (MaxRGB - *apix) / divisor;
-                    pix += row_shift;
-                    idx++;
+                    for (octave_idx_type row = 0; row < nRows; row++)
+                      {
+                        cbuf[idx] = p->red     / divisor;
+                        mbuf[idx] = p->green   / divisor;
+                        ybuf[idx] = p->blue    / divisor;
+                        kbuf[idx] = p->opacity / divisor;
+                        abuf[idx] = (MaxRGB - *apix) / divisor;
+                        p += row_shift;
+                        idx++;
+                      }
+                    p -= col_shift;
                   }
-                pix -= col_shift;
-              }
+              });
             img_fvec += frame_stride;
           }
         retval(2) = alpha;
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "dMatrix.h"
+#include "dSparse.h"
+#include "oct-locbuf.h"
+#include "quit.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Compiled core of the conjugate gradient method for the common case
+// handled by the fast path in pcg.m: a real sparse matrix, no
+// preconditioner, and no eigenvalue estimate.  The iteration follows
+// the m-file loop step for step (including the stagnation and
+// positive-definiteness checks and the minimum-residual iterate) so
+// that the fast path reports the same flags and history as the
+// interpreted implementation.
+
+// w = A*p for a compressed-column matrix.
+
+static void
+pcg_matvec (const SparseMatrix& A, const double *p, double *w)
+{
+  octave_idx_type nr = A.rows ();
+  octave_idx_type nc = A.cols ();
+  const octave_idx_type *cidx = A.cidx ();
+  const octave_idx_type *ridx = A.ridx ();
+  const double *data = A.data ();
+
+  for (octave_idx_type i = 0; i < nr; i++)
+    w[i] = 0.0;
+
+  for (octave_idx_type j = 0; j < nc; j++)
+    {
+      double t = p[j];
+      if (t != 0.0)
+        {
+          for (octave_idx_type i = cidx[j]; i < cidx[j+1]; i++)
+            w[ridx[i]] += data[i] * t;
+        }
+    }
+}
+
+static double
+pcg_dot (octave_idx_type n, const double *a, const double *b)
+{
+  double sum = 0.0;
+  for (octave_idx_type i = 0; i < n; i++)
+    sum += a[i] * b[i];
+  return sum;
+}
+
+DEFUN (__pcg__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {[@var{x}, @var{flag}, @var{relres}, @var{iter}, @var{resvec}] =} __pcg__ (@var{A}, @var{b}, @var{tol}, @var{maxit}, @var{x0})
+Undocumented internal function.
+
+Conjugate gradient iteration on a real sparse matrix without
+preconditioning; called from @code{pcg}.
+@end deftypefn */)
+{
+  if (args.length () != 5)
+    print_usage ();
+
+  SparseMatrix A = args(0).sparse_matrix_value ();
+  Matrix b = args(1).matrix_value ();
+  double tol = args(2).double_value ();
+  octave_idx_type maxit = args(3).idx_type_value ();
+  Matrix x0 = args(4).matrix_value ();
+
+  octave_idx_type n = b.numel ();
+
+  if (A.rows () != n || A.cols () != n || x0.numel () != n)
+    error ("__pcg__: nonconformant arguments");
+
+  const double *bv = b.data ();
+
+  double b_norm = std::sqrt (pcg_dot (n, bv, bv));
+
+  if (b_norm == 0.0)
+    return ovl (b, 0.0, 0.0, 0.0, 0.0);
+
+  // As in pcg.m, two extra iterations cover the initial residual and
+  // the final bookkeeping.
+
+  maxit += 2;
+
+  OCTAVE_LOCAL_BUFFER (double, xv, n);
+  OCTAVE_LOCAL_BUFFER (double, x_pr, n);
+  OCTAVE_LOCAL_BUFFER (double, x_min, n);
+  OCTAVE_LOCAL_BUFFER (double, rv, n);
+  OCTAVE_LOCAL_BUFFER (double, pv, n);
+  OCTAVE_LOCAL_BUFFER (double, wv, n);
+
+  const double *x0v = x0.data ();
+
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      xv[i] = x_pr[i] = x_min[i] = x0v[i];
+      pv[i] = 0.0;
+    }
+
+  pcg_matvec (A, xv, wv);
+
+  for (octave_idx_type i = 0; i < n; i++)
+    rv[i] = bv[i] - wv[i];
+
+  std::vector<double> resvec (maxit + 1, 0.0);
+  resvec[0] = std::sqrt (pcg_dot (n, rv, rv));
+
+  octave_idx_type iter = 2;
+  octave_idx_type iter_min = 0;
+  int flag = 1;
+  double old_tau = 1.0;
+  const double eps = std::numeric_limits<double>::epsilon ();
+
+  while (resvec[iter-2] > tol * b_norm && iter < maxit)
+    {
+      octave_quit ();
+
+      double tau = pcg_dot (n, rv, rv);
+      double beta = tau / old_tau;
+      old_tau = tau;
+
+      for (octave_idx_type i = 0; i < n; i++)
+        pv[i] = rv[i] + beta * pv[i];
+
+      pcg_matvec (A, pv, wv);
+
+      double den = pcg_dot (n, pv, wv);
+      double alpha = tau / den;
+
+      // A nonpositive product means A is probably not positive
+      // definite.
+
+      if (tau <= 0.0 || den <= 0.0)
+        {
+          flag = 4;
+          break;
+        }
+
+      // Fused update of the iterate and the residual.
+
+      for (octave_idx_type i = 0; i < n; i++)
+        {
+          xv[i] += alpha * pv[i];
+          rv[i] -= alpha * wv[i];
+        }
+
+      resvec[iter-1] = std::sqrt (pcg_dot (n, rv, rv));
+
+      if (resvec[iter-1] <= resvec[iter_min])
+        {
+          for (octave_idx_type i = 0; i < n; i++)
+            x_min[i] = xv[i];
+          iter_min = iter - 1;
+        }
+
+      iter++;
+
+      // Check for stagnation.
+
+      double dnrm = 0.0;
+      double xnrm = 0.0;
+      for (octave_idx_type i = 0; i < n; i++)
+        {
+          double d = xv[i] - x_pr[i];
+          dnrm += d * d;
+          xnrm += xv[i] * xv[i];
+        }
+
+      if (std::sqrt (dnrm) <= eps * std::sqrt (xnrm))
+        {
+          flag = 3;
+          break;
+        }
+
+      for (octave_idx_type i = 0; i < n; i++)
+        x_pr[i] = xv[i];
+    }
+
+  double relres = (resvec[0] == 0.0
+                   ? 0.0 : resvec[iter_min] / b_norm);
+
+  if (flag == 1 && relres <= tol)
+    flag = 0;
+
+  Matrix x (n, 1);
+  for (octave_idx_type i = 0; i < n; i++)
+    x.xelem (i) = x_min[i];
+
+  Matrix res (iter - 1, 1);
+  for (octave_idx_type i = 0; i < iter - 1; i++)
+    res.xelem (i) = resvec[i];
+
+  return ovl (x, flag, relres, iter_min, res);
+}
+
+OCTAVE_END_NAMESPACE(octave)
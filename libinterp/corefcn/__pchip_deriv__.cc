@@ -27,7 +27,10 @@
 #  include "config.h"
 #endif
 
+#include <atomic>
+
 #include "lo-slatec-proto.h"
+#include "oct-parallel.h"
 
 #include "defun.h"
 #include "error.h"
@@ -73,33 +76,54 @@ Undocumented internal function.
 
               FloatComplexMatrix dmat (nyr, nyc);
 
-              F77_INT ierr;
               const F77_INT incfd = (rows ? to_f77_int (2*nyr) : 2);
-              volatile const octave_idx_type inc = (rows ? 2 : 2*nyr);
-              volatile octave_idx_type k = 0;
-
-              for (volatile octave_idx_type i = (rows ? nyr : nyc); i > 0; i--)
-                {
-                  F77_XFCN (pchim, PCHIM, (nx, xvec.data (),
-                                           reinterpret_cast<float const *>(ymat.data ()) + k * inc,
-                                           reinterpret_cast<float *>(dmat.fortran_vec ()) + k * inc,
-                                           incfd, ierr));
-
-                  if (ierr < 0)
-                    error ("__pchip_deriv__: PCHIM failed for real part with ierr = %"
-                           OCTAVE_F77_INT_TYPE_FORMAT, ierr);
-
-                  F77_XFCN (pchim, PCHIM, (nx, xvec.data (),
-                                           reinterpret_cast<float const *>(ymat.data ()) + 1 + k * inc,
-                                           reinterpret_cast<float *>(dmat.fortran_vec ()) + 1 + k * inc,
-                                           incfd, ierr));
-
-                  if (ierr < 0)
-                    error ("__pchip_deriv__: PCHIM failed for imaginary part with ierr = %"
-                           OCTAVE_F77_INT_TYPE_FORMAT, ierr);
-
-                  k++;
-                }
+              const octave_idx_type inc = (rows ? 2 : 2*nyr);
+              const octave_idx_type ncol = (rows ? nyr : nyc);
+
+              const float *px = xvec.data ();
+              const float *py
+                = reinterpret_cast<const float *> (ymat.data ());
+              float *pd = reinterpret_cast<float *> (dmat.fortran_vec ());
+
+              // Each column is an independent interpolation problem, so
+              // large sets are split across threads.  A failure depends
+              // only on X, never on the column data, so it is the same
+              // for every column and is reported after the loop.
+
+              std::atomic<F77_INT> err_re (0), err_im (0);
+
+              chunked_parallel_for (ncol, ncol * nx,
+                                    [=, &err_re, &err_im]
+                                    (octave_idx_type start,
+                                     octave_idx_type len)
+              {
+                for (octave_idx_type k = start; k < start + len; k++)
+                  {
+                    F77_INT ierr;
+
+                    F77_XFCN (pchim, PCHIM, (nx, px, py + k * inc,
+                                             pd + k * inc, incfd, ierr));
+
+                    if (ierr < 0)
+                      err_re = ierr;
+
+                    F77_XFCN (pchim, PCHIM, (nx, px, py + 1 + k * inc,
+                                             pd + 1 + k * inc, incfd, ierr));
+
+                    if (ierr < 0)
+                      err_im = ierr;
+                  }
+              });
+
+              if (err_re < 0)
+                error ("__pchip_deriv__: PCHIM failed for real part with ierr = %"
+                       OCTAVE_F77_INT_TYPE_FORMAT,
+                       static_cast<F77_INT> (err_re));
+
+              if (err_im < 0)
+                error ("__pchip_deriv__: PCHIM failed for imaginary part with ierr = %"
+                       OCTAVE_F77_INT_TYPE_FORMAT,
+                       static_cast<F77_INT> (err_im));
 
               retval = dmat;
             }
@@ -115,24 +139,36 @@ Undocumented internal function.
 
               FloatMatrix dmat (nyr, nyc);
 
-              F77_INT ierr;
               const F77_INT incfd = (rows ? to_f77_int (nyr) : 1);
-              volatile const octave_idx_type inc = (rows ? 1 : nyr);
-              volatile octave_idx_type k = 0;
+              const octave_idx_type inc = (rows ? 1 : nyr);
+              const octave_idx_type ncol = (rows ? nyr : nyc);
+
+              const float *px = xvec.data ();
+              const float *py = ymat.data ();
+              float *pd = dmat.fortran_vec ();
 
-              for (volatile octave_idx_type i = (rows ? nyr : nyc); i > 0; i--)
-                {
-                  F77_XFCN (pchim, PCHIM, (nx, xvec.data (),
-                                           ymat.data () + k * inc,
-                                           dmat.fortran_vec () + k * inc,
-                                           incfd, ierr));
+              std::atomic<F77_INT> err (0);
 
-                  k++;
+              chunked_parallel_for (ncol, ncol * nx,
+                                    [=, &err] (octave_idx_type start,
+                                               octave_idx_type len)
+              {
+                for (octave_idx_type k = start; k < start + len; k++)
+                  {
+                    F77_INT ierr;
 
-                  if (ierr < 0)
-                    error ("__pchip_deriv__: PCHIM failed with ierr = %"
-                           OCTAVE_F77_INT_TYPE_FORMAT, ierr);
-                }
+                    F77_XFCN (pchim, PCHIM, (nx, px, py + k * inc,
+                                             pd + k * inc, incfd, ierr));
+
+                    if (ierr < 0)
+                      err = ierr;
+                  }
+              });
+
+              if (err < 0)
+                error ("__pchip_deriv__: PCHIM failed with ierr = %"
+                       OCTAVE_F77_INT_TYPE_FORMAT,
+                       static_cast<F77_INT> (err));
 
               retval = dmat;
             }
@@ -156,33 +192,50 @@ Undocumented internal function.
 
               ComplexMatrix dmat (nyr, nyc);
 
-              F77_INT ierr;
               const F77_INT incfd = (rows ? to_f77_int (2*nyr) : 2);
-              volatile const octave_idx_type inc = (rows ? 2 : 2*nyr);
-              volatile octave_idx_type k = 0;
-
-              for (volatile octave_idx_type i = (rows ? nyr : nyc); i > 0; i--)
-                {
-                  F77_XFCN (dpchim, DPCHIM, (nx, xvec.data (),
-                                             reinterpret_cast<double const *>(ymat.data ()) + k * inc,
-                                             reinterpret_cast<double *>(dmat.fortran_vec ()) + k * inc,
-                                             incfd, ierr));
-
-                  if (ierr < 0)
-                    error ("__pchip_deriv__: DPCHIM failed for real part with ierr = %"
-                           OCTAVE_F77_INT_TYPE_FORMAT, ierr);
-
-                  F77_XFCN (dpchim, DPCHIM, (nx, xvec.data (),
-                                             reinterpret_cast<double const *>(ymat.data ()) + 1 + k * inc,
-                                             reinterpret_cast<double *>(dmat.fortran_vec ()) + 1 + k * inc,
-                                             incfd, ierr));
-
-                  if (ierr < 0)
-                    error ("__pchip_deriv__: DPCHIM failed for imaginary part with ierr = %"
-                           OCTAVE_F77_INT_TYPE_FORMAT, ierr);
-
-                  k++;
-                }
+              const octave_idx_type inc = (rows ? 2 : 2*nyr);
+              const octave_idx_type ncol = (rows ? nyr : nyc);
+
+              const double *px = xvec.data ();
+              const double *py
+                = reinterpret_cast<const double *> (ymat.data ());
+              double *pd = reinterpret_cast<double *> (dmat.fortran_vec ());
+
+              std::atomic<F77_INT> err_re (0), err_im (0);
+
+              chunked_parallel_for (ncol, ncol * nx,
+                                    [=, &err_re, &err_im]
+                                    (octave_idx_type start,
+                                     octave_idx_type len)
+              {
+                for (octave_idx_type k = start; k < start + len; k++)
+                  {
+                    F77_INT ierr;
+
+                    F77_XFCN (dpchim, DPCHIM, (nx, px, py + k * inc,
+                                               pd + k * inc, incfd, ierr));
+
+                    if (ierr < 0)
+                      err_re = ierr;
+
+                    F77_XFCN (dpchim, DPCHIM, (nx, px, py + 1 + k * inc,
+                                               pd + 1 + k * inc, incfd,
+                                               ierr));
+
+                    if (ierr < 0)
+                      err_im = ierr;
+                  }
+              });
+
+              if (err_re < 0)
+                error ("__pchip_deriv__: DPCHIM failed for real part with ierr = %"
+                       OCTAVE_F77_INT_TYPE_FORMAT,
+                       static_cast<F77_INT> (err_re));
+
+              if (err_im < 0)
+                error ("__pchip_deriv__: DPCHIM failed for imaginary part with ierr = %"
+                       OCTAVE_F77_INT_TYPE_FORMAT,
+                       static_cast<F77_INT> (err_im));
 
               retval = dmat;
             }
@@ -198,23 +251,36 @@ Undocumented internal function.
 
               Matrix dmat (nyr, nyc);
 
-              F77_INT ierr;
               const F77_INT incfd = (rows ? to_f77_int (nyr) : 1);
-              volatile const octave_idx_type inc = (rows ? 1 : nyr);
-              volatile octave_idx_type k = 0;
-
-              for (volatile octave_idx_type i = (rows ? nyr : nyc); i > 0; i--)
-                {
-                  F77_XFCN (dpchim, DPCHIM, (nx, xvec.data (),
-                                             ymat.data () + k * inc,
-                                             dmat.fortran_vec () + k * inc,
-                                             incfd, ierr));
-                  k++;
-
-                  if (ierr < 0)
-                    error ("__pchip_deriv__: DPCHIM failed with ierr = %"
-                           OCTAVE_F77_INT_TYPE_FORMAT, ierr);
-                }
+              const octave_idx_type inc = (rows ? 1 : nyr);
+              const octave_idx_type ncol = (rows ? nyr : nyc);
+
+              const double *px = xvec.data ();
+              const double *py = ymat.data ();
+              double *pd = dmat.fortran_vec ();
+
+              std::atomic<F77_INT> err (0);
+
+              chunked_parallel_for (ncol, ncol * nx,
+                                    [=, &err] (octave_idx_type start,
+                                               octave_idx_type len)
+              {
+                for (octave_idx_type k = start; k < start + len; k++)
+                  {
+                    F77_INT ierr;
+
+                    F77_XFCN (dpchim, DPCHIM, (nx, px, py + k * inc,
+                                               pd + k * inc, incfd, ierr));
+
+                    if (ierr < 0)
+                      err = ierr;
+                  }
+              });
+
+              if (err < 0)
+                error ("__pchip_deriv__: DPCHIM failed with ierr = %"
+                       OCTAVE_F77_INT_TYPE_FORMAT,
+                       static_cast<F77_INT> (err));
 
               retval = dmat;
             }
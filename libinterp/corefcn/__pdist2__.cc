@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "oct-pdist.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+DEFUN (__pdist2__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{d} =} __pdist2__ (@var{x}, @var{y})
+@deftypefnx {} {@var{d} =} __pdist2__ (@var{x}, @var{y}, "squared")
+Undocumented internal function.
+
+Compute the matrix of Euclidean distances between the rows of @var{x}
+and the rows of @var{y}, which must have the same number of columns.
+With the option @qcode{"squared"} the squared distances are returned.
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+
+  bool squared = false;
+  if (nargin == 3)
+    {
+      std::string opt = args(2).xstring_value ("__pdist2__: OPT must be a string");
+      if (opt != "squared")
+        error ("__pdist2__: unrecognized option \"%s\"", opt.c_str ());
+      squared = true;
+    }
+
+  if (! args(0).isreal () || ! args(1).isreal ())
+    error ("__pdist2__: X and Y must be real-valued");
+
+  Matrix x = args(0).matrix_value ();
+  Matrix y = args(1).matrix_value ();
+
+  if (x.cols () != y.cols ())
+    error ("__pdist2__: X and Y must have the same number of columns");
+
+  return ovl (xpdist2 (x, y, squared));
+}
+
+/*
+%!test
+%! x = [0 0; 3 4];
+%! [d] = __pdist2__ (x, [0 0; 0 4]);
+%! assert (d, [0 4; 5 3]);
+
+%!test
+%! ## wide rows exercise the BLAS3 formulation, narrow the direct one
+%! x = rand (7, 20);
+%! y = rand (9, 20);
+%! d2 = __pdist2__ (x, y, "squared");
+%! dref = zeros (7, 9);
+%! for i = 1:7
+%!   for j = 1:9
+%!     dref(i,j) = sum ((x(i,:) - y(j,:)).^2);
+%!   endfor
+%! endfor
+%! assert (d2, dref, 100*eps);
+%! assert (__pdist2__ (x(:,1:3), y(:,1:3)),
+%!         sqrt (__pdist2__ (x(:,1:3), y(:,1:3), "squared")), 100*eps);
+
+%!error __pdist2__ (1)
+%!error <same number of columns> __pdist2__ (ones (2, 2), ones (2, 3))
+%!error <unrecognized option> __pdist2__ (1, 1, "foo")
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,343 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "lo-ieee.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A merging t-digest: an approximate quantile summary for data that
+// arrives in chunks.  Incoming values are buffered, and when the
+// buffer fills it is sorted and merged into a bounded list of weighted
+// centroids.  Centroids near the tails stay small, so extreme
+// quantiles remain accurate while the memory footprint is fixed by
+// the compression parameter delta.
+
+struct tdigest_centroid
+{
+  double mean;
+  double weight;
+};
+
+class tdigest
+{
+public:
+
+  tdigest (double delta)
+    : m_delta (delta), m_total (0),
+      m_min (octave::numeric_limits<double>::Inf ()),
+      m_max (-octave::numeric_limits<double>::Inf ())
+  { }
+
+  void add (const double *x, octave_idx_type n)
+  {
+    std::size_t cap = static_cast<std::size_t> (16 * m_delta);
+
+    for (octave_idx_type i = 0; i < n; i++)
+      {
+        double v = x[i];
+
+        if (math::isnan (v))
+          continue;
+
+        m_buf.push_back (v);
+        m_total += 1;
+        m_min = std::min (m_min, v);
+        m_max = std::max (m_max, v);
+
+        if (m_buf.size () >= cap)
+          flush ();
+      }
+  }
+
+  double quantile (double p)
+  {
+    flush ();
+
+    if (m_total == 0)
+      return octave::numeric_limits<double>::NaN ();
+
+    if (p <= 0)
+      return m_min;
+    if (p >= 1)
+      return m_max;
+
+    double target = p * m_total;
+
+    double cum = 0;
+    double prev_mean = m_min;
+    double prev_pos = 0;
+
+    for (const tdigest_centroid& c : m_cent)
+      {
+        double pos = cum + c.weight / 2;
+
+        if (target < pos)
+          {
+            double t = (target - prev_pos) / (pos - prev_pos);
+            return prev_mean + t * (c.mean - prev_mean);
+          }
+
+        cum += c.weight;
+        prev_mean = c.mean;
+        prev_pos = pos;
+      }
+
+    double t = (target - prev_pos) / (m_total - prev_pos);
+    return prev_mean + t * (m_max - prev_mean);
+  }
+
+  double total_weight () const { return m_total; }
+
+private:
+
+  void flush ()
+  {
+    if (m_buf.empty ())
+      return;
+
+    std::sort (m_buf.begin (), m_buf.end ());
+
+    // Two-way merge of the old centroids and the sorted buffer.
+    std::vector<tdigest_centroid> merged;
+    merged.reserve (m_cent.size () + m_buf.size ());
+
+    std::size_t i = 0, j = 0;
+    while (i < m_cent.size () || j < m_buf.size ())
+      {
+        if (j == m_buf.size ()
+            || (i < m_cent.size () && m_cent[i].mean <= m_buf[j]))
+          merged.push_back (m_cent[i++]);
+        else
+          merged.push_back ({m_buf[j++], 1});
+      }
+
+    m_buf.clear ();
+
+    // Compress: adjacent centroids are combined while the combined
+    // weight stays below the size limit 4*N*q*(1-q)/delta at the
+    // centroid's quantile position q.
+    m_cent.clear ();
+
+    tdigest_centroid acc = merged[0];
+    double wsum = 0;
+
+    for (std::size_t k = 1; k < merged.size (); k++)
+      {
+        const tdigest_centroid& c = merged[k];
+
+        double w = acc.weight + c.weight;
+        double q = (wsum + w / 2) / m_total;
+        double lim = 4 * m_total * q * (1 - q) / m_delta;
+
+        if (w <= lim)
+          {
+            acc.mean += c.weight * (c.mean - acc.mean) / w;
+            acc.weight = w;
+          }
+        else
+          {
+            m_cent.push_back (acc);
+            wsum += acc.weight;
+            acc = c;
+          }
+      }
+
+    m_cent.push_back (acc);
+  }
+
+  double m_delta;
+  double m_total;
+  double m_min;
+  double m_max;
+  std::vector<tdigest_centroid> m_cent;
+  std::vector<double> m_buf;
+};
+
+static std::map<octave_idx_type, std::shared_ptr<tdigest>> tdigest_map;
+
+static octave_idx_type tdigest_next_handle = 1;
+
+static std::shared_ptr<tdigest>
+lookup_tdigest (const octave_value& ov)
+{
+  octave_idx_type h = ov.xidx_type_value ("__tdigest__: invalid digest handle");
+
+  auto p = tdigest_map.find (h);
+
+  if (p == tdigest_map.end ())
+    error ("__tdigest__: no t-digest with handle %" OCTAVE_IDX_TYPE_FORMAT, h);
+
+  return p->second;
+}
+
+DEFUN (__tdigest_new__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{h} =} __tdigest_new__ ()
+@deftypefnx {} {@var{h} =} __tdigest_new__ (@var{delta})
+Undocumented internal function.
+
+Create an empty streaming quantile digest and return a numeric handle
+for use with @code{__tdigest_add__} and @code{__tdigest_quantile__}.
+The optional compression parameter @var{delta} (default 100) bounds
+the number of retained centroids; larger values trade memory for
+accuracy.
+@seealso{__tdigest_add__, __tdigest_quantile__, __tdigest_delete__}
+@end deftypefn */)
+{
+  if (args.length () > 1)
+    print_usage ();
+
+  double delta = 100;
+
+  if (args.length () == 1)
+    {
+      delta = args(0).xdouble_value ("__tdigest_new__: DELTA must be a positive scalar");
+
+      if (! (delta > 0 && math::isfinite (delta)))
+        error ("__tdigest_new__: DELTA must be a positive scalar");
+    }
+
+  octave_idx_type h = tdigest_next_handle++;
+  tdigest_map[h] = std::make_shared<tdigest> (delta);
+
+  return ovl (h);
+}
+
+DEFUN (__tdigest_add__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} __tdigest_add__ (@var{h}, @var{x})
+Undocumented internal function.
+
+Accumulate the real values of @var{x} into the t-digest @var{h}.
+NaN values are ignored.
+@seealso{__tdigest_new__, __tdigest_quantile__}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  std::shared_ptr<tdigest> d = lookup_tdigest (args(0));
+
+  if (! args(1).isreal ())
+    error ("__tdigest_add__: X must be real");
+
+  NDArray x = args(1).array_value ();
+
+  d->add (x.data (), x.numel ());
+
+  return ovl ();
+}
+
+DEFUN (__tdigest_quantile__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{q} =} __tdigest_quantile__ (@var{h}, @var{p})
+Undocumented internal function.
+
+Return approximate quantiles of the data accumulated in the t-digest
+@var{h} for the cumulative probabilities @var{p}.  The result has the
+same dimensions as @var{p}.
+@seealso{__tdigest_new__, __tdigest_add__}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  std::shared_ptr<tdigest> d = lookup_tdigest (args(0));
+
+  if (! args(1).isreal ())
+    error ("__tdigest_quantile__: P must be real");
+
+  NDArray p = args(1).array_value ();
+
+  NDArray q (p.dims ());
+
+  for (octave_idx_type i = 0; i < p.numel (); i++)
+    q.xelem (i) = d->quantile (p.xelem (i));
+
+  return ovl (q);
+}
+
+DEFUN (__tdigest_delete__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} __tdigest_delete__ (@var{h})
+Undocumented internal function.
+
+Release the t-digest with handle @var{h}.
+@seealso{__tdigest_new__}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_idx_type h = args(0).xidx_type_value ("__tdigest_delete__: invalid digest handle");
+
+  if (tdigest_map.erase (h) == 0)
+    error ("__tdigest_delete__: no t-digest with handle %" OCTAVE_IDX_TYPE_FORMAT, h);
+
+  return ovl ();
+}
+
+/*
+%!error __tdigest_add__ ()
+%!error <no t-digest> __tdigest_quantile__ (-1, 0.5)
+
+%!test
+%! h = __tdigest_new__ ();
+%! __tdigest_add__ (h, 1:100);
+%! q = __tdigest_quantile__ (h, [0, 0.5, 1]);
+%! assert (q(1), 1);
+%! assert (q(3), 100);
+%! assert (q(2), 50.5, 2);
+%! __tdigest_delete__ (h);
+
+%!test
+%! ## chunked accumulation approximates the exact quantiles
+%! h = __tdigest_new__ ();
+%! x = rand (1e5, 1);
+%! for i = 1:10
+%!   __tdigest_add__ (h, x((i-1)*1e4+1 : i*1e4));
+%! endfor
+%! p = [0.01, 0.1, 0.5, 0.9, 0.99];
+%! q = __tdigest_quantile__ (h, p);
+%! assert (q, quantile (x, p), 0.01);
+%! __tdigest_delete__ (h);
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -29,6 +29,7 @@
 
 #include <limits>
 
+#include "oct-parallel.h"
 #include "str-vec.h"
 #include "quit.h"
 
@@ -84,8 +85,8 @@ octave_value
 bitopxx (const OP& op, const std::string& fname,
          const Array<T>& x, const Array<T>& y)
 {
-  int nelx = x.numel ();
-  int nely = y.numel ();
+  octave_idx_type nelx = x.numel ();
+  octave_idx_type nely = y.numel ();
 
   bool is_scalar_op = (nelx == 1 || nely == 1);
 
@@ -98,19 +99,47 @@ bitopxx (const OP& op, const std::string& fname,
     error ("%s: size of X and Y must match, or one operand must be a scalar",
            fname.c_str ());
 
-  Array<T> result;
+  Array<T> result (nelx != 1 ? dvx : dvy);
 
-  if (nelx != 1)
-    result.resize (dvx);
-  else
-    result.resize (dvy);
+  const T *xv = x.data ();
+  const T *yv = y.data ();
+  T *rv = result.fortran_vec ();
+
+  // Tight loops over the raw data so the compiler can turn each case
+  // into word-level vector operations; large arrays are additionally
+  // split across threads.
 
-  for (int i = 0; i < nelx; i++)
-    if (is_scalar_op)
-      for (int k = 0; k < nely; k++)
-        result(i+k) = op (x(i), y(k));
-    else
-      result(i) = op (x(i), y(i));
+  if (nelx == 1)
+    {
+      const T xs = xv[0];
+
+      chunked_parallel_for (nely, nely,
+                            [=] (octave_idx_type start, octave_idx_type len)
+      {
+        for (octave_idx_type i = start; i < start + len; i++)
+          rv[i] = op (xs, yv[i]);
+      });
+    }
+  else if (nely == 1)
+    {
+      const T ys = yv[0];
+
+      chunked_parallel_for (nelx, nelx,
+                            [=] (octave_idx_type start, octave_idx_type len)
+      {
+        for (octave_idx_type i = start; i < start + len; i++)
+          rv[i] = op (xv[i], ys);
+      });
+    }
+  else
+    {
+      chunked_parallel_for (nelx, nelx,
+                            [=] (octave_idx_type start, octave_idx_type len)
+      {
+        for (octave_idx_type i = start; i < start + len; i++)
+          rv[i] = op (xv[i], yv[i]);
+      });
+    }
 
   return result;
 }
@@ -470,8 +499,8 @@ bitshift (float a, int n, int64_t mask)
   if (! n.all_integers (d1, d2))                                        \
     error ("bitshift: K must be a scalar or array of integers");        \
                                                                         \
-  int m_nel = m.numel ();                                               \
-  int n_nel = n.numel ();                                               \
+  octave_idx_type m_nel = m.numel ();                                   \
+  octave_idx_type n_nel = n.numel ();                                   \
                                                                         \
   bool is_scalar_op = (m_nel == 1 || n_nel == 1);                       \
                                                                         \
@@ -483,25 +512,41 @@ bitshift (float a, int n, int64_t mask)
   if (! is_array_op && ! is_scalar_op)                                  \
     error ("bitshift: size of A and N must match, or one operand must be a scalar"); \
                                                                         \
-  T ## NDArray result;                                                  \
+  T ## NDArray result (m_nel != 1 ? m_dv : n_dv);                       \
                                                                         \
-  if (m_nel != 1)                                                       \
-    result.resize (m_dv);                                               \
-  else                                                                  \
-    result.resize (n_dv);                                               \
+  const double *nv = n.data ();                                         \
+  const auto *mv = m.data ();                                           \
+  auto *rv = result.fortran_vec ();                                     \
+                                                                        \
+  if (n_nel == 1)                                                       \
+    {                                                                   \
+      /* Common case: one shift amount for the whole array.  Hoisting  */ \
+      /* it out of the loop leaves a tight word-level shift-and-mask   */ \
+      /* loop over the raw data that the compiler can vectorize.       */ \
+      int k = static_cast<int> (nv[0]);                                 \
                                                                         \
-  for (int i = 0; i < m_nel; i++)                                       \
-    if (is_scalar_op)                                                   \
-      for (int k = 0; k < n_nel; k++)                                   \
-        if (static_cast<int> (n(k)) >= bits_in_type)                    \
-          result(i+k) = 0;                                              \
-        else                                                            \
-          result(i+k) = bitshift (m(i), static_cast<int> (n(k)), mask); \
-    else                                                                \
-      if (static_cast<int> (n(i)) >= bits_in_type)                      \
-        result(i) = 0;                                                  \
+      if (k >= bits_in_type)                                            \
+        for (octave_idx_type i = 0; i < m_nel; i++)                     \
+          rv[i] = 0;                                                    \
       else                                                              \
-        result(i) = bitshift (m(i), static_cast<int> (n(i)), mask);     \
+        for (octave_idx_type i = 0; i < m_nel; i++)                     \
+          rv[i] = bitshift (mv[i], k, mask);                            \
+    }                                                                   \
+  else                                                                  \
+    {                                                                   \
+      octave_idx_type nel = (m_nel == 1 ? n_nel : m_nel);               \
+      octave_idx_type m_stride = (m_nel == 1 ? 0 : 1);                  \
+                                                                        \
+      for (octave_idx_type i = 0; i < nel; i++)                         \
+        {                                                               \
+          int k = static_cast<int> (nv[i]);                             \
+                                                                        \
+          if (k >= bits_in_type)                                        \
+            rv[i] = 0;                                                  \
+          else                                                          \
+            rv[i] = bitshift (mv[i * m_stride], k, mask);               \
+        }                                                               \
+    }                                                                   \
                                                                         \
   retval = result;
 
@@ -27,9 +27,16 @@
 #  include "config.h"
 #endif
 
+#include <cstring>
+
+#include <condition_variable>
 #include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 #include "filepos-wrappers.h"
+#include "oct-env.h"
 
 #include "c-file-ptr-stream.h"
 
@@ -47,6 +54,293 @@ OCTAVE_BEGIN_NAMESPACE(octave)
 #  define SEEK_END 2
 #endif
 
+// Background read-ahead for c_file_ptr_buf.  A worker thread keeps up
+// to two fixed-size buffers filled from the FILE while the consumer
+// drains them in order, so sequential reads overlap disk latency with
+// whatever the caller does with the data.  All state is guarded by
+// m_mtx; the worker drops the lock around fread so filling one buffer
+// proceeds while the consumer works on the other.
+//
+// The worker commits a completed fread (store length, bump m_nfull,
+// set m_eof on a short count) in the same critical section in which it
+// clears m_filling, so anyone who has waited for m_filling to clear
+// sees a consistent picture of the buffered data.
+
+class c_file_ptr_buf::prefetch
+{
+public:
+
+  prefetch (FILE *f)
+    : m_f (f), m_worker (), m_mtx (), m_can_fill (), m_can_read (),
+      m_pos (0), m_rd (0), m_nfull (0), m_filling (false),
+      m_paused (false), m_eof (false), m_stop (false)
+  {
+    m_buf[0].reset (new char [s_bufsize]);
+    m_buf[1].reset (new char [s_bufsize]);
+    m_len[0] = m_len[1] = 0;
+  }
+
+  OCTAVE_DISABLE_CONSTRUCT_COPY_MOVE (prefetch)
+
+  ~prefetch ()
+  {
+    {
+      std::lock_guard<std::mutex> lock (m_mtx);
+      m_stop = true;
+    }
+
+    m_can_fill.notify_all ();
+
+    if (m_worker.joinable ())
+      m_worker.join ();
+  }
+
+  // Deliver up to N bytes; a short count means EOF or a read error at
+  // the logical position.
+
+  std::streamsize read (char *s, std::streamsize n)
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    start_worker ();
+
+    if (m_paused)
+      resume_worker ();
+
+    std::streamsize got = 0;
+
+    while (got < n)
+      {
+        while (m_nfull == 0 && ! m_eof)
+          m_can_read.wait (lock);
+
+        if (m_nfull == 0)
+          break;
+
+        std::size_t have = m_len[m_rd] - m_pos;
+        std::size_t want = static_cast<std::size_t> (n - got);
+        std::size_t take = (want < have ? want : have);
+
+        std::memcpy (s + got, m_buf[m_rd].get () + m_pos, take);
+
+        m_pos += take;
+        got += take;
+
+        if (m_pos == m_len[m_rd])
+          advance ();
+      }
+
+    return got;
+  }
+
+  // The next byte, consumed if BUMP, or EOF.
+
+  int_type get (bool bump)
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    start_worker ();
+
+    if (m_paused)
+      resume_worker ();
+
+    while (m_nfull == 0 && ! m_eof)
+      m_can_read.wait (lock);
+
+    if (m_nfull == 0)
+      return traits_type::eof ();
+
+    int_type c
+      = traits_type::to_int_type (m_buf[m_rd].get ()[m_pos]);
+
+    if (bump && ++m_pos == m_len[m_rd])
+      advance ();
+
+    return c;
+  }
+
+  // Step the logical position back one byte, overwriting it with C the
+  // way ungetc would.  Fails at a buffer boundary; the caller then
+  // falls back to drop_and_sync plus ungetc on the FILE itself.
+
+  bool putback (char c)
+  {
+    std::lock_guard<std::mutex> lock (m_mtx);
+
+    if (m_pos == 0)
+      return false;
+
+    m_buf[m_rd].get ()[--m_pos] = c;
+
+    return true;
+  }
+
+  // Quiesce the worker, discard the read-ahead, and move the FILE
+  // position back to the logical (consumer-visible) position.  The
+  // worker stays paused until the next read resumes it, so on return
+  // the caller may reposition or push back on the FILE without racing
+  // against a concurrent fread.
+
+  void drop_and_sync ()
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    pause_worker (lock);
+
+    off_t unread
+      = static_cast<off_t> (m_len[0] + m_len[1] - m_pos);
+
+    if (unread > 0)
+      octave_fseeko_wrapper (m_f, -unread, SEEK_CUR);
+
+    m_len[0] = m_len[1] = 0;
+    m_pos = 0;
+    m_rd = 0;
+    m_nfull = 0;
+    m_eof = false;
+  }
+
+  // The logical position: where the FILE is minus what is buffered
+  // but not yet consumed.
+
+  off_t tell ()
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    pause_worker (lock);
+
+    off_t pos = octave_ftello_wrapper (m_f);
+
+    off_t unread
+      = static_cast<off_t> (m_len[0] + m_len[1] - m_pos);
+
+    resume_worker ();
+
+    return pos >= 0 ? pos - unread : pos;
+  }
+
+private:
+
+  static const std::size_t s_bufsize = 256 * 1024;
+
+  // Call with m_mtx held.
+
+  void start_worker ()
+  {
+    if (! m_worker.joinable ())
+      m_worker = std::thread (&prefetch::fill_loop, this);
+  }
+
+  // Stop the worker from issuing new reads and wait out any read in
+  // flight.  Call with m_mtx held; undo with resume_worker.
+
+  void pause_worker (std::unique_lock<std::mutex>& lock)
+  {
+    m_paused = true;
+
+    while (m_filling)
+      m_can_read.wait (lock);
+  }
+
+  void resume_worker ()
+  {
+    m_paused = false;
+
+    m_can_fill.notify_one ();
+  }
+
+  // Consumer side, with m_mtx held: retire the drained buffer and let
+  // the worker refill it.
+
+  void advance ()
+  {
+    m_len[m_rd] = 0;
+    m_pos = 0;
+    m_rd = 1 - m_rd;
+    m_nfull--;
+
+    m_can_fill.notify_one ();
+  }
+
+  void fill_loop ()
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    while (true)
+      {
+        while (! m_stop && (m_nfull == 2 || m_eof || m_paused))
+          m_can_fill.wait (lock);
+
+        if (m_stop)
+          break;
+
+        int wr = (m_rd + m_nfull) % 2;
+
+        m_filling = true;
+
+        lock.unlock ();
+
+        std::size_t n = std::fread (m_buf[wr].get (), 1, s_bufsize, m_f);
+
+        lock.lock ();
+
+        m_filling = false;
+
+        if (n > 0)
+          {
+            m_len[wr] = n;
+            m_nfull++;
+          }
+
+        if (n < s_bufsize)
+          m_eof = true;
+
+        m_can_read.notify_all ();
+      }
+  }
+
+  FILE *m_f;
+
+  std::thread m_worker;
+
+  std::mutex m_mtx;
+
+  std::condition_variable m_can_fill;
+  std::condition_variable m_can_read;
+
+  std::unique_ptr<char []> m_buf[2];
+
+  std::size_t m_len[2];
+
+  // Consumed prefix of the buffer being drained.
+  std::size_t m_pos;
+
+  // Index of the buffer being drained; the worker fills
+  // (m_rd + m_nfull) % 2.
+  int m_rd;
+
+  int m_nfull;
+
+  bool m_filling;
+  bool m_paused;
+  bool m_eof;
+  bool m_stop;
+};
+
+void
+c_file_ptr_buf::enable_prefetch ()
+{
+  // Kill switch, mostly for debugging and timing comparisons.
+  static bool disabled
+    = (sys::env::getenv ("OCTAVE_STREAM_PREFETCH") == "0");
+
+  if (disabled)
+    return;
+
+  if (m_f && ! m_prefetch)
+    m_prefetch = new prefetch (m_f);
+}
+
 c_file_ptr_buf::~c_file_ptr_buf ()
 {
   buf_close ();
@@ -68,6 +362,9 @@ c_file_ptr_buf::underflow_common (bool bump)
 {
   if (m_f)
     {
+      if (m_prefetch)
+        return m_prefetch->get (bump);
+
       int_type c = std::fgetc (m_f);
 
       if (! bump && c != traits_type::eof ())
@@ -82,6 +379,15 @@ c_file_ptr_buf::underflow_common (bool bump)
 c_file_ptr_buf::int_type
 c_file_ptr_buf::pbackfail (int_type c)
 {
+  if (c != traits_type::eof () && m_f && m_prefetch)
+    {
+      if (m_prefetch->putback (traits_type::to_char_type (c)))
+        return c;
+
+      // At a buffer boundary; push back on the FILE itself.
+      m_prefetch->drop_and_sync ();
+    }
+
   return ((c != traits_type::eof () && m_f)
           ? ungetc (c, m_f) : traits_type::not_eof (c));
 }
@@ -99,7 +405,7 @@ std::streamsize
 c_file_ptr_buf::xsgetn (char *s, std::streamsize n)
 {
   if (m_f)
-    return std::fread (s, 1, n, m_f);
+    return m_prefetch ? m_prefetch->read (s, n) : std::fread (s, 1, n, m_f);
   else
     return 0;
 }
@@ -120,6 +426,11 @@ c_file_ptr_buf::seekoff (std::streamoff offset,
 {
   if (m_f)
     {
+      // Restoring the FILE position to the logical position first
+      // makes relative seeks come out right.
+      if (m_prefetch)
+        m_prefetch->drop_and_sync ();
+
       octave_fseeko_wrapper (m_f, offset, seekdir_to_whence (dir));
 
       return octave_ftello_wrapper (m_f);
@@ -133,6 +444,9 @@ c_file_ptr_buf::seekpos (std::streampos offset, std::ios::openmode)
 {
   if (m_f)
     {
+      if (m_prefetch)
+        m_prefetch->drop_and_sync ();
+
       octave_fseeko_wrapper (m_f, offset, SEEK_SET);
 
       return octave_ftello_wrapper (m_f);
@@ -144,6 +458,9 @@ c_file_ptr_buf::seekpos (std::streampos offset, std::ios::openmode)
 int
 c_file_ptr_buf::sync ()
 {
+  if (m_prefetch)
+    m_prefetch->drop_and_sync ();
+
   flush ();
 
   return 0;
@@ -160,6 +477,13 @@ c_file_ptr_buf::buf_close ()
 {
   int retval = -1;
 
+  if (m_prefetch)
+    {
+      // Joins the worker thread.
+      delete m_prefetch;
+      m_prefetch = nullptr;
+    }
+
   flush ();
 
   if (m_f)
@@ -174,12 +498,18 @@ c_file_ptr_buf::buf_close ()
 int
 c_file_ptr_buf::seek (off_t offset, int origin)
 {
+  if (m_f && m_prefetch)
+    m_prefetch->drop_and_sync ();
+
   return m_f ? octave_fseeko_wrapper (m_f, offset, origin) : -1;
 }
 
 off_t
 c_file_ptr_buf::tell ()
 {
+  if (m_f && m_prefetch)
+    return m_prefetch->tell ();
+
   return m_f ? octave_ftello_wrapper (m_f) : -1;
 }
 
@@ -51,7 +51,7 @@ public:
   c_file_ptr_buf () = delete;
 
   c_file_ptr_buf (FILE *f, close_fcn cf = file_close)
-    : std::streambuf (), m_f (f), m_cf (cf)
+    : std::streambuf (), m_f (f), m_cf (cf), m_prefetch (nullptr)
   { }
 
   OCTAVE_DISABLE_COPY_MOVE (c_file_ptr_buf)
@@ -92,6 +92,15 @@ public:
 
   static int file_close (FILE *m_f);
 
+  // Opt in to background read-ahead: a worker thread keeps two
+  // buffers filled from the file while the consumer drains them, so
+  // sequential reads overlap disk latency with whatever is done with
+  // the data.  Positioning requests behave as if the read-ahead did
+  // not exist.  Only sensible for streams that are read exclusively;
+  // writes must not be mixed in.
+
+  void enable_prefetch ();
+
 protected:
 
   FILE *m_f;
@@ -100,6 +109,10 @@ protected:
 
 private:
 
+  class prefetch;
+
+  prefetch *m_prefetch;
+
   int_type underflow_common (bool);
 };
 
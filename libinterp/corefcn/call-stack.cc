@@ -58,7 +58,7 @@ static const octave_fields bt_fields (bt_fieldnames);
 
 call_stack::call_stack (tree_evaluator& evaluator)
   : m_evaluator (evaluator), m_cs (), m_curr_frame (0),
-    m_max_stack_depth (1024), m_global_values ()
+    m_max_stack_depth (1024), m_global_values (), m_global_generation (0)
 {
   push (symbol_scope ("top scope"));
 }
@@ -706,6 +706,35 @@ std::list<frame_info> call_stack::backtrace_info () const
   return backtrace_info (curr_user_frame, true);
 }
 
+std::function<std::list<frame_info> ()>
+call_stack::backtrace_info_snapshot () const
+{
+  std::shared_ptr<stack_frame> top
+    = m_cs.empty () ? std::shared_ptr<stack_frame> () : m_cs.back ();
+
+  return [top] ()
+  {
+    std::list<frame_info> frames;
+
+    // Exclude the top-level frame (index 0), as backtrace_frames
+    // does.
+
+    for (const stack_frame *frm = top.get (); frm && frm->index () > 0;
+         frm = frm->parent_link ().get ())
+      {
+        if (frm->is_user_script_frame () || frm->is_user_fcn_frame ()
+            || frm->is_scope_frame ())
+          frames.push_back (frame_info (frm->fcn_file_name (),
+                                        frm->fcn_name (),
+                                        frm->line (), frm->column ()));
+      }
+
+    frames.unique ();
+
+    return frames;
+  };
+}
+
 octave_map call_stack::backtrace (octave_idx_type& curr_user_frame,
                                   bool print_subfn) const
 {
@@ -808,22 +837,34 @@ std::list<std::string> call_stack::variable_names () const
   return m_cs[m_curr_frame]->variable_names ();
 }
 
+// The clear functions remove the map nodes instead of just assigning
+// undefined values, so they must invalidate any cached binding
+// pointers by bumping the generation count.
+
 void call_stack::clear_global_variable (const std::string& name)
 {
   auto p = m_global_values.find (name);
 
   if (p != m_global_values.end ())
-    p->second = octave_value ();
+    {
+      m_global_values.erase (p);
+      m_global_generation++;
+    }
 }
 
 void call_stack::clear_global_variable_pattern (const std::string& pattern)
 {
   glob_match pat (pattern);
 
-  for (auto& nm_ov : m_global_values)
+  for (auto p = m_global_values.begin (); p != m_global_values.end (); )
     {
-      if (pat.match (nm_ov.first))
-        nm_ov.second = octave_value ();
+      if (pat.match (p->first))
+        {
+          p = m_global_values.erase (p);
+          m_global_generation++;
+        }
+      else
+        p++;
     }
 }
 
@@ -831,17 +872,22 @@ void call_stack::clear_global_variable_regexp (const std::string& pattern)
 {
   regexp pat (pattern);
 
-  for (auto& nm_ov : m_global_values)
+  for (auto p = m_global_values.begin (); p != m_global_values.end (); )
     {
-      if (pat.is_match (nm_ov.first))
-        nm_ov.second = octave_value ();
+      if (pat.is_match (p->first))
+        {
+          p = m_global_values.erase (p);
+          m_global_generation++;
+        }
+      else
+        p++;
     }
 }
 
 void call_stack::clear_global_variables ()
 {
-  for (auto& nm_ov : m_global_values)
-    nm_ov.second = octave_value ();
+  m_global_values.clear ();
+  m_global_generation++;
 }
 
 symbol_info_list
@@ -895,6 +941,14 @@ octave_value& call_stack::global_varref (const std::string& name)
   return m_global_values[name];
 }
 
+octave_value * call_stack::global_binding (const std::string& name)
+{
+  // Map nodes are never erased (clearing a global just assigns an
+  // undefined value), so the address of the mapped value is stable.
+
+  return &m_global_values[name];
+}
+
 octave_value call_stack::get_top_level_value (const std::string& name) const
 {
   return m_cs[0]->varval (name);
@@ -1303,4 +1357,19 @@ complex, nesting, persistent.
   return tw.do_who (argc, argv, nargout == 1, true);
 }
 
+/*
+%!test
+%! x = zeros (10);
+%! s = whos ("x");
+%! assert (s.bytes, 800);
+%! s = whos ("x");
+%! assert (s.bytes, 800);
+%! x(1) = 1;
+%! s = whos ("x");
+%! assert (s.bytes, 800);
+%! x = zeros (20);
+%! s = whos ("x");
+%! assert (s.bytes, 3200);
+*/
+
 OCTAVE_END_NAMESPACE(octave)
@@ -29,6 +29,7 @@
 #include "octave-config.h"
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -93,6 +94,16 @@ public:
     return m_cs[m_curr_frame];
   }
 
+  // Non-owning access to the current frame for hot evaluator paths
+  // (variable reads in particular).  The call stack itself keeps the
+  // frame alive for the duration of the call, so no reference count
+  // traffic is needed.
+
+  stack_frame * current_stack_frame_ptr () const
+  {
+    return m_cs[m_curr_frame].get ();
+  }
+
   symbol_scope top_scope () const
   {
     return m_cs[0]->get_scope ();
@@ -166,11 +177,14 @@ public:
 
   void push (octave_function *fcn);
 
+  // These run once per executed statement, so they must not copy the
+  // shared_ptr (an atomic reference count update per statement).
+
   void set_location (int l, int c)
   {
     if (! m_cs.empty ())
       {
-        std::shared_ptr<stack_frame> elt = m_cs.back ();
+        stack_frame *elt = m_cs.back ().get ();
 
         elt->line (l);
         elt->column (c);
@@ -180,21 +194,13 @@ public:
   void set_line (int l)
   {
     if (! m_cs.empty ())
-      {
-        std::shared_ptr<stack_frame> elt = m_cs.back ();
-
-        elt->line (l);
-      }
+      m_cs.back ()->line (l);
   }
 
   void set_column (int c)
   {
     if (! m_cs.empty ())
-      {
-        std::shared_ptr<stack_frame> elt = m_cs.back ();
-
-        elt->column (c);
-      }
+      m_cs.back ()->column (c);
   }
 
   bool goto_frame (std::size_t n = 0, bool verbose = false);
@@ -230,6 +236,14 @@ public:
 
   std::list<frame_info> backtrace_info () const;
 
+  // O(1) snapshot of the current stack for deferred backtrace
+  // capture.  The returned callable builds the frame_info list on
+  // demand by walking parent links from the frame that was on top
+  // when the snapshot was taken; holding that frame keeps the chain
+  // alive after the stack unwinds.
+
+  std::function<std::list<frame_info> ()> backtrace_info_snapshot () const;
+
   // The same as backtrace_info but in the form of a struct array
   // object that may be used in the interpreter.
 
@@ -278,6 +292,18 @@ public:
 
   octave_value& global_varref (const std::string& name);
 
+  // Direct pointer to the storage slot for global NAME, creating an
+  // undefined binding if none exists.  The pointer remains valid as
+  // long as global_binding_generation is unchanged, so callers may
+  // cache it and skip the by-name lookup on subsequent accesses.
+
+  octave_value * global_binding (const std::string& name);
+
+  std::size_t global_binding_generation () const
+  {
+    return m_global_generation;
+  }
+
   octave_value get_top_level_value (const std::string& name) const;
 
   void set_top_level_value (const std::string& name,
@@ -324,6 +350,10 @@ private:
   int m_max_stack_depth;
 
   std::map<std::string, octave_value> m_global_values;
+
+  // Bumped by operations that may restructure m_global_values;
+  // invalidates pointers handed out by global_binding.
+  std::size_t m_global_generation;
 };
 
 OCTAVE_END_NAMESPACE(octave)
@@ -34,6 +34,7 @@
 
 #include "lo-mappers.h"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
 #include "oct-string.h"
 
 #include "Cell.h"
@@ -119,6 +120,26 @@ get_output_list (interpreter& interp, octave_idx_type count,
   return tmp;
 }
 
+// Map a metadata query over the elements of a cell array in parallel
+// when the cell is large enough.  The queries used below are read-only
+// and touch independent result elements, which is safe across threads
+// now that value reference counts are atomic.
+
+template <typename ARR, typename F>
+static void
+cellfun_map_elems (ARR& result, const Cell& f_args, F&& fcn)
+{
+  octave_idx_type n = f_args.numel ();
+  auto *rv = result.fortran_vec ();
+
+  octave::chunked_parallel_for
+    (n, [&] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type i = beg; i < beg + len; i++)
+         rv[i] = fcn (f_args.elem (i));
+     });
+}
+
 // Templated function because the user can be stubborn enough to request
 // a cell array as an output even in these cases where the output fits
 // in an ordinary array
@@ -132,55 +153,56 @@ try_cellfun_internal_ops (const octave_value_list& args, int nargin)
 
   const Cell f_args = args(1).cell_value ();
 
-  octave_idx_type k = f_args.numel ();
-
   if (name == "isempty")
     {
       BNDA result (f_args.dims ());
-      for (octave_idx_type count = 0; count < k; count++)
-        result(count) = f_args.elem (count).isempty ();
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v) { return v.isempty (); });
       retval(0) = result;
     }
   else if (name == "islogical")
     {
       BNDA result (f_args.dims ());
-      for (octave_idx_type count= 0; count < k; count++)
-        result(count) = f_args.elem (count).islogical ();
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v) { return v.islogical (); });
       retval(0) = result;
     }
   else if (name == "isnumeric")
     {
       BNDA result (f_args.dims ());
-      for (octave_idx_type count= 0; count < k; count++)
-        result(count) = f_args.elem (count).isnumeric ();
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v) { return v.isnumeric (); });
       retval(0) = result;
     }
   else if (name == "isreal")
     {
       BNDA result (f_args.dims ());
-      for (octave_idx_type count= 0; count < k; count++)
-        result(count) = f_args.elem (count).isreal ();
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v) { return v.isreal (); });
       retval(0) = result;
     }
   else if (name == "length")
     {
       NDA result (f_args.dims ());
-      for (octave_idx_type count= 0; count < k; count++)
-        result(count) = static_cast<double> (f_args.elem (count).length ());
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v)
+                         { return static_cast<double> (v.length ()); });
       retval(0) = result;
     }
   else if (name == "ndims")
     {
       NDA result (f_args.dims ());
-      for (octave_idx_type count = 0; count < k; count++)
-        result(count) = static_cast<double> (f_args.elem (count).ndims ());
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v)
+                         { return static_cast<double> (v.ndims ()); });
       retval(0) = result;
     }
   else if (name == "numel" || name == "prodofsize")
     {
       NDA result (f_args.dims ());
-      for (octave_idx_type count = 0; count < k; count++)
-        result(count) = static_cast<double> (f_args.elem (count).numel ());
+      cellfun_map_elems (result, f_args,
+                         [] (const octave_value& v)
+                         { return static_cast<double> (v.numel ()); });
       retval(0) = result;
     }
   else if (name == "size")
@@ -194,15 +216,13 @@ try_cellfun_internal_ops (const octave_value_list& args, int nargin)
         error ("cellfun: K must be a positive integer");
 
       NDA result (f_args.dims ());
-
-      for (octave_idx_type count = 0; count < k; count++)
-        {
-          dim_vector dv = f_args.elem (count).dims ();
-          if (d < dv.ndims ())
-            result(count) = static_cast<double> (dv(d));
-          else
-            result(count) = 1.0;
-        }
+      cellfun_map_elems (result, f_args,
+                         [d] (const octave_value& v)
+                         {
+                           dim_vector dv = v.dims ();
+                           return (d < dv.ndims ()
+                                   ? static_cast<double> (dv(d)) : 1.0);
+                         });
 
       retval(0) = result;
     }
@@ -213,8 +233,9 @@ try_cellfun_internal_ops (const octave_value_list& args, int nargin)
 
       std::string class_name = args(2).string_value ();
       BNDA result (f_args.dims ());
-      for (octave_idx_type count = 0; count < k; count++)
-        result(count) = (f_args.elem (count).class_name () == class_name);
+      cellfun_map_elems (result, f_args,
+                         [&class_name] (const octave_value& v)
+                         { return v.class_name () == class_name; });
 
       retval(0) = result;
     }
@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "lo-ieee.h"
+#include "oct-queue.h"
+#include "quit.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ov.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Channels are bounded thread-safe queues of values, identified by
+// small integer handles like file ids.  The registry itself is
+// guarded by a mutex so that C++ worker threads may push into a
+// channel that m-code drains (or vice versa); each queue does its own
+// locking for the element transfers.
+
+typedef bounded_queue<octave_value> ov_channel;
+
+static std::mutex channel_registry_mutex;
+
+static std::map<octave_idx_type, std::shared_ptr<ov_channel>>
+  channel_registry;
+
+static octave_idx_type next_channel_id = 1;
+
+static std::shared_ptr<ov_channel>
+lookup_channel (octave_idx_type id, const char *who)
+{
+  std::lock_guard<std::mutex> lock (channel_registry_mutex);
+
+  auto it = channel_registry.find (id);
+
+  if (it == channel_registry.end ())
+    error ("%s: invalid channel id %" OCTAVE_IDX_TYPE_FORMAT, who, id);
+
+  return it->second;
+}
+
+static octave_idx_type
+channel_id_arg (const octave_value& arg, const char *who)
+{
+  octave_idx_type id = arg.xidx_type_value ("%s: CH must be a channel id",
+                                            who);
+
+  return id;
+}
+
+static double
+timeout_arg (const octave_value_list& args, int pos, const char *who)
+{
+  if (args.length () <= pos)
+    return lo_ieee_inf_value ();
+
+  double timeout = args(pos).xscalar_value ("%s: TIMEOUT must be a scalar",
+                                            who);
+
+  if (math::isnan (timeout) || timeout < 0)
+    error ("%s: TIMEOUT must be a non-negative number of seconds", who);
+
+  return timeout;
+}
+
+// Wait on OP in short slices so that Ctrl-C stays responsive even
+// with an infinite timeout.  OP must accept a timeout in seconds and
+// return true when it completed.
+
+template <typename F>
+static bool
+wait_interruptible (F op, double timeout)
+{
+  static const double slice = 0.1;
+
+  double remaining = timeout;
+
+  while (true)
+    {
+      double this_wait = (remaining < slice ? remaining : slice);
+
+      if (op (this_wait))
+        return true;
+
+      if (! math::isinf (remaining))
+        {
+          remaining -= this_wait;
+
+          if (remaining <= 0)
+            return false;
+        }
+
+      octave_quit ();
+    }
+}
+
+DEFUN (channel_create, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{ch} =} channel_create (@var{capacity})
+Create a bounded queue holding up to @var{capacity} values and return
+a handle to it.
+
+Channels connect producers and consumers: @code{channel_send} appends
+a value and blocks while the channel is full, @code{channel_recv}
+removes the oldest value and blocks while it is empty.  The channel
+may be used safely from multiple threads inside Octave, and the
+bounded capacity provides backpressure, pacing a fast producer to the
+speed of its consumer.
+
+The handle is a small integer, like a file id, and stays valid until
+the channel is closed with @code{channel_close}.
+@seealso{channel_send, channel_recv, channel_size, channel_close}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_idx_type capacity
+    = args(0).xidx_type_value ("channel_create: CAPACITY must be a positive integer");
+
+  if (capacity < 1)
+    error ("channel_create: CAPACITY must be a positive integer");
+
+  std::lock_guard<std::mutex> lock (channel_registry_mutex);
+
+  octave_idx_type id = next_channel_id++;
+
+  channel_registry[id] = std::make_shared<ov_channel> (capacity);
+
+  return ovl (id);
+}
+
+/*
+%!error channel_create ()
+%!error <CAPACITY must be a positive integer> channel_create (0)
+%!error <CAPACITY must be a positive integer> channel_create ("x")
+
+%!test
+%! ch = channel_create (4);
+%! unwind_protect
+%!   assert (ch > 0);
+%!   assert (channel_size (ch), 0);
+%! unwind_protect_cleanup
+%!   channel_close (ch);
+%! end_unwind_protect
+*/
+
+DEFUN (channel_send, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {} channel_send (@var{ch}, @var{val})
+@deftypefnx {} {@var{ok} =} channel_send (@var{ch}, @var{val}, @var{timeout})
+Append the value @var{val} to channel @var{ch}.
+
+If the channel is full the call blocks until space is available, or
+for at most @var{timeout} seconds when a timeout is given.  A
+@var{timeout} of zero makes the call non-blocking.  The return value
+is true if the value was enqueued and false if the timeout expired or
+the channel was closed while waiting.
+@seealso{channel_recv, channel_create}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+
+  octave_idx_type id = channel_id_arg (args(0), "channel_send");
+
+  double timeout = timeout_arg (args, 2, "channel_send");
+
+  std::shared_ptr<ov_channel> ch = lookup_channel (id, "channel_send");
+
+  octave_value val = args(1);
+
+  // Stop waiting early if another thread closes the channel.
+  bool sent = false;
+
+  wait_interruptible ([&ch, &val, &sent] (double t) {
+                        if (ch->push (val, t))
+                          sent = true;
+
+                        return sent || ch->is_closed ();
+                      }, timeout);
+
+  return ovl (sent);
+}
+
+/*
+%!test
+%! ch = channel_create (2);
+%! unwind_protect
+%!   assert (channel_send (ch, 1), true);
+%!   assert (channel_send (ch, "two"), true);
+%!   ## Full channel: a zero timeout must fail without blocking.
+%!   assert (channel_send (ch, 3, 0), false);
+%!   assert (channel_size (ch), 2);
+%! unwind_protect_cleanup
+%!   channel_close (ch);
+%! end_unwind_protect
+
+%!error channel_send ()
+%!error <TIMEOUT must be a non-negative number> channel_send (1, 2, -1)
+*/
+
+DEFUN (channel_recv, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{val} =} channel_recv (@var{ch})
+@deftypefnx {} {[@var{val}, @var{ok}] =} channel_recv (@var{ch}, @var{timeout})
+Remove and return the oldest value in channel @var{ch}.
+
+If the channel is empty the call blocks until a value arrives, or for
+at most @var{timeout} seconds when a timeout is given.  A
+@var{timeout} of zero makes the call non-blocking.  The second output
+@var{ok} is true if a value was received; when it is false, @var{val}
+is the empty matrix.
+@seealso{channel_send, channel_create}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+
+  octave_idx_type id = channel_id_arg (args(0), "channel_recv");
+
+  double timeout = timeout_arg (args, 1, "channel_recv");
+
+  std::shared_ptr<ov_channel> ch = lookup_channel (id, "channel_recv");
+
+  octave_value val = Matrix ();
+
+  // Stop waiting early once the channel is closed and drained.
+  bool received = false;
+
+  wait_interruptible ([&ch, &val, &received] (double t) {
+                        if (ch->pop (val, t))
+                          received = true;
+
+                        return received
+                               || (ch->is_closed () && ch->size () == 0);
+                      }, timeout);
+
+  return ovl (val, received);
+}
+
+/*
+%!test
+%! ch = channel_create (3);
+%! unwind_protect
+%!   channel_send (ch, 10);
+%!   channel_send (ch, magic (4));
+%!   channel_send (ch, {1, "a"});
+%!   assert (channel_recv (ch), 10);
+%!   assert (channel_recv (ch), magic (4));
+%!   assert (channel_recv (ch), {1, "a"});
+%!   ## Empty channel: a zero timeout must fail without blocking.
+%!   [val, ok] = channel_recv (ch, 0);
+%!   assert (ok, false);
+%!   assert (val, []);
+%! unwind_protect_cleanup
+%!   channel_close (ch);
+%! end_unwind_protect
+
+%!error channel_recv ()
+%!error <invalid channel id> channel_recv (-1)
+*/
+
+DEFUN (channel_size, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{n} =} channel_size (@var{ch})
+Return the number of values currently queued in channel @var{ch}.
+
+The count is only a snapshot when other threads are sending or
+receiving concurrently.
+@seealso{channel_send, channel_recv, channel_create}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_idx_type id = channel_id_arg (args(0), "channel_size");
+
+  std::shared_ptr<ov_channel> ch = lookup_channel (id, "channel_size");
+
+  return ovl (static_cast<double> (ch->size ()));
+}
+
+DEFUN (channel_close, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} channel_close (@var{ch})
+Close channel @var{ch} and release its handle.
+
+All senders and receivers blocked on the channel are woken and return
+with @var{ok} set to false; any queued values are discarded.  To
+shut a pipeline down without losing data, send a sentinel value and
+close only after the consumer has seen it.
+@seealso{channel_create}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_idx_type id = channel_id_arg (args(0), "channel_close");
+
+  std::shared_ptr<ov_channel> ch = lookup_channel (id, "channel_close");
+
+  ch->close ();
+
+  std::lock_guard<std::mutex> lock (channel_registry_mutex);
+
+  channel_registry.erase (id);
+
+  return ovl ();
+}
+
+/*
+%!test
+%! ch = channel_create (1);
+%! channel_send (ch, pi);
+%! channel_close (ch);
+%! fail ("channel_recv (ch)", "invalid channel id");
+%! fail ("channel_close (ch)", "invalid channel id");
+
+%!error channel_close ()
+%!error <invalid channel id> channel_close (0)
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,984 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Array.h"
+#include "boolNDArray.h"
+#include "dNDArray.h"
+#include "dim-vector.h"
+#include "fNDArray.h"
+#include "int16NDArray.h"
+#include "int32NDArray.h"
+#include "int64NDArray.h"
+#include "int8NDArray.h"
+#include "oct-mmap.h"
+#include "uint16NDArray.h"
+#include "uint32NDArray.h"
+#include "uint64NDArray.h"
+#include "uint8NDArray.h"
+
+#include "Cell.h"
+#include "defun.h"
+#include "error.h"
+#include "oct-map.h"
+#include "ov.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A columnar table file stores each column of a table contiguously so
+// that a scan touching only some columns never faults in pages of the
+// others.  The layout is
+//
+//   bytes 0-7    magic string "OCTCOLT1"
+//   bytes 8-15   number of rows (int64)
+//   bytes 16-19  number of columns (int32)
+//   directory    for each column: name length (int32), name bytes,
+//                element type code (int32, same codes as shmwrite),
+//                data offset (int64), data size in bytes (int64)
+//
+// Column data starts on an 8-byte boundary.  Data is stored in host
+// byte order; like shared memory segments, these files are meant for
+// processes on one machine, not for interchange.
+
+struct column_info
+{
+  std::string name;
+  int32_t type;
+  int64_t offset;
+  int64_t nbytes;
+};
+
+static std::size_t
+column_elem_size (int32_t type)
+{
+  switch (type)
+    {
+    case 0: return sizeof (double);
+    case 1: return sizeof (float);
+    case 4: case 8: return 1;
+    case 5: case 9: return 2;
+    case 6: case 10: return 4;
+    case 7: case 11: return 8;
+    case 12: return sizeof (bool);
+    default: return 0;
+    }
+}
+
+static const char *
+column_class_name (int32_t type)
+{
+  switch (type)
+    {
+    case 0: return "double";
+    case 1: return "single";
+    case 4: return "int8";
+    case 5: return "int16";
+    case 6: return "int32";
+    case 7: return "int64";
+    case 8: return "uint8";
+    case 9: return "uint16";
+    case 10: return "uint32";
+    case 11: return "uint64";
+    case 12: return "logical";
+    default: return "unknown";
+    }
+}
+
+// Type code for a value acceptable as a column, or -1.
+
+static int32_t
+column_type_code (const octave_value& val)
+{
+  if (val.issparse () || val.iscomplex ())
+    return -1;
+
+  if (val.islogical ())
+    return 12;
+  else if (val.is_int8_type ())
+    return 4;
+  else if (val.is_int16_type ())
+    return 5;
+  else if (val.is_int32_type ())
+    return 6;
+  else if (val.is_int64_type ())
+    return 7;
+  else if (val.is_uint8_type ())
+    return 8;
+  else if (val.is_uint16_type ())
+    return 9;
+  else if (val.is_uint32_type ())
+    return 10;
+  else if (val.is_uint64_type ())
+    return 11;
+  else if (val.is_single_type ())
+    return 1;
+  else if (val.is_double_type ())
+    return 0;
+  else
+    return -1;
+}
+
+template <typename T>
+static void
+release_mapped_column (T *data, std::size_t len)
+{
+  sys::mapped_file::release_range (data, len * sizeof (T));
+}
+
+// Access to one columnar table file.  Opens a memory mapping when the
+// system provides one and falls back to ordinary stream reads
+// otherwise; callers only see the column directory and typed column
+// values.
+
+class column_store
+{
+public:
+
+  column_store (const std::string& who, const std::string& file)
+    : m_map (), m_fs (), m_file (file), m_nrows (0), m_cols (), m_buf ()
+  {
+    std::string header;
+
+    if (m_map.open (file))
+      header.assign (m_map.data (),
+                     std::min (m_map.size (), static_cast<std::size_t> (20)));
+    else
+      {
+        m_fs.open (file, std::ios::in | std::ios::binary);
+
+        if (! m_fs)
+          error ("%s: unable to open file '%s'", who.c_str (), file.c_str ());
+
+        char buf[20];
+        m_fs.read (buf, sizeof (buf));
+        header.assign (buf, m_fs.gcount ());
+      }
+
+    if (header.length () < 20
+        || std::memcmp (header.data (), "OCTCOLT1", 8) != 0)
+      error ("%s: '%s' is not a columnar table file",
+             who.c_str (), file.c_str ());
+
+    int64_t nrows;
+    int32_t ncols;
+    std::memcpy (&nrows, header.data () + 8, 8);
+    std::memcpy (&ncols, header.data () + 16, 4);
+
+    if (nrows < 0 || ncols < 1)
+      error ("%s: corrupt column directory in '%s'",
+             who.c_str (), file.c_str ());
+
+    m_nrows = nrows;
+
+    for (int32_t i = 0; i < ncols; i++)
+      {
+        column_info ci;
+
+        int32_t name_len;
+        read_directory (who, &name_len, 4);
+
+        if (name_len < 1 || name_len > 65535)
+          error ("%s: corrupt column directory in '%s'",
+                 who.c_str (), file.c_str ());
+
+        ci.name.resize (name_len);
+        read_directory (who, &ci.name[0], name_len);
+        read_directory (who, &ci.type, 4);
+        read_directory (who, &ci.offset, 8);
+        read_directory (who, &ci.nbytes, 8);
+
+        std::size_t elem_size = column_elem_size (ci.type);
+
+        if (elem_size == 0 || ci.offset < 0 || ci.nbytes < 0
+            || ci.nbytes != m_nrows * static_cast<int64_t> (elem_size))
+          error ("%s: corrupt column directory in '%s'",
+                 who.c_str (), file.c_str ());
+
+        m_cols.push_back (ci);
+      }
+  }
+
+  // No copying!
+
+  column_store (const column_store&) = delete;
+
+  column_store& operator = (const column_store&) = delete;
+
+  octave_idx_type rows () const { return m_nrows; }
+
+  const std::vector<column_info>& columns () const { return m_cols; }
+
+  const column_info *
+  lookup (const std::string& who, const std::string& name) const
+  {
+    for (const column_info& ci : m_cols)
+      if (ci.name == name)
+        return &ci;
+
+    error ("%s: no column '%s' in '%s'",
+           who.c_str (), name.c_str (), m_file.c_str ());
+  }
+
+  // The full column as an Octave value.  When the file is mapped the
+  // array adopts a private copy-on-write mapping of the column's
+  // pages, so nothing is copied and clean pages stay shared with
+  // other processes scanning the same file.
+
+  octave_value read_column (const std::string& who, const column_info& ci)
+  {
+    if (m_map.is_open ())
+      {
+        void *data
+          = m_map.map_range (static_cast<std::size_t> (ci.offset),
+                             static_cast<std::size_t> (ci.nbytes));
+
+        if (data)
+          return make_mapped_value (ci.type, data, m_nrows);
+      }
+
+    // No mapping available; copy through the stream.
+
+    const char *bytes = column_bytes (who, ci);
+
+    Array<octave_idx_type> all (dim_vector (m_nrows, 1));
+    for (octave_idx_type i = 0; i < m_nrows; i++)
+      all.xelem (i) = i;
+
+    return gather_value (ci.type, bytes, all);
+  }
+
+  // Raw bytes of one column, for predicate evaluation and row
+  // gathering.  The pointer is valid until the next call.
+
+  const char * column_bytes (const std::string& who, const column_info& ci)
+  {
+    if (m_map.is_open ())
+      return m_map.data () + ci.offset;
+
+    m_buf.resize (ci.nbytes);
+    m_fs.clear ();
+    m_fs.seekg (ci.offset);
+    m_fs.read (&m_buf[0], ci.nbytes);
+
+    if (! m_fs || m_fs.gcount () != ci.nbytes)
+      error ("%s: error reading column '%s'", who.c_str (), ci.name.c_str ());
+
+    return m_buf.data ();
+  }
+
+  static octave_value
+  make_mapped_value (int32_t type, void *data, octave_idx_type nrows)
+  {
+    switch (type)
+      {
+      case 0: return octave_value (NDArray (adopt<double> (data, nrows)));
+      case 1:
+        return octave_value (FloatNDArray (adopt<float> (data, nrows)));
+      case 4:
+        return octave_value (int8NDArray (adopt<octave_int8> (data, nrows)));
+      case 5:
+        return octave_value (int16NDArray (adopt<octave_int16> (data, nrows)));
+      case 6:
+        return octave_value (int32NDArray (adopt<octave_int32> (data, nrows)));
+      case 7:
+        return octave_value (int64NDArray (adopt<octave_int64> (data, nrows)));
+      case 8:
+        return octave_value (uint8NDArray (adopt<octave_uint8> (data, nrows)));
+      case 9:
+        return octave_value (uint16NDArray (adopt<octave_uint16>
+                                              (data, nrows)));
+      case 10:
+        return octave_value (uint32NDArray (adopt<octave_uint32>
+                                              (data, nrows)));
+      case 11:
+        return octave_value (uint64NDArray (adopt<octave_uint64>
+                                              (data, nrows)));
+      case 12:
+        return octave_value (boolNDArray (adopt<bool> (data, nrows)));
+      default:
+        panic_impossible ();
+      }
+  }
+
+  static octave_value
+  gather_value (int32_t type, const char *bytes,
+                const Array<octave_idx_type>& ridx)
+  {
+    switch (type)
+      {
+      case 0: return octave_value (NDArray (gather<double> (bytes, ridx)));
+      case 1:
+        return octave_value (FloatNDArray (gather<float> (bytes, ridx)));
+      case 4:
+        return octave_value (int8NDArray (gather<octave_int8> (bytes, ridx)));
+      case 5:
+        return octave_value (int16NDArray (gather<octave_int16>
+                                             (bytes, ridx)));
+      case 6:
+        return octave_value (int32NDArray (gather<octave_int32>
+                                             (bytes, ridx)));
+      case 7:
+        return octave_value (int64NDArray (gather<octave_int64>
+                                             (bytes, ridx)));
+      case 8:
+        return octave_value (uint8NDArray (gather<octave_uint8>
+                                             (bytes, ridx)));
+      case 9:
+        return octave_value (uint16NDArray (gather<octave_uint16>
+                                              (bytes, ridx)));
+      case 10:
+        return octave_value (uint32NDArray (gather<octave_uint32>
+                                              (bytes, ridx)));
+      case 11:
+        return octave_value (uint64NDArray (gather<octave_uint64>
+                                              (bytes, ridx)));
+      case 12:
+        return octave_value (boolNDArray (gather<bool> (bytes, ridx)));
+      default:
+        panic_impossible ();
+      }
+  }
+
+private:
+
+  template <typename T>
+  static Array<T> adopt (void *data, octave_idx_type nrows)
+  {
+    return Array<T> (static_cast<T *> (data), dim_vector (nrows, 1),
+                     release_mapped_column<T>);
+  }
+
+  template <typename T>
+  static Array<T>
+  gather (const char *bytes, const Array<octave_idx_type>& ridx)
+  {
+    const T *src = reinterpret_cast<const T *> (bytes);
+
+    octave_idx_type n = ridx.numel ();
+
+    Array<T> result (dim_vector (n, 1));
+    T *dst = result.fortran_vec ();
+
+    for (octave_idx_type i = 0; i < n; i++)
+      dst[i] = src[ridx.xelem (i)];
+
+    return result;
+  }
+
+  void read_directory (const std::string& who, void *dest, std::size_t len)
+  {
+    if (m_map.is_open ())
+      {
+        if (m_dir_pos + len > m_map.size ())
+          error ("%s: corrupt column directory in '%s'",
+                 who.c_str (), m_file.c_str ());
+
+        std::memcpy (dest, m_map.data () + m_dir_pos, len);
+        m_dir_pos += len;
+      }
+    else
+      {
+        m_fs.read (static_cast<char *> (dest), len);
+
+        if (! m_fs || m_fs.gcount () != static_cast<std::streamsize> (len))
+          error ("%s: corrupt column directory in '%s'",
+                 who.c_str (), m_file.c_str ());
+      }
+  }
+
+  sys::mapped_file m_map;
+
+  std::ifstream m_fs;
+
+  std::string m_file;
+
+  octave_idx_type m_nrows;
+
+  std::vector<column_info> m_cols;
+
+  // Directory read position within the mapping.
+  std::size_t m_dir_pos = 20;
+
+  // Scratch buffer for column_bytes on the stream path.
+  std::string m_buf;
+};
+
+// Comparison of every element of a column against a scalar, producing
+// the row mask for a filtered scan.  Elements are compared through
+// their native scalar type so only the predicate column's pages are
+// touched.
+
+enum scan_op { op_lt, op_le, op_gt, op_ge, op_eq, op_ne };
+
+template <typename T>
+static void
+eval_predicate (const char *bytes, octave_idx_type nrows, scan_op op,
+                double rhs, boolNDArray& mask)
+{
+  const T *p = reinterpret_cast<const T *> (bytes);
+  bool *m = mask.fortran_vec ();
+
+  for (octave_idx_type i = 0; i < nrows; i++)
+    {
+      double lhs = static_cast<double> (p[i]);
+
+      switch (op)
+        {
+        case op_lt: m[i] = (lhs < rhs); break;
+        case op_le: m[i] = (lhs <= rhs); break;
+        case op_gt: m[i] = (lhs > rhs); break;
+        case op_ge: m[i] = (lhs >= rhs); break;
+        case op_eq: m[i] = (lhs == rhs); break;
+        case op_ne: m[i] = (lhs != rhs); break;
+        }
+    }
+}
+
+static void
+eval_column_predicate (int32_t type, const char *bytes, octave_idx_type nrows,
+                       scan_op op, double rhs, boolNDArray& mask)
+{
+  switch (type)
+    {
+    case 0: eval_predicate<double> (bytes, nrows, op, rhs, mask); break;
+    case 1: eval_predicate<float> (bytes, nrows, op, rhs, mask); break;
+    case 4: eval_predicate<int8_t> (bytes, nrows, op, rhs, mask); break;
+    case 5: eval_predicate<int16_t> (bytes, nrows, op, rhs, mask); break;
+    case 6: eval_predicate<int32_t> (bytes, nrows, op, rhs, mask); break;
+    case 7: eval_predicate<int64_t> (bytes, nrows, op, rhs, mask); break;
+    case 8: eval_predicate<uint8_t> (bytes, nrows, op, rhs, mask); break;
+    case 9: eval_predicate<uint16_t> (bytes, nrows, op, rhs, mask); break;
+    case 10: eval_predicate<uint32_t> (bytes, nrows, op, rhs, mask); break;
+    case 11: eval_predicate<uint64_t> (bytes, nrows, op, rhs, mask); break;
+    case 12: eval_predicate<bool> (bytes, nrows, op, rhs, mask); break;
+    default: panic_impossible ();
+    }
+}
+
+static scan_op
+lookup_scan_op (const std::string& who, const std::string& op)
+{
+  if (op == "<")
+    return op_lt;
+  else if (op == "<=")
+    return op_le;
+  else if (op == ">")
+    return op_gt;
+  else if (op == ">=")
+    return op_ge;
+  else if (op == "==")
+    return op_eq;
+  else if (op == "!=" || op == "~=")
+    return op_ne;
+
+  error ("%s: invalid comparison operator '%s'", who.c_str (), op.c_str ());
+}
+
+// Column selection argument: a single name or a cell array of names.
+
+static std::vector<std::string>
+column_selection (const std::string& who, const octave_value& val)
+{
+  std::vector<std::string> names;
+
+  if (val.is_string ())
+    names.push_back (val.string_value ());
+  else if (val.iscellstr ())
+    {
+      Array<std::string> tmp = val.cellstr_value ();
+
+      for (octave_idx_type i = 0; i < tmp.numel (); i++)
+        names.push_back (tmp.xelem (i));
+    }
+  else
+    error ("%s: COLS must be a column name or a cell array of column names",
+           who.c_str ());
+
+  return names;
+}
+
+template <typename ArrayT>
+static void
+write_array_bytes (std::ostream& os, const ArrayT& a)
+{
+  typedef typename ArrayT::element_type T;
+
+  os.write (reinterpret_cast<const char *> (a.data ()),
+            a.numel () * sizeof (T));
+}
+
+static void
+write_column_data (std::ostream& os, const octave_value& val, int32_t type)
+{
+  switch (type)
+    {
+    case 0: write_array_bytes (os, val.array_value ()); break;
+    case 1: write_array_bytes (os, val.float_array_value ()); break;
+    case 4: write_array_bytes (os, val.int8_array_value ()); break;
+    case 5: write_array_bytes (os, val.int16_array_value ()); break;
+    case 6: write_array_bytes (os, val.int32_array_value ()); break;
+    case 7: write_array_bytes (os, val.int64_array_value ()); break;
+    case 8: write_array_bytes (os, val.uint8_array_value ()); break;
+    case 9: write_array_bytes (os, val.uint16_array_value ()); break;
+    case 10: write_array_bytes (os, val.uint32_array_value ()); break;
+    case 11: write_array_bytes (os, val.uint64_array_value ()); break;
+    case 12: write_array_bytes (os, val.bool_array_value ()); break;
+    default: panic_impossible ();
+    }
+}
+
+DEFUN (colwrite, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} colwrite (@var{file}, @var{s})
+Write the columns of the scalar struct @var{s} to @var{file} in
+columnar table format.
+
+Each field of @var{s} must be a full real numeric or logical column
+vector and all fields must have the same number of rows.  Each column
+is stored contiguously, so @code{colread} and @code{colscan} can later
+retrieve some columns without reading the others.
+
+The data is written in host byte order and is intended for processes
+on the same machine, not for interchange between platforms.
+@seealso{colread, colscan, colinfo}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  std::string file
+    = args(0).xstring_value ("colwrite: FILE must be a string");
+
+  octave_scalar_map sm
+    = args(1).xscalar_map_value ("colwrite: S must be a scalar struct");
+
+  string_vector keys = sm.keys ();
+
+  octave_idx_type ncols = keys.numel ();
+
+  if (ncols < 1)
+    error ("colwrite: S must have at least one field");
+
+  std::vector<column_info> cols;
+
+  int64_t nrows = -1;
+  int64_t header_size = 20;
+
+  for (octave_idx_type i = 0; i < ncols; i++)
+    {
+      octave_value val = sm.getfield (keys(i));
+
+      int32_t type = column_type_code (val);
+
+      if (type < 0)
+        error ("colwrite: field '%s' is not a real numeric or logical array",
+               keys(i).c_str ());
+
+      if (val.ndims () != 2 || val.columns () > 1)
+        error ("colwrite: field '%s' is not a column vector",
+               keys(i).c_str ());
+
+      if (nrows < 0)
+        nrows = val.rows ();
+      else if (val.rows () != nrows)
+        error ("colwrite: field '%s' has %" OCTAVE_IDX_TYPE_FORMAT
+               " rows, expected %" OCTAVE_IDX_TYPE_FORMAT,
+               keys(i).c_str (),
+               static_cast<octave_idx_type> (val.rows ()),
+               static_cast<octave_idx_type> (nrows));
+
+      column_info ci;
+      ci.name = keys(i);
+      ci.type = type;
+      ci.nbytes = nrows * column_elem_size (type);
+
+      cols.push_back (ci);
+
+      header_size += 4 + ci.name.length () + 4 + 8 + 8;
+    }
+
+  // Columns start on 8-byte boundaries so that mapped column data is
+  // suitably aligned for any element type.
+
+  int64_t offset = (header_size + 7) & ~static_cast<int64_t> (7);
+
+  for (column_info& ci : cols)
+    {
+      ci.offset = offset;
+      offset = (offset + ci.nbytes + 7) & ~static_cast<int64_t> (7);
+    }
+
+  std::ofstream os (file, std::ios::out | std::ios::binary
+                          | std::ios::trunc);
+
+  if (! os)
+    error ("colwrite: unable to open file '%s'", file.c_str ());
+
+  os.write ("OCTCOLT1", 8);
+  os.write (reinterpret_cast<const char *> (&nrows), 8);
+
+  int32_t ncols32 = ncols;
+  os.write (reinterpret_cast<const char *> (&ncols32), 4);
+
+  for (const column_info& ci : cols)
+    {
+      int32_t name_len = ci.name.length ();
+      os.write (reinterpret_cast<const char *> (&name_len), 4);
+      os.write (ci.name.data (), name_len);
+      os.write (reinterpret_cast<const char *> (&ci.type), 4);
+      os.write (reinterpret_cast<const char *> (&ci.offset), 8);
+      os.write (reinterpret_cast<const char *> (&ci.nbytes), 8);
+    }
+
+  static const char pad[8] = { 0 };
+
+  int64_t pos = header_size;
+
+  for (octave_idx_type i = 0; i < ncols; i++)
+    {
+      os.write (pad, cols[i].offset - pos);
+
+      write_column_data (os, sm.getfield (keys(i)), cols[i].type);
+
+      pos = cols[i].offset + cols[i].nbytes;
+    }
+
+  if (! os)
+    error ("colwrite: error writing file '%s'", file.c_str ());
+
+  return ovl ();
+}
+
+/*
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   s.a = (1:1000)';
+%!   s.b = single (2:2:2000)';
+%!   s.c = int32 (-500:499)';
+%!   s.d = mod ((1:1000)', 3) == 0;
+%!   colwrite (f, s);
+%!   t = colread (f);
+%!   assert (t, s);
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+
+%!error colwrite ()
+%!error <FILE must be a string> colwrite (1, struct ("a", 1))
+%!error <must be a scalar struct> colwrite (tempname (), 1)
+%!error <not a column vector> colwrite (tempname (), struct ("a", eye (3)))
+%!test
+%! s.a = (1:10)';
+%! s.b = (1:11)';
+%! fail ("colwrite (tempname (), s)", "has 11 rows, expected 10");
+*/
+
+DEFUN (colread, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{s} =} colread (@var{file})
+@deftypefnx {} {@var{s} =} colread (@var{file}, @var{cols})
+Read columns from the columnar table file @var{file} into a struct.
+
+With one argument all columns are returned.  @var{cols} may name a
+single column or be a cell array of column names; only the named
+columns are then loaded and pages belonging to other columns are never
+read from disk.
+
+Where the system supports memory mapping, each returned column adopts
+a private copy-on-write mapping of its bytes in the file, so loading
+is lazy and the clean pages are shared with every other process
+reading the same file (see @code{ismapped}).
+@seealso{colwrite, colscan, colinfo, ismapped}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+
+  std::string file
+    = args(0).xstring_value ("colread: FILE must be a string");
+
+  column_store store ("colread", file);
+
+  octave_scalar_map retval;
+
+  if (nargin == 1)
+    {
+      for (const column_info& ci : store.columns ())
+        retval.setfield (ci.name, store.read_column ("colread", ci));
+    }
+  else
+    {
+      for (const std::string& name : column_selection ("colread", args(1)))
+        {
+          const column_info *ci = store.lookup ("colread", name);
+
+          retval.setfield (name, store.read_column ("colread", *ci));
+        }
+    }
+
+  return ovl (retval);
+}
+
+/*
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   s.x = rand (512, 1);
+%!   s.y = rand (512, 1);
+%!   s.z = uint16 (1:512)';
+%!   colwrite (f, s);
+%!   t = colread (f, "y");
+%!   assert (fieldnames (t), {"y"});
+%!   assert (t.y, s.y);
+%!   t = colread (f, {"z", "x"});
+%!   assert (fieldnames (t), {"z"; "x"});
+%!   assert (t.z, s.z);
+%!   assert (t.x, s.x);
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+
+%!test
+%! ## Mapped columns may be modified freely; the file is untouched.
+%! f = tempname ();
+%! unwind_protect
+%!   s.a = (1:100)';
+%!   colwrite (f, s);
+%!   t = colread (f);
+%!   if (isunix ())
+%!     assert (ismapped (t.a), true);
+%!   endif
+%!   t.a(1) = -1;
+%!   assert (colread (f).a, s.a);
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+
+%!error colread ()
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   colwrite (f, struct ("a", 1));
+%!   fail ('colread (f, "b")', "no column 'b'");
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+*/
+
+DEFUN (colscan, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{s} =} colscan (@var{file}, @var{cols}, @var{predcol}, @var{op}, @var{value})
+Return the rows of the named columns of @var{file} for which the
+predicate column satisfies a comparison.
+
+The predicate @code{@var{predcol} @var{op} @var{value}} is evaluated
+against every row, where @var{op} is one of @qcode{"<"}, @qcode{"<="},
+@qcode{">"}, @qcode{">="}, @qcode{"=="}, or @qcode{"!="} and
+@var{value} is a scalar.  Only the predicate column and the columns
+named in @var{cols} are read; the matching rows are returned as a
+struct of column vectors.
+
+For example, selecting the hot rows of a large event table touches
+two columns of the file rather than the whole table:
+
+@example
+@group
+s = colscan ("events.ct", @{"id", "t"@}, "temp", ">", 90);
+@end group
+@end example
+@seealso{colwrite, colread, colinfo}
+@end deftypefn */)
+{
+  if (args.length () != 5)
+    print_usage ();
+
+  std::string file
+    = args(0).xstring_value ("colscan: FILE must be a string");
+
+  std::vector<std::string> names = column_selection ("colscan", args(1));
+
+  std::string predcol
+    = args(2).xstring_value ("colscan: PREDCOL must be a column name");
+
+  scan_op op
+    = lookup_scan_op ("colscan",
+                      args(3).xstring_value ("colscan: OP must be a string"));
+
+  double rhs = args(4).xscalar_value ("colscan: VALUE must be a scalar");
+
+  column_store store ("colscan", file);
+
+  const column_info *pred = store.lookup ("colscan", predcol);
+
+  octave_idx_type nrows = store.rows ();
+
+  boolNDArray mask (dim_vector (nrows, 1));
+
+  eval_column_predicate (pred->type,
+                         store.column_bytes ("colscan", *pred),
+                         nrows, op, rhs, mask);
+
+  octave_idx_type nmatch = 0;
+  for (octave_idx_type i = 0; i < nrows; i++)
+    if (mask.xelem (i))
+      nmatch++;
+
+  Array<octave_idx_type> ridx (dim_vector (nmatch, 1));
+
+  for (octave_idx_type i = 0, k = 0; i < nrows; i++)
+    if (mask.xelem (i))
+      ridx.xelem (k++) = i;
+
+  octave_scalar_map retval;
+
+  for (const std::string& name : names)
+    {
+      const column_info *ci = store.lookup ("colscan", name);
+
+      retval.setfield (name,
+                       column_store::gather_value
+                         (ci->type,
+                          store.column_bytes ("colscan", *ci), ridx));
+    }
+
+  return ovl (retval);
+}
+
+/*
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   s.id = (1:1000)';
+%!   s.temp = mod ((1:1000)', 100);
+%!   s.flag = mod ((1:1000)', 2) == 0;
+%!   colwrite (f, s);
+%!   t = colscan (f, {"id", "flag"}, "temp", ">", 97);
+%!   sel = s.temp > 97;
+%!   assert (t.id, s.id(sel));
+%!   assert (t.flag, s.flag(sel));
+%!   t = colscan (f, "id", "id", "==", 42);
+%!   assert (t.id, 42);
+%!   t = colscan (f, "id", "id", "<", 1);
+%!   assert (t.id, zeros (0, 1));
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+
+%!error colscan ()
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   colwrite (f, struct ("a", (1:10)'));
+%!   fail ('colscan (f, "a", "a", "!", 1)', "invalid comparison operator");
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+*/
+
+DEFUN (colinfo, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{info} =} colinfo (@var{file})
+Return a struct describing the columnar table file @var{file} without
+reading any column data.
+
+The result has fields @code{rows} (the number of rows), @code{columns}
+(a cell array of column names), and @code{class} (a cell array of the
+corresponding element classes).
+@seealso{colwrite, colread, colscan}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  std::string file
+    = args(0).xstring_value ("colinfo: FILE must be a string");
+
+  column_store store ("colinfo", file);
+
+  octave_idx_type ncols = store.columns ().size ();
+
+  Cell names (dim_vector (ncols, 1));
+  Cell classes (dim_vector (ncols, 1));
+
+  for (octave_idx_type i = 0; i < ncols; i++)
+    {
+      const column_info& ci = store.columns ()[i];
+
+      names(i) = ci.name;
+      classes(i) = std::string (column_class_name (ci.type));
+    }
+
+  octave_scalar_map retval;
+
+  retval.setfield ("rows", static_cast<double> (store.rows ()));
+  retval.setfield ("columns", names);
+  retval.setfield ("class", classes);
+
+  return ovl (retval);
+}
+
+/*
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   s.a = (1:7)';
+%!   s.b = uint8 (1:7)';
+%!   colwrite (f, s);
+%!   info = colinfo (f);
+%!   assert (info.rows, 7);
+%!   assert (info.columns, {"a"; "b"});
+%!   assert (info.class, {"double"; "uint8"});
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+
+%!error colinfo ()
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   fid = fopen (f, "w");
+%!   fwrite (fid, "not a table");
+%!   fclose (fid);
+%!   fail ("colinfo (f)", "not a columnar table file");
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -53,6 +53,7 @@
 #include "oct-map.h"
 #include "ov-class.h"
 #include "ov-complex.h"
+#include "ov-const-mat.h"
 #include "ov-cx-mat.h"
 #include "ov-cx-sparse.h"
 #include "ov-float.h"
@@ -2510,6 +2511,23 @@ cat (4, ones (2, 2), zeros (2, 2))
 %! assert (cat (1, A, B), {1; 2});
 %! assert (cat (2, A, B), {1; 2});
 
+%!test
+%! ## Concatenation along an interior dimension copies one chunk per page.
+%! a = reshape (1:24, 2, 3, 4);
+%! b = reshape (25:48, 2, 3, 4);
+%! c = cat (2, a, b);
+%! assert (size (c), [2, 6, 4]);
+%! assert (c(:,1:3,:), a);
+%! assert (c(:,4:6,:), b);
+
+%!test
+%! ## Struct and cell concatenation share the same copy path.
+%! s = struct ("a", {1, 2}, "b", {3, 4});
+%! t = struct ("a", {5, 6}, "b", {7, 8});
+%! u = cat (2, s, t);
+%! assert ({u.a}, {1, 2, 5, 6});
+%! assert (cat (3, {1, 2}, {3, 4}), reshape ({1, 2, 3, 4}, [1, 2, 2]));
+
 %!error <dimension mismatch> cat (3, cat (3, [], []), [1,2;3,4])
 %!error <dimension mismatch> cat (3, zeros (0, 0, 2), [1,2;3,4])
 */
@@ -4243,7 +4261,13 @@ fill_matrix (const octave_value_list& args, int val, const char *fcn)
       if (iscomplex)
         retval = ComplexNDArray (dims, Complex (val, 0));
       else
-        retval = NDArray (dims, val);
+        {
+          // Keep zeros and ones symbolic until some operation needs
+          // the expanded array (see ov-const-mat.h).
+
+          retval = octave_value (new octave_const_matrix (val, dims));
+          retval.maybe_mutate ();
+        }
       break;
 
     case oct_data_conv::dt_logical:
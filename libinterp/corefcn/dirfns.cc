@@ -39,6 +39,7 @@
 #include "file-ops.h"
 #include "file-stat.h"
 #include "glob-match.h"
+#include "lo-ieee.h"
 #include "oct-env.h"
 #include "oct-glob.h"
 #include "pathsearch.h"
@@ -52,6 +53,7 @@
 #include "event-manager.h"
 #include "input.h"
 #include "load-path.h"
+#include "oct-map.h"
 #include "octave.h"
 #include "ovl.h"
 #include "pager.h"
@@ -176,6 +178,186 @@ error message.
   return retval;
 }
 
+DEFUN (__batch_lstat__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {[@var{st}, @var{err}, @var{msg}] =} __batch_lstat__ (@var{files})
+@deftypefnx {} {[@var{st}, @var{err}, @var{msg}] =} __batch_lstat__ (@var{files}, "basic")
+Stat every file in the cell array of file names @var{files} in a single
+call and return a struct array @var{st} with one element per file.
+
+Symbolic links that point to something are reported as their targets,
+matching what @code{dir} does; dangling links are reported as the link
+itself.  @var{err} is a column vector that is 0 for each file that
+could be examined and -1 otherwise, and @var{msg} is a cell array of
+the corresponding system error messages.
+
+With the optional @qcode{"basic"} selector, @var{st} contains only the
+@code{mode}, @code{size}, and @code{mtime} fields, skipping the fields
+(uid, gid, @dots{}) that callers listing names and sizes never look
+at.
+
+Looping over @code{lstat} costs one interpreter round trip per file;
+batching the loop here is what makes @code{dir} on large directories
+tolerable over slow filesystems.
+@seealso{lstat, stat, readdir, dir}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+
+  Array<std::string> files
+    = args(0).xcellstr_value ("__batch_lstat__: FILES must be a cell array of strings");
+
+  bool basic = false;
+
+  if (nargin == 2)
+    {
+      std::string fields
+        = args(1).xstring_value ("__batch_lstat__: FIELDS must be a string");
+
+      if (fields == "basic")
+        basic = true;
+      else if (fields != "full")
+        error ("__batch_lstat__: FIELDS must be \"basic\" or \"full\"");
+    }
+
+  static bool have_rdev
+    = sys::base_file_stat::have_struct_stat_st_rdev ();
+  static bool have_blksize
+    = sys::base_file_stat::have_struct_stat_st_blksize ();
+  static bool have_blocks
+    = sys::base_file_stat::have_struct_stat_st_blocks ();
+
+  static double nan = numeric_limits<double>::NaN ();
+
+  octave_idx_type n = files.numel ();
+
+  dim_vector dv (n, 1);
+
+  Cell dev (dv), ino (dv), mode (dv), modestr (dv), nlink (dv);
+  Cell uid (dv), gid (dv), rdev (dv), size (dv);
+  Cell atime (dv), mtime (dv), ctime (dv), blksize (dv), blocks (dv);
+
+  NDArray err (dv, 0.0);
+  Cell msg (dv, octave_value (""));
+
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      std::string fname = sys::file_ops::tilde_expand (files(i));
+
+      sys::file_stat fs (fname, false);
+
+      if (fs && fs.is_lnk ())
+        {
+          // Report the target of a link that points to something,
+          // the link itself otherwise.
+          sys::file_stat target (fname, true);
+
+          if (target)
+            fs = target;
+        }
+
+      if (! fs)
+        {
+          err(i) = -1;
+          msg(i) = fs.error ();
+          continue;
+        }
+
+      mode(i) = static_cast<double> (fs.mode ());
+      size(i) = static_cast<double> (fs.size ());
+      mtime(i) = fs.mtime ().double_value ();
+
+      if (! basic)
+        {
+          dev(i) = static_cast<double> (fs.dev ());
+          ino(i) = static_cast<double> (fs.ino ());
+          modestr(i) = fs.mode_as_string ();
+          nlink(i) = static_cast<double> (fs.nlink ());
+          uid(i) = static_cast<double> (fs.uid ());
+          gid(i) = static_cast<double> (fs.gid ());
+          rdev(i) = (have_rdev ? static_cast<double> (fs.rdev ()) : nan);
+          atime(i) = fs.atime ().double_value ();
+          ctime(i) = fs.ctime ().double_value ();
+          blksize(i) = (have_blksize
+                        ? static_cast<double> (fs.blksize ()) : nan);
+          blocks(i) = (have_blocks
+                       ? static_cast<double> (fs.blocks ()) : nan);
+        }
+    }
+
+  octave_map st (dv);
+
+  // Field order matches mk_stat_map in syscalls.cc so that the
+  // elements are interchangeable with what lstat returns.
+
+  if (! basic)
+    {
+      st.assign ("dev", dev);
+      st.assign ("ino", ino);
+    }
+
+  st.assign ("mode", mode);
+
+  if (! basic)
+    {
+      st.assign ("modestr", modestr);
+      st.assign ("nlink", nlink);
+      st.assign ("uid", uid);
+      st.assign ("gid", gid);
+      st.assign ("rdev", rdev);
+    }
+
+  st.assign ("size", size);
+
+  if (! basic)
+    st.assign ("atime", atime);
+
+  st.assign ("mtime", mtime);
+
+  if (! basic)
+    {
+      st.assign ("ctime", ctime);
+      st.assign ("blksize", blksize);
+      st.assign ("blocks", blocks);
+    }
+
+  return ovl (st, err, msg);
+}
+
+/*
+%!test
+%! f = tempname ();
+%! unwind_protect
+%!   fid = fopen (f, "w");
+%!   fwrite (fid, uint8 (1:5));
+%!   fclose (fid);
+%!   [bst, berr, bmsg] = __batch_lstat__ ({f});
+%!   [st, err, msg] = lstat (f);
+%!   assert (berr, 0);
+%!   assert (bmsg, {""});
+%!   assert (bst, st);
+%!   assert (bst.size, 5);
+%! unwind_protect_cleanup
+%!   unlink (f);
+%! end_unwind_protect
+
+%!test
+%! [st, err, msg] = __batch_lstat__ ({tempname(), tempname()});
+%! assert (err, [-1; -1]);
+%! assert (size (st), [2, 1]);
+
+%!test
+%! [st, err] = __batch_lstat__ ({pwd()}, "basic");
+%! assert (err, 0);
+%! assert (fieldnames (st), {"mode"; "size"; "mtime"});
+
+%!error <FILES must be a cell array of strings> __batch_lstat__ (1)
+%!error <FIELDS must be "basic" or "full"> __batch_lstat__ ({pwd()}, "huge")
+*/
+
 // FIXME: should maybe also allow second arg to specify mode?
 //        OTOH, that might cause trouble with compatibility later...
 
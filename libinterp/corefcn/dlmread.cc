@@ -33,12 +33,15 @@
 #include <clocale>
 #include <cmath>
 #include <cctype>
+#include <cstdlib>
 #include <fstream>
 #include <limits>
+#include <vector>
 
 #include "file-ops.h"
 #include "lo-ieee.h"
 #include "lo-sysdep.h"
+#include "oct-parallel.h"
 
 #include "defun.h"
 #include "interpreter.h"
@@ -167,6 +170,307 @@ parse_range_spec (const octave_value& range_spec,
   return stat;
 }
 
+#if defined (_OPENMP)
+
+// Minimum buffer size before the chunked parallel parser below is
+// worth engaging.
+
+static const std::size_t parallel_parse_min_bytes = 1 << 20;
+
+// Chunked parallel parser for purely real numeric input.  The buffered
+// file is split at line boundaries and then read in two passes: the
+// first pass counts the widest row so the result matrix can be
+// allocated up front, and the second parses every field with strtod
+// directly on the buffer into the preallocated matrix, so no per-field
+// or per-row copies are made.  Any field that strtod cannot consume
+// completely -- complex values, NA, trailing garbage -- makes this
+// function give up so the caller can rerun the buffer through the
+// character-level reader, which keeps the semantics of the slow path
+// exactly.  Empty fields become EMPTY_VALUE just as they do there.
+//
+// SEP and AUTO_SEP_IS_WSPACE are updated with the separator inference
+// performed here so a fallback does not re-infer them differently.
+// Returns true and sets RDATA (ROWS x COLS) on success.
+
+// strtod accepts a few spellings ("infinity", "nan(...)", hex floats)
+// that read_value<double> does not.  Accept only plain numbers and the
+// exact Inf/NaN forms so the fast path stays compatible with the
+// character-level reader; anything else falls back to it.
+
+static bool
+dlmread_plain_number (const char *fb, const char *fe)
+{
+  const char *p = fb;
+  if (p < fe && (*p == '+' || *p == '-'))
+    p++;
+
+  if (fe - p == 3)
+    {
+      if ((p[0] == 'i' || p[0] == 'I') && (p[1] == 'n' || p[1] == 'N')
+          && (p[2] == 'f' || p[2] == 'F'))
+        return true;
+
+      if ((p[0] == 'n' || p[0] == 'N') && (p[1] == 'a' || p[1] == 'A')
+          && (p[2] == 'n' || p[2] == 'N'))
+        return true;
+    }
+
+  for (p = fb; p < fe; p++)
+    if (! (std::isdigit (static_cast<unsigned char> (*p))
+           || *p == '.' || *p == '+' || *p == '-'
+           || *p == 'e' || *p == 'E'))
+      return false;
+
+  return true;
+}
+
+static bool
+dlmread_fast_path (const std::string& buf, std::string& sep,
+                   bool& auto_sep_is_wspace, double empty_value,
+                   octave_idx_type r1, Matrix& rdata,
+                   octave_idx_type& rows, octave_idx_type& cols)
+{
+  // Collect non-blank lines (blank lines are always skipped here
+  // because the fast path requires a non-whitespace separator).
+
+  std::vector<std::pair<std::size_t, std::size_t>> lines;
+
+  std::size_t len = buf.length ();
+  std::size_t pos = 0;
+
+  while (pos < len)
+    {
+      std::size_t eol = buf.find ('\n', pos);
+      std::size_t line_len = (eol == std::string::npos ? len : eol) - pos;
+
+      // Strip CR from CRLF line endings.
+      if (line_len > 0 && buf[pos + line_len - 1] == '\r')
+        line_len--;
+
+      if (buf.find_first_not_of (" \t", pos, 2) < pos + line_len)
+        {
+          lines.emplace_back (pos, line_len);
+
+          if (static_cast<octave_idx_type> (lines.size ()) > r1)
+            break;
+        }
+
+      if (eol == std::string::npos)
+        break;
+
+      pos = eol + 1;
+    }
+
+  rows = lines.size ();
+  cols = 0;
+
+  if (rows == 0)
+    {
+      rdata = Matrix (0, 0);
+      return true;
+    }
+
+  // Infer the separator from the first line the same way the
+  // character-level reader does.
+
+  if (sep.empty ())
+    {
+      std::string line = buf.substr (lines[0].first, lines[0].second);
+
+      std::size_t pos1 = line.find_first_not_of (" \t");
+      std::size_t n = line.find_first_of (",:; \t", pos1);
+
+      if (n == std::string::npos || line[n] == ' ' || line[n] == '\t')
+        {
+          sep = " \t";
+          auto_sep_is_wspace = true;
+        }
+      else
+        sep = line[n];
+    }
+
+  int nthreads = octave::parallel_num_threads ();
+
+  // Pass 1: count the widest row so the result can be allocated once
+  // at its final size instead of being grown while parsing.
+
+  std::vector<octave_idx_type> thread_cols (nthreads, 0);
+
+#pragma omp parallel for schedule (static) num_threads (nthreads)
+  for (int t = 0; t < nthreads; t++)
+    {
+      octave_idx_type beg = t * rows / nthreads;
+      octave_idx_type end = (t + 1) * rows / nthreads;
+      octave_idx_type my_cols = 0;
+
+      for (octave_idx_type l = beg; l < end; l++)
+        {
+          const char *p = buf.data () + lines[l].first;
+          const char *pend = p + lines[l].second;
+          octave_idx_type nfields = 0;
+
+          if (auto_sep_is_wspace)
+            {
+              // One field per run of non-whitespace characters.
+              while (p < pend)
+                {
+                  while (p < pend && (*p == ' ' || *p == '\t'))
+                    p++;
+                  if (p == pend)
+                    break;
+                  nfields++;
+                  while (p < pend && *p != ' ' && *p != '\t')
+                    p++;
+                }
+            }
+          else
+            {
+              octave_idx_type nsep = 0;
+              const char *last = p;
+              for (const char *q = p; q < pend; q++)
+                if (sep.find (*q) != std::string::npos)
+                  {
+                    nsep++;
+                    last = q + 1;
+                  }
+
+              // Separator followed by EOL doesn't generate an extra
+              // column.
+              bool tail = false;
+              for (const char *q = last; q < pend; q++)
+                if (*q != ' ' && *q != '\t')
+                  {
+                    tail = true;
+                    break;
+                  }
+
+              nfields = nsep + (tail ? 1 : 0);
+            }
+
+          my_cols = std::max (my_cols, nfields);
+        }
+
+      thread_cols[t] = my_cols;
+    }
+
+  for (int t = 0; t < nthreads; t++)
+    cols = std::max (cols, thread_cols[t]);
+
+  rdata = Matrix (rows, cols, empty_value);
+
+  double *data = rdata.fortran_vec ();
+
+  // Pass 2: parse every field with strtod directly on the buffer into
+  // the preallocated matrix.
+
+  std::vector<unsigned char> thread_ok (nthreads, 1);
+
+#pragma omp parallel for schedule (static) num_threads (nthreads)
+  for (int t = 0; t < nthreads; t++)
+    {
+      octave_idx_type beg = t * rows / nthreads;
+      octave_idx_type end = (t + 1) * rows / nthreads;
+
+      for (octave_idx_type l = beg; l < end && thread_ok[t]; l++)
+        {
+          const char *p = buf.data () + lines[l].first;
+          const char *pend = p + lines[l].second;
+          octave_idx_type jcol = 0;
+
+          if (auto_sep_is_wspace)
+            {
+              while (p < pend)
+                {
+                  while (p < pend && (*p == ' ' || *p == '\t'))
+                    p++;
+                  if (p == pend)
+                    break;
+
+                  const char *fb = p;
+                  while (p < pend && *p != ' ' && *p != '\t')
+                    p++;
+
+                  char *fend_p = nullptr;
+                  double x = std::strtod (fb, &fend_p);
+
+                  if (fend_p != p || jcol >= cols
+                      || ! dlmread_plain_number (fb, p))
+                    {
+                      // Complex value, NA, text, or trailing garbage:
+                      // let the slow path decide.
+                      thread_ok[t] = 0;
+                      break;
+                    }
+
+                  data[l + jcol++ * rows] = x;
+                }
+            }
+          else
+            {
+              const char *fs = p;
+
+              while (true)
+                {
+                  const char *q = fs;
+                  while (q < pend && sep.find (*q) == std::string::npos)
+                    q++;
+
+                  // Trim surrounding whitespace inside the field.
+                  const char *fb = fs;
+                  while (fb < q && (*fb == ' ' || *fb == '\t'))
+                    fb++;
+                  const char *fe = q;
+                  while (fe > fb && (fe[-1] == ' ' || fe[-1] == '\t'))
+                    fe--;
+
+                  // Separator followed by EOL doesn't generate an
+                  // extra column.
+                  if (q == pend && fb == fe)
+                    break;
+
+                  if (jcol >= cols)
+                    {
+                      thread_ok[t] = 0;
+                      break;
+                    }
+
+                  if (fb != fe)
+                    {
+                      char *fend_p = nullptr;
+                      double x = std::strtod (fb, &fend_p);
+
+                      if (fend_p == fe && dlmread_plain_number (fb, fe))
+                        data[l + jcol * rows] = x;
+                      else
+                        {
+                          // Complex value, NA, text, or trailing
+                          // garbage: let the slow path decide.
+                          thread_ok[t] = 0;
+                          break;
+                        }
+                    }
+
+                  // Empty fields keep the EMPTY_VALUE fill.
+                  jcol++;
+
+                  if (q == pend)
+                    break;
+
+                  fs = q + 1;
+                }
+            }
+        }
+    }
+
+  for (int t = 0; t < nthreads; t++)
+    if (! thread_ok[t])
+      return false;
+
+  return true;
+}
+
+#endif
+
 OCTAVE_BEGIN_NAMESPACE(octave)
 
 DEFMETHOD (dlmread, interp, args, ,
@@ -357,8 +661,73 @@ such as text, are also replaced by the @qcode{"emptyvalue"}.
 
   std::istringstream tmp_stream;
 
+  bool have_data = false;
+
+#if defined (_OPENMP)
+
+  std::istringstream buffered_input;
+
+  // For large files read from a plain (non-whitespace-separated) file
+  // name, buffer the remaining text and try the chunked parallel
+  // parser.  If it encounters anything it cannot handle exactly, the
+  // buffer is handed to the character-level reader below instead.
+
+  if (input == &input_file && ! sep_is_wspace
+      && octave::parallel_num_threads () > 1)
+    {
+      // Size the buffer from the stream so the remaining text is read
+      // with a single bulk read instead of being grown piecemeal.
+
+      std::string buf;
+
+      std::streampos cur_pos = input_file.tellg ();
+      input_file.seekg (0, std::ios::end);
+      std::streampos end_pos = input_file.tellg ();
+      input_file.seekg (cur_pos);
+
+      if (cur_pos >= std::streampos (0) && end_pos > cur_pos)
+        {
+          // The byte count is an upper bound; CRLF translation may
+          // deliver fewer characters than the probe suggests.
+          buf.resize (end_pos - cur_pos);
+          input_file.read (&buf[0], buf.size ());
+          buf.resize (input_file.gcount ());
+        }
+      else
+        {
+          std::ostringstream slurp;
+          slurp << input->rdbuf ();
+          buf = slurp.str ();
+        }
+
+      if (buf.length () >= parallel_parse_min_bytes)
+        {
+          octave_idx_type rows = 0;
+          octave_idx_type cols = 0;
+
+          if (dlmread_fast_path (buf, sep, auto_sep_is_wspace,
+                                 empty_value, r1, rdata, rows, cols))
+            {
+              r = rows;
+              c = cols;
+              i = rows;
+              j = cols;
+
+              have_data = true;
+            }
+        }
+
+      if (! have_data)
+        {
+          buffered_input.str (buf);
+          input = &buffered_input;
+        }
+    }
+
+#endif
+
   // Read the data one field at a time, growing the data matrix as needed.
-  while (getline (*input, line))
+  while (! have_data && getline (*input, line))
     {
       // Skip blank lines for compatibility.
       if ((! sep_is_wspace || auto_sep_is_wspace)
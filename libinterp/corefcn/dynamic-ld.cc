@@ -156,7 +156,7 @@ dynamic_loader::load_oct (const std::string& fcn_name,
 
   dynamic_library oct_file = m_loaded_shlibs.find_file (file_name);
 
-  if (oct_file && oct_file.is_out_of_date ())
+  if (oct_file && ! is_pinned (file_name) && oct_file.is_out_of_date ())
     clear (oct_file);
 
   if (! oct_file)
@@ -234,7 +234,7 @@ dynamic_loader::load_mex (const std::string& fcn_name,
 
   dynamic_library mex_file = m_loaded_shlibs.find_file (file_name);
 
-  if (mex_file && mex_file.is_out_of_date ())
+  if (mex_file && ! is_pinned (file_name) && mex_file.is_out_of_date ())
     clear (mex_file);
 
   if (! mex_file)
@@ -291,6 +291,41 @@ dynamic_loader::remove_mex (const std::string& fcn_name,
   return remove_oct (fcn_name, shl);
 }
 
+void
+dynamic_loader::pin_library (const std::string& file_name)
+{
+  dynamic_library lib = m_loaded_shlibs.find_file (file_name);
+
+  if (! lib)
+    lib.open (file_name);
+
+  if (! lib)
+    error ("%s is not a valid shared library", file_name.c_str ());
+
+  // Holding a reference here keeps the handle (and its resolved
+  // symbol cache) alive even after all functions from the library
+  // have been cleared, so reloading is a map lookup, not a dlopen.
+
+  m_pinned_libs[file_name] = lib;
+}
+
+bool
+dynamic_loader::unpin_library (const std::string& file_name)
+{
+  return m_pinned_libs.erase (file_name) > 0;
+}
+
+std::list<std::string>
+dynamic_loader::pinned_libraries () const
+{
+  std::list<std::string> retval;
+
+  for (const auto& p : m_pinned_libs)
+    retval.push_back (p.first);
+
+  return retval;
+}
+
 std::string
 dynamic_loader::name_mangler (const std::string& name)
 {
@@ -321,4 +356,89 @@ dynamic_loader::mex_f77_mangler (const std::string&)
   return STRINGIFY (F77_FUNC (mexfunction, MEXFUNCTION));
 }
 
+DEFMETHOD (pin_dynamic_library, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn  {} {} pin_dynamic_library (@var{file})
+@deftypefnx {} {@var{libs} =} pin_dynamic_library ()
+Keep the dynamically loaded library @var{file} open for the remainder
+of the session.
+
+@var{file} must be the name of a @file{.oct} or @file{.mex} file,
+including its path, as reported by @code{which} for a function it
+defines.  The library is opened immediately if it is not already
+loaded.
+
+Normally the handle for a library is dropped when the last function it
+defines is cleared, and the file's modification time is checked when
+its functions are loaded, so the next call to one of its functions
+pays for opening and inspecting the file again.  Pinning holds the
+handle open and skips the modification-time check, which removes that
+first-call cost; use it for stable libraries that are called early and
+often.  A pinned library is no longer reloaded automatically when the
+file changes on disk.
+
+When called with no arguments, return the list of currently pinned
+files as a cell array of strings.
+@seealso{unpin_dynamic_library, mlock, autoload}
+@end deftypefn */)
+{
+  dynamic_loader& dyn_loader = interp.get_dynamic_loader ();
+
+  if (args.length () == 0)
+    {
+      std::list<std::string> libs = dyn_loader.pinned_libraries ();
+
+      Cell c (dim_vector (libs.size (), 1));
+
+      octave_idx_type i = 0;
+      for (const auto& file : libs)
+        c(i++) = file;
+
+      return ovl (c);
+    }
+
+  for (int i = 0; i < args.length (); i++)
+    {
+      std::string file
+        = args(i).xstring_value ("pin_dynamic_library: FILE must be a string");
+
+      dyn_loader.pin_library (file);
+    }
+
+  return ovl ();
+}
+
+/*
+%!assert (iscellstr (pin_dynamic_library ()))
+%!error <FILE must be a string> pin_dynamic_library (1)
+*/
+
+DEFMETHOD (unpin_dynamic_library, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn {} {@var{tf} =} unpin_dynamic_library (@var{file})
+Release a library handle previously pinned with
+@code{pin_dynamic_library}.
+
+Returns true if @var{file} was pinned.  The library is closed once the
+last function it defines is cleared, as usual.
+@seealso{pin_dynamic_library}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  std::string file
+    = args(0).xstring_value ("unpin_dynamic_library: FILE must be a string");
+
+  dynamic_loader& dyn_loader = interp.get_dynamic_loader ();
+
+  return ovl (dyn_loader.unpin_library (file));
+}
+
+/*
+%!assert (unpin_dynamic_library ("__not_a_pinned_library__"), false)
+%!error <FILE must be a string> unpin_dynamic_library (1)
+%!error unpin_dynamic_library ()
+*/
+
 OCTAVE_END_NAMESPACE(octave)
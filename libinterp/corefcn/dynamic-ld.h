@@ -29,6 +29,7 @@
 #include "octave-config.h"
 
 #include <list>
+#include <map>
 #include <string>
 
 #include "oct-shlib.h"
@@ -101,6 +102,19 @@ public:
   bool remove_mex (const std::string& fcn_name,
                    dynamic_library& shl);
 
+  // Pinned libraries are held open for the life of the interpreter:
+  // clearing their functions no longer drops the library handle, and
+  // the modification-time check is skipped when reloading them.
+
+  void pin_library (const std::string& file_name);
+
+  bool unpin_library (const std::string& file_name);
+
+  bool is_pinned (const std::string& file_name) const
+  { return m_pinned_libs.find (file_name) != m_pinned_libs.end (); }
+
+  std::list<std::string> pinned_libraries () const;
+
 private:
 
   void clear_function (const std::string& fcn_name);
@@ -111,6 +125,9 @@ private:
 
   shlibs_list m_loaded_shlibs;
 
+  // Libraries held open by pin_library, keyed by file name.
+  std::map<std::string, dynamic_library> m_pinned_libs;
+
   bool m_doing_load;
 
   static std::string name_mangler (const std::string& name);
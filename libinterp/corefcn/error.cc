@@ -64,6 +64,11 @@ format_message (const char *fmt, va_list args)
   if (! fmt)
     return "";
 
+  // A format without conversions is its own result; skip the
+  // formatting machinery, which costs real time in catch-heavy code.
+  if (! strchr (fmt, '%'))
+    return fmt;
+
   std::ostringstream output_buf;
 
   octave::vformat (output_buf, fmt, args);
@@ -269,7 +274,8 @@ error_system::error_system (interpreter& interp)
     m_last_warning_message (),
     m_last_warning_id (),
     m_last_error_id (),
-    m_last_error_stack (init_error_stack (interp))
+    m_last_error_stack (init_error_stack (interp)),
+    m_pending_error_stack ()
 {
   initialize_default_warning_state ();
 }
@@ -866,22 +872,21 @@ void error_system::throw_error (const std::string& err_type,
                                 const std::string& message,
                                 const std::list<frame_info>& stack_info_arg)
 {
-  std::list<frame_info> stack_info = stack_info_arg;
+  execution_exception ex (err_type, id, message, stack_info_arg);
 
-  if (stack_info.empty ())
+  if (stack_info_arg.empty ())
     {
-      tree_evaluator& tw = m_interpreter.get_evaluator ();
+      // Throwing an error must not cost a walk over a possibly very
+      // deep stack; attach an O(1) snapshot instead and let the frame
+      // list be built if and when somebody inspects it.  The snapshot
+      // also applies the duplicate-frame filtering the eager walk
+      // used to do.
 
-      stack_info = tw.backtrace_info ();
-
-      // Print the error message only if it is different from the
-      // previous one; makes the output more concise and readable.
+      tree_evaluator& tw = m_interpreter.get_evaluator ();
 
-      stack_info.unique ();
+      ex.set_stack_info_provider (tw.backtrace_info_snapshot ());
     }
 
-  execution_exception ex (err_type, id, message, stack_info);
-
   throw_error (ex);
 }
 
@@ -898,7 +903,22 @@ void error_system::save_exception (const execution_exception& ee)
     = (message.size () > 0 && message.back () == '\n'
        ? message.substr (0, message.size () - 1) : message);
   last_error_message (xmsg);
-  last_error_stack (make_stack_map (ee.stack_info ()));
+
+  // Defer building the stack struct array until somebody asks for it;
+  // an error swallowed by a bare catch never does.  Copying the
+  // exception also carries along a still-deferred stack snapshot, at
+  // the price of keeping the snapshotted frames alive until the next
+  // error or until lasterror is read.
+  m_pending_error_stack = [ee] () { return ee.stack_info (); };
+}
+
+void error_system::materialize_error_stack () const
+{
+  if (m_pending_error_stack)
+    {
+      m_last_error_stack = make_stack_map (m_pending_error_stack ());
+      m_pending_error_stack = nullptr;
+    }
 }
 
 void error_system::display_exception (const execution_exception& ee) const
@@ -2011,6 +2031,18 @@ fields are set to their default values.
 %! lasterror (x);
 %! y = lasterror ();
 %! assert (y, x);
+
+## The stack map is built lazily after a caught error; make sure it is
+## still available on demand.
+%!test
+%! try
+%!   error ("Octave:test-lazy-stack", "oops");
+%! catch
+%! end_try_catch
+%! le = lasterror ();
+%! assert (le.identifier, "Octave:test-lazy-stack");
+%! assert (le.message, "oops");
+%! assert (isfield (le, "stack"));
 */
 
 DEFMETHOD (lasterr, interp, args, nargout,
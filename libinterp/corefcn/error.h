@@ -30,6 +30,8 @@
 
 #include <cstdarg>
 #include <cinttypes>
+#include <functional>
+#include <list>
 #include <string>
 
 #include "unwind-prot.h"
@@ -244,13 +246,21 @@ public:
 
   void set_last_error_stack (const octave_map& val)
   {
+    m_pending_error_stack = nullptr;
     m_last_error_stack = val;
   }
 
-  octave_map last_error_stack () const { return m_last_error_stack; }
+  octave_map last_error_stack () const
+  {
+    materialize_error_stack ();
+
+    return m_last_error_stack;
+  }
 
   octave_map last_error_stack (const octave_map& new_val)
   {
+    materialize_error_stack ();
+
     octave_map val = m_last_error_stack;
     m_last_error_stack = new_val;
     return val;
@@ -389,8 +399,17 @@ private:
   //! The last error message id.
   std::string m_last_error_id;
 
-  //! The last file in which an error occurred.
-  octave_map m_last_error_stack;
+  //! The last file in which an error occurred.  Mutable because the
+  //! map is built on demand from m_pending_error_stack.
+  mutable octave_map m_last_error_stack;
+
+  //! Deferred construction of the last error stack map.  Saving an
+  //! exception only stores the captured frame list; the expensive
+  //! struct array is built the first time someone asks for it, so
+  //! errors swallowed by a bare catch never pay for it.
+  mutable std::function<std::list<frame_info> ()> m_pending_error_stack;
+
+  OCTINTERP_API void materialize_error_stack () const;
 };
 
 OCTAVE_END_NAMESPACE(octave)
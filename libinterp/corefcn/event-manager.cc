@@ -113,11 +113,40 @@ void event_manager::process_events (bool disable_flag)
       if (disable_flag)
         disable ();
 
+      // Drain the whole queue in a single lock acquisition and run
+      // the events without holding the lock, so that a burst of
+      // events (rapid output updates, for example) costs one mutex
+      // round-trip instead of one per event and posting threads are
+      // never blocked behind event execution.
+
       m_event_queue_mutex->lock ();
       std::shared_ptr<event_queue> evq = m_gui_event_queue.top ();
+      std::deque<event_queue::elem *> pending = evq->take_all ();
       m_event_queue_mutex->unlock ();
 
-      evq->run ();
+      while (! pending.empty ())
+        {
+          // No leak on exception!
+          std::unique_ptr<event_queue::elem> ptr (pending.front ());
+          pending.pop_front ();
+
+          try
+            {
+              ptr->run ();
+            }
+          catch (...)
+            {
+              // Put the events we did not get to back so they run on
+              // the next call, ahead of anything posted meanwhile,
+              // just as if they had never been drained.
+
+              m_event_queue_mutex->lock ();
+              evq->putback (pending);
+              m_event_queue_mutex->unlock ();
+
+              throw;
+            }
+        }
     }
 }
 
@@ -126,10 +155,16 @@ void event_manager::discard_events ()
   if (enabled ())
     {
       m_event_queue_mutex->lock ();
-      std::shared_ptr<event_queue> evq = m_gui_event_queue.top ();
+      std::deque<event_queue::elem *> pending
+        = m_gui_event_queue.top ()->take_all ();
+      m_coalesced_tags.clear ();
       m_event_queue_mutex->unlock ();
 
-      evq->discard ();
+      while (! pending.empty ())
+        {
+          delete pending.front ();
+          pending.pop_front ();
+        }
     }
 }
 
@@ -158,8 +193,10 @@ void event_manager::post_event (const fcn_callback& fcn)
 {
   if (enabled ())
     {
+      m_event_queue_mutex->lock ();
       std::shared_ptr<event_queue> evq = m_gui_event_queue.top ();
       evq->add (fcn);
+      m_event_queue_mutex->unlock ();
     }
 }
 
@@ -167,11 +204,53 @@ void event_manager::post_event (const meth_callback& meth)
 {
   if (enabled ())
     {
+      m_event_queue_mutex->lock ();
       std::shared_ptr<event_queue> evq = m_gui_event_queue.top ();
       evq->add (std::bind (meth, std::ref (m_interpreter)));
+      m_event_queue_mutex->unlock ();
+    }
+}
+
+void event_manager::post_event (const std::string& tag,
+                                const fcn_callback& fcn)
+{
+  if (enabled ())
+    {
+      m_event_queue_mutex->lock ();
+
+      // Coalesce: if an event with this tag is already waiting, the
+      // new one is redundant (callbacks for tagged events must read
+      // the state they report when they run, not when they are
+      // posted).  Rapid bursts of identical update requests then
+      // collapse into a single queued event.
+
+      if (m_coalesced_tags.find (tag) == m_coalesced_tags.end ())
+        {
+          m_coalesced_tags.insert (tag);
+
+          std::shared_ptr<event_queue> evq = m_gui_event_queue.top ();
+
+          evq->add ([this, tag, fcn] ()
+                    {
+                      m_event_queue_mutex->lock ();
+                      m_coalesced_tags.erase (tag);
+                      m_event_queue_mutex->unlock ();
+
+                      fcn ();
+                    });
+        }
+
+      m_event_queue_mutex->unlock ();
     }
 }
 
+void event_manager::post_event (const std::string& tag,
+                                const meth_callback& meth)
+{
+  post_event (tag, fcn_callback (std::bind (meth,
+                                            std::ref (m_interpreter))));
+}
+
 void event_manager::set_workspace ()
 {
   if (enabled ())
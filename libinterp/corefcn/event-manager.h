@@ -31,6 +31,7 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <set>
 #include <stack>
 #include <string>
 
@@ -352,6 +353,17 @@ public:
   OCTINTERP_API void post_event (const fcn_callback& fcn);
   OCTINTERP_API void post_event (const meth_callback& meth);
 
+  // Tagged variants that coalesce redundant events: while an event
+  // posted with TAG is waiting to run, further posts with the same
+  // tag are dropped.  Use these for idempotent update notifications
+  // (workspace or directory refreshes, for example) whose callbacks
+  // gather the reported state when they execute.
+
+  OCTINTERP_API void post_event (const std::string& tag,
+                                 const fcn_callback& fcn);
+  OCTINTERP_API void post_event (const std::string& tag,
+                                 const meth_callback& meth);
+
   // The following functions correspond to the virtual fuunctions in
   // the interpreter_events class.  They provide a way for the
   // interpreter to notify the GUI that some event has occurred
@@ -773,6 +785,11 @@ protected:
 
   std::stack<std::shared_ptr <event_queue>> m_gui_event_queue;
 
+  // Tags of coalesced events currently waiting to run, protected by
+  // m_event_queue_mutex.
+
+  std::set<std::string> m_coalesced_tags;
+
   bool m_debugging;
   bool m_link_enabled;
 
@@ -28,8 +28,9 @@
 
 #include "octave-config.h"
 
-#include <queue>
+#include <deque>
 #include <memory>
+#include <utility>
 
 #include "action-container.h"
 
@@ -55,7 +56,7 @@ public:
       {
         // No leak on exception!
         std::unique_ptr<elem> ptr (m_fifo.front ());
-        m_fifo.pop ();
+        m_fifo.pop_front ();
         ptr->run ();
       }
   }
@@ -65,23 +66,49 @@ public:
     if (! empty ())
       {
         elem *ptr = m_fifo.front ();
-        m_fifo.pop ();
+        m_fifo.pop_front ();
         delete ptr;
       }
   }
 
   std::size_t size () const { return m_fifo.size (); }
 
+  // Transfer all queued actions to the caller, leaving the queue
+  // empty.  With external locking this lets a consumer drain the
+  // queue in a single lock acquisition instead of one round-trip per
+  // event; the caller owns the returned elements and must run or
+  // delete them (or return them with putback).
+
+  std::deque<elem *> take_all ()
+  {
+    std::deque<elem *> result;
+
+    std::swap (result, m_fifo);
+
+    return result;
+  }
+
+  // Return actions obtained from take_all that could not be run,
+  // placing them ahead of anything queued in the meantime so the
+  // original execution order is preserved.
+
+  void putback (std::deque<elem *>& items)
+  {
+    m_fifo.insert (m_fifo.begin (), items.begin (), items.end ());
+
+    items.clear ();
+  }
+
 protected:
 
   void add_action (elem *new_elem)
   {
-    m_fifo.push (new_elem);
+    m_fifo.push_back (new_elem);
   }
 
   //--------
 
-  std::queue<elem *> m_fifo;
+  std::deque<elem *> m_fifo;
 };
 
 // Like event_queue, but this one will guard against the
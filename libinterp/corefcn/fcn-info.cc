@@ -33,6 +33,7 @@
 
 #include "defun.h"
 #include "fcn-info.h"
+#include "interp-stats.h"
 #include "interpreter-private.h"
 #include "interpreter.h"
 #include "load-path.h"
@@ -350,6 +351,8 @@ octave_value
 fcn_info::fcn_info_rep::find (const symbol_scope& scope,
                               const octave_value_list& args)
 {
+  interp_stats::count_fcn_lookup ();
+
   symbol_scope search_scope
     = (scope
        ? scope : __get_current_scope__ ());
@@ -466,10 +469,10 @@ load_out_of_date_fcn (const std::string& file_name,
   return retval;
 }
 
-static bool
+bool
 out_of_date_check (octave_value& function,
-                   const std::string& dispatch_type = "",
-                   bool check_relative = true)
+                   const std::string& dispatch_type,
+                   bool check_relative)
 {
   bool retval = false;
 
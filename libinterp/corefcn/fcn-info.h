@@ -352,6 +352,14 @@ private:
   std::shared_ptr<fcn_info_rep> m_rep;
 };
 
+// If FUNCTION is out of date with respect to the file it was loaded
+// from, reload it in place.  Return true if a reload happened.
+
+extern OCTINTERP_API bool
+out_of_date_check (octave_value& function,
+                   const std::string& dispatch_type = "",
+                   bool check_relative = true);
+
 extern OCTINTERP_API std::string
 get_dispatch_type (const octave_value_list& args);
 
@@ -35,6 +35,9 @@
 #  include "config.h"
 #endif
 
+#include <algorithm>
+
+#include "oct-parallel.h"
 #include "quit.h"
 
 #include "defun.h"
@@ -118,12 +121,23 @@ filter (MArray<T>& b, MArray<T>& a, MArray<T>& x, MArray<T>& si,
   // For deconv and fftfilt, x_num seems to always be 1.
   // For directly calling filter, it can be more than 1.
 
-  for (octave_idx_type num = 0; num < x_num; num++)
+  T *py = y.fortran_vec ();
+  T *psi_vec = si.fortran_vec ();
+  const T *pa = a.data ();
+  const T *pb = b.data ();
+  const T *px = x.data ();
+
+  // Each slice (column, for DIM == 1) carries its own state vector and
+  // writes a disjoint part of the output, so slices are independent of
+  // each other.  CHECK_INTERRUPT is false when a slice runs on a worker
+  // thread, where octave_quit must not be called.
+
+  auto filter_slice = [=] (octave_idx_type num, bool check_interrupt)
     {
       octave_idx_type x_offset = (x_stride == 1) ? num * x_len
                                  : num + (num / x_stride) * x_stride * (x_len - 1);
 
-      octave_idx_type si_offset = num * si_len;
+      T *psi = psi_vec + num * si_len;
 
       // Try to achieve a balance between speed and interruptibility.
       //
@@ -164,16 +178,8 @@ filter (MArray<T>& b, MArray<T>& a, MArray<T>& x, MArray<T>& si,
       // is common to both branches can be pulled out here without affecting
       // correctness or speed.
 
-      T *py = y.fortran_vec ();
-      T *psi = si.fortran_vec ();
-      const T *pb = b.data ();
-      const T *px = x.data ();
-      psi += si_offset;
-
       if (a_len > 1)
         {
-          const T *pa = a.data ();
-
           // Usually the last element to be written will be si_len-1
           // but if si_len is 0, then we need the 0th element to be written.
           // Pulling this check out of the for-loop makes it run faster.
@@ -196,42 +202,138 @@ filter (MArray<T>& b, MArray<T>& a, MArray<T>& x, MArray<T>& si,
                   for (octave_idx_type j = lo; j <= hi; j++)
                     psi[j] = psi[j+1] - pa[j+1] * py[idx] + pb[j+1] * px[idx];
 
-                  octave_quit();  // Check for interruptions
+                  if (check_interrupt)
+                    octave_quit ();  // Check for interruptions
                 }
 
               psi[iidx] = pb[si_len] * px[idx] - pa[si_len] * py[idx];
             }
         }
+      else if (x_stride == 1)
+        {
+          // FIR fast path (a_len <= 1 ==> si_len MUST be > 0).  With no
+          // denominator there is no recurrence, so instead of dragging
+          // the state vector through memory for every sample we can
+          // evaluate the direct convolution sum, which vectorizes.  The
+          // initial conditions simply add to the first SI_LEN outputs.
+
+          const T *xcol = px + x_offset;
+          T *ycol = py + x_offset;
+
+          octave_idx_type lead = std::min (si_len, x_len);
+
+          for (octave_idx_type i = 0; i < lead; i++)
+            {
+              T acc = psi[i];
+
+              for (octave_idx_type k = 0; k <= i; k++)
+                acc += pb[k] * xcol[i-k];
+
+              ycol[i] = acc;
+            }
+
+          for (octave_idx_type i = lead; i < x_len; i++)
+            {
+              T acc = T ();
+
+              for (octave_idx_type k = 0; k <= si_len; k++)
+                acc += pb[k] * xcol[i-k];
+
+              ycol[i] = acc;
+            }
+
+          // Final conditions, for continuing the filter: the part of
+          // the convolution tail that extends past the data, plus any
+          // initial conditions not yet consumed when X is shorter than
+          // the state.  Ascending J only reads state entries that have
+          // not been overwritten yet.
+
+          for (octave_idx_type j = 0; j < si_len; j++)
+            {
+              T acc = (j + x_len < si_len) ? psi[j + x_len] : T ();
+
+              octave_idx_type mmax = std::min (si_len - j, x_len);
+
+              for (octave_idx_type m = 1; m <= mmax; m++)
+                acc += pb[j+m] * xcol[x_len - m];
+
+              psi[j] = acc;
+            }
+
+          if (check_interrupt)
+            octave_quit ();
+        }
       else // a_len <= 1 ==> si_len MUST be > 0
         {
-          // This else-block is almost the same as the above if-block,
-          // except for the absence of variable pa.
+          // The same direct convolution sum as above for slices that
+          // are not contiguous in memory (DIM > 1).  The strided loads
+          // are still cheaper than shifting the state vector through
+          // memory for every sample.
 
-          for (octave_idx_type i = 0, idx = x_offset;
-               i < x_len;
-               i++, idx += x_stride)
+          const T *xcol = px + x_offset;
+          T *ycol = py + x_offset;
+
+          octave_idx_type lead = std::min (si_len, x_len);
+
+          for (octave_idx_type i = 0; i < lead; i++)
             {
-              py[idx] = psi[0] + pb[0] * px[idx];
+              T acc = psi[i];
 
-              // Outer and inner loops for interruption management
-              for (octave_idx_type u = 0; u <= num_outer; u++)
-                {
-                  octave_idx_type lo = u * num_inner;
-                  octave_idx_type hi = (lo + num_inner < num_execs-1)
-                                       ? lo + num_inner : num_execs-1;
+              for (octave_idx_type k = 0; k <= i; k++)
+                acc += pb[k] * xcol[(i-k) * x_stride];
 
-                  // Inner loop, no interruption
-                  for (octave_idx_type j = lo; j <= hi; j++)
-                    psi[j] = psi[j+1] + pb[j+1] * px[idx];
+              ycol[i * x_stride] = acc;
+            }
 
-                  octave_quit();  // Check for interruptions
-                }
+          for (octave_idx_type i = lead; i < x_len; i++)
+            {
+              T acc = T ();
+
+              for (octave_idx_type k = 0; k <= si_len; k++)
+                acc += pb[k] * xcol[(i-k) * x_stride];
 
-              psi[si_len-1] = pb[si_len] * px[idx];
+              ycol[i * x_stride] = acc;
             }
+
+          for (octave_idx_type j = 0; j < si_len; j++)
+            {
+              T acc = (j + x_len < si_len) ? psi[j + x_len] : T ();
+
+              octave_idx_type mmax = std::min (si_len - j, x_len);
+
+              for (octave_idx_type m = 1; m <= mmax; m++)
+                acc += pb[j+m] * xcol[(x_len - m) * x_stride];
+
+              psi[j] = acc;
+            }
+
+          if (check_interrupt)
+            octave_quit ();
         }
+    };
+
+#if defined (_OPENMP)
+
+  int nthreads = parallel_num_threads ();
+
+  if (x_num > 1 && nthreads > 1
+      && double (x_num) * x_len * ab_len >= parallel_numel_threshold ()
+      && parallel_numel_threshold () > 0)
+    {
+#     pragma omp parallel for num_threads (nthreads) schedule (static)
+      for (octave_idx_type num = 0; num < x_num; num++)
+        filter_slice (num, false);
+
+      octave_quit ();
+
+      return y;
     }
 
+#endif
+
+  for (octave_idx_type num = 0; num < x_num; num++)
+    filter_slice (num, true);
+
   return y;
 }
 
@@ -613,6 +613,14 @@ b = sparse (i, j, v, sz(1), sz(2));
 %!assert (find ([2 0 1 0 5 0], Inf), [1, 3, 5])
 %!assert (find ([2 0 1 0 5 0], Inf, "last"), [1, 3, 5])
 
+## Large mask, which exercises the parallel two-pass compaction
+%!test
+%! x = mod (1:2e5, 7) == 0;
+%! assert (find (x), 7:7:2e5);
+%! assert (find (x'), (7:7:2e5)');
+%! [i, j] = find (reshape (x, 500, 400));
+%! assert (sub2ind ([500, 400], i, j), (7:7:2e5)');
+
 %!error find ()
 */
 
@@ -52,6 +52,7 @@
 #include <clocale>
 #include <cwchar>
 #include <map>
+#include <tuple>
 #include <utility>
 
 #include "singleton-cleanup.h"
@@ -469,7 +470,8 @@ public:
       m_xoffset (0), m_line_yoffset (0), m_yoffset (0), m_mode (MODE_BBOX),
       m_color (dim_vector (1, 3), 0), m_do_strlist (false), m_strlist (),
       m_line_xoffset (0), m_ymin (0), m_ymax (0), m_deltax (0),
-      m_max_fontsize (0), m_antialias (true)
+      m_max_fontsize (0), m_antialias (true), m_str_cache (),
+      m_str_cache_bytes (0)
   { }
 
   OCTAVE_DISABLE_COPY_MOVE (ft_text_renderer)
@@ -573,6 +575,42 @@ private:
   FT_UInt process_character (FT_ULong code, FT_UInt previous,
                              std::string& sub_font);
 
+  // Key of the shaped-string cache: the string together with every
+  // attribute that affects its rasterization.
+
+  struct str_cache_key
+  {
+    std::string txt;
+    std::string interpreter;
+    std::string font_name;
+    std::string font_weight;
+    std::string font_angle;
+    double font_size;
+    int halign;
+    int rot_mode;
+    uint32_t color;
+    bool antialias;
+
+    bool operator < (const str_cache_key& k) const
+    {
+      return (std::tie (txt, interpreter, font_name, font_weight,
+                        font_angle, font_size, halign, rot_mode, color,
+                        antialias)
+              < std::tie (k.txt, k.interpreter, k.font_name, k.font_weight,
+                          k.font_angle, k.font_size, k.halign, k.rot_mode,
+                          k.color, k.antialias));
+    }
+  };
+
+  // A cached rasterization: the pixels and bounding box of a complete
+  // string, before any alignment-dependent anchor adjustment.
+
+  struct str_cache_entry
+  {
+    uint8NDArray pixels;
+    Matrix bbox;
+  };
+
 public:
 
   void text_to_strlist (const std::string& txt,
@@ -640,6 +678,18 @@ private:
   // Anti-aliasing.
   bool m_antialias;
 
+  // Strings rasterized by previous calls, so that redrawing axes with
+  // unchanged labels and ticks reuses the pixels instead of shaping
+  // and rasterizing with FreeType again.
+  std::map<str_cache_key, str_cache_entry> m_str_cache;
+
+  // Total pixel bytes held by m_str_cache.  The cache is dropped once
+  // this exceeds max_str_cache_bytes, which bounds memory use while
+  // keeping the steady-state label set of a redrawn figure cached.
+  std::size_t m_str_cache_bytes;
+
+  static constexpr std::size_t max_str_cache_bytes = 16 * 1024 * 1024;
+
 };
 
 void
@@ -1435,9 +1485,9 @@ Matrix
 ft_text_renderer::get_extent (const std::string& txt, double rotation,
                               const caseless_str& interpreter)
 {
-  text_element *elt = text_parser::parse (txt, interpreter);
-  Matrix extent = get_extent (elt, rotation);
-  delete elt;
+  std::shared_ptr<text_element> elt
+    = text_parser::parse_cached (txt, interpreter);
+  Matrix extent = get_extent (elt.get (), rotation);
 
   return extent;
 }
@@ -1453,9 +1503,52 @@ ft_text_renderer::text_to_pixels (const std::string& txt,
 
   m_halign = _halign;
 
-  text_element *elt = text_parser::parse (txt, interpreter);
-  pxls = render (elt, box, rot_mode);
-  delete elt;
+  // Building the string list records each sub-string as a side effect,
+  // so only plain rendering requests go through the cache.  The cached
+  // bbox predates the anchor adjustment, which depends on the vertical
+  // alignment and is reapplied on every hit.
+
+  str_cache_key key { txt, interpreter, m_font.get_name (),
+                      m_font.get_weight (), m_font.get_angle (),
+                      m_font.get_size (), _halign, rot_mode,
+                      ((static_cast<uint32_t> (m_color(0).value ()) << 16)
+                       | (static_cast<uint32_t> (m_color(1).value ()) << 8)
+                       | static_cast<uint32_t> (m_color(2).value ())),
+                      m_antialias };
+
+  if (! m_do_strlist)
+    {
+      auto it = m_str_cache.find (key);
+
+      if (it != m_str_cache.end ())
+        {
+          pxls = it->second.pixels;
+          box = it->second.bbox;
+
+          if (pxls.isempty ())
+            return;
+
+          fix_bbox_anchor (box, m_halign, valign, rot_mode,
+                           handle_rotation);
+          return;
+        }
+    }
+
+  std::shared_ptr<text_element> elt
+    = text_parser::parse_cached (txt, interpreter);
+  pxls = render (elt.get (), box, rot_mode);
+
+  if (! m_do_strlist)
+    {
+      if (m_str_cache_bytes > max_str_cache_bytes)
+        {
+          m_str_cache.clear ();
+          m_str_cache_bytes = 0;
+        }
+
+      m_str_cache[key] = { pxls, box };
+      m_str_cache_bytes += pxls.numel ();
+    }
 
   if (pxls.isempty ())
     return;  // nothing to render
@@ -229,7 +229,8 @@ gh_manager::gh_manager (octave::interpreter& interp)
   : m_interpreter (interp), m_handle_map (), m_handle_free_list (),
     m_next_handle (-1.0 - (rand () + 1.0) / (RAND_MAX + 2.0)),
     m_figure_list (), m_graphics_lock (),  m_event_queue (),
-    m_callback_objects (), m_event_processing (0)
+    m_callback_objects (), m_event_processing (0), m_batch_depth (0),
+    m_pending_toolkit_updates (), m_pending_limit_updates ()
 {
   m_handle_map[0] = graphics_object (new root_figure ());
 
@@ -702,4 +703,75 @@ gh_manager::enable_event_processing (bool enable)
     }
 }
 
+void
+gh_manager::begin_batch ()
+{
+  octave::autolock guard (m_graphics_lock);
+
+  m_batch_depth++;
+}
+
+void
+gh_manager::end_batch ()
+{
+  std::set<std::pair<graphics_handle, std::string>> limit_updates;
+  std::set<std::pair<graphics_handle, int>> toolkit_updates;
+
+  {
+    octave::autolock guard (m_graphics_lock);
+
+    if (m_batch_depth == 0)
+      error ("gh_manager::end_batch: no batch in progress");
+
+    if (--m_batch_depth > 0)
+      return;
+
+    limit_updates.swap (m_pending_limit_updates);
+    toolkit_updates.swap (m_pending_toolkit_updates);
+  }
+
+  // Recompute limits first so the toolkit notifications below see the
+  // final state.  Batching is off again, so any properties set while
+  // recomputing notify normally.
+
+  for (const auto& lu : limit_updates)
+    {
+      graphics_object go = get_object (lu.first);
+
+      if (go)
+        go.update_axis_limits (lu.second);
+    }
+
+  for (const auto& tu : toolkit_updates)
+    {
+      graphics_object go = get_object (tu.first);
+
+      if (go)
+        go.update (tu.second);
+    }
+}
+
+bool
+gh_manager::defer_toolkit_update (const graphics_handle& h, int id)
+{
+  if (m_batch_depth == 0)
+    return false;
+
+  m_pending_toolkit_updates.emplace (h, id);
+
+  return true;
+}
+
+bool
+gh_manager::defer_axis_limits_update (const graphics_handle& h,
+                                      const std::string& axis_type)
+{
+  if (m_batch_depth == 0)
+    return false;
+
+  m_pending_limit_updates.emplace (h, axis_type);
+
+  return true;
+}
+
 OCTAVE_END_NAMESPACE(octave)
@@ -186,6 +186,30 @@ public:
 
   OCTINTERP_API void enable_event_processing (bool enable = true);
 
+  // Batched property updates.  Between begin_batch and the matching
+  // end_batch, toolkit property notifications and axis limit
+  // recomputations are coalesced and replayed once, so that setting
+  // many properties on a complex figure does not trigger a cascade of
+  // redundant updates after every individual set.  Batches nest; only
+  // the outermost end_batch replays.  Use an unwind_action to pair the
+  // calls when the batched code may throw.
+
+  OCTINTERP_API void begin_batch ();
+
+  OCTINTERP_API void end_batch ();
+
+  bool is_batching () const { return m_batch_depth > 0; }
+
+  // Return true if the update was recorded for replay because a batch
+  // is in progress, false if the caller should perform it now.
+
+  OCTINTERP_API bool
+  defer_toolkit_update (const graphics_handle& h, int id);
+
+  OCTINTERP_API bool
+  defer_axis_limits_update (const graphics_handle& h,
+                            const std::string& axis_type);
+
   bool is_handle_visible (const graphics_handle& h) const
   {
     bool retval = false;
@@ -277,6 +301,18 @@ private:
   // A flag telling whether event processing must be constantly on.
   int m_event_processing;
 
+  // Nesting depth of property update batches.
+  int m_batch_depth;
+
+  // Toolkit notifications coalesced during a batch, as unique
+  // (object handle, property id) pairs.
+  std::set<std::pair<graphics_handle, int>> m_pending_toolkit_updates;
+
+  // Axis limit recomputations coalesced during a batch, as unique
+  // (object handle, axis type) pairs.  Replayed as full recomputations
+  // over all children, which subsume the skipped incremental updates.
+  std::set<std::pair<graphics_handle, std::string>> m_pending_limit_updates;
+
   // Cache of already parsed latex strings. Store a separate list of keys
   // to allow for erasing oldest entries if cache size becomes too large.
   std::unordered_map<std::string, latex_data> m_latex_cache;
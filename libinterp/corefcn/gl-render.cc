@@ -27,6 +27,7 @@
 #  include "config.h"
 #endif
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -95,6 +96,141 @@ enum
 #  define CALLBACK
 #endif
 
+// Repack DATA into a power-of-two padded buffer and upload it to the
+// currently bound 2-D texture, either defining the texture image or,
+// when subimage is true, overwriting the existing storage in place.
+// The latter avoids a texture reallocation when streaming new frames
+// of identical geometry into an image object.  Returns false for
+// unsupported data types.
+
+static bool
+upload_texture_data (opengl_functions& glfcns, const octave_value& data,
+                     int h, int w, int tw, int th, bool subimage)
+{
+  dim_vector dv (data.dims ());
+
+  if (data.is_double_type ())
+    {
+      const NDArray xdata = data.array_value ();
+
+      OCTAVE_LOCAL_BUFFER (GLfloat, a, (3*tw*th));
+
+      for (int i = 0; i < h; i++)
+        {
+          for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
+            {
+              a[idx]   = xdata(i, j, 0);
+              a[idx+1] = xdata(i, j, 1);
+              a[idx+2] = xdata(i, j, 2);
+            }
+        }
+
+      if (subimage)
+        glfcns.glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, tw, th, GL_RGB,
+                                GL_FLOAT, a);
+      else
+        glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0, GL_RGB,
+                             GL_FLOAT, a);
+    }
+  else if (data.is_single_type ())
+    {
+      const FloatNDArray xdata = data.float_array_value ();
+
+      OCTAVE_LOCAL_BUFFER (GLfloat, a, (3*tw*th));
+
+      for (int i = 0; i < h; i++)
+        {
+          for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
+            {
+              a[idx]   = xdata(i, j, 0);
+              a[idx+1] = xdata(i, j, 1);
+              a[idx+2] = xdata(i, j, 2);
+            }
+        }
+
+      if (subimage)
+        glfcns.glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, tw, th, GL_RGB,
+                                GL_FLOAT, a);
+      else
+        glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0, GL_RGB,
+                             GL_FLOAT, a);
+    }
+  else if (data.is_uint16_type ())
+    {
+      const uint16NDArray xdata = data.uint16_array_value ();
+
+      OCTAVE_LOCAL_BUFFER (GLushort, a, (3*tw*th));
+
+      for (int i = 0; i < h; i++)
+        {
+          for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
+            {
+              a[idx]   = xdata(i, j, 0);
+              a[idx+1] = xdata(i, j, 1);
+              a[idx+2] = xdata(i, j, 2);
+            }
+        }
+
+      if (subimage)
+        glfcns.glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, tw, th, GL_RGB,
+                                GL_UNSIGNED_SHORT, a);
+      else
+        glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0, GL_RGB,
+                             GL_UNSIGNED_SHORT, a);
+    }
+  else if (data.is_uint8_type () && dv(2) == 3)
+    {
+      const uint8NDArray xdata = data.uint8_array_value ();
+
+      OCTAVE_LOCAL_BUFFER (GLubyte, a, (3*tw*th));
+
+      for (int i = 0; i < h; i++)
+        {
+          for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
+            {
+              a[idx]   = xdata(i, j, 0);
+              a[idx+1] = xdata(i, j, 1);
+              a[idx+2] = xdata(i, j, 2);
+            }
+        }
+
+      if (subimage)
+        glfcns.glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, tw, th, GL_RGB,
+                                GL_UNSIGNED_BYTE, a);
+      else
+        glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0, GL_RGB,
+                             GL_UNSIGNED_BYTE, a);
+    }
+  else if (data.is_uint8_type () && dv(2) == 4)
+    {
+      const uint8NDArray xdata = data.uint8_array_value ();
+
+      OCTAVE_LOCAL_BUFFER (GLubyte, a, (4*tw*th));
+
+      for (int i = 0; i < h; i++)
+        {
+          for (int j = 0, idx = i*tw*4; j < w; j++, idx += 4)
+            {
+              a[idx]   = xdata(i, j, 0);
+              a[idx+1] = xdata(i, j, 1);
+              a[idx+2] = xdata(i, j, 2);
+              a[idx+3] = xdata(i, j, 3);
+            }
+        }
+
+      if (subimage)
+        glfcns.glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, tw, th, GL_RGBA,
+                                GL_UNSIGNED_BYTE, a);
+      else
+        glfcns.glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA, tw, th, 0,
+                             GL_RGBA, GL_UNSIGNED_BYTE, a);
+    }
+  else
+    return false;
+
+  return true;
+}
+
 class opengl_texture
 {
 private:
@@ -104,14 +240,15 @@ private:
   public:
 
     texture_rep (opengl_functions& glfcns)
-      : m_glfcns (glfcns), m_id (), m_w (), m_h (), m_tw (), m_th (),
-        m_tx (), m_ty (), m_valid (false)
+      : m_glfcns (glfcns), m_id (), m_w (), m_h (), m_nc (), m_tw (),
+        m_th (), m_tx (), m_ty (), m_valid (false)
     { }
 
     texture_rep (opengl_functions& glfcns, GLuint id, int w, int h,
-                 int tw, int th)
-      : m_glfcns (glfcns), m_id (id), m_w (w), m_h (h), m_tw (tw), m_th (th),
-        m_tx (double(m_w)/m_tw), m_ty (double(m_h)/m_th), m_valid (true)
+                 int nc, int tw, int th)
+      : m_glfcns (glfcns), m_id (id), m_w (w), m_h (h), m_nc (nc),
+        m_tw (tw), m_th (th), m_tx (double(m_w)/m_tw),
+        m_ty (double(m_h)/m_th), m_valid (true)
     { }
 
     OCTAVE_DISABLE_CONSTRUCT_COPY_MOVE (texture_rep)
@@ -122,6 +259,23 @@ private:
         m_glfcns.glDeleteTextures (1, &m_id);
     }
 
+    bool update (const octave_value& data)
+    {
+      dim_vector dv (data.dims ());
+
+      if (! m_valid || dv.ndims () != 3 || dv(0) != m_h || dv(1) != m_w
+          || dv(2) != m_nc)
+        return false;
+
+      m_glfcns.glBindTexture (GL_TEXTURE_2D, m_id);
+
+      if (! upload_texture_data (m_glfcns, data, m_h, m_w, m_tw, m_th,
+                                 true))
+        return false;
+
+      return m_glfcns.glGetError () == GL_NO_ERROR;
+    }
+
     void bind (int mode) const
     {
       if (m_valid)
@@ -136,7 +290,7 @@ private:
 
     opengl_functions& m_glfcns;
     GLuint m_id;
-    int m_w, m_h;
+    int m_w, m_h, m_nc;
     int m_tw, m_th;
     double m_tx, m_ty;
     bool m_valid;
@@ -151,8 +305,8 @@ public:
   { }
 
   opengl_texture (opengl_functions& glfcns, GLuint id, int w, int h,
-                  int tw, int th)
-    : m_rep (new texture_rep (glfcns, id, w, h, tw, th))
+                  int nc, int tw, int th)
+    : m_rep (new texture_rep (glfcns, id, w, h, nc, tw, th))
   { }
 
   OCTAVE_DEFAULT_COPY_DELETE (opengl_texture)
@@ -166,6 +320,12 @@ public:
 
   bool is_valid () const { return m_rep->m_valid; }
 
+  // Overwrite the texture storage in place with DATA, which must have
+  // the same geometry as the data the texture was created from.
+  // Returns false if the geometry differs or the upload fails, in
+  // which case the caller should create a new texture.
+  bool update (const octave_value& data) { return m_rep->update (data); }
+
 private:
 
   opengl_texture (const std::shared_ptr<texture_rep>& new_rep)
@@ -209,7 +369,6 @@ opengl_texture::create (opengl_functions& glfcns, const octave_value& data)
         }
 
       GLuint id;
-      bool ok = true;
 
       tw = next_power_of_2 (w);
       th = next_power_of_2 (h);
@@ -217,108 +376,10 @@ opengl_texture::create (opengl_functions& glfcns, const octave_value& data)
       glfcns.glGenTextures (1, &id);
       glfcns.glBindTexture (GL_TEXTURE_2D, id);
 
-      if (data.is_double_type ())
-        {
-          const NDArray xdata = data.array_value ();
-
-          OCTAVE_LOCAL_BUFFER (GLfloat, a, (3*tw*th));
-
-          for (int i = 0; i < h; i++)
-            {
-              for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
-                {
-                  a[idx]   = xdata(i, j, 0);
-                  a[idx+1] = xdata(i, j, 1);
-                  a[idx+2] = xdata(i, j, 2);
-                }
-            }
-
-          glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0, GL_RGB,
-                               GL_FLOAT, a);
-        }
-
-      else if (data.is_single_type ())
-        {
-          const FloatNDArray xdata = data.float_array_value ();
-
-          OCTAVE_LOCAL_BUFFER (GLfloat, a, (3*tw*th));
-
-          for (int i = 0; i < h; i++)
-            {
-              for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
-                {
-                  a[idx]   = xdata(i, j, 0);
-                  a[idx+1] = xdata(i, j, 1);
-                  a[idx+2] = xdata(i, j, 2);
-                }
-            }
-
-          glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0, GL_RGB,
-                               GL_FLOAT, a);
-        }
-      else if (data.is_uint16_type ())
-        {
-          const uint16NDArray xdata = data.uint16_array_value ();
-
-          OCTAVE_LOCAL_BUFFER (GLushort, a, (3*tw*th));
-
-          for (int i = 0; i < h; i++)
-            {
-              for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
-                {
-                  a[idx]   = xdata(i, j, 0);
-                  a[idx+1] = xdata(i, j, 1);
-                  a[idx+2] = xdata(i, j, 2);
-                }
-            }
-
-          glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0,
-                               GL_RGB, GL_UNSIGNED_SHORT, a);
-        }
-      else if (data.is_uint8_type () && dv(2) == 3)
-        {
-          const uint8NDArray xdata = data.uint8_array_value ();
-
-          OCTAVE_LOCAL_BUFFER (GLubyte, a, (3*tw*th));
-
-          for (int i = 0; i < h; i++)
-            {
-              for (int j = 0, idx = i*tw*3; j < w; j++, idx += 3)
-                {
-                  a[idx]   = xdata(i, j, 0);
-                  a[idx+1] = xdata(i, j, 1);
-                  a[idx+2] = xdata(i, j, 2);
-                }
-            }
-
-          glfcns.glTexImage2D (GL_TEXTURE_2D, 0, 3, tw, th, 0,
-                               GL_RGB, GL_UNSIGNED_BYTE, a);
-        }
-      else if (data.is_uint8_type () && dv(2) == 4)
-        {
-          const uint8NDArray xdata = data.uint8_array_value ();
-
-          OCTAVE_LOCAL_BUFFER (GLubyte, a, (4*tw*th));
+      bool ok = upload_texture_data (glfcns, data, h, w, tw, th, false);
 
-          for (int i = 0; i < h; i++)
-            {
-              for (int j = 0, idx = i*tw*4; j < w; j++, idx += 4)
-                {
-                  a[idx]   = xdata(i, j, 0);
-                  a[idx+1] = xdata(i, j, 1);
-                  a[idx+2] = xdata(i, j, 2);
-                  a[idx+3] = xdata(i, j, 3);
-                }
-            }
-
-          glfcns.glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA, tw, th, 0,
-                               GL_RGBA, GL_UNSIGNED_BYTE, a);
-        }
-      else
-        {
-          ok = false;
-          warning ("opengl_texture::create: invalid image data type, expected double, single, uint8, or uint16");
-        }
+      if (! ok)
+        warning ("opengl_texture::create: invalid image data type, expected double, single, uint8, or uint16");
 
       if (ok)
         {
@@ -330,7 +391,7 @@ opengl_texture::create (opengl_functions& glfcns, const octave_value& data)
           if (glfcns.glGetError () != GL_NO_ERROR)
             warning ("opengl_texture::create: OpenGL error while generating texture data");
           else
-            retval = opengl_texture (glfcns, id, w, h, tw, th);
+            retval = opengl_texture (glfcns, id, w, h, dv(2), tw, th);
         }
     }
   else
@@ -689,7 +750,9 @@ opengl_renderer::opengl_renderer (opengl_functions& glfcns)
     m_xZ1 (), m_xZ2 (), m_marker_id (), m_filled_marker_id (),
     m_camera_pos (), m_camera_dir (), m_view_vector (),
     m_interpreter ("none"), m_txt_renderer (), m_current_light (0),
-    m_max_lights (0), m_selecting (false), m_printing (false)
+    m_max_lights (0), m_selecting (false), m_printing (false),
+    m_partial_redraw (false), m_prev_viewport_width (-1.0),
+    m_prev_viewport_height (-1.0), m_prev_devpixratio (0.0)
 {
   // This constructor will fail if we don't have OpenGL or if the data
   // types we assumed in our public interface aren't compatible with the
@@ -775,11 +838,291 @@ opengl_renderer::draw (const graphics_object& go, bool toplevel)
 #endif
 }
 
+// Compute the screen-space rectangle (logical pixels, stored as
+// [x0, y0, x1, y1] with the origin at the top-left corner of the
+// figure) that drawing AX may touch, including its decorations.
+
+static bool
+axes_damage_rect (const axes::properties& props, double fig_width,
+                  double fig_height, Matrix& rect)
+{
+  Matrix ext = props.get_extent (true);
+
+  double x0 = ext(0);
+  double y0 = ext(1);
+  double x1 = ext(0) + ext(2);
+  double y1 = ext(1) + ext(3);
+
+  // Tick labels are drawn outside the extent computed above.  When
+  // the axes is constrained to its outerposition, the layout engine
+  // keeps all decorations inside that box; otherwise fall back to a
+  // generous margin.
+
+  double pad = (props.positionconstraint_is ("outerposition") ? 10 : 100);
+
+  Matrix opos = props.get_outerposition ().matrix_value ();
+
+  if (props.units_is ("normalized"))
+    {
+      opos(0) *= fig_width;
+      opos(1) *= fig_height;
+      opos(2) *= fig_width;
+      opos(3) *= fig_height;
+    }
+  else if (! props.units_is ("pixels"))
+    return false;
+
+  // The outerposition origin is the bottom-left figure corner.
+
+  x0 = std::min (x0, opos(0));
+  y0 = std::min (y0, fig_height - opos(1) - opos(3));
+  x1 = std::max (x1, opos(0) + opos(2));
+  y1 = std::max (y1, fig_height - opos(1));
+
+  rect.resize (1, 4);
+
+  rect(0) = x0 - pad;
+  rect(1) = y0 - pad;
+  rect(2) = x1 + pad;
+  rect(3) = y1 + pad;
+
+  return true;
+}
+
+static bool
+damage_rects_intersect (const Matrix& a, const Matrix& b)
+{
+  if (a.isempty () || b.isempty ())
+    return false;
+
+  return ! (a(2) < b(0) || b(2) < a(0) || a(3) < b(1) || b(3) < a(1));
+}
+
+bool
+opengl_renderer::try_partial_redraw (const figure::properties& props,
+                                     const Matrix& children)
+{
+#if defined (HAVE_OPENGL)
+
+  int len = children.numel ();
+
+  if (len == 0)
+    return false;
+
+  // The preserved frame is only reusable if the scene layout still
+  // matches the one it was drawn with.
+
+  Matrix vp = get_viewport_scaled ();
+
+  if (m_prev_children.size () != static_cast<std::size_t> (len)
+      || m_prev_child_rects.size () != static_cast<std::size_t> (len)
+      || vp(2) != m_prev_viewport_width || vp(3) != m_prev_viewport_height
+      || m_devpixratio != m_prev_devpixratio)
+    return false;
+
+  for (int i = 0; i < len; i++)
+    if (children(i) != m_prev_children[i])
+      return false;
+
+  gh_manager& gh_mgr = __get_gh_manager__ ();
+
+  std::vector<graphics_object> objs (len);
+  std::vector<Matrix> rects (len);
+  std::vector<bool> redraw (len, false);
+
+  int n_axes = 0;
+  int n_redraw = 0;
+
+  for (int i = 0; i < len; i++)
+    {
+      objs[i] = gh_mgr.get_object (children(i));
+
+      if (! objs[i])
+        return false;
+
+      if (objs[i].isa ("axes"))
+        {
+          const axes::properties& ap
+            = dynamic_cast<const axes::properties&>
+              (objs[i].get_properties ());
+
+          if (! axes_damage_rect (ap, vp(2), vp(3), rects[i]))
+            return false;
+
+          n_axes++;
+
+          if (ap.is_modified ())
+            {
+              redraw[i] = true;
+              n_redraw++;
+            }
+        }
+      else if (objs[i].isa ("uimenu") || objs[i].isa ("uicontrol")
+               || objs[i].isa ("uicontextmenu") || objs[i].isa ("uitoolbar")
+               || objs[i].isa ("uipushtool") || objs[i].isa ("uitoggletool")
+               || objs[i].isa ("uitable") || objs[i].isa ("uipanel")
+               || objs[i].isa ("uibuttongroup"))
+        ;  // never drawn by this renderer as figure children
+      else
+        return false;
+    }
+
+  // A figure-only change (for example its color) cannot be told apart
+  // from a plain expose event here, so both take the full path.
+
+  if (n_redraw == 0 || n_redraw == n_axes)
+    return false;
+
+  // Damage region: everything a repainted axes may touch now or
+  // touched in the previous frame.
+
+  Matrix damage;
+
+  auto add_rect = [&damage] (const Matrix& r)
+  {
+    if (r.isempty ())
+      return;
+
+    if (damage.isempty ())
+      damage = r;
+    else
+      {
+        damage(0) = std::min (damage(0), r(0));
+        damage(1) = std::min (damage(1), r(1));
+        damage(2) = std::max (damage(2), r(2));
+        damage(3) = std::max (damage(3), r(3));
+      }
+  };
+
+  for (int i = 0; i < len; i++)
+    if (redraw[i])
+      {
+        add_rect (rects[i]);
+        add_rect (m_prev_child_rects[i]);
+      }
+
+  // Clean axes overlapping the damage region have their pixels
+  // cleared, so they must be repainted as well; that in turn can grow
+  // the region.
+
+  bool grew = true;
+
+  while (grew)
+    {
+      grew = false;
+
+      for (int i = 0; i < len; i++)
+        if (! redraw[i]
+            && (damage_rects_intersect (rects[i], damage)
+                || damage_rects_intersect (m_prev_child_rects[i], damage)))
+          {
+            redraw[i] = true;
+            add_rect (rects[i]);
+            add_rect (m_prev_child_rects[i]);
+            grew = true;
+          }
+    }
+
+  double x0 = std::max (damage(0), 0.0);
+  double y0 = std::max (damage(1), 0.0);
+  double x1 = std::min (damage(2), vp(2));
+  double y1 = std::min (damage(3), vp(3));
+
+  if (x0 >= x1 || y0 >= y1)
+    return true;  // all changes are off-screen
+
+  // Scissor coordinates are device pixels with a bottom-left origin.
+
+  m_glfcns.glEnable (GL_SCISSOR_TEST);
+  m_glfcns.glScissor (static_cast<GLint> (std::floor (x0 * m_devpixratio)),
+                      static_cast<GLint> (std::floor ((vp(3) - y1)
+                                                      * m_devpixratio)),
+                      static_cast<GLsizei> (std::ceil ((x1 - x0)
+                                                       * m_devpixratio)) + 1,
+                      static_cast<GLsizei> (std::ceil ((y1 - y0)
+                                                       * m_devpixratio)) + 1);
+
+  init_gl_context (props.is_graphicssmoothing (), props.get_color_rgb ());
+
+  for (int i = len - 1; i >= 0; i--)
+    if (redraw[i])
+      draw (objs[i], false);
+
+  m_glfcns.glDisable (GL_SCISSOR_TEST);
+
+  return true;
+
+#else
+
+  octave_unused_parameter (props);
+  octave_unused_parameter (children);
+
+  return false;
+
+#endif
+}
+
+void
+opengl_renderer::record_partial_state (const Matrix& children)
+{
+#if defined (HAVE_OPENGL)
+
+  int len = children.numel ();
+
+  gh_manager& gh_mgr = __get_gh_manager__ ();
+
+  Matrix vp = get_viewport_scaled ();
+
+  m_prev_children.resize (len);
+  m_prev_child_rects.assign (len, Matrix ());
+  m_prev_viewport_width = vp(2);
+  m_prev_viewport_height = vp(3);
+  m_prev_devpixratio = m_devpixratio;
+
+  for (int i = 0; i < len; i++)
+    {
+      m_prev_children[i] = children(i);
+
+      graphics_object obj = gh_mgr.get_object (children(i));
+
+      if (obj && obj.isa ("axes"))
+        {
+          axes::properties& ap
+            = dynamic_cast<axes::properties&> (obj.get_properties ());
+
+          axes_damage_rect (ap, vp(2), vp(3), m_prev_child_rects[i]);
+
+          // A child change propagates up to here (see
+          // base_properties::mark_modified), so resetting the axes
+          // flag alone is enough to detect the next modification.
+
+          ap.set_modified (false);
+        }
+    }
+
+#else
+
+  octave_unused_parameter (children);
+
+#endif
+}
+
 void
 opengl_renderer::draw_figure (const figure::properties& props)
 {
   m_printing = props.is___printing__ ();
 
+  Matrix children = props.get_all_children ();
+
+  if (m_partial_redraw && ! m_printing)
+    {
+      if (try_partial_redraw (props, children))
+        {
+          record_partial_state (children);
+          return;
+        }
+    }
+
   // Initialize OpenGL context
   init_gl_context (props.is_graphicssmoothing (), props.get_color_rgb ());
 
@@ -794,7 +1137,10 @@ opengl_renderer::draw_figure (const figure::properties& props)
 
   // Draw children
 
-  draw (props.get_all_children (), false);
+  draw (children, false);
+
+  if (m_partial_redraw && ! m_printing)
+    record_partial_state (children);
 }
 
 void
@@ -2408,57 +2754,214 @@ opengl_renderer::draw_line (const line::properties& props)
       set_linecap ("butt");
       set_linejoin (props.get_linejoin ());
 
-      if (has_z)
+      // Batch the unclipped runs of the polyline into a vertex array
+      // and draw each run with a single call instead of issuing
+      // per-vertex calls, which dominates refresh time for lines with
+      // millions of points.
+
+      int dim = (has_z ? 3 : 2);
+
+      const double *px = x.data ();
+      const double *py = y.data ();
+      const double *pz = (has_z ? z.data () : nullptr);
+      const uint8_t *pclip = clip.data ();
+      int np = n;
+
+      // Level-of-detail decimation: a 2-D line with far more points
+      // than the viewport has pixel columns cannot resolve individual
+      // samples, so reduce each pixel column to its first, minimum,
+      // maximum, and last samples before batching.  For a dense line
+      // this renders the same pixels as drawing every vertex but caps
+      // the vertex count at a few per column.  Lines below the
+      // threshold, 3-D lines, and lines with non-monotonic or
+      // non-finite xdata are drawn exactly.  The renderer rebuilds its
+      // vertex stream on every refresh, so the reduced set tracks axis
+      // limit changes (zoom and pan) automatically.
+
+      std::vector<double> dec_x, dec_y;
+      std::vector<uint8_t> dec_clip;
+
+      Matrix vp = get_viewport_scaled ();
+      int ncols = std::max (1, static_cast<int> (vp(2) * m_devpixratio));
+
+      if (! has_z && n > std::max (1 << 16, 8 * ncols))
         {
-          bool flag = false;
+          bool monotonic = true;
 
-          for (int i = 1; i < n; i++)
+          for (int j = 0; j < n && monotonic; j++)
+            monotonic = (math::isfinite (x(j))
+                         && (j == 0 || x(j) >= x(j-1)));
+
+          double x0 = (props.is_clipping ()
+                       ? std::max (m_xmin, x(0)) : x(0));
+          double x1 = (props.is_clipping ()
+                       ? std::min (m_xmax, x(n-1)) : x(n-1));
+          double colw = (x1 - x0) / ncols;
+
+          if (monotonic && colw > 0)
             {
-              if ((clip[i-1] & clip[i]) == clip_ok)
+              dec_x.reserve (4 * ncols + 16);
+              dec_y.reserve (4 * ncols + 16);
+              dec_clip.reserve (4 * ncols + 16);
+
+              auto emit = [&] (int j)
                 {
-                  if (! flag)
+                  dec_x.push_back (x(j));
+                  dec_y.push_back (y(j));
+                  dec_clip.push_back (clip[j]);
+                };
+
+              int cur_col = -1;
+              int i_first = 0, i_last = 0, i_min = 0, i_max = 0;
+
+              auto flush = [&] ()
+                {
+                  if (cur_col < 0)
+                    return;
+
+                  // Emit the column's extremes in sample order so the
+                  // strip still sweeps through them the way the full
+                  // polyline does.
+                  int idx[4] = { i_first, i_min, i_max, i_last };
+                  std::sort (std::begin (idx), std::end (idx));
+
+                  for (int k = 0; k < 4; k++)
+                    if (k == 0 || idx[k] != idx[k-1])
+                      emit (idx[k]);
+
+                  cur_col = -1;
+                };
+
+              // Samples clipped only in y still shape the column
+              // sweep (the clip planes cut it at the axes boundary
+              // exactly where the full polyline crosses), so they are
+              // aggregated like visible samples.  Only samples outside
+              // the x range or non-finite ones break the stream.
+              auto aggregatable = [] (uint8_t c)
+                {
+                  return (c & 0x43) == 0x40;
+                };
+
+              // First and last sample of the current run of
+              // x-clipped (or NaN) points, or -1 when inside an
+              // aggregatable run.
+              int run_first = -1, run_last = -1;
+
+              auto end_clipped_run = [&] ()
+                {
+                  if (run_first >= 0 && run_last != run_first)
                     {
-                      flag = true;
-                      m_glfcns.glBegin (GL_LINE_STRIP);
-                      m_glfcns.glVertex3d (x(i-1), y(i-1), z(i-1));
+                      // Keep the samples adjacent to the visible runs
+                      // so the segments crossing the axes boundary are
+                      // exact, but break the strip in between so the
+                      // reduced set cannot draw a spurious chord
+                      // across the viewport.
+                      dec_x.push_back (octave_NaN);
+                      dec_y.push_back (octave_NaN);
+                      dec_clip.push_back (0);
+
+                      emit (run_last);
                     }
-                  m_glfcns.glVertex3d (x(i), y(i), z(i));
-                }
-              else if (flag)
+
+                  run_first = -1;
+                };
+
+              for (int j = 0; j < n; j++)
                 {
-                  flag = false;
-                  m_glfcns.glEnd ();
+                  if (! aggregatable (clip[j]))
+                    {
+                      flush ();
+
+                      if (run_first < 0)
+                        {
+                          run_first = j;
+                          emit (j);
+                        }
+
+                      run_last = j;
+                      continue;
+                    }
+
+                  end_clipped_run ();
+
+                  int col = static_cast<int> ((x(j) - x0) / colw);
+                  col = std::min (std::max (col, 0), ncols - 1);
+
+                  if (col != cur_col)
+                    {
+                      flush ();
+
+                      cur_col = col;
+                      i_first = i_min = i_max = j;
+                    }
+                  else
+                    {
+                      if (y(j) < y(i_min))
+                        i_min = j;
+                      if (y(j) > y(i_max))
+                        i_max = j;
+                    }
+
+                  i_last = j;
                 }
-            }
 
-          if (flag)
-            m_glfcns.glEnd ();
+              flush ();
+              end_clipped_run ();
+
+              px = dec_x.data ();
+              py = dec_y.data ();
+              pclip = dec_clip.data ();
+              np = static_cast<int> (dec_x.size ());
+            }
         }
-      else
+
+      std::vector<double> vertex_data;
+      vertex_data.reserve (dim * np);
+
+      // (first vertex, vertex count) of each line strip.
+      std::vector<std::pair<GLint, GLsizei>> strips;
+
+      int i = 1;
+      while (i < np)
         {
-          bool flag = false;
+          if ((pclip[i-1] & pclip[i]) != clip_ok)
+            {
+              i++;
+              continue;
+            }
+
+          GLint first = static_cast<GLint> (vertex_data.size ()) / dim;
+
+          vertex_data.push_back (px[i-1]);
+          vertex_data.push_back (py[i-1]);
+          if (has_z)
+            vertex_data.push_back (pz[i-1]);
+
+          GLsizei count = 1;
 
-          for (int i = 1; i < n; i++)
+          while (i < np && (pclip[i-1] & pclip[i]) == clip_ok)
             {
-              if ((clip[i-1] & clip[i]) == clip_ok)
-                {
-                  if (! flag)
-                    {
-                      flag = true;
-                      m_glfcns.glBegin (GL_LINE_STRIP);
-                      m_glfcns.glVertex2d (x(i-1), y(i-1));
-                    }
-                  m_glfcns.glVertex2d (x(i), y(i));
-                }
-              else if (flag)
-                {
-                  flag = false;
-                  m_glfcns.glEnd ();
-                }
+              vertex_data.push_back (px[i]);
+              vertex_data.push_back (py[i]);
+              if (has_z)
+                vertex_data.push_back (pz[i]);
+
+              count++;
+              i++;
             }
 
-          if (flag)
-            m_glfcns.glEnd ();
+          strips.emplace_back (first, count);
+        }
+
+      if (! strips.empty ())
+        {
+          m_glfcns.glEnableClientState (GL_VERTEX_ARRAY);
+          m_glfcns.glVertexPointer (dim, GL_DOUBLE, 0, vertex_data.data ());
+
+          for (const auto& strip : strips)
+            m_glfcns.glDrawArrays (GL_LINE_STRIP, strip.first, strip.second);
+
+          m_glfcns.glDisableClientState (GL_VERTEX_ARRAY);
         }
 
       set_linewidth (0.5f);
@@ -4058,7 +4561,61 @@ opengl_renderer::draw_image (const image::properties& props)
   Matrix x = props.get_xdata ().matrix_value ();
   Matrix y = props.get_ydata ().matrix_value ();
 
-  draw_texture_image (cdata, x, y);
+  // Drop cached textures whose image object no longer exists.
+
+  gh_manager& gh_mgr = __get_gh_manager__ ();
+
+  for (auto p = m_image_textures.begin (); p != m_image_textures.end (); )
+    {
+      if (gh_mgr.get_object (p->first).valid_object ())
+        p++;
+      else
+        p = m_image_textures.erase (p);
+    }
+
+  dim_vector dv (cdata.dims ());
+
+  if (dv.ndims () != 3 || (dv(2) != 3 && dv(2) != 4))
+    {
+      warning ("opengl_renderer: invalid image size (expected MxNx3 or MxN)");
+      return;
+    }
+
+  // Redrawing an image whose cdata has not changed reuses the cached
+  // texture without any upload; new cdata of identical geometry is
+  // streamed into the existing texture storage in place.  Holding the
+  // cached octave_value keeps the comparison by rep pointer sound.
+
+  const double key = props.get___myhandle__ ().value ();
+
+  auto it = m_image_textures.find (key);
+
+  if (it != m_image_textures.end ()
+      && it->second.cdata.internal_rep () != cdata.internal_rep ())
+    {
+      if (it->second.texture->update (cdata))
+        it->second.cdata = cdata;
+      else
+        {
+          m_image_textures.erase (it);
+          it = m_image_textures.end ();
+        }
+    }
+
+  if (it == m_image_textures.end ())
+    {
+      opengl_texture tex = opengl_texture::create (m_glfcns, cdata);
+
+      if (! tex.is_valid ())
+        return;
+
+      image_texture_entry entry
+        = { cdata, std::make_shared<opengl_texture> (tex) };
+
+      it = m_image_textures.emplace (key, entry).first;
+    }
+
+  draw_texture_quad (*it->second.texture, cdata, x, y, false);
 
 #else
 
@@ -4076,6 +4633,41 @@ void
 opengl_renderer::draw_texture_image (const octave_value cdata, Matrix x,
                                      Matrix y, bool ortho)
 {
+#if defined (HAVE_OPENGL)
+
+  dim_vector dv (cdata.dims ());
+
+  // Expect RGB data
+  if (dv.ndims () == 3 && (dv(2) == 3 || dv(2) == 4))
+    {
+      opengl_texture tex  = opengl_texture::create (m_glfcns, cdata);
+      if (tex.is_valid ())
+        draw_texture_quad (tex, cdata, x, y, ortho);
+    }
+  else
+    warning ("opengl_renderer: invalid image size (expected MxNx3 or MxN)");
+
+#else
+
+  octave_unused_parameter (cdata);
+  octave_unused_parameter (x);
+  octave_unused_parameter (y);
+  octave_unused_parameter (ortho);
+
+  // This shouldn't happen because construction of opengl_renderer
+  // objects is supposed to be impossible if OpenGL is not available.
+
+  panic_impossible ();
+
+#endif
+}
+
+void
+opengl_renderer::draw_texture_quad (const opengl_texture& tex,
+                                    const octave_value& cdata,
+                                    const Matrix& x, const Matrix& y,
+                                    bool ortho)
+{
 #if defined (HAVE_OPENGL)
 
   dim_vector dv (cdata.dims ());
@@ -4097,51 +4689,42 @@ opengl_renderer::draw_texture_image (const octave_value cdata, Matrix x,
   y0 = y(0)-dy/2;
   y1 = y(1)+dy/2;
 
-  // Expect RGB data
-  if (dv.ndims () == 3 && (dv(2) == 3 || dv(2) == 4))
-    {
-      opengl_texture tex  = opengl_texture::create (m_glfcns, cdata);
-      if (tex.is_valid ())
-        {
-          m_glfcns.glColor4d (1.0, 1.0, 1.0, 1.0);
-
-          m_glfcns.glEnable (GL_TEXTURE_2D);
+  m_glfcns.glColor4d (1.0, 1.0, 1.0, 1.0);
 
-          m_glfcns.glBegin (GL_QUADS);
+  m_glfcns.glEnable (GL_TEXTURE_2D);
 
-          tex.tex_coord (0.0, 0.0);
-          if (ortho)
-            m_glfcns.glVertex2d (x0, y0);
-          else
-            m_glfcns.glVertex3d (x0, y0, 0.0);
+  m_glfcns.glBegin (GL_QUADS);
 
-          tex.tex_coord (1.0, 0.0);
-          if (ortho)
-            m_glfcns.glVertex2d (x1, y0);
-          else
-            m_glfcns.glVertex3d (x1, y0, 0.0);
+  tex.tex_coord (0.0, 0.0);
+  if (ortho)
+    m_glfcns.glVertex2d (x0, y0);
+  else
+    m_glfcns.glVertex3d (x0, y0, 0.0);
 
-          tex.tex_coord (1.0, 1.0);
-          if (ortho)
-            m_glfcns.glVertex2d (x1, y1);
-          else
-            m_glfcns.glVertex3d (x1, y1, 0.0);
+  tex.tex_coord (1.0, 0.0);
+  if (ortho)
+    m_glfcns.glVertex2d (x1, y0);
+  else
+    m_glfcns.glVertex3d (x1, y0, 0.0);
 
-          tex.tex_coord (0.0, 1.0);
-          if (ortho)
-            m_glfcns.glVertex2d (x0, y1);
-          else
-            m_glfcns.glVertex3d (x0, y1, 0.0);
+  tex.tex_coord (1.0, 1.0);
+  if (ortho)
+    m_glfcns.glVertex2d (x1, y1);
+  else
+    m_glfcns.glVertex3d (x1, y1, 0.0);
 
-          m_glfcns.glEnd ();
-          m_glfcns.glDisable (GL_TEXTURE_2D);
-        }
-    }
+  tex.tex_coord (0.0, 1.0);
+  if (ortho)
+    m_glfcns.glVertex2d (x0, y1);
   else
-    warning ("opengl_renderer: invalid image size (expected MxNx3 or MxN)");
+    m_glfcns.glVertex3d (x0, y1, 0.0);
+
+  m_glfcns.glEnd ();
+  m_glfcns.glDisable (GL_TEXTURE_2D);
 
 #else
 
+  octave_unused_parameter (tex);
   octave_unused_parameter (cdata);
   octave_unused_parameter (x);
   octave_unused_parameter (y);
@@ -34,6 +34,7 @@
 OCTAVE_BEGIN_NAMESPACE(octave)
 
 class opengl_functions;
+class opengl_texture;
 
 class
 OCTINTERP_API
@@ -58,6 +59,13 @@ public:
 
   virtual void set_viewport (int w, int h);
   virtual void set_device_pixel_ratio (double dpr) { m_devpixratio = dpr; }
+
+  // For toolkits whose canvas preserves the previous frame (see
+  // GLCanvas): when enabled, draw_figure repaints only the axes whose
+  // subtree was modified since the last frame, plus any axes
+  // overlapping the damaged region, inside a scissored clear.
+
+  void enable_partial_redraw (bool flag) { m_partial_redraw = flag; }
   virtual Matrix get_viewport_scaled () const;
   virtual graphics_xform get_transform () const { return m_xform; }
   virtual uint8NDArray get_pixels (int width, int height);
@@ -223,12 +231,28 @@ private:
 
   void draw_axes_children (const axes::properties& props);
 
+  // Attempt a damage-limited repaint of the figure; return false if a
+  // full redraw is required instead.
+
+  bool try_partial_redraw (const figure::properties& props,
+                           const Matrix& children);
+
+  // Record the scene layout of the frame just drawn and reset the
+  // modification flags of the figure children, so that the next frame
+  // can be repainted partially.
+
+  void record_partial_state (const Matrix& children);
+
   void draw_all_lights (const base_properties& props,
                         std::list<graphics_object>& obj_list);
 
   void draw_texture_image (const octave_value cdata,
                            Matrix x, Matrix y, bool ortho = false);
 
+  void draw_texture_quad (const opengl_texture& tex,
+                          const octave_value& cdata,
+                          const Matrix& x, const Matrix& y, bool ortho);
+
   //--------
 
   // The graphics m_toolkit associated with the figure being rendered.
@@ -257,6 +281,29 @@ private:
 
   // Indicate we are drawing for printing purpose
   bool m_printing;
+
+  // Textures of image objects from previous refreshes, keyed by the
+  // object's handle value.  Each entry keeps the cdata array that was
+  // uploaded so an unchanged image redraws without any upload and so
+  // the identity comparison by rep pointer stays sound.
+  struct image_texture_entry
+  {
+    octave_value cdata;
+    std::shared_ptr<opengl_texture> texture;
+  };
+
+  std::map<double, image_texture_entry> m_image_textures;
+
+  // Damage tracking for partial redraws: layout of the scene at the
+  // time of the last frame drawn into a preserved canvas.
+
+  bool m_partial_redraw;
+
+  std::vector<double> m_prev_children;
+  std::vector<Matrix> m_prev_child_rects;
+  double m_prev_viewport_width;
+  double m_prev_viewport_height;
+  double m_prev_devpixratio;
 };
 
 OCTAVE_END_NAMESPACE(octave)
@@ -1260,9 +1260,12 @@ base_property::set (const octave_value& v, bool do_run, bool do_notify_toolkit)
         {
           gh_manager& gh_mgr = octave::__get_gh_manager__ ();
 
-          graphics_object go = gh_mgr.get_object (m_parent);
-          if (go)
-            go.update (m_id);
+          if (! gh_mgr.defer_toolkit_update (m_parent, m_id))
+            {
+              graphics_object go = gh_mgr.get_object (m_parent);
+              if (go)
+                go.update (m_id);
+            }
         }
 
       // run listeners
@@ -3412,7 +3415,7 @@ base_graphics_object::remove_all_listeners ()
 
       try
         {
-          property p = get_properties ().get_property (pm.first);
+          property p = get_properties ().get_property (pm.first.str ());
 
           if (p.ok ())
             p.delete_listener ();
@@ -3482,7 +3485,7 @@ base_graphics_object::values_as_string ()
 
   for (const auto& pm : m)
     {
-      const auto& pname = pm.first;
+      const std::string& pname = pm.first;
       if (pname != "children" && ! go.has_readonly_property (pname))
         {
           property p = get_properties ().get_property (pname);
@@ -3547,7 +3550,7 @@ base_graphics_object::values_as_struct ()
 
   for (const auto& pm : m)
     {
-      const auto& pname = pm.first;
+      const std::string& pname = pm.first;
       if (pname != "children" && ! go.has_readonly_property (pname))
         {
           property p = get_properties ().get_property (pname);
@@ -4941,18 +4944,43 @@ axes::properties::calc_tightbox (const Matrix& init_pos)
   return pos;
 }
 
+static std::set<double> updating_sync_positions;
+
 void
 axes::properties::sync_positions ()
 {
+  // Synchronization requests triggered from inside a running one (the
+  // unit conversions and property listeners below can both lead back
+  // here) are dropped; the outermost call completes with the final
+  // property values anyway.
+
+  if (updating_sync_positions.find (get___myhandle__ ().value ())
+      != updating_sync_positions.end ())
+    return;
+
+  octave::unwind_protect_var<std::set<double>>
+    restore_var (updating_sync_positions);
+
+  updating_sync_positions.insert (get___myhandle__ ().value ());
+
+  // The whole reconciliation below works in normalized units.
+  // Hoisting the conversion here turns the nested set_units round
+  // trips in update_position and update_outerposition into no-ops, so
+  // the position-like properties are converted once per
+  // synchronization instead of once per step, and the transform
+  // (aspect ratios, camera, tick and label layout) is recomputed once
+  // at the end instead of after every step.
+
+  caseless_str old_units = get_units ();
+  set_units ("normalized");
+
   // First part is equivalent to 'update_tightinset ()'
   if (m_positionconstraint.is ("innerposition"))
     update_position ();
   else
     update_outerposition ();
-  caseless_str old_units = get_units ();
-  set_units ("normalized");
+
   Matrix pos = m_position.get ().matrix_value ();
-  Matrix outpos = m_outerposition.get ().matrix_value ();
   Matrix tightpos = calc_tightbox (pos);
   Matrix tinset (1, 4, 1.0);
   tinset(0) = pos(0)-tightpos(0);
@@ -4960,12 +4988,13 @@ axes::properties::sync_positions ()
   tinset(2) = tightpos(0)+tightpos(2)-pos(0)-pos(2);
   tinset(3) = tightpos(1)+tightpos(3)-pos(1)-pos(3);
   m_tightinset = tinset;
-  set_units (old_units);
-  update_transform ();
+
   if (m_positionconstraint.is ("innerposition"))
     update_position ();
   else
     update_outerposition ();
+
+  set_units (old_units);
 }
 
 /*
@@ -8182,6 +8211,11 @@ axes::update_axis_limits (const std::string& axis_type,
       != updating_axis_limits.end ())
     return;
 
+  gh_manager& gh_mgr = octave::__get_gh_manager__ ();
+
+  if (gh_mgr.defer_axis_limits_update (get_handle (), axis_type))
+    return;
+
   Matrix kids = Matrix (1, 1, h.value ());
 
   double min_val = octave::numeric_limits<double>::Inf ();
@@ -8400,6 +8434,11 @@ axes::update_axis_limits (const std::string& axis_type)
           != updating_aspectratios.end ()))
     return;
 
+  gh_manager& gh_mgr = octave::__get_gh_manager__ ();
+
+  if (gh_mgr.defer_axis_limits_update (get_handle (), axis_type))
+    return;
+
   Matrix kids = m_properties.get_all_children ();
 
   double min_val = octave::numeric_limits<double>::Inf ();
@@ -10478,6 +10517,11 @@ hggroup::update_axis_limits (const std::string& axis_type,
   if (updating_hggroup_limits)
     return;
 
+  gh_manager& gh_mgr = octave::__get_gh_manager__ ();
+
+  if (gh_mgr.defer_axis_limits_update (get_handle (), axis_type))
+    return;
+
   Matrix kids = Matrix (1, 1, h.value ());
 
   double min_val = octave::numeric_limits<double>::Inf ();
@@ -10589,6 +10633,11 @@ hggroup::update_axis_limits (const std::string& axis_type)
   if (updating_hggroup_limits)
     return;
 
+  gh_manager& gh_mgr = octave::__get_gh_manager__ ();
+
+  if (gh_mgr.defer_axis_limits_update (get_handle (), axis_type))
+    return;
+
   Matrix kids = m_properties.get_children ();
 
   double min_val = octave::numeric_limits<double>::Inf ();
@@ -50,14 +50,309 @@
 // For BUFSIZ.
 #include <cstdio>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oct-env.h"
+
 // Internal buffer sizes (default and "unbuffered" versions)
 #define STASHED_CHARACTERS 16
 #define BIGBUFSIZE (256 * 1024 + STASHED_CHARACTERS)
 #define SMALLBUFSIZE 1
 
+// Block-parallel gzip compression for the write path, pigz-style.
+// The uncompressed byte stream is cut into fixed-size blocks; worker
+// threads compress each block into a complete, independent gzip
+// member, and members are written to the file in input order.  Every
+// standard decompressor (gzread, gunzip, zcat) concatenates members
+// transparently, so the output is an ordinary gzip file that merely
+// cost a little compression ratio at the block seams.
+//
+// Output ordering needs no dedicated writer thread: the worker that
+// finished block K waits its turn on a condition variable until block
+// K-1 has been written, then writes its member itself.
+
+class gzfilebuf::parallel_deflate
+{
+public:
+
+  parallel_deflate (FILE *f, int nthreads)
+    : m_f (f), m_level (Z_DEFAULT_COMPRESSION),
+      m_strategy (Z_DEFAULT_STRATEGY), m_max_queue (2 * nthreads),
+      m_next_seq (0), m_next_write (0), m_bytes_in (0), m_eof (false),
+      m_error (false)
+  {
+    m_block.reserve (s_block_bytes);
+
+    for (int i = 0; i < nthreads; i++)
+      m_workers.emplace_back (&parallel_deflate::work_loop, this);
+  }
+
+  OCTAVE_DISABLE_CONSTRUCT_COPY_MOVE (parallel_deflate)
+
+  ~parallel_deflate ()
+  {
+    finish ();
+  }
+
+  // Queue N bytes for compression, blocking only when all workers are
+  // busy and the job queue is full.
+
+  bool write (const char *s, std::size_t n)
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    m_bytes_in += n;
+
+    while (n > 0 && ! m_error)
+      {
+        std::size_t take = s_block_bytes - m_block.size ();
+
+        if (take > n)
+          take = n;
+
+        m_block.insert (m_block.end (), s, s + take);
+
+        s += take;
+        n -= take;
+
+        if (m_block.size () == s_block_bytes)
+          submit_block (lock);
+      }
+
+    return ! m_error;
+  }
+
+  // Compression parameters for subsequent blocks.
+
+  void setparams (int level, int strategy)
+  {
+    std::lock_guard<std::mutex> lock (m_mtx);
+
+    m_level = level;
+    m_strategy = strategy;
+  }
+
+  // Uncompressed bytes accepted so far (the write-side analogue of
+  // gztell).
+
+  unsigned long long bytes_in () const { return m_bytes_in; }
+
+  // Flush the final partial block, drain the workers, and close the
+  // FILE.  Safe to call twice.
+
+  bool finish ()
+  {
+    if (! m_f)
+      return ! m_error;
+
+    {
+      std::unique_lock<std::mutex> lock (m_mtx);
+
+      // An empty file still gets one (empty) member so the result is
+      // a valid gzip file.
+      if (! m_block.empty () || m_next_seq == 0)
+        submit_block (lock);
+
+      m_eof = true;
+    }
+
+    m_have_jobs.notify_all ();
+
+    for (auto& w : m_workers)
+      w.join ();
+
+    if (std::fflush (m_f) != 0 || std::fclose (m_f) != 0)
+      m_error = true;
+
+    m_f = nullptr;
+
+    return ! m_error;
+  }
+
+  // Worker count from OCTAVE_COMPRESSION_THREADS, defaulting to the
+  // hardware concurrency (capped); 0 or 1 selects the serial gzwrite
+  // path.
+
+  static int configured_threads ()
+  {
+    static int nthreads = -1;
+
+    if (nthreads < 0)
+      {
+        unsigned int hw = std::thread::hardware_concurrency ();
+
+        nthreads = (hw > 8 ? 8 : (hw > 0 ? static_cast<int> (hw) : 1));
+
+        std::string env_val
+          = octave::sys::env::getenv ("OCTAVE_COMPRESSION_THREADS");
+
+        if (! env_val.empty ())
+          {
+            unsigned long val;
+            if (sscanf (env_val.c_str (), "%lu", &val) == 1)
+              nthreads = (val > 64 ? 64 : (val < 1 ? 1 : static_cast<int> (val)));
+          }
+      }
+
+    return nthreads;
+  }
+
+private:
+
+  static const std::size_t s_block_bytes = 1024 * 1024;
+
+  struct job
+  {
+    unsigned long seq;
+    std::vector<char> data;
+  };
+
+  // Call with m_mtx held.
+
+  void submit_block (std::unique_lock<std::mutex>& lock)
+  {
+    while (m_jobs.size () >= m_max_queue && ! m_error)
+      m_job_taken.wait (lock);
+
+    if (m_error)
+      return;
+
+    m_jobs.push_back (job { m_next_seq++, std::move (m_block) });
+
+    m_block = std::vector<char> ();
+    m_block.reserve (s_block_bytes);
+
+    m_have_jobs.notify_one ();
+  }
+
+  // Compress IN into a complete gzip member.
+
+  static bool compress_block (const std::vector<char>& in,
+                              std::vector<char>& out,
+                              int level, int strategy)
+  {
+    z_stream strm;
+    std::memset (&strm, 0, sizeof (strm));
+
+    // windowBits 15+16 selects the gzip wrapper.
+    if (deflateInit2 (&strm, level, Z_DEFLATED, 15 + 16, 8, strategy)
+        != Z_OK)
+      return false;
+
+    uLong bound = deflateBound (&strm, in.size ());
+
+    out.resize (bound);
+
+    strm.next_in = reinterpret_cast<Bytef *>
+      (const_cast<char *> (in.data ()));
+    strm.avail_in = in.size ();
+    strm.next_out = reinterpret_cast<Bytef *> (out.data ());
+    strm.avail_out = bound;
+
+    int status = deflate (&strm, Z_FINISH);
+
+    out.resize (bound - strm.avail_out);
+
+    deflateEnd (&strm);
+
+    return status == Z_STREAM_END;
+  }
+
+  void work_loop ()
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    while (true)
+      {
+        while (m_jobs.empty () && ! m_eof)
+          m_have_jobs.wait (lock);
+
+        if (m_jobs.empty ())
+          break;
+
+        job j = std::move (m_jobs.front ());
+        m_jobs.pop_front ();
+
+        m_job_taken.notify_all ();
+
+        int level = m_level;
+        int strategy = m_strategy;
+
+        lock.unlock ();
+
+        std::vector<char> out;
+        bool ok = compress_block (j.data, out, level, strategy);
+
+        lock.lock ();
+
+        if (! ok)
+          m_error = true;
+
+        // Wait for our turn in the output order.  The member is
+        // written without the lock; only the turn holder writes, and
+        // the turn does not advance until it finishes.
+        while (! m_error && m_next_write != j.seq)
+          m_my_turn.wait (lock);
+
+        if (! m_error)
+          {
+            lock.unlock ();
+
+            std::size_t wrote = std::fwrite (out.data (), 1, out.size (), m_f);
+
+            lock.lock ();
+
+            if (wrote != out.size ())
+              m_error = true;
+          }
+
+        // Keep the chain moving even on error so nobody deadlocks.
+        m_next_write++;
+
+        m_my_turn.notify_all ();
+        m_job_taken.notify_all ();
+      }
+  }
+
+  FILE *m_f;
+
+  int m_level;
+  int m_strategy;
+
+  std::size_t m_max_queue;
+
+  // Input-order sequence numbers: next block to hand out, next block
+  // due to be written.
+  unsigned long m_next_seq;
+  unsigned long m_next_write;
+
+  unsigned long long m_bytes_in;
+
+  bool m_eof;
+  bool m_error;
+
+  // Uncompressed data accumulating toward the next block.
+  std::vector<char> m_block;
+
+  std::deque<job> m_jobs;
+
+  std::mutex m_mtx;
+
+  std::condition_variable m_have_jobs;
+  std::condition_variable m_job_taken;
+  std::condition_variable m_my_turn;
+
+  std::vector<std::thread> m_workers;
+};
+
 // Default constructor
 gzfilebuf::gzfilebuf ()
-  : m_file(nullptr), m_io_mode(std::ios_base::openmode(0)), m_own_fd(false),
+  : m_file(nullptr), m_pdeflate(nullptr),
+    m_io_mode(std::ios_base::openmode(0)), m_own_fd(false),
     m_buffer(nullptr), m_buffer_size(BIGBUFSIZE), m_own_buffer(true)
 {
   // No buffers to start with
@@ -72,6 +367,9 @@ gzfilebuf::~gzfilebuf ()
   this->sync ();
   if (m_own_fd)
     this->close ();
+  // A parallel engine on an attached stream (not currently possible)
+  // would be cleaned up here.
+  delete m_pdeflate;
   // Make sure internal buffer is deallocated
   this->disable_buffer ();
 }
@@ -80,6 +378,12 @@ gzfilebuf::~gzfilebuf ()
 int
 gzfilebuf::setcompression (int comp_level, int comp_strategy)
 {
+  if (m_pdeflate)
+    {
+      m_pdeflate->setparams (comp_level, comp_strategy);
+      return Z_OK;
+    }
+
   return gzsetparams (m_file, comp_level, comp_strategy);
 }
 
@@ -99,6 +403,26 @@ gzfilebuf::open (const char *name, std::ios_base::openmode mode)
   if (! this->open_mode (mode, char_mode))
     return nullptr;
 
+  // Use block-parallel compression for plain writing when more than
+  // one thread is configured; the serial gzFile path remains for
+  // reading and for single-threaded configurations.
+  if ((mode & std::ios_base::out)
+      && parallel_deflate::configured_threads () > 1)
+    {
+      FILE *f = std::fopen (name,
+                            (mode & std::ios_base::app) ? "ab" : "wb");
+      if (! f)
+        return nullptr;
+
+      m_pdeflate
+        = new parallel_deflate (f, parallel_deflate::configured_threads ());
+
+      this->enable_buffer ();
+      m_io_mode = mode;
+      m_own_fd = true;
+      return this;
+    }
+
   // Attempt to open file
   if ((m_file = gzopen (name, char_mode)) == nullptr)
     return nullptr;
@@ -149,7 +473,14 @@ gzfilebuf::close ()
   // Attempt to sync and close gzipped file
   if (this->sync () == -1)
     retval = nullptr;
-  if (gzclose (m_file) < 0)
+  if (m_pdeflate)
+    {
+      if (! m_pdeflate->finish ())
+        retval = nullptr;
+      delete m_pdeflate;
+      m_pdeflate = nullptr;
+    }
+  else if (gzclose (m_file) < 0)
     retval = nullptr;
   // File is now gone anyway (postcondition [27.8.1.3.8])
   m_file = nullptr;
@@ -221,7 +552,7 @@ gzfilebuf::showmanyc ()
 gzfilebuf::int_type
 gzfilebuf::pbackfail (gzfilebuf::int_type c)
 {
-  if (this->is_open ())
+  if (this->is_open () && ! m_pdeflate)
     {
       if (gzseek (m_file, this->gptr () - this->egptr () - 1, SEEK_CUR) < 0)
         return traits_type::eof ();
@@ -323,8 +654,7 @@ gzfilebuf::overflow (int_type c)
           if (! this->is_open () || ! (m_io_mode & std::ios_base::out))
             return traits_type::eof ();
           // If gzipped file won't accept all bytes written to it, fail
-          if (gzwrite (m_file, this->pbase (), bytes_to_write)
-              != bytes_to_write)
+          if (! this->write_bytes (this->pbase (), bytes_to_write))
             return traits_type::eof ();
           // Reset next pointer to point to pbase on success
           this->pbump (-bytes_to_write);
@@ -339,7 +669,7 @@ gzfilebuf::overflow (int_type c)
       // Impromptu char buffer (allows "unbuffered" output)
       char_type last_char = traits_type::to_char_type (c);
       // If gzipped file won't accept this character, fail
-      if (gzwrite (m_file, &last_char, 1) != 1)
+      if (! this->write_bytes (&last_char, 1))
         return traits_type::eof ();
     }
 
@@ -384,6 +714,16 @@ gzfilebuf::setbuf (char_type *p, std::streamsize n)
   return this;
 }
 
+// Compress and write COUNT bytes, via the parallel engine when active
+bool
+gzfilebuf::write_bytes (const char_type *s, int count)
+{
+  if (m_pdeflate)
+    return m_pdeflate->write (s, count);
+
+  return gzwrite (m_file, s, count) == count;
+}
+
 // Write put area to gzipped file (i.e., ensures that put area is empty)
 int
 gzfilebuf::sync ()
@@ -469,6 +809,16 @@ gzfilebuf::seekoff (off_type off, std::ios_base::seekdir way,
 {
   pos_type ret = pos_type (off_type (-1));
 
+  if (m_pdeflate)
+    {
+      // The parallel write path cannot seek, but tellp still works;
+      // like gztell, it reports the uncompressed position.
+      if (off == 0 && way == std::ios_base::cur)
+        return pos_type (off_type (m_pdeflate->bytes_in ()));
+
+      return ret;
+    }
+
   if (this->is_open ())
     {
       off_type computed_off = off;
@@ -505,6 +855,9 @@ gzfilebuf::seekpos (pos_type sp, std::ios_base::openmode)
 {
   pos_type ret = pos_type (off_type (-1));
 
+  if (m_pdeflate)
+    return ret;
+
   if (this->is_open ())
     {
       ret = pos_type (gzseek (m_file, sp, SEEK_SET));
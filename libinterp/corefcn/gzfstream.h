@@ -83,7 +83,7 @@ public:
    *  @return  True if file is open.
   */
   bool
-  is_open () const { return (m_file != nullptr); }
+  is_open () const { return (m_file != nullptr || m_pdeflate != nullptr); }
 
   /**
    *  @brief  Open gzipped file.
@@ -225,11 +225,30 @@ private:
   void
   disable_buffer ();
 
+  /**
+   *  @brief  Compress and write COUNT bytes from the put area.
+   *
+   *  Dispatches to the parallel engine when one is active, otherwise
+   *  to gzwrite.
+  */
+  bool
+  write_bytes (const char_type *s, int count);
+
   /**
    *  Underlying file pointer.
   */
   gzFile m_file;
 
+  /**
+   *  @brief  Parallel block-compression engine for the write path.
+   *
+   *  Non-null when the file was opened for writing with block-parallel
+   *  gzip compression enabled; m_file stays null in that case.
+  */
+  class parallel_deflate;
+
+  parallel_deflate *m_pdeflate;
+
   /**
    *  Mode in which file was opened.
   */
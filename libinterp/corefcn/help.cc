@@ -38,6 +38,7 @@
 #include <string>
 
 #include "cmd-edit.h"
+#include "file-cache.h"
 #include "file-ops.h"
 #include "file-stat.h"
 #include "lo-sysdep.h"
@@ -699,23 +700,17 @@ help_system::raw_help_from_docstrings_file (const std::string& nm,
       std::streampos beg = txt_limits.first;
       std::streamoff len = txt_limits.second;
 
-      std::ifstream file = sys::ifstream (m_built_in_docstrings_file.c_str (),
-                                          std::ios::in | std::ios::binary);
+      // Every help lookup lands here, so serve the text from the
+      // whole-file cache instead of reopening and seeking each time.
 
-      if (! file)
+      std::string docstrings;
+
+      if (! sys::cached_file_contents (m_built_in_docstrings_file,
+                                       docstrings))
         error ("failed to open docstrings file: %s",
                m_built_in_docstrings_file.c_str ());
 
-      file.seekg (beg);
-
-      std::size_t txt_len = len;
-      OCTAVE_LOCAL_BUFFER (char, buf, txt_len + 1);
-
-      file.read (buf, txt_len);
-
-      buf[txt_len] = '\0';
-
-      h = buf;
+      h = docstrings.substr (beg, len);
 
       symbol_found = true;
     }
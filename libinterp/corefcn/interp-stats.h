@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_interp_stats_h)
+#define octave_interp_stats_h 1
+
+#include "octave-config.h"
+
+#include <atomic>
+#include <cstdint>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Always-on counters at interpreter choke points, the libinterp
+// counterpart of the allocation counters in oct-alloc-stats.h.  The
+// counters are cumulative; readers take snapshots and compare deltas.
+// Updates are relaxed atomic adds, cheap enough to leave enabled in
+// production builds.
+
+namespace interp_stats
+{
+
+extern OCTINTERP_API std::atomic<std::uint64_t> type_conversions;
+extern OCTINTERP_API std::atomic<std::uint64_t> fcn_lookups;
+
+inline void
+count_type_conversion ()
+{
+  type_conversions.fetch_add (1, std::memory_order_relaxed);
+}
+
+inline void
+count_fcn_lookup ()
+{
+  fcn_lookups.fetch_add (1, std::memory_order_relaxed);
+}
+
+}
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -70,6 +70,7 @@
 #include "ovl.h"
 #include "ov.h"
 #include "ov-classdef.h"
+#include "ov-fcn-handle.h"
 #include "parse.h"
 #include "pt-classdef.h"
 #include "pt-eval.h"
@@ -594,18 +595,14 @@ interpreter::interpreter (application *app_context)
         Ftexi_macros_file (*this, ovl (texi_macros_file));
     }
 
-  // FIXME: we defer creation of the gh_manager object because it
-  // creates a root_figure object that requires the display_info
-  // object, but that is currently only accessible through the global
-  // interpreter object and that is not available until after the
-  // interpreter::instance pointer is set (above).  It would be better
-  // if m_gh_manager could be an object value instead of a pointer and
-  // created as part of the interpreter initialization.  To do that,
-  // we should either make the display_info object independent of the
-  // interpreter object (does it really need to cache any
-  // information?) or defer creation of the root_figure object until
-  // it is actually needed.
-  m_gh_manager = new gh_manager (*this);
+  // The gh_manager object is created on demand by get_gh_manager.
+  // Creating it builds the root_figure object (which probes the
+  // display) and registers the default graphics toolkit, none of
+  // which a headless batch invocation ever needs.  Deferring it also
+  // sidesteps the ordering problem that the display_info object is
+  // only accessible through the global interpreter object, which is
+  // not available until after the interpreter::instance pointer is
+  // set (above).
 
   m_input_system.initialize (line_editing);
 
@@ -633,6 +630,15 @@ interpreter::~interpreter ()
   delete m_gh_manager;
 }
 
+gh_manager&
+interpreter::get_gh_manager ()
+{
+  if (! m_gh_manager)
+    m_gh_manager = new gh_manager (*this);
+
+  return *m_gh_manager;
+}
+
 void interpreter::intern_nargin (octave_idx_type nargs)
 {
   m_evaluator.set_auto_fcn_var (stack_frame::NARGIN, nargs);
@@ -940,7 +946,11 @@ void interpreter::shutdown ()
 
   m_initialized = false;
 
-  OCTAVE_SAFE_CALL (feval, ("close", ovl ("all"), 0));
+  // Closing figures only makes sense if something created the
+  // graphics subsystem; don't instantiate it just to shut it down.
+
+  if (m_gh_manager)
+    OCTAVE_SAFE_CALL (feval, ("close", ovl ("all"), 0));
 
   // Any atexit functions added after this function call won't be
   // executed.  Each atexit function is executed with
@@ -981,7 +991,8 @@ void interpreter::shutdown ()
 
   // We may still have some figures.  Close them.
 
-  OCTAVE_SAFE_CALL (feval, ("close", ovl ("all"), 0));
+  if (m_gh_manager)
+    OCTAVE_SAFE_CALL (feval, ("close", ovl ("all"), 0));
 
   // What is supposed to happen if a figure has a closerequestfcn or
   // deletefcn callback registered that creates other figures or
@@ -1562,6 +1573,21 @@ octave_value_list interpreter::feval (const octave_value& val,
       // This covers function handles, inline functions, and anonymous
       //  functions.
 
+      if (val.is_function_handle ())
+        {
+          octave_fcn_handle *fh = val.fcn_handle_value ();
+
+          if (fh)
+            {
+              // Call the handle directly instead of packaging ARGS
+              // into a one-element subsref index list.  Handle-heavy
+              // callers like cellfun come through here once per
+              // element, so the per-call savings add up.
+
+              return fh->call (nargout, args);
+            }
+        }
+
       std::list<octave_value_list> arg_list;
       arg_list.push_back (args);
 
@@ -324,10 +324,10 @@ public:
     return m_event_manager;
   }
 
-  gh_manager& get_gh_manager ()
-  {
-    return *m_gh_manager;
-  }
+  // Created on first use so that batch invocations that never touch
+  // graphics skip the subsystem entirely.
+
+  gh_manager& get_gh_manager ();
 
   // Any Octave code that needs to change the current directory should
   // call this function instead of calling the system chdir function
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "oct-alloc-stats.h"
+#include "oct-block-pool.h"
+
+#include "defun.h"
+#include "interp-stats.h"
+#include "oct-map.h"
+#include "ov.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+namespace interp_stats
+{
+
+std::atomic<std::uint64_t> type_conversions (0);
+std::atomic<std::uint64_t> fcn_lookups (0);
+
+}
+
+static double
+counter_value (const std::atomic<std::uint64_t>& counter)
+{
+  return static_cast<double> (counter.load (std::memory_order_relaxed));
+}
+
+DEFUN (interpstats, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{stats} =} interpstats ()
+Return a structure of cumulative interpreter runtime counters.
+
+The counters are maintained continuously at negligible cost, so
+comparing snapshots taken before and after a section of code shows
+where the interpreter spent its effort without rebuilding or enabling
+the profiler.  The fields are:
+
+@table @code
+@item BytesAllocated
+Total bytes allocated for array data.
+
+@item BytesFreed
+Total bytes of array data released.
+
+@item PeakBytes
+High-water mark of bytes held in array data.
+
+@item RepAllocations
+Number of array data blocks allocated.
+
+@item CowCopies
+Number of arrays copied because a shared array was about to be
+modified (copy-on-write).
+
+@item HugePagesAdvised
+Number of large array data blocks for which the kernel accepted
+transparent-huge-page advice.
+
+@item PoolHits
+Number of array data blocks served from the recycling pool instead of
+the system allocator.
+
+@item PoolReturns
+Number of freed array data blocks parked in the recycling pool for
+reuse.
+
+@item TypeConversions
+Number of automatic type conversions applied to make operator
+arguments compatible.
+
+@item FunctionLookups
+Number of function searches through scopes and the load path.
+@end table
+
+All counters only ever increase; compute deltas to attribute activity
+to a code region.
+@seealso{profile, memprofile, getrusage}
+@end deftypefn */)
+{
+  if (args.length () != 0)
+    print_usage ();
+
+  octave_scalar_map stats;
+
+  stats.assign ("BytesAllocated", counter_value (alloc_stats::bytes_allocated));
+  stats.assign ("BytesFreed", counter_value (alloc_stats::bytes_freed));
+  stats.assign ("PeakBytes", counter_value (alloc_stats::peak_bytes));
+  stats.assign ("RepAllocations",
+                counter_value (alloc_stats::rep_allocations));
+  stats.assign ("CowCopies", counter_value (alloc_stats::cow_copies));
+  stats.assign ("HugePagesAdvised",
+                counter_value (alloc_stats::hugepage_advised));
+  stats.assign ("PoolHits", counter_value (block_pool_stats::hits));
+  stats.assign ("PoolReturns", counter_value (block_pool_stats::returns));
+  stats.assign ("TypeConversions",
+                counter_value (interp_stats::type_conversions));
+  stats.assign ("FunctionLookups", counter_value (interp_stats::fcn_lookups));
+
+  return ovl (stats);
+}
+
+/*
+%!test
+%! s1 = interpstats ();
+%! assert (fieldnames (s1),
+%!         {"BytesAllocated"; "BytesFreed"; "PeakBytes"; "RepAllocations";
+%!          "CowCopies"; "HugePagesAdvised"; "PoolHits"; "PoolReturns";
+%!          "TypeConversions"; "FunctionLookups"});
+%! x = rand (100);
+%! y = x;
+%! y(1) = 0;
+%! s2 = interpstats ();
+%! assert (s2.BytesAllocated > s1.BytesAllocated);
+%! assert (s2.CowCopies > s1.CowCopies);
+%! assert (s2.RepAllocations >= s1.RepAllocations);
+
+%!error interpstats (1)
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -27,6 +27,10 @@
 #  include "config.h"
 #endif
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "defun.h"
 #include "error.h"
 #include "errwarn.h"
@@ -35,7 +39,7 @@
 #include "utils.h"
 
 #if defined (HAVE_RAPIDJSON)
-#  include <rapidjson/document.h>
+#  include <rapidjson/reader.h>
 #  include <rapidjson/error/en.h>
 #endif
 
@@ -43,190 +47,38 @@ OCTAVE_BEGIN_NAMESPACE(octave)
 
 #if defined (HAVE_RAPIDJSON)
 
-static octave_value
-decode (const rapidjson::Value& val,
-        const octave::make_valid_name_options *options);
-
-//! Decodes a numerical JSON value into a scalar number.
-//!
-//! @param val JSON value that is guaranteed to be a numerical value.
-//!
-//! @return @ref octave_value that contains the numerical value of @p val.
-//!
-//! @b Example:
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("123");
-//! octave_value num = decode_number (d);
-//! @endcode
-
-static octave_value
-decode_number (const rapidjson::Value& val)
-{
-  if (val.IsUint ())
-    return octave_value (val.GetUint ());
-  else if (val.IsInt ())
-    return octave_value (val.GetInt ());
-  else if (val.IsUint64 ())
-    return octave_value (val.GetUint64 ());
-  else if (val.IsInt64 ())
-    return octave_value (val.GetInt64 ());
-  else if (val.IsDouble ())
-    return octave_value (val.GetDouble ());
-  else
-    error ("jsondecode: unidentified type");
-}
-
-//! Decodes a JSON object into a scalar struct.
-//!
-//! @param val JSON value that is guaranteed to be a JSON object.
-//! @param options @c ReplacementStyle and @c Prefix options with their values.
-//!
-//! @return @ref octave_value that contains the equivalent scalar struct of @p val.
-//!
-//! @b Example:
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("{\"a\": 1, \"b\": 2}");
-//! octave_value struct = decode_object (d, octave_value_list ());
-//! @endcode
-
-static octave_value
-decode_object (const rapidjson::Value& val,
-               const octave::make_valid_name_options *options)
-{
-  octave_scalar_map retval;
-
-  for (const auto& pair : val.GetObject ())
-    {
-      // Validator function "matlab.lang.makeValidName" to guarantee legitimate
-      // variable name.
-      std::string varname = pair.name.GetString ();
-      if (options != nullptr)
-        octave::make_valid_name (varname, *options);
-      retval.assign (varname, decode (pair.value, options));
-    }
-
-  return retval;
-}
-
-//! Decodes a JSON array that contains only numerical or null values
-//! into an NDArray.
-//!
-//! @param val JSON value that is guaranteed to be a numeric array.
-//!
-//! @return @ref octave_value that contains the equivalent NDArray of @p val.
-//!
-//! @b Example:
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[1, 2, 3, 4]");
-//! octave_value numeric_array = decode_numeric_array (d);
-//! @endcode
-
-static octave_value
-decode_numeric_array (const rapidjson::Value& val)
-{
-  NDArray retval (dim_vector (val.Size (), 1));
-  octave_idx_type index = 0;
-  for (const auto& elem : val.GetArray ())
-    retval(index++) = elem.IsNull () ? octave_NaN
-                      : decode_number (elem).double_value ();
-  return retval;
-}
-
-//! Decodes a JSON array that contains only boolean values into a boolNDArray.
-//!
-//! @param val JSON value that is guaranteed to be a boolean array.
-//!
-//! @return @ref octave_value that contains the equivalent boolNDArray of @p val.
-//!
-//! @b Example:
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[true, false, true]");
-//! octave_value boolean_array = decode_boolean_array (d);
-//! @endcode
-
-static octave_value
-decode_boolean_array (const rapidjson::Value& val)
-{
-  boolNDArray retval (dim_vector (val.Size (), 1));
-  octave_idx_type index = 0;
-  for (const auto& elem : val.GetArray ())
-    retval(index++) = elem.GetBool ();
-  return retval;
-}
+//! JSON type tags recorded for each decoded array element.  A finished
+//! array collapses into a numeric array, logical array, struct array,
+//! or cell depending on these tags.  True and false share one tag just
+//! as the DOM-based decoder treated kTrueType and kFalseType as a
+//! single type.
 
-//! Decodes a JSON array that contains different types
-//! or string values only into a Cell.
-//!
-//! @param val JSON value that is guaranteed to be a mixed or string array.
-//! @param options @c ReplacementStyle and @c Prefix options with their values.
-//!
-//! @return @ref octave_value that contains the equivalent Cell of @p val.
-//!
-//! @b Example (decoding a string array):
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[\"foo\", \"bar\", \"baz\"]");
-//! octave_value cell = decode_string_and_mixed_array (d, octave_value_list ());
-//! @endcode
-//!
-//! @b Example (decoding a mixed array):
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[\"foo\", 123, true]");
-//! octave_value cell = decode_string_and_mixed_array (d, octave_value_list ());
-//! @endcode
-
-static octave_value
-decode_string_and_mixed_array (const rapidjson::Value& val,
-                               const octave::make_valid_name_options *options)
+enum json_elem_type : char
 {
-  Cell retval (dim_vector (val.Size (), 1));
-  octave_idx_type index = 0;
-  for (const auto& elem : val.GetArray ())
-    retval(index++) = decode (elem, options);
-  return retval;
-}
+  json_null,
+  json_bool,
+  json_number,
+  json_string,
+  json_object,
+  json_array
+};
 
-//! Decodes a JSON array that contains only objects into a Cell or struct array
-//! depending on the similarity of the objects' keys.
+//! Decodes a Cell of scalar structs into a Cell or struct array
+//! depending on the similarity of the structs' keys.
 //!
-//! @param val JSON value that is guaranteed to be an object array.
-//! @param options @c ReplacementStyle and @c Prefix options with their values.
+//! @param struct_cell Cell that is guaranteed to contain scalar structs.
 //!
 //! @return @ref octave_value that contains the equivalent Cell
-//! or struct array of @p val.
+//! or struct array of @p struct_cell.
 //!
-//! @b Example (returns a struct array):
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[{\"a\":1,\"b\":2},{\"a\":3,\"b\":4}]");
-//! octave_value object_array = decode_object_array (d, octave_value_list ());
-//! @endcode
-//!
-//! @b Example (returns a Cell):
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[{\"a\":1,\"b\":2},{\"b\":3,\"a\":4}]");
-//! octave_value object_array = decode_object_array (d, octave_value_list ());
-//! @endcode
+//! For example, the elements of @c '[{"a":1,"b":2},{"a":3,"b":4}]'
+//! share their keys and collapse into a struct array, while the
+//! elements of @c '[{"a":1,"b":2},{"b":3,"a":4}]' do not and remain a
+//! Cell of scalar structs.
 
 static octave_value
-decode_object_array (const rapidjson::Value& val,
-                     const octave::make_valid_name_options *options)
+decode_object_array (const Cell& struct_cell)
 {
-  Cell struct_cell = decode_string_and_mixed_array (val, options).cell_value ();
   string_vector field_names = struct_cell(0).scalar_map_value ().fieldnames ();
 
   bool same_field_names = true;
@@ -263,38 +115,20 @@ decode_object_array (const rapidjson::Value& val,
     return struct_cell;
 }
 
-//! Decodes a JSON array that contains only arrays into a Cell or an NDArray
+//! Decodes a Cell of decoded sub-arrays into a Cell or an NDArray
 //! depending on the dimensions and element types of the sub-arrays.
 //!
-//! @param val JSON value that is guaranteed to be an array of arrays.
-//! @param options @c ReplacementStyle and @c Prefix options with their values.
+//! @param cell Cell whose elements are all decoded JSON arrays.
 //!
 //! @return @ref octave_value that contains the equivalent Cell
-//! or NDArray of @p val.
+//! or NDArray of @p cell.
 //!
-//! @b Example (returns an NDArray):
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[[1, 2], [3, 4]]");
-//! octave_value array = decode_array_of_arrays (d, octave_value_list ());
-//! @endcode
-//!
-//! @b Example (returns a Cell):
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[[1, 2], [3, 4, 5]]");
-//! octave_value cell = decode_array_of_arrays (d, octave_value_list ());
-//! @endcode
+//! For example, @c '[[1, 2], [3, 4]]' becomes a 2x2 NDArray while
+//! @c '[[1, 2], [3, 4, 5]]' stays a Cell of its sub-arrays.
 
 static octave_value
-decode_array_of_arrays (const rapidjson::Value& val,
-                        const octave::make_valid_name_options *options)
+decode_array_of_arrays (const Cell& cell)
 {
-  // Some arrays should be decoded as NDArrays and others as cell arrays
-  Cell cell = decode_string_and_mixed_array (val, options).cell_value ();
-
   // Only arrays with sub-arrays of booleans and numericals will return NDArray
   bool is_bool = cell(0).is_bool_matrix ();
   bool is_struct = cell(0).isstruct ();
@@ -382,104 +216,252 @@ decode_array_of_arrays (const rapidjson::Value& val,
     }
 }
 
-//! Decodes any type of JSON arrays.  This function only serves as an interface
-//! by choosing which function to call from the previous functions.
-//!
-//! @param val JSON value that is guaranteed to be an array.
-//! @param options @c ReplacementStyle and @c Prefix options with their values.
-//!
-//! @return @ref octave_value that contains the output of decoding @p val.
+//! Event-driven (SAX) JSON decoder.  JSON values are converted to
+//! octave_values as parse events arrive, so only the currently open
+//! containers are buffered while parsing and the whole-document DOM is
+//! never materialized.  Objects are assembled field by field into an
+//! octave_scalar_map.  Array elements still have to be buffered until
+//! the closing bracket because the Octave type of the result (numeric
+//! array, logical array, struct array, cell) depends on the types of
+//! all of the elements; arrays that have produced only numbers or
+//! nulls so far keep their elements in a plain double buffer so large
+//! numeric arrays never exist as individual octave_values.
 //!
 //! @b Example:
 //!
 //! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[[1, 2], [3, 4, 5]]");
-//! octave_value array = decode_array (d, octave_value_list ());
+//! json_decode_handler handler (options);
+//! rapidjson::Reader reader;
+//! rapidjson::StringStream ss ("[{\"a\":1,\"b\":2},{\"b\":3,\"a\":4}]");
+//! reader.Parse (ss, handler);
+//! octave_value value = handler.result ();
 //! @endcode
 
-static octave_value
-decode_array (const rapidjson::Value& val,
-              const octave::make_valid_name_options *options)
+class json_decode_handler
+  : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>,
+                                        json_decode_handler>
 {
-  // Handle empty arrays
-  if (val.Empty ())
-    return NDArray ();
-
-  // Compare with other elements to know if the array has multiple types
-  rapidjson::Type array_type = val[0].GetType ();
-  // Check if the array is numeric and if it has multiple types
-  bool same_type = true;
-  bool is_numeric = true;
-  for (const auto& elem : val.GetArray ())
-    {
-      rapidjson::Type current_elem_type = elem.GetType ();
-      if (is_numeric && ! (current_elem_type == rapidjson::kNullType
-                           || current_elem_type == rapidjson::kNumberType))
-        is_numeric = false;
-      if (same_type && (current_elem_type != array_type))
-        // RapidJSON doesn't have kBoolean Type it has kTrueType and kFalseType
-        if (! ((current_elem_type == rapidjson::kTrueType
-                && array_type == rapidjson::kFalseType)
-               || (current_elem_type == rapidjson::kFalseType
-                   && array_type == rapidjson::kTrueType)))
+public:
+
+  json_decode_handler (const make_valid_name_options *options)
+    : m_options (options), m_stack (), m_result () { }
+
+  // The rapidjson::Reader handler interface; the method names are
+  // fixed by RapidJSON.
+
+  bool Null ()
+  {
+    if (in_numeric_array ())
+      return append_number (octave_NaN, json_null);
+
+    // null outside a numeric array decodes to an empty double array.
+    return deliver (NDArray (), json_null);
+  }
+
+  bool Bool (bool b) { return deliver (b, json_bool); }
+
+  bool Int (int i) { return number (octave_value (i), i); }
+
+  bool Uint (unsigned int u) { return number (octave_value (u), u); }
+
+  bool Int64 (int64_t i)
+  { return number (octave_value (i), static_cast<double> (i)); }
+
+  bool Uint64 (uint64_t u)
+  { return number (octave_value (u), static_cast<double> (u)); }
+
+  bool Double (double d) { return number (octave_value (d), d); }
+
+  bool String (const char *s, rapidjson::SizeType len, bool)
+  { return deliver (std::string (s, len), json_string); }
+
+  bool StartObject ()
+  {
+    m_stack.emplace_back ();
+    m_stack.back ().is_object = true;
+    return true;
+  }
+
+  bool Key (const char *s, rapidjson::SizeType len, bool)
+  {
+    // Validator function "matlab.lang.makeValidName" to guarantee
+    // legitimate variable name.
+    std::string key (s, len);
+    if (m_options != nullptr)
+      make_valid_name (key, *m_options);
+    m_stack.back ().key = std::move (key);
+    return true;
+  }
+
+  bool EndObject (rapidjson::SizeType)
+  {
+    octave_scalar_map map = std::move (m_stack.back ().map);
+    m_stack.pop_back ();
+    return deliver (map, json_object);
+  }
+
+  bool StartArray ()
+  {
+    m_stack.emplace_back ();
+    return true;
+  }
+
+  bool EndArray (rapidjson::SizeType)
+  {
+    frame f = std::move (m_stack.back ());
+    m_stack.pop_back ();
+    return deliver (collapse_array (f), json_array);
+  }
+
+  octave_value result () const { return m_result; }
+
+private:
+
+  // One currently open container.
+  struct frame
+  {
+    bool is_object = false;
+
+    // Object under construction and the key awaiting its value.
+    octave_scalar_map map;
+    std::string key;
+
+    // Decoded array elements with their JSON type tags.
+    std::vector<octave_value> elems;
+    std::vector<char> types;
+
+    // Fast path storage used while the array has produced only
+    // numbers and nulls; spilled into ELEMS by the first element of
+    // any other type.
+    std::vector<double> numbers;
+    bool numeric = true;
+  };
+
+  bool in_numeric_array () const
+  {
+    return (! m_stack.empty () && ! m_stack.back ().is_object
+            && m_stack.back ().numeric);
+  }
+
+  bool append_number (double d, json_elem_type type)
+  {
+    frame& f = m_stack.back ();
+    f.numbers.push_back (d);
+    f.types.push_back (type);
+    return true;
+  }
+
+  bool number (const octave_value& v, double d)
+  {
+    if (in_numeric_array ())
+      return append_number (d, json_number);
+
+    return deliver (v, json_number);
+  }
+
+  // Hand a finished value to the enclosing container, or make it the
+  // result if there is none.
+
+  bool deliver (const octave_value& v, json_elem_type type)
+  {
+    if (m_stack.empty ())
+      {
+        m_result = v;
+        return true;
+      }
+
+    frame& f = m_stack.back ();
+
+    if (f.is_object)
+      f.map.assign (f.key, v);
+    else
+      {
+        if (f.numeric)
+          spill (f);
+
+        f.elems.push_back (v);
+        f.types.push_back (type);
+      }
+
+    return true;
+  }
+
+  // Turn the numeric fast path storage into ordinary decoded elements.
+
+  static void spill (frame& f)
+  {
+    f.numeric = false;
+
+    f.elems.reserve (f.numbers.size ());
+    for (std::size_t i = 0; i < f.numbers.size (); i++)
+      {
+        // null decodes to an empty double array outside a numeric
+        // array.
+        if (f.types[i] == json_null)
+          f.elems.push_back (octave_value (NDArray ()));
+        else
+          f.elems.push_back (octave_value (f.numbers[i]));
+      }
+
+    f.numbers.clear ();
+  }
+
+  // Collapse a finished array into the Octave value its element types
+  // call for.
+
+  static octave_value collapse_array (frame& f)
+  {
+    octave_idx_type nel = f.types.size ();
+
+    // Handle empty arrays.
+    if (nel == 0)
+      return NDArray ();
+
+    // Arrays of numbers and nulls only.
+    if (f.numeric)
+      {
+        NDArray retval (dim_vector (nel, 1));
+        for (octave_idx_type i = 0; i < nel; i++)
+          retval.xelem (i) = f.numbers[i];
+        return retval;
+      }
+
+    bool same_type = true;
+    for (octave_idx_type i = 1; i < nel; i++)
+      if (f.types[i] != f.types[0])
+        {
           same_type = false;
-    }
+          break;
+        }
 
-  if (is_numeric)
-    return decode_numeric_array (val);
+    if (same_type && f.types[0] == json_bool)
+      {
+        boolNDArray retval (dim_vector (nel, 1));
+        for (octave_idx_type i = 0; i < nel; i++)
+          retval.xelem (i) = f.elems[i].bool_value ();
+        return retval;
+      }
 
-  if (same_type && (array_type != rapidjson::kStringType))
-    {
-      if (array_type == rapidjson::kTrueType
-          || array_type == rapidjson::kFalseType)
-        return decode_boolean_array (val);
-      else if (array_type == rapidjson::kObjectType)
-        return decode_object_array (val, options);
-      else if (array_type == rapidjson::kArrayType)
-        return decode_array_of_arrays (val, options);
-      else
-        error ("jsondecode: unidentified type");
-    }
-  else
-    return decode_string_and_mixed_array (val, options);
-}
+    Cell cell (dim_vector (nel, 1));
+    for (octave_idx_type i = 0; i < nel; i++)
+      cell.xelem (i) = f.elems[i];
 
-//! Decodes any JSON value.  This function only serves as an interface
-//! by choosing which function to call from the previous functions.
-//!
-//! @param val JSON value.
-//! @param options @c ReplacementStyle and @c Prefix options with their values.
-//!
-//! @return @ref octave_value that contains the output of decoding @p val.
-//!
-//! @b Example:
-//!
-//! @code{.cc}
-//! rapidjson::Document d;
-//! d.Parse ("[{\"a\":1,\"b\":2},{\"b\":3,\"a\":4}]");
-//! octave_value value = decode (d, octave_value_list ());
-//! @endcode
+    if (same_type && f.types[0] == json_object)
+      return decode_object_array (cell);
 
-static octave_value
-decode (const rapidjson::Value& val,
-        const octave::make_valid_name_options *options)
-{
-  if (val.IsBool ())
-    return val.GetBool ();
-  else if (val.IsNumber ())
-    return decode_number (val);
-  else if (val.IsString ())
-    return val.GetString ();
-  else if (val.IsObject ())
-    return decode_object (val, options);
-  else if (val.IsNull ())
-    return NDArray ();
-  else if (val.IsArray ())
-    return decode_array (val, options);
-  else
-    error ("jsondecode: unidentified type");
-}
+    if (same_type && f.types[0] == json_array)
+      return decode_array_of_arrays (cell);
+
+    // String and mixed arrays stay cells.
+    return cell;
+  }
+
+  const make_valid_name_options *m_options;
+
+  std::vector<frame> m_stack;
+
+  octave_value m_result;
+};
 
 #endif
 
@@ -618,20 +600,21 @@ jsondecode ('@{"1": "one", "2": "two"@}', 'Prefix', 'm_')
     error ("jsondecode: JSON_TXT must be a character string");
 
   std::string json = args(0).string_value ();
-  rapidjson::Document d;
-  // DOM is chosen instead of SAX as SAX publishes events to a handler that
-  // decides what to do depending on the event only.  This will cause a
-  // problem in decoding JSON arrays as the output may be an array or a cell
-  // and that doesn't only depend on the event (startArray) but also on the
-  // types of the elements inside the array.
-  d.Parse <rapidjson::kParseNanAndInfFlag> (json.c_str ());
-
-  if (d.HasParseError ())
+
+  // Streaming (SAX) parse; the handler constructs the octave_values
+  // directly from the parse events, so the document-wide DOM that a
+  // very large input would need is never built.
+
+  json_decode_handler handler (options);
+  rapidjson::Reader reader;
+  rapidjson::StringStream ss (json.c_str ());
+
+  if (! reader.Parse<rapidjson::kParseNanAndInfFlag> (ss, handler))
     error ("jsondecode: parse error at offset %u: %s\n",
-           static_cast<unsigned int> (d.GetErrorOffset ()) + 1,
-           rapidjson::GetParseError_En (d.GetParseError ()));
+           static_cast<unsigned int> (reader.GetErrorOffset ()) + 1,
+           rapidjson::GetParseError_En (reader.GetParseErrorCode ()));
 
-  return decode (d, options);
+  return handler.result ();
 
 #else
 
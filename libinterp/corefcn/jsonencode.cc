@@ -81,6 +81,33 @@ encode_numeric (T& writer, const octave_value& obj,
     error ("jsonencode: unsupported type");
 }
 
+//! Encodes one element of a numeric or logical array.  This is the
+//! same decision logic as @ref encode_numeric but operating on a plain
+//! double, so array loops do not have to box every element into an
+//! octave_value.  The conversion to text itself is done by RapidJSON's
+//! writer (Grisu2), which the value is handed to directly.
+//!
+//! @param writer RapidJSON's writer that is responsible for generating JSON.
+//! @param value element value.
+//! @param is_logical @c bool that indicates if the array is logical.
+//! @param ConvertInfAndNaN @c bool that converts @c Inf and @c NaN to @c null.
+
+template <typename T> void
+encode_numeric_element (T& writer, double value, bool is_logical,
+                        const bool& ConvertInfAndNaN)
+{
+  if (is_logical)
+    writer.Bool (value != 0);
+  // See encode_numeric for the reasoning behind these cases.
+  else if (fabs (floor (value) - value) < std::numeric_limits<double>::epsilon ()
+           && value <= 999999 && value >= -999999)
+    writer.Int64 (value);
+  else if (ConvertInfAndNaN && ! octave::math::isfinite (value))
+    writer.Null ();
+  else
+    writer.Double (value);
+}
+
 //! Encodes character vectors and arrays into JSON strings.
 //!
 //! @param writer RapidJSON's writer that is responsible for generating JSON.
@@ -299,14 +326,13 @@ encode_array (T& writer, const octave_value& obj, const bool& ConvertInfAndNaN,
     }
   else if (array.isvector ())
     {
+      // Stream the elements into the writer directly instead of boxing
+      // each one into an octave_value for encode_numeric.
+      const double *data = array.data ();
+
       writer.StartArray ();
       for (octave_idx_type i = 0; i < array.numel (); ++i)
-        {
-          if (is_logical)
-            encode_numeric (writer, bool (array(i)), ConvertInfAndNaN);
-          else
-            encode_numeric (writer, array(i), ConvertInfAndNaN);
-        }
+        encode_numeric_element (writer, data[i], is_logical, ConvertInfAndNaN);
       writer.EndArray ();
     }
   else
@@ -347,6 +373,26 @@ encode_array (T& writer, const octave_value& obj, const bool& ConvertInfAndNaN,
                             original_dims, level + 1, is_logical);
               writer.EndArray ();
             }
+          else if (ndims == 2)
+            {
+              // Fast path for plain matrices: stream the rows straight
+              // from the column-major data instead of materializing one
+              // sub-array octave_value per row with "num2cell".
+              const double *data = array.data ();
+              octave_idx_type nr = dims(0);
+              octave_idx_type nc = dims(1);
+
+              writer.StartArray ();
+              for (octave_idx_type i = 0; i < nr; ++i)
+                {
+                  writer.StartArray ();
+                  for (octave_idx_type j = 0; j < nc; ++j)
+                    encode_numeric_element (writer, data[i + j * nr],
+                                            is_logical, ConvertInfAndNaN);
+                  writer.EndArray ();
+                }
+              writer.EndArray ();
+            }
           else
             {
               for (idx = 0; idx < ndims; ++idx)
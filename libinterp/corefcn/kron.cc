@@ -43,6 +43,7 @@
 #include "PermMatrix.h"
 
 #include "mx-inlines.cc"
+#include "oct-parallel.h"
 #include "quit.h"
 
 #include "defun.h"
@@ -64,20 +65,34 @@ kron (const MArray<R>& a, const MArray<T>& b)
   octave_idx_type ncb = b.cols ();
 
   MArray<T> c (dim_vector (nra*nrb, nca*ncb));
+
+  const R *av = a.data ();
+  const T *bv = b.data ();
   T *cv = c.fortran_vec ();
 
-  for (octave_idx_type ja = 0; ja < nca; ja++)
+  // Column JA*NCB+JB of the result holds the copies of column JB of B
+  // scaled by the elements of column JA of A, so the result columns can
+  // be filled independently.  Split them across threads for large
+  // results; each worker streams through a contiguous slab of the
+  // output.
+
+  chunked_parallel_for (nca*ncb, c.numel (),
+    [=] (octave_idx_type beg, octave_idx_type len)
     {
-      octave_quit ();
-      for (octave_idx_type jb = 0; jb < ncb; jb++)
+      T *p = cv + beg * (nra*nrb);
+
+      for (octave_idx_type jc = beg; jc < beg + len; jc++)
         {
+          const R *acol = av + nra * (jc / ncb);
+          const T *bcol = bv + nrb * (jc % ncb);
+
           for (octave_idx_type ia = 0; ia < nra; ia++)
             {
-              mx_inline_mul (nrb, cv, a(ia, ja), b.data () + nrb*jb);
-              cv += nrb;
+              mx_inline_mul (nrb, p, acol[ia], bcol);
+              p += nrb;
             }
         }
-    }
+    });
 
   return c;
 }
@@ -29,10 +29,13 @@
 
 #include <algorithm>
 #include <cctype>
+#include <fstream>
+#include <sstream>
 
 #include "dir-ops.h"
 #include "file-ops.h"
 #include "file-stat.h"
+#include "lo-sysdep.h"
 #include "oct-env.h"
 #include "pathsearch.h"
 
@@ -231,6 +234,7 @@ subdirs_modified (const std::string& d, const sys::time& last_checked)
 
 std::string load_path::s_sys_path;
 load_path::abs_dir_cache_type load_path::s_abs_dir_cache;
+bool load_path::s_trust_cache = false;
 
 load_path::load_path (interpreter& interp)
   : m_add_hook ([=] (const std::string& dir) { this->execute_pkg_add (dir); }),
@@ -290,6 +294,8 @@ load_path::clear ()
 void
 load_path::set (const std::string& p, bool warn, bool is_init)
 {
+  m_interpreter.get_symbol_table ().bump_fcn_table_revision ();
+
   // Use a list when we need to preserve order.
   std::list<std::string> elts = split_path (p);
 
@@ -358,6 +364,8 @@ load_path::prepend (const std::string& dir, bool warn)
 bool
 load_path::remove (const std::string& dir_arg)
 {
+  m_interpreter.get_symbol_table ().bump_fcn_table_revision ();
+
   bool retval = false;
 
   if (! dir_arg.empty ())
@@ -399,6 +407,8 @@ load_path::remove (const std::string& dir_arg)
 void
 load_path::update ()
 {
+  m_interpreter.get_symbol_table ().bump_fcn_table_revision ();
+
   // I don't see a better way to do this because we need to
   // preserve the correct directory ordering for new files that
   // have appeared.
@@ -421,6 +431,270 @@ load_path::update ()
     }
 }
 
+// The persisted directory cache uses a plain line-oriented format,
+// one value per line, so that file names containing spaces (but not
+// newlines) round-trip.  Nothing outside this file depends on the
+// format; bump the header version when changing it.
+
+static const char *cache_file_magic = "# octave load-path directory cache v1";
+
+void
+load_path::write_cache_map (std::ostream& os,
+                            const dir_info::fcn_file_map_type& m)
+{
+  os << m.size () << '\n';
+
+  for (const auto& p : m)
+    os << p.second << ' ' << p.first << '\n';
+}
+
+static bool
+read_cache_count (std::istream& is, std::size_t& n)
+{
+  std::string line;
+
+  if (! std::getline (is, line))
+    return false;
+
+  try
+    {
+      n = std::stoul (line);
+    }
+  catch (const std::exception&)
+    {
+      return false;
+    }
+
+  return true;
+}
+
+bool
+load_path::read_cache_map (std::istream& is, dir_info::fcn_file_map_type& m)
+{
+  std::size_t n;
+
+  if (! read_cache_count (is, n))
+    return false;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      std::string line;
+
+      if (! std::getline (is, line))
+        return false;
+
+      std::size_t pos = line.find (' ');
+
+      if (pos == std::string::npos)
+        return false;
+
+      try
+        {
+          m[line.substr (pos+1)] = std::stoi (line.substr (0, pos));
+        }
+      catch (const std::exception&)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+void
+load_path::write_cache_files (std::ostream& os, const string_vector& v)
+{
+  os << v.numel () << '\n';
+
+  for (octave_idx_type i = 0; i < v.numel (); i++)
+    os << v(i) << '\n';
+}
+
+bool
+load_path::read_cache_files (std::istream& is, string_vector& v)
+{
+  std::size_t n;
+
+  if (! read_cache_count (is, n))
+    return false;
+
+  std::list<std::string> names;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      std::string line;
+
+      if (! std::getline (is, line))
+        return false;
+
+      names.push_back (line);
+    }
+
+  v = string_vector (names);
+
+  return true;
+}
+
+void
+load_path::write_cache_dir (std::ostream& os, const dir_info& di)
+{
+  os << di.dir_name << '\n';
+  os << di.abs_dir_name << '\n';
+  os << static_cast<long long> (di.dir_mtime.unix_time ()) << ' '
+     << static_cast<long long> (di.dir_time_last_checked.unix_time ())
+     << '\n';
+
+  write_cache_files (os, di.all_files);
+  write_cache_files (os, di.fcn_files);
+  write_cache_map (os, di.private_file_map);
+
+  os << di.method_file_map.size () << '\n';
+
+  for (const auto& p : di.method_file_map)
+    {
+      os << p.first << '\n';
+      write_cache_map (os, p.second.method_file_map);
+      write_cache_map (os, p.second.private_file_map);
+    }
+
+  os << di.package_dir_map.size () << '\n';
+
+  for (const auto& p : di.package_dir_map)
+    {
+      os << p.first << '\n';
+      write_cache_dir (os, p.second);
+    }
+}
+
+bool
+load_path::read_cache_dir (std::istream& is, dir_info& di)
+{
+  if (! std::getline (is, di.dir_name))
+    return false;
+
+  if (! std::getline (is, di.abs_dir_name))
+    return false;
+
+  std::string line;
+
+  if (! std::getline (is, line))
+    return false;
+
+  long long mtime, checked;
+
+  std::istringstream times (line);
+
+  times >> mtime >> checked;
+
+  if (! times)
+    return false;
+
+  di.is_relative = ! sys::env::absolute_pathname (di.dir_name);
+  di.dir_mtime = sys::time (static_cast<OCTAVE_TIME_T> (mtime));
+  di.dir_time_last_checked = sys::time (static_cast<OCTAVE_TIME_T> (checked));
+
+  if (! (read_cache_files (is, di.all_files)
+         && read_cache_files (is, di.fcn_files)
+         && read_cache_map (is, di.private_file_map)))
+    return false;
+
+  std::size_t n;
+
+  if (! read_cache_count (is, n))
+    return false;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      std::string name;
+
+      if (! std::getline (is, name))
+        return false;
+
+      dir_info::class_info& ci = di.method_file_map[name];
+
+      if (! (read_cache_map (is, ci.method_file_map)
+             && read_cache_map (is, ci.private_file_map)))
+        return false;
+    }
+
+  if (! read_cache_count (is, n))
+    return false;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      std::string name;
+
+      if (! std::getline (is, name))
+        return false;
+
+      if (! read_cache_dir (is, di.package_dir_map[name]))
+        return false;
+    }
+
+  return true;
+}
+
+void
+load_path::save_directory_cache (const std::string& file) const
+{
+  std::ofstream ofs = sys::ofstream (file.c_str (), std::ios::out);
+
+  if (! ofs)
+    error ("path_cache: unable to open '%s' for writing", file.c_str ());
+
+  ofs << cache_file_magic << '\n';
+  ofs << s_abs_dir_cache.size () << '\n';
+
+  for (const auto& p : s_abs_dir_cache)
+    write_cache_dir (ofs, p.second);
+}
+
+bool
+load_path::load_directory_cache (const std::string& file)
+{
+  std::ifstream ifs = sys::ifstream (file.c_str (), std::ios::in);
+
+  if (! ifs)
+    return false;
+
+  std::string line;
+
+  if (! std::getline (ifs, line) || line != cache_file_magic)
+    return false;
+
+  std::size_t n;
+
+  if (! read_cache_count (ifs, n))
+    return false;
+
+  abs_dir_cache_type entries;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      dir_info di;
+
+      if (! read_cache_dir (ifs, di))
+        return false;
+
+      // Index under both names so that adoption by the name used on
+      // the path works even when it is not the canonical one.
+
+      if (! di.abs_dir_name.empty ())
+        entries[di.abs_dir_name] = di;
+
+      if (di.dir_name != di.abs_dir_name)
+        entries[di.dir_name] = di;
+    }
+
+  // Merge only after the whole file parsed so a truncated cache
+  // cannot leave a half-loaded state behind.
+
+  for (const auto& p : entries)
+    s_abs_dir_cache[p.first] = p.second;
+
+  return true;
+}
+
 bool
 load_path::contains_canonical (const std::string& dir) const
 {
@@ -964,8 +1238,22 @@ load_path::execute_pkg_del (const std::string& dir)
   execute_pkg_add_or_del (dir, "PKG_DEL");
 }
 
-void load_path::rehash ()
+void load_path::rehash (bool force_rescan)
 {
+  if (force_rescan && s_trust_cache)
+    {
+      // Forget the remembered scans so update really rereads the
+      // directories instead of trusting the cache.
+
+      s_abs_dir_cache.clear ();
+
+      for (auto& di : m_dir_info_list)
+        {
+          di.dir_mtime = sys::time (static_cast<OCTAVE_TIME_T> (0));
+          di.dir_time_last_checked = sys::time (static_cast<OCTAVE_TIME_T> (0));
+        }
+    }
+
   update ();
 
   // Signal the GUI allowing updating the load path dialog
@@ -1085,6 +1373,8 @@ load_path::move (const dir_info& di, bool at_end, const std::string& pname)
 void
 load_path::add (const std::string& dir_arg, bool at_end, bool warn)
 {
+  m_interpreter.get_symbol_table ().bump_fcn_table_revision ();
+
   std::size_t len = dir_arg.length ();
 
   if (len > 1 && dir_arg.substr (len-2) == "//")
@@ -1390,6 +1680,16 @@ get_fcn_files (const std::string& d)
 bool
 load_path::dir_info::update ()
 {
+  // In trusted-cache mode a directory that has already been scanned
+  // (or adopted from a persisted cache) is used as-is, with no stat
+  // or readdir traffic at all.  On network filesystems those calls
+  // dominate rehash time, and change notification (inotify and
+  // friends) is not delivered for remote modifications anyway, so an
+  // explicit rehash is the only reliable invalidation there.
+
+  if (s_trust_cache && dir_time_last_checked.unix_time () > 0)
+    return true;
+
   sys::file_stat fs (dir_name);
 
   if (! fs)
@@ -1486,6 +1786,30 @@ load_path::dir_info::initialize ()
 {
   is_relative = ! sys::env::absolute_pathname (dir_name);
 
+  // A persisted cache entry saves the initial scan too: adopt it
+  // rather than reading the directory when the cache is trusted.
+
+  if (s_trust_cache && ! is_relative)
+    {
+      const_abs_dir_cache_iterator p = s_abs_dir_cache.find (dir_name);
+
+      if (p != s_abs_dir_cache.end ())
+        {
+          const dir_info& di = p->second;
+
+          abs_dir_name = di.abs_dir_name;
+          dir_mtime = di.dir_mtime;
+          dir_time_last_checked = di.dir_time_last_checked;
+          all_files = di.all_files;
+          fcn_files = di.fcn_files;
+          private_file_map = di.private_file_map;
+          method_file_map = di.method_file_map;
+          package_dir_map = di.package_dir_map;
+
+          return;
+        }
+    }
+
   dir_time_last_checked = sys::time (static_cast<OCTAVE_TIME_T> (0));
 
   sys::file_stat fs (dir_name);
@@ -2507,11 +2831,132 @@ Reinitialize Octave's load path directory cache.
 {
   load_path& lp = interp.get_load_path ();
 
-  lp.rehash ();
+  lp.rehash (true);
+
+  return ovl ();
+}
+
+DEFMETHOD (path_cache, interp, args, nargout,
+           doc: /* -*- texinfo -*-
+@deftypefn  {} {} path_cache ("save", @var{file})
+@deftypefnx {} {} path_cache ("load", @var{file})
+@deftypefnx {} {} path_cache ("mode", @var{mode})
+@deftypefnx {} {@var{mode} =} path_cache ("mode")
+Persist and control Octave's cache of scanned load path directories.
+
+@code{path_cache ("save", @var{file})} writes the cache of every
+directory scanned so far to @var{file};
+@code{path_cache ("load", @var{file})} merges such a file back in.
+
+The cache @var{mode} is either @qcode{"check"} (the default), where
+directory timestamps are re-checked whenever the path is updated, or
+@qcode{"trust"}, where already scanned or loaded directories are used
+as-is and never re-checked.  Trusting the cache eliminates all
+directory traffic in steady state, which matters on network
+filesystems where those checks are slow, change notification is not
+delivered for remote modifications, and every @code{addpath} or
+@code{rmpath} otherwise re-checks the whole path.  In trusted mode,
+run @code{rehash} to rescan the path explicitly after files change.
+
+A typical setup on a slow filesystem loads the cache early in
+@file{~/.octaverc}:
+
+@example
+@group
+path_cache ("mode", "trust");
+path_cache ("load", "~/.cache/octave-path-cache");
+addpath ("/nfs/toolboxes/...");
+@end group
+@end example
+
+@noindent
+after having run @code{path_cache ("save", @dots{})} once in a fully
+initialized session.
+@seealso{rehash, addpath, path}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+
+  std::string op = args(0).xstring_value ("path_cache: first argument must be a string");
+
+  load_path& lp = interp.get_load_path ();
+
+  if (op == "save")
+    {
+      if (nargin != 2)
+        print_usage ();
+
+      std::string file
+        = args(1).xstring_value ("path_cache: FILE must be a string");
+
+      lp.save_directory_cache (sys::file_ops::tilde_expand (file));
+    }
+  else if (op == "load")
+    {
+      if (nargin != 2)
+        print_usage ();
+
+      std::string file
+        = args(1).xstring_value ("path_cache: FILE must be a string");
+
+      if (! lp.load_directory_cache (sys::file_ops::tilde_expand (file)))
+        error ("path_cache: unable to load directory cache from '%s'",
+               file.c_str ());
+    }
+  else if (op == "mode")
+    {
+      if (nargin == 1)
+        return ovl (load_path::trust_cache () ? "trust" : "check");
+
+      std::string mode
+        = args(1).xstring_value ("path_cache: MODE must be a string");
+
+      if (mode == "trust")
+        load_path::set_trust_cache (true);
+      else if (mode == "check")
+        load_path::set_trust_cache (false);
+      else
+        error ("path_cache: MODE must be \"check\" or \"trust\"");
+    }
+  else
+    error ("path_cache: unknown operation '%s'", op.c_str ());
 
   return ovl ();
 }
 
+/*
+%!test
+%! mode = path_cache ("mode");
+%! unwind_protect
+%!   path_cache ("mode", "trust");
+%!   assert (path_cache ("mode"), "trust");
+%!   path_cache ("mode", "check");
+%!   assert (path_cache ("mode"), "check");
+%! unwind_protect_cleanup
+%!   path_cache ("mode", mode);
+%! end_unwind_protect
+
+%!test
+%! cachefile = tempname ();
+%! unwind_protect
+%!   path_cache ("save", cachefile);
+%!   assert (isfile (cachefile));
+%!   path_cache ("load", cachefile);
+%! unwind_protect_cleanup
+%!   if (isfile (cachefile))
+%!     delete (cachefile);
+%!   endif
+%! end_unwind_protect
+
+%!error path_cache ()
+%!error path_cache ("save")
+%!error <unknown operation> path_cache ("frobnicate")
+%!error <MODE must be "check" or "trust"> path_cache ("mode", "sometimes")
+*/
+
 DEFMETHOD (command_line_path, interp, args, ,
            doc: /* -*- texinfo -*-
 @deftypefn {} {@var{pathstr} =} command_line_path ()
@@ -69,6 +69,23 @@ public:
 
   void update ();
 
+  // Serialize the cache of scanned directories to FILE, or merge the
+  // contents of a file written earlier back into the cache.  Together
+  // with trusted-cache mode this lets path lookups on slow (network)
+  // filesystems run without any directory traffic in steady state.
+
+  void save_directory_cache (const std::string& file) const;
+
+  bool load_directory_cache (const std::string& file);
+
+  // When the cache is trusted, directories that have already been
+  // scanned (or loaded from a persisted cache) are never re-checked
+  // against the filesystem; only an explicit rehash rescans them.
+
+  static bool trust_cache () { return s_trust_cache; }
+
+  static void set_trust_cache (bool flag) { s_trust_cache = flag; }
+
   bool contains_canonical (const std::string& dir_name) const;
 
   bool contains_file_in_dir (const std::string& file_name,
@@ -209,7 +226,11 @@ public:
 
   std::string system_path () const { return s_sys_path; }
 
-  void rehash ();
+  // With FORCE_RESCAN, a trusted cache is invalidated first so the
+  // directories are really reread; this is the explicit invalidation
+  // point when automatic checks are disabled.
+
+  void rehash (bool force_rescan = false);
 
   static const int M_FILE = 1;
   static const int OCT_FILE = 2;
@@ -570,6 +591,19 @@ private:
 
   static abs_dir_cache_type s_abs_dir_cache;
 
+  static bool s_trust_cache;
+
+  // Helpers for the persisted directory cache format.
+
+  static void write_cache_map (std::ostream& os,
+                               const dir_info::fcn_file_map_type& m);
+  static bool read_cache_map (std::istream& is,
+                              dir_info::fcn_file_map_type& m);
+  static void write_cache_files (std::ostream& os, const string_vector& v);
+  static bool read_cache_files (std::istream& is, string_vector& v);
+  static void write_cache_dir (std::ostream& os, const dir_info& di);
+  static bool read_cache_dir (std::istream& is, dir_info& di);
+
   interpreter& m_interpreter;
 
   package_map_type m_package_map;
@@ -46,6 +46,7 @@
 #include "mach-info.h"
 #include "oct-env.h"
 #include "oct-locbuf.h"
+#include "oct-mmap.h"
 #include "oct-time.h"
 #include "quit.h"
 #include "str-vec.h"
@@ -431,6 +432,26 @@ load_save_system::load_vars (std::istream& stream,
 
         case MAT5_BINARY:
         case MAT7_BINARY:
+          // When specific variables were requested, seek past elements
+          // whose names cannot match instead of decoding them; for a
+          // big file this leaves almost all of the data unread (and
+          // for -v7, uncompressed).
+          if (! list_only && argv_idx < argc)
+            {
+              while (true)
+                {
+                  std::string next_name
+                    = peek_mat5_element_name (stream, swap);
+
+                  if (next_name.empty ()
+                      || matches_patterns (argv, argv_idx, argc, next_name))
+                    break;
+
+                  if (! skip_mat5_binary_element (stream, swap))
+                    break;
+                }
+            }
+
           name = read_mat5_binary_element (stream, orig_fname, swap,
                                            global, tc);
           break;
@@ -569,6 +590,14 @@ load_save_system::parse_save_options (const string_vector& argv,
         {
           fmt.set_type (BINARY);
         }
+      else if (argv[i] == "-zchunk")
+        {
+#if defined (HAVE_ZLIB)
+          fmt.set_type (BINARY_ZCHUNK);
+#else
+          err_disabled_feature ("save", "zlib");
+#endif
+        }
       else if (argv[i] == "-hdf5" || argv[i] == "-h")
         {
 #if defined (HAVE_HDF5)
@@ -648,8 +677,9 @@ load_save_system::parse_save_options (const string_vector& argv,
     }
 
   if (append && use_zlib
-      && (fmt.type () != TEXT && fmt.type () != MAT_ASCII))
-    error ("save: -append and -zip options can only be used together with a text format (-text or -ascii)");
+      && (fmt.type () != TEXT && fmt.type () != MAT_ASCII
+          && fmt.type () != HDF5))
+    error ("save: -append and -zip options can only be used together with a text format (-text or -ascii) or -hdf5");
 
   return retval;
 }
@@ -756,6 +786,12 @@ void load_save_system::dump_octave_core ()
 
       std::ios::openmode mode = std::ios::out;
 
+      // The chunked format buffers everything in memory before
+      // writing, which is the wrong trade-off when we may be crashing
+      // because of memory exhaustion, so fall back to plain binary.
+      if (fmt.type () == BINARY_ZCHUNK)
+        fmt.set_type (BINARY);
+
       // Matlab v7 files are always compressed
       if (fmt.type () == MAT7_BINARY)
         use_zlib = false;
@@ -774,6 +810,11 @@ void load_save_system::dump_octave_core ()
 #if defined (HAVE_HDF5)
       if (fmt.type () == HDF5)
         {
+          hdf5_set_save_compression (use_zlib);
+
+          unwind_action restore_compression
+            ([] () { hdf5_set_save_compression (false); });
+
           hdf5_ofstream file (fname, mode);
 
           if (file.file_id >= 0)
@@ -921,6 +962,35 @@ std::size_t load_save_system::save_vars (std::ostream& os,
 
   std::size_t saved = 0;
 
+  if (fmt.type () == MAT7_BINARY && syminfo_list.size () > 1)
+    {
+      // Batch the variables so their zlib compression can proceed in
+      // parallel; they are still written out in this order.
+
+      std::vector<octave_value> vals;
+      std::vector<std::string> names;
+      std::vector<bool> global_flags;
+
+      for (const auto& syminfo : syminfo_list)
+        {
+          octave_value val = syminfo.value ();
+
+          if (val.is_defined ())
+            {
+              vals.push_back (val);
+              names.push_back (syminfo.name ());
+              global_flags.push_back (syminfo.is_global ());
+            }
+
+          saved++;
+        }
+
+      save_mat7_binary_elements (os, vals, names, global_flags,
+                                 save_as_floats);
+
+      return saved;
+    }
+
   for (const auto& syminfo : syminfo_list)
     {
       do_save (os, syminfo, fmt, save_as_floats);
@@ -1096,6 +1166,12 @@ load_save_system::get_file_format (std::istream& file,
 
   bool swap = false;
 
+  if (read_zchunk_binary_magic (file))
+    return BINARY_ZCHUNK;
+
+  file.clear ();
+  file.seekg (0, std::ios::beg);
+
   if (read_binary_file_header (file, swap, flt_fmt, true) == 0)
     retval = BINARY;
   else
@@ -1194,6 +1270,14 @@ load_save_system::load (const octave_value_list& args, int nargout)
         {
           format = BINARY;
         }
+      else if (argv[i] == "-zchunk")
+        {
+#if defined (HAVE_ZLIB)
+          format = BINARY_ZCHUNK;
+#else
+          err_disabled_feature ("load", "zlib");
+#endif
+        }
       else if (argv[i] == "-hdf5" || argv[i] == "-h")
         {
 #if defined (HAVE_HDF5)
@@ -1323,6 +1407,49 @@ load_save_system::load (const octave_value_list& args, int nargout)
             // line-endings explicitly.
             std::ios::openmode mode = std::ios::in | std::ios::binary;
 
+            if (format.type () == BINARY_ZCHUNK)
+              {
+                // Expand the chunked container into memory (the chunks
+                // decompress in parallel into a preallocated buffer),
+                // then read the embedded binary data from there.
+
+                std::string payload;
+
+#if defined (HAVE_ZLIB)
+                if (use_zlib)
+                  {
+                    gzifstream file (fname.c_str (), mode);
+
+                    if (! file)
+                      err_file_open ("load", orig_fname);
+
+                    read_zchunk_binary_data (file, payload, orig_fname);
+
+                    file.close ();
+                  }
+                else
+#endif
+                  {
+                    std::ifstream file = sys::ifstream (fname.c_str (), mode);
+
+                    if (! file)
+                      err_file_open ("load", orig_fname);
+
+                    read_zchunk_binary_data (file, payload, orig_fname);
+
+                    file.close ();
+                  }
+
+                std::istringstream buf (payload);
+
+                if (read_binary_file_header (buf, swap, flt_fmt) < 0)
+                  return retval;
+
+                return load_vars (buf, orig_fname, load_save_format (BINARY),
+                                  flt_fmt, list_only, swap, verbose, argv, i,
+                                  argc, nargout);
+              }
+
 #if defined (HAVE_ZLIB)
             if (use_zlib)
               {
@@ -1359,36 +1486,64 @@ load_save_system::load (const octave_value_list& args, int nargout)
             else
 #endif
               {
-                std::ifstream file = sys::ifstream (fname.c_str (), mode);
+                // Map uncompressed binary formats into memory when the
+                // system supports it, so variable data is copied
+                // straight from the page cache instead of through
+                // iostream buffers (which roughly doubles peak memory
+                // for large MAT-file loads).  Everything else, and
+                // systems without mmap, uses an ordinary stream.
 
-                if (! file)
-                  error ("load: unable to open input file '%s'",
-                         orig_fname.c_str ());
+                sys::imapstream mapped_file;
+
+                std::ifstream file;
+
+                std::istream *in = nullptr;
+
+                if (format.type () == BINARY
+                    || format.type () == MAT_BINARY
+                    || format.type () == MAT5_BINARY
+                    || format.type () == MAT7_BINARY)
+                  {
+                    if (mapped_file.open (fname))
+                      in = &mapped_file;
+                  }
+
+                if (! in)
+                  {
+                    file = sys::ifstream (fname.c_str (), mode);
+
+                    if (! file)
+                      error ("load: unable to open input file '%s'",
+                             orig_fname.c_str ());
+
+                    in = &file;
+                  }
 
                 if (format.type () == BINARY)
                   {
-                    if (read_binary_file_header (file, swap, flt_fmt) < 0)
+                    if (read_binary_file_header (*in, swap, flt_fmt) < 0)
                       {
-                        if (file) file.close ();
+                        if (file.is_open ()) file.close ();
                         return retval;
                       }
                   }
                 else if (format.type () == MAT5_BINARY
                          || format.type () == MAT7_BINARY)
                   {
-                    if (read_mat5_binary_file_header (file, swap, false,
+                    if (read_mat5_binary_file_header (*in, swap, false,
                                                       orig_fname) < 0)
                       {
-                        if (file) file.close ();
+                        if (file.is_open ()) file.close ();
                         return retval;
                       }
                   }
 
-                retval = load_vars (file, orig_fname, format, flt_fmt,
+                retval = load_vars (*in, orig_fname, format, flt_fmt,
                                     list_only, swap, verbose, argv, i,
                                     argc, nargout);
 
-                file.close ();
+                if (file.is_open ())
+                  file.close ();
               }
           }
         else
@@ -1443,6 +1598,9 @@ load_save_system::save (const octave_value_list& args, int nargout)
         // don't insert any commands here!  the brace below must go
         // with the "else" above!
         {
+          if (format.type () == BINARY_ZCHUNK)
+            error ("save: cannot write -zchunk format to stdout");
+
           if (append)
             warning ("save: ignoring -append option for output to stdout");
 
@@ -1491,9 +1649,14 @@ load_save_system::save (const octave_value_list& args, int nargout)
 #if defined (HAVE_HDF5)
       if (format.type () == HDF5)
         {
-          // FIXME: It should be possible to append to HDF5 files.
-          if (append)
-            error ("save: appending to HDF5 files is not implemented");
+          // With -zip, write chunked, compressed datasets.  The flag
+          // is file-scope state in ls-hdf5.cc, so make sure it is
+          // reset even if the save fails.
+
+          hdf5_set_save_compression (use_zlib);
+
+          unwind_action restore_compression
+            ([] () { hdf5_set_save_compression (false); });
 
 #  if defined (HAVE_HDF5_UTF8)
           bool write_header_info
@@ -1520,6 +1683,31 @@ load_save_system::save (const octave_value_list& args, int nargout)
         // don't insert any statements here!  The brace below must go
         // with the "else" above!
         {
+          if (format.type () == BINARY_ZCHUNK)
+            {
+              // FIXME: appending would require rewriting the chunk
+              // table, so it is not implemented for this format.
+              if (append)
+                error ("save: appending to -zchunk files is not implemented");
+
+              std::ofstream file = sys::ofstream (fname.c_str (), mode);
+
+              if (! file)
+                err_file_open ("save", fname);
+
+              // Serialize the variables into an ordinary binary stream
+              // in memory, then compress it chunk-wise in parallel.
+
+              std::ostringstream payload_buf;
+
+              save_vars (argv, i, argc, payload_buf,
+                         load_save_format (BINARY), save_as_floats, true);
+
+              save_zchunk_binary_data (file, payload_buf.str ());
+
+              file.close ();
+            }
+          else
 #if defined (HAVE_ZLIB)
           if (use_zlib)
             {
@@ -1650,6 +1838,11 @@ modifies variable names if they are invalid Octave identifiers.
 @item -text
 Force Octave to assume the file is in Octave's text format.
 
+@item -zchunk
+Force Octave to assume the file is in Octave's chunked compressed binary
+format.  This option is only available if Octave was built with a link to
+the zlib libraries.
+
 @item  -v7.3
 @itemx -V7.3
 @itemx -7.3
@@ -1675,7 +1868,7 @@ Force Octave to assume the file is in @sc{matlab}'s version 6 binary format.
 Force Octave to assume the file is in @sc{matlab}'s version 4 binary format.
 
 @end table
-@seealso{save, dlmwrite, csvwrite, fwrite}
+@seealso{save, matfile, dlmwrite, csvwrite, fwrite}
 @end deftypefn */)
 {
   load_save_system& load_save_sys = interp.get_load_save_system ();
@@ -1722,7 +1915,12 @@ is 0, otherwise return the output in a character string.
 
 @table @code
 @item -append
-Append to the destination instead of overwriting.
+Append to the destination instead of overwriting.  For the @sc{hdf5}
+format, a variable that is already present in the file is replaced by its
+new value while the other variables are left untouched, so long-running
+jobs can checkpoint individual variables incrementally.  (The space used
+by replaced values is only reclaimed when the file is rewritten, e.g.,
+with the @code{h5repack} utility.)
 
 @item -ascii
 Save a matrix in a text file without a header or any other information.  The
@@ -1784,12 +1982,22 @@ Save the data in @sc{matlab}'s v6 binary data format.
 @itemx -mat4-binary
 Save the data in @sc{matlab}'s v4 binary data format.
 
+@item -zchunk
+Save the data in Octave's binary data format, compressed in independent
+chunks.  The chunks are compressed when saving and decompressed when loading
+in parallel on systems with multiple processors, which makes this format
+considerably faster than @option{-zip} for large workspaces.  This option is
+only available if Octave was built with a link to the zlib libraries.
+
 @item  -zip
 @itemx -z
 Use the gzip algorithm to compress the file.  This works on files that are
 compressed with gzip outside of Octave, and gzip can also be used to convert
-the files for backward compatibility.  This option is only available if Octave
-was built with a link to the zlib libraries.
+the files for backward compatibility.  When combined with the @option{-hdf5}
+format, large arrays are instead stored as chunked datasets compressed with
+the @sc{hdf5} deflate filter, which remain readable by any @sc{hdf5} tool
+and may be combined with @option{-append}.  This option is only available
+if Octave was built with a link to the zlib libraries.
 @end table
 
 The list of variables to save may use wildcard patterns (glob patterns)
@@ -1927,12 +2135,62 @@ dlmread, csvread, fread}
 %! end_unwind_protect
 %! assert (struc, struc2);
 
+## Save and load with "-zchunk"
+%!testif HAVE_ZLIB
+%! A = A2 = "foobar";  # normal string
+%! B = B2 = single (pi);  # single scalar
+%! C = C2 = rand (10, 10);  # double matrix
+%! D = D2 = {"foo", "bar"};  # cell string
+%! E = E2 = int32 (1:10);  # integer vector
+%! F = F2 = struct ("a", 1, "b", "two");  # struct
+%! fname = tempname ();
+%! unwind_protect
+%!   save (fname, "A", "B", "C", "D", "E", "F", "-zchunk");
+%!   clear ("A", "B", "C", "D", "E", "F");
+%!   load (fname);  # format is detected from the file magic
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+%! assert (A, A2);
+%! assert (B, B2);
+%! assert (C, C2);
+%! assert (D, D2);
+%! assert (E, E2);
+%! assert (F, F2);
+
 ## Test input validation
 %!testif HAVE_ZLIB <*59225>
 %! fname = tempname ();
 %! x = 1;
 %! fail ('save ("-append", "-zip", "-binary", fname, "x")',
 %!       "-append and -zip options .* with a text format");
+
+%!testif HAVE_ZLIB
+%! fname = tempname ();
+%! x = 1;
+%! fail ('save ("-append", "-zchunk", fname, "x")',
+%!       "appending to -zchunk files is not implemented");
+
+## Incremental checkpointing with "-hdf5 -append": new variables are
+## added and existing ones are replaced without touching the rest.
+%!testif HAVE_HDF5, HAVE_ZLIB
+%! A = rand (50, 50);
+%! B = 1;
+%! fname = [tempname(), ".h5"];
+%! unwind_protect
+%!   save (fname, "A", "-hdf5", "-zip");
+%!   B = 2;
+%!   save (fname, "B", "-hdf5", "-zip", "-append");
+%!   B = 3;
+%!   save (fname, "B", "-hdf5", "-zip", "-append");
+%!   A2 = A;  B2 = B;
+%!   clear ("A", "B");
+%!   load (fname);
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+%! assert (A, A2);
+%! assert (B, 3);
 */
 
 DEFMETHOD (crash_dumps_octave_core, interp, args, nargout,
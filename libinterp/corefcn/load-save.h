@@ -53,6 +53,7 @@ public:
   {
     TEXT,
     BINARY,
+    BINARY_ZCHUNK,
     MAT_ASCII,
     MAT_BINARY,
     MAT5_BINARY,
@@ -0,0 +1,504 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Append-only binary log writer with a background flush thread.  The
+// interpreter thread copies records into a large ring buffer and
+// returns immediately; a worker thread drains the ring to the FILE
+// with batched fwrite calls, so a slow disk stalls the producer only
+// when the ring is completely full.  This sits beside the prefetch
+// machinery in c-file-ptr-stream.cc: that overlaps reads with
+// consumer work, this overlaps writes with producer work.
+//
+// The worker writes straight out of the ring without holding the
+// lock; that region cannot be overwritten because the producer never
+// advances into unconsumed bytes, and the head only moves after the
+// fwrite commits.
+
+class log_writer
+{
+public:
+
+  log_writer (FILE *f, std::size_t bufsize)
+    : m_f (f), m_buf (new char [bufsize]), m_cap (bufsize),
+      m_head (0), m_size (0), m_draining (false), m_stop (false),
+      m_write_error (false),
+      m_worker (&log_writer::drain_loop, this)
+  { }
+
+  OCTAVE_DISABLE_CONSTRUCT_COPY_MOVE (log_writer)
+
+  ~log_writer ()
+  {
+    close ();
+  }
+
+  // Copy N bytes into the ring, blocking only while it is full.
+
+  void write (const char *s, std::size_t n)
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    while (n > 0)
+      {
+        while (m_size == m_cap && ! m_write_error)
+          m_can_write.wait (lock);
+
+        if (m_write_error)
+          return;
+
+        std::size_t tail = (m_head + m_size) % m_cap;
+        std::size_t room = m_cap - m_size;
+        std::size_t contig = m_cap - tail;
+        std::size_t take = n;
+
+        if (take > room)
+          take = room;
+        if (take > contig)
+          take = contig;
+
+        std::memcpy (m_buf.get () + tail, s, take);
+
+        m_size += take;
+        s += take;
+        n -= take;
+
+        m_can_drain.notify_one ();
+      }
+  }
+
+  // Wait for the ring to drain, then push the stdio buffer out too.
+
+  void flush ()
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    while ((m_size > 0 || m_draining) && ! m_write_error)
+      m_can_write.wait (lock);
+
+    if (! m_write_error && m_f && std::fflush (m_f) != 0)
+      m_write_error = true;
+  }
+
+  // Drain, stop the worker, and close the FILE.  Safe to call twice.
+
+  void close ()
+  {
+    {
+      std::lock_guard<std::mutex> lock (m_mtx);
+
+      if (! m_f)
+        return;
+
+      m_stop = true;
+    }
+
+    m_can_drain.notify_all ();
+
+    if (m_worker.joinable ())
+      m_worker.join ();
+
+    if (std::fclose (m_f) != 0)
+      m_write_error = true;
+
+    m_f = nullptr;
+  }
+
+  bool write_error () const { return m_write_error; }
+
+  std::size_t buffer_size () const { return m_cap; }
+
+private:
+
+  void drain_loop ()
+  {
+    std::unique_lock<std::mutex> lock (m_mtx);
+
+    while (true)
+      {
+        while (m_size == 0 && ! m_stop)
+          m_can_drain.wait (lock);
+
+        if (m_size == 0 && m_stop)
+          break;
+
+        std::size_t contig = m_cap - m_head;
+        std::size_t take = (m_size < contig ? m_size : contig);
+        char *src = m_buf.get () + m_head;
+
+        m_draining = true;
+
+        lock.unlock ();
+
+        std::size_t wrote = std::fwrite (src, 1, take, m_f);
+
+        lock.lock ();
+
+        m_draining = false;
+
+        m_head = (m_head + wrote) % m_cap;
+        m_size -= wrote;
+
+        if (wrote < take)
+          {
+            // Disk error: unblock everyone and give up; the producer
+            // reports it on the next flush or close.
+            m_write_error = true;
+            m_size = 0;
+          }
+
+        m_can_write.notify_all ();
+      }
+  }
+
+  FILE *m_f;
+
+  std::unique_ptr<char []> m_buf;
+
+  std::size_t m_cap;
+
+  // Read position and byte count; the write position is
+  // (m_head + m_size) % m_cap.
+  std::size_t m_head;
+  std::size_t m_size;
+
+  bool m_draining;
+  bool m_stop;
+  bool m_write_error;
+
+  std::mutex m_mtx;
+
+  std::condition_variable m_can_drain;
+  std::condition_variable m_can_write;
+
+  std::thread m_worker;
+};
+
+// Open writers, keyed by the small integer handle handed to scripts.
+// The map's destructor closes (and therefore drains) anything still
+// open at interpreter exit.
+
+static std::map<octave_idx_type, std::shared_ptr<log_writer>> writer_map;
+
+static octave_idx_type next_writer_id = 1;
+
+static std::shared_ptr<log_writer>
+lookup_writer (const octave_value& id_arg, const char *who)
+{
+  octave_idx_type id = id_arg.xidx_type_value ("%s: ID must be an integer", who);
+
+  auto it = writer_map.find (id);
+
+  if (it == writer_map.end ())
+    error ("%s: invalid log writer id %" OCTAVE_IDX_TYPE_FORMAT, who, id);
+
+  return it->second;
+}
+
+// Append VAL's data in its native binary layout, like fwrite with the
+// precision matching the class of VAL.
+
+static void
+append_value (log_writer& lw, const octave_value& val, const char *who)
+{
+  if (val.iscomplex ())
+    error ("%s: complex values are not supported", who);
+
+  if (val.is_char_matrix () || val.is_string ())
+    {
+      const charNDArray a = val.char_array_value ();
+      lw.write (a.data (), a.numel ());
+    }
+  else if (val.islogical ())
+    {
+      const boolNDArray a = val.bool_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * sizeof (bool));
+    }
+  else if (val.is_int8_type ())
+    {
+      const int8NDArray a = val.int8_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()), a.numel ());
+    }
+  else if (val.is_uint8_type ())
+    {
+      const uint8NDArray a = val.uint8_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()), a.numel ());
+    }
+  else if (val.is_int16_type ())
+    {
+      const int16NDArray a = val.int16_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * 2);
+    }
+  else if (val.is_uint16_type ())
+    {
+      const uint16NDArray a = val.uint16_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * 2);
+    }
+  else if (val.is_int32_type ())
+    {
+      const int32NDArray a = val.int32_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * 4);
+    }
+  else if (val.is_uint32_type ())
+    {
+      const uint32NDArray a = val.uint32_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * 4);
+    }
+  else if (val.is_int64_type ())
+    {
+      const int64NDArray a = val.int64_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * 8);
+    }
+  else if (val.is_uint64_type ())
+    {
+      const uint64NDArray a = val.uint64_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * 8);
+    }
+  else if (val.is_single_type ())
+    {
+      const FloatNDArray a = val.float_array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * sizeof (float));
+    }
+  else if (val.isnumeric ())
+    {
+      const NDArray a = val.array_value ();
+      lw.write (reinterpret_cast<const char *> (a.data ()),
+                a.numel () * sizeof (double));
+    }
+  else
+    error ("%s: unsupported data type '%s'",
+           who, val.class_name ().c_str ());
+}
+
+DEFUN (logwriter_open, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{id} =} logwriter_open (@var{file})
+@deftypefnx {} {@var{id} =} logwriter_open (@var{file}, @var{bufsize})
+Open @var{file} for buffered append-only binary logging and return a
+handle for use with @code{logwriter_write}.
+
+Data passed to @code{logwriter_write} is copied into a ring buffer of
+@var{bufsize} bytes (default 8 megabytes) and written to disk by a
+background thread, so the writing script stalls only if it produces
+data faster than the disk can absorb it for long enough to fill the
+buffer.  This is meant for data-capture loops where an @code{fwrite}
+stalling on disk latency would drop samples.
+
+The file is opened in binary append mode and created if necessary.
+@seealso{logwriter_write, logwriter_flush, logwriter_close, fopen}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+
+  std::string name
+    = args(0).xstring_value ("logwriter_open: FILE must be a string");
+
+  octave_idx_type bufsize = 8 * 1024 * 1024;
+
+  if (nargin == 2)
+    {
+      bufsize
+        = args(1).xidx_type_value ("logwriter_open: BUFSIZE must be a positive integer");
+
+      if (bufsize < 1)
+        error ("logwriter_open: BUFSIZE must be a positive integer");
+    }
+
+  FILE *f = std::fopen (name.c_str (), "ab");
+
+  if (! f)
+    error ("logwriter_open: unable to open '%s' for writing", name.c_str ());
+
+  octave_idx_type id = next_writer_id++;
+
+  writer_map[id]
+    = std::make_shared<log_writer> (f, static_cast<std::size_t> (bufsize));
+
+  return ovl (static_cast<double> (id));
+}
+
+DEFUN (logwriter_write, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} logwriter_write (@var{id}, @var{data}, @dots{})
+Append the binary contents of each @var{data} argument to the log
+writer @var{id} opened with @code{logwriter_open}.
+
+Each argument is written in its native binary layout, like
+@code{fwrite} with the precision matching its class, and multiple
+arguments are written back to back, so one call can emit a mixed
+record such as a header, a timestamp, and a block of samples:
+
+@example
+logwriter_write (id, uint32 (count), t, samples);
+@end example
+
+The call returns as soon as the data has been copied into the ring
+buffer; it blocks only when the buffer is full.  Character, logical,
+integer, single, and double data are supported.
+@seealso{logwriter_open, logwriter_flush, logwriter_close}
+@end deftypefn */)
+{
+  if (args.length () < 2)
+    print_usage ();
+
+  std::shared_ptr<log_writer> lw
+    = lookup_writer (args(0), "logwriter_write");
+
+  for (int i = 1; i < args.length (); i++)
+    append_value (*lw, args(i), "logwriter_write");
+
+  if (lw->write_error ())
+    error ("logwriter_write: write error on log file");
+
+  return ovl ();
+}
+
+DEFUN (logwriter_flush, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} logwriter_flush (@var{id})
+Block until all data queued on log writer @var{id} has been handed to
+the operating system.
+
+A write error detected by the background thread is reported here (or
+at @code{logwriter_close}).
+@seealso{logwriter_write, logwriter_close}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  std::shared_ptr<log_writer> lw
+    = lookup_writer (args(0), "logwriter_flush");
+
+  lw->flush ();
+
+  if (lw->write_error ())
+    error ("logwriter_flush: write error on log file");
+
+  return ovl ();
+}
+
+DEFUN (logwriter_close, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} logwriter_close (@var{id})
+Drain and close log writer @var{id}.
+
+Any writer still open when the interpreter exits is drained and
+closed automatically.
+@seealso{logwriter_open}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  std::shared_ptr<log_writer> lw
+    = lookup_writer (args(0), "logwriter_close");
+
+  lw->close ();
+
+  bool failed = lw->write_error ();
+
+  writer_map.erase (args(0).idx_type_value ());
+
+  if (failed)
+    error ("logwriter_close: write error on log file");
+
+  return ovl ();
+}
+
+/*
+%!test
+%! tmp = tempname ();
+%! unwind_protect
+%!   id = logwriter_open (tmp);
+%!   d = [1.5, -2.25, pi];
+%!   n = uint32 (42);
+%!   c = "hdr";
+%!   logwriter_write (id, c, n, d);
+%!   logwriter_flush (id);
+%!   logwriter_close (id);
+%!   fid = fopen (tmp, "rb");
+%!   assert (char (fread (fid, 3, "char")'), c);
+%!   assert (uint32 (fread (fid, 1, "uint32")), n);
+%!   assert (fread (fid, 3, "double")', d);
+%!   assert (isempty (fread (fid)));
+%!   fclose (fid);
+%! unwind_protect_cleanup
+%!   unlink (tmp);
+%! end_unwind_protect
+
+%!test
+%! ## small ring buffer forces wrap-around and producer blocking
+%! tmp = tempname ();
+%! unwind_protect
+%!   id = logwriter_open (tmp, 64);
+%!   d = 1:1000;
+%!   for i = 1:10
+%!     logwriter_write (id, d);
+%!   endfor
+%!   logwriter_close (id);
+%!   fid = fopen (tmp, "rb");
+%!   x = fread (fid, Inf, "double")';
+%!   fclose (fid);
+%!   assert (x, repmat (d, 1, 10));
+%! unwind_protect_cleanup
+%!   unlink (tmp);
+%! end_unwind_protect
+
+%!error <invalid log writer id> logwriter_write (-1, 1)
+%!error <FILE must be a string> logwriter_open (1)
+*/
+
+OCTAVE_END_NAMESPACE(octave)
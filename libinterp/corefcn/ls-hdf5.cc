@@ -86,6 +86,44 @@ check_hdf5_id_value (octave_hdf5_id id, const char *who)
 
 #endif
 
+// The size in bytes of the HDF5 raw data chunk cache used for each
+// file opened by load or save, set with the hdf5_chunk_cache_size
+// function below.  Zero means keep the (small) HDF5 default.
+
+static int Vhdf5_chunk_cache_size = 0;
+
+// If true, hdf5_dataset_creation_plist requests chunked, compressed
+// dataset storage.  Enabled while saving with the -zip option.
+
+static bool save_compressed_datasets = false;
+
+// Return a file access property list applying the configured chunk
+// cache size, or octave_H5P_DEFAULT if nothing was configured.
+
+static hid_t
+make_file_access_plist ()
+{
+  if (Vhdf5_chunk_cache_size <= 0)
+    return octave_H5P_DEFAULT;
+
+  hid_t fapl_id = H5Pcreate (H5P_FILE_ACCESS);
+
+  if (fapl_id < 0)
+    return octave_H5P_DEFAULT;
+
+  // The number of hash slots should be a prime roughly 10 to 100
+  // times the number of chunks that fit in the cache; the chunk size
+  // is not known here, so use a generous fixed value.
+
+  if (H5Pset_cache (fapl_id, 0, 10007, Vhdf5_chunk_cache_size, 0.75) < 0)
+    {
+      H5Pclose (fapl_id);
+      return octave_H5P_DEFAULT;
+    }
+
+  return fapl_id;
+}
+
 hdf5_fstreambase::hdf5_fstreambase (const char *name, int mode, int /* prot */)
   : file_id (-1), current_item (-1)
 {
@@ -152,16 +190,25 @@ hdf5_fstreambase::open_create (const char *name, int mode)
   const char *fname = ascii_fname_str.c_str ();
 #  endif
 
+  hid_t fapl_id = make_file_access_plist ();
+
+  octave::unwind_action close_fapl
+    ([fapl_id] ()
+     {
+       if (fapl_id != octave_H5P_DEFAULT)
+         H5Pclose (fapl_id);
+     });
+
   if (mode & std::ios::in)
-    file_id = H5Fopen (fname, H5F_ACC_RDONLY, octave_H5P_DEFAULT);
+    file_id = H5Fopen (fname, H5F_ACC_RDONLY, fapl_id);
   else if (mode & std::ios::out)
     {
       if (mode & std::ios::app && H5Fis_hdf5 (fname) > 0)
-        file_id = H5Fopen (fname, H5F_ACC_RDWR, octave_H5P_DEFAULT);
+        file_id = H5Fopen (fname, H5F_ACC_RDWR, fapl_id);
       else
 #  if defined (HAVE_HDF5_UTF8)
         file_id = H5Fcreate (fname, H5F_ACC_TRUNC, octave_H5P_DEFAULT,
-                             octave_H5P_DEFAULT);
+                             fapl_id);
 #  else
         {
           // Check whether file already exists
@@ -171,7 +218,7 @@ hdf5_fstreambase::open_create (const char *name, int mode)
             {
               // Use the existing file
               file_id = H5Fcreate (fname, H5F_ACC_TRUNC,
-                                   octave_H5P_DEFAULT, octave_H5P_DEFAULT);
+                                   octave_H5P_DEFAULT, fapl_id);
               if (file_id < 0)
                 std::ios::setstate (std::ios::badbit);
 
@@ -186,7 +233,7 @@ hdf5_fstreambase::open_create (const char *name, int mode)
             {
               // No non-ASCII characters
               file_id = H5Fcreate (name, H5F_ACC_TRUNC, octave_H5P_DEFAULT,
-                                   octave_H5P_DEFAULT);
+                                   fapl_id);
               if (file_id < 0)
                 std::ios::setstate (std::ios::badbit);
 
@@ -221,7 +268,7 @@ hdf5_fstreambase::open_create (const char *name, int mode)
           // Open file at final location
           ascii_fname_str = octave::sys::get_ASCII_filename (fname_str);
           ascii_fname = ascii_fname_str.c_str ();
-          file_id = H5Fopen (ascii_fname, H5F_ACC_RDWR, octave_H5P_DEFAULT);
+          file_id = H5Fopen (ascii_fname, H5F_ACC_RDWR, fapl_id);
         }
 #  endif
     }
@@ -1397,6 +1444,91 @@ save_type_to_hdf5 (save_type st)
 #endif
 }
 
+void
+hdf5_set_save_compression (bool enable)
+{
+#if defined (HAVE_HDF5)
+
+  save_compressed_datasets = enable;
+
+#else
+  octave_unused_parameter (enable);
+
+  err_disabled_feature ("hdf5_set_save_compression", "HDF5");
+#endif
+}
+
+octave_hdf5_id
+hdf5_dataset_creation_plist (octave_hdf5_id space_id)
+{
+#if defined (HAVE_HDF5) && defined (HAVE_HDF5_18)
+
+  if (! save_compressed_datasets)
+    return octave_H5P_DEFAULT;
+
+  if (H5Zfilter_avail (H5Z_FILTER_DEFLATE) <= 0)
+    return octave_H5P_DEFAULT;
+
+  int rank = H5Sget_simple_extent_ndims (space_id);
+
+  if (rank < 1)
+    return octave_H5P_DEFAULT;
+
+  OCTAVE_LOCAL_BUFFER (hsize_t, hdims, rank);
+  OCTAVE_LOCAL_BUFFER (hsize_t, cdims, rank);
+
+  if (H5Sget_simple_extent_dims (space_id, hdims, nullptr) < 0)
+    return octave_H5P_DEFAULT;
+
+  // Aim for chunks of about 128k elements (one megabyte of doubles):
+  // keep whole trailing (fastest-varying) dimensions and split the
+  // slowest dimension that no longer fits.
+
+  const hsize_t max_chunk_nelem = 128 * 1024;
+
+  hsize_t nelem = 1;
+
+  for (int i = rank - 1; i >= 0; i--)
+    {
+      if (hdims[i] == 0)
+        return octave_H5P_DEFAULT;
+
+      if (nelem >= max_chunk_nelem)
+        cdims[i] = 1;
+      else
+        {
+          hsize_t want = max_chunk_nelem / nelem;
+          cdims[i] = (hdims[i] < want ? hdims[i] : want);
+        }
+
+      nelem *= cdims[i];
+    }
+
+  hid_t plist_id = H5Pcreate (H5P_DATASET_CREATE);
+
+  if (plist_id < 0)
+    return octave_H5P_DEFAULT;
+
+  // Shuffling the bytes of each element before deflating markedly
+  // improves the compression of numeric data.
+
+  if (H5Pset_chunk (plist_id, rank, cdims) < 0
+      || H5Pset_shuffle (plist_id) < 0
+      || H5Pset_deflate (plist_id, 6) < 0)
+    {
+      H5Pclose (plist_id);
+      return octave_H5P_DEFAULT;
+    }
+
+  return plist_id;
+
+#else
+  octave_unused_parameter (space_id);
+
+  return octave_H5P_DEFAULT;
+#endif
+}
+
 // Add the data from TC to the HDF5 location loc_id, which could
 // be either a file or a group within a file.  Return true if
 // successful.  This function calls itself recursively for lists
@@ -1424,6 +1556,15 @@ add_hdf5_data (octave_hdf5_id loc_id, const octave_value& tc,
 
   std::string t = val.type_name ();
 #if defined (HAVE_HDF5_18)
+  // When appending a new checkpoint of a variable that is already in
+  // the file, unlink the old value first so the save replaces it
+  // instead of failing.  (The space used by the old value is not
+  // reclaimed until the file is repacked, but the other variables in
+  // the file do not have to be rewritten.)
+  if (H5Lexists (loc_id, name.c_str (), octave_H5P_DEFAULT) > 0
+      && H5Ldelete (loc_id, name.c_str (), octave_H5P_DEFAULT) < 0)
+    goto error_cleanup;
+
   data_id = H5Gcreate (loc_id, name.c_str (), octave_H5P_DEFAULT,
                        octave_H5P_DEFAULT, octave_H5P_DEFAULT);
 #else
@@ -1516,4 +1657,35 @@ save_hdf5_data (std::ostream& os, const octave_value& tc,
 #endif
 }
 
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+DEFUN (hdf5_chunk_cache_size, args, nargout,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{val} =} hdf5_chunk_cache_size ()
+@deftypefnx {} {@var{old_val} =} hdf5_chunk_cache_size (@var{new_val})
+@deftypefnx {} {@var{old_val} =} hdf5_chunk_cache_size (@var{new_val}, "local")
+Query or set the internal variable that specifies the size in bytes of
+the @sc{hdf5} raw data chunk cache used for each file opened by
+@code{load} or @code{save}.
+
+The chunk cache only affects files with chunked datasets, such as those
+written by @code{save -hdf5 -zip}.  The default value is 0, which keeps
+the @sc{hdf5} library default (currently one megabyte).  Raising the
+value so that the cache holds several chunks can speed up repeated
+partial reads and writes of large compressed datasets.
+
+When called from inside a function with the @qcode{"local"} option, the
+variable is changed locally for the function and any subroutines it calls.
+The original variable value is restored when exiting the function.
+
+@seealso{save, load, save_default_options}
+@end deftypefn */)
+{
+  return set_internal_variable (Vhdf5_chunk_cache_size, args, nargout,
+                                "hdf5_chunk_cache_size", 0,
+                                std::numeric_limits<int>::max ());
+}
+
+OCTAVE_END_NAMESPACE(octave)
+
 #endif
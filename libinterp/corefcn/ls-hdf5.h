@@ -161,6 +161,22 @@ save_hdf5_data (std::ostream& os, const octave_value& tc,
                 const std::string& name, const std::string& doc,
                 bool mark_global, bool save_as_floats);
 
+// If ENABLE is true, datasets subsequently created through
+// hdf5_dataset_creation_plist are chunked and compressed.
+
+extern OCTINTERP_API void
+hdf5_set_save_compression (bool enable);
+
+// Return a dataset creation property list for a dataset with the
+// dataspace SPACE_ID, requesting chunked, compressed storage when
+// that has been enabled for the current save operation and is
+// possible for the given dataspace, and octave_H5P_DEFAULT otherwise.
+// The caller must close the returned property list with H5Pclose if
+// it is not octave_H5P_DEFAULT.
+
+extern OCTINTERP_API octave_hdf5_id
+hdf5_dataset_creation_plist (octave_hdf5_id space_id);
+
 extern OCTINTERP_API bool
 hdf5_check_attr (octave_hdf5_id loc_id, const char *attr_name);
 
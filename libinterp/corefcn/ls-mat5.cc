@@ -47,6 +47,8 @@
 #include "mach-info.h"
 #include "oct-env.h"
 #include "oct-locbuf.h"
+#include "oct-mmap.h"
+#include "oct-parallel.h"
 #include "oct-time.h"
 #include "quit.h"
 #include "str-vec.h"
@@ -253,6 +255,67 @@ read_mat5_binary_data (std::istream& is, float *data,
     }
 }
 
+// Release hook for array storage adopted from map_mat5_real_data.
+
+template <typename T>
+static void
+release_mapped_data (T *data, std::size_t len)
+{
+  octave::sys::mapped_file::release_range (data, len * sizeof (T));
+}
+
+// Try to use the bytes of the real data subelement that IS is
+// positioned at directly as the storage of RE, by mapping them from
+// the input file instead of copying them.  This is only possible when
+// the element bytes in the file already have the in-memory layout
+// (native type NATIVE_TYPE, no byte swapping) and the stream reads
+// from a mapping of the file.  The pages are mapped copy-on-write, so
+// unmodified data stays shared with every other process loading the
+// same file, and the stream position is left untouched.  Return true
+// if RE was set up this way.
+
+template <typename ArrayT>
+static bool
+map_mat5_real_data (std::istream& is, ArrayT& re, const dim_vector& dims,
+                    octave_idx_type nelem, bool swap, int32_t type,
+                    enum mat5_data_type native_type,
+                    octave::mach_info::float_format flt_fmt)
+{
+  typedef typename ArrayT::element_type T;
+
+  // Below this size the bookkeeping of one mapping per array costs
+  // more than the copy it saves.
+
+  static const octave_idx_type min_mapped_bytes = 64 * 1024;
+
+  if (swap
+      || static_cast<enum mat5_data_type> (type) != native_type
+      || flt_fmt != octave::mach_info::native_float_format ()
+      || nelem * static_cast<octave_idx_type> (sizeof (T)) < min_mapped_bytes)
+    return false;
+
+  auto *ms = dynamic_cast<octave::sys::imapstream *> (&is);
+
+  if (! ms)
+    return false;
+
+  std::streamoff off = ms->tellg ();
+
+  if (off < 0 || off % alignof (T) != 0)
+    return false;
+
+  void *data = ms->file ().map_range (static_cast<std::size_t> (off),
+                                      nelem * sizeof (T));
+
+  if (! data)
+    return false;
+
+  re = ArrayT (Array<T> (static_cast<T *> (data), dims,
+                         release_mapped_data<T>));
+
+  return true;
+}
+
 template <typename T>
 void
 read_mat5_integer_data (std::istream& is, T *m, octave_idx_type count,
@@ -466,6 +529,161 @@ read_int (std::istream& is, bool swap, int32_t& val)
     swap_bytes<4> (&val);
 }
 
+// Parse the leading subelements (array flags, dimensions, array name)
+// of a miMATRIX element from IS and return the array name, or an
+// empty string if the layout is not understood.
+
+static std::string
+read_mat5_matrix_name (std::istream& is, bool swap)
+{
+  int32_t type, len;
+  bool is_small_data_element;
+
+  // array flags subelement
+  if (read_mat5_tag (is, swap, type, len, is_small_data_element)
+      || type != miUINT32 || len != 8 || is_small_data_element)
+    return "";
+
+  int32_t flags;
+  read_int (is, swap, flags);
+
+  arrayclasstype arrayclass = static_cast<arrayclasstype> (flags & 0xff);
+
+  int32_t tmp_nzmax;
+  read_int (is, swap, tmp_nzmax);
+
+  // dimensions array subelement
+  if (arrayclass != MAT_FILE_WORKSPACE_CLASS)
+    {
+      int32_t dim_len;
+
+      if (read_mat5_tag (is, swap, type, dim_len, is_small_data_element)
+          || type != miINT32)
+        return "";
+
+      std::streampos tmp_pos = is.tellg ();
+      is.seekg (tmp_pos + static_cast<std::streamoff>
+                (READ_PAD (is_small_data_element, dim_len)));
+    }
+
+  // array name subelement
+  if (read_mat5_tag (is, swap, type, len, is_small_data_element)
+      || ! INT8 (type) || len <= 0)
+    return "";
+
+  OCTAVE_LOCAL_BUFFER (char, name, len+1);
+
+  if (! is.read (name, len))
+    return "";
+
+  name[len] = '\0';
+
+  return std::string (name);
+}
+
+std::string
+peek_mat5_element_name (std::istream& is, bool swap)
+{
+  std::string retval;
+
+  std::streampos pos = is.tellg ();
+
+  if (pos == std::streampos (-1))
+    return retval;
+
+  int32_t type = 0;
+  int32_t element_length;
+  bool is_small_data_element;
+
+  if (! read_mat5_tag (is, swap, type, element_length,
+                       is_small_data_element))
+    {
+      if (type == miMATRIX)
+        retval = read_mat5_matrix_name (is, swap);
+#if defined (HAVE_ZLIB)
+      else if (type == miCOMPRESSED)
+        {
+          // Inflate just the beginning of the element; a fixed bound
+          // covers the array flags, the dimensions of any sensible
+          // array, and the up to 63 character name.
+
+          const int hdr_len = 256;
+
+          char inbuf[hdr_len];
+          char outbuf[hdr_len];
+
+          int in_len = (element_length < hdr_len ? element_length : hdr_len);
+
+          if (is.read (inbuf, in_len))
+            {
+              z_stream strm;
+              strm.zalloc = Z_NULL;
+              strm.zfree = Z_NULL;
+              strm.opaque = Z_NULL;
+              strm.next_in = reinterpret_cast<Bytef *> (inbuf);
+              strm.avail_in = in_len;
+              strm.next_out = reinterpret_cast<Bytef *> (outbuf);
+              strm.avail_out = hdr_len;
+
+              if (inflateInit (&strm) == Z_OK)
+                {
+                  int err = inflate (&strm, Z_SYNC_FLUSH);
+
+                  // Running out of input or output space is expected;
+                  // we only want the part that did inflate.
+                  if (err == Z_OK || err == Z_STREAM_END
+                      || err == Z_BUF_ERROR)
+                    {
+                      std::istringstream hdr_is
+                        (std::string (outbuf, hdr_len - strm.avail_out));
+
+                      // The inflated bytes begin with the miMATRIX tag.
+                      if (! read_mat5_tag (hdr_is, swap, type, element_length,
+                                           is_small_data_element)
+                          && type == miMATRIX)
+                        retval = read_mat5_matrix_name (hdr_is, swap);
+                    }
+
+                  inflateEnd (&strm);
+                }
+            }
+        }
+#endif
+    }
+
+  is.clear ();
+  is.seekg (pos);
+
+  return retval;
+}
+
+bool
+skip_mat5_binary_element (std::istream& is, bool swap)
+{
+  int32_t type = 0;
+  int32_t element_length;
+  bool is_small_data_element;
+
+  if (read_mat5_tag (is, swap, type, element_length, is_small_data_element))
+    return false;
+
+  // Compressed elements are written without tail padding; everything
+  // else is padded to an 8 byte boundary.
+
+  std::streamoff len;
+
+  if (is_small_data_element)
+    len = 4;
+  else if (type == miCOMPRESSED)
+    len = element_length;
+  else
+    len = READ_PAD (false, element_length);
+
+  is.seekg (len, std::ios::cur);
+
+  return static_cast<bool> (is);
+}
+
 // Extract one data element (scalar, matrix, string, etc.) from stream
 // IS and place it in TC, returning the name of the variable.
 //
@@ -1314,7 +1532,7 @@ read_mat5_binary_element (std::istream& is, const std::string& filename,
 
     case MAT_FILE_SINGLE_CLASS:
       {
-        FloatNDArray re (dims);
+        FloatNDArray re;
 
         // real data subelement
 
@@ -1323,11 +1541,18 @@ read_mat5_binary_element (std::istream& is, const std::string& filename,
         if (read_mat5_tag (is, swap, type, len, is_small_data_element))
           error ("load: reading matrix data for '%s'", retval.c_str ());
 
-        octave_idx_type n = re.numel ();
+        octave_idx_type n = dims.numel ();
         tmp_pos = is.tellg ();
-        read_mat5_binary_data (is, re.fortran_vec (), n, swap,
-                               static_cast<enum mat5_data_type> (type),
-                               flt_fmt);
+
+        if (imag
+            || ! map_mat5_real_data (is, re, dims, n, swap, type,
+                                     miSINGLE, flt_fmt))
+          {
+            re = FloatNDArray (dims);
+            read_mat5_binary_data (is, re.fortran_vec (), n, swap,
+                                   static_cast<enum mat5_data_type> (type),
+                                   flt_fmt);
+          }
 
         if (! is)
           error ("load: reading matrix data for '%s'", retval.c_str ());
@@ -1371,7 +1596,7 @@ read_mat5_binary_element (std::istream& is, const std::string& filename,
     case MAT_FILE_DOUBLE_CLASS:
     default:
       {
-        NDArray re (dims);
+        NDArray re;
 
         // real data subelement
 
@@ -1380,11 +1605,22 @@ read_mat5_binary_element (std::istream& is, const std::string& filename,
         if (read_mat5_tag (is, swap, type, len, is_small_data_element))
           error ("load: reading matrix data for '%s'", retval.c_str ());
 
-        octave_idx_type n = re.numel ();
+        octave_idx_type n = dims.numel ();
         tmp_pos = is.tellg ();
-        read_mat5_binary_data (is, re.fortran_vec (), n, swap,
-                               static_cast<enum mat5_data_type> (type),
-                               flt_fmt);
+
+        // A large plain double array whose bytes in the file already
+        // have the in-memory layout can adopt pages mapped from the
+        // file instead of copying them (see map_mat5_real_data).
+
+        if (logicalvar || imag || arrayclass != MAT_FILE_DOUBLE_CLASS
+            || ! map_mat5_real_data (is, re, dims, n, swap, type,
+                                     miDOUBLE, flt_fmt))
+          {
+            re = NDArray (dims);
+            read_mat5_binary_data (is, re.fortran_vec (), n, swap,
+                                   static_cast<enum mat5_data_type> (type),
+                                   flt_fmt);
+          }
 
         if (! is)
           error ("load: reading matrix data for '%s'", retval.c_str ());
@@ -2806,3 +3042,104 @@ save_mat5_binary_element (std::ostream& os,
 
   return true;
 }
+
+// Save VALS as compressed (-v7) MAT-file elements on OS.  The elements
+// are encoded one at a time on the calling thread, since encoding runs
+// interpreter code that is not safe to call concurrently, but the zlib
+// compression of the encoded buffers -- where nearly all of the time
+// goes for large workspaces -- is spread across OpenMP threads.  The
+// compressed elements are then written out in their original order.
+// Returns the number of elements written.
+
+std::size_t
+save_mat7_binary_elements (std::ostream& os,
+                           const std::vector<octave_value>& vals,
+                           const std::vector<std::string>& names,
+                           const std::vector<bool>& global_flags,
+                           bool save_as_floats)
+{
+#if defined (HAVE_ZLIB)
+
+  std::size_t n = vals.size ();
+
+  std::vector<std::string> encoded (n);
+  std::vector<bool> ok (n, false);
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      std::ostringstream buf;
+
+      ok[i] = save_mat5_binary_element (buf, vals[i], names[i],
+                                        global_flags[i], true,
+                                        save_as_floats, true);
+
+      if (ok[i])
+        encoded[i] = buf.str ();
+    }
+
+  std::vector<std::string> compressed (n);
+  std::vector<int> zerr (n, Z_OK);
+
+  int nthreads = octave::parallel_num_threads ();
+
+#if defined (_OPENMP)
+#  pragma omp parallel for schedule (dynamic) num_threads (nthreads)
+#endif
+  for (std::size_t i = 0; i < n; i++)
+    {
+      if (! ok[i])
+        continue;
+
+      uLongf srcLen = encoded[i].length ();
+      uLongf destLen = compressBound (srcLen);
+
+      compressed[i].resize (destLen);
+
+      zerr[i] = compress (reinterpret_cast<Bytef *> (&compressed[i][0]),
+                          &destLen,
+                          reinterpret_cast<const Bytef *> (encoded[i].data ()),
+                          srcLen);
+
+      if (zerr[i] == Z_OK)
+        compressed[i].resize (destLen);
+    }
+
+  octave_unused_parameter (nthreads);
+
+  std::size_t saved = 0;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      if (! ok[i])
+        continue;
+
+      if (zerr[i] != Z_OK)
+        error ("save: error compressing data element");
+
+      write_mat5_tag (os, miCOMPRESSED,
+                      static_cast<octave_idx_type> (compressed[i].length ()));
+
+      os.write (compressed[i].data (), compressed[i].length ());
+
+      saved++;
+    }
+
+  return saved;
+
+#else
+
+  std::size_t n = vals.size ();
+
+  std::size_t saved = 0;
+
+  for (std::size_t i = 0; i < n; i++)
+    {
+      if (save_mat5_binary_element (os, vals[i], names[i], global_flags[i],
+                                    true, save_as_floats))
+        saved++;
+    }
+
+  return saved;
+
+#endif
+}
@@ -30,6 +30,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 class octave_value;
 
@@ -62,10 +63,29 @@ read_mat5_binary_file_header (std::istream& is, bool& swap,
 extern OCTINTERP_API std::string
 read_mat5_binary_element (std::istream& is, const std::string& filename,
                           bool swap, bool& global, octave_value& tc);
+
+// Return the name of the next data element in IS without consuming
+// it, or an empty string if the name cannot be determined cheaply.
+
+extern OCTINTERP_API std::string
+peek_mat5_element_name (std::istream& is, bool swap);
+
+// Advance IS past the next data element without decoding it.  Return
+// false if the stream cannot be positioned past the element.
+
+extern OCTINTERP_API bool
+skip_mat5_binary_element (std::istream& is, bool swap);
 extern OCTINTERP_API bool
 save_mat5_binary_element (std::ostream& os,
                           const octave_value& tc, const std::string& name,
                           bool mark_global, bool mat7_format,
                           bool save_as_floats, bool compressing = false);
 
+extern OCTINTERP_API std::size_t
+save_mat7_binary_elements (std::ostream& os,
+                           const std::vector<octave_value>& vals,
+                           const std::vector<std::string>& names,
+                           const std::vector<bool>& global_flags,
+                           bool save_as_floats);
+
 #endif
@@ -27,9 +27,16 @@
 #  include "config.h"
 #endif
 
+#include <cstring>
+
 #include <istream>
 #include <ostream>
 #include <string>
+#include <vector>
+
+#if defined (HAVE_ZLIB)
+#  include <zlib.h>
+#endif
 
 #include "byte-swap.h"
 #include "data-conv.h"
@@ -39,6 +46,7 @@
 #include "mach-info.h"
 #include "oct-env.h"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
 #include "oct-time.h"
 
 #include "defun.h"
@@ -375,3 +383,235 @@ save_binary_data (std::ostream& os, const octave_value& tc,
 
   return (os && success);
 }
+
+// Chunked compressed container around the binary format above.  The
+// file starts with the magic "Octave-1-Z" followed by an order
+// character ('L' or 'B') giving the byte order of the header words,
+// three uint64 words (uncompressed payload size, chunk size, number
+// of chunks) and a table of uint64 compressed chunk sizes.  The
+// chunks follow in order, each an independent zlib stream, so they
+// can be compressed and decompressed concurrently.  The payload is an
+// ordinary "Octave-1-L"/"Octave-1-B" binary stream, header included.
+
+static const char zchunk_binary_magic[] = "Octave-1-Z";
+
+static const int zchunk_binary_magic_len = 10;
+
+// One chunk per megabyte of payload keeps plenty of independent work
+// for the compression threads without bloating the chunk table.
+
+static const uint64_t zchunk_binary_chunk_size = 1024 * 1024;
+
+bool
+read_zchunk_binary_magic (std::istream& is)
+{
+  char magic[zchunk_binary_magic_len];
+
+  is.read (magic, zchunk_binary_magic_len);
+
+  return (is
+          && strncmp (magic, zchunk_binary_magic,
+                      zchunk_binary_magic_len) == 0);
+}
+
+#if defined (HAVE_ZLIB)
+
+static uint64_t
+read_zchunk_binary_word (std::istream& is, bool swap)
+{
+  uint64_t val = 0;
+
+  is.read (reinterpret_cast<char *> (&val), 8);
+
+  if (swap)
+    swap_bytes<8> (&val);
+
+  return val;
+}
+
+static void
+write_zchunk_binary_word (std::ostream& os, uint64_t val)
+{
+  os.write (reinterpret_cast<const char *> (&val), 8);
+}
+
+#endif
+
+void
+read_zchunk_binary_data (std::istream& is, std::string& payload,
+                         const std::string& filename)
+{
+#if defined (HAVE_ZLIB)
+
+  if (! read_zchunk_binary_magic (is))
+    error ("load: unable to read binary file '%s'", filename.c_str ());
+
+  char order = 0;
+  is.read (&order, 1);
+
+  bool swap;
+
+  if (order == 'L')
+    swap = octave::mach_info::words_big_endian ();
+  else if (order == 'B')
+    swap = ! octave::mach_info::words_big_endian ();
+  else
+    error ("load: unrecognized binary format!");
+
+  uint64_t total = read_zchunk_binary_word (is, swap);
+  uint64_t chunk_size = read_zchunk_binary_word (is, swap);
+  uint64_t nchunks = read_zchunk_binary_word (is, swap);
+
+  if (! is || chunk_size == 0
+      || nchunks != (total + chunk_size - 1) / chunk_size)
+    error ("load: '%s' is not a valid chunked binary file",
+           filename.c_str ());
+
+  std::vector<uint64_t> zlen (nchunks);
+  std::vector<uint64_t> zoff (nchunks);
+
+  // No chunk can compress to more than compressBound of its input, so
+  // larger table entries mean the file is corrupt; checking here also
+  // keeps a bad table from requesting an absurd allocation below.
+
+  uint64_t max_zlen = compressBound (chunk_size);
+
+  uint64_t ztotal = 0;
+
+  for (uint64_t j = 0; j < nchunks; j++)
+    {
+      zlen[j] = read_zchunk_binary_word (is, swap);
+
+      if (zlen[j] > max_zlen)
+        error ("load: '%s' is not a valid chunked binary file",
+               filename.c_str ());
+
+      zoff[j] = ztotal;
+      ztotal += zlen[j];
+    }
+
+  std::vector<char> zbuf (ztotal);
+
+  if (! is.read (zbuf.data (), ztotal))
+    error ("load: '%s' is not a valid chunked binary file",
+           filename.c_str ());
+
+  payload.resize (total);
+
+  char *dest = (total > 0 ? &payload[0] : nullptr);
+
+  // The chunks are independent zlib streams with known destination
+  // offsets, so they can be expanded concurrently straight into the
+  // preallocated payload.  Workers store their status instead of
+  // throwing.
+
+  std::vector<int> status (nchunks, Z_OK);
+
+  octave::chunked_parallel_for (nchunks, total,
+    [&] (octave_idx_type beg, octave_idx_type len)
+    {
+      for (octave_idx_type j = beg; j < beg + len; j++)
+        {
+          uint64_t off = j * chunk_size;
+          uLongf dest_len = (total - off < chunk_size
+                             ? total - off : chunk_size);
+          uLongf expected_len = dest_len;
+
+          int err = uncompress (reinterpret_cast<Bytef *> (dest + off),
+                                &dest_len,
+                                reinterpret_cast<const Bytef *> (zbuf.data ()
+                                                                 + zoff[j]),
+                                zlen[j]);
+
+          if (err == Z_OK && dest_len != expected_len)
+            err = Z_DATA_ERROR;
+
+          status[j] = err;
+        }
+    });
+
+  for (uint64_t j = 0; j < nchunks; j++)
+    if (status[j] != Z_OK)
+      error ("load: '%s' is not a valid chunked binary file",
+             filename.c_str ());
+
+#else
+
+  octave_unused_parameter (is);
+  octave_unused_parameter (payload);
+  octave_unused_parameter (filename);
+
+  err_disabled_feature ("load", "zlib");
+
+#endif
+}
+
+void
+save_zchunk_binary_data (std::ostream& os, const std::string& payload)
+{
+#if defined (HAVE_ZLIB)
+
+  uint64_t total = payload.length ();
+  uint64_t chunk_size = zchunk_binary_chunk_size;
+  uint64_t nchunks = (total + chunk_size - 1) / chunk_size;
+
+  std::vector<std::vector<Bytef>> chunks (nchunks);
+
+  // Compress the chunks in parallel; they are still written out in
+  // order.  Workers store their status instead of throwing.
+
+  std::vector<int> status (nchunks, Z_OK);
+
+  octave::chunked_parallel_for (nchunks, total,
+    [&] (octave_idx_type beg, octave_idx_type len)
+    {
+      for (octave_idx_type j = beg; j < beg + len; j++)
+        {
+          uint64_t off = j * chunk_size;
+          uLong src_len = (total - off < chunk_size
+                           ? total - off : chunk_size);
+          uLongf dest_len = compressBound (src_len);
+
+          chunks[j].resize (dest_len);
+
+          int err = compress2 (chunks[j].data (), &dest_len,
+                               reinterpret_cast<const Bytef *> (payload.data ()
+                                                                + off),
+                               src_len, Z_DEFAULT_COMPRESSION);
+
+          if (err == Z_OK)
+            chunks[j].resize (dest_len);
+
+          status[j] = err;
+        }
+    });
+
+  for (uint64_t j = 0; j < nchunks; j++)
+    if (status[j] != Z_OK)
+      error ("save: zlib error while compressing data");
+
+  os.write (zchunk_binary_magic, zchunk_binary_magic_len);
+
+  char order = (octave::mach_info::words_big_endian () ? 'B' : 'L');
+  os.write (&order, 1);
+
+  write_zchunk_binary_word (os, total);
+  write_zchunk_binary_word (os, chunk_size);
+  write_zchunk_binary_word (os, nchunks);
+
+  for (uint64_t j = 0; j < nchunks; j++)
+    write_zchunk_binary_word (os, chunks[j].size ());
+
+  for (uint64_t j = 0; j < nchunks; j++)
+    os.write (reinterpret_cast<const char *> (chunks[j].data ()),
+              chunks[j].size ());
+
+#else
+
+  octave_unused_parameter (os);
+  octave_unused_parameter (payload);
+
+  err_disabled_feature ("save", "zlib");
+
+#endif
+}
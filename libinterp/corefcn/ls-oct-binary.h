@@ -45,4 +45,16 @@ read_binary_data (std::istream& is, bool swap,
                   const std::string& filename, bool& global,
                   octave_value& tc, std::string& doc);
 
+// Chunked compressed container around the binary format above.
+
+extern OCTINTERP_API bool
+read_zchunk_binary_magic (std::istream& is);
+
+extern OCTINTERP_API void
+read_zchunk_binary_data (std::istream& is, std::string& payload,
+                         const std::string& filename);
+
+extern OCTINTERP_API void
+save_zchunk_binary_data (std::ostream& os, const std::string& payload);
+
 #endif
@@ -265,6 +265,16 @@ other than 2 and @var{msg} will contain additional information.
 You can use the function @code{lsode_options} to set optional
 parameters for @code{lsode}.
 
+Ensembles of independent systems (for example, one system integrated
+from many initial conditions in a parameter sweep) are best integrated
+as a single call with the states stacked into one long vector, so that
+@var{fcn} is evaluated once per step for the whole ensemble instead of
+once per system.  The combined Jacobian of such a stacked system is
+block diagonal; setting the options @qcode{"jacobian type"} to
+@qcode{"banded"} and the bandwidths to the size of one subsystem keeps
+the work and storage for the Jacobian proportional to the number of
+systems rather than quadratic in the total state size.
+
 See @nospell{Alan C. Hindmarsh},
 @cite{ODEPACK, A Systematized Collection of ODE Solvers},
 in Scientific Computing, @nospell{R. S. Stepleman}, editor, (1983)
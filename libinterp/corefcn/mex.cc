@@ -45,6 +45,7 @@
 #endif
 #include <set>
 #include <string>
+#include <type_traits>
 
 #include "f77-fcn.h"
 #include "lo-ieee.h"
@@ -1974,6 +1975,37 @@ protected:
 
     ELT_T *ppr = static_cast<ELT_T *> (m_pr);
 
+#if defined (OCTAVE_HAVE_STD_PMR_POLYMORPHIC_ALLOCATOR)
+
+    // The octave_int wrappers hold a single integer member of the
+    // same width as the plain integer type the mxArray stores, so for
+    // the integer classes the array can borrow the mxArray data just
+    // as the floating-point conversions above do.  The logical and
+    // char classes still copy: the element-wise assignment below also
+    // normalizes arbitrary nonzero mxLogical values to true, which a
+    // borrow would skip.
+
+    if (std::is_class<ARRAY_ELT_T>::value
+        && sizeof (ELT_T) == sizeof (ARRAY_ELT_T))
+      {
+        ARRAY_ELT_T *appr = reinterpret_cast<ARRAY_ELT_T *> (ppr);
+
+        if (current_mx_memory_resource == &the_mx_deleting_memory_resource)
+          {
+            octave::unwind_action act ([=] () { maybe_disown_ptr (m_pr); });
+
+            return octave_value (ARRAY_T (Array<ARRAY_ELT_T>
+                                          (appr, dv,
+                                           current_mx_memory_resource)));
+          }
+        else
+          return octave_value (ARRAY_T (Array<ARRAY_ELT_T>
+                                        (appr, dv,
+                                         current_mx_memory_resource)));
+      }
+
+#endif
+
     // Copy data instead of allowing the octave_value object to borrow
     // the mxArray object data.
 
@@ -47,6 +47,7 @@ COREFCN_INC = \
   %reldir%/help.h \
   %reldir%/hook-fcn.h \
   %reldir%/input.h \
+  %reldir%/interp-stats.h \
   %reldir%/interpreter.h \
   %reldir%/latex-text-renderer.h \
   %reldir%/load-path.h \
@@ -121,13 +122,18 @@ COREFCN_SRC = \
   %reldir%/__expint__.cc \
   %reldir%/__ftp__.cc \
   %reldir%/__gammainc__.cc \
+  %reldir%/__histc__.cc \
   %reldir%/__ichol__.cc \
   %reldir%/__ilu__.cc \
   %reldir%/__isprimelarge__.cc \
+  %reldir%/__kdtree__.cc \
   %reldir%/__lin_interpn__.cc \
   %reldir%/__magick_read__.cc \
+  %reldir%/__pcg__.cc \
   %reldir%/__pchip_deriv__.cc \
+  %reldir%/__pdist2__.cc \
   %reldir%/__qp__.cc \
+  %reldir%/__tdigest__.cc \
   %reldir%/amd.cc \
   %reldir%/auto-shlib.cc \
   %reldir%/balance.cc \
@@ -140,10 +146,12 @@ COREFCN_SRC = \
   %reldir%/ccolamd.cc \
   %reldir%/cdisplay.c \
   %reldir%/cellfun.cc \
+  %reldir%/channel.cc \
   %reldir%/chol.cc \
   %reldir%/coct-hdf5-types.c \
   %reldir%/colamd.cc \
   %reldir%/colloc.cc \
+  %reldir%/coltable.cc \
   %reldir%/conv2.cc \
   %reldir%/daspk.cc \
   %reldir%/dasrt.cc \
@@ -195,6 +203,7 @@ COREFCN_SRC = \
   %reldir%/input.cc \
   %reldir%/interpreter-private.cc \
   %reldir%/interpreter.cc \
+  %reldir%/interpstats.cc \
   %reldir%/inv.cc \
   %reldir%/jsondecode.cc \
   %reldir%/jsonencode.cc \
@@ -202,6 +211,7 @@ COREFCN_SRC = \
   %reldir%/latex-text-renderer.cc \
   %reldir%/load-path.cc \
   %reldir%/load-save.cc \
+  %reldir%/log-writer.cc \
   %reldir%/lookup.cc \
   %reldir%/ls-ascii-helper.cc \
   %reldir%/ls-hdf5.cc \
@@ -234,6 +244,7 @@ COREFCN_SRC = \
   %reldir%/oct-tex-parser.yy \
   %reldir%/ordqz.cc \
   %reldir%/ordschur.cc \
+  %reldir%/page-ops.cc \
   %reldir%/pager.cc \
   %reldir%/pinv.cc \
   %reldir%/pow2.cc \
@@ -249,8 +260,11 @@ COREFCN_SRC = \
   %reldir%/rcond.cc \
   %reldir%/regexp.cc \
   %reldir%/schur.cc \
+  %reldir%/set-hash.cc \
   %reldir%/settings.cc \
+  %reldir%/shmem.cc \
   %reldir%/sighandlers.cc \
+  %reldir%/sockstream.cc \
   %reldir%/sparse-xdiv.cc \
   %reldir%/sparse-xpow.cc \
   %reldir%/sparse.cc \
@@ -27,7 +27,9 @@
 #  include "config.h"
 #endif
 
+#include "lo-sysinfo.h"
 #include "nproc-wrapper.h"
+#include "oct-parallel.h"
 
 #include "defun.h"
 #include "error.h"
@@ -112,4 +114,38 @@ same as @code{current}, but overridable through the
 %!error nproc ("no_valid_option")
 */
 
+DEFUN (__num_comp_threads__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{n} =} __num_comp_threads__ ()
+@deftypefnx {} {@var{n} =} __num_comp_threads__ (@var{n})
+Undocumented internal function.
+
+Query or set the number of computational threads Octave itself uses for
+threaded operations and asks the loaded BLAS to use.  A value of zero
+returns to automatic detection.  The previous count is returned.
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin > 1)
+    print_usage ();
+
+  int prev = parallel_num_threads ();
+
+  if (nargin == 1)
+    {
+      int n = args(0).int_value ();
+
+      if (n < 0)
+        error ("__num_comp_threads__: N must be a nonnegative integer");
+
+      set_parallel_num_threads (n);
+
+      // Keep the BLAS in step so dense kernels honor the same limit.
+      sys::set_blas_num_threads (parallel_num_threads ());
+    }
+
+  return ovl (prev);
+}
+
 OCTAVE_END_NAMESPACE(octave)
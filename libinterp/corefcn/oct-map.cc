@@ -47,7 +47,11 @@ octave_fields::octave_fields (const string_vector& fields)
 {
   octave_idx_type n = fields.numel ();
   for (octave_idx_type i = 0; i < n; i++)
-    (*m_rep)[fields(i)] = i;
+    {
+      octave::interned_string field (fields(i));
+      (*m_rep)[field] = i;
+      m_rep->m_hash[field.ptr ()] = i;
+    }
 }
 
 octave_fields::octave_fields (const char *const *fields)
@@ -55,52 +59,64 @@ octave_fields::octave_fields (const char *const *fields)
 {
   octave_idx_type n = 0;
   while (*fields)
-    (*m_rep)[std::string (*fields++)] = n++;
+    {
+      octave::interned_string field (*fields++);
+      (*m_rep)[field] = n;
+      m_rep->m_hash[field.ptr ()] = n++;
+    }
 }
 
 bool
 octave_fields::isfield (const std::string& field) const
 {
-  return m_rep->find (field) != m_rep->end ();
+  return m_rep->m_hash.find (&field) != m_rep->m_hash.end ();
 }
 
 octave_idx_type
 octave_fields::getfield (const std::string& field) const
 {
-  auto p = m_rep->find (field);
-  return (p != m_rep->end ()) ? p->second : -1;
+  auto p = m_rep->m_hash.find (&field);
+  return (p != m_rep->m_hash.end ()) ? p->second : -1;
 }
 
 octave_idx_type
 octave_fields::getfield (const std::string& field)
 {
-  auto p = m_rep->find (field);
-  if (p != m_rep->end ())
+  auto p = m_rep->m_hash.find (&field);
+  if (p != m_rep->m_hash.end ())
     return p->second;
   else
     {
       make_unique ();
       octave_idx_type n = m_rep->size ();
-      return (*m_rep)[field] = n;
+      octave::interned_string ifield (field);
+      m_rep->m_hash[ifield.ptr ()] = n;
+      return (*m_rep)[ifield] = n;
     }
 }
 
 octave_idx_type
 octave_fields::rmfield (const std::string& field)
 {
-  auto p = m_rep->find (field);
-  if (p == m_rep->end ())
+  auto p = m_rep->m_hash.find (&field);
+  if (p == m_rep->m_hash.end ())
     return -1;
   else
     {
       octave_idx_type n = p->second;
       make_unique ();
-      m_rep->erase (field);
+      m_rep->erase (m_rep->find (field));
+      m_rep->m_hash.erase (&field);
       for (auto& fld_idx : *m_rep)
         {
           if (fld_idx.second >= n)
             fld_idx.second--;
         }
+      for (auto& fld_idx : m_rep->m_hash)
+        {
+          if (fld_idx.second >= n)
+            fld_idx.second--;
+        }
 
       return n;
     }
@@ -118,6 +134,7 @@ octave_fields::orderfields (Array<octave_idx_type>& perm)
     {
       octave_idx_type j = fld_idx.second;
       fld_idx.second = i;
+      m_rep->m_hash[fld_idx.first.ptr ()] = i;
       perm(i++) = j;
     }
 }
@@ -30,7 +30,9 @@
 
 #include <algorithm>
 #include <map>
+#include <unordered_map>
 
+#include "oct-intern.h"
 #include "oct-refcount.h"
 
 #include "Cell.h"
@@ -39,22 +41,58 @@
 class string_vector;
 
 // A class holding a map field->index.  Supports reference-counting.
+//
+// Field names are interned (see oct-intern.h), so every fields_rep
+// holding the same name shares one pooled copy instead of keeping its
+// own std::string -- a large saving for struct-heavy workspaces where
+// the same few names recur across many maps.  The transparent
+// comparator lets lookups with plain std::strings compare contents
+// without touching the pool.
 class OCTINTERP_API
 octave_fields
 {
-  class fields_rep : public std::map<std::string, octave_idx_type>
+  typedef std::map<octave::interned_string, octave_idx_type,
+                   octave::interned_string::order> fields_map;
+
+  class fields_rep : public fields_map
   {
   public:
 
-    fields_rep () : std::map<std::string, octave_idx_type> (), m_count (1) { }
+    // Hash and equality for the unordered mirror below.  Keys are
+    // pointers to pooled names, but queries arrive as addresses of
+    // plain std::strings, so compare contents rather than addresses.
+
+    struct name_hash
+    {
+      std::size_t operator () (const std::string *s) const
+      { return std::hash<std::string> () (*s); }
+    };
+
+    struct name_equal
+    {
+      bool operator () (const std::string *a, const std::string *b) const
+      { return a == b || *a == *b; }
+    };
+
+    fields_rep () : fields_map (), m_count (1) { }
 
     fields_rep (const fields_rep& other)
-      : std::map<std::string, octave_idx_type> (other), m_count (1) { }
+      : fields_map (other), m_hash (other.m_hash),
+        m_count (1) { }
 
     fields_rep& operator = (const fields_rep&) = delete;
 
     ~fields_rep () = default;
 
+    // Unordered mirror of the name->index pairs.  The ordered map
+    // remains canonical because several algorithms (equality up to
+    // order, merging) rely on sorted iteration, but lookups go
+    // through the hash so field access is O(1) instead of O(log n)
+    // string compares.  Keys point to pooled names, which are stable
+    // for the life of the process.
+    std::unordered_map<const std::string *, octave_idx_type,
+                       name_hash, name_equal> m_hash;
+
     octave::refcount<octave_idx_type> m_count;
   };
 
@@ -105,7 +143,7 @@ public:
 
   // constant iteration support. non-const iteration intentionally unsupported.
 
-  typedef std::map<std::string, octave_idx_type>::const_iterator const_iterator;
+  typedef fields_map::const_iterator const_iterator;
   typedef const_iterator iterator;
 
   const_iterator begin () const { return m_rep->begin (); }
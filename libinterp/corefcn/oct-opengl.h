@@ -170,6 +170,16 @@ public:
     ::glDisable (cap);
   }
 
+  virtual void glDisableClientState (GLenum array)
+  {
+    ::glDisableClientState (array);
+  }
+
+  virtual void glDrawArrays (GLenum mode, GLint first, GLsizei count)
+  {
+    ::glDrawArrays (mode, first, count);
+  }
+
   virtual void glDrawPixels (GLsizei width, GLsizei height, GLenum format,
                              GLenum type, const GLvoid *pixels)
   {
@@ -186,6 +196,11 @@ public:
     ::glEnable (cap);
   }
 
+  virtual void glEnableClientState (GLenum array)
+  {
+    ::glEnableClientState (array);
+  }
+
   virtual void glEndList ()
   {
     ::glEndList ();
@@ -398,6 +413,11 @@ public:
     ::glScalef (x, y, z);
   }
 
+  virtual void glScissor (GLint x, GLint y, GLsizei width, GLsizei height)
+  {
+    ::glScissor (x, y, width, height);
+  }
+
   virtual void glSelectBuffer (GLsizei size, GLuint *buffer)
   {
     ::glSelectBuffer (size, buffer);
@@ -426,6 +446,15 @@ public:
     ::glTexParameteri (target, pname, param);
   }
 
+  virtual void glTexSubImage2D (GLenum target, GLint level, GLint xoffset,
+                                GLint yoffset, GLsizei width, GLsizei height,
+                                GLenum format, GLenum type,
+                                const GLvoid *pixels)
+  {
+    ::glTexSubImage2D (target, level, xoffset, yoffset, width, height,
+                       format, type, pixels);
+  }
+
   virtual void glTranslated (GLdouble x, GLdouble y, GLdouble z)
   {
     ::glTranslated (x, y, z);
@@ -451,6 +480,12 @@ public:
     ::glVertex3dv (v);
   }
 
+  virtual void glVertexPointer (GLint size, GLenum type, GLsizei stride,
+                                const GLvoid *pointer)
+  {
+    ::glVertexPointer (size, type, stride, pointer);
+  }
+
   virtual void glViewport (GLint x, GLint y, GLsizei width, GLsizei height)
   {
     ::glViewport (x, y, width, height);
@@ -30,6 +30,8 @@
 
 #include <iomanip>
 
+#include "file-stat.h"
+
 #include "oct-stream.h"
 #include "c-file-ptr-stream.h"
 
@@ -131,7 +133,25 @@ public:
                const std::string& encoding = "utf-8",
                c_file_ptr_buf::close_fcn cf = c_file_ptr_buf::file_close)
     : tstdiostream<c_file_ptr_buf, io_c_file_ptr_stream, FILE *>
-      (n, f, f ? fileno (f) : -1, m, ff, encoding, cf) { }
+      (n, f, f ? fileno (f) : -1, m, ff, encoding, cf)
+  {
+    // Read-ahead only pays off (and is only safe) for regular files
+    // opened for reading exclusively; pipes and read-write streams
+    // keep the plain synchronous path.
+
+    if (f && (m & std::ios::in) && ! (m & std::ios::out))
+      {
+        sys::file_stat fs (n);
+
+        if (fs && fs.is_reg ())
+          {
+            c_file_ptr_buf *buf = rdbuf ();
+
+            if (buf)
+              buf->enable_prefetch ();
+          }
+      }
+  }
 
   static stream
   create (const std::string& n, FILE *f = nullptr,
@@ -29,6 +29,7 @@
 
 #include <cassert>
 #include <cctype>
+#include <cstdio>
 #include <cstring>
 
 #include <algorithm>
@@ -37,8 +38,12 @@
 #include <limits>
 #include <iomanip>
 #include <iostream>
+#include <list>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "Array.h"
 #include "Cell.h"
@@ -1171,6 +1176,123 @@ printf_format_list::printme () const
     }
 }
 
+// Parsing a format string is pure work on the string, and interpreter
+// loops tend to print or scan with the same handful of formats
+// millions of times, so keep the most recently used parsed format
+// lists and hand them out for reuse.  An entry is borrowed
+// exclusively while a call iterates over it, because the iteration
+// cursor lives in the list itself; if the same format is requested
+// again before the first borrow ends, the second user just gets a
+// privately owned list.
+
+template <typename FMT_LIST_T>
+class format_list_cache
+{
+public:
+
+  class borrowed
+  {
+  public:
+
+    borrowed (FMT_LIST_T *list, bool *busy)
+      : m_list (list), m_busy (busy)
+    { }
+
+    OCTAVE_DISABLE_COPY_MOVE (borrowed)
+
+    ~borrowed ()
+    {
+      if (m_busy)
+        *m_busy = false;
+      else
+        delete m_list;
+    }
+
+    FMT_LIST_T& operator * () const { return *m_list; }
+    FMT_LIST_T * operator -> () const { return m_list; }
+
+  private:
+
+    FMT_LIST_T *m_list;
+
+    // Busy flag of the cache entry we borrowed from, or null if we
+    // own M_LIST outright.
+    bool *m_busy;
+  };
+
+  borrowed get (const std::string& fmt)
+  {
+    for (auto it = m_entries.begin (); it != m_entries.end (); ++it)
+      {
+        if (it->fmt == fmt && ! it->busy)
+          {
+            if (it != m_entries.begin ())
+              m_entries.splice (m_entries.begin (), m_entries, it);
+
+            entry& e = m_entries.front ();
+            e.busy = true;
+            return borrowed (e.list.get (), &e.busy);
+          }
+      }
+
+    FMT_LIST_T *fresh = new FMT_LIST_T (fmt);
+
+    // Don't cache invalid formats; the caller is about to error out.
+    if (! fresh->ok ())
+      return borrowed (fresh, nullptr);
+
+    m_entries.push_front (entry { fmt, std::unique_ptr<FMT_LIST_T> (fresh),
+                                  true });
+
+    // Trim, skipping entries that are still borrowed.
+    std::size_t n = m_entries.size ();
+    auto it = m_entries.end ();
+    while (n > max_cached_formats && it != m_entries.begin ())
+      {
+        --it;
+        if (! it->busy)
+          {
+            it = m_entries.erase (it);
+            n--;
+          }
+      }
+
+    return borrowed (m_entries.front ().list.get (),
+                     &m_entries.front ().busy);
+  }
+
+private:
+
+  struct entry
+  {
+    std::string fmt;
+    std::unique_ptr<FMT_LIST_T> list;
+    bool busy;
+  };
+
+  enum { max_cached_formats = 16 };
+
+  // Most recently used first; list nodes, so borrowed pointers stay
+  // valid across splicing and insertion.
+  std::list<entry> m_entries;
+};
+
+static typename format_list_cache<scanf_format_list>::borrowed
+cached_scanf_format (const std::string& fmt)
+{
+  static format_list_cache<scanf_format_list> cache;
+
+  return cache.get (fmt);
+}
+
+static typename format_list_cache<printf_format_list>::borrowed
+cached_printf_format (const std::string& fmt)
+{
+  static format_list_cache<printf_format_list> cache;
+
+  return cache.get (fmt);
+}
+
 // Calculate x^n.  Used for ...e+nn so that, for example, 1e2 is
 // exactly 100 and 5e-1 is 1/2
 
@@ -5119,9 +5241,9 @@ base_stream::scanf (const std::string& fmt, const Array<double>& size,
     invalid_operation (who, "reading");
   else
     {
-      scanf_format_list fmt_list (fmt);
+      auto fmt_list = cached_scanf_format (fmt);
 
-      if (fmt_list.num_conversions () == -1)
+      if (fmt_list->num_conversions () == -1)
         ::error ("%s: invalid format specified", who.c_str ());
 
       octave_idx_type nr = -1;
@@ -5131,7 +5253,7 @@ base_stream::scanf (const std::string& fmt, const Array<double>& size,
 
       get_size (size, nr, nc, one_elt_size_spec, who);
 
-      retval = do_scanf (fmt_list, nr, nc, one_elt_size_spec,
+      retval = do_scanf (*fmt_list, nr, nc, one_elt_size_spec,
                          conversion_count, who);
     }
 
@@ -5367,20 +5489,20 @@ base_stream::oscanf (const std::string& fmt, const std::string& who)
     {
       std::istream& is = *isp;
 
-      scanf_format_list fmt_list (fmt);
+      auto fmt_list = cached_scanf_format (fmt);
 
-      octave_idx_type m_nconv = fmt_list.num_conversions ();
+      octave_idx_type m_nconv = fmt_list->num_conversions ();
 
       if (m_nconv == -1)
         ::error ("%s: invalid format specified", who.c_str ());
 
       is.clear ();
 
-      octave_idx_type len = fmt_list.length ();
+      octave_idx_type len = fmt_list->length ();
 
       retval.resize (m_nconv+2, Matrix ());
 
-      const scanf_format_elt *elt = fmt_list.first ();
+      const scanf_format_elt *elt = fmt_list->first ();
 
       int num_values = 0;
 
@@ -5402,7 +5524,7 @@ base_stream::oscanf (const std::string& fmt, const std::string& who)
               if (! ok ())
                 break;
 
-              elt = fmt_list.next (m_nconv > 0);
+              elt = fmt_list->next (m_nconv > 0);
             }
         }
 
@@ -5418,7 +5540,7 @@ base_stream::oscanf (const std::string& fmt, const std::string& who)
             {
               octave_value tmp;
 
-              elt = fmt_list.next ();
+              elt = fmt_list->next ();
 
               do_oscanf (elt, tmp, who);
             }
@@ -5919,6 +6041,231 @@ base_stream::do_numeric_printf_conv (std::ostream& os,
   return retval;
 }
 
+// A printf format element "compiled" for the bulk formatting fast
+// path: the C format strings needed at run time (including the
+// variants used for non-integral and non-finite values) are built
+// once so that formatting an array element is a single snprintf call
+// with no further inspection of the format.
+
+class
+compiled_printf_elt
+{
+public:
+
+  enum conv_kind
+  {
+    literal_text,   // no argument consumed
+    signed_conv,    // 'd' or 'i'
+    unsigned_conv,  // 'o', 'x', 'X', or 'u'
+    double_conv     // 'f', 'e', 'E', 'g', or 'G'
+  };
+
+  compiled_printf_elt ()
+    : kind (literal_text), fmt (), g_fmt (), nan_fmt (), plus_flag (false)
+  { }
+
+  conv_kind kind;
+
+  // For LITERAL_TEXT, the text to copy verbatim.  Otherwise, the
+  // C-style format for the element, with the "long" modifier already
+  // inserted for integer conversions.
+  std::string fmt;
+
+  // Fallback format for integer conversions applied to values that
+  // are not representable as integers.
+  std::string g_fmt;
+
+  // String format (precision stripped) used for Inf, -Inf, NA, and
+  // NaN values.
+  std::string nan_fmt;
+
+  // True if the '+' flag was given.
+  bool plus_flag;
+};
+
+// Attempt to compile FMT_LIST for the fast path.  Return false if any
+// element requires the generic conversion loop ('*' field widths or
+// precisions, string or character conversions, or invalid specifiers).
+
+static bool
+compile_printf_format (printf_format_list& fmt_list,
+                       std::vector<compiled_printf_elt>& celts)
+{
+  static std::string llmod
+    = (sizeof (long) == sizeof (int64_t) ? "l" : "ll");
+
+  for (const printf_format_elt *elt = fmt_list.first (); elt;
+       elt = fmt_list.next (false))
+    {
+      compiled_printf_elt celt;
+
+      if (elt->type == '%')
+        celt.fmt = '%';
+      else if (elt->args == 0)
+        celt.fmt = elt->text;
+      else
+        {
+          if (elt->fw == -2 || elt->prec == -2 || elt->args != 1)
+            return false;
+
+          switch (elt->type)
+            {
+            case 'd': case 'i':
+              celt.kind = compiled_printf_elt::signed_conv;
+              break;
+
+            case 'o': case 'x': case 'X': case 'u':
+              celt.kind = compiled_printf_elt::unsigned_conv;
+              break;
+
+            case 'f': case 'e': case 'E': case 'g': case 'G':
+              celt.kind = compiled_printf_elt::double_conv;
+              break;
+
+            default:
+              return false;
+            }
+
+          celt.fmt = elt->text;
+
+          if (celt.kind != compiled_printf_elt::double_conv)
+            {
+              // Insert "long" modifier.
+              celt.fmt.replace (celt.fmt.rfind (elt->type), 1,
+                                llmod + elt->type);
+
+              celt.g_fmt = switch_to_g_format (elt);
+            }
+
+          // Build the non-finite variant the same way the generic
+          // path does: replace the conversion with 's' and discard
+          // any precision.
+
+          std::string tfmt = elt->text;
+
+          std::string::size_type i1, i2;
+
+          tfmt.replace ((i1 = tfmt.rfind (elt->type)), 1, 1, 's');
+
+          if ((i2 = tfmt.rfind ('.')) != std::string::npos && i2 < i1)
+            tfmt.erase (i2, i1-i2);
+
+          celt.nan_fmt = tfmt;
+
+          celt.plus_flag = elt->flags.find ('+') != std::string::npos;
+        }
+
+      celts.push_back (celt);
+    }
+
+  return true;
+}
+
+// Format every element of VALS with the compiled format CELTS,
+// cycling through the format as the generic loop would, and write the
+// result to OS in one operation.  Return the number of characters
+// written.
+
+static int
+do_printf_fast (std::ostream& os,
+                const std::vector<compiled_printf_elt>& celts,
+                const NDArray& vals)
+{
+  std::string out;
+
+  const double *data = vals.data ();
+  octave_idx_type n = vals.numel ();
+  octave_idx_type i = 0;
+
+  out.reserve (8 * n);
+
+  char buf[128];
+
+  auto append_conv = [&out, &buf] (const char *fmt, auto arg)
+  {
+    int len = std::snprintf (buf, sizeof (buf), fmt, arg);
+
+    if (len < static_cast<int> (sizeof (buf)))
+      out.append (buf, len);
+    else
+      {
+        std::vector<char> big (len + 1);
+        std::snprintf (big.data (), big.size (), fmt, arg);
+        out.append (big.data (), len);
+      }
+  };
+
+  std::size_t k = 0;
+
+  while (true)
+    {
+      const compiled_printf_elt& celt = celts[k];
+
+      if (celt.kind == compiled_printf_elt::literal_text)
+        out += celt.fmt;
+      else if (i < n)
+        {
+          double dval = data[i++];
+
+          if (lo_ieee_isnan (dval) || lo_ieee_isinf (dval))
+            {
+              const char *tval;
+
+              if (lo_ieee_isinf (dval))
+                tval = (dval < 0 ? "-Inf"
+                                 : (celt.plus_flag ? "+Inf" : "Inf"));
+              else if (lo_ieee_is_NA (dval))
+                tval = (celt.plus_flag ? "+NA" : "NA");
+              else
+                tval = (celt.plus_flag ? "+NaN" : "NaN");
+
+              append_conv (celt.nan_fmt.c_str (), tval);
+            }
+          else if (celt.kind == compiled_printf_elt::double_conv)
+            append_conv (celt.fmt.c_str (), dval);
+          else if (celt.kind == compiled_printf_elt::signed_conv)
+            {
+              uint64_t limit = std::numeric_limits<int64_t>::max ();
+
+              if (dval == math::fix (dval) && dval <= limit)
+                append_conv (celt.fmt.c_str (),
+                             octave_int64 (dval).value ());
+              else
+                append_conv (celt.g_fmt.c_str (), dval);
+            }
+          else
+            {
+              uint64_t limit = std::numeric_limits<uint64_t>::max ();
+
+              if (dval == math::fix (dval) && dval >= 0 && dval <= limit)
+                append_conv (celt.fmt.c_str (),
+                             octave_uint64 (dval).value ());
+              else
+                append_conv (celt.g_fmt.c_str (), dval);
+            }
+        }
+      else
+        break;
+
+      if (++k == celts.size ())
+        {
+          // Once the data is exhausted, trailing literal text is
+          // still copied but the format does not cycle again.
+
+          if (i >= n)
+            break;
+
+          k = 0;
+
+          octave_quit ();
+        }
+    }
+
+  os << out;
+
+  return out.length ();
+}
+
 void
 base_stream::field_width_error (const std::string& who) const
 {
@@ -5945,6 +6292,34 @@ base_stream::do_printf (printf_format_list& fmt_list,
 
       preserve_stream_state stream_state (os);
 
+      // Fast path: a format containing only literal text and plain
+      // numeric conversions applied to a single real array can be
+      // compiled once and then formatted element by element into a
+      // single buffer, avoiding the per-element value cache and
+      // stream operations of the generic loop below.
+
+      if (m_nconv > 0 && args.length () == 1)
+        {
+          octave_value val = args(0);
+
+          if ((val.is_double_type () || val.is_single_type ())
+              && ! val.iscomplex () && ! val.issparse ()
+              && val.numel () > 0)
+            {
+              std::vector<compiled_printf_elt> celts;
+
+              if (compile_printf_format (fmt_list, celts))
+                {
+                  retval = do_printf_fast (os, celts, val.array_value ());
+
+                  if (! os)
+                    error (who, "write error");
+
+                  return retval;
+                }
+            }
+        }
+
       const printf_format_elt *elt = fmt_list.first ();
 
       printf_value_cache val_cache (args, who);
@@ -6051,12 +6426,12 @@ base_stream::printf (const std::string& fmt,
                      const octave_value_list& args,
                      const std::string& who)
 {
-  printf_format_list fmt_list (fmt);
+  auto fmt_list = cached_printf_format (fmt);
 
-  if (fmt_list.num_conversions () == -1)
+  if (fmt_list->num_conversions () == -1)
     ::error ("%s: invalid format specified", who.c_str ());
 
-  return do_printf (fmt_list, args, who);
+  return do_printf (*fmt_list, args, who);
 }
 
 int
@@ -6396,6 +6771,33 @@ stream::close ()
     }
 }
 
+// Identify SRC_T/array element pairs whose bytes in the file and in
+// memory are laid out identically, so a converted buffer can be copied
+// into the array wholesale instead of element by element.
+
+template <typename SRC_T, typename ELT_T>
+struct same_data_layout : std::is_same<SRC_T, ELT_T> { };
+
+template <typename T>
+struct same_data_layout<T, octave_int<T>> : std::true_type { };
+
+template <typename SRC_T, typename ELT_T>
+static inline void
+copy_chunk (ELT_T *dst, const SRC_T *src, octave_idx_type n,
+            std::true_type)
+{
+  std::memcpy (static_cast<void *> (dst), src, n * sizeof (ELT_T));
+}
+
+template <typename SRC_T, typename ELT_T>
+static inline void
+copy_chunk (ELT_T *dst, const SRC_T *src, octave_idx_type n,
+            std::false_type)
+{
+  for (octave_idx_type i = 0; i < n; i++)
+    dst[i] = src[i];
+}
+
 template <typename SRC_T, typename DST_T>
 static octave_value
 convert_and_copy (std::list<void *>& input_buf_list,
@@ -6417,64 +6819,33 @@ convert_and_copy (std::list<void *>& input_buf_list,
     {
       SRC_T *data = static_cast<SRC_T *> (*it);
 
-      if (swap || do_float_fmt_conv)
-        {
-          if (do_NA_conv)
-            {
-              for (octave_idx_type i = 0; i < input_buf_elts && j < elts_read;
-                   i++, j++)
-                {
-                  if (swap)
-                    swap_bytes<sizeof (SRC_T)> (&data[i]);
-                  else if (do_float_fmt_conv)
-                    do_float_format_conversion (&data[i], sizeof (SRC_T),
-                                                1, from_flt_fmt,
-                                                mach_info::native_float_format ());
-
-                  // FIXME: Potentially add conversion code for MIPS NA here
-                  //        Bug #59830.
-                  // dst_elt_type tmp (data[i]);
-                  // if (is_MIPS_NA (tmp))
-                  //  tmp = replace_MIPS_NA (tmp);
-                  // conv_data[j] = tmp;
-
-                  conv_data[j] = data[i];
-                }
-            }
-          else
-            {
-              for (octave_idx_type i = 0; i < input_buf_elts && j < elts_read;
-                   i++, j++)
-                {
-                  if (swap)
-                    swap_bytes<sizeof (SRC_T)> (&data[i]);
-                  else if (do_float_fmt_conv)
-                    do_float_format_conversion (&data[i], sizeof (SRC_T),
-                                                1, from_flt_fmt,
-                                                mach_info::native_float_format ());
-
-                  conv_data[j] = data[i];
-                }
-            }
-        }
-      else
-        {
-          if (do_NA_conv)
-            {
-              for (octave_idx_type i = 0; i < input_buf_elts && j < elts_read;
-                   i++, j++)
-                {
-                  // FIXME: Potentially add conversion code for MIPS NA here
-                  conv_data[j] = data[i];
-                }
-            }
-          else
-            {
-              for (octave_idx_type i = 0; i < input_buf_elts && j < elts_read;
-                   i++, j++)
-                conv_data[j] = data[i];
-            }
-        }
+      octave_idx_type chunk_elts = std::min (input_buf_elts, elts_read - j);
+
+      // Transform the whole chunk in one pass per operation instead of
+      // testing the flags for every element; the single-purpose loops
+      // are simple enough for compilers to vectorize.
+
+      if (swap)
+        swap_bytes<sizeof (SRC_T)> (data, chunk_elts);
+      else if (do_float_fmt_conv)
+        do_float_format_conversion (data, sizeof (SRC_T), chunk_elts,
+                                    from_flt_fmt,
+                                    mach_info::native_float_format ());
+
+      // FIXME: Potentially add conversion code for MIPS NA here
+      //        Bug #59830.  It would have to run before the copy below
+      //        and would rule out the same-layout shortcut for double
+      //        destinations.
+      // dst_elt_type tmp (data[i]);
+      // if (is_MIPS_NA (tmp))
+      //  tmp = replace_MIPS_NA (tmp);
+      // conv_data[j] = tmp;
+      octave_unused_parameter (do_NA_conv);
+
+      copy_chunk (conv_data + j, data, chunk_elts,
+                  same_data_layout<SRC_T, dst_elt_type> ());
+
+      j += chunk_elts;
 
       delete [] data;
     }
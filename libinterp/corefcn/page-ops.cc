@@ -0,0 +1,568 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+// Page-wise batched linear algebra: pagemtimes and pagemldivide.
+// These operate on each 2-D page of N-D operands with kernels tuned
+// for many small pages, threaded across pages, instead of looping in
+// the interpreter and paying dispatch plus LAPACK setup per page.
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cmath>
+
+#include "CNDArray.h"
+#include "dNDArray.h"
+#include "fCNDArray.h"
+#include "fNDArray.h"
+#include "lo-array-errwarn.h"
+#include "oct-locbuf.h"
+#include "oct-parallel.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+static inline double page_conj (double x) { return x; }
+static inline float page_conj (float x) { return x; }
+static inline Complex page_conj (const Complex& x) { return std::conj (x); }
+static inline FloatComplex page_conj (const FloatComplex& x)
+{ return std::conj (x); }
+
+static inline double page_abs (double x) { return std::abs (x); }
+static inline float page_abs (float x) { return std::abs (x); }
+static inline double page_abs (const Complex& x) { return std::abs (x); }
+static inline float page_abs (const FloatComplex& x) { return std::abs (x); }
+
+// C = op(A) * op(B) for one column-major page.  AM x AN are the stored
+// dimensions of the A page and likewise BM x BN; OPA and OPB are 'N',
+// 'T' or 'C'.  The loops keep the output column in cache and for the
+// common 'N' case stream both C and A columns contiguously, which is
+// what small fixed-size pages need; a compiler unrolls the short
+// trip-count loops on its own.
+
+template <typename T>
+static void
+page_gemm (char opa, char opb,
+           const T *a, octave_idx_type am,
+           const T *b, octave_idx_type bm,
+           T *c, octave_idx_type m, octave_idx_type n, octave_idx_type k)
+{
+  for (octave_idx_type j = 0; j < n; j++)
+    {
+      T *cc = c + j * m;
+
+      for (octave_idx_type i = 0; i < m; i++)
+        cc[i] = T ();
+
+      for (octave_idx_type l = 0; l < k; l++)
+        {
+          T bv;
+          if (opb == 'N')
+            bv = b[l + j * bm];
+          else if (opb == 'T')
+            bv = b[j + l * bm];
+          else
+            bv = page_conj (b[j + l * bm]);
+
+          if (opa == 'N')
+            {
+              const T *ac = a + l * am;
+              for (octave_idx_type i = 0; i < m; i++)
+                cc[i] += ac[i] * bv;
+            }
+          else if (opa == 'T')
+            {
+              for (octave_idx_type i = 0; i < m; i++)
+                cc[i] += a[l + i * am] * bv;
+            }
+          else
+            {
+              for (octave_idx_type i = 0; i < m; i++)
+                cc[i] += page_conj (a[l + i * am]) * bv;
+            }
+        }
+    }
+}
+
+// Solve A*X = B for one page with partial-pivoting LU on local copies.
+// Returns false if a zero pivot was met; the affected columns then
+// contain Inf or NaN, like the singular case of the 2-D solvers.
+
+template <typename T>
+static bool
+page_lu_solve (T *a, octave_idx_type n, T *b, octave_idx_type nrhs)
+{
+  bool ok = true;
+
+  for (octave_idx_type kk = 0; kk < n; kk++)
+    {
+      // Partial pivoting.
+      octave_idx_type p = kk;
+      double pmax = page_abs (a[kk + kk * n]);
+      for (octave_idx_type i = kk + 1; i < n; i++)
+        {
+          double ai = page_abs (a[i + kk * n]);
+          if (ai > pmax)
+            {
+              pmax = ai;
+              p = i;
+            }
+        }
+
+      if (pmax == 0.0)
+        ok = false;
+
+      if (p != kk)
+        {
+          for (octave_idx_type j = 0; j < n; j++)
+            std::swap (a[kk + j * n], a[p + j * n]);
+          for (octave_idx_type j = 0; j < nrhs; j++)
+            std::swap (b[kk + j * n], b[p + j * n]);
+        }
+
+      T piv = a[kk + kk * n];
+      for (octave_idx_type i = kk + 1; i < n; i++)
+        {
+          T f = a[i + kk * n] / piv;
+          a[i + kk * n] = f;
+          for (octave_idx_type j = kk + 1; j < n; j++)
+            a[i + j * n] -= f * a[kk + j * n];
+          for (octave_idx_type j = 0; j < nrhs; j++)
+            b[i + j * n] -= f * b[kk + j * n];
+        }
+    }
+
+  // Back substitution.
+  for (octave_idx_type j = 0; j < nrhs; j++)
+    {
+      T *bc = b + j * n;
+      for (octave_idx_type i = n - 1; i >= 0; i--)
+        {
+          T s = bc[i];
+          for (octave_idx_type l = i + 1; l < n; l++)
+            s -= a[i + l * n] * bc[l];
+          bc[i] = s / a[i + i * n];
+        }
+    }
+
+  return ok;
+}
+
+// Check that the page (trailing) dimensions of the operands agree or
+// that one operand has a single page, and return the result page
+// count.  NPAGES_A and NPAGES_B are the per-operand totals.
+
+static octave_idx_type
+page_dims_check (const char *who, const dim_vector& adims,
+                 const dim_vector& bdims,
+                 octave_idx_type npages_a, octave_idx_type npages_b)
+{
+  if (npages_a == 1 || npages_b == 1)
+    return (npages_a == 1 ? npages_b : npages_a);
+
+  bool match = adims.ndims () == bdims.ndims ();
+  for (int i = 2; match && i < adims.ndims (); i++)
+    match = adims(i) == bdims(i);
+
+  if (! match)
+    error ("%s: operands must have identical page dimensions "
+           "or a single page", who);
+
+  return npages_a;
+}
+
+static char
+page_transp_flag (const char *who, const octave_value& arg)
+{
+  std::string s = arg.xstring_value ("%s: TRANSP option must be a string",
+                                     who);
+
+  if (s == "none")
+    return 'N';
+  else if (s == "transpose")
+    return 'T';
+  else if (s == "ctranspose")
+    return 'C';
+  else
+    error ("%s: invalid TRANSP option \"%s\"", who, s.c_str ());
+}
+
+template <typename NDA>
+static octave_value
+do_page_mtimes (const octave_value& av, char opa,
+                const octave_value& bv, char opb)
+{
+  NDA a = octave_value_extract<NDA> (av);
+  NDA b = octave_value_extract<NDA> (bv);
+
+  const dim_vector adims = a.dims ();
+  const dim_vector bdims = b.dims ();
+
+  octave_idx_type am = adims(0);
+  octave_idx_type an = adims.ndims () > 1 ? adims(1) : 1;
+  octave_idx_type bm = bdims(0);
+  octave_idx_type bn = bdims.ndims () > 1 ? bdims(1) : 1;
+
+  octave_idx_type m = (opa == 'N' ? am : an);
+  octave_idx_type k = (opa == 'N' ? an : am);
+  octave_idx_type kb = (opb == 'N' ? bm : bn);
+  octave_idx_type n = (opb == 'N' ? bn : bm);
+
+  if (k != kb)
+    error ("pagemtimes: nonconformant pages (op(A) is %" OCTAVE_IDX_TYPE_FORMAT
+           "x%" OCTAVE_IDX_TYPE_FORMAT ", op(B) is %" OCTAVE_IDX_TYPE_FORMAT
+           "x%" OCTAVE_IDX_TYPE_FORMAT ")", m, k, kb, n);
+
+  octave_idx_type apage = am * an;
+  octave_idx_type bpage = bm * bn;
+  octave_idx_type npages_a = (apage == 0 ? 1 : a.numel () / apage);
+  octave_idx_type npages_b = (bpage == 0 ? 1 : b.numel () / bpage);
+
+  octave_idx_type npages
+    = page_dims_check ("pagemtimes", adims, bdims, npages_a, npages_b);
+
+  dim_vector rdims = (npages_a == 1 && npages_b != 1 ? bdims : adims);
+  rdims(0) = m;
+  if (rdims.ndims () > 1)
+    rdims(1) = n;
+
+  NDA c (rdims);
+
+  const typename NDA::element_type *ad = a.data ();
+  const typename NDA::element_type *bd = b.data ();
+  typename NDA::element_type *cd = c.fortran_vec ();
+
+  octave_idx_type cpage = m * n;
+
+  chunked_parallel_for (npages, c.numel (),
+    [=] (octave_idx_type beg, octave_idx_type len)
+    {
+      for (octave_idx_type p = beg; p < beg + len; p++)
+        page_gemm (opa, opb,
+                   ad + (npages_a == 1 ? 0 : p) * apage, am,
+                   bd + (npages_b == 1 ? 0 : p) * bpage, bm,
+                   cd + p * cpage, m, n, k);
+    });
+
+  return octave_value (c);
+}
+
+template <typename NDA>
+static octave_value
+do_page_mldivide (const octave_value& av, const octave_value& bv)
+{
+  NDA a = octave_value_extract<NDA> (av);
+  NDA b = octave_value_extract<NDA> (bv);
+
+  const dim_vector adims = a.dims ();
+  const dim_vector bdims = b.dims ();
+
+  octave_idx_type n = adims(0);
+  octave_idx_type an = adims.ndims () > 1 ? adims(1) : 1;
+  octave_idx_type bm = bdims(0);
+  octave_idx_type nrhs = bdims.ndims () > 1 ? bdims(1) : 1;
+
+  if (n != an)
+    error ("pagemldivide: pages of A must be square");
+  if (bm != n)
+    error ("pagemldivide: nonconformant pages (A is %" OCTAVE_IDX_TYPE_FORMAT
+           "x%" OCTAVE_IDX_TYPE_FORMAT ", B is %" OCTAVE_IDX_TYPE_FORMAT
+           "x%" OCTAVE_IDX_TYPE_FORMAT ")", n, n, bm, nrhs);
+
+  octave_idx_type apage = n * n;
+  octave_idx_type bpage = n * nrhs;
+  octave_idx_type npages_a = (apage == 0 ? 1 : a.numel () / apage);
+  octave_idx_type npages_b = (bpage == 0 ? 1 : b.numel () / bpage);
+
+  octave_idx_type npages
+    = page_dims_check ("pagemldivide", adims, bdims, npages_a, npages_b);
+
+  dim_vector rdims = (npages_a == 1 && npages_b != 1 ? bdims : adims);
+  rdims(0) = n;
+  if (rdims.ndims () > 1)
+    rdims(1) = nrhs;
+
+  NDA x (rdims);
+
+  const typename NDA::element_type *ad = a.data ();
+  const typename NDA::element_type *bd = b.data ();
+  typename NDA::element_type *xd = x.fortran_vec ();
+
+  // Written only inside the workers, read only after they finish; a
+  // racy write is harmless because every writer stores true.
+  bool singular = false;
+  bool *singular_p = &singular;
+
+  chunked_parallel_for (npages, x.numel (),
+    [=] (octave_idx_type beg, octave_idx_type len)
+    {
+      OCTAVE_LOCAL_BUFFER (typename NDA::element_type, awork, apage);
+
+      for (octave_idx_type p = beg; p < beg + len; p++)
+        {
+          const typename NDA::element_type *ap
+            = ad + (npages_a == 1 ? 0 : p) * apage;
+          for (octave_idx_type i = 0; i < apage; i++)
+            awork[i] = ap[i];
+
+          typename NDA::element_type *xp = xd + p * bpage;
+          const typename NDA::element_type *bp
+            = bd + (npages_b == 1 ? 0 : p) * bpage;
+          for (octave_idx_type i = 0; i < bpage; i++)
+            xp[i] = bp[i];
+
+          if (! page_lu_solve (awork, n, xp, nrhs))
+            *singular_p = true;
+        }
+    });
+
+  if (singular)
+    warn_singular_matrix ();
+
+  return octave_value (x);
+}
+
+DEFUN (pagemtimes, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{C} =} pagemtimes (@var{A}, @var{B})
+@deftypefnx {} {@var{C} =} pagemtimes (@var{A}, @var{transpA}, @var{B}, @var{transpB})
+Compute the matrix product of corresponding pages of @var{A} and
+@var{B}.
+
+Page @code{@var{C}(:,:,i)} of the result is
+@code{@var{A}(:,:,i) * @var{B}(:,:,i)}.  The page dimensions (the
+third and higher dimensions) of the operands must agree, or one
+operand may consist of a single page which is then combined with
+every page of the other.
+
+The optional arguments @var{transpA} and @var{transpB} select an
+operation applied to each page before multiplying and may be
+@qcode{"none"}, @qcode{"transpose"}, or @qcode{"ctranspose"}.
+
+The pages are processed with kernels tuned for many small matrices
+and distributed across threads; a product of two large single-page
+matrices is better written with the @code{*} operator.
+@seealso{pagemldivide, pagetranspose, pagectranspose, mtimes}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin != 2 && nargin != 4)
+    print_usage ();
+
+  octave_value a, b;
+  char opa = 'N';
+  char opb = 'N';
+
+  if (nargin == 2)
+    {
+      a = args(0);
+      b = args(1);
+    }
+  else
+    {
+      a = args(0);
+      opa = page_transp_flag ("pagemtimes", args(1));
+      b = args(2);
+      opb = page_transp_flag ("pagemtimes", args(3));
+    }
+
+  if (! a.isnumeric () || ! b.isnumeric ()
+      || a.islogical () || b.islogical ())
+    error ("pagemtimes: A and B must be numeric arrays");
+
+  if (a.isinteger () || b.isinteger ())
+    error ("pagemtimes: A and B must be floating point arrays");
+
+  bool is_single = a.is_single_type () || b.is_single_type ();
+  bool is_cplx = a.iscomplex () || b.iscomplex ();
+
+  if (is_single)
+    {
+      if (is_cplx)
+        return do_page_mtimes<FloatComplexNDArray>
+               (octave_value (a.float_complex_array_value ()), opa,
+                octave_value (b.float_complex_array_value ()), opb);
+      else
+        return do_page_mtimes<FloatNDArray>
+               (octave_value (a.float_array_value ()), opa,
+                octave_value (b.float_array_value ()), opb);
+    }
+  else
+    {
+      if (is_cplx)
+        return do_page_mtimes<ComplexNDArray>
+               (octave_value (a.complex_array_value ()), opa,
+                octave_value (b.complex_array_value ()), opb);
+      else
+        return do_page_mtimes<NDArray>
+               (octave_value (a.array_value ()), opa,
+                octave_value (b.array_value ()), opb);
+    }
+}
+
+/*
+%!test
+%! A = reshape (1:24, 2, 3, 4);
+%! B = reshape (24:-1:1, 3, 2, 4);
+%! C = pagemtimes (A, B);
+%! for i = 1:4
+%!   assert (C(:,:,i), A(:,:,i) * B(:,:,i));
+%! endfor
+
+%!test
+%! A = rand (4, 4, 5);
+%! B = rand (4, 2);  # single page, broadcast
+%! C = pagemtimes (A, B);
+%! for i = 1:5
+%!   assert (C(:,:,i), A(:,:,i) * B, 1e-14);
+%! endfor
+
+%!test
+%! A = rand (3, 5, 4) + 1i * rand (3, 5, 4);
+%! B = rand (3, 2, 4) + 1i * rand (3, 2, 4);
+%! C = pagemtimes (A, "ctranspose", B, "none");
+%! for i = 1:4
+%!   assert (C(:,:,i), A(:,:,i)' * B(:,:,i), 1e-13);
+%! endfor
+
+%!test
+%! A = single (rand (4, 3, 2));
+%! B = rand (2, 3, 2);
+%! C = pagemtimes (A, "transpose", B, "transpose");
+%! assert (isa (C, "single"));
+%! for i = 1:2
+%!   assert (C(:,:,i), single (A(:,:,i).' * B(:,:,i).'), 1e-5);
+%! endfor
+
+%!assert (pagemtimes (zeros (0, 3, 2), zeros (3, 0, 2)), zeros (0, 0, 2))
+
+%!error <nonconformant pages> pagemtimes (rand (2, 3), rand (2, 3))
+%!error <identical page dimensions> pagemtimes (rand (2, 2, 3), rand (2, 2, 4))
+%!error <invalid TRANSP option> pagemtimes (1, "foo", 2, "none")
+*/
+
+DEFUN (pagemldivide, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{X} =} pagemldivide (@var{A}, @var{B})
+Solve the linear systems given by corresponding pages of @var{A} and
+@var{B}.
+
+Page @code{@var{X}(:,:,i)} of the result is
+@code{@var{A}(:,:,i) \ @var{B}(:,:,i)}; the pages of @var{A} must be
+square.  The page dimensions of the operands must agree, or one
+operand may consist of a single page which is then combined with
+every page of the other.
+
+Each page is solved by LU factorization with partial pivoting using
+kernels tuned for many small systems, distributed across threads.
+If a page is singular a warning is issued and the corresponding
+result page contains @code{Inf} or @code{NaN} values.
+@seealso{pagemtimes, mldivide}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  octave_value a = args(0);
+  octave_value b = args(1);
+
+  if (! a.isnumeric () || ! b.isnumeric ()
+      || a.islogical () || b.islogical ())
+    error ("pagemldivide: A and B must be numeric arrays");
+
+  if (a.isinteger () || b.isinteger ())
+    error ("pagemldivide: A and B must be floating point arrays");
+
+  bool is_single = a.is_single_type () || b.is_single_type ();
+  bool is_cplx = a.iscomplex () || b.iscomplex ();
+
+  if (is_single)
+    {
+      if (is_cplx)
+        return do_page_mldivide<FloatComplexNDArray>
+               (octave_value (a.float_complex_array_value ()),
+                octave_value (b.float_complex_array_value ()));
+      else
+        return do_page_mldivide<FloatNDArray>
+               (octave_value (a.float_array_value ()),
+                octave_value (b.float_array_value ()));
+    }
+  else
+    {
+      if (is_cplx)
+        return do_page_mldivide<ComplexNDArray>
+               (octave_value (a.complex_array_value ()),
+                octave_value (b.complex_array_value ()));
+      else
+        return do_page_mldivide<NDArray>
+               (octave_value (a.array_value ()),
+                octave_value (b.array_value ()));
+    }
+}
+
+/*
+%!test
+%! A = rand (4, 4, 6) + 4 * repmat (eye (4), [1, 1, 6]);
+%! B = rand (4, 3, 6);
+%! X = pagemldivide (A, B);
+%! for i = 1:6
+%!   assert (X(:,:,i), A(:,:,i) \ B(:,:,i), 1e-12);
+%! endfor
+
+%!test
+%! A = rand (5, 5) + 5 * eye (5);  # single page, broadcast
+%! B = rand (5, 2, 3);
+%! X = pagemldivide (A, B);
+%! for i = 1:3
+%!   assert (X(:,:,i), A \ B(:,:,i), 1e-12);
+%! endfor
+
+%!test
+%! A = rand (3, 3, 4) + 1i * rand (3, 3, 4) + 3 * repmat (eye (3), [1, 1, 4]);
+%! B = rand (3, 1, 4) + 1i * rand (3, 1, 4);
+%! X = pagemldivide (A, B);
+%! for i = 1:4
+%!   assert (X(:,:,i), A(:,:,i) \ B(:,:,i), 1e-12);
+%! endfor
+
+%!test
+%! A = zeros (2, 2, 2);
+%! A(:,:,1) = eye (2);
+%! B = ones (2, 1, 2);
+%! warning ("off", "Octave:singular-matrix", "local");
+%! X = pagemldivide (A, B);
+%! assert (X(:,:,1), ones (2, 1));
+%! assert (all (! isfinite (X(:,:,2))));
+
+%!error <pages of A must be square> pagemldivide (rand (2, 3, 2), rand (2, 1, 2))
+%!error <nonconformant pages> pagemldivide (rand (3, 3, 2), rand (2, 1, 2))
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -28,12 +28,15 @@
 #endif
 
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 
 #include <iomanip>
 #include <limits>
 #include <list>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include "Array-util.h"
 #include "CMatrix.h"
@@ -1870,6 +1873,114 @@ get_column_width (const float_display_format& fmt)
   return retval;
 }
 
+// Fast bulk formatting for large real matrices.  The generic path
+// saves and restores stream state and runs the locale-aware ostream
+// inserters for every element, which dominates display time once a
+// matrix has more than a few thousand elements.  For the plain fixed,
+// scientific, and default float fields produced by make_format the
+// same text can be generated with snprintf into a row buffer that is
+// written out in one call, so accidentally displaying a huge matrix
+// costs little more than the underlying write.
+
+// Element types the fast path can format.  Complex and rational
+// output keeps the generic path.
+
+template <typename T> struct pr_fast_elt : std::false_type { };
+template <> struct pr_fast_elt<double> : std::true_type { };
+template <> struct pr_fast_elt<float> : std::true_type { };
+
+template <typename T>
+static inline void
+pr_fast_float (std::string& buf, const float_format& fmt, T val)
+{
+  int fw = fmt.width ();
+  int prec = fmt.precision ();
+
+  if (prec < 0)
+    prec = 6;
+
+  // Mirror the special cases of pr_any_float.
+
+  const char *s = nullptr;
+
+  if (val == 0)
+    s = "0";
+  else if (octave::math::isna (val))
+    s = "NA";
+  else if (octave::math::isinf (val))
+    s = (val < 0 ? "-Inf" : "Inf");
+  else if (octave::math::isnan (val))
+    s = "NaN";
+
+  if (s)
+    {
+      std::size_t slen = std::strlen (s);
+
+      if (fw > 0 && static_cast<std::size_t> (fw) > slen)
+        buf.append (fw - slen, ' ');
+
+      buf.append (s, slen);
+
+      return;
+    }
+
+  // Build "%*.*f" and friends; '#' reproduces std::ios::showpoint
+  // (keep the decimal point and trailing zeros).
+
+  char spec[8];
+  char *p = spec;
+
+  *p++ = '%';
+  if (fmt.show_trailing_zeros ())
+    *p++ = '#';
+  *p++ = '*';
+  *p++ = '.';
+  *p++ = '*';
+
+  if (fmt.is_fixed ())
+    *p++ = 'f';
+  else if (fmt.is_scientific ())
+    *p++ = (fmt.is_uppercase () ? 'E' : 'e');
+  else
+    *p++ = (fmt.is_uppercase () ? 'G' : 'g');
+
+  *p = 0;
+
+  char tmp[256];
+
+  int len = std::snprintf (tmp, sizeof (tmp), spec, fw, prec,
+                           static_cast<double> (val));
+
+  if (len < 0 || len >= static_cast<int> (sizeof (tmp)))
+    {
+      // Wider than the scratch buffer (fixed format with a huge
+      // magnitude); take the exact but slower stream route.
+
+      std::ostringstream tmp_os;
+
+      if (fw >= 0)
+        tmp_os << std::setw (fw);
+      if (fmt.precision () >= 0)
+        tmp_os << std::setprecision (fmt.precision ());
+
+      tmp_os.flags (fmt.format_flags ());
+
+      tmp_os << val;
+
+      buf += tmp_os.str ();
+    }
+  else
+    buf.append (tmp, len);
+}
+
+template <typename T>
+static inline void
+pr_fast_float (std::string&, const float_format&, const std::complex<T>&)
+{
+  // Never called; complex matrices are rejected by pr_fast_elt.
+  panic_impossible ();
+}
+
 template <typename MT>
 static void
 octave_print_matrix_internal (std::ostream& os, const MT& m,
@@ -1957,6 +2068,18 @@ octave_print_matrix_internal (std::ostream& os, const MT& m,
 
           pr_scale_header (os, fmt.scale_factor ());
 
+          double scale = fmt.scale_factor ();
+          bool scale_vals = (Vfixed_point_format && ! (print_g || print_e)
+                             && scale != 1);
+
+          bool fast = (pr_fast_elt<typename MT::element_type>::value
+                       && ! rat_format && ! hex_format && ! bit_format
+                       && ! print_eng);
+
+          const float_format& rfmt = fmt.real_format ();
+
+          std::string row_buf;
+
           for (octave_idx_type col = 0; col < nc; col += inc)
             {
               octave_idx_type lim = (col + inc < nc ? col + inc : nc);
@@ -1964,6 +2087,36 @@ octave_print_matrix_internal (std::ostream& os, const MT& m,
               pr_col_num_header (os, total_width, max_width, lim, col,
                                  extra_indent);
 
+              if (fast)
+                {
+                  for (octave_idx_type i = 0; i < nr; i++)
+                    {
+                      octave_quit ();
+
+                      row_buf.clear ();
+                      row_buf.append (extra_indent, ' ');
+
+                      for (octave_idx_type j = col; j < lim; j++)
+                        {
+                          row_buf.append (2, ' ');
+
+                          auto val = m(i, j);
+
+                          if (scale_vals)
+                            val /= scale;
+
+                          pr_fast_float (row_buf, rfmt, val);
+                        }
+
+                      if (i < nr - 1)
+                        row_buf.push_back ('\n');
+
+                      os.write (row_buf.data (), row_buf.size ());
+                    }
+
+                  continue;
+                }
+
               for (octave_idx_type i = 0; i < nr; i++)
                 {
                   os << std::setw (extra_indent) << "";
@@ -3552,6 +3705,17 @@ of properly displaying the object's name.  This can be done by using the
 %!   format (old_spacing);
 %! end_unwind_protect
 
+%!test
+%! [old_fmt, old_spacing] = format ();
+%! unwind_protect
+%!   format short;
+%!   str = disp ([1.1, -2.2; 3.3, 4.4]);
+%!   assert (str, "   1.1000  -2.2000\n   3.3000   4.4000\n");
+%! unwind_protect_cleanup
+%!   format (old_fmt);
+%!   format (old_spacing);
+%! end_unwind_protect
+
 ## Test input validation
 %!error display ()
 %!error display (1,2)
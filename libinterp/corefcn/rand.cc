@@ -159,6 +159,8 @@ do_rand (const octave_value_list& args, int nargin, const char *fcn,
               retval = rand::seed ();
             else if (s_arg == "state" || s_arg == "twister")
               retval = rand::state (fcn);
+            else if (s_arg == "philox")
+              retval = rand::philox_state ();
             else if (s_arg == "uniform")
               rand::uniform_distribution ();
             else if (s_arg == "normal")
@@ -277,6 +279,21 @@ do_rand (const octave_value_list& args, int nargin, const char *fcn,
                     rand::state (s, fcn);
                   }
               }
+            else if (ts == "philox")
+              {
+                if (args(idx+1).is_string ()
+                    && args(idx+1).string_value () == "reset")
+                  rand::philox_reset ();
+                else if (args(idx+1).is_real_scalar ())
+                  rand::philox_seed (args(idx+1).double_value ());
+                else
+                  {
+                    ColumnVector s
+                      = ColumnVector (args(idx+1).vector_value (false, true));
+
+                    rand::philox_state (s);
+                  }
+              }
             else
               error ("%s: unrecognized string argument", fcn);
           }
@@ -368,6 +385,9 @@ DEFUN (rand, args, ,
 @deftypefnx {} {@var{v} =} rand ("seed")
 @deftypefnx {} {} rand ("seed", @var{v})
 @deftypefnx {} {} rand ("seed", "reset")
+@deftypefnx {} {@var{v} =} rand ("philox")
+@deftypefnx {} {} rand ("philox", @var{v})
+@deftypefnx {} {} rand ("philox", "reset")
 Return a matrix with random elements uniformly distributed on the
 interval (0, 1).
 
@@ -437,6 +457,24 @@ However, it should be noted that querying the seed will not cause
 @code{rand} to once again use the new generators, the keyword
 @qcode{"state"} should be used to reset the state of the @code{rand}.
 
+As an alternative to the Mersenne Twister, the keyword @qcode{"philox"}
+selects the counter-based Philox-4x32 generator
+
+@example
+rand ("philox", val)
+@end example
+
+@noindent
+which seeds the generator with @var{val}.  Because each output of a
+counter-based generator depends only on the seed and on its position in
+the stream, large matrices are filled using multiple threads, and the
+result is independent of the number of threads used.  The Philox state
+is a vector of 6 values which can be queried with
+@code{rand ("philox")} and restored with @code{rand ("philox", @var{v})}.
+The Philox generator is used for uniformly, normally, and exponentially
+distributed numbers; @code{randg} and @code{randp} continue to use the
+Mersenne Twister.
+
 The state or seed of the generator can be reset to a new random value using
 the @qcode{"reset"} keyword.
 
@@ -486,6 +524,26 @@ classes.
 %! assert (x, y);
 %! rand ("seed", s);  z = rand (1,2);
 %! assert (x, z);
+%!test  # "philox" seed selects the counter-based generator reproducibly
+%! s0 = rand ("state");
+%! rand ("philox", 12);  x = rand (1,4);
+%! rand ("philox", 12);  y = rand (1,4);
+%! assert (x, y);
+%! rand ("state", s0);
+%!test  # querying "philox" returns a state which can be restored
+%! s0 = rand ("state");
+%! rand ("philox", 42);  rand (1,2);
+%! s = rand ("philox");  x = rand (1,2);
+%! rand ("philox", s);   y = rand (1,2);
+%! assert (x, y);
+%! rand ("state", s0);
+%!test  # scalar and bulk fills draw from the same "philox" stream
+%! s0 = rand ("state");
+%! rand ("philox", 7);  x = rand (1,4);
+%! rand ("philox", 7);  y = [rand, rand, rand, rand];
+%! assert (x, y);
+%! rand ("state", s0);
+%!error <philox state must have 6 elements> rand ("philox", [1,2,3])
 */
 
 /*
@@ -27,7 +27,10 @@
 #  include "config.h"
 #endif
 
+#include <cstdio>
+
 #include <list>
+#include <memory>
 #include <sstream>
 
 #include "base-list.h"
@@ -40,7 +43,9 @@
 #include "Cell.h"
 #include "error.h"
 #include "errwarn.h"
+#include "interpreter.h"
 #include "oct-map.h"
+#include "oct-stream.h"
 #include "ovl.h"
 #include "utils.h"
 
@@ -358,6 +363,57 @@ parse_options (regexp::opts& options, const octave_value_list& args,
     }
 }
 
+// Cache the most recently used compiled patterns so that repeated calls
+// with the same pattern -- in particular the per-element loops in
+// octcellregexp -- do not recompile it each time.  The cache is keyed on
+// the pattern, the options, and the name used for error reporting, and
+// is kept in most-recently-used order.
+
+static regexp&
+compiled_pattern (const std::string& pat, const regexp::opts& opt,
+                  const std::string& who)
+{
+  struct cache_entry
+  {
+    std::string pattern;
+    regexp::opts options;
+    std::string who;
+    std::shared_ptr<regexp> rx;
+  };
+
+  static std::list<cache_entry> cache;
+
+  enum { MAX_CACHED_PATTERNS = 16 };
+
+  for (auto it = cache.begin (); it != cache.end (); ++it)
+    {
+      if (it->pattern == pat && it->who == who
+          && it->options.case_insensitive () == opt.case_insensitive ()
+          && it->options.dotexceptnewline () == opt.dotexceptnewline ()
+          && it->options.emptymatch () == opt.emptymatch ()
+          && it->options.freespacing () == opt.freespacing ()
+          && it->options.lineanchors () == opt.lineanchors ()
+          && it->options.once () == opt.once ())
+        {
+          if (it != cache.begin ())
+            cache.splice (cache.begin (), cache, it);
+
+          return *cache.front ().rx;
+        }
+    }
+
+  // An error while compiling the pattern propagates to the caller
+  // before anything is inserted into the cache.
+  std::shared_ptr<regexp> rx = std::make_shared<regexp> (pat, opt, who);
+
+  cache.push_front ({ pat, opt, who, rx });
+
+  while (cache.size () > std::size_t (MAX_CACHED_PATTERNS))
+    cache.pop_back ();
+
+  return *cache.front ().rx;
+}
+
 static octave_value_list
 octregexp (const octave_value_list& args, int nargout,
            const std::string& who, bool case_insensitive = false)
@@ -380,7 +436,7 @@ octregexp (const octave_value_list& args, int nargout,
   parse_options (options, args, who, 2, extra_options);
 
   const regexp::match_data rx_lst
-    = regexp::match (pattern, buffer, options, who);
+    = compiled_pattern (pattern, options, who).match (buffer);
 
   string_vector named_pats = rx_lst.named_patterns ();
 
@@ -1414,7 +1470,7 @@ octregexprep (const octave_value_list& args, const std::string& who)
   bool extra_args = false;
   parse_options (options, regexpargs, who, 0, extra_args);
 
-  return regexp::replace (pattern, buffer, replacement, options, who);
+  return compiled_pattern (pattern, options, who).replace (buffer, replacement);
 }
 
 DEFUN (regexprep, args, ,
@@ -1606,4 +1662,207 @@ function.
 %!                 "\nabc"));
 */
 
+DEFMETHOD (fregexp, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn  {} {[@var{s}, @var{match}] =} fregexp (@var{fid}, @var{pat})
+@deftypefnx {} {[@var{s}, @var{match}] =} fregexp (@var{fid}, @var{pat}, @var{n})
+Search the stream @var{fid} for the regular expression @var{pat}
+without reading the whole stream into memory.
+
+The stream is scanned from its current position using a sliding window
+of bounded size, so the memory used is independent of the size of the
+file.  The return value @var{s} holds the starting positions of the
+matches as one-based byte offsets into the file, and @var{match} holds
+the matched text as a cell array of strings.  The regular expression
+syntax is the same as for @code{regexp}.
+
+With two arguments, the remainder of the stream is scanned and the
+stream is left at end-of-file.  With a third argument @var{n}, at most
+@var{n} matches are returned and a seekable stream is repositioned
+just after the last one, so repeated calls enumerate the matches of a
+large file incrementally:
+
+@example
+@group
+do
+  [s, m] = fregexp (fid, pat, 100);
+  process (s, m);
+until (isempty (s))
+@end group
+@end example
+
+A match is guaranteed to be found only if it fits within the scanning
+window (one megabyte); a match longer than the window, or a greedy
+match whose full extent exceeds it, may be truncated at the window
+boundary.
+@seealso{regexp, fgetl, fskipl}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+
+  std::string pattern = args(1).string_value ();
+
+  // Rewrite pattern for PCRE
+  pattern = do_regexp_ptn_string_escapes (pattern, args(1).is_sq_string ());
+
+  octave_idx_type max_count = -1;
+
+  if (nargin == 3)
+    {
+      max_count = args(2).xidx_type_value ("fregexp: N must be a non-negative integer");
+
+      if (max_count < 0)
+        error ("fregexp: N must be a non-negative integer");
+    }
+
+  stream_list& streams = interp.get_stream_list ();
+
+  stream os = streams.lookup (args(0), "fregexp");
+
+  std::istream *isp = os.input_stream ();
+
+  if (! isp)
+    error ("fregexp: stream FID is not open for reading");
+
+  std::istream& is = *isp;
+
+  regexp::opts options;
+  const regexp& rx = compiled_pattern (pattern, options, "fregexp");
+
+  // The window bounds both the memory used and the longest match that
+  // can be recognized.
+  static const std::size_t window_bytes = 1048576;
+
+  off_t base = os.tell ();
+
+  // Absolute (zero-based) offset of window[0]; for a non-seekable
+  // stream, positions are relative to where scanning started.
+  off_t origin = (base >= 0 ? base : 0);
+
+  std::string window;
+  std::list<double> starts;
+  std::list<std::string> matches;
+
+  bool done = (max_count == 0);
+  bool at_eof = false;
+  off_t resume_pos = origin;
+
+  while (! done && ! at_eof)
+    {
+      std::size_t old_len = window.size ();
+      window.resize (old_len + window_bytes);
+      is.read (&window[old_len], window_bytes);
+      window.resize (old_len + static_cast<std::size_t> (is.gcount ()));
+      at_eof = is.eof ();
+
+      const regexp::match_data md = rx.match (window);
+
+      std::size_t consumed = 0;
+
+      for (const auto& elt : md)
+        {
+          std::size_t e = static_cast<std::size_t> (elt.end ());
+
+          // A match running to the very end of the window might
+          // extend once more data arrives; rescan it next round.
+          if (! at_eof && e >= window.size ())
+            break;
+
+          starts.push_back (origin + elt.start ());
+          matches.push_back (elt.match_string ());
+
+          consumed = e;
+          resume_pos = origin + e;
+
+          if (max_count > 0
+              && octave_idx_type (starts.size ()) >= max_count)
+            {
+              done = true;
+              break;
+            }
+        }
+
+      // Drop everything up to the last accepted match, but cap the
+      // carried tail at one window so an unmatched stretch cannot grow
+      // without bound.  Any match no longer than the window still has
+      // its start retained.
+      std::size_t keep_from = consumed;
+
+      if (window.size () - keep_from > window_bytes)
+        keep_from = window.size () - window_bytes;
+
+      window.erase (0, keep_from);
+      origin += keep_from;
+    }
+
+  // In counted mode, reposition after the last returned match so the
+  // next call resumes there.
+
+  if (done && max_count >= 0 && base >= 0)
+    os.seek (resume_pos, SEEK_SET);
+
+  octave_idx_type k = starts.size ();
+
+  RowVector s (k);
+  Cell match (dim_vector (1, k));
+
+  octave_idx_type i = 0;
+  auto ps = starts.begin ();
+  auto pm = matches.begin ();
+
+  while (i < k)
+    {
+      s(i) = *ps++;
+      match(i) = *pm++;
+      i++;
+    }
+
+  return ovl (s, match);
+}
+
+/*
+%!test
+%! tmp = tempname ();
+%! unwind_protect
+%!   fid = fopen (tmp, "w");
+%!   txt = "foo 123 bar 45 baz 6789 qux";
+%!   fputs (fid, txt);
+%!   fclose (fid);
+%!   fid = fopen (tmp, "r");
+%!   [s, m] = fregexp (fid, '\d+');
+%!   assert (feof (fid));
+%!   fclose (fid);
+%!   [s2, m2] = regexp (txt, '\d+');
+%!   assert (s, s2);
+%!   assert (m, regexp (txt, '\d+', "match"));
+%! unwind_protect_cleanup
+%!   unlink (tmp);
+%! end_unwind_protect
+
+%!test
+%! tmp = tempname ();
+%! unwind_protect
+%!   fid = fopen (tmp, "w");
+%!   fputs (fid, "a1 a2 a3");
+%!   fclose (fid);
+%!   fid = fopen (tmp, "r");
+%!   [s, m] = fregexp (fid, 'a\d', 2);
+%!   assert (s, [1, 4]);
+%!   assert (m, {"a1", "a2"});
+%!   [s, m] = fregexp (fid, 'a\d', 2);
+%!   assert (s, 7);
+%!   assert (m, {"a3"});
+%!   [s, m] = fregexp (fid, 'a\d', 2);
+%!   assert (isempty (s));
+%!   fclose (fid);
+%! unwind_protect_cleanup
+%!   unlink (tmp);
+%! end_unwind_protect
+
+%!error <N must be a non-negative integer> fregexp (1, 'x', -1)
+*/
+
 OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,509 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Array.h"
+#include "boolNDArray.h"
+#include "dMatrix.h"
+#include "dNDArray.h"
+#include "dim-vector.h"
+#include "int16NDArray.h"
+#include "int32NDArray.h"
+#include "int64NDArray.h"
+#include "int8NDArray.h"
+#include "lo-fasthash.h"
+#include "lo-ieee.h"
+#include "uint16NDArray.h"
+#include "uint32NDArray.h"
+#include "uint64NDArray.h"
+#include "uint8NDArray.h"
+
+#include "Cell.h"
+#include "defun.h"
+#include "error.h"
+#include "ov.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Hash-based backends for the set functions.  A sort-based ismember
+// costs O((na+ns) log ns); for a large unsorted table a hash join is
+// linear, and a hash-based unique only sorts the distinct values.
+// The m-files decide when to route here; see ismember.m and unique.m.
+
+// The keys stored in the tables below are already canonical bit
+// patterns, so hashing them is just the avalanche mix.
+
+struct bitkey_hash
+{
+  std::size_t operator () (uint64_t key) const
+  { return static_cast<std::size_t> (hash64_mix (key)); }
+};
+
+struct string_hash
+{
+  std::size_t operator () (const std::string& s) const
+  { return static_cast<std::size_t> (hash64_bytes (s.data (), s.length ())); }
+};
+
+// First-occurrence table of S: emplace keeps the lowest index for
+// duplicate values, matching the documented ismember behavior.
+
+typedef std::unordered_map<uint64_t, octave_idx_type, bitkey_hash> bit_table;
+
+static void
+hash_ismember_double (const NDArray& a, const NDArray& s,
+                      boolNDArray& tf, NDArray& idx, bool want_idx)
+{
+  bit_table table;
+  table.reserve (s.numel ());
+
+  for (octave_idx_type i = 0; i < s.numel (); i++)
+    {
+      double val = s.xelem (i);
+
+      // NaN compares unequal to everything, including itself.
+      if (math::isnan (val))
+        continue;
+
+      table.emplace (hash64_double_key (val), i + 1);
+    }
+
+  for (octave_idx_type i = 0; i < a.numel (); i++)
+    {
+      double val = a.xelem (i);
+
+      octave_idx_type match = 0;
+
+      if (! math::isnan (val))
+        {
+          auto it = table.find (hash64_double_key (val));
+
+          if (it != table.end ())
+            match = it->second;
+        }
+
+      tf.xelem (i) = (match != 0);
+
+      if (want_idx)
+        idx.xelem (i) = match;
+    }
+}
+
+template <typename T>
+static void
+hash_ismember_int (const intNDArray<T>& a, const intNDArray<T>& s,
+                   boolNDArray& tf, NDArray& idx, bool want_idx)
+{
+  bit_table table;
+  table.reserve (s.numel ());
+
+  for (octave_idx_type i = 0; i < s.numel (); i++)
+    table.emplace (static_cast<uint64_t> (s.xelem (i).value ()), i + 1);
+
+  for (octave_idx_type i = 0; i < a.numel (); i++)
+    {
+      auto it = table.find (static_cast<uint64_t> (a.xelem (i).value ()));
+
+      octave_idx_type match = (it != table.end () ? it->second : 0);
+
+      tf.xelem (i) = (match != 0);
+
+      if (want_idx)
+        idx.xelem (i) = match;
+    }
+}
+
+static void
+hash_ismember_str (const Array<std::string>& a, const Array<std::string>& s,
+                   boolNDArray& tf, NDArray& idx, bool want_idx)
+{
+  std::unordered_map<std::string, octave_idx_type, string_hash> table;
+  table.reserve (s.numel ());
+
+  for (octave_idx_type i = 0; i < s.numel (); i++)
+    table.emplace (s.xelem (i), i + 1);
+
+  for (octave_idx_type i = 0; i < a.numel (); i++)
+    {
+      auto it = table.find (a.xelem (i));
+
+      octave_idx_type match = (it != table.end () ? it->second : 0);
+
+      tf.xelem (i) = (match != 0);
+
+      if (want_idx)
+        idx.xelem (i) = match;
+    }
+}
+
+// Key for one matrix row: the canonicalized bit patterns of its
+// elements, or empty if the row contains a NaN and thus can never
+// match.  Equal rows produce equal byte strings.
+
+static std::string
+row_key (const Matrix& m, octave_idx_type r)
+{
+  octave_idx_type nr = m.rows ();
+  octave_idx_type nc = m.columns ();
+
+  std::string key (nc * sizeof (uint64_t), '\0');
+
+  const double *data = m.data ();
+
+  for (octave_idx_type j = 0; j < nc; j++)
+    {
+      double val = data[r + j * nr];
+
+      if (math::isnan (val))
+        return "";
+
+      uint64_t bits = hash64_double_key (val);
+      std::memcpy (&key[j * sizeof (uint64_t)], &bits, sizeof (uint64_t));
+    }
+
+  return key;
+}
+
+static void
+hash_ismember_rows (const Matrix& a, const Matrix& s,
+                    boolNDArray& tf, NDArray& idx, bool want_idx)
+{
+  std::unordered_map<std::string, octave_idx_type, string_hash> table;
+  table.reserve (s.rows ());
+
+  for (octave_idx_type i = 0; i < s.rows (); i++)
+    {
+      std::string key = row_key (s, i);
+
+      if (! key.empty ())
+        table.emplace (key, i + 1);
+    }
+
+  for (octave_idx_type i = 0; i < a.rows (); i++)
+    {
+      octave_idx_type match = 0;
+
+      std::string key = row_key (a, i);
+
+      if (! key.empty ())
+        {
+          auto it = table.find (key);
+
+          if (it != table.end ())
+            match = it->second;
+        }
+
+      tf.xelem (i) = (match != 0);
+
+      if (want_idx)
+        idx.xelem (i) = match;
+    }
+}
+
+DEFUN (__hash_ismember__, args, nargout,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {[@var{tf}, @var{s_idx}] =} __hash_ismember__ (@var{a}, @var{s})
+@deftypefnx {} {[@var{tf}, @var{s_idx}] =} __hash_ismember__ (@var{a}, @var{s}, "rows")
+Undocumented internal function.
+
+Hash join backend for @code{ismember}: membership of the elements (or
+rows) of @var{a} in @var{s} in linear time, without sorting @var{s}.
+@var{s_idx} holds the lowest matching index or zero.
+@seealso{ismember}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+
+  octave_value a = args(0);
+  octave_value s = args(1);
+
+  bool want_idx = (nargout > 1);
+
+  boolNDArray tf;
+  NDArray idx;
+
+  if (nargin == 3)
+    {
+      if (args(2).xstring_value ("__hash_ismember__: invalid option")
+          != "rows")
+        error ("__hash_ismember__: invalid option");
+
+      Matrix am = a.matrix_value ();
+      Matrix sm = s.matrix_value ();
+
+      if (am.columns () != sm.columns ())
+        error ("__hash_ismember__: number of columns must match");
+
+      dim_vector dv (am.rows (), 1);
+      tf = boolNDArray (dv);
+      if (want_idx)
+        idx = NDArray (dv);
+
+      hash_ismember_rows (am, sm, tf, idx, want_idx);
+    }
+  else
+    {
+      dim_vector dv = a.dims ();
+      tf = boolNDArray (dv);
+      if (want_idx)
+        idx = NDArray (dv);
+
+      if (a.iscellstr () && s.iscellstr ())
+        hash_ismember_str (a.cellstr_value (), s.cellstr_value (),
+                           tf, idx, want_idx);
+      else if (a.isinteger () || s.isinteger ())
+        {
+          if (a.class_name () != s.class_name ())
+            error ("__hash_ismember__: A and S must have the same class");
+
+          if (a.is_int8_type ())
+            hash_ismember_int (a.int8_array_value (), s.int8_array_value (),
+                               tf, idx, want_idx);
+          else if (a.is_int16_type ())
+            hash_ismember_int (a.int16_array_value (), s.int16_array_value (),
+                               tf, idx, want_idx);
+          else if (a.is_int32_type ())
+            hash_ismember_int (a.int32_array_value (), s.int32_array_value (),
+                               tf, idx, want_idx);
+          else if (a.is_int64_type ())
+            hash_ismember_int (a.int64_array_value (), s.int64_array_value (),
+                               tf, idx, want_idx);
+          else if (a.is_uint8_type ())
+            hash_ismember_int (a.uint8_array_value (), s.uint8_array_value (),
+                               tf, idx, want_idx);
+          else if (a.is_uint16_type ())
+            hash_ismember_int (a.uint16_array_value (),
+                               s.uint16_array_value (), tf, idx, want_idx);
+          else if (a.is_uint32_type ())
+            hash_ismember_int (a.uint32_array_value (),
+                               s.uint32_array_value (), tf, idx, want_idx);
+          else
+            hash_ismember_int (a.uint64_array_value (),
+                               s.uint64_array_value (), tf, idx, want_idx);
+        }
+      else if (a.iscomplex () || s.iscomplex ())
+        error ("__hash_ismember__: A and S must be real");
+      else
+        hash_ismember_double (a.array_value (), s.array_value (),
+                              tf, idx, want_idx);
+    }
+
+  if (want_idx)
+    return ovl (tf, idx);
+  else
+    return ovl (tf);
+}
+
+/*
+%!test
+%! s = [5, 3, 3, NaN, -0, 7];
+%! [tf, idx] = __hash_ismember__ ([3, 0, NaN, 8, 7], s);
+%! assert (tf, logical ([1, 1, 0, 0, 1]));
+%! assert (idx, [2, 5, 0, 0, 6]);
+
+%!test
+%! [tf, idx] = __hash_ismember__ (int64 ([intmax("int64"), 1]), ...
+%!                                int64 ([intmax("int64"), 2]));
+%! assert (tf, logical ([1, 0]));
+%! assert (idx, [1, 0]);
+
+%!test
+%! [tf, idx] = __hash_ismember__ ({"b", "x", "a"}, {"a", "b", "b"});
+%! assert (tf, logical ([1, 0, 1]));
+%! assert (idx, [2, 0, 1]);
+
+%!test
+%! a = [1:3; 5:7; 4:6];
+%! s = [0:2; 1:3; 2:4; 3:5; 4:6];
+%! [tf, idx] = __hash_ismember__ (a, s, "rows");
+%! assert (tf, logical ([1; 0; 1]));
+%! assert (idx, [2; 0; 5]);
+
+%!test
+%! ## Rows containing NaN never match.
+%! [tf, idx] = __hash_ismember__ ([1, NaN], [1, NaN], "rows");
+%! assert (tf, false);
+%! assert (idx, 0);
+
+%!error __hash_ismember__ ()
+%!error <same class> __hash_ismember__ (int8 (1), int16 (1))
+*/
+
+static NDArray
+hash_unique_double (const NDArray& x)
+{
+  std::unordered_map<uint64_t, double, bitkey_hash> seen;
+  seen.reserve (x.numel ());
+
+  std::vector<double> vals;
+
+  octave_idx_type num_nan = 0;
+
+  for (octave_idx_type i = 0; i < x.numel (); i++)
+    {
+      double val = x.xelem (i);
+
+      // Each NaN is distinct from every other, so all are kept.
+      if (math::isnan (val))
+        {
+          num_nan++;
+          continue;
+        }
+
+      if (seen.emplace (hash64_double_key (val), val).second)
+        vals.push_back (val);
+    }
+
+  std::sort (vals.begin (), vals.end ());
+
+  NDArray retval (dim_vector (vals.size () + num_nan, 1));
+
+  octave_idx_type k = 0;
+
+  for (double val : vals)
+    retval.xelem (k++) = val;
+
+  for (octave_idx_type i = 0; i < num_nan; i++)
+    retval.xelem (k++) = lo_ieee_nan_value ();
+
+  return retval;
+}
+
+template <typename T>
+static intNDArray<T>
+hash_unique_int (const intNDArray<T>& x)
+{
+  bit_table seen;
+  seen.reserve (x.numel ());
+
+  std::vector<T> vals;
+
+  for (octave_idx_type i = 0; i < x.numel (); i++)
+    {
+      T val = x.xelem (i);
+
+      if (seen.emplace (static_cast<uint64_t> (val.value ()), 1).second)
+        vals.push_back (val);
+    }
+
+  std::sort (vals.begin (), vals.end ());
+
+  intNDArray<T> retval (dim_vector (vals.size (), 1));
+
+  for (std::size_t i = 0; i < vals.size (); i++)
+    retval.xelem (i) = vals[i];
+
+  return retval;
+}
+
+static Cell
+hash_unique_str (const Array<std::string>& x)
+{
+  std::unordered_map<std::string, char, string_hash> seen;
+  seen.reserve (x.numel ());
+
+  std::vector<std::string> vals;
+
+  for (octave_idx_type i = 0; i < x.numel (); i++)
+    if (seen.emplace (x.xelem (i), 1).second)
+      vals.push_back (x.xelem (i));
+
+  std::sort (vals.begin (), vals.end ());
+
+  Cell retval (dim_vector (vals.size (), 1));
+
+  for (std::size_t i = 0; i < vals.size (); i++)
+    retval.xelem (i) = vals[i];
+
+  return retval;
+}
+
+DEFUN (__hash_unique__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{y} =} __hash_unique__ (@var{x})
+Undocumented internal function.
+
+Hash backend for @code{unique}: the sorted distinct values of @var{x}
+as a column vector, collected in linear time so only the distinct
+values need sorting.  Numeric input that is not an integer type is
+returned as double; the caller restores the class.
+@seealso{unique}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_value x = args(0);
+
+  if (x.iscellstr ())
+    return ovl (hash_unique_str (x.cellstr_value ()));
+  else if (x.is_int8_type ())
+    return ovl (hash_unique_int (x.int8_array_value ()));
+  else if (x.is_int16_type ())
+    return ovl (hash_unique_int (x.int16_array_value ()));
+  else if (x.is_int32_type ())
+    return ovl (hash_unique_int (x.int32_array_value ()));
+  else if (x.is_int64_type ())
+    return ovl (hash_unique_int (x.int64_array_value ()));
+  else if (x.is_uint8_type ())
+    return ovl (hash_unique_int (x.uint8_array_value ()));
+  else if (x.is_uint16_type ())
+    return ovl (hash_unique_int (x.uint16_array_value ()));
+  else if (x.is_uint32_type ())
+    return ovl (hash_unique_int (x.uint32_array_value ()));
+  else if (x.is_uint64_type ())
+    return ovl (hash_unique_int (x.uint64_array_value ()));
+  else if (x.iscomplex ())
+    error ("__hash_unique__: X must be real");
+  else
+    return ovl (hash_unique_double (x.array_value ()));
+}
+
+/*
+%!assert (__hash_unique__ ([3, 1, 3, -0, 0, 2]), [0; 1; 2; 3])
+%!assert (__hash_unique__ ([2, NaN, 1, NaN]), [1; 2; NaN; NaN])
+%!assert (__hash_unique__ (uint8 ([255, 0, 255])), uint8 ([0; 255]))
+%!assert (__hash_unique__ ({"b", "a", "b"}), {"a"; "b"})
+
+%!error __hash_unique__ ()
+%!error <must be real> __hash_unique__ (1i)
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,517 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include <string>
+
+#include "Array.h"
+#include "CNDArray.h"
+#include "boolNDArray.h"
+#include "chNDArray.h"
+#include "dNDArray.h"
+#include "dim-vector.h"
+#include "fCNDArray.h"
+#include "fNDArray.h"
+#include "int16NDArray.h"
+#include "int32NDArray.h"
+#include "int64NDArray.h"
+#include "int8NDArray.h"
+#include "oct-shmem.h"
+#include "uint16NDArray.h"
+#include "uint32NDArray.h"
+#include "uint64NDArray.h"
+#include "uint8NDArray.h"
+
+#include "defun.h"
+#include "error.h"
+#include "ov.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A segment written by shmwrite starts with a fixed header:
+//
+//   bytes 0-7    magic string "OCTSHM01"
+//   bytes 8-11   element type code (see the switches below)
+//   bytes 12-15  number of dimensions
+//   bytes 16-    dimensions, one int64 each
+//
+// The array data begins at a page-size offset so that shmread can hand
+// the mapped memory directly to an Array rep; when the last reference
+// to that rep dies, the release hook recovers the mapping base from
+// the data pointer and unmaps the whole segment.
+
+// Unmap the segment that DATA points into.  Installed as the Array
+// disposal hook by shmread.
+
+template <typename T>
+static void
+release_mapping (T *data, std::size_t len)
+{
+  std::size_t off = sys::shmem_page_size ();
+
+  sys::shmem_detach (reinterpret_cast<char *> (data) - off,
+                     off + len * sizeof (T));
+}
+
+template <typename T>
+static void
+write_segment (const std::string& name, int32_t type_code, const Array<T>& a)
+{
+  const dim_vector dv = a.dims ();
+
+  std::size_t off = sys::shmem_page_size ();
+
+  if (16 + 8 * static_cast<std::size_t> (dv.ndims ()) > off)
+    error ("shmwrite: too many dimensions");
+
+  std::size_t nbytes = off + a.numel () * sizeof (T);
+
+  char *base = static_cast<char *> (sys::shmem_create (name, nbytes));
+
+  if (! base)
+    error ("shmwrite: unable to create shared memory segment '%s'",
+           name.c_str ());
+
+  std::memcpy (base, "OCTSHM01", 8);
+
+  int32_t *hdr = reinterpret_cast<int32_t *> (base + 8);
+  hdr[0] = type_code;
+  hdr[1] = dv.ndims ();
+
+  int64_t *dims = reinterpret_cast<int64_t *> (base + 16);
+  for (int i = 0; i < dv.ndims (); i++)
+    dims[i] = dv(i);
+
+  std::memcpy (base + off, a.data (), a.numel () * sizeof (T));
+
+  sys::shmem_detach (base, nbytes);
+}
+
+// Map the data region of the segment at BASE as an array without
+// copying it.  The returned array owns the mapping; no shmem_detach
+// call is needed on this path.
+
+template <typename T>
+static Array<T>
+make_mapped_array (char *base, std::size_t nbytes, const dim_vector& dv)
+{
+  std::size_t off = sys::shmem_page_size ();
+
+  octave_idx_type len = dv.safe_numel ();
+
+  if (off + len * sizeof (T) > nbytes)
+    {
+      sys::shmem_detach (base, nbytes);
+      error ("shmread: segment is smaller than its header claims");
+    }
+
+  return Array<T> (reinterpret_cast<T *> (base + off), dv,
+                   release_mapping<T>);
+}
+
+DEFUN (shmwrite, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {} shmwrite (@var{name}, @var{A})
+Store the array @var{A} in the named shared memory segment @var{name}.
+
+The segment is created if necessary and replaces any previous contents.
+It persists until it is removed with @code{shmunlink}, so other Octave
+processes on the same machine may retrieve the array with
+@code{shmread} without the data being copied through a pipe or a file.
+
+@var{name} is a system-wide identifier and should look like a filename
+with a single leading slash, for example @qcode{"/octave-data"}.
+@var{A} must be a full numeric, logical, or character array.
+
+Shared memory segments are only available on Unix-like systems.
+@seealso{shmread, shmunlink}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  std::string name = args(0).xstring_value ("shmwrite: NAME must be a string");
+
+  octave_value val = args(1);
+
+  if (val.issparse ())
+    error ("shmwrite: A must be a full array, not sparse");
+
+  if (val.iscomplex ())
+    {
+      if (val.is_single_type ())
+        write_segment (name, 3, val.float_complex_array_value ());
+      else
+        write_segment (name, 2, val.complex_array_value ());
+    }
+  else if (val.islogical ())
+    write_segment (name, 12, val.bool_array_value ());
+  else if (val.is_string ())
+    write_segment (name, 13, val.char_array_value ());
+  else if (val.isinteger ())
+    {
+      if (val.is_int8_type ())
+        write_segment (name, 4, val.int8_array_value ());
+      else if (val.is_int16_type ())
+        write_segment (name, 5, val.int16_array_value ());
+      else if (val.is_int32_type ())
+        write_segment (name, 6, val.int32_array_value ());
+      else if (val.is_int64_type ())
+        write_segment (name, 7, val.int64_array_value ());
+      else if (val.is_uint8_type ())
+        write_segment (name, 8, val.uint8_array_value ());
+      else if (val.is_uint16_type ())
+        write_segment (name, 9, val.uint16_array_value ());
+      else if (val.is_uint32_type ())
+        write_segment (name, 10, val.uint32_array_value ());
+      else
+        write_segment (name, 11, val.uint64_array_value ());
+    }
+  else if (val.isnumeric ())
+    {
+      if (val.is_single_type ())
+        write_segment (name, 1, val.float_array_value ());
+      else
+        write_segment (name, 0, val.array_value ());
+    }
+  else
+    error ("shmwrite: A must be a full numeric, logical, or character array");
+
+  return ovl ();
+}
+
+/*
+%!test
+%! if (isunix ())
+%!   nm = sprintf ("/octave-shmem-%d", getpid ());
+%!   unwind_protect
+%!     a = magic (4);
+%!     shmwrite (nm, a);
+%!     assert (shmread (nm), a);
+%!   unwind_protect_cleanup
+%!     shmunlink (nm);
+%!   end_unwind_protect
+%! endif
+
+%!test
+%! if (isunix ())
+%!   nm = sprintf ("/octave-shmem-%d", getpid ());
+%!   unwind_protect
+%!     shmwrite (nm, int32 ([1, 2; 3, 4]));
+%!     assert (shmread (nm), int32 ([1, 2; 3, 4]));
+%!     shmwrite (nm, [1, 2, 3] > 2);
+%!     assert (shmread (nm), logical ([0, 0, 1]));
+%!   unwind_protect_cleanup
+%!     shmunlink (nm);
+%!   end_unwind_protect
+%! endif
+
+%!error shmwrite ()
+%!error shmwrite ("/octave-shmem-err")
+%!error <NAME must be a string> shmwrite (1, 2)
+%!error <must be a full array> shmwrite ("/octave-shmem-err", sparse (eye (3)))
+%!error <must be a full numeric> shmwrite ("/octave-shmem-err", {1, 2})
+*/
+
+DEFUN (shmread, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{A} =} shmread (@var{name})
+Retrieve the array stored in the named shared memory segment @var{name}.
+
+The mapped memory is used as the array data directly, so no copy is
+made no matter how large the array is; the operating system releases
+the mapping when the returned value is no longer referenced.  The
+mapping is private, so modifying @var{A} afterwards does not disturb
+the segment or other processes reading it.
+
+Shared memory segments are only available on Unix-like systems.
+@seealso{shmwrite, shmunlink}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  std::string name = args(0).xstring_value ("shmread: NAME must be a string");
+
+  std::size_t nbytes = 0;
+  char *base = static_cast<char *> (sys::shmem_attach (name, nbytes));
+
+  if (! base)
+    error ("shmread: unable to open shared memory segment '%s'",
+           name.c_str ());
+
+  std::size_t off = sys::shmem_page_size ();
+
+  if (nbytes < off || std::memcmp (base, "OCTSHM01", 8) != 0)
+    {
+      sys::shmem_detach (base, nbytes);
+      error ("shmread: segment '%s' was not written by shmwrite",
+             name.c_str ());
+    }
+
+  const int32_t *hdr = reinterpret_cast<const int32_t *> (base + 8);
+  int32_t type_code = hdr[0];
+  int32_t ndims = hdr[1];
+
+  if (ndims < 2 || 16 + 8 * static_cast<std::size_t> (ndims) > off)
+    {
+      sys::shmem_detach (base, nbytes);
+      error ("shmread: segment '%s' has an invalid header", name.c_str ());
+    }
+
+  const int64_t *dims = reinterpret_cast<const int64_t *> (base + 16);
+
+  dim_vector dv;
+  dv.resize (ndims);
+  for (int32_t i = 0; i < ndims; i++)
+    dv(i) = dims[i];
+
+  switch (type_code)
+    {
+    case 0:
+      return ovl (NDArray (make_mapped_array<double> (base, nbytes, dv)));
+
+    case 1:
+      return ovl (FloatNDArray (make_mapped_array<float> (base, nbytes, dv)));
+
+    case 2:
+      return ovl (ComplexNDArray (make_mapped_array<Complex> (base, nbytes,
+                                                              dv)));
+
+    case 3:
+      return ovl (FloatComplexNDArray (make_mapped_array<FloatComplex>
+                                         (base, nbytes, dv)));
+
+    case 4:
+      return ovl (int8NDArray (make_mapped_array<octave_int8> (base, nbytes,
+                                                               dv)));
+
+    case 5:
+      return ovl (int16NDArray (make_mapped_array<octave_int16> (base, nbytes,
+                                                                 dv)));
+
+    case 6:
+      return ovl (int32NDArray (make_mapped_array<octave_int32> (base, nbytes,
+                                                                 dv)));
+
+    case 7:
+      return ovl (int64NDArray (make_mapped_array<octave_int64> (base, nbytes,
+                                                                 dv)));
+
+    case 8:
+      return ovl (uint8NDArray (make_mapped_array<octave_uint8> (base, nbytes,
+                                                                 dv)));
+
+    case 9:
+      return ovl (uint16NDArray (make_mapped_array<octave_uint16>
+                                   (base, nbytes, dv)));
+
+    case 10:
+      return ovl (uint32NDArray (make_mapped_array<octave_uint32>
+                                   (base, nbytes, dv)));
+
+    case 11:
+      return ovl (uint64NDArray (make_mapped_array<octave_uint64>
+                                   (base, nbytes, dv)));
+
+    case 12:
+      return ovl (boolNDArray (make_mapped_array<bool> (base, nbytes, dv)));
+
+    case 13:
+      return ovl (charNDArray (make_mapped_array<char> (base, nbytes, dv)));
+
+    default:
+      sys::shmem_detach (base, nbytes);
+      error ("shmread: segment '%s' has an unknown element type",
+             name.c_str ());
+    }
+}
+
+/*
+%!test
+%! if (isunix ())
+%!   nm = sprintf ("/octave-shmem-%d", getpid ());
+%!   unwind_protect
+%!     a = rand (100, 3);
+%!     shmwrite (nm, a);
+%!     b = shmread (nm);
+%!     assert (b, a);
+%!     ## The mapping is copy-on-write: changing the local copy must
+%!     ## not disturb the segment.
+%!     b(1) = 42;
+%!     assert (shmread (nm), a);
+%!   unwind_protect_cleanup
+%!     shmunlink (nm);
+%!   end_unwind_protect
+%! endif
+
+%!test
+%! if (isunix ())
+%!   nm = sprintf ("/octave-shmem-%d", getpid ());
+%!   unwind_protect
+%!     shmwrite (nm, "hello");
+%!     assert (shmread (nm), "hello");
+%!     shmwrite (nm, single (pi) * ones (2, 3, 4));
+%!     assert (shmread (nm), single (pi) * ones (2, 3, 4));
+%!   unwind_protect_cleanup
+%!     shmunlink (nm);
+%!   end_unwind_protect
+%! endif
+
+%!error shmread ()
+%!error <NAME must be a string> shmread (1)
+%!test
+%! if (isunix ())
+%!   fail ('shmread ("/octave-shmem-no-such-segment")', ...
+%!         "unable to open");
+%! endif
+*/
+
+DEFUN (shmunlink, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{ok} =} shmunlink (@var{name})
+Remove the named shared memory segment @var{name}.
+
+Arrays already retrieved from the segment with @code{shmread} remain
+valid; the memory itself is released once the last of them is cleared.
+The return value is true if the segment existed and was removed.
+
+Shared memory segments are only available on Unix-like systems.
+@seealso{shmwrite, shmread}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  std::string name
+    = args(0).xstring_value ("shmunlink: NAME must be a string");
+
+  return ovl (sys::shmem_unlink (name));
+}
+
+/*
+%!test
+%! if (isunix ())
+%!   nm = sprintf ("/octave-shmem-%d", getpid ());
+%!   shmwrite (nm, 1:10);
+%!   ## Values read before the segment is unlinked survive it.
+%!   a = shmread (nm);
+%!   assert (shmunlink (nm), true);
+%!   assert (a, 1:10);
+%!   assert (shmunlink (nm), false);
+%! endif
+
+%!error shmunlink ()
+%!error <NAME must be a string> shmunlink (1)
+*/
+
+DEFUN (ismapped, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{tf} =} ismapped (@var{x})
+Return true if the elements of @var{x} live in a memory mapping rather
+than in ordinary heap storage.
+
+This is the case for arrays returned by @code{shmread} and for large
+numeric arrays loaded from MAT binary files, whose pages are mapped
+copy-on-write from the file and shared with every other process that
+has loaded the same file.  Writing to a mapped array is safe; modified
+pages become private copies without affecting the file or other
+processes.
+
+For any other value @code{ismapped} returns false.
+@seealso{shmread, load}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_value val = args(0);
+
+  bool mapped = false;
+
+  if (val.is_double_type () && ! val.iscomplex ())
+    mapped = val.array_value ().adopted_storage ();
+  else if (val.is_single_type () && ! val.iscomplex ())
+    mapped = val.float_array_value ().adopted_storage ();
+  else if (val.is_double_type ())
+    mapped = val.complex_array_value ().adopted_storage ();
+  else if (val.is_single_type ())
+    mapped = val.float_complex_array_value ().adopted_storage ();
+  else if (val.is_int8_type ())
+    mapped = val.int8_array_value ().adopted_storage ();
+  else if (val.is_int16_type ())
+    mapped = val.int16_array_value ().adopted_storage ();
+  else if (val.is_int32_type ())
+    mapped = val.int32_array_value ().adopted_storage ();
+  else if (val.is_int64_type ())
+    mapped = val.int64_array_value ().adopted_storage ();
+  else if (val.is_uint8_type ())
+    mapped = val.uint8_array_value ().adopted_storage ();
+  else if (val.is_uint16_type ())
+    mapped = val.uint16_array_value ().adopted_storage ();
+  else if (val.is_uint32_type ())
+    mapped = val.uint32_array_value ().adopted_storage ();
+  else if (val.is_uint64_type ())
+    mapped = val.uint64_array_value ().adopted_storage ();
+  else if (val.islogical ())
+    mapped = val.bool_array_value ().adopted_storage ();
+  else if (val.is_char_matrix ())
+    mapped = val.char_array_value ().adopted_storage ();
+
+  return ovl (mapped);
+}
+
+/*
+%!assert (ismapped (1:10), false)
+%!assert (ismapped ("abc"), false)
+%!assert (ismapped ({1, 2}), false)
+
+%!test
+%! if (isunix ())
+%!   nm = sprintf ("/octave-shmem-%d", getpid ());
+%!   unwind_protect
+%!     shmwrite (nm, rand (10, 10));
+%!     a = shmread (nm);
+%!     assert (ismapped (a), true);
+%!     ## A deep copy drops the mapping.
+%!     b = a(:, 1:5);
+%!     assert (ismapped (b), false);
+%!   unwind_protect_cleanup
+%!     shmunlink (nm);
+%!   end_unwind_protect
+%! endif
+
+%!error ismapped ()
+%!error ismapped (1, 2)
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#include <string>
+
+#if ! defined (OCTAVE_USE_WINDOWS_API)
+#  include <netdb.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <sys/socket.h>
+#  include <sys/types.h>
+#  include <unistd.h>
+#endif
+
+#include "defun.h"
+#include "error.h"
+#include "interpreter.h"
+#include "oct-stdstrm.h"
+#include "oct-stream.h"
+#include "ovl.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Network byte streams for live data feeds.  A connected TCP socket
+// is wrapped in the ordinary stdiostream machinery, so the resulting
+// fid works with fread, fgetl, fwrite, and friends, with stdio
+// buffering between the reader and the socket; fread with a uint8
+// precision hands binary frames to the script as uint8 arrays without
+// a sidecar process in between.  The background read-ahead used for
+// regular files stays off for these streams (it is gated on the file
+// being a regular file), so a read never blocks for more than the
+// bytes it asked for beyond stdio's own buffering.
+
+#if ! defined (OCTAVE_USE_WINDOWS_API)
+
+// Resolve HOST:PORT and connect, returning the fd or -1 with ERRMSG
+// set.
+
+static int
+connect_tcp (const std::string& host, int port, std::string& errmsg)
+{
+  struct addrinfo hints;
+  std::memset (&hints, 0, sizeof (hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+
+  std::string service = std::to_string (port);
+
+  struct addrinfo *info = nullptr;
+
+  int status = getaddrinfo (host.c_str (), service.c_str (), &hints, &info);
+
+  if (status != 0)
+    {
+      errmsg = gai_strerror (status);
+      return -1;
+    }
+
+  int fd = -1;
+
+  for (struct addrinfo *p = info; p; p = p->ai_next)
+    {
+      fd = ::socket (p->ai_family, p->ai_socktype, p->ai_protocol);
+
+      if (fd < 0)
+        continue;
+
+      if (::connect (fd, p->ai_addr, p->ai_addrlen) == 0)
+        break;
+
+      errmsg = std::strerror (errno);
+
+      ::close (fd);
+      fd = -1;
+    }
+
+  freeaddrinfo (info);
+
+  if (fd < 0 && errmsg.empty ())
+    errmsg = "no usable address";
+
+  if (fd >= 0)
+    {
+      // Feed consumers care about per-message latency, not
+      // throughput; don't let Nagle batch small writes.
+      int on = 1;
+      setsockopt (fd, IPPROTO_TCP, TCP_NODELAY,
+                  reinterpret_cast<const char *> (&on), sizeof (on));
+    }
+
+  return fd;
+}
+
+#endif
+
+DEFMETHOD (sockopen, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn {} {@var{fid} =} sockopen (@var{host}, @var{port})
+Open a TCP connection to @var{host}:@var{port} and return a file id
+for it.
+
+The returned @var{fid} behaves like a file opened for reading and
+writing: read incoming data with @code{fread} or @code{fgetl}, send
+with @code{fwrite} or @code{fputs}, and disconnect with
+@code{fclose}.  Binary messages are best read with a @code{uint8}
+precision, for example:
+
+@example
+@group
+fid = sockopen ("feed.example.com", 9000);
+hdr = fread (fid, 8, "uint8=>uint8");
+msg = fread (fid, msglen (hdr), "uint8=>uint8");
+@end group
+@end example
+
+The stream cannot seek; @code{fseek} and @code{ftell} fail on it.
+@code{TCP_NODELAY} is set so small writes go out immediately.
+@seealso{fread, fwrite, fclose, popen}
+@end deftypefn */)
+{
+  if (args.length () != 2)
+    print_usage ();
+
+  std::string host
+    = args(0).xstring_value ("sockopen: HOST must be a string");
+
+  int port = args(1).xint_value ("sockopen: PORT must be an integer");
+
+  if (port < 1 || port > 65535)
+    error ("sockopen: PORT must be between 1 and 65535");
+
+#if defined (OCTAVE_USE_WINDOWS_API)
+
+  octave_unused_parameter (interp);
+
+  error ("sockopen: not supported on this platform");
+
+#else
+
+  std::string errmsg;
+
+  int fd = connect_tcp (host, port, errmsg);
+
+  if (fd < 0)
+    error ("sockopen: unable to connect to %s:%d: %s",
+           host.c_str (), port, errmsg.c_str ());
+
+  FILE *fp = fdopen (fd, "r+");
+
+  if (! fp)
+    {
+      ::close (fd);
+      error ("sockopen: unable to create stream for %s:%d",
+             host.c_str (), port);
+    }
+
+  std::string name = "tcp://" + host + ':' + std::to_string (port);
+
+  stream s = stdiostream::create (name, fp,
+                                  std::ios::in | std::ios::out
+                                  | std::ios::binary);
+
+  stream_list& streams = interp.get_stream_list ();
+
+  return ovl (streams.insert (s));
+
+#endif
+}
+
+/*
+%!error <HOST must be a string> sockopen (1, 80)
+%!error <PORT must be between 1 and 65535> sockopen ("localhost", 0)
+%!error sockopen ("just-one-arg")
+*/
+
+OCTAVE_END_NAMESPACE(octave)
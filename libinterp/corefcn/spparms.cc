@@ -98,6 +98,20 @@ by the @sc{lapack} banded solvers (default 0.5)
 @item umfpack
 Flag whether the @sc{umfpack} or mmd solvers are used for the LU, '\' and
 '/' operations (default 1)
+
+@item mul_threads
+Number of threads used for large sparse matrix products when Octave was
+built with OpenMP support; 0 means choose automatically from the number
+of available processors and 1 disables threading (default 0)
+
+@item nd_order
+Flag whether the sparse Cholesky and LU factorizations prefer a
+@sc{metis}-style nested dissection fill-reducing ordering over the
+default @sc{amd}/@sc{colamd} orderings.  Nested dissection is slower to
+compute but can reduce fill, and therefore memory use, substantially for
+matrices arising from 2-D and 3-D meshes.  It is only used when the
+@sc{suitesparse} libraries were built with @sc{metis} support; otherwise
+the default orderings are used (default 0)
 @end table
 
 The value of individual keys can be set with
@@ -177,11 +191,11 @@ longer running time.
 %! old_vals = spparms ();  # save state
 %! spparms ("default");
 %! vals = spparms ();
-%! assert (vals, [0 1 1 0 3 3 0.5 1.0 1.0 0.1 0.5 1.0 0.001]');
+%! assert (vals, [0 1 1 0 3 3 0.5 1.0 1.0 0.1 0.5 1.0 0.001 0 0]');
 %! [keys, vals] = spparms ();
-%! assert (rows (keys), 13);
+%! assert (rows (keys), 15);
 %! assert (keys(2,:), "ths_rel");
-%! assert (vals, [0 1 1 0 3 3 0.5 1.0 1.0 0.1 0.5 1.0 0.001]');
+%! assert (vals, [0 1 1 0 3 3 0.5 1.0 1.0 0.1 0.5 1.0 0.001 0 0]');
 %! spparms ([3 2 1]);
 %! assert (spparms ()(1:3), [3, 2, 1]');
 %! assert (spparms ("ths_rel"), 2);
@@ -195,7 +209,7 @@ longer running time.
 %!error <KEY not recognized> spparms ("UNKNOWN_KEY")
 %!#error <input must be a string> spparms ({1, 2, 3})
 %!error spparms ({1, 2, 3})
-%!error <too many elements in vector VALS> spparms (ones (14, 1))
+%!error <too many elements in vector VALS> spparms (ones (16, 1))
 %!error <first argument must be a string> spparms (1, 1)
 %!#error <second argument must be a real scalar> spparms ("ths_rel", "hello")
 %!error spparms ("ths_rel", "hello")
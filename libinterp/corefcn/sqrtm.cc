@@ -28,7 +28,9 @@
 #endif
 
 #include "schur.h"
+#include "f77-fcn.h"
 #include "lo-ieee.h"
+#include "lo-lapack-proto.h"
 #include "lo-mappers.h"
 #include "oct-norm.h"
 
@@ -41,8 +43,8 @@
 OCTAVE_BEGIN_NAMESPACE(octave)
 
 template <typename Matrix>
-static void
-sqrtm_utri_inplace (Matrix& T)
+static bool
+sqrtm_utri_unblocked (Matrix& T)
 {
   typedef typename Matrix::element_type element_type;
 
@@ -88,6 +90,177 @@ sqrtm_utri_inplace (Matrix& T)
         }
     }
 
+  return singular;
+}
+
+// Solve A*X + X*B = C for X, overwriting C, where A and B are upper
+// triangular factors already in place inside a larger matrix (hence
+// the explicit leading dimensions).
+
+static void
+sylvester_solve (F77_INT m, F77_INT n,
+                 const double *a, F77_INT lda,
+                 const double *b, F77_INT ldb,
+                 double *c, F77_INT ldc)
+{
+  double scale;
+  F77_INT info;
+
+  F77_XFCN (dtrsyl, DTRSYL, (F77_CONST_CHAR_ARG2 ("N", 1),
+                             F77_CONST_CHAR_ARG2 ("N", 1),
+                             1, m, n, a, lda, b, ldb, c, ldc,
+                             scale, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
+
+  if (scale != 1)
+    for (F77_INT j = 0; j < n; j++)
+      for (F77_INT i = 0; i < m; i++)
+        c[i + j * ldc] /= scale;
+}
+
+static void
+sylvester_solve (F77_INT m, F77_INT n,
+                 const float *a, F77_INT lda,
+                 const float *b, F77_INT ldb,
+                 float *c, F77_INT ldc)
+{
+  float scale;
+  F77_INT info;
+
+  F77_XFCN (strsyl, STRSYL, (F77_CONST_CHAR_ARG2 ("N", 1),
+                             F77_CONST_CHAR_ARG2 ("N", 1),
+                             1, m, n, a, lda, b, ldb, c, ldc,
+                             scale, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
+
+  if (scale != 1)
+    for (F77_INT j = 0; j < n; j++)
+      for (F77_INT i = 0; i < m; i++)
+        c[i + j * ldc] /= scale;
+}
+
+static void
+sylvester_solve (F77_INT m, F77_INT n,
+                 const Complex *a, F77_INT lda,
+                 const Complex *b, F77_INT ldb,
+                 Complex *c, F77_INT ldc)
+{
+  double scale;
+  F77_INT info;
+
+  F77_XFCN (ztrsyl, ZTRSYL, (F77_CONST_CHAR_ARG2 ("N", 1),
+                             F77_CONST_CHAR_ARG2 ("N", 1),
+                             1, m, n,
+                             F77_CONST_DBLE_CMPLX_ARG (a), lda,
+                             F77_CONST_DBLE_CMPLX_ARG (b), ldb,
+                             F77_DBLE_CMPLX_ARG (c), ldc,
+                             scale, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
+
+  if (scale != 1)
+    for (F77_INT j = 0; j < n; j++)
+      for (F77_INT i = 0; i < m; i++)
+        c[i + j * ldc] /= scale;
+}
+
+static void
+sylvester_solve (F77_INT m, F77_INT n,
+                 const FloatComplex *a, F77_INT lda,
+                 const FloatComplex *b, F77_INT ldb,
+                 FloatComplex *c, F77_INT ldc)
+{
+  float scale;
+  F77_INT info;
+
+  F77_XFCN (ctrsyl, CTRSYL, (F77_CONST_CHAR_ARG2 ("N", 1),
+                             F77_CONST_CHAR_ARG2 ("N", 1),
+                             1, m, n,
+                             F77_CONST_CMPLX_ARG (a), lda,
+                             F77_CONST_CMPLX_ARG (b), ldb,
+                             F77_CMPLX_ARG (c), ldc,
+                             scale, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
+
+  if (scale != 1)
+    for (F77_INT j = 0; j < n; j++)
+      for (F77_INT i = 0; i < m; i++)
+        c[i + j * ldc] /= scale;
+}
+
+// Blocked variant of the recurrence following Deadman, Higham, and
+// Ralha ("Blocked Schur Algorithms for Computing the Matrix Square
+// Root").  Diagonal blocks use the scalar recurrence above; each
+// off-diagonal block of the root satisfies a Sylvester equation whose
+// right-hand side is downdated with matrix products, so almost all of
+// the work runs in (threaded) level-3 BLAS and LAPACK TRSYL.
+
+template <typename Matrix>
+static void
+sqrtm_utri_inplace (Matrix& T)
+{
+  typedef typename Matrix::element_type element_type;
+
+  static const octave_idx_type blksize = 64;
+
+  octave_idx_type n = T.rows ();
+
+  bool singular = false;
+
+  if (n <= 2 * blksize)
+    singular = sqrtm_utri_unblocked (T);
+  else
+    {
+      octave_idx_type nblk = (n + blksize - 1) / blksize;
+
+      auto blk_off = [n, nblk] (octave_idx_type k)
+      {
+        return (k * n) / nblk;
+      };
+
+      element_type *Tp = T.fortran_vec ();
+
+      for (octave_idx_type jb = 0; jb < nblk; jb++)
+        {
+          octave_quit ();
+
+          octave_idx_type j0 = blk_off (jb);
+          octave_idx_type j1 = blk_off (jb+1);
+
+          Matrix Tjj = T.extract (j0, j0, j1-1, j1-1);
+          singular |= sqrtm_utri_unblocked (Tjj);
+          T.insert (Tjj, j0, j0);
+
+          for (octave_idx_type ib = jb-1; ib >= 0; ib--)
+            {
+              octave_idx_type i0 = blk_off (ib);
+              octave_idx_type i1 = blk_off (ib+1);
+
+              Matrix C = T.extract (i0, j0, i1-1, j1-1);
+
+              if (i1 < j0)
+                {
+                  // Downdate with the blocks strictly between i and j,
+                  // which already hold the root.
+                  Matrix A = T.extract (i0, i1, i1-1, j0-1);
+                  Matrix B = T.extract (i1, j0, j0-1, j1-1);
+
+                  C -= A * B;
+                }
+
+              sylvester_solve (to_f77_int (i1 - i0), to_f77_int (j1 - j0),
+                               Tp + i0 + i0 * n, to_f77_int (n),
+                               Tp + j0 + j0 * n, to_f77_int (n),
+                               C.fortran_vec (), to_f77_int (i1 - i0));
+
+              T.insert (C, i0, j0);
+            }
+        }
+    }
+
   if (singular)
     warning_with_id ("Octave:sqrtm:SingularMatrix",
                      "sqrtm: matrix is singular, may not have a square root");
@@ -276,6 +449,20 @@ Mathematics, Manchester, England, January 1999.
 %! [y, err] = sqrtm (x);
 %! assert (y, z);
 %! assert (err, 0);   # Yes, this one has to hold exactly
+
+## Large enough to take the blocked triangular path.
+%!test
+%! n = 160;
+%! T = triu (rand (n)) + n * eye (n);
+%! S = sqrtm (T);
+%! assert (S^2, T, -1e-10);
+
+%!test
+%! n = 160;
+%! B = rand (n);
+%! A = B*B' + n * eye (n);
+%! S = sqrtm (A);
+%! assert (S^2, A, -1e-10);
 */
 
 OCTAVE_END_NAMESPACE(octave)
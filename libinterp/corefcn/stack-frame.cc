@@ -50,12 +50,79 @@
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
+// Stack frames are allocated and freed at a very high rate -- one per
+// function or script call -- and almost always have the same handful
+// of sizes, so recycle their storage through a small per-thread free
+// list instead of hitting the global allocator on every call.  Blocks
+// are returned to the pool when the frame object is actually
+// destroyed, which may be long after the frame is popped if a closure
+// or handle still references it, so lifetimes are unaffected.
+
+template <typename T>
+class frame_block_pool
+{
+public:
+
+  static void * allocate (std::size_t size)
+  {
+    if (size == sizeof (T) && s_free_list)
+      {
+        void *p = s_free_list;
+        s_free_list = *static_cast<void **> (p);
+        s_num_free--;
+        return p;
+      }
+
+    return ::operator new (size);
+  }
+
+  static void release (void *p)
+  {
+    if (s_num_free < max_free)
+      {
+        *static_cast<void **> (p) = s_free_list;
+        s_free_list = p;
+        s_num_free++;
+      }
+    else
+      ::operator delete (p);
+  }
+
+private:
+
+  // Deep recursion unwinds release many frames at once; don't hoard
+  // more than this.
+  static const int max_free = 64;
+
+  static thread_local void *s_free_list;
+  static thread_local int s_num_free;
+};
+
+template <typename T>
+thread_local void *frame_block_pool<T>::s_free_list = nullptr;
+
+template <typename T>
+thread_local int frame_block_pool<T>::s_num_free = 0;
+
+#define OCTAVE_POOL_FRAME_ALLOCATORS(T)                         \
+  void * operator new (std::size_t size)                        \
+  {                                                             \
+    return frame_block_pool<T>::allocate (size);                \
+  }                                                             \
+                                                                \
+  void operator delete (void *p)                                \
+  {                                                             \
+    frame_block_pool<T>::release (p);                           \
+  }
+
 class compiled_fcn_stack_frame : public stack_frame
 {
 public:
 
   compiled_fcn_stack_frame () = delete;
 
+  OCTAVE_POOL_FRAME_ALLOCATORS (compiled_fcn_stack_frame)
+
   compiled_fcn_stack_frame (tree_evaluator& tw, octave_function *fcn,
                             std::size_t index,
                             const std::shared_ptr<stack_frame>& parent_link,
@@ -177,6 +244,8 @@ public:
 
   script_stack_frame () = delete;
 
+  OCTAVE_POOL_FRAME_ALLOCATORS (script_stack_frame)
+
   script_stack_frame (tree_evaluator& tw, octave_user_script *script,
                       std::size_t index,
                       const std::shared_ptr<stack_frame>& parent_link,
@@ -352,9 +421,36 @@ public:
 
   octave_value& varref (std::size_t data_offset)
   {
+    // Handing out a writable reference invalidates any cached
+    // metadata for this slot.
+
+    m_byte_size_cache.erase (data_offset);
+
     return m_values.at (data_offset);
   }
 
+  bool lookup_cached_byte_size (std::size_t data_offset,
+                                const octave_value& value,
+                                std::size_t& byte_size) const
+  {
+    auto p = m_byte_size_cache.find (data_offset);
+
+    if (p == m_byte_size_cache.end ()
+        || p->second.first != value.internal_rep ())
+      return false;
+
+    byte_size = p->second.second;
+
+    return true;
+  }
+
+  void cache_byte_size (std::size_t data_offset, const octave_value& value,
+                        std::size_t byte_size) const
+  {
+    m_byte_size_cache[data_offset]
+      = std::make_pair (value.internal_rep (), byte_size);
+  }
+
   void display (bool follow = true) const;
 
 protected:
@@ -364,6 +460,15 @@ protected:
   // associated with this stack frame.
   std::vector<octave_value> m_values;
 
+  // Byte sizes measured for make_symbol_info_list, indexed by data
+  // offset.  The rep pointer is stored only to recognize a value that
+  // was replaced without going through varref; it is never
+  // dereferenced and holds no reference count, so copy-on-write
+  // uniqueness of the variables is unaffected.
+  mutable std::map<std::size_t,
+                   std::pair<const octave_base_value *, std::size_t>>
+    m_byte_size_cache;
+
   // The type of each variable (local, global, persistent) of each
   // value.  This array is indexed by the data_offset value stored
   // in the symbol_record objects of the scope associated with this
@@ -396,6 +501,8 @@ public:
 
   user_fcn_stack_frame () = delete;
 
+  OCTAVE_POOL_FRAME_ALLOCATORS (user_fcn_stack_frame)
+
   user_fcn_stack_frame (tree_evaluator& tw, octave_user_function *fcn,
                         std::size_t index,
                         const std::shared_ptr<stack_frame>& parent_link,
@@ -507,6 +614,8 @@ public:
 
   scope_stack_frame () = delete;
 
+  OCTAVE_POOL_FRAME_ALLOCATORS (scope_stack_frame)
+
   scope_stack_frame (tree_evaluator& tw, const symbol_scope& scope,
                      std::size_t index,
                      const std::shared_ptr<stack_frame>& parent_link,
@@ -1029,52 +1138,59 @@ private:
   std::set<std::string> m_found_names;
 };
 
-stack_frame *stack_frame::create (tree_evaluator& tw, octave_function *fcn,
+std::shared_ptr<stack_frame>
+stack_frame::create (tree_evaluator& tw, octave_function *fcn,
                                   std::size_t index,
                                   const std::shared_ptr<stack_frame>& parent_link,
                                   const std::shared_ptr<stack_frame>& static_link)
 {
-  return new compiled_fcn_stack_frame (tw, fcn, index,
-                                       parent_link, static_link);
+  return std::make_shared<compiled_fcn_stack_frame> (tw, fcn, index,
+                                                     parent_link,
+                                                     static_link);
 }
 
-stack_frame *stack_frame::create (tree_evaluator& tw,
-                                  octave_user_script *script,
+std::shared_ptr<stack_frame>
+stack_frame::create (tree_evaluator& tw, octave_user_script *script,
                                   std::size_t index,
                                   const std::shared_ptr<stack_frame>& parent_link,
                                   const std::shared_ptr<stack_frame>& static_link)
 {
-  return new script_stack_frame (tw, script, index, parent_link, static_link);
+  return std::make_shared<script_stack_frame> (tw, script, index,
+                                               parent_link, static_link);
 }
 
-stack_frame *stack_frame::create (tree_evaluator& tw,
-                                  octave_user_function *fcn, std::size_t index,
-                                  const std::shared_ptr<stack_frame>& parent_link,
-                                  const std::shared_ptr<stack_frame>& static_link,
-                                  const std::shared_ptr<stack_frame>& access_link)
+std::shared_ptr<stack_frame>
+stack_frame::create (tree_evaluator& tw, octave_user_function *fcn,
+                     std::size_t index,
+                     const std::shared_ptr<stack_frame>& parent_link,
+                     const std::shared_ptr<stack_frame>& static_link,
+                     const std::shared_ptr<stack_frame>& access_link)
 {
-  return new user_fcn_stack_frame (tw, fcn, index,
-                                   parent_link, static_link, access_link);
+  return std::make_shared<user_fcn_stack_frame> (tw, fcn, index, parent_link,
+                                                 static_link, access_link);
 }
 
-stack_frame *stack_frame::create (tree_evaluator& tw,
-                                  octave_user_function *fcn, std::size_t index,
-                                  const std::shared_ptr<stack_frame>& parent_link,
-                                  const std::shared_ptr<stack_frame>& static_link,
-                                  const local_vars_map& local_vars,
-                                  const std::shared_ptr<stack_frame>& access_link)
+std::shared_ptr<stack_frame>
+stack_frame::create (tree_evaluator& tw, octave_user_function *fcn,
+                     std::size_t index,
+                     const std::shared_ptr<stack_frame>& parent_link,
+                     const std::shared_ptr<stack_frame>& static_link,
+                     const local_vars_map& local_vars,
+                     const std::shared_ptr<stack_frame>& access_link)
 {
-  return new user_fcn_stack_frame (tw, fcn, index,
-                                   parent_link, static_link, local_vars,
-                                   access_link);
+  return std::make_shared<user_fcn_stack_frame> (tw, fcn, index, parent_link,
+                                                 static_link, local_vars,
+                                                 access_link);
 }
 
-stack_frame *stack_frame::create (tree_evaluator& tw,
-                                  const symbol_scope& scope, std::size_t index,
+std::shared_ptr<stack_frame>
+stack_frame::create (tree_evaluator& tw, const symbol_scope& scope,
+                     std::size_t index,
                                   const std::shared_ptr<stack_frame>& parent_link,
                                   const std::shared_ptr<stack_frame>& static_link)
 {
-  return new scope_stack_frame (tw, scope, index, parent_link, static_link);
+  return std::make_shared<scope_stack_frame> (tw, scope, index,
+                                              parent_link, static_link);
 }
 
 // This function is only implemented and should only be called for
@@ -1099,8 +1215,33 @@ stack_frame::make_symbol_info_list (const std::list<symbol_record>& symrec_list)
           || (is_user_fcn_frame () && sym.frame_offset () > 0))
         continue;
 
-      symbol_info syminf (sym.name (), value, sym.is_formal (),
-                          is_global (sym), is_persistent (sym));
+      bool global = is_global (sym);
+      bool persistent = is_persistent (sym);
+
+      // Plain local slots are only written through varref, which
+      // drops the cached entry, so a surviving entry for the same rep
+      // is up to date and measuring the value again can be skipped.
+      // Global and persistent values are stored outside this frame
+      // and may change without this frame noticing, so they are
+      // always re-measured.
+
+      bool cacheable = (sym.frame_offset () == 0 && ! global && ! persistent);
+
+      std::size_t data_offset = sym.data_offset ();
+
+      std::size_t byte_size;
+
+      if (! (cacheable
+             && lookup_cached_byte_size (data_offset, value, byte_size)))
+        {
+          byte_size = value.byte_size ();
+
+          if (cacheable)
+            cache_byte_size (data_offset, value, byte_size);
+        }
+
+      symbol_info syminf (sym.name (), value, byte_size, sym.is_formal (),
+                          global, persistent);
 
       symbol_stats.append (syminf);
     }
@@ -1334,6 +1475,43 @@ octave_value& stack_frame::varref (std::size_t)
   panic_impossible ();
 }
 
+octave_value *
+stack_frame::global_binding (const symbol_record& sym,
+                             std::size_t data_offset) const
+{
+  std::size_t gen = m_evaluator.global_binding_generation ();
+
+  if (gen != m_global_bindings_gen)
+    {
+      m_global_bindings.clear ();
+      m_global_bindings_gen = gen;
+    }
+
+  if (data_offset >= m_global_bindings.size ())
+    m_global_bindings.resize (data_offset + 1, nullptr);
+
+  octave_value *& slot = m_global_bindings[data_offset];
+
+  if (! slot)
+    slot = m_evaluator.global_binding (sym.name ());
+
+  return slot;
+}
+
+octave_value
+stack_frame::global_varval_cached (const symbol_record& sym,
+                                   std::size_t data_offset) const
+{
+  return *global_binding (sym, data_offset);
+}
+
+octave_value&
+stack_frame::global_varref_cached (const symbol_record& sym,
+                                   std::size_t data_offset)
+{
+  return *global_binding (sym, data_offset);
+}
+
 void stack_frame::clear_objects ()
 {
   symbol_cleaner sc (true, true);
@@ -1952,7 +2130,7 @@ octave_value script_stack_frame::varval (const symbol_record& sym) const
       }
 
     case GLOBAL:
-      return m_evaluator.global_varval (sym.name ());
+      return frame->global_varval_cached (sym, data_offset);
     }
 
   error ("internal error: invalid switch case");
@@ -1991,7 +2169,7 @@ octave_value& script_stack_frame::varref (const symbol_record& sym)
       }
 
     case GLOBAL:
-      return m_evaluator.global_varref (sym.name ());
+      return frame->global_varref_cached (sym, data_offset);
     }
 
   error ("internal error: invalid switch case");
@@ -2284,7 +2462,7 @@ octave_value user_fcn_stack_frame::varval (const symbol_record& sym) const
       }
 
     case GLOBAL:
-      return m_evaluator.global_varval (sym.name ());
+      return frame->global_varval_cached (sym, data_offset);
     }
 
   error ("internal error: invalid switch case");
@@ -2322,7 +2500,7 @@ octave_value& user_fcn_stack_frame::varref (const symbol_record& sym)
       }
 
     case GLOBAL:
-      return m_evaluator.global_varref (sym.name ());
+      return frame->global_varref_cached (sym, data_offset);
     }
 
   error ("internal error: invalid switch case");
@@ -2423,7 +2601,7 @@ octave_value scope_stack_frame::varval (const symbol_record& sym) const
       return m_scope.persistent_varval (data_offset);
 
     case GLOBAL:
-      return m_evaluator.global_varval (sym.name ());
+      return global_varval_cached (sym, data_offset);
     }
 
   error ("internal error: invalid switch case");
@@ -2442,13 +2620,15 @@ octave_value& scope_stack_frame::varref (const symbol_record& sym)
   switch (get_scope_flag (data_offset))
     {
     case LOCAL:
-      return m_values.at (data_offset);
+      // Route through the data_offset overload so the cached
+      // workspace metadata for this slot is invalidated.
+      return varref (data_offset);
 
     case PERSISTENT:
       return m_scope.persistent_varref (data_offset);
 
     case GLOBAL:
-      return m_evaluator.global_varref (sym.name ());
+      return global_varref_cached (sym, data_offset);
     }
 
   error ("internal error: invalid switch case");
@@ -34,6 +34,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 class octave_value;
 class octave_value_list;
@@ -146,30 +147,31 @@ public:
     : m_evaluator (tw), m_is_closure_context (false),
       m_line (-1), m_column (-1), m_index (index),
       m_parent_link (parent_link), m_static_link (static_link),
-      m_access_link (access_link), m_dispatch_class ()
+      m_access_link (access_link), m_dispatch_class (),
+      m_global_bindings (), m_global_bindings_gen (0)
   { }
 
   // Compiled function.
-  static stack_frame *
+  static std::shared_ptr<stack_frame>
   create (tree_evaluator& tw, octave_function *fcn, std::size_t index,
           const std::shared_ptr<stack_frame>& parent_link,
           const std::shared_ptr<stack_frame>& static_link);
 
   // Script.
-  static stack_frame *
+  static std::shared_ptr<stack_frame>
   create (tree_evaluator& tw, octave_user_script *script, std::size_t index,
           const std::shared_ptr<stack_frame>& parent_link,
           const std::shared_ptr<stack_frame>& static_link);
 
   // User-defined function.
-  static stack_frame *
+  static std::shared_ptr<stack_frame>
   create (tree_evaluator& tw, octave_user_function *fcn, std::size_t index,
           const std::shared_ptr<stack_frame>& parent_link,
           const std::shared_ptr<stack_frame>& static_link,
           const std::shared_ptr<stack_frame>& access_link = std::shared_ptr<stack_frame> ());
 
   // Anonymous user-defined function with init vars.
-  static stack_frame *
+  static std::shared_ptr<stack_frame>
   create (tree_evaluator& tw, octave_user_function *fcn, std::size_t index,
           const std::shared_ptr<stack_frame>& parent_link,
           const std::shared_ptr<stack_frame>& static_link,
@@ -177,7 +179,7 @@ public:
           const std::shared_ptr<stack_frame>& access_link = std::shared_ptr<stack_frame> ());
 
   // Scope.
-  static stack_frame *
+  static std::shared_ptr<stack_frame>
   create (tree_evaluator& tw, const symbol_scope& scope, std::size_t index,
           const std::shared_ptr<stack_frame>& parent_link,
           const std::shared_ptr<stack_frame>& static_link);
@@ -247,6 +249,25 @@ public:
   symbol_info_list
   make_symbol_info_list (const std::list<symbol_record>& symrec_list) const;
 
+  // Cached workspace metadata.  Frames that own variable storage
+  // remember the measured byte size per data offset and drop the
+  // entry whenever the slot is handed out for writing, so rebuilding
+  // workspace info for whos or the GUI only re-measures variables
+  // that changed since the last call.  The default implementations
+  // cache nothing.
+
+  virtual bool lookup_cached_byte_size (std::size_t /*data_offset*/,
+                                        const octave_value& /*value*/,
+                                        std::size_t& /*byte_size*/) const
+  {
+    return false;
+  }
+
+  virtual void cache_byte_size (std::size_t /*data_offset*/,
+                                const octave_value& /*value*/,
+                                std::size_t /*byte_size*/) const
+  { }
+
   octave_value who (const string_vector& patterns, bool have_regexp,
                     bool return_list, bool verbose,
                     const std::string& whos_line_fmt,
@@ -442,6 +463,17 @@ public:
 
   virtual octave_value& varref (std::size_t data_offset);
 
+  // Access the global variable bound to SYM through a per-frame
+  // cached slot pointer, so hot loops touching globals skip the
+  // by-name map lookup after the first access.  DATA_OFFSET is the
+  // slot of SYM in this frame and must carry the GLOBAL scope flag.
+
+  octave_value global_varval_cached (const symbol_record& sym,
+                                     std::size_t data_offset) const;
+
+  octave_value& global_varref_cached (const symbol_record& sym,
+                                      std::size_t data_offset);
+
   void assign (const symbol_record& sym, const octave_value& val)
   {
     octave_value& lhs = varref (sym);
@@ -593,6 +625,19 @@ protected:
   // Allow function handles to temporarily store their dispatch class
   // in the call stack.
   std::string m_dispatch_class;
+
+private:
+
+  octave_value * global_binding (const symbol_record& sym,
+                                 std::size_t data_offset) const;
+
+  // Cached pointers to global variable storage, indexed by the
+  // data offset of the corresponding symbol in this frame.  Valid
+  // only while m_global_bindings_gen matches the call stack's
+  // global binding generation.
+  mutable std::vector<octave_value *> m_global_bindings;
+
+  mutable std::size_t m_global_bindings_gen;
 };
 
 OCTAVE_END_NAMESPACE(octave)
@@ -28,6 +28,7 @@
 #endif
 
 #include <algorithm>
+#include <cstring>
 #include <deque>
 #include <limits>
 #include <string>
@@ -81,63 +82,46 @@ qs_search (const Array<char>& needle,
   std::deque<octave_idx_type> accum;
   if (m == 1)
     {
-      // Looking for a single character.
-      for (octave_idx_type i = 0; i < n; i++)
-        {
-          if (y[i] == x[0])
-            accum.push_back (i);
-        }
-    }
-  else if (m == 2)
-    {
-      // Two characters.
-      if (overlaps)
-        {
-          for (octave_idx_type i = 0; i < n-1; i++)
-            {
-              if (y[i] == x[0] && y[i+1] == x[1])
-                accum.push_back (i);
-            }
-        }
-      else
+      // Looking for a single character.  memchr is typically vectorized
+      // by the C library.
+      const char *p = y;
+
+      while ((p = static_cast<const char *> (std::memchr (p, x[0],
+                                                          y + n - p))))
         {
-          for (octave_idx_type i = 0; i < n-1; i++)
-            {
-              if (y[i] == x[0] && y[i+1] == x[1])
-                accum.push_back (i++);
-            }
+          accum.push_back (p - y);
+          p++;
         }
     }
-  else if (n >= m)
+  else if (m > 1 && n >= m)
     {
-      // General case.
+      // General case.  Use memchr to skip to candidate occurrences of
+      // the first pattern byte and verify the rest with memcmp; both
+      // are typically vectorized by the C library.  On a mismatch in
+      // the middle of the haystack, also apply the quick search
+      // bad-character skip, which never steps over a match.
       octave_idx_type j = 0;
 
-      if (overlaps)
+      while (j <= n - m)
         {
-          while (j < n - m)
-            {
-              if (std::equal (x, x + m, y + j))
-                accum.push_back (j);
-              j += table[ORD(y[j + m])];
-            }
-        }
-      else
-        {
-          while (j < n - m)
+          const char *p = static_cast<const char *>
+                            (std::memchr (y + j, x[0], n - m + 1 - j));
+
+          if (! p)
+            break;
+
+          j = p - y;
+
+          if (std::memcmp (x + 1, y + j + 1, m - 1) == 0)
             {
-              if (std::equal (x, x + m, y + j))
-                {
-                  accum.push_back (j);
-                  j += m;
-                }
-              else
-                j += table[ORD(y[j + m])];
+              accum.push_back (j);
+              j += (overlaps ? 1 : m);
             }
+          else if (j < n - m)
+            j += table[ORD(y[j + m])];
+          else
+            break;
         }
-
-      if (j == n - m && std::equal (x, x + m, y + j))
-        accum.push_back (j);
     }
 
   octave_idx_type nmatch = accum.size ();
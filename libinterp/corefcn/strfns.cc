@@ -31,8 +31,10 @@
 
 #include <queue>
 #include <sstream>
+#include <vector>
 
 #include "dMatrix.h"
+#include "oct-parallel.h"
 #include "localcharset-wrapper.h"
 #include "uniconv-wrappers.h"
 #include "unistr-wrappers.h"
@@ -876,6 +878,125 @@ efficient, and avoids the security risk of using @code{eval} on unknown data.
 %!assert (str2double (char (zeros (3,0))), NaN)
 */
 
+// The whitespace set matched by the "[\s\v]" pattern strtrim
+// previously applied through the regexp engine.
+
+static bool
+is_strtrim_space (char c)
+{
+  return (c == ' ' || c == '\t' || c == '\n'
+          || c == '\v' || c == '\f' || c == '\r');
+}
+
+DEFUN (__strtrim_cellstr__, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{c} =} __strtrim_cellstr__ (@var{c})
+Undocumented internal function.
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  Cell c = args(0).xcell_value ("__strtrim_cellstr__: C must be a cell array");
+
+  octave_idx_type n = c.numel ();
+
+  // Collect the character data up front, so conversions, warnings,
+  // and errors all happen on this thread; the arrays also keep the
+  // data alive across the scan below.
+
+  struct char_span
+  {
+    const char *data;
+    octave_idx_type stride;
+    octave_idx_type len;
+    octave_idx_type b;
+    octave_idx_type e;
+  };
+
+  std::vector<charNDArray> elts (n);
+  std::vector<char_span> spans (n);
+
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      octave_value elt = c(i);
+
+      if (! elt.is_string ())
+        error ("strtrim: S argument must be a string or cellstring");
+
+      if (elt.ndims () != 2)
+        error ("invalid conversion of charNDArray to string");
+
+      elts[i] = elt.char_array_value ();
+
+      octave_idx_type nr = elts[i].rows ();
+
+      if (nr > 1)
+        warning_with_id ("Octave:charmat-truncated",
+                         "multi-row character matrix converted to a string, only the first row is used");
+
+      // Row 0 of a character matrix is strided in column-major
+      // storage; plain strings have stride 1.
+
+      spans[i].data = elts[i].data ();
+      spans[i].stride = (nr > 1 ? nr : 1);
+      spans[i].len = (nr > 0 ? elts[i].columns () : 0);
+    }
+
+  // Scanning for the trim bounds only reads the character data, so it
+  // can proceed in parallel across elements.
+
+  chunked_parallel_for
+    (n, [&spans] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type i = beg; i < beg + len; i++)
+         {
+           char_span& sp = spans[i];
+
+           octave_idx_type b = 0;
+           octave_idx_type e = sp.len;
+
+           while (b < e && is_strtrim_space (sp.data[b * sp.stride]))
+             b++;
+
+           while (e > b && is_strtrim_space (sp.data[(e-1) * sp.stride]))
+             e--;
+
+           sp.b = b;
+           sp.e = e;
+         }
+     });
+
+  Cell result (c.dims ());
+
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      const char_span& sp = spans[i];
+
+      std::string str;
+      str.reserve (sp.e - sp.b);
+
+      for (octave_idx_type j = sp.b; j < sp.e; j++)
+        str.push_back (sp.data[j * sp.stride]);
+
+      result.xelem (i) = octave_value (str);
+    }
+
+  return ovl (result);
+}
+
+/*
+%!assert (__strtrim_cellstr__ ({" abc ", "d"; "ef", "  gh"}),
+%!        {"abc", "d"; "ef", "gh"})
+%!assert (__strtrim_cellstr__ (cell (0, 3)), cell (0, 3))
+%!test
+%! c = {"  x  ", "", "   ", sprintf (" \t\n\v\f\r y "), blanks (5)};
+%! assert (__strtrim_cellstr__ (c), regexprep (c, '^[\s\v]+|[\s\v]+$', ''));
+%!error __strtrim_cellstr__ ()
+%!error <must be a cell array> __strtrim_cellstr__ ("abc")
+%!error <must be a string> __strtrim_cellstr__ ({1})
+*/
+
 DEFUN (__native2unicode__, args, ,
        doc: /* -*- texinfo -*-
 @deftypefn {} {@var{utf8_str} =} __native2unicode__ (@var{native_bytes}, @var{codepage})
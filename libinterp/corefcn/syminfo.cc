@@ -123,7 +123,7 @@ symbol_info::display_line (std::ostream& os,
               break;
 
             case 'b':
-              os << m_value.byte_size ();
+              os << m_byte_size;
               break;
 
             case 'c':
@@ -219,7 +219,7 @@ symbol_info_list::map_value (const std::string& caller_function_name,
       octave_value val = syminfo.value ();
 
       size_info(j) = val.size ();
-      bytes_info(j) = val.byte_size ();
+      bytes_info(j) = syminfo.byte_size ();
       class_info(j) = val.class_name ();
       sparse_info(j) = val.issparse ();
       complex_info(j) = val.iscomplex ();
@@ -349,7 +349,7 @@ void symbol_info_list::display (std::ostream& os,
           octave_value val = syminfo.value ();
 
           elements += val.numel ();
-          bytes += val.byte_size ();
+          bytes += syminfo.byte_size ();
         }
 
       os << "\nTotal is " << elements
@@ -424,7 +424,7 @@ symbol_info_list::parse_whos_line_format (const std::string& format) const
                               > static_cast<std::size_t> (param_length(pos_e)))
                              ? str.length () : param_length(pos_e));
 
-      bytes1 = val.byte_size ();
+      bytes1 = syminfo.byte_size ();
       ss2 << bytes1;
       str = ss2.str ();
       param_length(pos_b) = ((str.length ()
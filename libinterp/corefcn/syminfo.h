@@ -58,15 +58,32 @@ public:
 
   symbol_info (const std::string& name, const octave_value& value,
                bool is_formal, bool is_global, bool is_persistent)
-    : m_name (name), m_value (value), m_is_complex (value.iscomplex ()),
-      m_is_sparse (value.issparse ()), m_is_formal (is_formal),
-      m_is_global (is_global), m_is_persistent (is_persistent)
+    : m_name (name), m_value (value), m_byte_size (value.byte_size ()),
+      m_is_complex (value.iscomplex ()), m_is_sparse (value.issparse ()),
+      m_is_formal (is_formal), m_is_global (is_global),
+      m_is_persistent (is_persistent)
+  { }
+
+  // For callers that already know the size, for example from the
+  // stack frame's metadata cache.  Measuring deep cell and struct
+  // values is the expensive part of building workspace info, so avoid
+  // repeating it when possible.
+
+  symbol_info (const std::string& name, const octave_value& value,
+               std::size_t byte_size, bool is_formal, bool is_global,
+               bool is_persistent)
+    : m_name (name), m_value (value), m_byte_size (byte_size),
+      m_is_complex (value.iscomplex ()), m_is_sparse (value.issparse ()),
+      m_is_formal (is_formal), m_is_global (is_global),
+      m_is_persistent (is_persistent)
   { }
 
   std::string name () const { return m_name; }
 
   octave_value value () const { return m_value; }
 
+  std::size_t byte_size () const { return m_byte_size; }
+
   bool is_complex () const { return m_is_complex; }
 
   bool is_sparse () const { return m_is_sparse; }
@@ -83,6 +100,7 @@ private:
 
   std::string m_name;
   octave_value m_value;
+  std::size_t m_byte_size;
   bool m_is_complex;
   bool m_is_sparse;
   bool m_is_formal;
@@ -53,7 +53,7 @@ symbol_record::symbol_record_rep::dump () const
   std::map<std::string, octave_value> m
   = {{ "frame_offset", m_frame_offset },
     { "data_offset", m_data_offset },
-    { "name", m_name },
+    { "name", m_name.str () },
     { "local", is_local () },
     { "formal", is_formal () }
   };
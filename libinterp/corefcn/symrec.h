@@ -35,6 +35,7 @@
 
 class octave_user_function;
 
+#include "oct-intern.h"
 #include "ov.h"
 #include "ovl.h"
 
@@ -168,7 +169,9 @@ private:
 
     symrec_t m_storage_class;
 
-    std::string m_name;
+    // Interned: each scope referencing the same identifier shares one
+    // pooled copy of the name.
+    interned_string m_name;
   };
 
 public:
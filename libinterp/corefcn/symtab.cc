@@ -332,6 +332,8 @@ octave_value symbol_table::find_cmdline_function (const std::string& name)
 void symbol_table::install_cmdline_function (const std::string& name,
     const octave_value& fcn)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -357,6 +359,8 @@ void symbol_table::install_local_function (const std::string& name,
     const octave_value& fcn,
     const std::string& file_name)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -378,6 +382,8 @@ void symbol_table::install_local_function (const std::string& name,
 void symbol_table::install_user_function (const std::string& name,
     const octave_value& fcn)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -401,6 +407,8 @@ void symbol_table::install_user_function (const std::string& name,
 void symbol_table::install_built_in_function (const std::string& name,
     const octave_value& fcn)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -425,6 +433,8 @@ void symbol_table::install_built_in_function (const std::string& name,
 
 void symbol_table::clear_functions (bool force)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.begin ();
 
   while (p != m_fcn_table.end ())
@@ -438,6 +448,8 @@ void symbol_table::clear_function (const std::string& name)
 
 void symbol_table::clear_function_pattern (const std::string& pat)
 {
+  bump_fcn_table_revision ();
+
   glob_match pattern (pat);
 
   auto p = m_fcn_table.begin ();
@@ -453,6 +465,8 @@ void symbol_table::clear_function_pattern (const std::string& pat)
 
 void symbol_table::clear_function_regexp (const std::string& pat)
 {
+  bump_fcn_table_revision ();
+
   regexp pattern (pat);
 
   auto p = m_fcn_table.begin ();
@@ -468,6 +482,8 @@ void symbol_table::clear_function_regexp (const std::string& pat)
 
 void symbol_table::clear_user_function (const std::string& name)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -484,6 +500,8 @@ void symbol_table::clear_user_function (const std::string& name)
 // This clears oct and mex files, including autoloads.
 void symbol_table::clear_dld_function (const std::string& name)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -497,6 +515,8 @@ void symbol_table::clear_dld_function (const std::string& name)
 
 void symbol_table::clear_mex_functions ()
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.begin ();
 
   while (p != m_fcn_table.end ())
@@ -510,6 +530,8 @@ void symbol_table::clear_mex_functions ()
 bool symbol_table::set_class_relationship (const std::string& sup_class,
     const std::string& inf_class)
 {
+  bump_fcn_table_revision ();
+
   if (is_superiorto (inf_class, sup_class))
     return false;
 
@@ -549,6 +571,8 @@ bool symbol_table::is_superiorto (const std::string& a, const std::string& b)
 void symbol_table::alias_built_in_function (const std::string& alias,
     const std::string& name)
 {
+  bump_fcn_table_revision ();
+
   octave_value fcn = find_built_in_function (name);
 
   if (fcn.is_defined ())
@@ -566,6 +590,8 @@ void symbol_table::alias_built_in_function (const std::string& alias,
 void symbol_table::install_built_in_dispatch (const std::string& name,
     const std::string& klass)
 {
+  bump_fcn_table_revision ();
+
   auto p = m_fcn_table.find (name);
 
   if (p != m_fcn_table.end ())
@@ -68,6 +68,16 @@ public:
 
   bool is_built_in_function_name (const std::string& name);
 
+  // Revision counter for the function table.  It is bumped by any
+  // operation that may change how a name resolves to a function
+  // (installing or clearing functions, class relationship changes,
+  // load path updates) so call sites may cache the result of
+  // find_function and validate it with a single comparison.
+
+  std::size_t fcn_table_revision () const { return m_fcn_table_revision; }
+
+  void bump_fcn_table_revision () { m_fcn_table_revision++; }
+
   octave_value find_scoped_function (const std::string& name,
                                      const symbol_scope& search_scope);
 
@@ -201,6 +211,9 @@ private:
   // them.
   std::map<std::string, fcn_info> m_fcn_table;
 
+  // Incremented whenever name-to-function resolution may change.
+  std::size_t m_fcn_table_revision = 1;
+
   // Map from class names to set of classes that have lower
   // precedence.
   std::map<std::string, std::set<std::string>> m_class_precedence_table;
@@ -27,11 +27,68 @@
 #  include "config.h"
 #endif
 
+#include <list>
+#include <map>
+#include <utility>
+
 #include "text-engine.h"
 #include "oct-tex-symbols.cc"
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
+// Bounded MRU cache of parsed text element trees.  Graphics text layout
+// happens on a single thread, so no locking is needed.
+
+namespace
+{
+  typedef std::pair<std::string, bool> parse_cache_key;
+
+  struct parse_cache_entry
+  {
+    std::shared_ptr<text_element> elt;
+    std::list<parse_cache_key>::iterator lru_pos;
+  };
+
+  const std::size_t max_parse_cache_entries = 128;
+
+  std::map<parse_cache_key, parse_cache_entry> parse_cache;
+
+  // Most recently used keys first.
+  std::list<parse_cache_key> parse_cache_lru;
+}
+
+std::shared_ptr<text_element>
+text_parser::parse_cached (const std::string& s,
+                           const caseless_str& interpreter)
+{
+  // "latex" text is rendered as if "none" when no latex renderer is
+  // available, so only the tex/non-tex distinction matters here.
+
+  parse_cache_key key (s, interpreter.compare ("tex"));
+
+  auto it = parse_cache.find (key);
+
+  if (it != parse_cache.end ())
+    {
+      parse_cache_lru.splice (parse_cache_lru.begin (), parse_cache_lru,
+                              it->second.lru_pos);
+      return it->second.elt;
+    }
+
+  std::shared_ptr<text_element> elt (parse (s, interpreter));
+
+  while (parse_cache.size () >= max_parse_cache_entries)
+    {
+      parse_cache.erase (parse_cache_lru.back ());
+      parse_cache_lru.pop_back ();
+    }
+
+  parse_cache_lru.push_front (key);
+  parse_cache[key] = { elt, parse_cache_lru.begin () };
+
+  return elt;
+}
+
 uint32_t
 text_element_symbol::get_symbol_code () const
 {
@@ -404,6 +404,13 @@ public:
 public:
   static text_element * parse (const std::string& s,
                               const caseless_str& interpreter);
+
+  // Shared-ownership variant that serves repeated layout passes from
+  // a cache keyed by (string, interpreter mode).  The returned tree
+  // must be treated as read-only; re-layout of a figure with many
+  // annotations then parses each label only once.
+  static std::shared_ptr<text_element>
+  parse_cached (const std::string& s, const caseless_str& interpreter);
 };
 
 class
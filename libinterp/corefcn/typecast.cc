@@ -174,6 +174,30 @@ typecast (@var{x}, "uint8")
 
   octave_value array = args(0);
 
+  std::string numclass = args(1).string_value ();
+  std::transform (numclass.begin (), numclass.end (), numclass.begin (),
+                  tolower);
+
+  // Typecasting to the class the data already has reinterprets the
+  // bytes as themselves, so only the shape changes: return a shallow
+  // copy sharing the input representation.  Views across classes are
+  // not possible with the typed array representation, so the
+  // combinations below still copy.  Complex and sparse inputs always
+  // take the copy path, which interleaves or fills them into a new
+  // full array.
+
+  if (! array.iscomplex () && ! array.islogical () && ! array.issparse ()
+      && numclass == array.class_name ())
+    {
+      dim_vector vdims = get_vec_dims (array.dims (), array.numel ());
+
+      if (array.is_string ())
+        return ovl (octave_value (array.char_array_value ().reshape (vdims),
+                                  array.is_dq_string () ? '"' : '\''));
+
+      return ovl (array.reshape (vdims));
+    }
+
   if (array.islogical ())
     get_data_and_bytesize (array.bool_array_value (), data, byte_size,
                            old_dims, frame);
@@ -229,10 +253,6 @@ typecast (@var{x}, "uint8")
     error ("typecast: invalid input CLASS: %s",
            array.class_name ().c_str ());
 
-  std::string numclass = args(1).string_value ();
-  std::transform (numclass.begin (), numclass.end (), numclass.begin (),
-                  tolower);
-
   if (numclass.size () == 0)
     ;
   else if (numclass == "char")
@@ -301,6 +321,16 @@ typecast (@var{x}, "uint8")
 %!assert (typecast (-inf, "double"), -inf)
 %!assert (typecast (nan,  "double"), nan)
 
+## Same-class typecasts share the input data; the result must still
+## have the usual vector shape.
+%!assert (typecast (uint8 ([1 2 3 4]), "uint8"), uint8 ([1 2 3 4]))
+%!assert (typecast (single ([1 2 3]'), "single"), single ([1 2 3]'))
+%!assert (typecast ("abc", "char"), "abc")
+%!test
+%! x = magic (3);
+%! assert (typecast (x, "double"), x(:));
+%!assert (typecast (complex (1, 2), "double"), [1, 2])
+
 %!error typecast ()
 %!error typecast (1)
 %!error typecast (1, 2, 3)
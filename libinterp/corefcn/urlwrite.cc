@@ -266,6 +266,92 @@ s = urlread ("http://www.google.com/search",
   return retval;
 }
 
+DEFUN (urlreadmulti, args, nargout,
+       doc: /* -*- texinfo -*-
+@deftypefn  {} {@var{s} =} urlreadmulti (@var{urls})
+@deftypefnx {} {@var{s} =} urlreadmulti (@var{urls}, @var{maxconn})
+@deftypefnx {} {[@var{s}, @var{success}, @var{message}] =} urlreadmulti (@dots{})
+Download several remote files concurrently and return their contents
+in the cell array of strings @var{s}.
+
+@var{urls} is a cell array of URL strings.  All transfers run at the
+same time over a shared connection pool, with at most @var{maxconn}
+(default 8) simultaneous connections, so fetching many small files
+costs a few round trips instead of one per file.  Connections are kept
+alive between calls and reused for later batches against the same
+hosts.
+
+The logical array @var{success} marks the transfers that completed,
+and @var{message} holds an error message for each failed one.  When
+@var{success} is not requested, any failed transfer raises an error.
+
+This function uses libcurl and supports the same protocols as
+@code{urlread}.
+@seealso{urlread, urlwrite, parfeval}
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+
+  Array<std::string> url_arr
+    = args(0).xcellstr_value ("urlreadmulti: URLS must be a cell array of strings");
+
+  int maxconn = 8;
+
+  if (nargin == 2)
+    {
+      maxconn = args(1).xint_value ("urlreadmulti: MAXCONN must be a positive integer");
+
+      if (maxconn < 1)
+        error ("urlreadmulti: MAXCONN must be a positive integer");
+    }
+
+  octave_idx_type n = url_arr.numel ();
+
+  std::vector<std::string> urls (n);
+
+  for (octave_idx_type i = 0; i < n; i++)
+    urls[i] = url_arr(i);
+
+  std::vector<url_multi_result> xfers = url_multi_get (urls, maxconn);
+
+  Cell s (url_arr.dims ());
+  boolNDArray success (url_arr.dims ());
+  Cell message (url_arr.dims ());
+
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      s.xelem (i) = xfers[i].body;
+      success.xelem (i) = xfers[i].ok;
+      message.xelem (i) = xfers[i].errmsg;
+
+      if (nargout < 2 && ! xfers[i].ok)
+        error ("urlreadmulti: %s: %s",
+               urls[i].c_str (), xfers[i].errmsg.c_str ());
+    }
+
+  octave_value_list retval (std::max (1, std::min (nargout, 3)));
+
+  retval(0) = s;
+
+  if (nargout > 1)
+    retval(1) = success;
+  if (nargout > 2)
+    retval(2) = message;
+
+  return retval;
+}
+
+/*
+%!error <URLS must be a cell array of strings> urlreadmulti (1)
+%!error urlreadmulti ()
+%!test
+%! [s, ok, msg] = urlreadmulti ({});
+%! assert (isempty (s) && isempty (ok) && isempty (msg));
+*/
+
 DEFUN (__restful_service__, args, nargout,
        doc: /* -*- texinfo -*-
 @deftypefn {} {@var{response} =} __restful_service__ (@var{url}, @var{param}, @var{weboptions})
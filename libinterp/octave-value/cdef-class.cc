@@ -109,6 +109,16 @@ cdef_class::cdef_class_rep::find_method (const std::string& nm, bool local)
 
   if (! local)
     {
+      // Methods resolved through the superclass chain are cached per
+      // class, so repeated dispatch on an inherited method skips the
+      // SuperClasses property fetch and class lookups below.  The
+      // cache is flushed when the method table changes.
+
+      auto cit = m_dispatch_cache.find (nm);
+
+      if (cit != m_dispatch_cache.end () && cit->second.ok ())
+        return cit->second;
+
       // Look into superclasses
 
       Cell super_classes = get ("SuperClasses").cell_value ();
@@ -120,7 +130,10 @@ cdef_class::cdef_class_rep::find_method (const std::string& nm, bool local)
           cdef_method meth = cls.find_method (nm);
 
           if (meth.ok ())
-            return meth;
+            {
+              m_dispatch_cache[nm] = meth;
+              return meth;
+            }
         }
     }
 
@@ -231,6 +244,8 @@ cdef_class::cdef_class_rep::install_method (const cdef_method& meth)
 {
   m_method_map[meth.get_name ()] = meth;
 
+  m_dispatch_cache.clear ();
+
   m_member_count++;
 
   if (meth.is_constructor ())
@@ -149,6 +149,7 @@ private:
 
           m_member_count = 0;
           m_method_map.clear ();
+          m_dispatch_cache.clear ();
           m_property_map.clear ();
         }
       else
@@ -200,6 +201,12 @@ private:
 
     std::map<std::string, cdef_method> m_method_map;
 
+    // Dispatch cache: methods resolved through this class, including
+    // ones found by walking the superclass chain.  Rebuilt lazily by
+    // find_method and flushed whenever the method table changes.
+
+    std::map<std::string, cdef_method> m_dispatch_cache;
+
     // The properties defined by this class.
 
     std::map<std::string, cdef_property> m_property_map;
@@ -31,6 +31,7 @@ OCTAVE_VALUE_INC = \
   %reldir%/ov-base-scalar.h \
   %reldir%/ov-base.h \
   %reldir%/ov-bool-mat.h \
+  %reldir%/ov-bool-packed.h \
   %reldir%/ov-bool.h \
   %reldir%/ov-builtin.h \
   %reldir%/ov-cell.h \
@@ -39,6 +40,7 @@ OCTAVE_VALUE_INC = \
   %reldir%/ov-classdef.h \
   %reldir%/ov-colon.h \
   %reldir%/ov-complex.h \
+  %reldir%/ov-const-mat.h \
   %reldir%/ov-cs-list.h \
   %reldir%/ov-cx-diag.h \
   %reldir%/ov-cx-mat.h \
@@ -98,6 +100,7 @@ OCTAVE_VALUE_SRC = \
   %reldir%/cdef-utils.cc \
   %reldir%/ov-base.cc \
   %reldir%/ov-bool-mat.cc \
+  %reldir%/ov-bool-packed.cc \
   %reldir%/ov-bool.cc \
   %reldir%/ov-builtin.cc \
   %reldir%/ov-cell.cc \
@@ -106,6 +109,7 @@ OCTAVE_VALUE_SRC = \
   %reldir%/ov-classdef.cc \
   %reldir%/ov-colon.cc \
   %reldir%/ov-complex.cc \
+  %reldir%/ov-const-mat.cc \
   %reldir%/ov-cs-list.cc \
   %reldir%/ov-cx-diag.cc \
   %reldir%/ov-cx-mat.cc \
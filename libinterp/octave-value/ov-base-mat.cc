@@ -169,6 +169,33 @@ octave_base_matrix<MT>::do_index_op (const octave_value_list& idx,
 
         case 2:
           {
+            // Optimize a full column slice, A(:,k).  The result is a
+            // shallow view over the rep (see Array<T>::column), and
+            // taking it here also skips building and reducing index
+            // vectors, which dominates the cost of slicing a column
+            // out of a large matrix in a loop.
+            if (! resize_ok && nd == 2 && idx(0).is_magic_colon ()
+                && idx(1).is_real_scalar ())
+              {
+                double dk = idx(1).double_value ();
+
+                // Check the range before converting; the conversion is
+                // undefined for NaN, Inf, or values that do not fit in
+                // octave_idx_type, all of which must fall through to
+                // the normal (erroring) index path.
+                if (dk >= 1 && dk <= m_matrix.columns ())
+                  {
+                    octave_idx_type kcol
+                      = static_cast<octave_idx_type> (dk);
+
+                    if (dk == kcol)
+                      {
+                        retval = MT (cmatrix.column (kcol - 1));
+                        break;
+                      }
+                  }
+              }
+
             octave::idx_vector i = idx (0).index_vector ();
 
             k=1;
@@ -288,6 +315,12 @@ octave_base_matrix<MT>::matrix_type (const MatrixType& typ) const
 {
   delete m_typ;
   m_typ = new MatrixType (typ);
+
+  // Also remember the result on the array rep itself so that other
+  // octave_value objects wrapping the same data skip the probe.
+  if (typ.is_known ())
+    m_matrix.cache_matrix_type (typ);
+
   return *m_typ;
 }
 
@@ -133,7 +133,8 @@ public:
   octave_value all (int dim = 0) const { return m_matrix.all (dim); }
   octave_value any (int dim = 0) const { return m_matrix.any (dim); }
 
-  MatrixType matrix_type () const { return m_typ ? *m_typ : MatrixType (); }
+  MatrixType matrix_type () const
+  { return m_typ ? *m_typ : m_matrix.cached_matrix_type (); }
   MatrixType matrix_type (const MatrixType& _typ) const;
 
   octave_value diag (octave_idx_type k = 0) const
@@ -0,0 +1,377 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "ov-bool-packed.h"
+
+#include "defun.h"
+#include "error.h"
+#include "errwarn.h"
+#include "ls-oct-text.h"
+#include "ls-oct-binary.h"
+#include "ops.h"
+#include "ovl.h"
+
+DEFINE_OV_TYPEID_FUNCTIONS_AND_DATA (octave_packed_bool_matrix,
+                                     "packed bool matrix", "logical");
+
+static octave_base_value *
+default_numeric_conversion_function (const octave_base_value& a)
+{
+  const octave_packed_bool_matrix& v
+    = dynamic_cast<const octave_packed_bool_matrix&> (a);
+
+  return v.full_value ().clone ();
+}
+
+octave_base_value::type_conv_info
+octave_packed_bool_matrix::numeric_conversion_function () const
+{
+  return octave_base_value::type_conv_info
+         (default_numeric_conversion_function,
+          octave_bool_matrix::static_type_id ());
+}
+
+static uint64NDArray
+pack_words (const boolNDArray& b)
+{
+  octave_idx_type n = b.numel ();
+  octave_idx_type nw = (n + 63) / 64;
+
+  uint64NDArray words (dim_vector (nw, 1), octave_uint64 (0));
+
+  const bool *bv = b.data ();
+  octave_uint64 *wv = words.fortran_vec ();
+
+  for (octave_idx_type i = 0; i < n; i++)
+    if (bv[i])
+      wv[i >> 6] = octave_uint64 (wv[i >> 6].value ()
+                                  | (uint64_t (1) << (i & 63)));
+
+  return words;
+}
+
+octave_packed_bool_matrix::octave_packed_bool_matrix (const boolNDArray& b)
+  : octave_base_value (), m_words (pack_words (b)), m_dims (b.dims ()),
+    m_value ()
+{ }
+
+const octave_value&
+octave_packed_bool_matrix::make_value () const
+{
+  if (m_value.is_undefined ())
+    {
+      octave_idx_type n = m_dims.numel ();
+
+      boolNDArray b (m_dims);
+
+      bool *bv = b.fortran_vec ();
+      const octave_uint64 *wv = m_words.data ();
+
+      for (octave_idx_type i = 0; i < n; i++)
+        bv[i] = (wv[i >> 6].value () >> (i & 63)) & 1;
+
+      m_value = octave_value (b);
+    }
+
+  return m_value;
+}
+
+octave_value&
+octave_packed_bool_matrix::make_value ()
+{
+  const octave_packed_bool_matrix *cthis = this;
+
+  cthis->make_value ();
+
+  return m_value;
+}
+
+octave_value
+octave_packed_bool_matrix::fast_elem_extract (octave_idx_type n) const
+{
+  if (n < 0 || n >= m_dims.numel ())
+    return octave_value ();
+
+  return bool ((m_words(n >> 6).value () >> (n & 63)) & 1);
+}
+
+octave_idx_type
+octave_packed_bool_matrix::nnz () const
+{
+  octave_idx_type nw = m_words.numel ();
+
+  const octave_uint64 *wv = m_words.data ();
+
+  octave_idx_type count = 0;
+
+  // The unused bits of the last word are zero, so they never count.
+
+  for (octave_idx_type i = 0; i < nw; i++)
+    {
+      uint64_t w = wv[i].value ();
+
+      // Hamming weight, one word at a time.
+
+      w = w - ((w >> 1) & 0x5555555555555555ULL);
+      w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+      w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+
+      count += (w * 0x0101010101010101ULL) >> 56;
+    }
+
+  return count;
+}
+
+bool
+octave_packed_bool_matrix::is_true () const
+{
+  octave_idx_type n = m_dims.numel ();
+
+  if (n == 0)
+    return false;
+
+  octave_idx_type nw = m_words.numel ();
+
+  const octave_uint64 *wv = m_words.data ();
+
+  for (octave_idx_type i = 0; i < nw - 1; i++)
+    if (wv[i].value () != ~uint64_t (0))
+      return false;
+
+  octave_idx_type tail = n - 64 * (nw - 1);
+
+  uint64_t tail_mask = (tail == 64
+                        ? ~uint64_t (0)
+                        : (uint64_t (1) << tail) - 1);
+
+  return wv[nw-1].value () == tail_mask;
+}
+
+// Packed values are saved in their expanded form so that the files
+// remain readable by older versions; a file written this way reads
+// back as a plain bool matrix.  If a value of this type is
+// nevertheless asked to load itself, the words must be repacked from
+// the expanded data.
+
+static const std::string value_save_tag ("value");
+
+bool
+octave_packed_bool_matrix::save_ascii (std::ostream& os)
+{
+  return save_text_data (os, make_value (), value_save_tag, false, 0);
+}
+
+bool
+octave_packed_bool_matrix::load_ascii (std::istream& is)
+{
+  bool dummy;
+
+  std::string nm = read_text_data (is, "", dummy, m_value, 0);
+
+  if (nm != value_save_tag)
+    error ("packed bool matrix: corrupted data on load");
+
+  m_dims = m_value.dims ();
+  m_words = pack_words (m_value.bool_array_value ());
+
+  return true;
+}
+
+bool
+octave_packed_bool_matrix::save_binary (std::ostream& os, bool save_as_floats)
+{
+  return save_binary_data (os, make_value (), value_save_tag,
+                           "", false, save_as_floats);
+}
+
+bool
+octave_packed_bool_matrix::load_binary (std::istream& is, bool swap,
+                                        octave::mach_info::float_format fmt)
+{
+  bool dummy;
+  std::string doc;
+
+  std::string nm = read_binary_data (is, swap, fmt, "", dummy, m_value, doc);
+
+  if (nm != value_save_tag)
+    error ("packed bool matrix: corrupted data on load");
+
+  m_dims = m_value.dims ();
+  m_words = pack_words (m_value.bool_array_value ());
+
+  return true;
+}
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+DEFUN (packlogical, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{p} =} packlogical (@var{x})
+Return the logical array @var{x} stored one bit per element.
+
+The packed value behaves like an ordinary logical array: it may be used
+for indexing and in logical expressions, @code{class} reports
+@qcode{"logical"}, and any operation that needs the full representation
+expands it transparently.  It occupies one eighth of the memory of a
+plain logical array, and elementwise @code{&}, @code{|} and @code{!}
+between packed arrays of equal size operate directly on the packed
+words.
+
+If @var{x} is not already logical it is converted as by @code{logical}.
+@seealso{unpacklogical, ispackedlogical, logical}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_value x = args(0);
+
+  if (x.type_id () == octave_packed_bool_matrix::static_type_id ())
+    return ovl (x);
+
+  boolNDArray b = x.bool_array_value ();
+
+  return ovl (octave_value (new octave_packed_bool_matrix (b)));
+}
+
+/*
+%!test
+%! x = mod (1:200, 3) == 0;
+%! p = packlogical (x);
+%! assert (islogical (p));
+%! assert (class (p), "logical");
+%! assert (size (p), size (x));
+%! assert (logical (p), x);
+%! assert (nnz (p), nnz (x));
+
+%!test
+%! p = packlogical (true (1, 128));
+%! assert (sizeof (p), 16);
+
+%!test
+%! a = sin (1:100);
+%! p = packlogical (a > 0);
+%! assert (a(p), a(a > 0));
+
+%!assert (packlogical (logical (zeros (0, 0))), logical (zeros (0, 0)))
+%!assert (double (packlogical ([0 1 1])), [0 1 1])
+
+%!test
+%! ## Save/load must repack the words, not leave them empty.
+%! p = packlogical (mod (1:100, 7) == 0);
+%! fname = tempname ();
+%! unwind_protect
+%!   save ("-text", fname, "p");
+%!   s = load (fname);
+%!   assert (logical (s.p), mod (1:100, 7) == 0);
+%!   assert (nnz (s.p), nnz (mod (1:100, 7) == 0));
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+
+%!error packlogical ()
+%!error packlogical (1, 2)
+*/
+
+DEFUN (unpacklogical, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{x} =} unpacklogical (@var{p})
+Return the full, one byte per element, representation of a logical
+array created by @code{packlogical}.
+
+If @var{p} is not packed it is returned unchanged.
+@seealso{packlogical, ispackedlogical}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  octave_value x = args(0);
+
+  if (x.type_id () == octave_packed_bool_matrix::static_type_id ())
+    return ovl (octave_value (x.bool_array_value ()));
+
+  return ovl (x);
+}
+
+/*
+%!test
+%! p = packlogical (eye (5) != 0);
+%! x = unpacklogical (p);
+%! assert (! ispackedlogical (x));
+%! assert (x, eye (5) != 0);
+
+%!assert (unpacklogical (1:5), 1:5)
+
+%!error unpacklogical ()
+*/
+
+DEFUN (ispackedlogical, args, ,
+       doc: /* -*- texinfo -*-
+@deftypefn {} {@var{tf} =} ispackedlogical (@var{x})
+Return true if @var{x} is a logical array stored one bit per element.
+@seealso{packlogical, unpacklogical}
+@end deftypefn */)
+{
+  if (args.length () != 1)
+    print_usage ();
+
+  return ovl (args(0).type_id ()
+              == octave_packed_bool_matrix::static_type_id ());
+}
+
+/*
+%!assert (ispackedlogical (packlogical ([true false])), true)
+%!assert (ispackedlogical ([true false]), false)
+%!assert (ispackedlogical (1), false)
+
+%!test
+%! p = packlogical (rand (3) > 0.5);
+%! q = p & p;
+%! assert (ispackedlogical (q));
+%! assert (logical (q), logical (p));
+
+%!test
+%! x = mod (1:100, 7) == 0;
+%! y = mod (1:100, 5) == 0;
+%! px = packlogical (x);
+%! py = packlogical (y);
+%! assert (logical (px & py), x & y);
+%! assert (logical (px | py), x | y);
+%! assert (logical (! px), ! x);
+%! assert (ispackedlogical (px & py) && ispackedlogical (! px));
+%! assert (nnz (! px), nnz (! x));
+%! assert (px & y, x & y);
+%! assert (all (packlogical (true (1, 70))), true);
+%! assert (any (packlogical (false (1, 70))), false);
+
+%!error ispackedlogical ()
+*/
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,325 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "ov-const-mat.h"
+
+#include "error.h"
+#include "errwarn.h"
+#include "ls-oct-text.h"
+#include "ls-oct-binary.h"
+#include "ops.h"
+#include "ov-scalar.h"
+#include "ovl.h"
+
+DEFINE_OV_TYPEID_FUNCTIONS_AND_DATA (octave_const_matrix,
+                                     "constant matrix", "double");
+
+static octave_base_value *
+default_numeric_conversion_function (const octave_base_value& a)
+{
+  const octave_const_matrix& v
+    = dynamic_cast<const octave_const_matrix&> (a);
+
+  return v.full_value ().clone ();
+}
+
+octave_base_value::type_conv_info
+octave_const_matrix::numeric_conversion_function () const
+{
+  return octave_base_value::type_conv_info
+         (default_numeric_conversion_function,
+          octave_matrix::static_type_id ());
+}
+
+octave_base_value *
+octave_const_matrix::try_narrowing_conversion ()
+{
+  octave_base_value *retval = nullptr;
+
+  octave_idx_type n = m_dims.numel ();
+
+  if (n == 1)
+    retval = new octave_scalar (m_val);
+  else if (n == 0)
+    retval = new octave_matrix (NDArray (m_dims));
+
+  return retval;
+}
+
+const octave_value&
+octave_const_matrix::make_value () const
+{
+  if (m_value.is_undefined ())
+    m_value = octave_value (NDArray (m_dims, m_val));
+
+  return m_value;
+}
+
+octave_value&
+octave_const_matrix::make_value ()
+{
+  const octave_const_matrix *cthis = this;
+
+  cthis->make_value ();
+
+  return m_value;
+}
+
+octave_value
+octave_const_matrix::fast_elem_extract (octave_idx_type n) const
+{
+  if (n < 0 || n >= m_dims.numel ())
+    return octave_value ();
+
+  return m_val;
+}
+
+// Indexing a constant array yields a constant array, so for index
+// forms whose result dimensions are easy to determine -- a single
+// colon, or a full subscript list -- stay symbolic.  Anything doubtful
+// falls back to the expanded value.
+
+octave_value
+octave_const_matrix::do_index_op (const octave_value_list& idx,
+                                  bool resize_ok)
+{
+  octave_idx_type nidx = idx.length ();
+
+  if (! resize_ok && nidx > 0)
+    {
+      if (nidx == 1 && idx(0).is_magic_colon ())
+        return octave_value
+               (new octave_const_matrix
+                (m_val, dim_vector (m_dims.numel (), 1)));
+
+      if (nidx > 1)
+        {
+          int ndims = m_dims.ndims ();
+
+          dim_vector rdims;
+          rdims.resize (nidx);
+
+          bool ok = true;
+
+          for (octave_idx_type i = 0; i < nidx && ok; i++)
+            {
+              // The last subscript sees the product of the remaining
+              // dimensions, trailing subscripts beyond them see 1.
+
+              octave_idx_type d = 1;
+
+              if (i < ndims)
+                {
+                  d = m_dims(i);
+
+                  if (i == nidx - 1)
+                    for (int j = i + 1; j < ndims; j++)
+                      d *= m_dims(j);
+                }
+
+              try
+                {
+                  octave::idx_vector iv = idx(i).index_vector ();
+
+                  if (iv.extent (d) > d)
+                    ok = false;
+                  else
+                    rdims(i) = iv.length (d);
+                }
+              catch (const octave::index_exception&)
+                {
+                  ok = false;
+                }
+            }
+
+          if (ok)
+            {
+              if (rdims.numel () == 1)
+                return octave_value (m_val);
+
+              return octave_value (new octave_const_matrix (m_val, rdims));
+            }
+        }
+    }
+
+  return make_value ().index_op (idx, resize_ok);
+}
+
+octave_value
+octave_const_matrix::reshape (const dim_vector& new_dims) const
+{
+  if (new_dims.numel () == m_dims.numel ())
+    return octave_value (new octave_const_matrix (m_val, new_dims));
+
+  return make_value ().reshape (new_dims);
+}
+
+// Constant arrays are saved in their expanded form so that the files
+// remain readable by older versions; a file written this way reads
+// back as a plain matrix.  If a value of this type is nevertheless
+// asked to load itself, the constant must be recovered from the
+// expanded data -- anything non-uniform cannot be represented here.
+
+static const std::string value_save_tag ("value");
+
+static double
+extract_constant (const octave_value& value)
+{
+  NDArray nda = value.array_value ();
+
+  octave_idx_type nel = nda.numel ();
+  const double *v = nda.data ();
+
+  double c = (nel > 0 ? v[0] : 0);
+
+  for (octave_idx_type i = 1; i < nel; i++)
+    if (v[i] != c)
+      error ("constant matrix: non-constant data on load");
+
+  return c;
+}
+
+bool
+octave_const_matrix::save_ascii (std::ostream& os)
+{
+  return save_text_data (os, make_value (), value_save_tag, false, 0);
+}
+
+bool
+octave_const_matrix::load_ascii (std::istream& is)
+{
+  bool dummy;
+
+  std::string nm = read_text_data (is, "", dummy, m_value, 0);
+
+  if (nm != value_save_tag)
+    error ("constant matrix: corrupted data on load");
+
+  m_dims = m_value.dims ();
+  m_val = extract_constant (m_value);
+
+  return true;
+}
+
+bool
+octave_const_matrix::save_binary (std::ostream& os, bool save_as_floats)
+{
+  return save_binary_data (os, make_value (), value_save_tag,
+                           "", false, save_as_floats);
+}
+
+bool
+octave_const_matrix::load_binary (std::istream& is, bool swap,
+                                  octave::mach_info::float_format fmt)
+{
+  bool dummy;
+  std::string doc;
+
+  std::string nm = read_binary_data (is, swap, fmt, "", dummy, m_value, doc);
+
+  if (nm != value_save_tag)
+    error ("constant matrix: corrupted data on load");
+
+  m_dims = m_value.dims ();
+  m_val = extract_constant (m_value);
+
+  return true;
+}
+
+/*
+%!assert (typeinfo (zeros (2, 3)), "constant matrix")
+%!assert (typeinfo (ones (2, 3)), "constant matrix")
+%!assert (typeinfo (zeros (2)), "constant matrix")
+%!assert (typeinfo (zeros ()), "scalar")
+%!assert (typeinfo (zeros (0, 3)), "matrix")
+
+%!test
+%! z = zeros (3, 4);
+%! assert (class (z), "double");
+%! assert (size (z), [3, 4]);
+%! assert (nnz (z), 0);
+%! assert (sizeof (z), 8);
+%! assert (z + 0 == 0);
+%! o = ones (3, 4);
+%! assert (nnz (o), 12);
+%! assert (sum (o(:)), 12);
+
+%!test
+%! z = zeros (2, 3);
+%! z(2, 2) = 5;
+%! assert (z, [0, 0, 0; 0, 5, 0]);
+%! assert (typeinfo (z), "matrix");
+
+%!test
+%! x = magic (4);
+%! assert (x + zeros (4), x);
+%! assert (zeros (4) + x, x);
+%! assert (x - zeros (4), x);
+%! assert (x .* ones (4), x);
+%! assert (x ./ ones (4), x);
+%! assert (typeinfo (zeros (3, 2)(:)), "constant matrix");
+%! assert (size (zeros (3, 2)(:)), [6, 1]);
+%! assert (typeinfo (ones (4, 4)(2:3, [1 1 2])), "constant matrix");
+%! assert (size (ones (4, 4)(2:3, [1 1 2])), [2, 3]);
+%! assert (ones (2, 2)(2, 2), 1);
+
+%!test
+%! ## Adding zeros must follow IEEE 754 signed-zero rules: -0 + 0 is
+%! ## +0, so addition is not folded away.  Subtracting zeros is exact.
+%! x = [-0, 0];
+%! assert (signbit (x + zeros (1, 2)), [false, false]);
+%! assert (signbit (zeros (1, 2) + x), [false, false]);
+%! assert (signbit (zeros (1, 2) - x), [false, false]);
+%! assert (signbit (x - zeros (1, 2)), [true, false]);
+
+%!test
+%! c = ones (3, 4) * 7;
+%! assert (typeinfo (c), "constant matrix");
+%! assert (c, repmat (7, 3, 4));
+%! assert (typeinfo (2 + zeros (5, 5)), "constant matrix");
+%! assert (typeinfo (reshape (zeros (4, 6), 3, 8)), "constant matrix");
+%! assert (reshape (zeros (4, 6), 3, 8), zeros (3, 8));
+
+%!test
+%! ## Save/load must round-trip the constant, not reset it to zeros.
+%! o = ones (3, 2);
+%! fname = tempname ();
+%! unwind_protect
+%!   save ("-text", fname, "o");
+%!   s = load (fname);
+%!   assert (s.o, ones (3, 2));
+%!   assert (nnz (s.o), 6);
+%!   assert (magic (3)(:,1:2) + s.o, magic (3)(:,1:2) + 1);
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+
+%!error zeros (2)(3, 1)
+%!error ones (2, 2)(0)
+*/
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_ov_const_mat_h)
+#define octave_ov_const_mat_h 1
+
+#include "octave-config.h"
+
+#include "ov-re-mat.h"
+
+// Real matrices whose elements are all the same value, as produced by
+// zeros and ones.  Like ranges and lazy indices, these stay in their
+// symbolic form -- a scalar and a dim_vector -- until an operation
+// actually needs the full NDArray, at which point the expanded value
+// is created on demand and cached.  Elementwise identities such as
+// X + zeros (...) and arithmetic with scalars are handled without
+// expansion in op-cnst.cc.
+
+class
+OCTINTERP_API
+octave_const_matrix : public octave_base_value
+{
+public:
+
+  octave_const_matrix ()
+    : octave_base_value (), m_val (0), m_dims (0, 0), m_value () { }
+
+  octave_const_matrix (double val, const dim_vector& dims)
+    : octave_base_value (), m_val (val), m_dims (dims), m_value () { }
+
+  octave_const_matrix (const octave_const_matrix& m)
+    : octave_base_value (), m_val (m.m_val), m_dims (m.m_dims),
+      m_value (m.m_value) { }
+
+  ~octave_const_matrix () = default;
+
+  octave_base_value * clone () const
+  { return new octave_const_matrix (*this); }
+  octave_base_value * empty_clone () const { return new octave_matrix (); }
+
+  type_conv_info numeric_conversion_function () const;
+
+  octave_base_value * try_narrowing_conversion ();
+
+  octave_value full_value () const { return make_value (); }
+
+  double constant_value () const { return m_val; }
+
+  octave_value fast_elem_extract (octave_idx_type n) const;
+
+  std::size_t byte_size () const { return sizeof (double); }
+
+  octave_idx_type nnz () const
+  { return m_val != 0 ? m_dims.numel () : 0; }
+
+  bool is_true () const
+  { return m_dims.numel () > 0 && m_val != 0; }
+
+  octave::idx_vector index_vector (bool require_integers = false) const
+  { return make_value ().index_vector (require_integers); }
+
+  // We don't need to override all three forms of subsref.  The using
+  // declaration will avoid warnings about partially-overloaded virtual
+  // functions.
+  using octave_base_value::subsref;
+
+  octave_value subsref (const std::string& type,
+                        const std::list<octave_value_list>& idx)
+  { return make_value ().subsref (type, idx); }
+
+  octave_value_list subsref (const std::string& type,
+                             const std::list<octave_value_list>& idx, int)
+  { return subsref (type, idx); }
+
+  octave_value do_index_op (const octave_value_list& idx,
+                            bool resize_ok = false);
+
+  dim_vector dims () const { return m_dims; }
+
+  octave_value reshape (const dim_vector& new_dims) const;
+
+  octave_value permute (const Array<int>& vec, bool inv = false) const
+  { return make_value ().permute (vec, inv); }
+
+  octave_value resize (const dim_vector& dv, bool fill = false) const
+  { return make_value ().resize (dv, fill); }
+
+  octave_value all (int dim = 0) const { return make_value ().all (dim); }
+  octave_value any (int dim = 0) const { return make_value ().any (dim); }
+
+  octave_value sort (octave_idx_type dim = 0, sortmode mode = ASCENDING) const
+  { return octave_value (clone ()); }
+
+  octave_value sort (Array<octave_idx_type>& sidx, octave_idx_type dim = 0,
+                     sortmode mode = ASCENDING) const
+  { return make_value ().sort (sidx, dim, mode); }
+
+  sortmode issorted (sortmode mode = UNSORTED) const
+  { return make_value ().issorted (mode); }
+
+  bool is_matrix_type () const { return true; }
+
+  bool isnumeric () const { return true; }
+
+  bool is_real_matrix () const { return true; }
+
+  bool isreal () const { return true; }
+
+  bool is_double_type () const { return true; }
+
+  bool isfloat () const { return true; }
+
+  bool is_defined () const { return true; }
+
+  bool is_constant () const { return true; }
+
+  builtin_type_t builtin_type () const { return btyp_double; }
+
+  bool print_as_scalar () const
+  { return make_value ().print_as_scalar (); }
+
+  void print (std::ostream& os, bool pr_as_read_syntax = false)
+  { make_value ().print (os, pr_as_read_syntax); }
+
+  void print_raw (std::ostream& os, bool pr_as_read_syntax = false) const
+  { make_value ().print_raw (os, pr_as_read_syntax); }
+
+  void print_info (std::ostream& os, const std::string& prefix) const
+  { make_value ().print_info (os, prefix); }
+
+#define FORWARD_VALUE_QUERY1(TYPE, NAME)        \
+  TYPE NAME (bool flag = false) const           \
+  {                                             \
+    return make_value ().NAME (flag);           \
+  }
+
+  FORWARD_VALUE_QUERY1 (double, double_value)
+  FORWARD_VALUE_QUERY1 (float, float_value)
+  FORWARD_VALUE_QUERY1 (double, scalar_value)
+  FORWARD_VALUE_QUERY1 (Matrix, matrix_value)
+  FORWARD_VALUE_QUERY1 (FloatMatrix, float_matrix_value)
+  FORWARD_VALUE_QUERY1 (Complex, complex_value)
+  FORWARD_VALUE_QUERY1 (FloatComplex, float_complex_value)
+  FORWARD_VALUE_QUERY1 (ComplexMatrix, complex_matrix_value)
+  FORWARD_VALUE_QUERY1 (FloatComplexMatrix, float_complex_matrix_value)
+  FORWARD_VALUE_QUERY1 (ComplexNDArray, complex_array_value)
+  FORWARD_VALUE_QUERY1 (FloatComplexNDArray, float_complex_array_value)
+  FORWARD_VALUE_QUERY1 (boolNDArray, bool_array_value)
+  FORWARD_VALUE_QUERY1 (charNDArray, char_array_value)
+  FORWARD_VALUE_QUERY1 (NDArray, array_value)
+  FORWARD_VALUE_QUERY1 (FloatNDArray, float_array_value)
+  FORWARD_VALUE_QUERY1 (SparseMatrix, sparse_matrix_value)
+  FORWARD_VALUE_QUERY1 (SparseComplexMatrix, sparse_complex_matrix_value)
+
+#undef FORWARD_VALUE_QUERY1
+
+  octave_value convert_to_str_internal (bool pad, bool force, char type) const
+  {
+    return make_value ().convert_to_str_internal (pad, force, type);
+  }
+
+  octave_value as_double () const { return octave_value (clone ()); }
+  octave_value as_single () const { return make_value ().as_single (); }
+
+  bool save_ascii (std::ostream& os);
+
+  bool load_ascii (std::istream& is);
+
+  bool save_binary (std::ostream& os, bool save_as_floats);
+
+  bool load_binary (std::istream& is, bool swap,
+                    octave::mach_info::float_format fmt);
+
+  octave_value map (unary_mapper_t umap) const
+  { return make_value ().map (umap); }
+
+private:
+
+  const octave_value& make_value () const;
+
+  octave_value& make_value ();
+
+  // The common element value and the dimensions of the array it
+  // fills.
+
+  double m_val;
+  dim_vector m_dims;
+
+  // The cached full representation, created on demand.
+
+  mutable octave_value m_value;
+
+  DECLARE_OV_TYPEID_FUNCTIONS_AND_DATA
+};
+
+#endif
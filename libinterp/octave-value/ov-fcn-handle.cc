@@ -41,6 +41,7 @@
 #include "defun.h"
 #include "error.h"
 #include "errwarn.h"
+#include "fcn-info.h"
 #include "file-stat.h"
 #include "input.h"
 #include "interpreter-private.h"
@@ -232,6 +233,13 @@ public:
 private:
 
   octave_value m_fcn;
+
+  // Cached result of the per-call function lookup; see call.
+
+  octave_value m_cached_fcn;
+  symbol_scope m_cached_fcn_scope;
+  std::string m_cached_dispatch_type;
+  std::size_t m_cached_fcn_revision = 0;
 };
 
 class scoped_fcn_handle : public base_fcn_handle
@@ -1088,37 +1096,85 @@ simple_fcn_handle::call (int nargout, const octave_value_list& args)
       // to do this regardless of whether a function was found when
       // the handle was created.
 
-      octave_value ov_fcn = symtab.find_function (m_name, args);
-
-      if (m_fcn.is_defined ())
+      // The result of that lookup only changes when the function
+      // table changes, when the calling scope changes (private
+      // functions and subfunctions), or when the dispatch type of the
+      // arguments changes (class methods).  Cache the resolved callee
+      // on the handle keyed on those three things so a handle that is
+      // invoked repeatedly -- cellfun (@sin, ...), solver callbacks
+      // -- pays for a full lookup only on the first call.  The cached
+      // function is still revalidated with the usual out-of-date
+      // check so edited function files are picked up.
+
+      std::size_t revision = symtab.fcn_table_revision ();
+      symbol_scope scope = symtab.current_scope ();
+      std::string dispatch_type = get_dispatch_type (args);
+
+      if (m_cached_fcn_revision == revision
+          && m_cached_fcn.is_defined ()
+          && m_cached_fcn_scope == scope
+          && m_cached_dispatch_type == dispatch_type)
         {
-          // A simple function was found when the handle was created.
-          // Use that unless we find a class method to override it.
+          fcn_to_call = m_cached_fcn;
 
-          fcn_to_call = m_fcn;
+          // Pass the dispatch type only when revalidating a class
+          // method, as fcn_info does.
 
-          if (ov_fcn.is_defined ())
+          octave_function *cached = fcn_to_call.function_value (true);
+
+          if (out_of_date_check (fcn_to_call,
+                                 (cached && cached->is_class_method ()
+                                  ? dispatch_type : "")))
+            m_cached_fcn = fcn_to_call;
+        }
+      else
+        {
+          octave_value ov_fcn = symtab.find_function (m_name, args);
+
+          if (m_fcn.is_defined ())
             {
-              octave_function *fcn = ov_fcn.function_value ();
+              // A simple function was found when the handle was
+              // created.  Use that unless we find a class method to
+              // override it.
 
-              std::string dispatch_class = fcn->dispatch_class ();
+              fcn_to_call = m_fcn;
 
-              if (fcn->is_class_method ())
+              if (ov_fcn.is_defined ())
                 {
-                  // Function found through lookup is a class method
-                  // so use it instead of the simple one found when
-                  // the handle was created.
+                  octave_function *fcn = ov_fcn.function_value ();
+
+                  std::string dispatch_class = fcn->dispatch_class ();
 
-                  fcn_to_call = ov_fcn;
+                  if (fcn->is_class_method ())
+                    {
+                      // Function found through lookup is a class
+                      // method so use it instead of the simple one
+                      // found when the handle was created.
+
+                      fcn_to_call = ov_fcn;
+                    }
                 }
             }
-        }
-      else
-        {
-          // There was no simple function found when the handle was
-          // created so use the one found here (if any).
+          else
+            {
+              // There was no simple function found when the handle
+              // was created so use the one found here (if any).
+
+              fcn_to_call = ov_fcn;
+            }
 
-          fcn_to_call = ov_fcn;
+          if (fcn_to_call.is_defined ())
+            {
+              m_cached_fcn = fcn_to_call;
+              m_cached_fcn_scope = scope;
+              m_cached_dispatch_type = dispatch_type;
+              m_cached_fcn_revision = revision;
+            }
+          else
+            {
+              m_cached_fcn = octave_value ();
+              m_cached_fcn_revision = 0;
+            }
         }
     }
 
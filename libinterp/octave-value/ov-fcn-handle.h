@@ -256,7 +256,15 @@ public:
     return m_rep->subsref (type, idx, nargout);
   }
 
-  octave_value_list call (int nargout, const octave_value_list& args);
+  // Invoke the handle directly, without packaging ARGS into a
+  // subsref index list.  This is the preferred entry point for C++
+  // callers that already have an argument list (feval, cellfun and
+  // friends).
+
+  octave_value_list call (int nargout, const octave_value_list& args)
+  {
+    return m_rep->call (nargout, args);
+  }
 
   bool is_defined () const { return true; }
 
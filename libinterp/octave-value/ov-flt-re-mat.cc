@@ -618,9 +618,13 @@ octave_float_matrix::save_hdf5 (octave_hdf5_id loc_id, const char *name, bool)
     }
 #endif
 #if defined (HAVE_HDF5_18)
+  hid_t dcpl_hid = hdf5_dataset_creation_plist (space_hid);
+
   data_hid = H5Dcreate (loc_id, name, save_type_hid, space_hid,
-                        octave_H5P_DEFAULT, octave_H5P_DEFAULT,
-                        octave_H5P_DEFAULT);
+                        octave_H5P_DEFAULT, dcpl_hid, octave_H5P_DEFAULT);
+
+  if (dcpl_hid != octave_H5P_DEFAULT)
+    H5Pclose (dcpl_hid);
 #else
   data_hid = H5Dcreate (loc_id, name, save_type_hid, space_hid,
                         octave_H5P_DEFAULT);
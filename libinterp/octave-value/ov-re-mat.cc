@@ -744,9 +744,13 @@ octave_matrix::save_hdf5 (octave_hdf5_id loc_id, const char *name,
 #endif
 
 #if defined (HAVE_HDF5_18)
+  hid_t dcpl_hid = hdf5_dataset_creation_plist (space_hid);
+
   data_hid = H5Dcreate (loc_id, name, save_type_hid, space_hid,
-                        octave_H5P_DEFAULT, octave_H5P_DEFAULT,
-                        octave_H5P_DEFAULT);
+                        octave_H5P_DEFAULT, dcpl_hid, octave_H5P_DEFAULT);
+
+  if (dcpl_hid != octave_H5P_DEFAULT)
+    H5Pclose (dcpl_hid);
 #else
   data_hid = H5Dcreate (loc_id, name, save_type_hid, space_hid,
                         octave_H5P_DEFAULT);
@@ -948,10 +952,28 @@ octave_matrix::map (unary_mapper_t umap) const
       ARRAY_MAPPER (asinh, double, octave::math::asinh);
       ARRAY_MAPPER (atan, double, ::atan);
       RC_ARRAY_MAPPER (atanh, Complex, octave::math::rc_atanh);
-      ARRAY_MAPPER (erf, double, octave::math::erf);
+
+      // erf and erfc have batched kernels that can use all elements at
+      // once instead of mapping element by element.
+
+    case umap_erf:
+      {
+        NDArray r (m_matrix.dims ());
+        octave::math::erf (m_matrix.data (), r.fortran_vec (),
+                           m_matrix.numel ());
+        return octave_value (r);
+      }
+
+    case umap_erfc:
+      {
+        NDArray r (m_matrix.dims ());
+        octave::math::erfc (m_matrix.data (), r.fortran_vec (),
+                            m_matrix.numel ());
+        return octave_value (r);
+      }
+
       ARRAY_MAPPER (erfinv, double, octave::math::erfinv);
       ARRAY_MAPPER (erfcinv, double, octave::math::erfcinv);
-      ARRAY_MAPPER (erfc, double, octave::math::erfc);
       ARRAY_MAPPER (erfcx, double, octave::math::erfcx);
       ARRAY_MAPPER (erfi, double, octave::math::erfi);
       ARRAY_MAPPER (dawson, double, octave::math::dawson);
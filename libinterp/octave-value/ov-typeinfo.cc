@@ -80,7 +80,8 @@ type_info::type_info (int init_tab_sz)
     m_assign_ops (dim_vector (octave_value::num_assign_ops, init_tab_sz, init_tab_sz), nullptr),
     m_assignany_ops (dim_vector (octave_value::num_assign_ops, init_tab_sz), nullptr),
     m_pref_assign_conv (dim_vector (init_tab_sz, init_tab_sz), -1),
-    m_widening_ops (dim_vector (init_tab_sz, init_tab_sz), nullptr)
+    m_widening_ops (dim_vector (init_tab_sz, init_tab_sz), nullptr),
+    m_binary_ops_generation (0)
 {
   install_types (*this);
 
@@ -290,6 +291,8 @@ bool type_info::register_binary_op (octave_value::binary_op op,
   m_binary_ops.checkelem (static_cast<int> (op), t1, t2)
     = reinterpret_cast<void *> (f);
 
+  m_binary_ops_generation++;
+
   return false;
 }
 
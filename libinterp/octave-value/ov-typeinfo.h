@@ -199,6 +199,11 @@ public:
 
   binary_op_fcn lookup_binary_op (octave_value::binary_op, int, int);
 
+  // Incremented whenever a binary operator is (re)registered, so that
+  // call sites caching a looked-up binary_op_fcn can tell when their
+  // cached resolution may have gone stale.
+  int binary_ops_generation () const { return m_binary_ops_generation; }
+
   binary_class_op_fcn
   lookup_binary_class_op (octave_value::compound_binary_op);
 
@@ -262,6 +267,8 @@ private:
   Array<int> m_pref_assign_conv;
 
   Array<void *> m_widening_ops;
+
+  int m_binary_ops_generation;
 };
 
 OCTAVE_END_NAMESPACE(octave)
@@ -41,6 +41,8 @@
 #include "ov-base.h"
 #include "ov-bool.h"
 #include "ov-bool-mat.h"
+#include "ov-bool-packed.h"
+#include "ov-const-mat.h"
 #include "ov-cell.h"
 #include "ov-scalar.h"
 #include "ov-float.h"
@@ -89,6 +91,7 @@
 #include "defun.h"
 #include "error.h"
 #include "errwarn.h"
+#include "interp-stats.h"
 #include "interpreter-private.h"
 #include "pager.h"
 #include "parse.h"
@@ -1534,9 +1537,16 @@ octave_value::assign (assign_op op, const std::string& type,
 
       octave_value t = subsref (type, idx);
 
-      binary_op binop = op_eq_to_binary_op (op);
+      // T is a unique copy of the indexed slice, so op= on it goes
+      // through the in-place assign operators when they are
+      // registered for this type pair instead of allocating a second
+      // temporary for the binary op result.  When no in-place
+      // handler exists, assign falls back to the equivalent binary
+      // op, so the semantics are unchanged.
 
-      t_rhs = octave::binary_op (binop, t, rhs);
+      t.assign (op, rhs);
+
+      t_rhs = t;
     }
 
   *this = subsasgn (type, idx, t_rhs);
@@ -2367,6 +2377,8 @@ octave_value::non_const_unary_op (unary_op op)
           if (! cf)
             err_unary_op (octave_value::unary_op_as_string (op), type_name ());
 
+          octave::interp_stats::count_type_conversion ();
+
           octave_base_value *tmp = cf (*m_rep);
 
           if (! tmp)
@@ -2557,6 +2569,75 @@ err_binary_op_conv (const std::string& on)
   error ("type conversion failed for binary operator '%s'", on.c_str ());
 }
 
+// Mixed real scalar-matrix arithmetic dominates interpreted inner
+// loops.  Routing each operation through the registered operator
+// tables costs a bounds-checked table lookup and an indirect call, so
+// recognize the common combinations up front and run the array
+// kernels (which already take the scalar operand in a register)
+// directly.  Only operations whose registered handlers are simple
+// elementwise kernels are short-circuited; everything else, including
+// scalar-first division, takes the normal route.
+
+static bool
+mixed_scalar_matrix_op (octave_value::binary_op op,
+                        const octave_base_value& mrep, double s,
+                        bool scalar_first, octave_value& result)
+{
+  const octave_matrix& mv = static_cast<const octave_matrix&> (mrep);
+
+  NDArray a = mv.array_value ();
+
+  switch (op)
+    {
+    case octave_value::op_add:
+      result = a + s;
+      return true;
+
+    case octave_value::op_sub:
+      result = scalar_first ? s - a : a - s;
+      return true;
+
+    case octave_value::op_mul:
+    case octave_value::op_el_mul:
+      result = a * s;
+      return true;
+
+    case octave_value::op_div:
+    case octave_value::op_el_div:
+      if (scalar_first)
+        return false;
+      result = a / s;
+      return true;
+
+    case octave_value::op_lt:
+      result = scalar_first ? mx_el_lt (s, a) : mx_el_lt (a, s);
+      return true;
+
+    case octave_value::op_le:
+      result = scalar_first ? mx_el_le (s, a) : mx_el_le (a, s);
+      return true;
+
+    case octave_value::op_eq:
+      result = mx_el_eq (a, s);
+      return true;
+
+    case octave_value::op_ge:
+      result = scalar_first ? mx_el_ge (s, a) : mx_el_ge (a, s);
+      return true;
+
+    case octave_value::op_gt:
+      result = scalar_first ? mx_el_gt (s, a) : mx_el_gt (a, s);
+      return true;
+
+    case octave_value::op_ne:
+      result = mx_el_ne (a, s);
+      return true;
+
+    default:
+      return false;
+    }
+}
+
 octave_value
 binary_op (type_info& ti, octave_value::binary_op op,
            const octave_value& v1, const octave_value& v2)
@@ -2566,6 +2647,25 @@ binary_op (type_info& ti, octave_value::binary_op op,
   int t1 = v1.type_id ();
   int t2 = v2.type_id ();
 
+  if (t1 == octave_matrix::static_type_id ()
+      && t2 == octave_scalar::static_type_id ())
+    {
+      double s = static_cast<const octave_scalar&> (v2.get_rep ())
+                 .octave_scalar::double_value ();
+
+      if (mixed_scalar_matrix_op (op, v1.get_rep (), s, false, retval))
+        return retval;
+    }
+  else if (t1 == octave_scalar::static_type_id ()
+           && t2 == octave_matrix::static_type_id ())
+    {
+      double s = static_cast<const octave_scalar&> (v1.get_rep ())
+                 .octave_scalar::double_value ();
+
+      if (mixed_scalar_matrix_op (op, v2.get_rep (), s, true, retval))
+        return retval;
+    }
+
   if (t1 == octave_class::static_type_id ()
       || t2 == octave_class::static_type_id ()
       || t1 == octave_classdef::static_type_id ()
@@ -2609,6 +2709,8 @@ binary_op (type_info& ti, octave_value::binary_op op,
 
           if (cf1)
             {
+              octave::interp_stats::count_type_conversion ();
+
               octave_base_value *tmp = cf1 (v1.get_rep ());
 
               if (! tmp)
@@ -2622,6 +2724,8 @@ binary_op (type_info& ti, octave_value::binary_op op,
 
           if (cf2)
             {
+              octave::interp_stats::count_type_conversion ();
+
               octave_base_value *tmp = cf2 (v2.get_rep ());
 
               if (! tmp)
@@ -2654,6 +2758,8 @@ binary_op (type_info& ti, octave_value::binary_op op,
 
               if (cf1)
                 {
+                  octave::interp_stats::count_type_conversion ();
+
                   octave_base_value *tmp = cf1 (tv1.get_rep ());
 
                   if (! tmp)
@@ -2665,6 +2771,8 @@ binary_op (type_info& ti, octave_value::binary_op op,
 
               if (cf2)
                 {
+                  octave::interp_stats::count_type_conversion ();
+
                   octave_base_value *tmp = cf2 (tv2.get_rep ());
 
                   if (! tmp)
@@ -3467,6 +3575,8 @@ unary_op (type_info& ti, octave_value::unary_op op,
             err_unary_op (octave_value::unary_op_as_string (op),
                           v.type_name ());
 
+          octave::interp_stats::count_type_conversion ();
+
           octave_base_value *tmp = cf (v.get_rep ());
 
           if (! tmp)
@@ -3512,6 +3622,8 @@ install_types (octave::type_info& ti)
 
   octave_bool::register_type (ti);
   octave_bool_matrix::register_type (ti);
+  octave_packed_bool_matrix::register_type (ti);
+  octave_const_matrix::register_type (ti);
   octave_char_matrix_str::register_type (ti);
   octave_char_matrix_sq_str::register_type (ti);
   octave_int8_scalar::register_type (ti);
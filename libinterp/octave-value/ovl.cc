@@ -106,6 +106,14 @@ octave_value_list::append (const octave_value& val)
   return *this;
 }
 
+octave_value_list&
+octave_value_list::append (octave_value&& val)
+{
+  m_data.push_back (std::move (val));
+
+  return *this;
+}
+
 octave_value_list&
 octave_value_list::append (const octave_value_list& lst)
 {
@@ -277,7 +285,7 @@ void
 octave_value_list::make_storable_values ()
 {
   octave_idx_type len = length ();
-  const std::vector<octave_value>& cdata = m_data;
+  const auto& cdata = m_data;
 
   for (octave_idx_type i = 0; i < len; i++)
     {
@@ -29,9 +29,11 @@
 #include "octave-config.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 #include <initializer_list>
 
+#include "oct-small-vector.h"
 #include "str-vec.h"
 #include "Array.h"
 
@@ -55,6 +57,12 @@ public:
   octave_value_list (const octave_value& tc)
     : m_data (1, tc), m_names () { }
 
+  octave_value_list (octave_value&& tc)
+    : m_data (), m_names ()
+  {
+    m_data.push_back (std::move (tc));
+  }
+
   template<template <typename...> class OV_Container>
   octave_value_list (const OV_Container<octave_value>& args)
     : m_data (args.begin (), args.end ()), m_names () { }
@@ -123,6 +131,8 @@ public:
 
   octave_value_list& append (const octave_value& val);
 
+  octave_value_list& append (octave_value&& val);
+
   octave_value_list& append (const octave_value_list& lst);
 
   octave_value_list& reverse ();
@@ -174,7 +184,10 @@ public:
 
 private:
 
-  std::vector<octave_value> m_data;
+  // Short argument and return lists are the common case, so the first
+  // few elements are stored in the list object itself.
+
+  octave::small_vector<octave_value, 4> m_data;
 
   // The list of strings can be used to tag each element of m_data with a name.
   // By default, it is empty.
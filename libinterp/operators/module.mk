@@ -14,6 +14,7 @@ LIBINTERP_OPERATORS_SRC = \
   %reldir%/op-cell.cc \
   %reldir%/op-chm.cc \
   %reldir%/op-class.cc \
+  %reldir%/op-cnst.cc \
   %reldir%/op-cm-cdm.cc \
   %reldir%/op-cm-cm.cc \
   %reldir%/op-cm-cs.cc \
@@ -87,6 +88,7 @@ LIBINTERP_OPERATORS_SRC = \
   %reldir%/op-m-scm.cc \
   %reldir%/op-m-sm.cc \
   %reldir%/op-mi.cc \
+  %reldir%/op-pbm-pbm.cc \
   %reldir%/op-pm-cm.cc \
   %reldir%/op-pm-fcm.cc \
   %reldir%/op-pm-fm.cc \
@@ -162,6 +162,13 @@ install_cm_cs_ops (octave::type_info& ti)
   INSTALL_ASSIGNOP_TI (ti, op_div_eq, octave_complex_matrix,
                        octave_complex_scalar,
                        assign_div);
+
+  INSTALL_ASSIGNOP_TI (ti, op_el_mul_eq, octave_complex_matrix,
+                       octave_complex_scalar,
+                       assign_mul);
+  INSTALL_ASSIGNOP_TI (ti, op_el_div_eq, octave_complex_matrix,
+                       octave_complex_scalar,
+                       assign_div);
 }
 
 OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,334 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "errwarn.h"
+#include "ovl.h"
+#include "ov.h"
+#include "ov-const-mat.h"
+#include "ov-re-mat.h"
+#include "ov-scalar.h"
+#include "ov-typeinfo.h"
+#include "ops.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Arithmetic involving constant arrays that can be carried out on the
+// scalar value alone stays symbolic: exact identity operands
+// (X .* ones, X ./ ones, X - zeros) return the other operand
+// unchanged and operations with scalars produce another constant
+// array.  Everything that depends on the individual elements of the
+// other operand falls back to the expanded representations.  Note
+// that X + zeros and zeros - X are NOT identities under IEEE 754:
+// -0 + 0 is +0, not -0, and 0 - (+0) is +0, not -0, so additions
+// always compute.
+
+static octave_value
+make_const (double val, const dim_vector& dims)
+{
+  octave_value retval (new octave_const_matrix (val, dims));
+
+  retval.maybe_mutate ();
+
+  return retval;
+}
+
+// unary constant matrix ops.
+
+DEFUNOP (uplus, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v, a);
+
+  return make_const (v.constant_value (), v.dims ());
+}
+
+DEFUNOP (uminus, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v, a);
+
+  return make_const (- v.constant_value (), v.dims ());
+}
+
+DEFUNOP (transpose, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v, a);
+
+  if (v.ndims () > 2)
+    error ("transpose not defined for N-D objects");
+
+  dim_vector dv = v.dims ();
+
+  return make_const (v.constant_value (), dim_vector (dv(1), dv(0)));
+}
+
+// constant matrix by constant matrix ops.
+
+DEFBINOP (add_cc, const_matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (v1.array_value () + v2.array_value ());
+
+  return make_const (v1.constant_value () + v2.constant_value (),
+                     v1.dims ());
+}
+
+DEFBINOP (sub_cc, const_matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (v1.array_value () - v2.array_value ());
+
+  return make_const (v1.constant_value () - v2.constant_value (),
+                     v1.dims ());
+}
+
+DEFBINOP (el_mul_cc, const_matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (product (v1.array_value (), v2.array_value ()));
+
+  return make_const (v1.constant_value () * v2.constant_value (),
+                     v1.dims ());
+}
+
+DEFBINOP (mul_cc, const_matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  dim_vector d1 = v1.dims ();
+  dim_vector d2 = v2.dims ();
+
+  if (d1.ndims () != 2 || d2.ndims () != 2 || d1(1) != d2(0))
+    return octave_value (v1.matrix_value () * v2.matrix_value ());
+
+  // Every element of the product is the same inner product.
+
+  return make_const (v1.constant_value () * v2.constant_value () * d1(1),
+                     dim_vector (d1(0), d2(1)));
+}
+
+// constant matrix by matrix ops.
+
+DEFBINOP (add_cm, const_matrix, matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v2, a2);
+
+  return octave_value (v1.array_value () + v2.array_value ());
+}
+
+DEFBINOP (sub_cm, const_matrix, matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v2, a2);
+
+  return octave_value (v1.array_value () - v2.array_value ());
+}
+
+DEFBINOP (el_mul_cm, const_matrix, matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v2, a2);
+
+  if (v1.constant_value () == 1 && v1.dims () == v2.dims ())
+    return octave_value (v2.array_value ());
+
+  return octave_value (product (v1.array_value (), v2.array_value ()));
+}
+
+// matrix by constant matrix ops.
+
+DEFBINOP (add_mc, matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  return octave_value (v1.array_value () + v2.array_value ());
+}
+
+DEFBINOP (sub_mc, matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  // Unlike addition, X - zeros is exact: x - (+0) is x, sign
+  // included, for every x.
+
+  if (v2.constant_value () == 0 && v1.dims () == v2.dims ())
+    return octave_value (v1.array_value ());
+
+  return octave_value (v1.array_value () - v2.array_value ());
+}
+
+DEFBINOP (el_mul_mc, matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  if (v2.constant_value () == 1 && v1.dims () == v2.dims ())
+    return octave_value (v1.array_value ());
+
+  return octave_value (product (v1.array_value (), v2.array_value ()));
+}
+
+DEFBINOP (el_div_mc, matrix, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  if (v2.constant_value () == 1 && v1.dims () == v2.dims ())
+    return octave_value (v1.array_value ());
+
+  return octave_value (quotient (v1.array_value (), v2.array_value ()));
+}
+
+// constant matrix by scalar ops.
+
+DEFBINOP (add_cs, const_matrix, scalar)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v2, a2);
+
+  return make_const (v1.constant_value () + v2.double_value (), v1.dims ());
+}
+
+DEFBINOP (sub_cs, const_matrix, scalar)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v2, a2);
+
+  return make_const (v1.constant_value () - v2.double_value (), v1.dims ());
+}
+
+DEFBINOP (mul_cs, const_matrix, scalar)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v2, a2);
+
+  return make_const (v1.constant_value () * v2.double_value (), v1.dims ());
+}
+
+DEFBINOP (div_cs, const_matrix, scalar)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v2, a2);
+
+  return make_const (v1.constant_value () / v2.double_value (), v1.dims ());
+}
+
+// scalar by constant matrix ops.
+
+DEFBINOP (add_sc, scalar, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  return make_const (v1.double_value () + v2.constant_value (), v2.dims ());
+}
+
+DEFBINOP (sub_sc, scalar, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  return make_const (v1.double_value () - v2.constant_value (), v2.dims ());
+}
+
+DEFBINOP (mul_sc, scalar, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  return make_const (v1.double_value () * v2.constant_value (), v2.dims ());
+}
+
+DEFBINOP (el_div_sc, scalar, const_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_scalar&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_const_matrix&, v2, a2);
+
+  return make_const (v1.double_value () / v2.constant_value (), v2.dims ());
+}
+
+void
+install_cnst_ops (octave::type_info& ti)
+{
+  INSTALL_UNOP_TI (ti, op_uplus, octave_const_matrix, uplus);
+  INSTALL_UNOP_TI (ti, op_uminus, octave_const_matrix, uminus);
+  INSTALL_UNOP_TI (ti, op_transpose, octave_const_matrix, transpose);
+  INSTALL_UNOP_TI (ti, op_hermitian, octave_const_matrix, transpose);
+
+  INSTALL_BINOP_TI (ti, op_add, octave_const_matrix, octave_const_matrix,
+                    add_cc);
+  INSTALL_BINOP_TI (ti, op_sub, octave_const_matrix, octave_const_matrix,
+                    sub_cc);
+  INSTALL_BINOP_TI (ti, op_el_mul, octave_const_matrix, octave_const_matrix,
+                    el_mul_cc);
+  INSTALL_BINOP_TI (ti, op_mul, octave_const_matrix, octave_const_matrix,
+                    mul_cc);
+
+  INSTALL_BINOP_TI (ti, op_add, octave_const_matrix, octave_matrix, add_cm);
+  INSTALL_BINOP_TI (ti, op_sub, octave_const_matrix, octave_matrix, sub_cm);
+  INSTALL_BINOP_TI (ti, op_el_mul, octave_const_matrix, octave_matrix,
+                    el_mul_cm);
+
+  INSTALL_BINOP_TI (ti, op_add, octave_matrix, octave_const_matrix, add_mc);
+  INSTALL_BINOP_TI (ti, op_sub, octave_matrix, octave_const_matrix, sub_mc);
+  INSTALL_BINOP_TI (ti, op_el_mul, octave_matrix, octave_const_matrix,
+                    el_mul_mc);
+  INSTALL_BINOP_TI (ti, op_el_div, octave_matrix, octave_const_matrix,
+                    el_div_mc);
+
+  INSTALL_BINOP_TI (ti, op_add, octave_const_matrix, octave_scalar, add_cs);
+  INSTALL_BINOP_TI (ti, op_sub, octave_const_matrix, octave_scalar, sub_cs);
+  INSTALL_BINOP_TI (ti, op_mul, octave_const_matrix, octave_scalar, mul_cs);
+  INSTALL_BINOP_TI (ti, op_el_mul, octave_const_matrix, octave_scalar,
+                    mul_cs);
+  INSTALL_BINOP_TI (ti, op_div, octave_const_matrix, octave_scalar, div_cs);
+  INSTALL_BINOP_TI (ti, op_el_div, octave_const_matrix, octave_scalar,
+                    div_cs);
+
+  INSTALL_BINOP_TI (ti, op_add, octave_scalar, octave_const_matrix, add_sc);
+  INSTALL_BINOP_TI (ti, op_sub, octave_scalar, octave_const_matrix, sub_sc);
+  INSTALL_BINOP_TI (ti, op_mul, octave_scalar, octave_const_matrix, mul_sc);
+  INSTALL_BINOP_TI (ti, op_el_mul, octave_scalar, octave_const_matrix,
+                    mul_sc);
+  INSTALL_BINOP_TI (ti, op_el_div, octave_scalar, octave_const_matrix,
+                    el_div_sc);
+}
+
+OCTAVE_END_NAMESPACE(octave)
@@ -194,6 +194,11 @@ install_fcm_fcs_ops (octave::type_info& ti)
                        octave_float_complex_scalar, assign_mul);
   INSTALL_ASSIGNOP_TI (ti, op_div_eq, octave_float_complex_matrix,
                        octave_float_complex_scalar, assign_div);
+
+  INSTALL_ASSIGNOP_TI (ti, op_el_mul_eq, octave_float_complex_matrix,
+                       octave_float_complex_scalar, assign_mul);
+  INSTALL_ASSIGNOP_TI (ti, op_el_div_eq, octave_float_complex_matrix,
+                       octave_float_complex_scalar, assign_div);
 }
 
 OCTAVE_END_NAMESPACE(octave)
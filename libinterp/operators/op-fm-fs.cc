@@ -169,6 +169,11 @@ install_fm_fs_ops (octave::type_info& ti)
                        assign_mul);
   INSTALL_ASSIGNOP_TI (ti, op_div_eq, octave_float_matrix, octave_float_scalar,
                        assign_div);
+
+  INSTALL_ASSIGNOP_TI (ti, op_el_mul_eq, octave_float_matrix,
+                       octave_float_scalar, assign_mul);
+  INSTALL_ASSIGNOP_TI (ti, op_el_div_eq, octave_float_matrix,
+                       octave_float_scalar, assign_div);
 }
 
 OCTAVE_END_NAMESPACE(octave)
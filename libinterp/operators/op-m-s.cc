@@ -148,6 +148,14 @@ install_m_s_ops (octave::type_info& ti)
   INSTALL_ASSIGNOP_TI (ti, op_sub_eq, octave_matrix, octave_scalar, assign_sub);
   INSTALL_ASSIGNOP_TI (ti, op_mul_eq, octave_matrix, octave_scalar, assign_mul);
   INSTALL_ASSIGNOP_TI (ti, op_div_eq, octave_matrix, octave_scalar, assign_div);
+
+  // For a scalar rhs, the elementwise and matrix forms are the same
+  // operation, so make A .*= s and A ./= s eligible for the in-place
+  // path too.
+  INSTALL_ASSIGNOP_TI (ti, op_el_mul_eq, octave_matrix, octave_scalar,
+                       assign_mul);
+  INSTALL_ASSIGNOP_TI (ti, op_el_div_eq, octave_matrix, octave_scalar,
+                       assign_div);
 }
 
 OCTAVE_END_NAMESPACE(octave)
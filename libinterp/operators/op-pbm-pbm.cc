@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "mx-op-defs.h"
+
+#include "errwarn.h"
+#include "ovl.h"
+#include "ov.h"
+#include "ov-bool-mat.h"
+#include "ov-bool-packed.h"
+#include "ov-typeinfo.h"
+#include "ops.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Elementwise logical operations between packed bool matrices of equal
+// dimensions work directly on the 64-bit words, 64 elements at a time.
+// Mismatched dimensions (broadcasting) fall back to the full
+// representation and the ordinary bool matrix kernels.
+
+// Clear the unused high bits of the last word, which operations like
+// complement would otherwise set.
+
+static uint64NDArray
+packed_mask_tail (const uint64NDArray& words, octave_idx_type n)
+{
+  uint64NDArray retval = words;
+
+  octave_idx_type nw = retval.numel ();
+
+  octave_idx_type tail = n - 64 * (nw - 1);
+
+  if (nw > 0 && tail < 64)
+    {
+      octave_uint64 *wv = retval.fortran_vec ();
+
+      wv[nw-1] = octave_uint64 (wv[nw-1].value ()
+                                & ((uint64_t (1) << tail) - 1));
+    }
+
+  return retval;
+}
+
+template <typename WordOp>
+static octave_value
+packed_binop (const octave_packed_bool_matrix& v1,
+              const octave_packed_bool_matrix& v2, WordOp op,
+              bool mask_tail = false)
+{
+  const uint64NDArray& w1 = v1.words ();
+  const uint64NDArray& w2 = v2.words ();
+
+  octave_idx_type nw = w1.numel ();
+
+  uint64NDArray wr (dim_vector (nw, 1));
+
+  const octave_uint64 *p1 = w1.data ();
+  const octave_uint64 *p2 = w2.data ();
+  octave_uint64 *pr = wr.fortran_vec ();
+
+  for (octave_idx_type i = 0; i < nw; i++)
+    pr[i] = octave_uint64 (op (p1[i].value (), p2[i].value ()));
+
+  if (mask_tail)
+    wr = packed_mask_tail (wr, v1.numel ());
+
+  return octave_value (new octave_packed_bool_matrix (wr, v1.dims ()));
+}
+
+DEFUNOP (not, packed_bool_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v, a);
+
+  const uint64NDArray& w = v.words ();
+
+  octave_idx_type nw = w.numel ();
+
+  uint64NDArray wr (dim_vector (nw, 1));
+
+  const octave_uint64 *p = w.data ();
+  octave_uint64 *pr = wr.fortran_vec ();
+
+  for (octave_idx_type i = 0; i < nw; i++)
+    pr[i] = octave_uint64 (~ p[i].value ());
+
+  return octave_value
+         (new octave_packed_bool_matrix
+          (packed_mask_tail (wr, v.numel ()), v.dims ()));
+}
+
+DEFBINOP (el_and, packed_bool_matrix, packed_bool_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (mx_el_and (v1.bool_array_value (),
+                                    v2.bool_array_value ()));
+
+  return packed_binop (v1, v2,
+                       [] (uint64_t x, uint64_t y) { return x & y; });
+}
+
+DEFBINOP (el_or, packed_bool_matrix, packed_bool_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (mx_el_or (v1.bool_array_value (),
+                                   v2.bool_array_value ()));
+
+  return packed_binop (v1, v2,
+                       [] (uint64_t x, uint64_t y) { return x | y; });
+}
+
+DEFBINOP (eq, packed_bool_matrix, packed_bool_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (mx_el_eq (v1.bool_array_value (),
+                                   v2.bool_array_value ()));
+
+  return packed_binop (v1, v2,
+                       [] (uint64_t x, uint64_t y) { return ~ (x ^ y); },
+                       true);
+}
+
+DEFBINOP (ne, packed_bool_matrix, packed_bool_matrix)
+{
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v1, a1);
+  OCTAVE_CAST_BASE_VALUE (const octave_packed_bool_matrix&, v2, a2);
+
+  if (v1.dims () != v2.dims ())
+    return octave_value (mx_el_ne (v1.bool_array_value (),
+                                   v2.bool_array_value ()));
+
+  return packed_binop (v1, v2,
+                       [] (uint64_t x, uint64_t y) { return x ^ y; });
+}
+
+void
+install_pbm_pbm_ops (octave::type_info& ti)
+{
+  INSTALL_UNOP_TI (ti, op_not, octave_packed_bool_matrix, not);
+
+  INSTALL_BINOP_TI (ti, op_el_and, octave_packed_bool_matrix,
+                    octave_packed_bool_matrix, el_and);
+  INSTALL_BINOP_TI (ti, op_el_or, octave_packed_bool_matrix,
+                    octave_packed_bool_matrix, el_or);
+  INSTALL_BINOP_TI (ti, op_eq, octave_packed_bool_matrix,
+                    octave_packed_bool_matrix, eq);
+  INSTALL_BINOP_TI (ti, op_ne, octave_packed_bool_matrix,
+                    octave_packed_bool_matrix, ne);
+}
+
+OCTAVE_END_NAMESPACE(octave)
@@ -27,6 +27,7 @@ PARSE_TREE_INC = \
   %reldir%/pt-except.h \
   %reldir%/pt-exp.h \
   %reldir%/pt-fcn-handle.h \
+  %reldir%/pt-fold.h \
   %reldir%/pt-id.h \
   %reldir%/pt-idx.h \
   %reldir%/pt-jump.h \
@@ -75,6 +76,7 @@ PARSE_TREE_SRC = \
   %reldir%/pt-except.cc \
   %reldir%/pt-exp.cc \
   %reldir%/pt-fcn-handle.cc \
+  %reldir%/pt-fold.cc \
   %reldir%/pt-id.cc \
   %reldir%/pt-idx.cc \
   %reldir%/pt-loop.cc \
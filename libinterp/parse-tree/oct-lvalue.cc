@@ -34,6 +34,8 @@
 #include "ovl.h"
 #include "oct-lvalue.h"
 #include "ov.h"
+#include "ov-scalar.h"
+#include "stack-frame.h"
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
@@ -59,6 +61,32 @@ void octave_lvalue::assign (octave_value::assign_op op,
     m_frame->assign (op, m_sym, m_type, m_idx, rhs);
 }
 
+bool octave_lvalue::assign_in_place (double rhs)
+{
+  if (m_black_hole || ! m_idx.empty ())
+    return false;
+
+  octave_value& slot = m_frame->varref (m_sym);
+
+  // Touching the rep directly is only equivalent to a full assignment
+  // if nothing else references it and it is already a real scalar.
+  // Anything the loop body may have done to the variable -- sharing
+  // it, retyping it, clearing it, making it global -- fails one of
+  // these checks and falls back to the normal assignment.
+
+  if (slot.get_count () != 1)
+    return false;
+
+  octave_base_value *rep = slot.internal_rep ();
+
+  if (rep->type_id () != octave_scalar::static_type_id ())
+    return false;
+
+  static_cast<octave_scalar *> (rep)->scalar_ref () = rhs;
+
+  return true;
+}
+
 octave_idx_type octave_lvalue::numel () const
 {
   // Return 1 if there is no index because without an index there
@@ -62,6 +62,14 @@ public:
 
   void assign (octave_value::assign_op, const octave_value&);
 
+  // If this lvalue is a plain symbol whose slot currently holds an
+  // unshared real scalar, overwrite the stored scalar with RHS and
+  // return true; otherwise do nothing and return false.  The
+  // evaluator uses this to update a range loop variable without
+  // allocating a new value each iteration.
+
+  bool assign_in_place (double rhs);
+
   octave_idx_type numel () const;
 
   void set_index (const std::string& t,
@@ -3143,7 +3143,8 @@ OCTAVE_BEGIN_NAMESPACE(octave)
     int l = tok_val->line ();
     int c = tok_val->column ();
 
-    return maybe_compound_binary_expression (op1, op2, l, c, t);
+    return maybe_constant_fold (maybe_compound_binary_expression (op1, op2,
+                                                                  l, c, t));
   }
 
   void
@@ -3248,7 +3249,7 @@ OCTAVE_BEGIN_NAMESPACE(octave)
     int l = tok_val->line ();
     int c = tok_val->column ();
 
-    return new tree_prefix_expression (op1, l, c, t);
+    return maybe_constant_fold (new tree_prefix_expression (op1, l, c, t));
   }
 
   // Build a postfix expression.
@@ -3284,7 +3285,7 @@ OCTAVE_BEGIN_NAMESPACE(octave)
     int l = tok_val->line ();
     int c = tok_val->column ();
 
-    return new tree_postfix_expression (op1, l, c, t);
+    return maybe_constant_fold (new tree_postfix_expression (op1, l, c, t));
   }
 
   // Build an unwind-protect command.
@@ -5769,6 +5770,85 @@ OCTAVE_BEGIN_NAMESPACE(octave)
     return exit_status;
   }
 
+  // Cache of parse results for function and script files, keyed by
+  // file name and parsing context and validated against the file's
+  // modification time and size.  Re-parsing a file whose contents have
+  // not changed (after "clear functions", for example, or when many
+  // scripts source the same helper file) then reuses the function
+  // object that the previous parse produced, exactly as if it had
+  // never been dropped from the symbol table.  Classdef files are not
+  // cached because their parse trees are converted to meta.class
+  // objects that register themselves on creation.
+  //
+  // This cache is per-process.  A cross-process variant -- an on-disk
+  // image of parsed core functions that a fresh interpreter could map
+  // at startup -- has been requested several times for deployments
+  // that launch octave-cli tens of thousands of times a day, and is
+  // worth recording the obstacles to:
+  //
+  //   * Parse trees are graphs of polymorphic nodes full of vtable
+  //     and interior pointers, so live objects cannot be mapped from
+  //     a file; an image needs a real serialization layer covering
+  //     every tree node type (a pair of tree_walker visitors would be
+  //     the natural shape for it).
+  //
+  //   * Loading a function is not side-effect free: classdef
+  //     registration, autoload tables, and package metadata all
+  //     mutate interpreter state that a snapshot would have to
+  //     capture or replay.
+  //
+  // Until someone builds that layer, the practical mitigations are
+  // this cache (warm re-parses), the trusted load-path cache in
+  // path_cache (cold-start directory scans), and running a resident
+  // interpreter with --server instead of one process per job.
+
+  class parsed_fcn_cache
+  {
+  public:
+
+    parsed_fcn_cache ()
+      : m_enabled (sys::env::getenv ("OCTAVE_DISABLE_PARSE_CACHE").empty ()),
+        m_cache ()
+    { }
+
+    bool enabled () const { return m_enabled; }
+
+    bool lookup (const std::string& key, const sys::file_stat& fs,
+                 octave_value& fcn) const
+    {
+      auto it = m_cache.find (key);
+
+      if (it == m_cache.end ()
+          || it->second.m_mtime != fs.mtime ().unix_time ()
+          || it->second.m_size != fs.size ())
+        return false;
+
+      fcn = it->second.m_fcn;
+      return true;
+    }
+
+    void insert (const std::string& key, const sys::file_stat& fs,
+                 const octave_value& fcn)
+    {
+      m_cache[key] = entry { fs.mtime ().unix_time (), fs.size (), fcn };
+    }
+
+  private:
+
+    struct entry
+    {
+      time_t m_mtime;
+      off_t m_size;
+      octave_value m_fcn;
+    };
+
+    bool m_enabled;
+
+    std::map<std::string, entry> m_cache;
+  };
+
+  static parsed_fcn_cache s_parsed_fcn_cache;
+
   octave_value
   parse_fcn_file (interpreter& interp, const std::string& full_file,
                   const std::string& file, const std::string& dir_name,
@@ -5780,6 +5860,9 @@ OCTAVE_BEGIN_NAMESPACE(octave)
 
     FILE *ffile = nullptr;
 
+    std::string cache_key;
+    sys::file_stat cache_fs;
+
     if (! full_file.empty ())
     {
       // Check that m-file is not overly large which can segfault interpreter.
@@ -5793,6 +5876,21 @@ OCTAVE_BEGIN_NAMESPACE(octave)
           return octave_value ();
         }
 
+      if (fs && s_parsed_fcn_cache.enabled ())
+        {
+          cache_key = full_file + '\n' + dispatch_type + '\n' + package_name
+                      + (force_script ? 's' : 'f')
+                      + (autoload ? 'a' : '-')
+                      + (relative_lookup ? 'r' : '-');
+
+          octave_value cached_fcn;
+
+          if (s_parsed_fcn_cache.lookup (cache_key, fs, cached_fcn))
+            return cached_fcn;
+
+          cache_fs = fs;
+        }
+
       ffile = sys::fopen (full_file, "rb");
     }
 
@@ -5862,6 +5960,9 @@ OCTAVE_BEGIN_NAMESPACE(octave)
             fcn->stash_subfunction_names (parser.m_subfunction_names);
           }
 
+        if (! cache_key.empty ())
+          s_parsed_fcn_cache.insert (cache_key, cache_fs, ov_fcn);
+
         return ov_fcn;
       }
 
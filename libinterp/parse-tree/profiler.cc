@@ -27,18 +27,24 @@
 #  include "config.h"
 #endif
 
+#include <chrono>
+
 #include "defun.h"
 #include "event-manager.h"
+#include "interpreter-private.h"
 #include "interpreter.h"
+#include "oct-alloc-stats.h"
 #include "oct-time.h"
 #include "ov-struct.h"
 #include "pager.h"
 #include "profiler.h"
+#include "pt-eval.h"
+#include "stack-frame.h"
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
 profiler::stats::stats ()
-  : m_time (0.0), m_calls (0), m_recursive (false),
+  : m_time (0.0), m_calls (0), m_alloc (0), m_recursive (false),
     m_parents (), m_children ()
 { }
 
@@ -56,7 +62,8 @@ profiler::stats::function_set_value (const function_set& list)
 }
 
 profiler::tree_node::tree_node (tree_node *p, octave_idx_type f)
-  : m_parent (p), m_fcn_id (f), m_children (), m_time (0.0), m_calls (0)
+  : m_parent (p), m_fcn_id (f), m_children (), m_time (0.0), m_alloc (0),
+    m_calls (0)
 { }
 
 profiler::tree_node::~tree_node ()
@@ -105,6 +112,7 @@ profiler::tree_node::build_flat (flat_profile& data) const
 
       entry.m_time += m_time;
       entry.m_calls += m_calls;
+      entry.m_alloc += m_alloc;
 
       panic_unless (m_parent);
       if (m_parent->m_fcn_id != 0)
@@ -175,11 +183,15 @@ profiler::tree_node::get_hierarchical (double *total) const
 profiler::profiler ()
   : m_known_functions (), m_fcn_index (),
     m_enabled (false), m_call_tree (new tree_node (nullptr, 0)),
-    m_active_fcn (nullptr), m_last_time (-1.0)
+    m_active_fcn (nullptr), m_last_time (-1.0), m_last_alloc (0),
+    m_sample_interval (0.0), m_sample_due (false),
+    m_stop_sampling (false), m_sample_thread (), m_samples ()
 { }
 
 profiler::~profiler ()
 {
+  stop_sample_timer ();
+
   delete m_call_tree;
 }
 
@@ -187,6 +199,117 @@ void
 profiler::set_active (bool value)
 {
   m_enabled = value;
+
+  if (sampling ())
+    {
+      if (value)
+        start_sample_timer ();
+      else
+        stop_sample_timer ();
+    }
+}
+
+void
+profiler::set_sample_interval (double interval)
+{
+  if (enabled ())
+    error ("profile: can't change sampling mode of active profiler");
+
+  // The comparison is written to reject NaN as well.
+  if (! (interval >= 0))
+    error ("profile: sampling interval must be a non-negative number");
+
+  m_sample_interval = interval;
+}
+
+void
+profiler::take_sample (const std::string& leaf)
+{
+  tree_evaluator& tw = __get_evaluator__ ();
+
+  std::list<std::shared_ptr<stack_frame>> frames = tw.backtrace_frames ();
+
+  // backtrace_frames lists the innermost frame first but folded
+  // stacks are written root first.
+
+  std::string key;
+
+  for (auto it = frames.rbegin (); it != frames.rend (); ++it)
+    {
+      std::string nm = (*it)->fcn_name ();
+
+      if (nm.empty ())
+        continue;
+
+      if (! key.empty ())
+        key += ';';
+
+      key += nm;
+    }
+
+  // The profiled block we were entering when the timer fired is not
+  // on the call stack yet (and, for built-in functions, never will
+  // be), so append it as the leaf unless it is already there.
+
+  if (! leaf.empty ()
+      && (frames.empty () || leaf != frames.front ()->fcn_name ()))
+    {
+      if (! key.empty ())
+        key += ';';
+
+      key += leaf;
+    }
+
+  if (! key.empty ())
+    ++m_samples[key];
+}
+
+void
+profiler::start_sample_timer ()
+{
+  if (m_sample_thread.joinable ())
+    return;
+
+  m_sample_due.store (false, std::memory_order_relaxed);
+  m_stop_sampling.store (false, std::memory_order_relaxed);
+
+  double interval = m_sample_interval;
+
+  m_sample_thread = std::thread
+    ([this, interval] ()
+     {
+       while (! m_stop_sampling.load (std::memory_order_relaxed))
+         {
+           // Sleep in small slices so that disabling the profiler
+           // doesn't block for a full interval.
+
+           double remaining = interval;
+
+           while (remaining > 0
+                  && ! m_stop_sampling.load (std::memory_order_relaxed))
+             {
+               double slice = (remaining < 0.01 ? remaining : 0.01);
+
+               std::this_thread::sleep_for
+                 (std::chrono::duration<double> (slice));
+
+               remaining -= slice;
+             }
+
+           m_sample_due.store (true, std::memory_order_relaxed);
+         }
+     });
+}
+
+void
+profiler::stop_sample_timer ()
+{
+  if (! m_sample_thread.joinable ())
+    return;
+
+  m_stop_sampling.store (true, std::memory_order_relaxed);
+
+  m_sample_thread.join ();
 }
 
 void
@@ -196,10 +319,13 @@ profiler::enter_function (const std::string& fcn)
   panic_unless (enabled ());
   panic_unless (m_call_tree);
 
-  // If there is already an active function, add to its time before
-  // pushing the new one.
+  // If there is already an active function, add to its time and
+  // allocation figures before pushing the new one.
   if (m_active_fcn && m_active_fcn != m_call_tree)
-    add_current_time ();
+    {
+      add_current_time ();
+      add_current_alloc ();
+    }
 
   // Map the function's name to its index.
   octave_idx_type fcn_idx;
@@ -219,7 +345,8 @@ profiler::enter_function (const std::string& fcn)
   m_active_fcn = m_active_fcn->enter (fcn_idx);
 
   m_last_time = query_time ();
-
+  m_last_alloc
+    = alloc_stats::bytes_allocated.load (std::memory_order_relaxed);
 }
 
 void
@@ -237,7 +364,10 @@ profiler::exit_function (const std::string& fcn)
       // the call disabling the profiler is an exception.  So also check here
       // and only record the time if enabled.
       if (enabled ())
-        add_current_time ();
+        {
+          add_current_time ();
+          add_current_alloc ();
+        }
 
       fcn_index_map::iterator pos = m_fcn_index.find (fcn);
       // FIXME: This panic_unless statements doesn't make sense if profile()
@@ -249,6 +379,8 @@ profiler::exit_function (const std::string& fcn)
       // If this was an "inner call", we resume executing the parent function
       // up the stack.  So note the start-time for this!
       m_last_time = query_time ();
+      m_last_alloc
+        = alloc_stats::bytes_allocated.load (std::memory_order_relaxed);
     }
 }
 
@@ -268,6 +400,8 @@ profiler::reset ()
       m_active_fcn = nullptr;
     }
 
+  m_samples.clear ();
+
   m_last_time = -1.0;
 }
 
@@ -359,6 +493,81 @@ profiler::get_hierarchical () const
   return retval;
 }
 
+octave_value
+profiler::get_memory () const
+{
+  octave_value retval;
+
+  const octave_idx_type n = m_known_functions.size ();
+
+  flat_profile flat (n);
+
+  if (m_call_tree)
+    {
+      m_call_tree->build_flat (flat);
+
+      Cell rv_names (n, 1);
+      Cell rv_bytes (n, 1);
+      Cell rv_calls (n, 1);
+
+      for (octave_idx_type i = 0; i != n; ++i)
+        {
+          rv_names(i) = octave_value (m_known_functions[i]);
+          rv_bytes(i) = octave_value (static_cast<double> (flat[i].m_alloc));
+          rv_calls(i) = octave_value (flat[i].m_calls);
+        }
+
+      octave_map m;
+
+      m.assign ("FunctionName", rv_names);
+      m.assign ("AllocatedBytes", rv_bytes);
+      m.assign ("NumCalls", rv_calls);
+
+      retval = m;
+    }
+  else
+    {
+      static const char *fn[] =
+      {
+        "FunctionName",
+        "AllocatedBytes",
+        "NumCalls",
+        nullptr
+      };
+
+      static octave_map m (dim_vector (0, 1), string_vector (fn));
+
+      retval = m;
+    }
+
+  return retval;
+}
+
+octave_value
+profiler::get_folded () const
+{
+  const octave_idx_type n = m_samples.size ();
+
+  Cell rv_stacks (n, 1);
+  Cell rv_counts (n, 1);
+
+  octave_idx_type i = 0;
+  for (const auto& stack_count : m_samples)
+    {
+      rv_stacks(i) = octave_value (stack_count.first);
+      rv_counts(i) = octave_value (stack_count.second);
+
+      ++i;
+    }
+
+  octave_map retval;
+
+  retval.assign ("FoldedStack", rv_stacks);
+  retval.assign ("NumSamples", rv_counts);
+
+  return retval;
+}
+
 double
 profiler::query_time () const
 {
@@ -382,6 +591,18 @@ profiler::add_current_time ()
     }
 }
 
+void
+profiler::add_current_alloc ()
+{
+  if (m_active_fcn)
+    {
+      const std::uint64_t a
+        = alloc_stats::bytes_allocated.load (std::memory_order_relaxed);
+
+      m_active_fcn->add_alloc (a - m_last_alloc);
+    }
+}
+
 // Enable or disable the profiler data collection.
 DEFMETHOD (__profiler_enable__, interp, args, ,
            doc: /* -*- texinfo -*-
@@ -446,4 +667,65 @@ Undocumented internal function.
     return ovl (profiler.get_flat ());
 }
 
+// Query the per-function allocation accounting and the global
+// allocation counters.
+DEFMETHOD (__profiler_memory_data__, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn {} {[@var{data}, @var{peak}, @var{current}] =} __profiler_memory_data__ ()
+Undocumented internal function.
+@end deftypefn */)
+{
+  if (args.length () != 0)
+    print_usage ();
+
+  profiler& profiler = interp.get_profiler ();
+
+  double peak
+    = static_cast<double>
+        (alloc_stats::peak_bytes.load (std::memory_order_relaxed));
+
+  double current
+    = static_cast<double>
+        (alloc_stats::bytes_allocated.load (std::memory_order_relaxed)
+         - alloc_stats::bytes_freed.load (std::memory_order_relaxed));
+
+  return ovl (profiler.get_memory (), peak, current);
+}
+
+// Get or set the sampling interval of the profiler.  An interval of
+// zero selects the tracing mode.
+DEFMETHOD (__profiler_sample_interval__, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn {} {@var{interval} =} __profiler_sample_interval__ ()
+Undocumented internal function.
+@end deftypefn */)
+{
+  int nargin = args.length ();
+
+  if (nargin > 1)
+    print_usage ();
+
+  profiler& profiler = interp.get_profiler ();
+
+  if (nargin == 1)
+    profiler.set_sample_interval (args(0).double_value ());
+
+  return ovl (profiler.sample_interval ());
+}
+
+// Query the folded call-stack samples collected in sampling mode.
+DEFMETHOD (__profiler_folded_data__, interp, args, ,
+           doc: /* -*- texinfo -*-
+@deftypefn {} {@var{data} =} __profiler_folded_data__ ()
+Undocumented internal function.
+@end deftypefn */)
+{
+  if (args.length () != 0)
+    print_usage ();
+
+  profiler& profiler = interp.get_profiler ();
+
+  return ovl (profiler.get_folded ());
+}
+
 OCTAVE_END_NAMESPACE(octave)
@@ -28,10 +28,13 @@
 
 #include "octave-config.h"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 class octave_value;
@@ -61,6 +64,19 @@ public:
       // A profiling block cannot be active if the profiler is not
       m_enabled = m_profiler.enabled ();
 
+      if (m_enabled && m_profiler.sampling ())
+        {
+          // Sampling mode: no per-call bookkeeping at all.  The
+          // profiled block only checks whether the sample timer has
+          // fired, and the block name is not even computed unless a
+          // sample is actually recorded.
+
+          if (m_profiler.sample_due ())
+            m_profiler.take_sample (t.profiler_name ());
+
+          m_enabled = false;
+        }
+
       if (m_enabled)
         {
           m_fcn = t.profiler_name ();
@@ -94,11 +110,28 @@ public:
   bool enabled () const { return m_enabled; }
   void set_active (bool);
 
+  // A positive sampling interval (in seconds) switches the profiler
+  // from tracing every call to periodically recording the interpreter
+  // call stack, which has a fixed low cost and doesn't skew hot call
+  // sites.  An interval of zero selects the classic tracing mode.
+  bool sampling () const { return m_sample_interval > 0; }
+  double sample_interval () const { return m_sample_interval; }
+  void set_sample_interval (double);
+
   void reset ();
 
   octave_value get_flat () const;
   octave_value get_hierarchical () const;
 
+  // The accumulated samples as folded call stacks
+  // ("caller;callee;..." with a sample count each), the format flame
+  // graph tools consume.
+  octave_value get_folded () const;
+
+  // Per-function allocation accounting collected alongside the
+  // timings, fed by the global Array rep allocation counters.
+  octave_value get_memory () const;
+
 private:
 
   // One entry in the flat profile (i.e., a collection of data for a single
@@ -122,6 +155,9 @@ private:
     double m_time;
     std::size_t m_calls;
 
+    // Bytes allocated directly in this function, excluding callees.
+    std::uint64_t m_alloc;
+
     bool m_recursive;
 
     function_set m_parents;
@@ -143,6 +179,7 @@ private:
     OCTAVE_DISABLE_CONSTRUCT_COPY_MOVE (tree_node)
 
     void add_time (double dt) { m_time += dt; }
+    void add_alloc (std::uint64_t nbytes) { m_alloc += nbytes; }
 
     // Enter a child function.  It is created in the list of children if it
     // wasn't already there.  The now-active child node is returned.
@@ -171,6 +208,9 @@ private:
     // This is only time spent *directly* on this level, excluding children!
     double m_time;
 
+    // Likewise, bytes allocated directly on this level.
+    std::uint64_t m_alloc;
+
     std::size_t m_calls;
   };
 
@@ -194,11 +234,46 @@ private:
   // called.
   double m_last_time;
 
+  // Snapshot of the global allocation counter taken at the same
+  // points as m_last_time, so allocation deltas are attributed to the
+  // same function the elapsed time is.
+  std::uint64_t m_last_alloc;
+
+  // Sampling mode.  The timer thread periodically raises
+  // m_sample_due; the next profiled block entered on the interpreter
+  // thread then records the call stack.  Samples are keyed by the
+  // folded (semicolon-joined, root first) stack.
+
+  double m_sample_interval;
+
+  std::atomic<bool> m_sample_due;
+  std::atomic<bool> m_stop_sampling;
+
+  std::thread m_sample_thread;
+
+  typedef std::map<std::string, std::size_t> sample_map;
+  sample_map m_samples;
+
   // These are private as only the unwind-protecting inner class enter
   // should be allowed to call them.
   void enter_function (const std::string&);
   void exit_function (const std::string&);
 
+  bool sample_due ()
+  {
+    if (! m_sample_due.load (std::memory_order_relaxed))
+      return false;
+
+    m_sample_due.store (false, std::memory_order_relaxed);
+
+    return true;
+  }
+
+  void take_sample (const std::string&);
+
+  void start_sample_timer ();
+  void stop_sample_timer ();
+
   // Query a timestamp, used for timing calls (obviously).
   // This is not static because in the future, maybe we want a flag
   // in the profiler or something to choose between cputime, wall-time,
@@ -209,6 +284,9 @@ private:
   // This is called from two different positions, thus it is useful to have
   // it as a separate function.
   void add_current_time ();
+
+  // Likewise for the bytes allocated since the last snapshot.
+  void add_current_alloc ();
 };
 
 OCTAVE_END_NAMESPACE(octave)
@@ -44,6 +44,7 @@
 #include "pt-except.h"
 #include "pt-exp.h"
 #include "pt-fcn-handle.h"
+#include "pt-fold.h"
 #include "pt-id.h"
 #include "pt-idx.h"
 #include "pt-jump.h"
@@ -28,6 +28,9 @@
 
 #include "octave-config.h"
 
+#include <string>
+#include <vector>
+
 #include "pt-arg-list.h"
 #include "pt-cmd.h"
 #include "pt-exp.h"
@@ -35,6 +38,7 @@
 #include "pt-walk.h"
 
 #include "base-list.h"
+#include "ov.h"
 
 // FIXME: We could maybe re-think the naming of some of these objects
 // before releasing a version that contains these new classes...
@@ -205,6 +209,35 @@ private:
   tree_identifier *m_attr;
 };
 
+// Compiled form of one arguments block entry.  The evaluator builds
+// these on first execution so later calls validate with native
+// comparisons instead of walking the parse tree; see
+// tree_evaluator::visit_arguments_block.
+
+class arg_validation_spec
+{
+public:
+
+  std::string m_arg_name;
+
+  // Empty means no class restriction.
+  std::string m_class_name;
+
+  // Expected dimensions; -1 entries are ':' wildcards.
+  bool m_have_size = false;
+  std::vector<octave_idx_type> m_dims;
+
+  // Validators given as plain names (mustBeNumeric) are resolved to
+  // functions when the spec is compiled; validators written as calls
+  // (mustBeGreaterThan (x, 0)) keep a pointer to the expression and
+  // are evaluated per call.  Neither pointer is owned here.
+
+  std::vector<octave_value> m_validator_fcns;
+  std::vector<tree_expression *> m_validator_exprs;
+
+  tree_expression *m_default_expr = nullptr;
+};
+
 // Arguments block.
 
 class tree_arguments_block : public tree_command
@@ -244,6 +277,25 @@ public:
 
   comment_list * trailing_comment () { return m_trail_comm; }
 
+  // Compiled spec cache maintained by the evaluator.  The revision is
+  // the symbol table function revision the validators were resolved
+  // against; zero means not yet compiled.  An unsupported block (one
+  // using features the evaluator cannot validate yet) is remembered
+  // so the fallback warning is not recomputed from the tree.
+
+  std::vector<arg_validation_spec>& compiled_specs ()
+  {
+    return m_compiled_specs;
+  }
+
+  std::size_t compiled_revision () const { return m_compiled_revision; }
+
+  void set_compiled_revision (std::size_t r) { m_compiled_revision = r; }
+
+  bool validation_unsupported () const { return m_validation_unsupported; }
+
+  void set_validation_unsupported () { m_validation_unsupported = true; }
+
   void accept (tree_walker& tw)
   {
     tw.visit_arguments_block (*this);
@@ -251,6 +303,12 @@ public:
 
 private:
 
+  std::vector<arg_validation_spec> m_compiled_specs;
+
+  std::size_t m_compiled_revision = 0;
+
+  bool m_validation_unsupported = false;
+
   tree_args_block_attribute_list *m_attr_list;
 
   tree_args_block_validation_list *m_validation_list;
@@ -29,6 +29,9 @@
 
 #include "error.h"
 #include "interpreter.h"
+#include "ov-class.h"
+#include "ov-classdef.h"
+#include "ov-typeinfo.h"
 #include "ov.h"
 #include "profiler.h"
 #include "pt-binop.h"
@@ -53,6 +56,27 @@ tree_binary_expression::oper () const
   return octave_value::binary_op_as_string (m_etype);
 }
 
+// Whether the result of applying OP may be stored in the operand VAL,
+// overwriting it.  VAL must be an unshared temporary (a count of one
+// means the evaluator holds the only reference; values bound to
+// variables or cached in the parse tree are always shared), must not
+// dispatch through user-defined operator methods, and must already
+// have the shape of the result so the in-place operation never has to
+// broadcast the destination.
+
+static bool
+operand_is_reusable (const octave_value& val, const octave_value& other)
+{
+  if (val.get_count () != 1)
+    return false;
+
+  if (val.isobject () || val.is_classdef_object ()
+      || other.isobject () || other.is_classdef_object ())
+    return false;
+
+  return val.dims () == other.dims () || other.numel () == 1;
+}
+
 tree_expression *
 tree_binary_expression::dup (symbol_scope& scope) const
 {
@@ -92,6 +116,83 @@ tree_binary_expression::evaluate (tree_evaluator& tw, int)
 
               type_info& ti = interp.get_type_info ();
 
+              // Chains of element-wise operators such as a.*b + c.*d
+              // materialize a temporary per operator.  When an operand
+              // is itself a dead temporary, apply the operator in
+              // place through the assign-op table so the chain
+              // recycles one buffer instead of allocating at every
+              // step; assign falls back to the ordinary binary op for
+              // type pairs without an in-place form.
+
+              switch (m_etype)
+                {
+                case octave_value::op_add:
+                case octave_value::op_sub:
+                case octave_value::op_el_mul:
+                case octave_value::op_el_div:
+                case octave_value::op_el_and:
+                case octave_value::op_el_or:
+                  if (operand_is_reusable (a, b))
+                    {
+                      a.assign (octave_value::binary_op_to_assign_op (m_etype),
+                                b);
+                      return a;
+                    }
+
+                  // Addition and element-wise multiplication commute
+                  // for every type the assign-op table covers, so a
+                  // right-hand temporary serves just as well.
+
+                  if ((m_etype == octave_value::op_add
+                       || m_etype == octave_value::op_el_mul)
+                      && operand_is_reusable (b, a))
+                    {
+                      b.assign (octave_value::binary_op_to_assign_op (m_etype),
+                                a);
+                      return b;
+                    }
+                  break;
+
+                default:
+                  break;
+                }
+
+              // Call-site specialization: most expressions see the
+              // same operand type pair on every evaluation, so
+              // remember the kernel the operator tables resolved here
+              // and call it directly while the pair (and the tables)
+              // stay the same.  Class and classdef operands always
+              // take the generic path, as do pairs that only resolve
+              // through type conversions.
+
+              int t1 = a.type_id ();
+              int t2 = b.type_id ();
+
+              if (m_spec_fcn && t1 == m_spec_t1 && t2 == m_spec_t2
+                  && m_spec_generation == ti.binary_ops_generation ())
+                return m_spec_fcn (a.get_rep (), b.get_rep ());
+
+              m_spec_fcn = nullptr;
+
+              if (t1 != octave_class::static_type_id ()
+                  && t2 != octave_class::static_type_id ()
+                  && t1 != octave_classdef::static_type_id ()
+                  && t2 != octave_classdef::static_type_id ())
+                {
+                  type_info::binary_op_fcn f
+                    = ti.lookup_binary_op (m_etype, t1, t2);
+
+                  if (f)
+                    {
+                      m_spec_t1 = t1;
+                      m_spec_t2 = t2;
+                      m_spec_generation = ti.binary_ops_generation ();
+                      m_spec_fcn = f;
+
+                      return f (a.get_rep (), b.get_rep ());
+                    }
+                }
+
               return binary_op (ti, m_etype, a, b);
             }
         }
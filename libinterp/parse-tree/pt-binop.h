@@ -51,7 +51,8 @@ public:
                           octave_value::binary_op t
                           = octave_value::unknown_binary_op)
     : tree_expression (l, c), m_lhs (nullptr), m_rhs (nullptr), m_etype (t),
-      m_preserve_operands (false)
+      m_preserve_operands (false), m_spec_t1 (-1), m_spec_t2 (-1),
+      m_spec_generation (-1), m_spec_fcn (nullptr)
   { }
 
   tree_binary_expression (tree_expression *a, tree_expression *b,
@@ -59,7 +60,8 @@ public:
                           octave_value::binary_op t
                           = octave_value::unknown_binary_op)
     : tree_expression (l, c), m_lhs (a), m_rhs (b), m_etype (t),
-      m_preserve_operands (false)
+      m_preserve_operands (false), m_spec_t1 (-1), m_spec_t2 (-1),
+      m_spec_generation (-1), m_spec_fcn (nullptr)
   { }
 
   OCTAVE_DISABLE_COPY_MOVE (tree_binary_expression)
@@ -120,6 +122,16 @@ private:
 
   // If TRUE, don't delete m_lhs and m_rhs in destructor;
   bool m_preserve_operands;
+
+  // Call-site specialization cache: the operator kernel the type
+  // tables resolved for the last operand type pair seen here, valid
+  // while the operands keep those type ids and no operator has been
+  // (re)registered since (see type_info::binary_ops_generation).
+  int m_spec_t1;
+  int m_spec_t2;
+  int m_spec_generation;
+  octave_value (*m_spec_fcn) (const octave_base_value&,
+                              const octave_base_value&);
 };
 
 class tree_braindead_shortcircuit_binary_expression
@@ -35,6 +35,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <type_traits>
 
 #include "cmd-edit.h"
 #include "file-ops.h"
@@ -1252,10 +1253,289 @@ tree_evaluator::visit_argument_list (tree_argument_list&)
   panic_impossible ();
 }
 
+// Compile an arguments block into native validation specs.  Returns
+// false if the block uses a form we cannot validate yet (name-value
+// option structs, non-constant size specifications).
+
+static bool
+compile_arguments_block (tree_arguments_block& blk, tree_evaluator& tw,
+                         symbol_table& symtab)
+{
+  tree_args_block_validation_list *vlist = blk.validation_list ();
+
+  if (! vlist)
+    return false;
+
+  std::vector<arg_validation_spec> specs;
+
+  for (tree_arg_validation *av : *vlist)
+    {
+      if (! av)
+        return false;
+
+      arg_validation_spec spec;
+
+      tree_identifier *id
+        = dynamic_cast<tree_identifier *> (av->identifier_expression ());
+
+      // Structured names (opts.field) declare name-value options,
+      // which are not implemented.
+
+      if (! id)
+        return false;
+
+      spec.m_arg_name = id->name ();
+
+      if (av->class_name ())
+        spec.m_class_name = av->class_name ()->name ();
+
+      tree_arg_size_spec *size_spec = av->size_spec ();
+
+      if (size_spec)
+        {
+          tree_argument_list *size_args = size_spec->size_args ();
+
+          if (! size_args || size_args->size () < 2)
+            return false;
+
+          for (tree_expression *elt : *size_args)
+            {
+              if (! elt || ! elt->is_constant ())
+                return false;
+
+              octave_value v
+                = dynamic_cast<tree_constant *> (elt)->evaluate (tw);
+
+              if (v.is_magic_colon ())
+                spec.m_dims.push_back (-1);
+              else
+                {
+                  octave_idx_type n
+                    = v.xidx_type_value ("arguments: size specification values must be nonnegative integers");
+
+                  if (n < 0)
+                    error ("arguments: size specification values must be nonnegative integers");
+
+                  spec.m_dims.push_back (n);
+                }
+            }
+
+          spec.m_have_size = true;
+        }
+
+      tree_arg_validation_fcns *vfcns = av->validation_fcns ();
+
+      if (vfcns && vfcns->fcn_args ())
+        {
+          for (tree_expression *elt : *vfcns->fcn_args ())
+            {
+              if (! elt)
+                return false;
+
+              if (elt->is_identifier ())
+                {
+                  tree_identifier *fid
+                    = dynamic_cast<tree_identifier *> (elt);
+
+                  octave_value fcn = symtab.find_function (fid->name ());
+
+                  if (! fcn.is_defined ())
+                    error ("arguments: unknown validation function '%s'",
+                           fid->name ().c_str ());
+
+                  spec.m_validator_fcns.push_back (fcn);
+                }
+              else
+                spec.m_validator_exprs.push_back (elt);
+            }
+        }
+
+      spec.m_default_expr = av->initializer_expression ();
+
+      specs.push_back (std::move (spec));
+    }
+
+  blk.compiled_specs () = std::move (specs);
+
+  return true;
+}
+
+// Format a size specification for error messages, e.g. "1x:".
+
+static std::string
+arg_size_spec_string (const std::vector<octave_idx_type>& dims)
+{
+  std::string retval;
+
+  for (std::size_t i = 0; i < dims.size (); i++)
+    {
+      if (i > 0)
+        retval += 'x';
+
+      if (dims[i] < 0)
+        retval += ':';
+      else
+        retval += std::to_string (dims[i]);
+    }
+
+  return retval;
+}
+
+// Check VAL against the size specification DIMS, reorienting a vector
+// value to match a vector specification as Matlab does.  Returns
+// false if the sizes are incompatible.
+
+static bool
+match_arg_size (octave_value& val, const std::vector<octave_idx_type>& dims)
+{
+  int nd = dims.size ();
+
+  dim_vector dv = val.dims ().redim (nd);
+
+  bool ok = true;
+
+  for (int i = 0; i < nd; i++)
+    {
+      if (dims[i] >= 0 && dv(i) != dims[i])
+        {
+          ok = false;
+          break;
+        }
+    }
+
+  if (ok)
+    return true;
+
+  if (nd == 2)
+    {
+      dim_vector vdims = val.dims ();
+
+      if (vdims.ndims () == 2 && (vdims(0) == 1 || vdims(1) == 1))
+        {
+          octave_idx_type len = val.numel ();
+
+          if (dims[0] == 1 && (dims[1] < 0 || dims[1] == len))
+            {
+              val = val.reshape (dim_vector (1, len));
+              return true;
+            }
+
+          if (dims[1] == 1 && (dims[0] < 0 || dims[0] == len))
+            {
+              val = val.reshape (dim_vector (len, 1));
+              return true;
+            }
+        }
+    }
+
+  return false;
+}
+
+// Apply one compiled validation spec to the corresponding variable in
+// the current frame.
+
+static void
+validate_fcn_argument (tree_evaluator& tw, const arg_validation_spec& spec)
+{
+  interpreter& interp = tw.get_interpreter ();
+
+  octave_value val = tw.varval (spec.m_arg_name);
+
+  octave_value orig_val = val;
+
+  if (val.is_undefined ())
+    {
+      if (! spec.m_default_expr)
+        error ("not enough input arguments: '%s' is undefined and has no default value",
+               spec.m_arg_name.c_str ());
+
+      val = spec.m_default_expr->evaluate (tw);
+    }
+
+  if (! spec.m_class_name.empty ()
+      && val.class_name () != spec.m_class_name)
+    {
+      // Try to convert by calling the class constructor with the
+      // value, as Matlab does.
+
+      octave_value converted;
+
+      try
+        {
+          octave_value_list tmp
+            = interp.feval (spec.m_class_name, ovl (val), 1);
+
+          if (! tmp.empty ())
+            converted = tmp(0);
+        }
+      catch (const execution_exception&)
+        {
+          interp.recover_from_exception ();
+        }
+
+      if (converted.is_undefined ()
+          || converted.class_name () != spec.m_class_name)
+        error ("arguments: '%s' must be of class %s but was %s",
+               spec.m_arg_name.c_str (), spec.m_class_name.c_str (),
+               val.class_name ().c_str ());
+
+      val = converted;
+    }
+
+  if (spec.m_have_size && ! match_arg_size (val, spec.m_dims))
+    error ("arguments: '%s' must be of size %s",
+           spec.m_arg_name.c_str (),
+           arg_size_spec_string (spec.m_dims).c_str ());
+
+  // Store the value before running the validators; validators given
+  // as call expressions reference the variable by name.
+
+  if (! val.is_copy_of (orig_val))
+    tw.assign (spec.m_arg_name, val);
+
+  for (const octave_value& fcn : spec.m_validator_fcns)
+    interp.feval (fcn, ovl (val), 0);
+
+  for (tree_expression *expr : spec.m_validator_exprs)
+    expr->evaluate (tw, 0);
+}
+
 void
-tree_evaluator::visit_arguments_block (tree_arguments_block&)
+tree_evaluator::visit_arguments_block (tree_arguments_block& blk)
 {
-  warning ("function arguments validation blocks are not supported; INCORRECT RESULTS ARE POSSIBLE");
+  // (Output) and (Repeating) blocks are not implemented, nor are
+  // name-value option structs; keep the old warning for those.
+
+  if (blk.validation_unsupported ()
+      || (blk.attribute_list () && blk.attribute_list ()->attribute ()))
+    {
+      warning ("function arguments validation blocks are not supported; INCORRECT RESULTS ARE POSSIBLE");
+      return;
+    }
+
+  symbol_table& symtab = m_interpreter.get_symbol_table ();
+
+  // Specs are compiled once and revalidated against the function
+  // table revision because validator functions are resolved when the
+  // spec is compiled.
+
+  std::size_t revision = symtab.fcn_table_revision ();
+
+  if (blk.compiled_revision () != revision)
+    {
+      if (! compile_arguments_block (blk, *this, symtab))
+        {
+          blk.set_validation_unsupported ();
+
+          warning ("function arguments validation blocks are not supported; INCORRECT RESULTS ARE POSSIBLE");
+          return;
+        }
+
+      blk.set_compiled_revision (revision);
+    }
+
+  for (const arg_validation_spec& spec : blk.compiled_specs ())
+    validate_fcn_argument (*this, spec);
 }
 
 void
@@ -1421,6 +1701,12 @@ tree_evaluator::enter_debugger (const std::string& prompt)
                reset_debug_state ();
              });
 
+  // Ensure the debug-mode flag is set while the debug prompt is
+  // active (it may not be if we got here from keyboard rather than a
+  // breakpoint).  The per-statement hooks test only that flag in the
+  // fast path, so in_debug_repl is never consulted when it is clear.
+  reset_debug_state (true);
+
   dbgr->repl (prompt);
 }
 
@@ -1902,10 +2188,7 @@ tree_evaluator::is_variable (const symbol_record& sym) const
 bool
 tree_evaluator::is_defined (const symbol_record& sym) const
 {
-  std::shared_ptr<stack_frame> frame
-    = m_call_stack.get_current_stack_frame ();
-
-  return frame->is_defined (sym);
+  return m_call_stack.current_stack_frame_ptr ()->is_defined (sym);
 }
 
 bool tree_evaluator::is_global (const std::string& name) const
@@ -1919,10 +2202,7 @@ bool tree_evaluator::is_global (const std::string& name) const
 octave_value
 tree_evaluator::varval (const symbol_record& sym) const
 {
-  std::shared_ptr<stack_frame> frame
-    = m_call_stack.get_current_stack_frame ();
-
-  return frame->varval (sym);
+  return m_call_stack.current_stack_frame_ptr ()->varval (sym);
 }
 
 octave_value
@@ -1956,6 +2236,18 @@ tree_evaluator::global_varref (const std::string& name)
   return m_call_stack.global_varref (name);
 }
 
+octave_value *
+tree_evaluator::global_binding (const std::string& name)
+{
+  return m_call_stack.global_binding (name);
+}
+
+std::size_t
+tree_evaluator::global_binding_generation () const
+{
+  return m_call_stack.global_binding_generation ();
+}
+
 void
 tree_evaluator::global_assign (const std::string& name,
                                const octave_value& val)
@@ -2571,6 +2863,12 @@ std::list<frame_info> tree_evaluator::backtrace_info () const
   return m_call_stack.backtrace_info ();
 }
 
+std::function<std::list<frame_info> ()>
+tree_evaluator::backtrace_info_snapshot () const
+{
+  return m_call_stack.backtrace_info_snapshot ();
+}
+
 octave_map
 tree_evaluator::backtrace (octave_idx_type& curr_user_frame,
                            bool print_subfn) const
@@ -3020,9 +3318,19 @@ tree_evaluator::execute_range_loop (const range<T>& rng, int line,
       if (m_echo_state)
         m_echo_file_pos = line;
 
-      octave_value val (rng.elem (i));
+      // Update the loop variable in place when possible instead of
+      // boxing a fresh octave_value per iteration.  The in-place
+      // store is restricted to double elements so a future range
+      // instantiation for another type cannot silently retype the
+      // variable through the implicit conversion.
 
-      ult.assign (octave_value::op_asn_eq, val);
+      if (! (std::is_same<T, double>::value
+             && ult.assign_in_place (static_cast<double> (rng.elem (i)))))
+        {
+          octave_value val (rng.elem (i));
+
+          ult.assign (octave_value::op_asn_eq, val);
+        }
 
       if (loop_body)
         loop_body->accept (*this);
@@ -3048,8 +3356,16 @@ tree_evaluator::visit_simple_for_command (tree_simple_for_command& cmd)
   if (m_debug_mode)
     do_breakpoint (cmd.is_active_breakpoint (*this));
 
-  // FIXME: need to handle PARFOR loops here using cmd.in_parallel ()
-  // and cmd.maxproc_expr ();
+  // PARFOR loops (cmd.in_parallel (), cmd.maxproc_expr ()) currently
+  // execute serially.  Running iterations on worker threads would
+  // require an evaluator, call stack, and symbol table per worker,
+  // but those are reached throughout the tree via the global
+  // __get_evaluator__/__get_interpreter__ accessors, parse trees are
+  // mutated during evaluation (breakpoints, profiler), and liboctave
+  // already spreads big element-wise kernels across cores, so the two
+  // pools would oversubscribe each other.  Until the interpreter
+  // state is per-context, serial execution is the only correct
+  // option.
 
   unwind_protect_var<bool> upv (m_in_loop_command, true);
 
@@ -3696,7 +4012,7 @@ tree_evaluator::visit_if_command_list (tree_if_command_list& lst)
     {
       tree_expression *expr = tic->condition ();
 
-      if (! (in_debug_repl ()
+      if (! (m_debug_mode && in_debug_repl ()
              && m_call_stack.current_frame () == m_debug_frame))
         m_call_stack.set_location (tic->line (), tic->column ());
 
@@ -3802,7 +4118,8 @@ tree_evaluator::visit_return_command (tree_return_command& cmd)
 
   // Act like dbcont.
 
-  if (in_debug_repl () && m_call_stack.current_frame () == m_debug_frame)
+  if (m_debug_mode && in_debug_repl ()
+      && m_call_stack.current_frame () == m_debug_frame)
     dbcont ();
   else if (m_statement_context == SC_FUNCTION
            || m_statement_context == SC_SCRIPT
@@ -3824,7 +4141,7 @@ tree_evaluator::visit_statement (tree_statement& stmt)
 
   if (cmd || expr)
     {
-      if (! (in_debug_repl ()
+      if (! (m_debug_mode && in_debug_repl ()
              && m_call_stack.current_frame () == m_debug_frame))
         m_call_stack.set_location (stmt.line (), stmt.column ());
 
@@ -3943,7 +4260,7 @@ tree_evaluator::visit_statement_list (tree_statement_list& lst)
           if (! elt)
             error ("invalid statement found in statement list!");
 
-          octave_quit ();
+          quit_check ();
 
           elt->accept (*this);
 
@@ -4070,10 +4387,6 @@ tree_evaluator::visit_try_catch_command (tree_try_catch_command& cmd)
 
           es.save_exception (ee);
 
-          err_map.assign ("message", es.last_error_message ());
-          err_map.assign ("identifier", es.last_error_id ());
-          err_map.assign ("stack", es.last_error_stack ());
-
           m_interpreter.recover_from_exception ();
         }
 
@@ -4091,6 +4404,16 @@ tree_evaluator::visit_try_catch_command (tree_try_catch_command& cmd)
 
           if (expr_id)
             {
+              // Build the error struct only when the catch clause
+              // names a variable; a bare catch never looks at it and
+              // building the stack map is not free.
+
+              error_system& es = m_interpreter.get_error_system ();
+
+              err_map.assign ("message", es.last_error_message ());
+              err_map.assign ("identifier", es.last_error_id ());
+              err_map.assign ("stack", es.last_error_stack ());
+
               octave_lvalue ult = expr_id->lvalue (*this);
 
               ult.assign (octave_value::op_asn_eq, err_map);
@@ -4567,6 +4890,11 @@ void tree_evaluator::add_autoload (const std::string& fcn,
   std::string file_name = check_autoload_file (nm);
 
   m_autoload_map[fcn] = file_name;
+
+  // Autoloads take precedence over path files when resolving FCN, so
+  // any cached resolution of that name is now stale.
+
+  m_interpreter.get_symbol_table ().bump_fcn_table_revision ();
 }
 
 void tree_evaluator::remove_autoload (const std::string& fcn,
@@ -5128,7 +5456,7 @@ void tree_evaluator::echo_code (int line)
 // Decide if it's time to quit a for or while loop.
 bool tree_evaluator::quit_loop_now ()
 {
-  octave_quit ();
+  quit_check ();
 
   // Maybe handle 'continue N' someday...
 
@@ -28,6 +28,7 @@
 
 #include "octave-config.h"
 
+#include <functional>
 #include <iosfwd>
 #include <list>
 #include <memory>
@@ -38,6 +39,7 @@
 #include "bp-table.h"
 #include "call-stack.h"
 #include "oct-lvalue.h"
+#include "quit.h"
 #include "ov.h"
 #include "ovl.h"
 #include "profiler.h"
@@ -356,6 +358,10 @@ public:
 
   octave_value& global_varref (const std::string& name);
 
+  octave_value * global_binding (const std::string& name);
+
+  std::size_t global_binding_generation () const;
+
   void global_assign (const std::string& name,
                       const octave_value& val = octave_value ());
 
@@ -496,6 +502,8 @@ public:
 
   std::list<frame_info> backtrace_info () const;
 
+  std::function<std::list<frame_info> ()> backtrace_info_snapshot () const;
+
   octave_map backtrace (octave_idx_type& curr_user_frame,
                         bool print_subfn = true) const;
 
@@ -871,6 +879,21 @@ private:
 
   bool quit_loop_now ();
 
+  // Batched interrupt check for the statement and loop dispatch
+  // paths.  One dispatch in s_quit_check_interval pays for the flag
+  // load and a pending interrupt is still noticed within a handful
+  // of dispatches; code that can run for a long time between
+  // dispatches must keep calling octave_quit directly.
+
+  void quit_check ()
+  {
+    if (++m_quit_check_count >= s_quit_check_interval)
+      {
+        m_quit_check_count = 0;
+        octave_quit ();
+      }
+  }
+
   void bind_auto_fcn_vars (const string_vector& arg_names,
                            const Matrix& ignored_outputs, int nargin,
                            int nargout, bool takes_varargs,
@@ -976,6 +999,12 @@ private:
   // TRUE means we are evaluating some kind of looping construct.
   bool m_in_loop_command;
 
+  // Number of statement dispatches since the last interrupt check;
+  // see quit_check.
+  unsigned int m_quit_check_count = 0;
+
+  static const unsigned int s_quit_check_interval = 16;
+
   // Nonzero means we're breaking out of a loop or function body.
   int m_breaking;
 
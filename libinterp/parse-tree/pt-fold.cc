@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <functional>
+#include <sstream>
+
+#include "interpreter-private.h"
+#include "interpreter.h"
+#include "ov.h"
+#include "pt-binop.h"
+#include "pt-cbinop.h"
+#include "pt-const.h"
+#include "pt-fold.h"
+#include "pt-pr-code.h"
+#include "pt-unop.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Evaluate OP now if that is certain to produce the same value the
+// evaluator would produce later.  Only expressions whose operands are
+// literal constants qualify: identifiers and function calls can
+// resolve differently at run time, and matrix and cell constructors
+// are separate node types that never reach here.  Built-in operators
+// on the types a literal can have (double, complex, bool, char) are
+// pure, so evaluation order does not matter.
+//
+// If the operation fails -- which can only happen for pathological
+// literal combinations -- fold nothing and let the error occur at run
+// time where the user expects it.
+
+static bool
+fold_result (octave_value& result,
+             const std::function<octave_value (type_info&)>& op)
+{
+  interpreter *interp = interpreter::the_interpreter ();
+
+  // No folding when parsing outside of an interpreter context.
+
+  if (! interp)
+    return false;
+
+  try
+    {
+      result = op (interp->get_type_info ());
+    }
+  catch (const execution_exception&)
+    {
+      interp->recover_from_exception ();
+      return false;
+    }
+
+  return result.is_defined ();
+}
+
+tree_expression *
+maybe_constant_fold (tree_expression *expr)
+{
+  octave_value result;
+  bool folded = false;
+
+  if (expr->is_binary_expression ())
+    {
+      tree_binary_expression *binexp
+        = dynamic_cast<tree_binary_expression *> (expr);
+
+      // Compound binary expressions reference their operands through
+      // additional pointers and boolean expressions short circuit;
+      // neither is created from constant operands, so just skip them.
+
+      if (dynamic_cast<tree_compound_binary_expression *> (expr)
+          || dynamic_cast<tree_boolean_expression *> (expr))
+        return expr;
+
+      tree_expression *lhs = binexp->lhs ();
+      tree_expression *rhs = binexp->rhs ();
+
+      if (lhs && lhs->is_constant () && rhs && rhs->is_constant ())
+        {
+          octave_value a = dynamic_cast<tree_constant *> (lhs)->value ();
+          octave_value b = dynamic_cast<tree_constant *> (rhs)->value ();
+
+          octave_value::binary_op op_type = binexp->op_type ();
+
+          folded = fold_result (result,
+                                [=] (type_info& ti)
+                                {
+                                  return binary_op (ti, op_type, a, b);
+                                });
+        }
+    }
+  else if (expr->is_unary_expression ())
+    {
+      tree_unary_expression *unexp
+        = dynamic_cast<tree_unary_expression *> (expr);
+
+      octave_value::unary_op op_type = unexp->op_type ();
+
+      // Never fold increment or decrement; they modify their operand.
+
+      if (op_type == octave_value::op_incr
+          || op_type == octave_value::op_decr)
+        return expr;
+
+      tree_expression *op = unexp->operand ();
+
+      if (op && op->is_constant ())
+        {
+          octave_value a = dynamic_cast<tree_constant *> (op)->value ();
+
+          folded = fold_result (result,
+                                [=] (type_info& ti)
+                                {
+                                  return unary_op (ti, op_type, a);
+                                });
+        }
+    }
+
+  if (! folded)
+    return expr;
+
+  tree_constant *retval
+    = new tree_constant (result, expr->line (), expr->column ());
+
+  // Folding must not change how the expression prints: anonymous
+  // function bodies are displayed -- and rebuilt by func2str -- from
+  // their parse tree, and printing the folded value instead of the
+  // source would lose precision for results like 1/3.  Render the
+  // original expression and stash that as the constant's text.
+
+  std::ostringstream buf;
+  tree_print_code tpc (buf);
+  expr->accept (tpc);
+  retval->stash_original_text (buf.str ());
+
+  delete expr;
+
+  return retval;
+}
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_pt_fold_h)
+#define octave_pt_fold_h 1
+
+#include "octave-config.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+class tree_expression;
+
+// If EXPR is a unary or binary expression whose operands are all
+// literal constants, evaluate it now and return an equivalent
+// tree_constant, deleting EXPR.  Otherwise return EXPR unchanged.
+// The parser builds expressions bottom up, so applying this at
+// construction time folds arbitrarily deep literal subexpressions
+// without a separate tree traversal.
+
+extern OCTINTERP_API tree_expression *
+maybe_constant_fold (tree_expression *expr);
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
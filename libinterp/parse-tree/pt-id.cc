@@ -28,6 +28,7 @@
 #endif
 
 #include "error.h"
+#include "fcn-info.h"
 #include "interpreter-private.h"
 #include "oct-lvalue.h"
 #include "pt-const.h"
@@ -102,7 +103,43 @@ tree_identifier::evaluate_n (tree_evaluator& tw, int nargout)
 
       symbol_table& symtab = interp.get_symbol_table ();
 
-      val = symtab.find_function (m_sym.name ());
+      // Per-call-site inline cache.  A monomorphic call like foo(x)
+      // in a hot loop becomes a revision comparison instead of a
+      // full fcn_info lookup through class precedence and load-path
+      // state.  The cached value is revalidated with the usual
+      // out-of-date check so edited function files are still picked
+      // up, and the cache is keyed on the scope we resolved in so a
+      // script evaluated from different scopes cannot reuse a stale
+      // private or subfunction resolution.
+
+      std::size_t revision = symtab.fcn_table_revision ();
+      symbol_scope scope = tw.get_current_scope ();
+
+      if (m_cached_fcn_revision == revision
+          && m_cached_fcn.is_defined ()
+          && m_cached_fcn_scope == scope)
+        {
+          val = m_cached_fcn;
+
+          if (out_of_date_check (val))
+            m_cached_fcn = val;
+        }
+      else
+        {
+          val = symtab.find_function (m_sym.name ());
+
+          if (val.is_defined ())
+            {
+              m_cached_fcn = val;
+              m_cached_fcn_scope = scope;
+              m_cached_fcn_revision = revision;
+            }
+          else
+            {
+              m_cached_fcn = octave_value ();
+              m_cached_fcn_revision = 0;
+            }
+        }
     }
 
   if (val.is_defined ())
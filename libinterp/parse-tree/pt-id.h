@@ -36,6 +36,7 @@ class octave_value_list;
 class octave_function;
 
 #include "oct-lvalue.h"
+#include "ov.h"
 #include "pt-bp.h"
 #include "pt-exp.h"
 #include "pt-walk.h"
@@ -109,6 +110,13 @@ protected:
 
   // The symbol record that this identifier references.
   symbol_record m_sym;
+
+  // Per-call-site cache for function lookup, valid as long as the
+  // function table revision and the scope we resolved in are
+  // unchanged.  See tree_identifier::evaluate_n.
+  octave_value m_cached_fcn;
+  symbol_scope m_cached_fcn_scope;
+  std::size_t m_cached_fcn_revision = 0;
 };
 
 class tree_black_hole : public tree_identifier
@@ -27,14 +27,19 @@
 #  include "config.h"
 #endif
 
+#include <utility>
+
 #include "Cell.h"
+#include "dNDArray.h"
 #include "error.h"
+#include "fNDArray.h"
 #include "interpreter-private.h"
 #include "oct-map.h"
 #include "ovl.h"
 #include "oct-lvalue.h"
 #include "ov.h"
 #include "pt-arg-list.h"
+#include "pt-binop.h"
 #include "pt-eval.h"
 #include "pt-id.h"
 #include "pt-idx.h"
@@ -341,6 +346,184 @@ tree_index_expression::dup (symbol_scope& scope) const
 //    In the last two steps, the partial value computed in the
 //    previous step is used to determine the value of END.
 
+// Selecting elements with a freshly computed relational mask, as in
+// A(B > T), normally materializes a full logical array and then an
+// index vector before any data is copied.  For the common case of a
+// plain variable indexed by a single ARRAY-OP-SCALAR comparison we can
+// stream the comparison and the selection in one pass instead, so that
+// neither intermediate is ever allocated.
+
+template <typename ArrayT, typename BArrayT, typename S, typename Cmp>
+static octave_value
+fused_mask_select (const ArrayT& a, const BArrayT& b, S t, Cmp cmp)
+{
+  octave_idx_type n = a.numel ();
+
+  const typename ArrayT::element_type *av = a.data ();
+  const typename BArrayT::element_type *bv = b.data ();
+
+  octave_idx_type cnt = 0;
+  for (octave_idx_type i = 0; i < n; i++)
+    cnt += cmp (static_cast<S> (bv[i]), t);
+
+  bool row = (a.ndims () == 2 && a.rows () == 1);
+
+  ArrayT result (row ? dim_vector (1, cnt) : dim_vector (cnt, 1));
+
+  typename ArrayT::element_type *rv = result.fortran_vec ();
+
+  for (octave_idx_type i = 0; i < n; i++)
+    if (cmp (static_cast<S> (bv[i]), t))
+      *rv++ = av[i];
+
+  return octave_value (result);
+}
+
+template <typename ArrayT, typename BArrayT, typename S>
+static octave_value
+fused_mask_select_op (const ArrayT& a, const BArrayT& b, S t,
+                      octave_value::binary_op op)
+{
+  switch (op)
+    {
+    case octave_value::op_lt:
+      return fused_mask_select (a, b, t, [] (S x, S y) { return x < y; });
+
+    case octave_value::op_le:
+      return fused_mask_select (a, b, t, [] (S x, S y) { return x <= y; });
+
+    case octave_value::op_gt:
+      return fused_mask_select (a, b, t, [] (S x, S y) { return x > y; });
+
+    case octave_value::op_ge:
+      return fused_mask_select (a, b, t, [] (S x, S y) { return x >= y; });
+
+    case octave_value::op_eq:
+      return fused_mask_select (a, b, t, [] (S x, S y) { return x == y; });
+
+    case octave_value::op_ne:
+      return fused_mask_select (a, b, t, [] (S x, S y) { return x != y; });
+
+    default:
+      return octave_value ();
+    }
+}
+
+static bool
+fused_mask_index (tree_evaluator& tw, const octave_value& aval,
+                  tree_argument_list *args, octave_value& result)
+{
+  if (! args || args->length () != 1)
+    return false;
+
+  tree_expression *arg = args->front ();
+
+  if (! arg || ! arg->is_binary_expression ())
+    return false;
+
+  tree_binary_expression *bexp
+    = dynamic_cast<tree_binary_expression *> (arg);
+
+  octave_value::binary_op op = bexp->op_type ();
+
+  switch (op)
+    {
+    case octave_value::op_lt:
+    case octave_value::op_le:
+    case octave_value::op_eq:
+    case octave_value::op_ge:
+    case octave_value::op_gt:
+    case octave_value::op_ne:
+      break;
+
+    default:
+      return false;
+    }
+
+  // Only operands that are free of side effects (and of the magic
+  // "end" index, which needs indexing context that is not set up here)
+  // may be evaluated on this path: plain variables and constants.
+  // Anything else takes the normal route.
+
+  tree_expression *lhs_expr = bexp->lhs ();
+  tree_expression *rhs_expr = bexp->rhs ();
+
+  auto is_pure = [&tw] (tree_expression *e)
+  {
+    return e && (e->is_constant ()
+                 || (e->is_identifier () && tw.is_variable (e)));
+  };
+
+  if (! is_pure (lhs_expr) || ! is_pure (rhs_expr))
+    return false;
+
+  if (! ((aval.is_double_type () || aval.is_single_type ())
+         && aval.isreal () && ! aval.issparse () && aval.numel () > 1))
+    return false;
+
+  octave_value lhs_val = lhs_expr->evaluate (tw);
+  octave_value rhs_val = rhs_expr->evaluate (tw);
+
+  // Exactly one operand must be an array matching the dimensions of
+  // the indexed value and the other a real double scalar; mirror the
+  // operator when the scalar appears on the left.
+
+  if (lhs_val.numel () == 1 && rhs_val.numel () != 1)
+    {
+      std::swap (lhs_val, rhs_val);
+
+      switch (op)
+        {
+        case octave_value::op_lt: op = octave_value::op_gt; break;
+        case octave_value::op_le: op = octave_value::op_ge; break;
+        case octave_value::op_gt: op = octave_value::op_lt; break;
+        case octave_value::op_ge: op = octave_value::op_le; break;
+        default: break;
+        }
+    }
+
+  const octave_value& bval = lhs_val;
+  const octave_value& sval = rhs_val;
+
+  if (! ((bval.is_double_type () || bval.is_single_type ())
+         && bval.isreal () && ! bval.issparse ()
+         && bval.dims () == aval.dims ()))
+    return false;
+
+  // Requiring a double scalar keeps the comparison in the operand
+  // array's native precision, exactly as the elementwise relational
+  // operators would compute it.
+
+  if (! (sval.is_double_type () && sval.isreal () && ! sval.issparse ()
+         && sval.numel () == 1))
+    return false;
+
+  double t = sval.double_value ();
+
+  if (aval.is_double_type ())
+    {
+      NDArray a = aval.array_value ();
+
+      if (bval.is_double_type ())
+        result = fused_mask_select_op (a, bval.array_value (), t, op);
+      else
+        result = fused_mask_select_op (a, bval.float_array_value (),
+                                       static_cast<float> (t), op);
+    }
+  else
+    {
+      FloatNDArray a = aval.float_array_value ();
+
+      if (bval.is_double_type ())
+        result = fused_mask_select_op (a, bval.array_value (), t, op);
+      else
+        result = fused_mask_select_op (a, bval.float_array_value (),
+                                       static_cast<float> (t), op);
+    }
+
+  return result.is_defined ();
+}
+
 octave_value_list
 tree_index_expression::evaluate_n (tree_evaluator& tw, int nargout)
 {
@@ -387,6 +570,17 @@ tree_index_expression::evaluate_n (tree_evaluator& tw, int nargout)
                  nm.c_str (), advice.c_str ());
         }
 
+      if (is_var && n == 1 && nargout <= 1)
+        {
+          octave_value result;
+
+          if (fused_mask_index (tw, tw.varval (nm), *p_args, result))
+            {
+              retval = result;
+              return retval;
+            }
+        }
+
       if (! is_var)
         {
           octave_value_list first_args;
@@ -718,6 +912,32 @@ OCTAVE_END_NAMESPACE(octave)
 %! [x{:}] = deal (4, 5, 6);
 %! assert (x, {4, 5, 6});
 
+## Indexing by a relational mask computed in the index expression takes
+## a fused path; check that it agrees with indexing by a precomputed mask.
+%!test
+%! a = sin (1:100);
+%! mask = a > 0.5;
+%! assert (a(a > 0.5), a(mask));
+%! assert (a(0.5 < a), a(mask));
+%! assert (a(a != a), zeros (1, 0));
+%! b = a';
+%! mask = b <= -0.25;
+%! assert (b(b <= -0.25), b(mask));
+%! assert (size (b(b <= -0.25)), [nnz(mask), 1]);
+%! a(7) = NaN;
+%! mask = a >= 0.5;
+%! assert (a(a >= 0.5), a(mask));
+%! assert (! any (isnan (a(a >= 0.5))));
+
+%!test
+%! a = single (reshape (sin (1:24), 2, 3, 4));
+%! t = 0.25;
+%! mask = a > t;
+%! assert (a(a > t), a(mask));
+%! assert (class (a(a > t)), "single");
+%! b = reshape (cos (1:24), 2, 3, 4);
+%! assert (a(b < 0), a(find (b < 0)));
+
 %!test
 %! [x.a, x.b.c] = deal (1, 2);
 %! assert (x.a == 1 && x.b.c == 2);
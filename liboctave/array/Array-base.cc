@@ -32,11 +32,13 @@
 // this file.
 
 #include <ostream>
+#include <type_traits>
 
 #include "Array-util.h"
 #include "Array.h"
 #include "lo-mappers.h"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
 
 // One dimensional array class.  Handles the reference counting for
 // all the derived classes.
@@ -100,6 +102,13 @@ Array<T, Alloc>::fill (const T& val)
       m_rep = new ArrayRep (numel (), val);
       m_slice_data = m_rep->m_data;
     }
+  else if (std::is_trivially_copyable<T>::value)
+    {
+      T *data = m_slice_data;
+      octave::chunked_parallel_for
+        (m_slice_len, [data, val] (octave_idx_type start, octave_idx_type n)
+         { std::fill_n (data + start, n, val); });
+    }
   else
     std::fill_n (m_slice_data, m_slice_len, val);
 }
@@ -356,19 +365,49 @@ public:
   ~rec_permute_helper () { delete [] m_dim; }
 
   template <typename T>
-  void permute (const T *src, T *dest) const { do_permute (src, dest, m_top); }
+  void permute (const T *src, T *dest) const
+  {
+    if (m_top > 0 && std::is_trivially_copyable<T>::value)
+      {
+        // Each top-level iteration writes one contiguous run of the
+        // destination, so the outer loop can be split across threads
+        // for large arrays; elements that need nontrivial copying stay
+        // on the calling thread.
+
+        octave_idx_type len = m_dim[m_top];
+        octave_idx_type step = m_stride[m_top];
 
-  // Helper method for fast blocked transpose.
+        octave_idx_type sub = 1;
+        for (int k = 0; k < m_top; k++)
+          sub *= m_dim[k];
+
+        octave::chunked_parallel_for (len, len * sub,
+          [=] (octave_idx_type beg, octave_idx_type cnt)
+          {
+            T *d = dest + beg * sub;
+            for (octave_idx_type i = 0; i < cnt; i++)
+              d = do_permute (src + (beg + i) * step, d, m_top - 1);
+          });
+      }
+    else
+      do_permute (src, dest, m_top);
+  }
+
+  // Helper method for fast blocked transpose, covering source rows
+  // [R0, R1) only; tiles for disjoint row ranges write disjoint
+  // destination columns, so ranges may be processed concurrently.
   template <typename T>
-  static T *
-  blk_trans (const T *src, T *dest, octave_idx_type nr, octave_idx_type nc)
+  static void
+  blk_trans_range (const T *src, T *dest,
+                   octave_idx_type nr, octave_idx_type nc,
+                   octave_idx_type r0, octave_idx_type r1)
   {
     static const octave_idx_type m = 8;
     OCTAVE_LOCAL_BUFFER (T, blk, m*m);
-    for (octave_idx_type kr = 0; kr < nr; kr += m)
+    for (octave_idx_type kr = r0; kr < r1; kr += m)
       for (octave_idx_type kc = 0; kc < nc; kc += m)
         {
-          octave_idx_type lr = std::min (m, nr - kr);
+          octave_idx_type lr = std::min (m, r1 - kr);
           octave_idx_type lc = std::min (m, nc - kc);
           if (lr == m && lc == m)
             {
@@ -393,6 +432,13 @@ public:
                   dd[j*nc+i] = blk[i*m+j];
             }
         }
+  }
+
+  template <typename T>
+  static T *
+  blk_trans (const T *src, T *dest, octave_idx_type nr, octave_idx_type nc)
+  {
+    blk_trans_range (src, dest, nr, nc, 0, nr);
 
     return dest + nr*nc;
   }
@@ -822,8 +868,24 @@ Array<T, Alloc>::index (const octave::idx_vector& i, const octave::idx_vector& j
           const T *src = data ();
           T *dest = retval.fortran_vec ();
 
-          for (octave_idx_type k = 0; k < jl; k++)
-            dest += i.index (src + r * j.xelem (k), r, dest);
+          if (std::is_trivially_copyable<T>::value)
+            {
+              // Each column lands in its own slice of the result, so
+              // large extractions can copy columns concurrently.
+              octave::chunked_parallel_for
+                (jl, il * jl,
+                 [=, &i, &j] (octave_idx_type beg, octave_idx_type len)
+                 {
+                   T *d = dest + beg * il;
+                   for (octave_idx_type k = beg; k < beg + len; k++)
+                     d += i.index (src + r * j.xelem (k), r, d);
+                 });
+            }
+          else
+            {
+              for (octave_idx_type k = 0; k < jl; k++)
+                dest += i.index (src + r * j.xelem (k), r, dest);
+            }
         }
     }
 
@@ -951,8 +1013,14 @@ Array<T, Alloc>::resize1 (octave_idx_type n, const T& rfv)
         }
       else
         {
+          // Overallocate proportionally to the current size so that a
+          // sequence of pushes amortizes to O(1) per element; the
+          // reserve is invisible outside the rep and is trimmed by the
+          // next deep copy.  Keep the old fixed chunk as a floor so
+          // small arrays don't reallocate on nearly every push.
           static const octave_idx_type max_stack_chunk = 1024;
-          octave_idx_type nn = n + std::min (nx, max_stack_chunk);
+          octave_idx_type nn = n + std::max (std::min (nx, max_stack_chunk),
+                                             nx / 2);
           Array<T, Alloc> tmp (Array<T, Alloc> (dim_vector (nn, 1)), dv, 0, n);
           T *dest = tmp.fortran_vec ();
 
@@ -985,7 +1053,39 @@ Array<T, Alloc>::resize2 (octave_idx_type r, octave_idx_type c, const T& rfv)
 
   octave_idx_type rx = rows ();
   octave_idx_type cx = columns ();
-  if (r != rx || c != cx)
+  if (r == rx && c == cx + 1 && r > 0)
+    {
+      // Appending a single column (this is how row vectors, cell rows,
+      // and struct-array fields grow one element at a time).  Reuse
+      // any reserve left in the rep, and overallocate geometrically
+      // when a new rep is needed, just like the resize1 push path.
+
+      octave_idx_type nx = r * cx;
+      octave_idx_type n = nx + r;
+      dim_vector dv (r, c);
+
+      if (m_rep->m_count == 1
+          && m_slice_data + m_slice_len + r <= m_rep->m_data + m_rep->m_len)
+        {
+          std::fill_n (m_slice_data + m_slice_len, r, rfv);
+          m_slice_len += r;
+          m_dimensions = dv;
+        }
+      else
+        {
+          static const octave_idx_type max_stack_chunk = 1024;
+          octave_idx_type nn = n + std::max (std::min (nx, max_stack_chunk),
+                                             nx / 2);
+          Array<T, Alloc> tmp (Array<T, Alloc> (dim_vector (nn, 1)), dv, 0, n);
+          T *dest = tmp.fortran_vec ();
+
+          std::copy_n (data (), nx, dest);
+          std::fill_n (dest + nx, r, rfv);
+
+          *this = tmp;
+        }
+    }
+  else if (r != rx || c != cx)
     {
       Array<T, Alloc> tmp = Array<T, Alloc> (dim_vector (r, c));
       T *dest = tmp.fortran_vec ();
@@ -1427,12 +1527,56 @@ Array<T, Alloc>::delete_elements (const octave::idx_vector& i)
         {
           // Special case deleting a contiguous range.
           octave_idx_type m = n + l - u;
-          Array<T, Alloc> tmp (dim_vector (col_vec ? m : 1, ! col_vec ? m : 1));
-          const T *src = data ();
-          T *dest = tmp.fortran_vec ();
-          std::copy_n (src, l, dest);
-          std::copy (src + u, src + n, dest + l);
-          *this = tmp;
+          if (m_rep->m_count == 1)
+            {
+              // Unshared rep: close the hole with an overlapping
+              // leftward copy and shrink the view instead of
+              // reallocating.  The rep keeps its old capacity, which
+              // also makes repeated deletions cheap.
+              std::copy (m_slice_data + u, m_slice_data + n,
+                         m_slice_data + l);
+              m_dimensions = dim_vector (col_vec ? m : 1, ! col_vec ? m : 1);
+              m_slice_len = m;
+            }
+          else
+            {
+              Array<T, Alloc> tmp (dim_vector (col_vec ? m : 1,
+                                               ! col_vec ? m : 1));
+              const T *src = data ();
+              T *dest = tmp.fortran_vec ();
+              std::copy_n (src, l, dest);
+              std::copy (src + u, src + n, dest + l);
+              *this = tmp;
+            }
+        }
+      else if (m_rep->m_count == 1)
+        {
+          // Unshared rep: close all holes in place, walking the kept
+          // segments between the (sorted, deduplicated) deleted
+          // positions from left to right.
+          octave::idx_vector si = i.sorted (true);
+          octave_idx_type len = si.length (n);
+
+          T *fv = m_slice_data;
+          octave_idx_type dest = si(0);
+          for (octave_idx_type k = 0; k < len; k++)
+            {
+              octave_idx_type from = si(k) + 1;
+              octave_idx_type to = (k+1 < len ? si(k+1) : n);
+              std::copy (fv + from, fv + to, fv + dest);
+              dest += to - from;
+            }
+
+          // Match the orientation the complement-index path below
+          // would produce: a column vector, unless the object itself
+          // is a vector, which keeps its orientation.
+          octave_idx_type m = n - len;
+          dim_vector rdv (m, 1);
+          if (n != 1 && is_nd_vector () && m != 1 && rdv.is_nd_vector ())
+            rdv = m_dimensions.make_nd_vector (m);
+
+          m_dimensions = rdv;
+          m_slice_len = m;
         }
       else
         {
@@ -1472,21 +1616,45 @@ Array<T, Alloc>::delete_elements (int dim, const octave::idx_vector& i)
           for (int k = 0; k < dim; k++) dl *= m_dimensions(k);
           for (int k = dim + 1; k < ndims (); k++) du *= m_dimensions(k);
 
-          // Special case deleting a contiguous range.
-          Array<T, Alloc> tmp = Array<T, Alloc> (rdv);
-          const T *src = data ();
-          T *dest = tmp.fortran_vec ();
           l *= dl; u *= dl; n *= dl;
-          for (octave_idx_type k = 0; k < du; k++)
+
+          if (m_rep->m_count == 1)
             {
-              std::copy_n (src, l, dest);
-              dest += l;
-              std::copy (src + u, src + n, dest);
-              dest += n - u;
-              src += n;
+              // Unshared rep: compact page by page in place.  The
+              // destination stays strictly behind the source in every
+              // page, so the overlapping copies are safe, and the rep
+              // keeps its old capacity.
+              const T *src = m_slice_data;
+              T *dest = m_slice_data;
+              for (octave_idx_type k = 0; k < du; k++)
+                {
+                  if (k > 0)
+                    std::copy (src, src + l, dest);
+                  dest += l;
+                  std::copy (src + u, src + n, dest);
+                  dest += n - u;
+                  src += n;
+                }
+
+              m_dimensions = rdv;
+              m_slice_len = rdv.numel ();
             }
+          else
+            {
+              Array<T, Alloc> tmp = Array<T, Alloc> (rdv);
+              const T *src = data ();
+              T *dest = tmp.fortran_vec ();
+              for (octave_idx_type k = 0; k < du; k++)
+                {
+                  std::copy_n (src, l, dest);
+                  dest += l;
+                  std::copy (src + u, src + n, dest);
+                  dest += n - u;
+                  src += n;
+                }
 
-          *this = tmp;
+              *this = tmp;
+            }
         }
       else
         {
@@ -1579,6 +1747,42 @@ template <typename T, typename Alloc>
 Array<T, Alloc>&
 Array<T, Alloc>::insert (const Array<T, Alloc>& a, octave_idx_type r, octave_idx_type c)
 {
+  // Writing a 2-D block inside the bounds of a 2-D target reduces to
+  // one contiguous copy per source column, which is far cheaper than
+  // the generic indexed assignment and can be split across threads.
+  // This is the workhorse of matrix-literal assembly ([a, b; c, d]).
+
+  if (ndims () == 2 && a.ndims () == 2 && this != &a
+      && r >= 0 && c >= 0 && r + a.rows () <= rows ()
+      && c + a.columns () <= columns ())
+    {
+      octave_idx_type anr = a.rows ();
+      octave_idx_type anc = a.columns ();
+
+      if (anr > 0 && anc > 0)
+        {
+          octave_idx_type nr = rows ();
+          const T *src = a.data ();
+          T *dest = fortran_vec () + r + c * nr;
+
+          if (std::is_trivially_copyable<T>::value)
+            octave::chunked_parallel_for
+              (anc, a.numel (),
+               [=] (octave_idx_type start, octave_idx_type len)
+               {
+                 for (octave_idx_type j = start; j < start + len; j++)
+                   std::copy_n (src + j * anr, anr, dest + j * nr);
+               });
+          else
+            {
+              for (octave_idx_type j = 0; j < anc; j++)
+                std::copy_n (src + j * anr, anr, dest + j * nr);
+            }
+        }
+
+      return *this;
+    }
+
   octave::idx_vector i (r, r + a.rows ());
   octave::idx_vector j (c, c + a.columns ());
   if (ndims () == 2 && a.ndims () == 2)
@@ -1624,9 +1828,26 @@ Array<T, Alloc>::transpose () const
     {
       Array<T, Alloc> result (dim_vector (nc, nr));
 
-      // Reuse the implementation used for permuting.
+      // Reuse the implementation used for permuting, splitting the
+      // tile rows across threads for large matrices; each row range
+      // fills a contiguous run of destination columns.
 
-      rec_permute_helper::blk_trans (data (), result.fortran_vec (), nr, nc);
+      const T *s = data ();
+      T *d = result.fortran_vec ();
+
+      if (std::is_trivially_copyable<T>::value)
+        {
+          octave_idx_type nblk = (nr + 7) / 8;
+
+          octave::chunked_parallel_for (nblk, numel (),
+            [=] (octave_idx_type beg, octave_idx_type len)
+            {
+              rec_permute_helper::blk_trans_range
+                (s, d, nr, nc, beg * 8, std::min ((beg + len) * 8, nr));
+            });
+        }
+      else
+        rec_permute_helper::blk_trans (s, d, nr, nc);
 
       return result;
     }
@@ -1654,6 +1875,35 @@ no_op_fcn (const T& x)
   return x;
 }
 
+// Blocked transpose applying FCN to every element, covering source
+// rows [R0, R1); the counterpart of rec_permute_helper::blk_trans_range
+// for the hermitian operation.
+
+template <typename T>
+static void
+blk_herm_range (const T *src, T *dest,
+                octave_idx_type nr, octave_idx_type nc,
+                octave_idx_type r0, octave_idx_type r1,
+                T (*fcn) (const T&))
+{
+  static const octave_idx_type m = 8;
+  OCTAVE_LOCAL_BUFFER (T, blk, m*m);
+  for (octave_idx_type kr = r0; kr < r1; kr += m)
+    for (octave_idx_type kc = 0; kc < nc; kc += m)
+      {
+        octave_idx_type lr = std::min (m, r1 - kr);
+        octave_idx_type lc = std::min (m, nc - kc);
+        const T *ss = src + kc * nr + kr;
+        for (octave_idx_type j = 0; j < lc; j++)
+          for (octave_idx_type i = 0; i < lr; i++)
+            blk[j*m+i] = ss[j*nr + i];
+        T *dd = dest + kr * nc + kc;
+        for (octave_idx_type j = 0; j < lr; j++)
+          for (octave_idx_type i = 0; i < lc; i++)
+            dd[j*nc+i] = fcn (blk[i*m+j]);
+      }
+}
+
 template <typename T, typename Alloc>
 Array<T, Alloc>
 Array<T, Alloc>::hermitian (T (*fcn) (const T&)) const
@@ -1670,39 +1920,26 @@ Array<T, Alloc>::hermitian (T (*fcn) (const T&)) const
     {
       Array<T, Alloc> result (dim_vector (nc, nr));
 
-      // Blocked transpose to attempt to avoid cache misses.
+      // Blocked transpose to attempt to avoid cache misses, splitting
+      // the tile rows across threads for large matrices as in
+      // transpose above.
 
-      T buf[64];
+      const T *s = data ();
+      T *d = result.fortran_vec ();
 
-      octave_idx_type jj;
-      for (jj = 0; jj < (nc - 8 + 1); jj += 8)
+      if (std::is_trivially_copyable<T>::value)
         {
-          octave_idx_type ii;
-          for (ii = 0; ii < (nr - 8 + 1); ii += 8)
-            {
-              // Copy to buffer
-              for (octave_idx_type j = jj, k = 0, idxj = jj * nr;
-                   j < jj + 8; j++, idxj += nr)
-                for (octave_idx_type i = ii; i < ii + 8; i++)
-                  buf[k++] = xelem (i + idxj);
-
-              // Copy from buffer
-              for (octave_idx_type i = ii, idxi = ii * nc; i < ii + 8;
-                   i++, idxi += nc)
-                for (octave_idx_type j = jj, k = i - ii; j < jj + 8;
-                     j++, k+=8)
-                  result.xelem (j + idxi) = fcn (buf[k]);
-            }
+          octave_idx_type nblk = (nr + 7) / 8;
 
-          if (ii < nr)
-            for (octave_idx_type j = jj; j < jj + 8; j++)
-              for (octave_idx_type i = ii; i < nr; i++)
-                result.xelem (j, i) = fcn (xelem (i, j));
+          octave::chunked_parallel_for (nblk, numel (),
+            [=] (octave_idx_type beg, octave_idx_type len)
+            {
+              blk_herm_range (s, d, nr, nc, beg * 8,
+                              std::min ((beg + len) * 8, nr), fcn);
+            });
         }
-
-      for (octave_idx_type j = jj; j < nc; j++)
-        for (octave_idx_type i = 0; i < nr; i++)
-          result.xelem (j, i) = fcn (xelem (i, j));
+      else
+        blk_herm_range (s, d, nr, nc, 0, nr, fcn);
 
       return result;
     }
@@ -2226,6 +2463,85 @@ Array<T, Alloc>::nnz () const
   return retval;
 }
 
+// Parallel two-pass find-all: count the matches in each thread's block
+// so the output can be allocated exactly, then let every thread write
+// its block's indices into the resulting disjoint output ranges.  The
+// counting loop is a branchless reduction the compiler can vectorize.
+// Returns false when the size or configuration does not warrant
+// threading and the caller should use the sequential loops.
+
+template <typename T>
+static bool
+find_all_parallel (const T *src, octave_idx_type nel,
+                   Array<octave_idx_type>& retval)
+{
+#if defined (_OPENMP)
+
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+
+  if (threshold <= 0 || nel < threshold)
+    return false;
+
+  int nthreads = octave::parallel_num_threads ();
+
+  if (nthreads < 2)
+    return false;
+
+  const T zero = T ();
+
+  octave_idx_type chunk = (nel + nthreads - 1) / nthreads;
+
+  OCTAVE_LOCAL_BUFFER (octave_idx_type, counts, nthreads);
+
+#  pragma omp parallel for num_threads (nthreads) schedule (static)
+  for (int t = 0; t < nthreads; t++)
+    {
+      octave_idx_type start = static_cast<octave_idx_type> (t) * chunk;
+      octave_idx_type stop = std::min (start + chunk, nel);
+
+      octave_idx_type cnt = 0;
+      for (octave_idx_type i = start; i < stop; i++)
+        cnt += src[i] != zero;
+
+      counts[t] = cnt;
+    }
+
+  // Exclusive prefix sum turns the block counts into output offsets.
+  octave_idx_type total = 0;
+  for (int t = 0; t < nthreads; t++)
+    {
+      octave_idx_type cnt = counts[t];
+      counts[t] = total;
+      total += cnt;
+    }
+
+  retval.clear (total, 1);
+  octave_idx_type *dest = retval.fortran_vec ();
+
+#  pragma omp parallel for num_threads (nthreads) schedule (static)
+  for (int t = 0; t < nthreads; t++)
+    {
+      octave_idx_type start = static_cast<octave_idx_type> (t) * chunk;
+      octave_idx_type stop = std::min (start + chunk, nel);
+
+      octave_idx_type *d = dest + counts[t];
+      for (octave_idx_type i = start; i < stop; i++)
+        if (src[i] != zero) *d++ = i;
+    }
+
+  return true;
+
+#else
+
+  octave_unused_parameter (src);
+  octave_unused_parameter (nel);
+  octave_unused_parameter (retval);
+
+  return false;
+
+#endif
+}
+
 template <typename T, typename Alloc>
 Array<octave_idx_type>
 Array<T, Alloc>::find (octave_idx_type n, bool backward) const
@@ -2238,14 +2554,17 @@ Array<T, Alloc>::find (octave_idx_type n, bool backward) const
     {
       // We want all elements, which means we'll almost surely need
       // to resize.  So count first, then allocate array of exact size.
-      octave_idx_type cnt = 0;
-      for (octave_idx_type i = 0; i < nel; i++)
-        cnt += src[i] != zero;
-
-      retval.clear (cnt, 1);
-      octave_idx_type *dest = retval.fortran_vec ();
-      for (octave_idx_type i = 0; i < nel; i++)
-        if (src[i] != zero) *dest++ = i;
+      if (! find_all_parallel (src, nel, retval))
+        {
+          octave_idx_type cnt = 0;
+          for (octave_idx_type i = 0; i < nel; i++)
+            cnt += src[i] != zero;
+
+          retval.clear (cnt, 1);
+          octave_idx_type *dest = retval.fortran_vec ();
+          for (octave_idx_type i = 0; i < nel; i++)
+            if (src[i] != zero) *dest++ = i;
+        }
     }
   else
     {
@@ -2702,8 +3021,22 @@ Array<T, Alloc>::cat (int dim, octave_idx_type n, const Array<T, Alloc> *array_l
   if (retval.isempty ())
     return retval;
 
-  int nidx = std::max (dv.ndims (), static_cast<octave_idx_type> (dim + 1));
-  Array<octave::idx_vector> idxa (dim_vector (nidx, 1), octave::idx_vector::colon);
+  // Concatenating along DIM partitions the result into regular slabs:
+  // each source contributes one contiguous chunk per "page" (the
+  // product of the result dimensions above DIM), so the geometry of
+  // the whole operation is known up front and every source element can
+  // be copied directly to its final location in a single pass.
+
+  octave_idx_type below = 1;
+  for (int k = 0; k < dim && k < dv.ndims (); k++)
+    below *= dv(k);
+
+  octave_idx_type dlen = (dim < dv.ndims () ? dv(dim) : 1);
+  octave_idx_type slab = below * dlen;
+  octave_idx_type npages = retval.numel () / slab;
+
+  T *rv = retval.fortran_vec ();
+
   octave_idx_type l = 0;
 
   for (octave_idx_type i = 0; i < n; i++)
@@ -2725,9 +3058,24 @@ Array<T, Alloc>::cat (int dim, octave_idx_type n, const Array<T, Alloc> *array_l
       else
         u = l + 1;
 
-      idxa(dim) = octave::idx_vector (l, u);
+      octave_idx_type chunk = below * (u - l);
 
-      retval.assign (idxa, array_list[i]);
+      const T *src = array_list[i].data ();
+      T *dest = rv + l * below;
+
+      if (std::is_trivially_copyable<T>::value)
+        octave::chunked_parallel_for
+          (npages, array_list[i].numel (),
+           [=] (octave_idx_type start, octave_idx_type len)
+           {
+             for (octave_idx_type p = start; p < start + len; p++)
+               std::copy_n (src + p * chunk, chunk, dest + p * slab);
+           });
+      else
+        {
+          for (octave_idx_type p = 0; p < npages; p++)
+            std::copy_n (src + p * chunk, chunk, dest + p * slab);
+        }
 
       l = u;
     }
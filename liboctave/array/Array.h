@@ -34,10 +34,16 @@
 #include <algorithm>
 #include <iosfwd>
 #include <string>
+#include <type_traits>
 
 #include "Array-fwd.h"
+#include "MatrixType.h"
 #include "dim-vector.h"
 #include "idx-vector.h"
+#include "hugepage-wrapper.h"
+#include "oct-alloc-stats.h"
+#include "oct-block-pool.h"
+#include "oct-parallel.h"
 #include "lo-error.h"
 #include "lo-traits.h"
 #include "lo-utils.h"
@@ -169,12 +175,35 @@ protected:
     explicit ArrayRep (octave_idx_type len, const T& val)
       : Alloc (), m_data (allocate (len)), m_len (len), m_count (1)
     {
-      std::fill_n (m_data, len, val);
+      if (std::is_trivially_copyable<T>::value)
+        {
+          pointer data = m_data;
+          octave::chunked_parallel_for
+            (len, [data, val] (octave_idx_type start, octave_idx_type n)
+             { std::fill_n (data + start, n, val); });
+        }
+      else
+        std::fill_n (m_data, len, val);
     }
 
     explicit ArrayRep (pointer ptr, const dim_vector& dv,
                        const Alloc& xallocator = Alloc ())
       : Alloc (xallocator), m_data (ptr), m_len (dv.safe_numel ()), m_count (1)
+    {
+      // The adopted buffer was allocated elsewhere but is released
+      // through deallocate, so account for it here to keep the
+      // allocation counters balanced.
+      octave::alloc_stats::count_allocation (m_len * sizeof (T));
+    }
+
+    // Adopt a buffer that did not come from the allocator at all (for
+    // example a shared memory mapping).  RELEASE is called with the
+    // data pointer and element count instead of deallocating, and the
+    // allocation counters are left alone.
+    explicit ArrayRep (pointer ptr, const dim_vector& dv,
+                       void (*release) (pointer, std::size_t))
+      : Alloc (), m_data (ptr), m_len (dv.safe_numel ()), m_count (1),
+        m_release (release)
     { }
 
     // FIXME: Should the allocator be copied or created with the default?
@@ -185,19 +214,121 @@ protected:
       std::copy_n (a.m_data, a.m_len, m_data);
     }
 
-    ~ArrayRep () { deallocate (m_data, m_len); }
+    ~ArrayRep () { deallocate (m_data, m_len); delete m_mat_type; }
 
     octave_idx_type numel () const { return m_len; }
 
+    //! Cached MatrixType probe result for one matrix view of this rep,
+    //! identified by the view's offset into the data and its
+    //! dimensions.  The cache survives copies that share the rep and
+    //! is dropped by make_unique before any in-place modification.
+
+    struct mat_type_cache
+    {
+      MatrixType type;
+      octave_idx_type offset;
+      dim_vector dims;
+    };
+
+    mutable mat_type_cache *m_mat_type = nullptr;
+
+    // Disposal hook for buffers adopted from outside the allocator.
+    void (*m_release) (pointer, std::size_t) = nullptr;
+
     // No assignment!
 
     ArrayRep& operator = (const ArrayRep&) = delete;
 
+    //! Inline storage used instead of a separate heap block when the
+    //! data fits.  Scalar temporaries and short index vectors are by
+    //! far the most frequently constructed arrays, and this halves
+    //! their allocator traffic.
+
+    static const std::size_t s_small_bytes = 16;
+
+    //! Size above which a freshly allocated data block is advised to
+    //! the kernel for transparent huge pages.  Large arrays walk far
+    //! more address space than the TLB covers with base pages, and
+    //! giving the advice before the first touch lets the fault handler
+    //! install huge pages directly.
+
+    static const std::size_t s_hugepage_bytes = 4 * 1024 * 1024;
+
+    alignas (alignof (T)) unsigned char m_small[s_small_bytes];
+
+    bool fits_inline (std::size_t len) const
+    { return len * sizeof (T) <= s_small_bytes; }
+
+    //! Whether freed data blocks may recirculate through the block
+    //! pool.  The pool deals in raw operator new storage, so only
+    //! allocators backed by plain operator new with default alignment
+    //! can exchange blocks with it: std::allocator, and a polymorphic
+    //! allocator still using the default new/delete resource.
+
+#if defined (OCTAVE_HAVE_STD_PMR_POLYMORPHIC_ALLOCATOR)
+
+    static bool pool_backed_by_new (const std::pmr::polymorphic_allocator<T>& a)
+    { return a.resource () == std::pmr::get_default_resource (); }
+
+    template <typename A>
+    static bool pool_backed_by_new (const A&)
+    { return std::is_same<A, std::allocator<T>>::value; }
+
+    bool pool_eligible () const
+    {
+      return (alignof (T) <= alignof (std::max_align_t)
+              && pool_backed_by_new (static_cast<const Alloc&> (*this)));
+    }
+
+#else
+
+    bool pool_eligible () const
+    {
+      return std::is_same<Alloc, std::allocator<T>>::value
+             && alignof (T) <= alignof (std::max_align_t);
+    }
+
+#endif
+
     pointer allocate (size_t len)
     {
-      pointer data = Alloc_traits::allocate (*this, len);
-      for (size_t i = 0; i < len; i++)
-        T_Alloc_traits::construct (*this, data+i);
+      pointer data;
+      if (fits_inline (len))
+        data = reinterpret_cast<pointer> (m_small);
+      else
+        {
+          data = nullptr;
+          if (pool_eligible ())
+            data = static_cast<pointer>
+                   (octave::block_pool_acquire (len * sizeof (T)));
+          if (! data)
+            data = Alloc_traits::allocate (*this, len);
+          octave::alloc_stats::count_allocation (len * sizeof (T));
+          if (len * sizeof (T) >= s_hugepage_bytes
+              && octave_advise_hugepages_wrapper (data, len * sizeof (T)))
+            octave::alloc_stats::count_hugepage_advice ();
+        }
+      // Constructing the elements is also the first touch of the
+      // pages backing them.  For trivial types, split the loop with
+      // the same static partition chunked_parallel_for uses so that
+      // on first-touch NUMA systems each page lands on the node of
+      // the thread that will process that subrange later, instead of
+      // the whole array crowding the allocating thread's node.
+      if (std::is_trivially_default_constructible<T>::value)
+        {
+          octave_idx_type n = static_cast<octave_idx_type> (len);
+          octave::chunked_parallel_for
+            (n, [this, data] (octave_idx_type start, octave_idx_type cnt)
+             {
+               for (octave_idx_type i = 0; i < cnt; i++)
+                 T_Alloc_traits::construct (*this, data + start + i);
+             });
+        }
+      else
+        {
+          for (size_t i = 0; i < len; i++)
+            T_Alloc_traits::construct (*this, data+i);
+        }
       return data;
     }
 
@@ -205,7 +336,21 @@ protected:
     {
       for (size_t i = 0; i < len; i++)
         T_Alloc_traits::destroy (*this, data+i);
-      Alloc_traits::deallocate (*this, data, len);
+      if (m_release)
+        {
+          m_release (data, len);
+          return;
+        }
+      // Compare the pointer rather than the length: a rep adopting an
+      // external buffer may be small but must still release it.
+      if (data != reinterpret_cast<pointer> (m_small))
+        {
+          octave::alloc_stats::count_deallocation (len * sizeof (T));
+          if (pool_eligible ()
+              && octave::block_pool_release (data, len * sizeof (T)))
+            return;
+          Alloc_traits::deallocate (*this, data, len);
+        }
     }
   };
 
@@ -217,6 +362,8 @@ public:
   {
     if (m_rep->m_count > 1)
       {
+        octave::alloc_stats::count_cow_copy ();
+
         ArrayRep *r = new ArrayRep (m_slice_data, m_slice_len);
 
         if (--m_rep->m_count == 0)
@@ -225,6 +372,14 @@ public:
         m_rep = r;
         m_slice_data = m_rep->m_data;
       }
+    else if (m_rep->m_mat_type)
+      {
+        // The caller may modify the data in place, so any cached
+        // structure probe result is no longer trustworthy.
+
+        delete m_rep->m_mat_type;
+        m_rep->m_mat_type = nullptr;
+      }
   }
 
   typedef T element_type;
@@ -314,6 +469,21 @@ public:
     m_dimensions.chop_trailing_singletons ();
   }
 
+  // Take ownership of a buffer that was not allocated with operator
+  // new, for example a shared memory mapping.  When the last
+  // reference is dropped, RELEASE is called with PTR and the element
+  // count instead of deleting the buffer.
+
+  OCTARRAY_OVERRIDABLE_FUNC_API
+  explicit Array (T *ptr, const dim_vector& dv,
+                  void (*release) (T *, std::size_t))
+    : m_dimensions (dv),
+      m_rep (new typename Array<T, Alloc>::ArrayRep (ptr, dv, release)),
+      m_slice_data (m_rep->m_data), m_slice_len (m_rep->m_len)
+  {
+    m_dimensions.chop_trailing_singletons ();
+  }
+
   //! Reshape constructor.
   OCTARRAY_API Array (const Array<T, Alloc>& a, const dim_vector& dv);
 
@@ -668,9 +838,41 @@ public:
   OCTARRAY_OVERRIDABLE_FUNC_API bool is_shared () const
   { return m_rep->m_count > 1; }
 
+  //! True if the elements live in an adopted external buffer (for
+  //! example a memory mapping) instead of allocator storage.
+
+  OCTARRAY_OVERRIDABLE_FUNC_API bool adopted_storage () const
+  { return m_rep->m_release != nullptr; }
+
   OCTARRAY_OVERRIDABLE_FUNC_API int ndims () const
   { return m_dimensions.ndims (); }
 
+  //! Return the MatrixType probe result cached on the shared rep for
+  //! this exact view of the data, or an unknown type if none has been
+  //! stored.
+
+  MatrixType cached_matrix_type () const
+  {
+    typename ArrayRep::mat_type_cache *c = m_rep->m_mat_type;
+
+    return ((c && c->offset == m_slice_data - m_rep->m_data
+             && c->dims == m_dimensions)
+            ? c->type : MatrixType ());
+  }
+
+  //! Remember a MatrixType probe result on the shared rep so that
+  //! other arrays viewing the same data can reuse it instead of
+  //! re-probing the structure.  make_unique drops the cache before
+  //! any in-place modification.
+
+  void cache_matrix_type (const MatrixType& typ) const
+  {
+    delete m_rep->m_mat_type;
+    m_rep->m_mat_type = new typename ArrayRep::mat_type_cache
+                            { typ, m_slice_data - m_rep->m_data,
+                              m_dimensions };
+  }
+
   //@{
   //! Indexing without resizing.
   OCTARRAY_API Array<T, Alloc> index (const octave::idx_vector& i) const;
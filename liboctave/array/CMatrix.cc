@@ -1826,7 +1826,154 @@ ComplexMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
             }
         }
 
-      if (typ == MatrixType::Full)
+      bool solved = false;
+
+      if (typ == MatrixType::Full && nr >= 8)
+        {
+          // Detect densely stored tridiagonal systems; discretized 1-D
+          // operators are common and the banded factorization is O(n)
+          // instead of O(n^3).  The scan bails out at the first
+          // element off the three diagonals, so it costs next to
+          // nothing for general matrices.
+
+          const Complex *pm = data ();
+
+          bool tridiag = true;
+
+          for (F77_INT j = 0; j < nc && tridiag; j++)
+            {
+              const Complex *col = pm + static_cast<std::size_t> (j) * nr;
+              for (F77_INT i = 0; i < nr; i++)
+                if (col[i] != 0.0 && (i < j-1 || i > j+1))
+                  {
+                    tridiag = false;
+                    break;
+                  }
+            }
+
+          if (tridiag)
+            {
+              info = 0;
+
+              ComplexColumnVector dl (nr-1), d (nr), du (nr-1), du2 (nr-2);
+              Complex *pdl = dl.fortran_vec ();
+              Complex *pd = d.fortran_vec ();
+              Complex *pdu = du.fortran_vec ();
+              Complex *pdu2 = du2.fortran_vec ();
+
+              for (F77_INT j = 0; j < nc; j++)
+                {
+                  const Complex *col = pm + static_cast<std::size_t> (j) * nr;
+                  pd[j] = col[j];
+                  if (j > 0)
+                    pdu[j-1] = col[j-1];
+                  if (j < nc - 1)
+                    pdl[j] = col[j+1];
+                }
+
+              if (calc_cond && anorm < 0.0)
+                anorm = norm1 (*this);
+
+              Array<F77_INT> ipvt (dim_vector (nr, 1));
+              F77_INT *pipvt = ipvt.fortran_vec ();
+
+              F77_INT tmp_info = 0;
+
+              // Work around bug #45577, LAPACK crashes Octave if norm
+              // is NaN, as in the full path below.
+              if (octave::math::isnan (anorm) || octave::math::isinf (anorm))
+                info = -2;
+              else
+                {
+                  F77_XFCN (zgttrf, ZGTTRF, (nr, F77_DBLE_CMPLX_ARG (pdl),
+                                             F77_DBLE_CMPLX_ARG (pd),
+                                             F77_DBLE_CMPLX_ARG (pdu),
+                                             F77_DBLE_CMPLX_ARG (pdu2),
+                                             pipvt, tmp_info));
+
+                  info = tmp_info;
+                }
+
+              rcon = 0.0;
+              if (info != 0)
+                {
+                  info = -2;
+
+                  if (sing_handler)
+                    sing_handler (rcon);
+                  else
+                    octave::warn_singular_matrix ();
+
+                  mattype.mark_as_rectangular ();
+
+                  solved = true;
+                }
+              else
+                {
+                  if (calc_cond)
+                    {
+                      char job = '1';
+                      Array<Complex> z (dim_vector (2 * nc, 1));
+                      Complex *pz = z.fortran_vec ();
+
+                      F77_XFCN (zgtcon, ZGTCON, (F77_CONST_CHAR_ARG2 (&job, 1),
+                                                 nc, F77_CONST_DBLE_CMPLX_ARG (pdl),
+                                                 F77_CONST_DBLE_CMPLX_ARG (pd),
+                                                 F77_CONST_DBLE_CMPLX_ARG (pdu),
+                                                 F77_CONST_DBLE_CMPLX_ARG (pdu2),
+                                                 pipvt, anorm, rcon,
+                                                 F77_DBLE_CMPLX_ARG (pz),
+                                                 tmp_info
+                                                 F77_CHAR_ARG_LEN (1)));
+
+                      info = tmp_info;
+
+                      if (info != 0)
+                        info = -2;
+
+                      volatile double rcond_plus_one = rcon + 1.0;
+
+                      if (rcond_plus_one == 1.0
+                          || octave::math::isnan (rcon))
+                        {
+                          if (sing_handler)
+                            sing_handler (rcon);
+                          else
+                            octave::warn_singular_matrix (rcon);
+                        }
+                    }
+
+                  if (info == 0)
+                    {
+                      retval = b;
+                      Complex *result = retval.fortran_vec ();
+
+                      char job = 'N';
+                      F77_XFCN (zgttrs, ZGTTRS,
+                                (F77_CONST_CHAR_ARG2 (&job, 1),
+                                 nr, b_nc, F77_CONST_DBLE_CMPLX_ARG (pdl),
+                                 F77_CONST_DBLE_CMPLX_ARG (pd),
+                                 F77_CONST_DBLE_CMPLX_ARG (pdu),
+                                 F77_CONST_DBLE_CMPLX_ARG (pdu2),
+                                 pipvt, F77_DBLE_CMPLX_ARG (result),
+                                 b_nr, tmp_info
+                                 F77_CHAR_ARG_LEN (1)));
+
+                      info = tmp_info;
+
+                      solved = true;
+                    }
+                  else
+                    {
+                      mattype.mark_as_rectangular ();
+
+                      solved = true;
+                    }
+                }
+            }
+        }
+
+      if (typ == MatrixType::Full && ! solved)
         {
           info = 0;
 
@@ -27,10 +27,13 @@
 #  include "config.h"
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <complex>
 #include <istream>
 #include <ostream>
 
+#include "oct-parallel.h"
 #include "quit.h"
 #include "lo-ieee.h"
 #include "lo-mappers.h"
@@ -1125,6 +1128,8 @@ SparseComplexMatrix::determinant (octave_idx_type& err, double& rcond,
       // Turn-off UMFPACK scaling for LU
       Control (UMFPACK_SCALE) = UMFPACK_SCALE_NONE;
 
+      octave::maybe_set_nd_ordering (control);
+
       UMFPACK_ZNAME (report_control) (control);
 
       const octave_idx_type *Ap = cidx ();
@@ -5572,6 +5577,8 @@ SparseComplexMatrix::factorize (octave_idx_type& err, double& rcond,
   if (! octave::math::isnan (tmp))
     Control (UMFPACK_FIXQ) = tmp;
 
+  octave::maybe_set_nd_ordering (control);
+
   UMFPACK_ZNAME (report_control) (control);
 
   const octave_idx_type *Ap = cidx ();
@@ -5723,6 +5730,8 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const Matrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -5788,17 +5797,38 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const Matrix& b,
                   return retval;
                 }
 
-              cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+              octave_idx_type b_nr = b.rows ();
+              octave_idx_type b_nc = b.cols ();
+              retval.resize (b_nr, b_nc);
+
+              // Stream the right-hand side through the factor in
+              // bounded blocks of columns.  cholmod_solve allocates
+              // the solution and internal workspace proportional to
+              // the number of right-hand sides, so solving a wide B in
+              // a single call can multiply the peak memory of an
+              // already large factorization.
+              octave_idx_type max_blk = 64;
 
-              retval.resize (b.rows (), b.cols ());
-              for (octave_idx_type j = 0; j < b.cols (); j++)
+              for (octave_idx_type j0 = 0; j0 < b_nc; j0 += max_blk)
                 {
-                  octave_idx_type jr = j * b.rows ();
-                  for (octave_idx_type i = 0; i < b.rows (); i++)
-                    retval.xelem (i, j) = static_cast<Complex *>(X->x)[jr + i];
-                }
+                  octave_idx_type blk = std::min (max_blk, b_nc - j0);
+
+                  B->ncol = blk;
+                  B->nzmax = b_nr * blk;
+                  B->x = const_cast<double *> (b.data () + j0 * b_nr);
+
+                  cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+
+                  for (octave_idx_type j = 0; j < blk; j++)
+                    {
+                      octave_idx_type jr = j * b_nr;
+                      for (octave_idx_type i = 0; i < b_nr; i++)
+                        retval.xelem (i, j0 + j)
+                          = static_cast<Complex *>(X->x)[jr + i];
+                    }
 
-              CHOLMOD_NAME(free_dense) (&X, cm);
+                  CHOLMOD_NAME(free_dense) (&X, cm);
+                }
               CHOLMOD_NAME(free_factor) (&L, cm);
               CHOLMOD_NAME(finish) (cm);
               static char blank_name[] = " ";
@@ -5839,51 +5869,80 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const Matrix& b,
               OCTAVE_LOCAL_BUFFER (double, Bz, b_nr);
               for (octave_idx_type i = 0; i < b_nr; i++)
                 Bz[i] = 0.;
+              const double *Bzc = Bz;
 #else
-              OCTAVE_LOCAL_BUFFER (Complex, Bz, b_nr);
+              const double *breal = b.data ();
 #endif
               retval.resize (b_nr, b_nc);
               Complex *Xx = retval.fortran_vec ();
 
-              for (octave_idx_type j = 0, iidx = 0; j < b_nc; j++, iidx += b_nr)
-                {
+              // The right-hand side columns solve independently
+              // against the shared read-only factorization, so the
+              // column batches are distributed across threads; each
+              // thread reports into its own Info array and the stats
+              // of the last column are kept for report_info below.
+
+              std::atomic<int> batch_status (0);
+              std::atomic<int> *batch_statusp = &batch_status;
+
+              octave::chunked_parallel_for
+                (b_nc, b_nr * b_nc,
+                 [=] (octave_idx_type beg, octave_idx_type len)
+                 {
+                   double info_local[UMFPACK_INFO];
+
+#if ! defined (UMFPACK_SEPARATE_SPLIT)
+                   OCTAVE_LOCAL_BUFFER (Complex, Bz, b_nr);
+#endif
+
+                   for (octave_idx_type j = beg; j < beg + len; j++)
+                     {
+                       octave_idx_type iidx = j * b_nr;
+                       int st;
 #if defined (UMFPACK_SEPARATE_SPLIT)
-                  status = UMFPACK_ZNAME (solve) (UMFPACK_A,
-                                                  octave::to_suitesparse_intptr (Ap),
-                                                  octave::to_suitesparse_intptr (Ai),
-                                                  reinterpret_cast<const double *> (Ax),
-                                                  nullptr,
-                                                  reinterpret_cast<double *> (&Xx[iidx]),
-                                                  nullptr,
-                                                  &Bx[iidx], Bz, Numeric,
-                                                  control, info);
+                       st = UMFPACK_ZNAME (solve) (UMFPACK_A,
+                                                   octave::to_suitesparse_intptr (Ap),
+                                                   octave::to_suitesparse_intptr (Ai),
+                                                   reinterpret_cast<const double *> (Ax),
+                                                   nullptr,
+                                                   reinterpret_cast<double *> (&Xx[iidx]),
+                                                   nullptr,
+                                                   &Bx[iidx], Bzc, Numeric,
+                                                   control, info_local);
 #else
-                  for (octave_idx_type i = 0; i < b_nr; i++)
-                    Bz[i] = b.elem (i, j);
-
-                  status = UMFPACK_ZNAME (solve) (UMFPACK_A,
-                                                  octave::to_suitesparse_intptr (Ap),
-                                                  octave::to_suitesparse_intptr (Ai),
-                                                  reinterpret_cast<const double *> (Ax),
-                                                  0,
-                                                  reinterpret_cast<double *> (&Xx[iidx]),
-                                                  0,
-                                                  reinterpret_cast<const double *> (Bz),
-                                                  0, Numeric,
-                                                  control, info);
+                       for (octave_idx_type i = 0; i < b_nr; i++)
+                         Bz[i] = breal[iidx + i];
+
+                       st = UMFPACK_ZNAME (solve) (UMFPACK_A,
+                                                   octave::to_suitesparse_intptr (Ap),
+                                                   octave::to_suitesparse_intptr (Ai),
+                                                   reinterpret_cast<const double *> (Ax),
+                                                   0,
+                                                   reinterpret_cast<double *> (&Xx[iidx]),
+                                                   0,
+                                                   reinterpret_cast<const double *> (Bz),
+                                                   0, Numeric,
+                                                   control, info_local);
 #endif
 
-                  if (status < 0)
-                    {
-                      UMFPACK_ZNAME (report_status) (control, status);
+                       if (st < 0)
+                         batch_statusp->store (st);
 
-                      // FIXME: Should this be a warning?
-                      (*current_liboctave_error_handler)
-                        ("SparseComplexMatrix::solve solve failed");
+                       if (j == b_nc - 1)
+                         std::copy_n (info_local, UMFPACK_INFO, info);
+                     }
+                 });
 
-                      err = -1;
-                      break;
-                    }
+              status = batch_status.load ();
+              if (status < 0)
+                {
+                  UMFPACK_ZNAME (report_status) (control, status);
+
+                  // FIXME: Should this be a warning?
+                  (*current_liboctave_error_handler)
+                    ("SparseComplexMatrix::solve solve failed");
+
+                  err = -1;
                 }
 
               UMFPACK_ZNAME (report_info) (control, info);
@@ -5962,6 +6021,8 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const SparseMatrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -6252,6 +6313,8 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -6317,17 +6380,35 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
                   return retval;
                 }
 
-              cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+              octave_idx_type b_nr = b.rows ();
+              octave_idx_type b_nc = b.cols ();
+              retval.resize (b_nr, b_nc);
+
+              // Stream the right-hand side through the factor in
+              // bounded blocks of columns to limit the solve-phase
+              // workspace (see the real right-hand side case above).
+              octave_idx_type max_blk = 64;
 
-              retval.resize (b.rows (), b.cols ());
-              for (octave_idx_type j = 0; j < b.cols (); j++)
+              for (octave_idx_type j0 = 0; j0 < b_nc; j0 += max_blk)
                 {
-                  octave_idx_type jr = j * b.rows ();
-                  for (octave_idx_type i = 0; i < b.rows (); i++)
-                    retval.xelem (i, j) = static_cast<Complex *>(X->x)[jr + i];
-                }
+                  octave_idx_type blk = std::min (max_blk, b_nc - j0);
+
+                  B->ncol = blk;
+                  B->nzmax = b_nr * blk;
+                  B->x = const_cast<Complex *> (b.data () + j0 * b_nr);
+
+                  cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+
+                  for (octave_idx_type j = 0; j < blk; j++)
+                    {
+                      octave_idx_type jr = j * b_nr;
+                      for (octave_idx_type i = 0; i < b_nr; i++)
+                        retval.xelem (i, j0 + j)
+                          = static_cast<Complex *>(X->x)[jr + i];
+                    }
 
-              CHOLMOD_NAME(free_dense) (&X, cm);
+                  CHOLMOD_NAME(free_dense) (&X, cm);
+                }
               CHOLMOD_NAME(free_factor) (&L, cm);
               CHOLMOD_NAME(finish) (cm);
               static char blank_name[] = " ";
@@ -6368,30 +6449,51 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
               retval.resize (b_nr, b_nc);
               Complex *Xx = retval.fortran_vec ();
 
-              for (octave_idx_type j = 0, iidx = 0; j < b_nc; j++, iidx += b_nr)
-                {
-                  status
-                    = UMFPACK_ZNAME (solve) (UMFPACK_A,
-                                             octave::to_suitesparse_intptr (Ap),
-                                             octave::to_suitesparse_intptr (Ai),
-                                             reinterpret_cast<const double *> (Ax),
-                                             nullptr,
-                                             reinterpret_cast<double *> (&Xx[iidx]),
-                                             nullptr,
-                                             reinterpret_cast<const double *> (&Bx[iidx]),
-                                             nullptr, Numeric, control, info);
+              // Distribute the independent column batches over
+              // threads; see the real right-hand side variant above.
 
-                  if (status < 0)
-                    {
-                      UMFPACK_ZNAME (report_status) (control, status);
+              std::atomic<int> batch_status (0);
+              std::atomic<int> *batch_statusp = &batch_status;
 
-                      // FIXME: Should this be a warning?
-                      (*current_liboctave_error_handler)
-                        ("SparseComplexMatrix::solve solve failed");
+              octave::chunked_parallel_for
+                (b_nc, b_nr * b_nc,
+                 [=] (octave_idx_type beg, octave_idx_type len)
+                 {
+                   double info_local[UMFPACK_INFO];
 
-                      err = -1;
-                      break;
-                    }
+                   for (octave_idx_type j = beg; j < beg + len; j++)
+                     {
+                       octave_idx_type iidx = j * b_nr;
+                       int st
+                         = UMFPACK_ZNAME (solve) (UMFPACK_A,
+                                                  octave::to_suitesparse_intptr (Ap),
+                                                  octave::to_suitesparse_intptr (Ai),
+                                                  reinterpret_cast<const double *> (Ax),
+                                                  nullptr,
+                                                  reinterpret_cast<double *> (&Xx[iidx]),
+                                                  nullptr,
+                                                  reinterpret_cast<const double *> (&Bx[iidx]),
+                                                  nullptr, Numeric, control,
+                                                  info_local);
+
+                       if (st < 0)
+                         batch_statusp->store (st);
+
+                       if (j == b_nc - 1)
+                         std::copy_n (info_local, UMFPACK_INFO, info);
+                     }
+                 });
+
+              status = batch_status.load ();
+              if (status < 0)
+                {
+                  UMFPACK_ZNAME (report_status) (control, status);
+
+                  // FIXME: Should this be a warning?
+                  (*current_liboctave_error_handler)
+                    ("SparseComplexMatrix::solve solve failed");
+
+                  err = -1;
                 }
 
               UMFPACK_ZNAME (report_info) (control, info);
@@ -6470,6 +6572,8 @@ SparseComplexMatrix::fsolve (MatrixType& mattype, const SparseComplexMatrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -30,6 +30,93 @@
 #include "MArray.h"
 #include "Array-util.h"
 #include "lo-error.h"
+#include "oct-parallel.h"
+
+#include <vector>
+
+// Parallel scatter-reduce for the accumarray kernels: split the
+// subscript list across threads, each reducing into a private partial
+// array, and merge the partials into DST afterwards.  This only pays
+// off when the subscript list is much longer than the output, as in
+// histogram and group-by workloads, so the split is gated on both the
+// parallel threshold and the output size.  Returns false when the
+// caller should run the sequential loop instead.
+//
+// When IDEMPOTENT is true the partials start as copies of DST and OP
+// must satisfy op(x, x) == x, as min and max do; otherwise they start
+// at T(), which must be the identity of OP.
+
+template <typename T, typename ValFcn, typename OpFcn>
+static bool
+idx_scatter_reduce (T *dst, octave_idx_type n, const octave::idx_vector& idx,
+                    octave_idx_type len, ValFcn vfcn, bool idempotent,
+                    OpFcn op)
+{
+#if defined (_OPENMP)
+
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+
+  if (threshold <= 0 || len < threshold || n < 1 || ! idx.isvector ())
+    return false;
+
+  int nthreads = octave::parallel_num_threads ();
+
+  if (nthreads < 2 || n > len / nthreads)
+    return false;
+
+  // The copy shares the rep; raw is just the vector rep's data here.
+  octave::idx_vector vidx = idx;
+  const octave_idx_type *ridx = vidx.raw ();
+
+  std::vector<T> partials;
+
+  if (idempotent)
+    {
+      partials.reserve (static_cast<std::size_t> (nthreads) * n);
+      for (int t = 0; t < nthreads; t++)
+        partials.insert (partials.end (), dst, dst + n);
+    }
+  else
+    partials.resize (static_cast<std::size_t> (nthreads) * n, T ());
+
+  octave_idx_type chunk = (len + nthreads - 1) / nthreads;
+
+#  pragma omp parallel for num_threads (nthreads) schedule (static)
+  for (int t = 0; t < nthreads; t++)
+    {
+      T *part = partials.data () + static_cast<std::size_t> (t) * n;
+
+      octave_idx_type start = static_cast<octave_idx_type> (t) * chunk;
+      octave_idx_type stop = std::min (start + chunk, len);
+
+      for (octave_idx_type i = start; i < stop; i++)
+        part[ridx[i]] = op (part[ridx[i]], vfcn (i));
+    }
+
+  for (int t = 0; t < nthreads; t++)
+    {
+      const T *part = partials.data () + static_cast<std::size_t> (t) * n;
+
+      for (octave_idx_type j = 0; j < n; j++)
+        dst[j] = op (dst[j], part[j]);
+    }
+
+  return true;
+
+#else
+
+  octave_unused_parameter (dst);
+  octave_unused_parameter (n);
+  octave_unused_parameter (idx);
+  octave_unused_parameter (len);
+  octave_unused_parameter (vfcn);
+  octave_unused_parameter (idempotent);
+  octave_unused_parameter (op);
+
+  return false;
+
+#endif
+}
 
 template <typename T>
 class _idxadds_helper
@@ -74,7 +161,15 @@ MArray<T>::idx_add (const octave::idx_vector& idx, T val)
   octave_quit ();
 
   octave_idx_type len = idx.length (n);
-  idx.loop (len, _idxadds_helper<T> (this->fortran_vec (), val));
+
+  T *dst = this->fortran_vec ();
+
+  if (idx_scatter_reduce (dst, n, idx, len,
+                          [val] (octave_idx_type) { return val; }, false,
+                          [] (const T& x, const T& y) { return x + y; }))
+    return;
+
+  idx.loop (len, _idxadds_helper<T> (dst, val));
 }
 
 template <typename T>
@@ -92,7 +187,17 @@ MArray<T>::idx_add (const octave::idx_vector& idx, const MArray<T>& vals)
   octave_quit ();
 
   octave_idx_type len = std::min (idx.length (n), vals.numel ());
-  idx.loop (len, _idxadda_helper<T> (this->fortran_vec (), vals.data ()));
+
+  T *dst = this->fortran_vec ();
+  const T *vdata = vals.data ();
+
+  if (idx_scatter_reduce (dst, n, idx, len,
+                          [vdata] (octave_idx_type i) { return vdata[i]; },
+                          false,
+                          [] (const T& x, const T& y) { return x + y; }))
+    return;
+
+  idx.loop (len, _idxadda_helper<T> (dst, vdata));
 }
 
 template <typename T, T op (typename ref_param<T>::type,
@@ -125,8 +230,18 @@ MArray<T>::idx_min (const octave::idx_vector& idx, const MArray<T>& vals)
   octave_quit ();
 
   octave_idx_type len = std::min (idx.length (n), vals.numel ());
-  idx.loop (len, _idxbinop_helper<T, octave::math::min> (this->fortran_vec (),
-                                                         vals.data ()));
+
+  T *dst = this->fortran_vec ();
+  const T *vdata = vals.data ();
+
+  if (idx_scatter_reduce (dst, n, idx, len,
+                          [vdata] (octave_idx_type i) { return vdata[i]; },
+                          true,
+                          [] (const T& x, const T& y)
+                          { return octave::math::min (x, y); }))
+    return;
+
+  idx.loop (len, _idxbinop_helper<T, octave::math::min> (dst, vdata));
 }
 
 template <typename T>
@@ -144,8 +259,18 @@ MArray<T>::idx_max (const octave::idx_vector& idx, const MArray<T>& vals)
   octave_quit ();
 
   octave_idx_type len = std::min (idx.length (n), vals.numel ());
-  idx.loop (len, _idxbinop_helper<T, octave::math::max> (this->fortran_vec (),
-                                                         vals.data ()));
+
+  T *dst = this->fortran_vec ();
+  const T *vdata = vals.data ();
+
+  if (idx_scatter_reduce (dst, n, idx, len,
+                          [vdata] (octave_idx_type i) { return vdata[i]; },
+                          true,
+                          [] (const T& x, const T& y)
+                          { return octave::math::max (x, y); }))
+    return;
+
+  idx.loop (len, _idxbinop_helper<T, octave::math::max> (dst, vdata));
 }
 
 template <typename T>
@@ -30,7 +30,7 @@
 
 #include "mx-fwd.h"
 
-#include "MSparse.h"
+template <typename T> class MSparse;
 
 class
 MatrixType
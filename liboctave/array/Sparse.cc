@@ -1144,6 +1144,93 @@ Sparse<T, Alloc>::transpose () const
   octave_idx_type nz = nnz ();
   Sparse<T, Alloc> retval (nc, nr, nz);
 
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+  octave_idx_type nthr = octave::parallel_num_threads ();
+
+  // The parallel bucket pass keeps one row-counter array per thread,
+  // so it only pays off when the entry count dominates the row count;
+  // otherwise (and for small matrices) use the serial pass below.
+
+  if (threshold > 0 && nz >= threshold && nthr > 1 && nr <= nz / 4)
+    {
+      const octave_idx_type *cidxp = cidx ();
+      const octave_idx_type *ridxp = ridx ();
+      const T *datap = data ();
+
+      octave_idx_type *rcidx = retval.xcidx ();
+      octave_idx_type *rridx = retval.xridx ();
+      T *rdata = retval.xdata ();
+
+      // Split the source columns so that each thread sees roughly the
+      // same number of entries.
+
+      OCTAVE_LOCAL_BUFFER (octave_idx_type, csplit, nthr + 1);
+      csplit[0] = 0;
+      for (octave_idx_type t = 1; t < nthr; t++)
+        {
+          octave_idx_type target = t * (nz / nthr);
+          octave_idx_type c = std::lower_bound (cidxp, cidxp + nc + 1,
+                                                target) - cidxp;
+          csplit[t] = std::max (std::min (c, nc), csplit[t-1]);
+        }
+      csplit[nthr] = nc;
+
+      OCTAVE_LOCAL_BUFFER (octave_idx_type, counts, nthr * nr);
+
+      // Each thread counts the rows occurring in its column range.
+
+      octave::chunked_parallel_for
+        (nthr, nz, [=] (octave_idx_type beg, octave_idx_type len)
+         {
+           for (octave_idx_type t = beg; t < beg + len; t++)
+             {
+               octave_idx_type *cnt = counts + t * nr;
+               std::fill_n (cnt, nr, 0);
+               for (octave_idx_type j = csplit[t]; j < csplit[t+1]; j++)
+                 for (octave_idx_type k = cidxp[j]; k < cidxp[j+1]; k++)
+                   cnt[ridxp[k]]++;
+             }
+         });
+
+      // Turn the per-thread counts into absolute scatter offsets.
+      // Within each destination column the threads' regions follow
+      // each other in thread order and every thread walks its source
+      // columns in order, so the scattered entries stay sorted by
+      // source column.  The same pass produces the destination cidx.
+
+      octave_idx_type run = 0;
+      for (octave_idx_type r = 0; r < nr; r++)
+        {
+          rcidx[r] = run;
+          for (octave_idx_type t = 0; t < nthr; t++)
+            {
+              octave_idx_type tmp = counts[t * nr + r];
+              counts[t * nr + r] = run;
+              run += tmp;
+            }
+        }
+      rcidx[nr] = run;
+      assert (run == nz);
+
+      octave::chunked_parallel_for
+        (nthr, nz, [=] (octave_idx_type beg, octave_idx_type len)
+         {
+           for (octave_idx_type t = beg; t < beg + len; t++)
+             {
+               octave_idx_type *cnt = counts + t * nr;
+               for (octave_idx_type j = csplit[t]; j < csplit[t+1]; j++)
+                 for (octave_idx_type k = cidxp[j]; k < cidxp[j+1]; k++)
+                   {
+                     octave_idx_type q = cnt[ridxp[k]]++;
+                     rridx[q] = j;
+                     rdata[q] = datap[k];
+                   }
+             }
+         });
+
+      return retval;
+    }
+
   for (octave_idx_type i = 0; i < nz; i++)
     retval.xcidx (ridx (i) + 1)++;
   // retval.xcidx[1:nr] holds the row degrees for rows 0:(nr-1)
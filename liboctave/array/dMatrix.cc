@@ -1496,7 +1496,141 @@ Matrix::fsolve (MatrixType& mattype, const Matrix& b, octave_idx_type& info,
             }
         }
 
-      if (typ == MatrixType::Full)
+      bool solved = false;
+
+      if (typ == MatrixType::Full && nr >= 8)
+        {
+          // Detect densely stored tridiagonal systems; discretized 1-D
+          // operators are common and the banded factorization is O(n)
+          // instead of O(n^3).  The scan bails out at the first
+          // element off the three diagonals, so it costs next to
+          // nothing for general matrices.
+
+          const double *pm = data ();
+
+          bool tridiag = true;
+
+          for (F77_INT j = 0; j < nc && tridiag; j++)
+            {
+              const double *col = pm + static_cast<std::size_t> (j) * nr;
+              for (F77_INT i = 0; i < nr; i++)
+                if (col[i] != 0.0 && (i < j-1 || i > j+1))
+                  {
+                    tridiag = false;
+                    break;
+                  }
+            }
+
+          if (tridiag)
+            {
+              info = 0;
+
+              ColumnVector dl (nr-1), d (nr), du (nr-1), du2 (nr-2);
+              double *pdl = dl.fortran_vec ();
+              double *pd = d.fortran_vec ();
+              double *pdu = du.fortran_vec ();
+              double *pdu2 = du2.fortran_vec ();
+
+              for (F77_INT j = 0; j < nc; j++)
+                {
+                  const double *col = pm + static_cast<std::size_t> (j) * nr;
+                  pd[j] = col[j];
+                  if (j > 0)
+                    pdu[j-1] = col[j-1];
+                  if (j < nc - 1)
+                    pdl[j] = col[j+1];
+                }
+
+              if (calc_cond && anorm < 0.0)
+                anorm = norm1 (*this);
+
+              Array<F77_INT> ipvt (dim_vector (nr, 1));
+              F77_INT *pipvt = ipvt.fortran_vec ();
+
+              F77_INT tmp_info = 0;
+
+              F77_XFCN (dgttrf, DGTTRF, (nr, pdl, pd, pdu, pdu2, pipvt,
+                                         tmp_info));
+
+              info = tmp_info;
+
+              rcon = 0.0;
+              if (info != 0)
+                {
+                  info = -2;
+
+                  if (sing_handler)
+                    sing_handler (rcon);
+                  else
+                    octave::warn_singular_matrix ();
+
+                  mattype.mark_as_rectangular ();
+
+                  solved = true;
+                }
+              else
+                {
+                  if (calc_cond)
+                    {
+                      char job = '1';
+                      Array<double> z (dim_vector (2 * nc, 1));
+                      double *pz = z.fortran_vec ();
+                      Array<F77_INT> iz (dim_vector (nc, 1));
+                      F77_INT *piz = iz.fortran_vec ();
+
+                      F77_XFCN (dgtcon, DGTCON, (F77_CONST_CHAR_ARG2 (&job, 1),
+                                                 nc, pdl, pd, pdu, pdu2,
+                                                 pipvt, anorm, rcon, pz, piz,
+                                                 tmp_info
+                                                 F77_CHAR_ARG_LEN (1)));
+
+                      info = tmp_info;
+
+                      if (info != 0)
+                        info = -2;
+
+                      volatile double rcond_plus_one = rcon + 1.0;
+
+                      if (rcond_plus_one == 1.0
+                          || octave::math::isnan (rcon))
+                        {
+                          if (sing_handler)
+                            sing_handler (rcon);
+                          else
+                            octave::warn_singular_matrix (rcon);
+                        }
+                    }
+
+                  if (info == 0)
+                    {
+                      retval = b;
+                      double *result = retval.fortran_vec ();
+
+                      F77_INT b_nr = octave::to_f77_int (b.rows ());
+                      F77_INT b_nc = octave::to_f77_int (b.cols ());
+
+                      char job = 'N';
+                      F77_XFCN (dgttrs, DGTTRS,
+                                (F77_CONST_CHAR_ARG2 (&job, 1),
+                                 nr, b_nc, pdl, pd, pdu, pdu2,
+                                 pipvt, result, b_nr, tmp_info
+                                 F77_CHAR_ARG_LEN (1)));
+
+                      info = tmp_info;
+
+                      solved = true;
+                    }
+                  else
+                    {
+                      mattype.mark_as_rectangular ();
+
+                      solved = true;
+                    }
+                }
+            }
+        }
+
+      if (typ == MatrixType::Full && ! solved)
         {
           info = 0;
 
@@ -1580,7 +1714,7 @@ Matrix::fsolve (MatrixType& mattype, const Matrix& b, octave_idx_type& info,
                 mattype.mark_as_rectangular ();
             }
         }
-      else if (typ != MatrixType::Hermitian)
+      else if (! solved && typ != MatrixType::Hermitian)
         (*current_liboctave_error_handler) ("incorrect matrix type");
     }
 
@@ -2772,6 +2906,16 @@ Sylvester (const Matrix& a, const Matrix& b, const Matrix& c)
 %!assert (M'\cv, Mt\cv, 1e-14)
 %!assert (M'\rv', Mt\rvt, 1e-14)
 
+## Dense tridiagonal systems take a banded factorization fast path.
+%!test
+%! n = 50;
+%! A = full (spdiags (rand (n, 3) + 1, -1:1, n, n));
+%! b = rand (n, 2);
+%! x = A \ b;
+%! assert (A * x, b, 1e-10);
+%! x = (A + 1i * A) \ b;
+%! assert ((A + 1i * A) * x, b, 1e-10);
+
 */
 
 static inline char
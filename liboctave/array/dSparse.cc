@@ -27,6 +27,8 @@
 #  include "config.h"
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <istream>
 #include <ostream>
 
@@ -36,6 +38,7 @@
 #include "lo-mappers.h"
 #include "dRowVector.h"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
 
 #include "dDiagMatrix.h"
 #include "CSparse.h"
@@ -1065,6 +1068,8 @@ SparseMatrix::determinant (octave_idx_type& err, double& rcond, bool) const
       // Turn-off UMFPACK scaling for LU
       Control (UMFPACK_SCALE) = UMFPACK_SCALE_NONE;
 
+      octave::maybe_set_nd_ordering (control);
+
       UMFPACK_DNAME (report_control) (control);
 
       const octave_idx_type *Ap = cidx ();
@@ -5616,6 +5621,8 @@ SparseMatrix::factorize (octave_idx_type& err, double& rcond, Matrix& Control,
   if (! octave::math::isnan (tmp))
     Control (UMFPACK_FIXQ) = tmp;
 
+  octave::maybe_set_nd_ordering (control);
+
   UMFPACK_DNAME (report_control) (control);
 
   const octave_idx_type *Ap = cidx ();
@@ -5765,6 +5772,8 @@ SparseMatrix::fsolve (MatrixType& mattype, const Matrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -5830,17 +5839,38 @@ SparseMatrix::fsolve (MatrixType& mattype, const Matrix& b,
                   return retval;
                 }
 
-              cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+              octave_idx_type b_nr = b.rows ();
+              octave_idx_type b_nc = b.cols ();
+              retval.resize (b_nr, b_nc);
 
-              retval.resize (b.rows (), b.cols ());
-              for (octave_idx_type j = 0; j < b.cols (); j++)
+              // Stream the right-hand side through the factor in
+              // bounded blocks of columns.  cholmod_solve allocates
+              // the solution and internal workspace proportional to
+              // the number of right-hand sides, so solving a wide B in
+              // a single call can multiply the peak memory of an
+              // already large factorization.
+              octave_idx_type max_blk = 64;
+
+              for (octave_idx_type j0 = 0; j0 < b_nc; j0 += max_blk)
                 {
-                  octave_idx_type jr = j * b.rows ();
-                  for (octave_idx_type i = 0; i < b.rows (); i++)
-                    retval.xelem (i, j) = static_cast<double *>(X->x)[jr + i];
-                }
+                  octave_idx_type blk = std::min (max_blk, b_nc - j0);
+
+                  B->ncol = blk;
+                  B->nzmax = b_nr * blk;
+                  B->x = const_cast<double *> (b.data () + j0 * b_nr);
+
+                  cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
 
-              CHOLMOD_NAME(free_dense) (&X, cm);
+                  for (octave_idx_type j = 0; j < blk; j++)
+                    {
+                      octave_idx_type jr = j * b_nr;
+                      for (octave_idx_type i = 0; i < b_nr; i++)
+                        retval.xelem (i, j0 + j)
+                          = static_cast<double *>(X->x)[jr + i];
+                    }
+
+                  CHOLMOD_NAME(free_dense) (&X, cm);
+                }
               CHOLMOD_NAME(free_factor) (&L, cm);
               CHOLMOD_NAME(finish) (cm);
               static char blank_name[] = " ";
@@ -5880,24 +5910,48 @@ SparseMatrix::fsolve (MatrixType& mattype, const Matrix& b,
               const octave_idx_type *Ai = ridx ();
               const double *Ax = data ();
 
-              for (octave_idx_type j = 0, iidx = 0; j < b_nc; j++, iidx += b_nr)
+              // The factorization is read-only during the solve phase
+              // and the right-hand side columns are independent, so
+              // batches of columns are distributed across threads.
+              // Each thread reports into its own Info array; the stats
+              // of the last column are kept for report_info below.
+
+              std::atomic<int> batch_status (0);
+              std::atomic<int> *batch_statusp = &batch_status;
+
+              octave::chunked_parallel_for
+                (b_nc, b_nr * b_nc,
+                 [=] (octave_idx_type beg, octave_idx_type len)
+                 {
+                   double info_local[UMFPACK_INFO];
+
+                   for (octave_idx_type j = beg; j < beg + len; j++)
+                     {
+                       octave_idx_type iidx = j * b_nr;
+                       int st = UMFPACK_DNAME (solve) (UMFPACK_A,
+                                                       octave::to_suitesparse_intptr (Ap),
+                                                       octave::to_suitesparse_intptr (Ai),
+                                                       Ax, &result[iidx], &Bx[iidx],
+                                                       Numeric, control,
+                                                       info_local);
+                       if (st < 0)
+                         batch_statusp->store (st);
+
+                       if (j == b_nc - 1)
+                         std::copy_n (info_local, UMFPACK_INFO, info);
+                     }
+                 });
+
+              status = batch_status.load ();
+              if (status < 0)
                 {
-                  status = UMFPACK_DNAME (solve) (UMFPACK_A,
-                                                  octave::to_suitesparse_intptr (Ap),
-                                                  octave::to_suitesparse_intptr (Ai),
-                                                  Ax, &result[iidx], &Bx[iidx],
-                                                  Numeric, control, info);
-                  if (status < 0)
-                    {
-                      UMFPACK_DNAME (report_status) (control, status);
+                  UMFPACK_DNAME (report_status) (control, status);
 
-                      // FIXME: Should this be a warning?
-                      (*current_liboctave_error_handler)
-                        ("SparseMatrix::solve solve failed");
+                  // FIXME: Should this be a warning?
+                  (*current_liboctave_error_handler)
+                    ("SparseMatrix::solve solve failed");
 
-                      err = -1;
-                      break;
-                    }
+                  err = -1;
                 }
 
               UMFPACK_DNAME (report_info) (control, info);
@@ -5976,6 +6030,8 @@ SparseMatrix::fsolve (MatrixType& mattype, const SparseMatrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -6236,6 +6292,8 @@ SparseMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
@@ -6301,17 +6359,35 @@ SparseMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
                   return retval;
                 }
 
-              cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+              octave_idx_type b_nr = b.rows ();
+              octave_idx_type b_nc = b.cols ();
+              retval.resize (b_nr, b_nc);
 
-              retval.resize (b.rows (), b.cols ());
-              for (octave_idx_type j = 0; j < b.cols (); j++)
+              // Stream the right-hand side through the factor in
+              // bounded blocks of columns to limit the solve-phase
+              // workspace (see the real right-hand side case above).
+              octave_idx_type max_blk = 64;
+
+              for (octave_idx_type j0 = 0; j0 < b_nc; j0 += max_blk)
                 {
-                  octave_idx_type jr = j * b.rows ();
-                  for (octave_idx_type i = 0; i < b.rows (); i++)
-                    retval.xelem (i, j) = static_cast<Complex *>(X->x)[jr + i];
-                }
+                  octave_idx_type blk = std::min (max_blk, b_nc - j0);
+
+                  B->ncol = blk;
+                  B->nzmax = b_nr * blk;
+                  B->x = const_cast<Complex *> (b.data () + j0 * b_nr);
+
+                  cholmod_dense *X = CHOLMOD_NAME(solve) (CHOLMOD_A, L, B, cm);
+
+                  for (octave_idx_type j = 0; j < blk; j++)
+                    {
+                      octave_idx_type jr = j * b_nr;
+                      for (octave_idx_type i = 0; i < b_nr; i++)
+                        retval.xelem (i, j0 + j)
+                          = static_cast<Complex *>(X->x)[jr + i];
+                    }
 
-              CHOLMOD_NAME(free_dense) (&X, cm);
+                  CHOLMOD_NAME(free_dense) (&X, cm);
+                }
               CHOLMOD_NAME(free_factor) (&L, cm);
               CHOLMOD_NAME(finish) (cm);
               static char blank_name[] = " ";
@@ -6348,48 +6424,73 @@ SparseMatrix::fsolve (MatrixType& mattype, const ComplexMatrix& b,
               const octave_idx_type *Ai = ridx ();
               const double *Ax = data ();
 
-              OCTAVE_LOCAL_BUFFER (double, Bx, b_nr);
-              OCTAVE_LOCAL_BUFFER (double, Bz, b_nr);
-
               retval.resize (b_nr, b_nc);
 
-              OCTAVE_LOCAL_BUFFER (double, Xx, b_nr);
-              OCTAVE_LOCAL_BUFFER (double, Xz, b_nr);
-
-              for (octave_idx_type j = 0; j < b_nc; j++)
-                {
-                  for (octave_idx_type i = 0; i < b_nr; i++)
-                    {
-                      Complex c = b(i, j);
-                      Bx[i] = c.real ();
-                      Bz[i] = c.imag ();
-                    }
-
-                  status = UMFPACK_DNAME (solve) (UMFPACK_A,
-                                                  octave::to_suitesparse_intptr (Ap),
-                                                  octave::to_suitesparse_intptr (Ai),
-                                                  Ax, Xx, Bx, Numeric,
-                                                  control, info);
-                  int status2 = UMFPACK_DNAME (solve) (UMFPACK_A,
+              const Complex *bvec = b.data ();
+              Complex *rvec = retval.fortran_vec ();
+
+              // Column batches are distributed as in the real
+              // right-hand side case above; the split and recombine
+              // scratch is per-thread.
+
+              std::atomic<int> batch_status (0);
+              std::atomic<int> *batch_statusp = &batch_status;
+
+              octave::chunked_parallel_for
+                (b_nc, b_nr * b_nc,
+                 [=] (octave_idx_type beg, octave_idx_type len)
+                 {
+                   double info_local[UMFPACK_INFO];
+
+                   OCTAVE_LOCAL_BUFFER (double, Bx, b_nr);
+                   OCTAVE_LOCAL_BUFFER (double, Bz, b_nr);
+                   OCTAVE_LOCAL_BUFFER (double, Xx, b_nr);
+                   OCTAVE_LOCAL_BUFFER (double, Xz, b_nr);
+
+                   for (octave_idx_type j = beg; j < beg + len; j++)
+                     {
+                       for (octave_idx_type i = 0; i < b_nr; i++)
+                         {
+                           Complex c = bvec[j * b_nr + i];
+                           Bx[i] = c.real ();
+                           Bz[i] = c.imag ();
+                         }
+
+                       int st = UMFPACK_DNAME (solve) (UMFPACK_A,
                                                        octave::to_suitesparse_intptr (Ap),
                                                        octave::to_suitesparse_intptr (Ai),
-                                                       Ax, Xz, Bz,
-                                                       Numeric, control, info);
-
-                  if (status < 0 || status2 < 0)
-                    {
-                      UMFPACK_DNAME (report_status) (control, status);
-
-                      // FIXME: Should this be a warning?
-                      (*current_liboctave_error_handler)
-                        ("SparseMatrix::solve solve failed");
+                                                       Ax, Xx, Bx, Numeric,
+                                                       control, info_local);
+                       int st2 = UMFPACK_DNAME (solve) (UMFPACK_A,
+                                                        octave::to_suitesparse_intptr (Ap),
+                                                        octave::to_suitesparse_intptr (Ai),
+                                                        Ax, Xz, Bz, Numeric,
+                                                        control, info_local);
+
+                       if (st < 0 || st2 < 0)
+                         {
+                           batch_statusp->store (st < 0 ? st : st2);
+                           return;
+                         }
+
+                       for (octave_idx_type i = 0; i < b_nr; i++)
+                         rvec[j * b_nr + i] = Complex (Xx[i], Xz[i]);
+
+                       if (j == b_nc - 1)
+                         std::copy_n (info_local, UMFPACK_INFO, info);
+                     }
+                 });
+
+              status = batch_status.load ();
+              if (status < 0)
+                {
+                  UMFPACK_DNAME (report_status) (control, status);
 
-                      err = -1;
-                      break;
-                    }
+                  // FIXME: Should this be a warning?
+                  (*current_liboctave_error_handler)
+                    ("SparseMatrix::solve solve failed");
 
-                  for (octave_idx_type i = 0; i < b_nr; i++)
-                    retval(i, j) = Complex (Xx[i], Xz[i]);
+                  err = -1;
                 }
 
               UMFPACK_DNAME (report_info) (control, info);
@@ -6468,6 +6569,8 @@ SparseMatrix::fsolve (MatrixType& mattype, const SparseComplexMatrix& b,
 
           cm->final_ll = true;
 
+          octave::maybe_set_nd_ordering (cm);
+
           cholmod_sparse Astore;
           cholmod_sparse *A = &Astore;
           A->nrow = nr;
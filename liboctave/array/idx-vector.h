@@ -34,10 +34,12 @@
 #include <algorithm>
 #include <iosfwd>
 #include <memory>
+#include <type_traits>
 
 #include "Array-fwd.h"
 #include "dim-vector.h"
 #include "oct-inttypes.h"
+#include "oct-parallel.h"
 #include "oct-refcount.h"
 #include "Sparse-fwd.h"
 #include "range-fwd.h"
@@ -624,8 +626,24 @@ public:
         {
           idx_vector_rep *r = dynamic_cast<idx_vector_rep *> (m_rep);
           const octave_idx_type *data = r->get_data ();
-          for (octave_idx_type i = 0; i < len; i++)
-            dest[i] = src[data[i]];
+          if (std::is_trivially_copyable<T>::value)
+            {
+              // Large gathers are memory bound; split them across
+              // threads.  Non-trivial element types stay serial so
+              // that throwing copy constructors never cross the
+              // thread boundary.
+              chunked_parallel_for
+                (len, [=] (octave_idx_type beg, octave_idx_type blen)
+                 {
+                   for (octave_idx_type i = beg; i < beg + blen; i++)
+                     dest[i] = src[data[i]];
+                 });
+            }
+          else
+            {
+              for (octave_idx_type i = 0; i < len; i++)
+                dest[i] = src[data[i]];
+            }
         }
         break;
 
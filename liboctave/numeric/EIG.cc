@@ -191,33 +191,43 @@ EIG::symmetric_init (const Matrix& a, bool calc_rev, bool calc_lev)
   ColumnVector wr (n);
   double *pwr = wr.fortran_vec ();
 
+  // Divide-and-conquer driver; much faster than the QR-based DSYEV
+  // when eigenvectors are wanted.
+
   F77_INT lwork = -1;
+  F77_INT liwork = -1;
   double dummy_work;
+  F77_INT dummy_iwork;
 
-  F77_XFCN (dsyev, DSYEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, tmp_data, n, pwr, &dummy_work, lwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  F77_XFCN (dsyevd, DSYEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, tmp_data, n, pwr, &dummy_work, lwork,
+                             &dummy_iwork, liwork, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info != 0)
-    (*current_liboctave_error_handler) ("dsyev workspace query failed");
+    (*current_liboctave_error_handler) ("dsyevd workspace query failed");
 
   lwork = static_cast<F77_INT> (dummy_work);
+  liwork = dummy_iwork;
   Array<double> work (dim_vector (lwork, 1));
   double *pwork = work.fortran_vec ();
+  Array<F77_INT> iwork (dim_vector (liwork, 1));
+  F77_INT *piwork = iwork.fortran_vec ();
 
-  F77_XFCN (dsyev, DSYEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, tmp_data, n, pwr, pwork, lwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  F77_XFCN (dsyevd, DSYEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, tmp_data, n, pwr, pwork, lwork,
+                             piwork, liwork, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info < 0)
-    (*current_liboctave_error_handler) ("unrecoverable error in dsyev");
+    (*current_liboctave_error_handler) ("unrecoverable error in dsyevd");
 
   if (info > 0)
-    (*current_liboctave_error_handler) ("dsyev failed to converge");
+    (*current_liboctave_error_handler) ("dsyevd failed to converge");
 
   m_lambda = ComplexColumnVector (wr);
   m_v = (calc_rev ? ComplexMatrix (atmp) : ComplexMatrix ());
@@ -345,40 +355,53 @@ EIG::hermitian_init (const ComplexMatrix& a, bool calc_rev, bool calc_lev)
   ColumnVector wr (n);
   double *pwr = wr.fortran_vec ();
 
+  // Divide-and-conquer driver; much faster than the QR-based ZHEEV
+  // when eigenvectors are wanted.
+
   F77_INT lwork = -1;
+  F77_INT lrwork = -1;
+  F77_INT liwork = -1;
   Complex dummy_work;
+  double dummy_rwork;
+  F77_INT dummy_iwork;
 
-  F77_INT lrwork = 3*n;
-  Array<double> rwork (dim_vector (lrwork, 1));
-  double *prwork = rwork.fortran_vec ();
-
-  F77_XFCN (zheev, ZHEEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, F77_DBLE_CMPLX_ARG (tmp_data), n, pwr,
-                           F77_DBLE_CMPLX_ARG (&dummy_work), lwork,
-                           prwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  F77_XFCN (zheevd, ZHEEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, F77_DBLE_CMPLX_ARG (tmp_data), n, pwr,
+                             F77_DBLE_CMPLX_ARG (&dummy_work), lwork,
+                             &dummy_rwork, lrwork, &dummy_iwork, liwork,
+                             info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info != 0)
-    (*current_liboctave_error_handler) ("zheev workspace query failed");
+    (*current_liboctave_error_handler) ("zheevd workspace query failed");
 
   lwork = static_cast<F77_INT> (dummy_work.real ());
   Array<Complex> work (dim_vector (lwork, 1));
   Complex *pwork = work.fortran_vec ();
 
-  F77_XFCN (zheev, ZHEEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, F77_DBLE_CMPLX_ARG (tmp_data), n, pwr,
-                           F77_DBLE_CMPLX_ARG (pwork), lwork, prwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  lrwork = static_cast<F77_INT> (dummy_rwork);
+  Array<double> rwork (dim_vector (lrwork, 1));
+  double *prwork = rwork.fortran_vec ();
+
+  liwork = dummy_iwork;
+  Array<F77_INT> iwork (dim_vector (liwork, 1));
+  F77_INT *piwork = iwork.fortran_vec ();
+
+  F77_XFCN (zheevd, ZHEEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, F77_DBLE_CMPLX_ARG (tmp_data), n, pwr,
+                             F77_DBLE_CMPLX_ARG (pwork), lwork,
+                             prwork, lrwork, piwork, liwork, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info < 0)
-    (*current_liboctave_error_handler) ("unrecoverable error in zheev");
+    (*current_liboctave_error_handler) ("unrecoverable error in zheevd");
 
   if (info > 0)
-    (*current_liboctave_error_handler) ("zheev failed to converge");
+    (*current_liboctave_error_handler) ("zheevd failed to converge");
 
   m_lambda = ComplexColumnVector (wr);
   m_v = (calc_rev ? ComplexMatrix (atmp) : ComplexMatrix ());
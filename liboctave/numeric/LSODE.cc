@@ -169,8 +169,23 @@ LSODE::do_integrate (double tout)
                 }
             }
 
-          m_liw = 20 + n;
-          m_lrw = 22 + n * (9 + n);
+          // Size the work arrays for the chosen iteration method (see
+          // the LRW/LIW table in dlsode.f).  Sizing every stiff method
+          // for a full Jacobian would make banded problems, such as
+          // ensembles of independent systems integrated with stacked
+          // state vectors, allocate O(n^2) memory needlessly.
+
+          F77_INT ml = octave::to_f77_int (lower_jacobian_subdiagonals ());
+          F77_INT mu = octave::to_f77_int (upper_jacobian_subdiagonals ());
+
+          m_liw = (m_method_flag == 23 ? 20 : 20 + n);
+
+          if (m_method_flag == 21 || m_method_flag == 22)
+            m_lrw = 22 + n * (9 + n);
+          else if (m_method_flag == 23)
+            m_lrw = 22 + 10 * n;
+          else
+            m_lrw = 22 + n * (10 + 2 * ml + mu);
         }
       else
         {
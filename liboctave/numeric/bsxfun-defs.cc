@@ -35,6 +35,7 @@
 #include "lo-error.h"
 #include "mx-inlines.cc"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
 
 template <typename R, typename X, typename Y>
 Array<R>
@@ -83,6 +84,45 @@ do_bsxfun_op (const Array<X>& x, const Array<Y>& y,
     ; // do nothing
   else if (start == nd)
     op_vv (retval.numel (), rvec, xvec, yvec);
+  else if (nd == 2 && dvr(0) > 1)
+    {
+      // Stride-specialized 2-D broadcasting.  Row and column vector
+      // expansion covers nearly all broadcasting seen in practice, so
+      // compute each result column with one flat kernel call at a
+      // constant offset instead of per-slice index arithmetic, and
+      // split the independent columns across threads.
+
+      octave_idx_type rm = dvr(0);
+      octave_idx_type rn = dvr(1);
+
+      // Column strides; a zero stride spreads a single column.
+      octave_idx_type xc = (dvx(1) == 1 ? 0 : dvx(0));
+      octave_idx_type yc = (dvy(1) == 1 ? 0 : dvy(0));
+
+      // Whether a single element spreads along each result column.
+      // Both cannot be true, else the result would have one row.
+      bool xs = (dvx(0) == 1);
+      bool ys = (dvy(0) == 1);
+
+      octave::chunked_parallel_for
+        (rn, dvr.numel (),
+         [=] (octave_idx_type beg, octave_idx_type len)
+         {
+           for (octave_idx_type j = beg; j < beg + len; j++)
+             {
+               R *rc = rvec + j * rm;
+               const X *xp = xvec + j * xc;
+               const Y *yp = yvec + j * yc;
+
+               if (xs)
+                 op_sv (rm, rc, *xp, yp);
+               else if (ys)
+                 op_vs (rm, rc, xp, *yp);
+               else
+                 op_vv (rm, rc, xp, yp);
+             }
+         });
+    }
   else
     {
       // Determine the type of the low-level loop.
@@ -164,6 +204,33 @@ do_inplace_bsxfun_op (Array<R>& r, const Array<X>& x,
     ; // do nothing
   else if (start == nd)
     op_vv (r.numel (), rvec, xvec);
+  else if (nd == 2 && dvr(0) > 1)
+    {
+      // Same stride-specialized 2-D cases as in do_bsxfun_op above.
+
+      octave_idx_type rm = dvr(0);
+      octave_idx_type rn = dvr(1);
+
+      octave_idx_type xc = (dvx(1) == 1 ? 0 : dvx(0));
+
+      bool xs = (dvx(0) == 1);
+
+      octave::chunked_parallel_for
+        (rn, dvr.numel (),
+         [=] (octave_idx_type beg, octave_idx_type len)
+         {
+           for (octave_idx_type j = beg; j < beg + len; j++)
+             {
+               R *rc = rvec + j * rm;
+               const X *xp = xvec + j * xc;
+
+               if (xs)
+                 op_vs (rm, rc, *xp);
+               else
+                 op_vv (rm, rc, xp);
+             }
+         });
+    }
   else
     {
       // Determine the type of the low-level loop.
@@ -189,33 +189,44 @@ FloatEIG::symmetric_init (const FloatMatrix& a, bool calc_rev, bool calc_lev)
   FloatColumnVector wr (n);
   float *pwr = wr.fortran_vec ();
 
+  // Divide-and-conquer driver; much faster than the QR-based SSYEV
+  // when eigenvectors are wanted.
+
   F77_INT lwork = -1;
+  F77_INT liwork = -1;
   float dummy_work;
+  F77_INT dummy_iwork;
 
-  F77_XFCN (ssyev, SSYEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, tmp_data, n, pwr, &dummy_work, lwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  F77_XFCN (ssyevd, SSYEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, tmp_data, n, pwr, &dummy_work, lwork,
+                             &dummy_iwork, liwork, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info != 0)
-    (*current_liboctave_error_handler) ("ssyev workspace query failed");
+    (*current_liboctave_error_handler) ("ssyevd workspace query failed");
 
   lwork = static_cast<F77_INT> (dummy_work);
   Array<float> work (dim_vector (lwork, 1));
   float *pwork = work.fortran_vec ();
 
-  F77_XFCN (ssyev, SSYEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, tmp_data, n, pwr, pwork, lwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  liwork = dummy_iwork;
+  Array<F77_INT> iwork (dim_vector (liwork, 1));
+  F77_INT *piwork = iwork.fortran_vec ();
+
+  F77_XFCN (ssyevd, SSYEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, tmp_data, n, pwr, pwork, lwork,
+                             piwork, liwork, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info < 0)
-    (*current_liboctave_error_handler) ("unrecoverable error in ssyev");
+    (*current_liboctave_error_handler) ("unrecoverable error in ssyevd");
 
   if (info > 0)
-    (*current_liboctave_error_handler) ("ssyev failed to converge");
+    (*current_liboctave_error_handler) ("ssyevd failed to converge");
 
   m_lambda = FloatComplexColumnVector (wr);
   m_v = (calc_rev ? FloatComplexMatrix (atmp) : FloatComplexMatrix ());
@@ -342,40 +353,53 @@ FloatEIG::hermitian_init (const FloatComplexMatrix& a, bool calc_rev,
   FloatColumnVector wr (n);
   float *pwr = wr.fortran_vec ();
 
+  // Divide-and-conquer driver; much faster than the QR-based CHEEV
+  // when eigenvectors are wanted.
+
   F77_INT lwork = -1;
+  F77_INT lrwork = -1;
+  F77_INT liwork = -1;
   FloatComplex dummy_work;
+  float dummy_rwork;
+  F77_INT dummy_iwork;
 
-  F77_INT lrwork = 3*n;
-  Array<float> rwork (dim_vector (lrwork, 1));
-  float *prwork = rwork.fortran_vec ();
-
-  F77_XFCN (cheev, CHEEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, F77_CMPLX_ARG (tmp_data), n, pwr,
-                           F77_CMPLX_ARG (&dummy_work), lwork,
-                           prwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  F77_XFCN (cheevd, CHEEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, F77_CMPLX_ARG (tmp_data), n, pwr,
+                             F77_CMPLX_ARG (&dummy_work), lwork,
+                             &dummy_rwork, lrwork, &dummy_iwork, liwork,
+                             info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info != 0)
-    (*current_liboctave_error_handler) ("cheev workspace query failed");
+    (*current_liboctave_error_handler) ("cheevd workspace query failed");
 
   lwork = static_cast<F77_INT> (dummy_work.real ());
   Array<FloatComplex> work (dim_vector (lwork, 1));
   FloatComplex *pwork = work.fortran_vec ();
 
-  F77_XFCN (cheev, CHEEV, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
-                           F77_CONST_CHAR_ARG2 ("U", 1),
-                           n, F77_CMPLX_ARG (tmp_data), n, pwr,
-                           F77_CMPLX_ARG (pwork), lwork, prwork, info
-                           F77_CHAR_ARG_LEN (1)
-                           F77_CHAR_ARG_LEN (1)));
+  lrwork = static_cast<F77_INT> (dummy_rwork);
+  Array<float> rwork (dim_vector (lrwork, 1));
+  float *prwork = rwork.fortran_vec ();
+
+  liwork = dummy_iwork;
+  Array<F77_INT> iwork (dim_vector (liwork, 1));
+  F77_INT *piwork = iwork.fortran_vec ();
+
+  F77_XFCN (cheevd, CHEEVD, (F77_CONST_CHAR_ARG2 (calc_rev ? "V" : "N", 1),
+                             F77_CONST_CHAR_ARG2 ("U", 1),
+                             n, F77_CMPLX_ARG (tmp_data), n, pwr,
+                             F77_CMPLX_ARG (pwork), lwork,
+                             prwork, lrwork, piwork, liwork, info
+                             F77_CHAR_ARG_LEN (1)
+                             F77_CHAR_ARG_LEN (1)));
 
   if (info < 0)
-    (*current_liboctave_error_handler) ("unrecoverable error in cheev");
+    (*current_liboctave_error_handler) ("unrecoverable error in cheevd");
 
   if (info > 0)
-    (*current_liboctave_error_handler) ("cheev failed to converge");
+    (*current_liboctave_error_handler) ("cheevd failed to converge");
 
   m_lambda = FloatComplexColumnVector (wr);
   m_v = (calc_rev ? FloatComplexMatrix (atmp) : FloatComplexMatrix ());
@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <algorithm>
+
+#include "kdtree.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Ranges of at most this many points become leaves and are scanned
+// linearly during queries.
+
+static const octave_idx_type kdtree_leaf_size = 16;
+
+kdtree::kdtree (const Matrix& pts)
+  : m_pts (pts), m_npts (pts.rows ()), m_ndims (pts.cols ()),
+    m_idx (m_npts), m_nodes ()
+{
+  for (octave_idx_type i = 0; i < m_npts; i++)
+    m_idx[i] = i;
+
+  if (m_npts > 0 && m_ndims > 0)
+    {
+      m_nodes.reserve (2 * (m_npts / kdtree_leaf_size + 1));
+      build (0, m_npts, 0);
+    }
+}
+
+octave_idx_type
+kdtree::build (octave_idx_type lo, octave_idx_type hi, int depth)
+{
+  octave_idx_type ni = m_nodes.size ();
+  m_nodes.push_back (node ());
+
+  node& nd = m_nodes[ni];
+  nd.lo = lo;
+  nd.hi = hi;
+  nd.left = nd.right = -1;
+  nd.dim = depth % m_ndims;
+  nd.split = 0;
+
+  if (hi - lo <= kdtree_leaf_size)
+    return ni;
+
+  const double *coord = m_pts.data () + nd.dim * m_npts;
+
+  octave_idx_type mid = lo + (hi - lo) / 2;
+  std::nth_element (m_idx.begin () + lo, m_idx.begin () + mid,
+                    m_idx.begin () + hi,
+                    [coord] (octave_idx_type a, octave_idx_type b)
+                    { return coord[a] < coord[b]; });
+
+  double split = coord[m_idx[mid]];
+  int dim = nd.dim;
+
+  // build () may reallocate m_nodes, so finish with the reference
+  // before recursing and re-index afterwards.
+
+  octave_idx_type left = build (lo, mid, depth + 1);
+  octave_idx_type right = build (mid, hi, depth + 1);
+
+  node& nd2 = m_nodes[ni];
+  nd2.left = left;
+  nd2.right = right;
+  nd2.dim = dim;
+  nd2.split = split;
+
+  return ni;
+}
+
+double
+kdtree::point_dist2 (octave_idx_type p, const double *q) const
+{
+  const double *pv = m_pts.data ();
+  double s = 0;
+
+  for (octave_idx_type k = 0; k < m_ndims; k++)
+    {
+      double t = pv[p + k * m_npts] - q[k];
+      s += t * t;
+    }
+
+  return s;
+}
+
+void
+kdtree::search (octave_idx_type ni, const double *q, octave_idx_type k,
+                octave_idx_type *idx, double *dist2,
+                octave_idx_type& cnt) const
+{
+  const node& nd = m_nodes[ni];
+
+  if (nd.left < 0)
+    {
+      // Leaf: scan the range, keeping the candidate lists sorted by
+      // insertion (k is small, so this beats heap bookkeeping).
+
+      for (octave_idx_type i = nd.lo; i < nd.hi; i++)
+        {
+          octave_idx_type p = m_idx[i];
+          double d2 = point_dist2 (p, q);
+
+          if (cnt == k && d2 >= dist2[cnt-1])
+            continue;
+
+          octave_idx_type pos = (cnt < k ? cnt : k - 1);
+          while (pos > 0 && dist2[pos-1] > d2)
+            {
+              dist2[pos] = dist2[pos-1];
+              idx[pos] = idx[pos-1];
+              pos--;
+            }
+
+          dist2[pos] = d2;
+          idx[pos] = p;
+
+          if (cnt < k)
+            cnt++;
+        }
+
+      return;
+    }
+
+  double delta = q[nd.dim] - nd.split;
+
+  octave_idx_type near = (delta <= 0 ? nd.left : nd.right);
+  octave_idx_type far = (delta <= 0 ? nd.right : nd.left);
+
+  search (near, q, k, idx, dist2, cnt);
+
+  if (cnt < k || delta * delta < dist2[cnt-1])
+    search (far, q, k, idx, dist2, cnt);
+}
+
+octave_idx_type
+kdtree::knn (const double *q, octave_idx_type k,
+             octave_idx_type *idx, double *dist2) const
+{
+  if (m_nodes.empty () || k < 1)
+    return 0;
+
+  if (k > m_npts)
+    k = m_npts;
+
+  octave_idx_type cnt = 0;
+  search (0, q, k, idx, dist2, cnt);
+
+  return cnt;
+}
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_kdtree_h)
+#define octave_kdtree_h 1
+
+#include "octave-config.h"
+
+#include <vector>
+
+#include "dMatrix.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A k-d tree over the rows of a matrix of points, built once and then
+// queried many times.  Queries are read-only, so batches of queries
+// may be issued concurrently from several threads against the same
+// tree.
+
+class OCTAVE_API kdtree
+{
+public:
+
+  kdtree () : m_pts (), m_npts (0), m_ndims (0), m_idx (), m_nodes () { }
+
+  explicit kdtree (const Matrix& pts);
+
+  kdtree (const kdtree&) = default;
+
+  kdtree& operator = (const kdtree&) = default;
+
+  ~kdtree () = default;
+
+  octave_idx_type numel () const { return m_npts; }
+
+  octave_idx_type ndims () const { return m_ndims; }
+
+  // Find the (at most) K nearest neighbors of the query point Q (an
+  // array of ndims () coordinates).  The 0-based point indices and
+  // squared distances are stored in increasing order of distance in
+  // IDX and DIST2, which must have room for K entries each.  Returns
+  // the number of neighbors found (min (K, numel ())).
+
+  octave_idx_type knn (const double *q, octave_idx_type k,
+                       octave_idx_type *idx, double *dist2) const;
+
+private:
+
+  struct node
+  {
+    octave_idx_type lo, hi;      // range in m_idx (leaf only)
+    octave_idx_type left, right; // children, -1 for leaves
+    int dim;                     // split dimension
+    double split;                // split coordinate
+  };
+
+  // Points are stored by column as passed in; m_idx holds the
+  // permutation produced by the median splits.
+
+  Matrix m_pts;
+  octave_idx_type m_npts;
+  octave_idx_type m_ndims;
+  std::vector<octave_idx_type> m_idx;
+  std::vector<node> m_nodes;
+
+  octave_idx_type build (octave_idx_type lo, octave_idx_type hi, int depth);
+
+  void search (octave_idx_type ni, const double *q, octave_idx_type k,
+               octave_idx_type *idx, double *dist2,
+               octave_idx_type& cnt) const;
+
+  double point_dist2 (octave_idx_type p, const double *q) const;
+};
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -1255,6 +1255,26 @@ extern "C"
    F77_CHAR_ARG_LEN_DECL
    F77_CHAR_ARG_LEN_DECL);
 
+  // GTCON
+
+  F77_RET_T
+  F77_FUNC (dgtcon, DGTCON) (F77_CONST_CHAR_ARG_DECL,
+                             const F77_INT&, const F77_DBLE *,
+                             const F77_DBLE *, const F77_DBLE *,
+                             const F77_DBLE *, const F77_INT *,
+                             const F77_DBLE&, F77_DBLE&, F77_DBLE *,
+                             F77_INT *, F77_INT&
+                             F77_CHAR_ARG_LEN_DECL);
+
+  F77_RET_T
+  F77_FUNC (zgtcon, ZGTCON) (F77_CONST_CHAR_ARG_DECL,
+                             const F77_INT&, const F77_DBLE_CMPLX *,
+                             const F77_DBLE_CMPLX *, const F77_DBLE_CMPLX *,
+                             const F77_DBLE_CMPLX *, const F77_INT *,
+                             const F77_DBLE&, F77_DBLE&, F77_DBLE_CMPLX *,
+                             F77_INT&
+                             F77_CHAR_ARG_LEN_DECL);
+
   // GTSV
 
   F77_RET_T
@@ -1321,6 +1341,29 @@ extern "C"
                            F77_CHAR_ARG_LEN_DECL
                            F77_CHAR_ARG_LEN_DECL);
 
+  // HEEVD
+
+  F77_RET_T
+  F77_FUNC (cheevd, CHEEVD) (F77_CONST_CHAR_ARG_DECL,
+                             F77_CONST_CHAR_ARG_DECL,
+                             const F77_INT&, F77_CMPLX *,
+                             const F77_INT&, F77_REAL *, F77_CMPLX *,
+                             const F77_INT&, F77_REAL *, const F77_INT&,
+                             F77_INT *, const F77_INT&, F77_INT&
+                             F77_CHAR_ARG_LEN_DECL
+                             F77_CHAR_ARG_LEN_DECL);
+
+  F77_RET_T
+  F77_FUNC (zheevd, ZHEEVD) (F77_CONST_CHAR_ARG_DECL,
+                             F77_CONST_CHAR_ARG_DECL,
+                             const F77_INT&, F77_DBLE_CMPLX *,
+                             const F77_INT&, F77_DBLE *,
+                             F77_DBLE_CMPLX *, const F77_INT&,
+                             F77_DBLE *, const F77_INT&,
+                             F77_INT *, const F77_INT&, F77_INT&
+                             F77_CHAR_ARG_LEN_DECL
+                             F77_CHAR_ARG_LEN_DECL);
+
   // HEGV
 
   F77_RET_T
@@ -1715,6 +1758,28 @@ extern "C"
                            F77_CHAR_ARG_LEN_DECL
                            F77_CHAR_ARG_LEN_DECL);
 
+  // SYEVD
+
+  F77_RET_T
+  F77_FUNC (dsyevd, DSYEVD) (F77_CONST_CHAR_ARG_DECL,
+                             F77_CONST_CHAR_ARG_DECL,
+                             const F77_INT&, F77_DBLE *,
+                             const F77_INT&, F77_DBLE *, F77_DBLE *,
+                             const F77_INT&, F77_INT *, const F77_INT&,
+                             F77_INT&
+                             F77_CHAR_ARG_LEN_DECL
+                             F77_CHAR_ARG_LEN_DECL);
+
+  F77_RET_T
+  F77_FUNC (ssyevd, SSYEVD) (F77_CONST_CHAR_ARG_DECL,
+                             F77_CONST_CHAR_ARG_DECL,
+                             const F77_INT&, F77_REAL *,
+                             const F77_INT&, F77_REAL *, F77_REAL *,
+                             const F77_INT&, F77_INT *, const F77_INT&,
+                             F77_INT&
+                             F77_CHAR_ARG_LEN_DECL
+                             F77_CHAR_ARG_LEN_DECL);
+
   // SYGV
 
   F77_RET_T
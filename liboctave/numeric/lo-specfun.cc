@@ -54,6 +54,7 @@
 #include "lo-slatec-proto.h"
 #include "lo-specfun.h"
 #include "mx-inlines.cc"
+#include "oct-parallel.h"
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
@@ -1611,6 +1612,99 @@ erfc (const FloatComplex& x)
   return FloatComplex (ret.real (), ret.imag ());
 }
 
+// Batched real erf/erfc.  The elements are processed in small blocks:
+// a block that lies entirely in [-1, 1] is evaluated with a truncated
+// Taylor series, erf (x) = x * P (x^2), in a branch-free loop the
+// compiler can vectorize; blocks containing larger or non-finite
+// values fall back to the libm routines element by element.  The
+// series is carried to x^41, giving a truncation error below 5e-22 at
+// the interval ends, so the result agrees with libm to rounding
+// error.
+
+static const double erf_taylor[21] =
+{
+  1.1283791670955126,
+  -0.3761263890318375,
+  0.11283791670955126,
+  -0.02686617064513125,
+  0.005223977625442187,
+  -0.0008548327023450852,
+  0.00012055332981789664,
+  -1.4925650358406252e-05,
+  1.6462114365889246e-06,
+  -1.6365844691234924e-07,
+  1.4807192815879218e-08,
+  -1.2290555301717926e-09,
+  9.422759064650411e-11,
+  -6.7113668551641105e-12,
+  4.463224263286477e-13,
+  -2.7835162072109215e-14,
+  1.6342614095367152e-15,
+  -9.063970842808672e-17,
+  4.763348040515068e-18,
+  -2.3784598852774293e-19,
+  1.131218725924631e-20
+};
+
+static inline double
+erf_central (double x)
+{
+  double t = x * x;
+  double p = erf_taylor[20];
+
+  for (int k = 19; k >= 0; k--)
+    p = p * t + erf_taylor[k];
+
+  return x * p;
+}
+
+static const octave_idx_type erf_block = 8;
+
+void
+erf (const double *x, double *r, octave_idx_type n)
+{
+  chunked_parallel_for
+    (n,
+     [=] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type b = beg; b < beg + len; b += erf_block)
+         {
+           octave_idx_type bn = std::min (erf_block, beg + len - b);
+
+           bool central = true;
+           for (octave_idx_type i = b; i < b + bn; i++)
+             central = central && std::abs (x[i]) <= 1.0;
+
+           if (central)
+             {
+               for (octave_idx_type i = b; i < b + bn; i++)
+                 r[i] = erf_central (x[i]);
+             }
+           else
+             {
+               for (octave_idx_type i = b; i < b + bn; i++)
+                 r[i] = std::erf (x[i]);
+             }
+         }
+     });
+}
+
+// For erfc the complemented series would lose absolute accuracy to
+// cancellation, so the batch only distributes the libm calls across
+// threads; results are identical to the scalar path.
+
+void
+erfc (const double *x, double *r, octave_idx_type n)
+{
+  chunked_parallel_for
+    (n,
+     [=] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type i = beg; i < beg + len; i++)
+         r[i] = std::erfc (x[i]);
+     });
+}
+
 // The algorithm for erfcinv is an adaptation of the erfinv algorithm
 // above from P. J. Acklam.  It has been modified to run over the
 // different input domain of erfcinv.  See the notes for erfinv for an
@@ -309,6 +309,12 @@ inline float erfc (float x) { return std::erfcf (x); }
 extern OCTAVE_API Complex erfc (const Complex& x);
 extern OCTAVE_API FloatComplex erfc (const FloatComplex& x);
 
+// Batched kernels for real arrays: threaded, with a vectorizable
+// polynomial fast path for the central range.
+
+extern OCTAVE_API void erf (const double *x, double *r, octave_idx_type n);
+extern OCTAVE_API void erfc (const double *x, double *r, octave_idx_type n);
+
 extern OCTAVE_API double erfcinv (double x);
 extern OCTAVE_API float erfcinv (float x);
 
@@ -35,6 +35,7 @@ NUMERIC_INC = \
   %reldir%/fEIG.h \
   %reldir%/gepbalance.h \
   %reldir%/hess.h \
+  %reldir%/kdtree.h \
   %reldir%/lo-amos-proto.h \
   %reldir%/lo-arpack-proto.h \
   %reldir%/lo-blas-proto.h \
@@ -48,12 +49,14 @@ NUMERIC_INC = \
   %reldir%/oct-convn.h \
   %reldir%/oct-fftw.h \
   %reldir%/oct-norm.h \
+  %reldir%/oct-pdist.h \
   %reldir%/oct-rand.h \
   %reldir%/oct-spparms.h \
   %reldir%/qr.h \
   %reldir%/qrp.h \
   %reldir%/randgamma.h \
   %reldir%/randmtzig.h \
+  %reldir%/randphilox.h \
   %reldir%/randpoisson.h \
   %reldir%/schur.h \
   %reldir%/sparse-chol.h \
@@ -78,18 +81,21 @@ NUMERIC_SRC = \
   %reldir%/fEIG.cc \
   %reldir%/gepbalance.cc \
   %reldir%/hess.cc \
+  %reldir%/kdtree.cc \
   %reldir%/lo-mappers.cc \
   %reldir%/lo-specfun.cc \
   %reldir%/lu.cc \
   %reldir%/oct-convn.cc \
   %reldir%/oct-fftw.cc \
   %reldir%/oct-norm.cc \
+  %reldir%/oct-pdist.cc \
   %reldir%/oct-rand.cc \
   %reldir%/oct-spparms.cc \
   %reldir%/qr.cc \
   %reldir%/qrp.cc \
   %reldir%/randgamma.cc \
   %reldir%/randmtzig.cc \
+  %reldir%/randphilox.cc \
   %reldir%/randpoisson.cc \
   %reldir%/schur.cc \
   %reldir%/sparse-chol.cc \
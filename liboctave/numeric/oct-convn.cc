@@ -28,6 +28,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 
 #include "Array.h"
 #include "CColVector.h"
@@ -49,6 +50,8 @@
 #include "fNDArray.h"
 #include "fRowVector.h"
 #include "oct-convn.h"
+#include "oct-parallel.h"
+#include "quit.h"
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
@@ -105,6 +108,57 @@ FORWARD_IMPL (std::complex<double>, double,
 FORWARD_IMPL (std::complex<float>, float, F77_CMPLX, F77_REAL, F77_CMPLX_ARG,
               F77_CONST_CMPLX_ARG,, cs, CS)
 
+// Column-blocked wrapper around the Fortran outer-convolution kernel.
+// Splitting the first array into column blocks keeps the accumulator
+// panel cache-resident for large inputs and exposes parallelism: with
+// a block width of at least NB columns, the output panels of blocks K
+// and K+2 cannot overlap, so even and odd blocks can run as two
+// parallel phases without racing on the shared accumulator.
+
+template <typename T, typename R>
+static void
+convolve_2d_blocked (const T *a, F77_INT ma, F77_INT na,
+                     const R *b, F77_INT mb, F77_INT nb, T *c)
+{
+#if defined (_OPENMP)
+
+  int nthreads = parallel_num_threads ();
+
+  if (nthreads > 1
+      && double (ma) * na * mb * nb >= 4e7)
+    {
+      F77_INT ldc = ma + mb - 1;
+      F77_INT bw = std::max (static_cast<F77_INT> (256),
+                             static_cast<F77_INT> (2) * nb);
+      F77_INT nblocks = (na + bw - 1) / bw;
+
+      if (nblocks > 2)
+        {
+          for (int phase = 0; phase < 2; phase++)
+            {
+#             pragma omp parallel for num_threads (nthreads) \
+                schedule (dynamic)
+              for (F77_INT k = phase; k < nblocks; k += 2)
+                {
+                  F77_INT j0 = k * bw;
+                  F77_INT w = std::min (bw, static_cast<F77_INT> (na - j0));
+
+                  convolve_2d<T, R> (a + static_cast<std::size_t> (ma) * j0,
+                                     ma, w, b, mb, nb,
+                                     c + static_cast<std::size_t> (ldc) * j0,
+                                     false);
+                }
+            }
+
+          return;
+        }
+    }
+
+#endif
+
+  convolve_2d<T, R> (a, ma, na, b, mb, nb, c, false);
+}
+
 template <typename T, typename R>
 void convolve_nd (const T *a, const dim_vector& ad, const dim_vector& acd,
                   const R *b, const dim_vector& bd, const dim_vector& bcd,
@@ -118,7 +172,10 @@ void convolve_nd (const T *a, const dim_vector& ad, const dim_vector& acd,
       F77_INT bd0 = to_f77_int (bd(0));
       F77_INT bd1 = to_f77_int (bd(1));
 
-      convolve_2d<T, R> (a, ad0, ad1, b, bd0, bd1, c, inner);
+      if (inner)
+        convolve_2d<T, R> (a, ad0, ad1, b, bd0, bd1, c, inner);
+      else
+        convolve_2d_blocked<T, R> (a, ad0, ad1, b, bd0, bd1, c);
     }
   else
     {
@@ -146,6 +203,182 @@ void convolve_nd (const T *a, const dim_vector& ad, const dim_vector& acd,
     }
 }
 
+// FFT-based convolution.  The element types are promoted to the
+// complex array type matching their precision so that the transforms
+// of dNDArray and friends (FFTW when available, FFTPACK otherwise)
+// can be reused for every real/complex type combination.
+
+template <typename T> struct convn_fft_traits { };
+
+template <> struct convn_fft_traits<double>
+{ typedef ComplexNDArray array_type; };
+template <> struct convn_fft_traits<Complex>
+{ typedef ComplexNDArray array_type; };
+template <> struct convn_fft_traits<float>
+{ typedef FloatComplexNDArray array_type; };
+template <> struct convn_fft_traits<FloatComplex>
+{ typedef FloatComplexNDArray array_type; };
+
+static inline void conv_add (double& x, const Complex& y)
+{ x += y.real (); }
+static inline void conv_add (Complex& x, const Complex& y)
+{ x += y; }
+static inline void conv_add (float& x, const FloatComplex& y)
+{ x += y.real (); }
+static inline void conv_add (FloatComplex& x, const FloatComplex& y)
+{ x += y; }
+
+// Copy an nd-dimensional slab of SRC into the leading corner of the
+// zero-filled padded buffer DST, promoting the elements.  N_OUTER
+// overrides the extent of the outermost dimension so that blocks of
+// the source can be embedded.
+
+template <typename T, typename CT>
+static void
+convn_embed (const T *src, const dim_vector& sd, const dim_vector& scd,
+             CT *dst, const dim_vector& dcd, int nd,
+             octave_idx_type n_outer)
+{
+  if (nd == 1)
+    {
+      for (octave_idx_type i = 0; i < n_outer; i++)
+        dst[i] = src[i];
+    }
+  else
+    {
+      for (octave_idx_type j = 0; j < n_outer; j++)
+        convn_embed (src + scd(nd-2)*j, sd, scd,
+                     dst + dcd(nd-2)*j, dcd, nd-1, sd(nd-2));
+    }
+}
+
+// Add an nd-dimensional block result to the accumulator, demoting the
+// elements (dropping the imaginary part for real outputs).
+
+template <typename CT, typename T>
+static void
+convn_accumulate (const CT *src, const dim_vector& scd,
+                  T *dst, const dim_vector& dd, const dim_vector& dcd,
+                  int nd, octave_idx_type n_outer)
+{
+  if (nd == 1)
+    {
+      for (octave_idx_type i = 0; i < n_outer; i++)
+        conv_add (dst[i], src[i]);
+    }
+  else
+    {
+      for (octave_idx_type j = 0; j < n_outer; j++)
+        convn_accumulate (src + scd(nd-2)*j, scd,
+                          dst + dcd(nd-2)*j, dd, dcd, nd-1, dd(nd-2));
+    }
+}
+
+// Overlap-add FFT convolution producing the full-shape result: the
+// first array is split into blocks along its last dimension, each
+// zero-padded block is convolved with the (pre-transformed) kernel in
+// the frequency domain, and the block results are accumulated into
+// the output at their block offsets.  Blocking bounds the workspace
+// for arbitrarily long inputs.  The blocks are processed serially
+// because the FFT planner caches are not safe to mutate concurrently;
+// the transforms themselves are threaded by FFTW when enabled.
+
+template <typename T, typename R>
+static MArray<T>
+fft_convolve (const MArray<T>& a, const dim_vector& ad,
+              const MArray<R>& b, const dim_vector& bd, int nd)
+{
+  typedef typename convn_fft_traits<T>::array_type fft_array_type;
+  typedef typename fft_array_type::element_type ct;
+
+  dim_vector fd = dim_vector::alloc (nd);
+
+  for (int i = 0; i < nd; i++)
+    fd(i) = ad(i) + bd(i) - 1;
+
+  octave_idx_type al = ad(nd-1);
+  octave_idx_type bl = bd(nd-1);
+
+  // Block length along the last dimension.
+  octave_idx_type len = std::max (static_cast<octave_idx_type> (64), 4*bl);
+  if (len > al)
+    len = al;
+
+  dim_vector pd = dim_vector::alloc (nd);
+
+  for (int i = 0; i < nd-1; i++)
+    pd(i) = fd(i);
+  pd(nd-1) = len + bl - 1;
+
+  const dim_vector acd = ad.cumulative ();
+  const dim_vector pcd = pd.cumulative ();
+  const dim_vector fcd = fd.cumulative ();
+
+  // Transform of the zero-padded kernel, computed once.
+  fft_array_type bpad (pd, ct ());
+  convn_embed (b.data (), bd, bd.cumulative (),
+               bpad.fortran_vec (), pcd, nd, bl);
+  fft_array_type bhat = bpad.fourierNd ();
+  const ct *bhat_vec = bhat.data ();
+
+  MArray<T> c (fd, T ());
+  T *cvec = c.fortran_vec ();
+
+  octave_idx_type nblocks = (al + len - 1) / len;
+  octave_idx_type pnumel = pd.numel ();
+
+  for (octave_idx_type k = 0; k < nblocks; k++)
+    {
+      octave_idx_type beg = k * len;
+      octave_idx_type blen = std::min (len, al - beg);
+
+      fft_array_type apad (pd, ct ());
+      convn_embed (a.data () + acd(nd-2)*beg, ad, acd,
+                   apad.fortran_vec (), pcd, nd, blen);
+
+      fft_array_type ahat = apad.fourierNd ();
+      ct *ahat_vec = ahat.fortran_vec ();
+
+      for (octave_idx_type i = 0; i < pnumel; i++)
+        ahat_vec[i] *= bhat_vec[i];
+
+      fft_array_type cblk = ahat.ifourierNd ();
+
+      convn_accumulate (cblk.data (), pcd,
+                        cvec + fcd(nd-2)*beg, fd, fcd, nd, blen + bl - 1);
+
+      octave_quit ();
+    }
+
+  return c;
+}
+
+// Decide between the direct kernels and the overlap-add FFT engine.
+// Direct convolution costs one multiply-add per kernel element per
+// output element; the FFT engine costs a few transforms of the padded
+// result.  The constant absorbs the promotion to complex and the
+// workspace traffic, so the FFT only takes over when it wins clearly.
+
+static bool
+convn_use_fft (const dim_vector& ad, const dim_vector& bd, int nd)
+{
+  double bnumel = 1.0;
+  double fnumel = 1.0;
+
+  for (int i = 0; i < nd; i++)
+    {
+      // Shape handling for kernels larger than the array stays with
+      // the direct code.
+      if (bd(i) > ad(i))
+        return false;
+
+      bnumel *= bd(i);
+      fnumel *= ad(i) + bd(i) - 1;
+    }
+
+  return bnumel >= std::max (256.0, 40.0 * std::log2 (fnumel));
+}
+
 // Arbitrary convolutor.
 // The 2nd array is assumed to be the smaller one.
 template <typename T, typename R>
@@ -171,6 +404,28 @@ convolve (const MArray<T>& a, const MArray<R>& b,
                              static_cast<octave_idx_type> (0));
     }
 
+  if (convn_use_fft (adims, bdims, nd))
+    {
+      MArray<T> c = fft_convolve<T, R> (a, adims, b, bdims, nd);
+
+      if (ct == convn_full)
+        return c;
+
+      // Pick the relevant part of the full result.
+      Array<idx_vector> sidx (dim_vector (nd, 1));
+
+      for (int i = 0; i < nd; i++)
+        {
+          if (ct == convn_same)
+            sidx(i) = idx_vector::make_range (bdims(i)/2, 1, adims(i));
+          else
+            sidx(i) = idx_vector::make_range (bdims(i)-1, 1,
+                                              adims(i) - bdims(i) + 1);
+        }
+
+      return c.index (sidx);
+    }
+
   MArray<T> c (cdims, T ());
 
   // "valid" shape can sometimes result in empty matrices which must avoid
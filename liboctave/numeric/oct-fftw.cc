@@ -31,7 +31,9 @@
 #  include <fftw3.h>
 #endif
 
+#include "file-ops.h"
 #include "lo-error.h"
+#include "oct-env.h"
 #include "oct-fftw.h"
 #include "oct-locbuf.h"
 #include "quit.h"
@@ -65,16 +67,56 @@ fftw_planner *fftw_planner::s_instance = nullptr;
 
 // Note that it is profitable to store the FFTW3 plans, for small FFTs.
 
-fftw_planner::fftw_planner ()
-  : m_meth (ESTIMATE), m_rplan (nullptr), m_rd (0), m_rs (0), m_rr (0),
-    m_rh (0), m_rn (), m_rsimd_align (false), m_nthreads (1)
+// Per-host wisdom cache file.  Wisdom accumulated while planning is
+// exported when a planner is destroyed and imported again by the next
+// session, so measured plans survive interpreter restarts.
+
+static std::string
+wisdom_cache_file (bool single_precision)
+{
+  std::string dir = sys::env::getenv ("OCTAVE_FFTW_WISDOM_DIR");
+
+  if (dir.empty ())
+    {
+      dir = sys::env::getenv ("XDG_CACHE_HOME");
+
+      if (dir.empty ())
+        {
+          std::string home = sys::env::get_home_directory ();
+
+          if (home.empty ())
+            return "";
+
+          dir = home + sys::file_ops::dir_sep_str () + ".cache";
+        }
+
+      dir += sys::file_ops::dir_sep_str () + "octave";
+    }
+
+  std::string host = sys::env::get_host_name ();
+
+  if (host.empty ())
+    host = "localhost";
+
+  return (dir + sys::file_ops::dir_sep_str () + "fftw-wisdom-" + host
+          + (single_precision ? "-single" : "") + ".dat");
+}
+
+static void
+prepare_wisdom_cache_dir (const std::string& file)
 {
-  m_plan[0] = m_plan[1] = nullptr;
-  m_d[0] = m_d[1] = m_s[0] = m_s[1] = m_r[0] = m_r[1] = m_h[0] = m_h[1] = 0;
-  m_simd_align[0] = m_simd_align[1] = false;
-  m_inplace[0] = m_inplace[1] = false;
-  m_n[0] = m_n[1] = dim_vector ();
+  std::size_t pos = file.find_last_of (sys::file_ops::dir_sep_chars ());
 
+  if (pos != std::string::npos)
+    {
+      std::string msg;
+      sys::recursive_mkdir (file.substr (0, pos), 0777, msg);
+    }
+}
+
+fftw_planner::fftw_planner ()
+  : m_meth (ESTIMATE), m_plans (), m_nthreads (1)
+{
 #if defined (HAVE_FFTW3_THREADS)
   int init_ret = fftw_init_threads ();
   if (! init_ret)
@@ -95,23 +137,24 @@ fftw_planner::fftw_planner ()
 
   // If we have a system wide wisdom file, import it.
   fftw_import_system_wisdom ();
+
+  // Then layer any wisdom cached by previous sessions on top of it.
+  std::string wisdom = wisdom_cache_file (false);
+  if (! wisdom.empty ())
+    fftw_import_wisdom_from_filename (wisdom.c_str ());
 }
 
 fftw_planner::~fftw_planner ()
 {
-  fftw_plan *plan_p;
-
-  plan_p = reinterpret_cast<fftw_plan *> (&m_rplan);
-  if (*plan_p)
-    fftw_destroy_plan (*plan_p);
-
-  plan_p = reinterpret_cast<fftw_plan *> (&m_plan[0]);
-  if (*plan_p)
-    fftw_destroy_plan (*plan_p);
+  std::string wisdom = wisdom_cache_file (false);
+  if (! wisdom.empty ())
+    {
+      prepare_wisdom_cache_dir (wisdom);
+      fftw_export_wisdom_to_filename (wisdom.c_str ());
+    }
 
-  plan_p = reinterpret_cast<fftw_plan *> (&m_plan[1]);
-  if (*plan_p)
-    fftw_destroy_plan (*plan_p);
+  for (auto& rec : m_plans)
+    fftw_destroy_plan (reinterpret_cast<fftw_plan> (rec.plan));
 }
 
 bool
@@ -136,9 +179,11 @@ fftw_planner::threads (int nt)
     {
       s_instance->m_nthreads = nt;
       fftw_plan_with_nthreads (nt);
-      // Clear the current plans.
-      s_instance->m_rplan = nullptr;
-      s_instance->m_plan[0] = s_instance->m_plan[1] = nullptr;
+      // Discard the cached plans; they were created for the old
+      // thread count.
+      for (auto& rec : s_instance->m_plans)
+        fftw_destroy_plan (reinterpret_cast<fftw_plan> (rec.plan));
+      s_instance->m_plans.clear ();
     }
 #else
   octave_unused_parameter (nt);
@@ -159,121 +204,131 @@ fftw_planner::do_create_plan (int dir, const int rank,
                               octave_idx_type dist,
                               const Complex *in, Complex *out)
 {
-  int which = (dir == FFTW_FORWARD) ? 0 : 1;
-  fftw_plan *cur_plan_p = reinterpret_cast<fftw_plan *> (&m_plan[which]);
-  bool create_new_plan = false;
   bool ioalign = CHECK_SIMD_ALIGNMENT (in) && CHECK_SIMD_ALIGNMENT (out);
   bool ioinplace = (in == out);
 
-  // Don't create a new plan if we have a non SIMD plan already but
-  // can do SIMD.  This prevents endlessly recreating plans if we
-  // change the alignment.
+  // Look for a cached plan matching this transform geometry.  Reuse a
+  // non SIMD plan even if we could do SIMD.  This prevents endlessly
+  // recreating plans if we change the alignment.
 
-  if (m_plan[which] == nullptr || m_d[which] != dist || m_s[which] != stride
-      || m_r[which] != rank || m_h[which] != howmany
-      || ioinplace != m_inplace[which]
-      || ((ioalign != m_simd_align[which]) ? ! ioalign : false))
-    create_new_plan = true;
-  else
+  for (auto it = m_plans.begin (); it != m_plans.end (); ++it)
     {
+      if (it->dir != dir || it->dist != dist || it->stride != stride
+          || it->rank != rank || it->howmany != howmany
+          || it->inplace != ioinplace
+          || (it->simd_align && ! ioalign))
+        continue;
+
       // We still might not have the same shape of array.
 
+      bool match = true;
+
       for (int i = 0; i < rank; i++)
-        if (dims(i) != m_n[which](i))
+        if (dims(i) != it->dims(i))
           {
-            create_new_plan = true;
+            match = false;
             break;
           }
-    }
 
-  if (create_new_plan)
-    {
-      m_d[which] = dist;
-      m_s[which] = stride;
-      m_r[which] = rank;
-      m_h[which] = howmany;
-      m_simd_align[which] = ioalign;
-      m_inplace[which] = ioinplace;
-      m_n[which] = dims;
-
-      // Note reversal of dimensions for column major storage in FFTW.
-      octave_idx_type nn = 1;
-      OCTAVE_LOCAL_BUFFER (int, tmp, rank);
-
-      for (int i = 0, j = rank-1; i < rank; i++, j--)
+      if (match)
         {
-          tmp[i] = dims(j);
-          nn *= dims(j);
+          // Move to the front so frequently used plans stay cached.
+          m_plans.splice (m_plans.begin (), m_plans, it);
+          return it->plan;
         }
+    }
+
+  // Note reversal of dimensions for column major storage in FFTW.
+  octave_idx_type nn = 1;
+  OCTAVE_LOCAL_BUFFER (int, tmp, rank);
+
+  for (int i = 0, j = rank-1; i < rank; i++, j--)
+    {
+      tmp[i] = dims(j);
+      nn *= dims(j);
+    }
 
-      int plan_flags = 0;
-      bool plan_destroys_in = true;
+  int plan_flags = 0;
+  bool plan_destroys_in = true;
 
-      switch (m_meth)
+  switch (m_meth)
+    {
+    case UNKNOWN:
+    case ESTIMATE:
+      plan_flags |= FFTW_ESTIMATE;
+      plan_destroys_in = false;
+      break;
+    case MEASURE:
+      plan_flags |= FFTW_MEASURE;
+      break;
+    case PATIENT:
+      plan_flags |= FFTW_PATIENT;
+      break;
+    case EXHAUSTIVE:
+      plan_flags |= FFTW_EXHAUSTIVE;
+      break;
+    case HYBRID:
+      if (nn < 8193)
+        plan_flags |= FFTW_MEASURE;
+      else
         {
-        case UNKNOWN:
-        case ESTIMATE:
           plan_flags |= FFTW_ESTIMATE;
           plan_destroys_in = false;
-          break;
-        case MEASURE:
-          plan_flags |= FFTW_MEASURE;
-          break;
-        case PATIENT:
-          plan_flags |= FFTW_PATIENT;
-          break;
-        case EXHAUSTIVE:
-          plan_flags |= FFTW_EXHAUSTIVE;
-          break;
-        case HYBRID:
-          if (nn < 8193)
-            plan_flags |= FFTW_MEASURE;
-          else
-            {
-              plan_flags |= FFTW_ESTIMATE;
-              plan_destroys_in = false;
-            }
-          break;
         }
+      break;
+    }
 
-      if (ioalign)
-        plan_flags &= ~FFTW_UNALIGNED;
-      else
-        plan_flags |= FFTW_UNALIGNED;
+  if (ioalign)
+    plan_flags &= ~FFTW_UNALIGNED;
+  else
+    plan_flags |= FFTW_UNALIGNED;
 
-      if (*cur_plan_p)
-        fftw_destroy_plan (*cur_plan_p);
+#if defined (HAVE_FFTW3_THREADS)
+  // Threading only pays off for large transforms; plan small ones
+  // single-threaded to avoid the synchronization overhead.
+  fftw_plan_with_nthreads (nn * howmany >= 65536 ? m_nthreads : 1);
+#endif
 
-      if (plan_destroys_in)
-        {
-          // Create matrix with the same size and 16-byte alignment as input
-          OCTAVE_LOCAL_BUFFER (Complex, itmp, nn * howmany + 32);
-          itmp = reinterpret_cast<Complex *>
-                 (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
-                  ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
-
-          *cur_plan_p
-            = fftw_plan_many_dft (rank, tmp, howmany,
-                                  reinterpret_cast<fftw_complex *> (itmp),
-                                  nullptr, stride, dist,
-                                  reinterpret_cast<fftw_complex *> (out),
-                                  nullptr, stride, dist, dir, plan_flags);
-        }
-      else
-        {
-          *cur_plan_p
-            = fftw_plan_many_dft (rank, tmp, howmany,
-                                  reinterpret_cast<fftw_complex *> (const_cast<Complex *> (in)),
-                                  nullptr, stride, dist,
-                                  reinterpret_cast<fftw_complex *> (out),
-                                  nullptr, stride, dist, dir, plan_flags);
-        }
+  fftw_plan plan;
+
+  if (plan_destroys_in)
+    {
+      // Create matrix with the same size and 16-byte alignment as input
+      OCTAVE_LOCAL_BUFFER (Complex, itmp, nn * howmany + 32);
+      itmp = reinterpret_cast<Complex *>
+             (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
+              ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
+
+      plan
+        = fftw_plan_many_dft (rank, tmp, howmany,
+                              reinterpret_cast<fftw_complex *> (itmp),
+                              nullptr, stride, dist,
+                              reinterpret_cast<fftw_complex *> (out),
+                              nullptr, stride, dist, dir, plan_flags);
+    }
+  else
+    {
+      plan
+        = fftw_plan_many_dft (rank, tmp, howmany,
+                              reinterpret_cast<fftw_complex *> (const_cast<Complex *> (in)),
+                              nullptr, stride, dist,
+                              reinterpret_cast<fftw_complex *> (out),
+                              nullptr, stride, dist, dir, plan_flags);
+    }
+
+  if (plan == nullptr)
+    (*current_liboctave_error_handler) ("Error creating FFTW plan");
 
-      if (*cur_plan_p == nullptr)
-        (*current_liboctave_error_handler) ("Error creating FFTW plan");
+  m_plans.push_front ({ plan, dir, rank, dims, howmany, stride, dist,
+                        ioalign, ioinplace });
+
+  while (m_plans.size () > std::size_t (MAX_CACHED_PLANS))
+    {
+      fftw_destroy_plan (reinterpret_cast<fftw_plan> (m_plans.back ().plan));
+      m_plans.pop_back ();
     }
 
-  return *cur_plan_p;
+  return plan;
 }
 
 void *
@@ -283,115 +338,127 @@ fftw_planner::do_create_plan (const int rank, const dim_vector& dims,
                               octave_idx_type dist,
                               const double *in, Complex *out)
 {
-  fftw_plan *cur_plan_p = reinterpret_cast<fftw_plan *> (&m_rplan);
-  bool create_new_plan = false;
   bool ioalign = CHECK_SIMD_ALIGNMENT (in) && CHECK_SIMD_ALIGNMENT (out);
 
-  // Don't create a new plan if we have a non SIMD plan already but
-  // can do SIMD.  This prevents endlessly recreating plans if we
-  // change the alignment.
+  // Real-to-complex plans are cached with DIR set to zero so they
+  // never collide with the complex plans above.
 
-  if (m_rplan == nullptr || m_rd != dist || m_rs != stride || m_rr != rank
-      || m_rh != howmany || ((ioalign != m_rsimd_align) ? ! ioalign : false))
-    create_new_plan = true;
-  else
+  for (auto it = m_plans.begin (); it != m_plans.end (); ++it)
     {
+      if (it->dir != 0 || it->dist != dist || it->stride != stride
+          || it->rank != rank || it->howmany != howmany
+          || (it->simd_align && ! ioalign))
+        continue;
+
       // We still might not have the same shape of array.
 
+      bool match = true;
+
       for (int i = 0; i < rank; i++)
-        if (dims(i) != m_rn(i))
+        if (dims(i) != it->dims(i))
           {
-            create_new_plan = true;
+            match = false;
             break;
           }
-    }
 
-  if (create_new_plan)
-    {
-      m_rd = dist;
-      m_rs = stride;
-      m_rr = rank;
-      m_rh = howmany;
-      m_rsimd_align = ioalign;
-      m_rn = dims;
-
-      // Note reversal of dimensions for column major storage in FFTW.
-      octave_idx_type nn = 1;
-      OCTAVE_LOCAL_BUFFER (int, tmp, rank);
-
-      for (int i = 0, j = rank-1; i < rank; i++, j--)
+      if (match)
         {
-          tmp[i] = dims(j);
-          nn *= dims(j);
+          // Move to the front so frequently used plans stay cached.
+          m_plans.splice (m_plans.begin (), m_plans, it);
+          return it->plan;
         }
+    }
 
-      int plan_flags = 0;
-      bool plan_destroys_in = true;
+  // Note reversal of dimensions for column major storage in FFTW.
+  octave_idx_type nn = 1;
+  OCTAVE_LOCAL_BUFFER (int, tmp, rank);
+
+  for (int i = 0, j = rank-1; i < rank; i++, j--)
+    {
+      tmp[i] = dims(j);
+      nn *= dims(j);
+    }
 
-      switch (m_meth)
+  int plan_flags = 0;
+  bool plan_destroys_in = true;
+
+  switch (m_meth)
+    {
+    case UNKNOWN:
+    case ESTIMATE:
+      plan_flags |= FFTW_ESTIMATE;
+      plan_destroys_in = false;
+      break;
+    case MEASURE:
+      plan_flags |= FFTW_MEASURE;
+      break;
+    case PATIENT:
+      plan_flags |= FFTW_PATIENT;
+      break;
+    case EXHAUSTIVE:
+      plan_flags |= FFTW_EXHAUSTIVE;
+      break;
+    case HYBRID:
+      if (nn < 8193)
+        plan_flags |= FFTW_MEASURE;
+      else
         {
-        case UNKNOWN:
-        case ESTIMATE:
           plan_flags |= FFTW_ESTIMATE;
           plan_destroys_in = false;
-          break;
-        case MEASURE:
-          plan_flags |= FFTW_MEASURE;
-          break;
-        case PATIENT:
-          plan_flags |= FFTW_PATIENT;
-          break;
-        case EXHAUSTIVE:
-          plan_flags |= FFTW_EXHAUSTIVE;
-          break;
-        case HYBRID:
-          if (nn < 8193)
-            plan_flags |= FFTW_MEASURE;
-          else
-            {
-              plan_flags |= FFTW_ESTIMATE;
-              plan_destroys_in = false;
-            }
-          break;
         }
+      break;
+    }
 
-      if (ioalign)
-        plan_flags &= ~FFTW_UNALIGNED;
-      else
-        plan_flags |= FFTW_UNALIGNED;
+  if (ioalign)
+    plan_flags &= ~FFTW_UNALIGNED;
+  else
+    plan_flags |= FFTW_UNALIGNED;
 
-      if (*cur_plan_p)
-        fftw_destroy_plan (*cur_plan_p);
+#if defined (HAVE_FFTW3_THREADS)
+  // Threading only pays off for large transforms; plan small ones
+  // single-threaded to avoid the synchronization overhead.
+  fftw_plan_with_nthreads (nn * howmany >= 65536 ? m_nthreads : 1);
+#endif
 
-      if (plan_destroys_in)
-        {
-          // Create matrix with the same size and 16-byte alignment as input
-          OCTAVE_LOCAL_BUFFER (double, itmp, nn + 32);
-          itmp = reinterpret_cast<double *>
-                 (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
-                  ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
-
-          *cur_plan_p
-            = fftw_plan_many_dft_r2c (rank, tmp, howmany, itmp,
-                                      nullptr, stride, dist,
-                                      reinterpret_cast<fftw_complex *> (out),
-                                      nullptr, stride, dist, plan_flags);
-        }
-      else
-        {
-          *cur_plan_p
-            = fftw_plan_many_dft_r2c (rank, tmp, howmany,
-                                      (const_cast<double *> (in)),
-                                      nullptr, stride, dist,
-                                      reinterpret_cast<fftw_complex *> (out),
-                                      nullptr, stride, dist, plan_flags);
-        }
+  fftw_plan plan;
+
+  if (plan_destroys_in)
+    {
+      // Create matrix with the same size and 16-byte alignment as input
+      OCTAVE_LOCAL_BUFFER (double, itmp, nn + 32);
+      itmp = reinterpret_cast<double *>
+             (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
+              ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
+
+      plan
+        = fftw_plan_many_dft_r2c (rank, tmp, howmany, itmp,
+                                  nullptr, stride, dist,
+                                  reinterpret_cast<fftw_complex *> (out),
+                                  nullptr, stride, dist, plan_flags);
+    }
+  else
+    {
+      plan
+        = fftw_plan_many_dft_r2c (rank, tmp, howmany,
+                                  (const_cast<double *> (in)),
+                                  nullptr, stride, dist,
+                                  reinterpret_cast<fftw_complex *> (out),
+                                  nullptr, stride, dist, plan_flags);
+    }
+
+  if (plan == nullptr)
+    (*current_liboctave_error_handler) ("Error creating FFTW plan");
 
-      if (*cur_plan_p == nullptr)
-        (*current_liboctave_error_handler) ("Error creating FFTW plan");
+  m_plans.push_front ({ plan, 0, rank, dims, howmany, stride, dist,
+                        ioalign, false });
+
+  while (m_plans.size () > std::size_t (MAX_CACHED_PLANS))
+    {
+      fftw_destroy_plan (reinterpret_cast<fftw_plan> (m_plans.back ().plan));
+      m_plans.pop_back ();
     }
 
-  return *cur_plan_p;
+  return plan;
 }
 
 fftw_planner::FftwMethod
@@ -411,13 +478,9 @@ fftw_planner::do_method (FftwMethod _meth)
       if (m_meth != _meth)
         {
           m_meth = _meth;
-          if (m_rplan)
-            fftw_destroy_plan (reinterpret_cast<fftw_plan> (m_rplan));
-          if (m_plan[0])
-            fftw_destroy_plan (reinterpret_cast<fftw_plan> (m_plan[0]));
-          if (m_plan[1])
-            fftw_destroy_plan (reinterpret_cast<fftw_plan> (m_plan[1]));
-          m_rplan = m_plan[0] = m_plan[1] = nullptr;
+          for (auto& rec : m_plans)
+            fftw_destroy_plan (reinterpret_cast<fftw_plan> (rec.plan));
+          m_plans.clear ();
         }
     }
   else
@@ -428,15 +491,8 @@ fftw_planner::do_method (FftwMethod _meth)
 float_fftw_planner *float_fftw_planner::s_instance = nullptr;
 
 float_fftw_planner::float_fftw_planner ()
-  : m_meth (ESTIMATE), m_rplan (nullptr), m_rd (0), m_rs (0), m_rr (0),
-    m_rh (0), m_rn (), m_rsimd_align (false), m_nthreads (1)
+  : m_meth (ESTIMATE), m_plans (), m_nthreads (1)
 {
-  m_plan[0] = m_plan[1] = nullptr;
-  m_d[0] = m_d[1] = m_s[0] = m_s[1] = m_r[0] = m_r[1] = m_h[0] = m_h[1] = 0;
-  m_simd_align[0] = m_simd_align[1] = false;
-  m_inplace[0] = m_inplace[1] = false;
-  m_n[0] = m_n[1] = dim_vector ();
-
 #if defined (HAVE_FFTW3F_THREADS)
   int init_ret = fftwf_init_threads ();
   if (! init_ret)
@@ -452,23 +508,24 @@ float_fftw_planner::float_fftw_planner ()
 
   // If we have a system wide wisdom file, import it.
   fftwf_import_system_wisdom ();
+
+  // Then layer any wisdom cached by previous sessions on top of it.
+  std::string wisdom = wisdom_cache_file (true);
+  if (! wisdom.empty ())
+    fftwf_import_wisdom_from_filename (wisdom.c_str ());
 }
 
 float_fftw_planner::~float_fftw_planner ()
 {
-  fftwf_plan *plan_p;
-
-  plan_p = reinterpret_cast<fftwf_plan *> (&m_rplan);
-  if (*plan_p)
-    fftwf_destroy_plan (*plan_p);
-
-  plan_p = reinterpret_cast<fftwf_plan *> (&m_plan[0]);
-  if (*plan_p)
-    fftwf_destroy_plan (*plan_p);
+  std::string wisdom = wisdom_cache_file (true);
+  if (! wisdom.empty ())
+    {
+      prepare_wisdom_cache_dir (wisdom);
+      fftwf_export_wisdom_to_filename (wisdom.c_str ());
+    }
 
-  plan_p = reinterpret_cast<fftwf_plan *> (&m_plan[1]);
-  if (*plan_p)
-    fftwf_destroy_plan (*plan_p);
+  for (auto& rec : m_plans)
+    fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (rec.plan));
 }
 
 bool
@@ -493,9 +550,11 @@ float_fftw_planner::threads (int nt)
     {
       s_instance->m_nthreads = nt;
       fftwf_plan_with_nthreads (nt);
-      // Clear the current plans.
-      s_instance->m_rplan = nullptr;
-      s_instance->m_plan[0] = s_instance->m_plan[1] = nullptr;
+      // Discard the cached plans; they were created for the old
+      // thread count.
+      for (auto& rec : s_instance->m_plans)
+        fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (rec.plan));
+      s_instance->m_plans.clear ();
     }
 #else
   octave_unused_parameter (nt);
@@ -514,121 +573,129 @@ float_fftw_planner::do_create_plan (int dir, const int rank,
                                     const FloatComplex *in,
                                     FloatComplex *out)
 {
-  int which = (dir == FFTW_FORWARD) ? 0 : 1;
-  fftwf_plan *cur_plan_p = reinterpret_cast<fftwf_plan *> (&m_plan[which]);
-  bool create_new_plan = false;
   bool ioalign = CHECK_SIMD_ALIGNMENT (in) && CHECK_SIMD_ALIGNMENT (out);
   bool ioinplace = (in == out);
 
-  // Don't create a new plan if we have a non SIMD plan already but
-  // can do SIMD.  This prevents endlessly recreating plans if we
-  // change the alignment.
+  // Look for a cached plan matching this transform geometry.  Reuse a
+  // non SIMD plan even if we could do SIMD.  This prevents endlessly
+  // recreating plans if we change the alignment.
 
-  if (m_plan[which] == nullptr || m_d[which] != dist || m_s[which] != stride
-      || m_r[which] != rank || m_h[which] != howmany
-      || ioinplace != m_inplace[which]
-      || ((ioalign != m_simd_align[which]) ? ! ioalign : false))
-    create_new_plan = true;
-  else
+  for (auto it = m_plans.begin (); it != m_plans.end (); ++it)
     {
+      if (it->dir != dir || it->dist != dist || it->stride != stride
+          || it->rank != rank || it->howmany != howmany
+          || it->inplace != ioinplace
+          || (it->simd_align && ! ioalign))
+        continue;
+
       // We still might not have the same shape of array.
 
+      bool match = true;
+
       for (int i = 0; i < rank; i++)
-        if (dims(i) != m_n[which](i))
+        if (dims(i) != it->dims(i))
           {
-            create_new_plan = true;
+            match = false;
             break;
           }
-    }
 
-  if (create_new_plan)
-    {
-      m_d[which] = dist;
-      m_s[which] = stride;
-      m_r[which] = rank;
-      m_h[which] = howmany;
-      m_simd_align[which] = ioalign;
-      m_inplace[which] = ioinplace;
-      m_n[which] = dims;
-
-      // Note reversal of dimensions for column major storage in FFTW.
-      octave_idx_type nn = 1;
-      OCTAVE_LOCAL_BUFFER (int, tmp, rank);
-
-      for (int i = 0, j = rank-1; i < rank; i++, j--)
+      if (match)
         {
-          tmp[i] = dims(j);
-          nn *= dims(j);
+          // Move to the front so frequently used plans stay cached.
+          m_plans.splice (m_plans.begin (), m_plans, it);
+          return it->plan;
         }
+    }
+
+  // Note reversal of dimensions for column major storage in FFTW.
+  octave_idx_type nn = 1;
+  OCTAVE_LOCAL_BUFFER (int, tmp, rank);
+
+  for (int i = 0, j = rank-1; i < rank; i++, j--)
+    {
+      tmp[i] = dims(j);
+      nn *= dims(j);
+    }
 
-      int plan_flags = 0;
-      bool plan_destroys_in = true;
+  int plan_flags = 0;
+  bool plan_destroys_in = true;
 
-      switch (m_meth)
+  switch (m_meth)
+    {
+    case UNKNOWN:
+    case ESTIMATE:
+      plan_flags |= FFTW_ESTIMATE;
+      plan_destroys_in = false;
+      break;
+    case MEASURE:
+      plan_flags |= FFTW_MEASURE;
+      break;
+    case PATIENT:
+      plan_flags |= FFTW_PATIENT;
+      break;
+    case EXHAUSTIVE:
+      plan_flags |= FFTW_EXHAUSTIVE;
+      break;
+    case HYBRID:
+      if (nn < 8193)
+        plan_flags |= FFTW_MEASURE;
+      else
         {
-        case UNKNOWN:
-        case ESTIMATE:
           plan_flags |= FFTW_ESTIMATE;
           plan_destroys_in = false;
-          break;
-        case MEASURE:
-          plan_flags |= FFTW_MEASURE;
-          break;
-        case PATIENT:
-          plan_flags |= FFTW_PATIENT;
-          break;
-        case EXHAUSTIVE:
-          plan_flags |= FFTW_EXHAUSTIVE;
-          break;
-        case HYBRID:
-          if (nn < 8193)
-            plan_flags |= FFTW_MEASURE;
-          else
-            {
-              plan_flags |= FFTW_ESTIMATE;
-              plan_destroys_in = false;
-            }
-          break;
         }
+      break;
+    }
 
-      if (ioalign)
-        plan_flags &= ~FFTW_UNALIGNED;
-      else
-        plan_flags |= FFTW_UNALIGNED;
+  if (ioalign)
+    plan_flags &= ~FFTW_UNALIGNED;
+  else
+    plan_flags |= FFTW_UNALIGNED;
 
-      if (*cur_plan_p)
-        fftwf_destroy_plan (*cur_plan_p);
+#if defined (HAVE_FFTW3F_THREADS)
+  fftwf_plan_with_nthreads (nn * howmany >= 65536 ? m_nthreads : 1);
+#endif
 
-      if (plan_destroys_in)
-        {
-          // Create matrix with the same size and 16-byte alignment as input
-          OCTAVE_LOCAL_BUFFER (FloatComplex, itmp, nn * howmany + 32);
-          itmp = reinterpret_cast<FloatComplex *>
-                 (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
-                  ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
-
-          *cur_plan_p
-            = fftwf_plan_many_dft (rank, tmp, howmany,
-                                   reinterpret_cast<fftwf_complex *> (itmp),
-                                   nullptr, stride, dist,
-                                   reinterpret_cast<fftwf_complex *> (out),
-                                   nullptr, stride, dist, dir, plan_flags);
-        }
-      else
-        {
-          *cur_plan_p
-            = fftwf_plan_many_dft (rank, tmp, howmany,
-                                   reinterpret_cast<fftwf_complex *> (const_cast<FloatComplex *> (in)),
-                                   nullptr, stride, dist,
-                                   reinterpret_cast<fftwf_complex *> (out),
-                                   nullptr, stride, dist, dir, plan_flags);
-        }
+  fftwf_plan plan;
 
-      if (*cur_plan_p == nullptr)
-        (*current_liboctave_error_handler) ("Error creating FFTW plan");
+  if (plan_destroys_in)
+    {
+      // Create matrix with the same size and 16-byte alignment as input
+      OCTAVE_LOCAL_BUFFER (FloatComplex, itmp, nn * howmany + 32);
+      itmp = reinterpret_cast<FloatComplex *>
+             (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
+              ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
+
+      plan
+        = fftwf_plan_many_dft (rank, tmp, howmany,
+                               reinterpret_cast<fftwf_complex *> (itmp),
+                               nullptr, stride, dist,
+                               reinterpret_cast<fftwf_complex *> (out),
+                               nullptr, stride, dist, dir, plan_flags);
+    }
+  else
+    {
+      plan
+        = fftwf_plan_many_dft (rank, tmp, howmany,
+                               reinterpret_cast<fftwf_complex *> (const_cast<FloatComplex *> (in)),
+                               nullptr, stride, dist,
+                               reinterpret_cast<fftwf_complex *> (out),
+                               nullptr, stride, dist, dir, plan_flags);
     }
 
-  return *cur_plan_p;
+  if (plan == nullptr)
+    (*current_liboctave_error_handler) ("Error creating FFTW plan");
+
+  m_plans.push_front ({ plan, dir, rank, dims, howmany, stride, dist,
+                        ioalign, ioinplace });
+
+  while (m_plans.size () > std::size_t (MAX_CACHED_PLANS))
+    {
+      fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (m_plans.back ().plan));
+      m_plans.pop_back ();
+    }
+
+  return plan;
 }
 
 void *
@@ -638,115 +705,125 @@ float_fftw_planner::do_create_plan (const int rank, const dim_vector& dims,
                                     octave_idx_type dist,
                                     const float *in, FloatComplex *out)
 {
-  fftwf_plan *cur_plan_p = reinterpret_cast<fftwf_plan *> (&m_rplan);
-  bool create_new_plan = false;
   bool ioalign = CHECK_SIMD_ALIGNMENT (in) && CHECK_SIMD_ALIGNMENT (out);
 
-  // Don't create a new plan if we have a non SIMD plan already but
-  // can do SIMD.  This prevents endlessly recreating plans if we
-  // change the alignment.
+  // Real-to-complex plans are cached with DIR set to zero so they
+  // never collide with the complex plans above.
 
-  if (m_rplan == nullptr || m_rd != dist || m_rs != stride || m_rr != rank
-      || m_rh != howmany || ((ioalign != m_rsimd_align) ? ! ioalign : false))
-    create_new_plan = true;
-  else
+  for (auto it = m_plans.begin (); it != m_plans.end (); ++it)
     {
+      if (it->dir != 0 || it->dist != dist || it->stride != stride
+          || it->rank != rank || it->howmany != howmany
+          || (it->simd_align && ! ioalign))
+        continue;
+
       // We still might not have the same shape of array.
 
+      bool match = true;
+
       for (int i = 0; i < rank; i++)
-        if (dims(i) != m_rn(i))
+        if (dims(i) != it->dims(i))
           {
-            create_new_plan = true;
+            match = false;
             break;
           }
-    }
 
-  if (create_new_plan)
-    {
-      m_rd = dist;
-      m_rs = stride;
-      m_rr = rank;
-      m_rh = howmany;
-      m_rsimd_align = ioalign;
-      m_rn = dims;
-
-      // Note reversal of dimensions for column major storage in FFTW.
-      octave_idx_type nn = 1;
-      OCTAVE_LOCAL_BUFFER (int, tmp, rank);
-
-      for (int i = 0, j = rank-1; i < rank; i++, j--)
+      if (match)
         {
-          tmp[i] = dims(j);
-          nn *= dims(j);
+          // Move to the front so frequently used plans stay cached.
+          m_plans.splice (m_plans.begin (), m_plans, it);
+          return it->plan;
         }
+    }
 
-      int plan_flags = 0;
-      bool plan_destroys_in = true;
+  // Note reversal of dimensions for column major storage in FFTW.
+  octave_idx_type nn = 1;
+  OCTAVE_LOCAL_BUFFER (int, tmp, rank);
+
+  for (int i = 0, j = rank-1; i < rank; i++, j--)
+    {
+      tmp[i] = dims(j);
+      nn *= dims(j);
+    }
 
-      switch (m_meth)
+  int plan_flags = 0;
+  bool plan_destroys_in = true;
+
+  switch (m_meth)
+    {
+    case UNKNOWN:
+    case ESTIMATE:
+      plan_flags |= FFTW_ESTIMATE;
+      plan_destroys_in = false;
+      break;
+    case MEASURE:
+      plan_flags |= FFTW_MEASURE;
+      break;
+    case PATIENT:
+      plan_flags |= FFTW_PATIENT;
+      break;
+    case EXHAUSTIVE:
+      plan_flags |= FFTW_EXHAUSTIVE;
+      break;
+    case HYBRID:
+      if (nn < 8193)
+        plan_flags |= FFTW_MEASURE;
+      else
         {
-        case UNKNOWN:
-        case ESTIMATE:
           plan_flags |= FFTW_ESTIMATE;
           plan_destroys_in = false;
-          break;
-        case MEASURE:
-          plan_flags |= FFTW_MEASURE;
-          break;
-        case PATIENT:
-          plan_flags |= FFTW_PATIENT;
-          break;
-        case EXHAUSTIVE:
-          plan_flags |= FFTW_EXHAUSTIVE;
-          break;
-        case HYBRID:
-          if (nn < 8193)
-            plan_flags |= FFTW_MEASURE;
-          else
-            {
-              plan_flags |= FFTW_ESTIMATE;
-              plan_destroys_in = false;
-            }
-          break;
         }
+      break;
+    }
 
-      if (ioalign)
-        plan_flags &= ~FFTW_UNALIGNED;
-      else
-        plan_flags |= FFTW_UNALIGNED;
+  if (ioalign)
+    plan_flags &= ~FFTW_UNALIGNED;
+  else
+    plan_flags |= FFTW_UNALIGNED;
 
-      if (*cur_plan_p)
-        fftwf_destroy_plan (*cur_plan_p);
+#if defined (HAVE_FFTW3F_THREADS)
+  fftwf_plan_with_nthreads (nn * howmany >= 65536 ? m_nthreads : 1);
+#endif
 
-      if (plan_destroys_in)
-        {
-          // Create matrix with the same size and 16-byte alignment as input
-          OCTAVE_LOCAL_BUFFER (float, itmp, nn + 32);
-          itmp = reinterpret_cast<float *>
-                 (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
-                  ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
-
-          *cur_plan_p
-            = fftwf_plan_many_dft_r2c (rank, tmp, howmany, itmp,
-                                       nullptr, stride, dist,
-                                       reinterpret_cast<fftwf_complex *> (out),
-                                       nullptr, stride, dist, plan_flags);
-        }
-      else
-        {
-          *cur_plan_p
-            = fftwf_plan_many_dft_r2c (rank, tmp, howmany,
-                                       (const_cast<float *> (in)),
-                                       nullptr, stride, dist,
-                                       reinterpret_cast<fftwf_complex *> (out),
-                                       nullptr, stride, dist, plan_flags);
-        }
+  fftwf_plan plan;
 
-      if (*cur_plan_p == nullptr)
-        (*current_liboctave_error_handler) ("Error creating FFTW plan");
+  if (plan_destroys_in)
+    {
+      // Create matrix with the same size and 16-byte alignment as input
+      OCTAVE_LOCAL_BUFFER (float, itmp, nn + 32);
+      itmp = reinterpret_cast<float *>
+             (((reinterpret_cast<std::ptrdiff_t> (itmp) + 15) & ~ 0xF) +
+              ((reinterpret_cast<std::ptrdiff_t> (in)) & 0xF));
+
+      plan
+        = fftwf_plan_many_dft_r2c (rank, tmp, howmany, itmp,
+                                   nullptr, stride, dist,
+                                   reinterpret_cast<fftwf_complex *> (out),
+                                   nullptr, stride, dist, plan_flags);
+    }
+  else
+    {
+      plan
+        = fftwf_plan_many_dft_r2c (rank, tmp, howmany,
+                                   (const_cast<float *> (in)),
+                                   nullptr, stride, dist,
+                                   reinterpret_cast<fftwf_complex *> (out),
+                                   nullptr, stride, dist, plan_flags);
+    }
+
+  if (plan == nullptr)
+    (*current_liboctave_error_handler) ("Error creating FFTW plan");
+
+  m_plans.push_front ({ plan, 0, rank, dims, howmany, stride, dist,
+                        ioalign, false });
+
+  while (m_plans.size () > std::size_t (MAX_CACHED_PLANS))
+    {
+      fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (m_plans.back ().plan));
+      m_plans.pop_back ();
     }
 
-  return *cur_plan_p;
+  return plan;
 }
 
 float_fftw_planner::FftwMethod
@@ -766,13 +843,9 @@ float_fftw_planner::do_method (FftwMethod _meth)
       if (m_meth != _meth)
         {
           m_meth = _meth;
-          if (m_rplan)
-            fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (m_rplan));
-          if (m_plan[0])
-            fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (m_plan[0]));
-          if (m_plan[1])
-            fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (m_plan[1]));
-          m_rplan = m_plan[0] = m_plan[1] = nullptr;
+          for (auto& rec : m_plans)
+            fftwf_destroy_plan (reinterpret_cast<fftwf_plan> (rec.plan));
+          m_plans.clear ();
         }
     }
   else
@@ -30,6 +30,7 @@
 
 #include <cstddef>
 
+#include <list>
 #include <string>
 
 #include "dim-vector.h"
@@ -131,48 +132,31 @@ private:
 
   FftwMethod m_meth;
 
-  // FIXME: perhaps this should be split into two classes?
+  // A cached plan together with the transform geometry it was created
+  // for.  DIR is FFTW_FORWARD or FFTW_BACKWARD for complex plans and 0
+  // for real-to-complex plans.
 
-  // Plan for fft and ifft of complex values
-  void *m_plan[2];
-
-  // dist
-  octave_idx_type m_d[2];
-
-  // stride
-  octave_idx_type m_s[2];
-
-  // rank
-  int m_r[2];
-
-  // howmany
-  octave_idx_type m_h[2];
-
-  // dims
-  dim_vector m_n[2];
-
-  bool m_simd_align[2];
-  bool m_inplace[2];
-
-  // Plan for fft of real values
-  void *m_rplan;
-
-  // dist
-  octave_idx_type m_rd;
-
-  // stride
-  octave_idx_type m_rs;
-
-  // rank
-  int m_rr;
+  struct plan_record
+  {
+    void *plan;
+    int dir;
+    int rank;
+    dim_vector dims;
+    octave_idx_type howmany;
+    octave_idx_type stride;
+    octave_idx_type dist;
+    bool simd_align;
+    bool inplace;
+  };
 
-  // howmany
-  octave_idx_type m_rh;
+  // Cached plans, most recently used first.  Keeping a handful of
+  // entries lets code that alternates between a few transform shapes
+  // (an STFT loop interleaved with other transforms, for example)
+  // reuse its plans instead of re-entering the planner on every call.
 
-  // dims
-  dim_vector m_rn;
+  std::list<plan_record> m_plans;
 
-  bool m_rsimd_align;
+  enum { MAX_CACHED_PLANS = 16 };
 
   // number of threads.  Always 1 unless compiled with multi-threading
   // support.
@@ -273,48 +257,28 @@ private:
 
   FftwMethod m_meth;
 
-  // FIXME: perhaps this should be split into two classes?
+  // A cached plan together with the transform geometry it was created
+  // for.  DIR is FFTW_FORWARD or FFTW_BACKWARD for complex plans and 0
+  // for real-to-complex plans.
 
-  // Plan for fft and ifft of complex values
-  void *m_plan[2];
-
-  // dist
-  octave_idx_type m_d[2];
-
-  // stride
-  octave_idx_type m_s[2];
-
-  // rank
-  int m_r[2];
-
-  // howmany
-  octave_idx_type m_h[2];
-
-  // dims
-  dim_vector m_n[2];
-
-  bool m_simd_align[2];
-  bool m_inplace[2];
-
-  // Plan for fft of real values
-  void *m_rplan;
-
-  // dist
-  octave_idx_type m_rd;
-
-  // stride
-  octave_idx_type m_rs;
-
-  // rank
-  int m_rr;
+  struct plan_record
+  {
+    void *plan;
+    int dir;
+    int rank;
+    dim_vector dims;
+    octave_idx_type howmany;
+    octave_idx_type stride;
+    octave_idx_type dist;
+    bool simd_align;
+    bool inplace;
+  };
 
-  // howmany
-  octave_idx_type m_rh;
+  // Cached plans, most recently used first.
 
-  // dims
-  dim_vector m_rn;
+  std::list<plan_record> m_plans;
 
-  bool m_rsimd_align;
+  enum { MAX_CACHED_PLANS = 16 };
 
   // number of threads.  Always 1 unless compiled with multi-threading
   // support.
@@ -60,6 +60,7 @@
 #include "mx-s-cm.h"
 #include "oct-cmplx.h"
 #include "oct-norm.h"
+#include "oct-parallel.h"
 #include "quit.h"
 #include "svd.h"
 
@@ -83,7 +84,6 @@ public:
   template <typename U>
   void accum (U val)
   {
-    octave_quit ();
     R t = std::abs (val);
     if (m_scl == t) // we need this to handle Infs properly
       m_sum += 1;
@@ -116,7 +116,6 @@ public:
   template <typename U>
   void accum (U val)
   {
-    octave_quit ();
     R t = 1 / std::abs (val);
     if (m_scl == t)
       m_sum += 1;
@@ -283,48 +282,90 @@ inline void vector_norm (const Array<T>& v, R& res, ACC acc)
 }
 
 // dense versions
+
+// The accumulators above do not throw, so independent columns (or row
+// blocks) can be handed to worker threads.
+
 template <typename T, typename R, typename ACC>
 void column_norms (const MArray<T>& m, MArray<R>& res, ACC acc)
 {
-  res = MArray<R> (dim_vector (1, m.columns ()));
-  for (octave_idx_type j = 0; j < m.columns (); j++)
-    {
-      ACC accj = acc;
-      for (octave_idx_type i = 0; i < m.rows (); i++)
-        accj.accum (m(i, j));
+  octave_idx_type nr = m.rows ();
+  octave_idx_type nc = m.columns ();
 
-      res.xelem (j) = accj;
-    }
+  res = MArray<R> (dim_vector (1, nc));
+
+  const T *v = m.data ();
+  R *rv = res.fortran_vec ();
+
+  chunked_parallel_for (nc, m.numel (),
+                        [=] (octave_idx_type start, octave_idx_type len)
+  {
+    for (octave_idx_type j = start; j < start + len; j++)
+      {
+        ACC accj = acc;
+        const T *col = v + j * nr;
+        for (octave_idx_type i = 0; i < nr; i++)
+          accj.accum (col[i]);
+
+        rv[j] = accj;
+      }
+  });
 }
 
 template <typename T, typename R, typename ACC>
 void row_norms (const MArray<T>& m, MArray<R>& res, ACC acc)
 {
-  res = MArray<R> (dim_vector (m.rows (), 1));
-  std::vector<ACC> acci (m.rows (), acc);
-  for (octave_idx_type j = 0; j < m.columns (); j++)
-    {
-      for (octave_idx_type i = 0; i < m.rows (); i++)
-        acci[i].accum (m(i, j));
-    }
+  octave_idx_type nr = m.rows ();
+  octave_idx_type nc = m.columns ();
 
-  for (octave_idx_type i = 0; i < m.rows (); i++)
-    res.xelem (i) = acci[i];
+  res = MArray<R> (dim_vector (nr, 1));
+
+  const T *v = m.data ();
+  R *rv = res.fortran_vec ();
+
+  // Each thread sweeps all columns of its block of rows, so the data
+  // is still traversed in memory order.
+
+  chunked_parallel_for (nr, m.numel (),
+                        [=] (octave_idx_type start, octave_idx_type len)
+  {
+    std::vector<ACC> acci (len, acc);
+    for (octave_idx_type j = 0; j < nc; j++)
+      {
+        const T *col = v + j * nr + start;
+        for (octave_idx_type i = 0; i < len; i++)
+          acci[i].accum (col[i]);
+      }
+
+    for (octave_idx_type i = 0; i < len; i++)
+      rv[start + i] = acci[i];
+  });
 }
 
 // sparse versions
 template <typename T, typename R, typename ACC>
 void column_norms (const MSparse<T>& m, MArray<R>& res, ACC acc)
 {
-  res = MArray<R> (dim_vector (1, m.columns ()));
-  for (octave_idx_type j = 0; j < m.columns (); j++)
-    {
-      ACC accj = acc;
-      for (octave_idx_type k = m.cidx (j); k < m.cidx (j+1); k++)
-        accj.accum (m.data (k));
+  octave_idx_type nc = m.columns ();
 
-      res.xelem (j) = accj;
-    }
+  res = MArray<R> (dim_vector (1, nc));
+
+  const T *data = m.data ();
+  const octave_idx_type *cidx = m.cidx ();
+  R *rv = res.fortran_vec ();
+
+  chunked_parallel_for (nc, m.nnz (),
+                        [=] (octave_idx_type start, octave_idx_type len)
+  {
+    for (octave_idx_type j = start; j < start + len; j++)
+      {
+        ACC accj = acc;
+        for (octave_idx_type k = cidx[j]; k < cidx[j+1]; k++)
+          accj.accum (data[k]);
+
+        rv[j] = accj;
+      }
+  });
 }
 
 template <typename T, typename R, typename ACC>
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include "dMatrix.h"
+#include "oct-locbuf.h"
+#include "oct-parallel.h"
+#include "oct-pdist.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Number of columns of the result processed together in the direct
+// kernel, so that each column of X is reused from cache across the
+// tile instead of being streamed once per result column.
+
+static const octave_idx_type pdist_tile = 32;
+
+// Direct accumulation over the coordinates, tiled as above.  Used when
+// the point dimension is too small for the GEMM formulation to pay off
+// and as the fallback that involves no intermediate matrix.
+
+static void
+pdist2_direct (const double *xv, const double *yv, double *rv,
+               octave_idx_type n, octave_idx_type m, octave_idx_type d,
+               bool squared)
+{
+  chunked_parallel_for
+    (m, n * m,
+     [=] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type j0 = beg; j0 < beg + len; j0 += pdist_tile)
+         {
+           octave_idx_type jn = std::min (pdist_tile, beg + len - j0);
+
+           std::fill_n (rv + j0 * n, jn * n, 0.0);
+
+           for (octave_idx_type k = 0; k < d; k++)
+             {
+               const double *xc = xv + k * n;
+
+               for (octave_idx_type j = j0; j < j0 + jn; j++)
+                 {
+                   double c = yv[j + k * m];
+                   double *col = rv + j * n;
+
+                   for (octave_idx_type i = 0; i < n; i++)
+                     {
+                       double t = xc[i] - c;
+                       col[i] += t * t;
+                     }
+                 }
+             }
+
+           if (! squared)
+             {
+               double *blk = rv + j0 * n;
+               for (octave_idx_type i = 0; i < jn * n; i++)
+                 blk[i] = std::sqrt (blk[i]);
+             }
+         }
+     });
+}
+
+Matrix
+xpdist2 (const Matrix& x, const Matrix& y, bool squared)
+{
+  octave_idx_type n = x.rows ();
+  octave_idx_type m = y.rows ();
+  octave_idx_type d = x.cols ();
+
+  Matrix retval (n, m);
+
+  if (n == 0 || m == 0)
+    return retval;
+
+  const double *xv = x.data ();
+  const double *yv = y.data ();
+  double *rv = retval.fortran_vec ();
+
+  if (d < 16)
+    {
+      pdist2_direct (xv, yv, rv, n, m, d, squared);
+      return retval;
+    }
+
+  // GEMM formulation: d(i,j)^2 = |x_i|^2 + |y_j|^2 - 2 x_i . y_j, with
+  // the cross terms computed as one BLAS3 product.  Cancellation can
+  // leave small negative values, which are clamped to zero.
+
+  Matrix g = xgemm (x, y, blas_no_trans, blas_trans);
+  const double *gv = g.data ();
+
+  OCTAVE_LOCAL_BUFFER (double, xn, n);
+  OCTAVE_LOCAL_BUFFER (double, yn, m);
+
+  std::fill_n (xn, n, 0.0);
+  std::fill_n (yn, m, 0.0);
+
+  for (octave_idx_type k = 0; k < d; k++)
+    for (octave_idx_type i = 0; i < n; i++)
+      xn[i] += xv[i + k * n] * xv[i + k * n];
+
+  for (octave_idx_type k = 0; k < d; k++)
+    for (octave_idx_type j = 0; j < m; j++)
+      yn[j] += yv[j + k * m] * yv[j + k * m];
+
+  const double *xnp = xn;
+  const double *ynp = yn;
+
+  chunked_parallel_for
+    (m, n * m,
+     [=] (octave_idx_type beg, octave_idx_type len)
+     {
+       for (octave_idx_type j = beg; j < beg + len; j++)
+         {
+           const double *gc = gv + j * n;
+           double *col = rv + j * n;
+           double c = ynp[j];
+
+           for (octave_idx_type i = 0; i < n; i++)
+             {
+               double t = xnp[i] + c - 2 * gc[i];
+               if (t < 0)
+                 t = 0;
+               col[i] = (squared ? t : std::sqrt (t));
+             }
+         }
+     });
+
+  return retval;
+}
+
+OCTAVE_END_NAMESPACE(octave)
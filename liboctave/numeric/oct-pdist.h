@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_pdist_h)
+#define octave_oct_pdist_h 1
+
+#include "octave-config.h"
+
+#include "mx-fwd.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Compute the matrix of Euclidean distances between the rows of X and
+// the rows of Y, which must have the same number of columns.  The
+// result has one row per row of X and one column per row of Y.  When
+// SQUARED is true the squared distances are returned, saving the
+// square roots.
+
+extern OCTAVE_API Matrix
+xpdist2 (const Matrix& x, const Matrix& y, bool squared = false);
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -43,6 +43,7 @@
 #include "quit.h"
 #include "randgamma.h"
 #include "randmtzig.h"
+#include "randphilox.h"
 #include "randpoisson.h"
 #include "singleton-cleanup.h"
 
@@ -52,11 +53,13 @@ rand *rand::s_instance = nullptr;
 
 rand::rand ()
   : m_current_distribution (uniform_dist), m_use_old_generators (false),
-    m_rand_states ()
+    m_use_philox (false), m_rand_states ()
 {
   initialize_ranlib_generators ();
 
   initialize_mersenne_twister ();
+
+  init_philox ();
 }
 
 bool rand::instance_ok ()
@@ -111,6 +114,7 @@ force_to_fit_range (int32_t i, int32_t lo, int32_t hi)
 void rand::do_seed (double s)
 {
   m_use_old_generators = true;
+  m_use_philox = false;
 
   int i0, i1;
   union d2i { double d; int32_t i[2]; };
@@ -138,6 +142,7 @@ void rand::do_seed (double s)
 void rand::do_reset ()
 {
   m_use_old_generators = true;
+  m_use_philox = false;
   initialize_ranlib_generators ();
 }
 
@@ -149,6 +154,7 @@ uint32NDArray rand::do_state (const std::string& d)
 void rand::do_state (const uint32NDArray& s, const std::string& d)
 {
   m_use_old_generators = false;
+  m_use_philox = false;
 
   int old_dist = m_current_distribution;
 
@@ -170,6 +176,7 @@ void rand::do_state (const uint32NDArray& s, const std::string& d)
 void rand::do_reset (const std::string& d)
 {
   m_use_old_generators = false;
+  m_use_philox = false;
 
   int old_dist = m_current_distribution;
 
@@ -187,6 +194,49 @@ void rand::do_reset (const std::string& d)
     m_rand_states[old_dist] = saved_state;
 }
 
+uint32NDArray rand::do_philox_state ()
+{
+  uint32NDArray s (dim_vector (PHILOX_STATE_LEN, 1));
+
+  get_philox_state (reinterpret_cast<uint32_t *> (s.fortran_vec ()));
+
+  return s;
+}
+
+void rand::do_philox_state (const uint32NDArray& s)
+{
+  if (s.numel () != PHILOX_STATE_LEN)
+    (*current_liboctave_error_handler)
+      ("rand: philox state must have %d elements", PHILOX_STATE_LEN);
+
+  m_use_old_generators = false;
+  m_use_philox = true;
+
+  set_philox_state (reinterpret_cast<const uint32_t *> (s.data ()));
+}
+
+void rand::do_philox_seed (double s)
+{
+  m_use_old_generators = false;
+  m_use_philox = true;
+
+  // Use the bit pattern of the seed so that non-integer seeds also
+  // select distinct streams.
+  union d2i { double d; uint64_t i; };
+  union d2i u;
+  u.d = s;
+
+  init_philox (u.i);
+}
+
+void rand::do_philox_reset ()
+{
+  m_use_old_generators = false;
+  m_use_philox = true;
+
+  init_philox ();
+}
+
 std::string rand::do_distribution ()
 {
   std::string retval;
@@ -297,6 +347,8 @@ OCTAVE_API double rand::uniform<double> ()
 
   if (m_use_old_generators)
     F77_FUNC (dgenunf, DGENUNF) (0.0, 1.0, retval);
+  else if (m_use_philox)
+    retval = philox_rand_uniform<double> ();
   else
     retval = rand_uniform<double> ();
 
@@ -310,6 +362,8 @@ OCTAVE_API double rand::normal<double> ()
 
   if (m_use_old_generators)
     F77_FUNC (dgennor, DGENNOR) (0.0, 1.0, retval);
+  else if (m_use_philox)
+    retval = philox_rand_normal<double> ();
   else
     retval = rand_normal<double> ();
 
@@ -323,6 +377,8 @@ OCTAVE_API double rand::exponential<double> ()
 
   if (m_use_old_generators)
     F77_FUNC (dgenexp, DGENEXP) (1.0, retval);
+  else if (m_use_philox)
+    retval = philox_rand_exponential<double> ();
   else
     retval = rand_exponential<double> ();
 
@@ -376,6 +432,8 @@ OCTAVE_API float rand::uniform<float> ()
 
   if (m_use_old_generators)
     F77_FUNC (fgenunf, FGENUNF) (0.0f, 1.0f, retval);
+  else if (m_use_philox)
+    retval = philox_rand_uniform<float> ();
   else
     retval = rand_uniform<float> ();
 
@@ -389,6 +447,8 @@ OCTAVE_API float rand::normal<float> ()
 
   if (m_use_old_generators)
     F77_FUNC (fgennor, FGENNOR) (0.0f, 1.0f, retval);
+  else if (m_use_philox)
+    retval = philox_rand_normal<float> ();
   else
     retval = rand_normal<float> ();
 
@@ -402,6 +462,8 @@ OCTAVE_API float rand::exponential<float> ()
 
   if (m_use_old_generators)
     F77_FUNC (fgenexp, FGENEXP) (1.0f, retval);
+  else if (m_use_philox)
+    retval = philox_rand_exponential<float> ();
   else
     retval = rand_exponential<float> ();
 
@@ -665,6 +727,8 @@ void rand::fill (octave_idx_type len, double *v, double a)
     case uniform_dist:
       if (m_use_old_generators)
         std::generate_n (v, len, []() { double x; F77_FUNC (dgenunf, DGENUNF) (0.0, 1.0, x); return x; });
+      else if (m_use_philox)
+        philox_rand_uniform<double> (len, v);
       else
         rand_uniform<double> (len, v);
       break;
@@ -672,6 +736,8 @@ void rand::fill (octave_idx_type len, double *v, double a)
     case normal_dist:
       if (m_use_old_generators)
         std::generate_n (v, len, []() { double x; F77_FUNC (dgennor, DGENNOR) (0.0, 1.0, x); return x; });
+      else if (m_use_philox)
+        philox_rand_normal<double> (len, v);
       else
         rand_normal<double> (len, v);
       break;
@@ -679,6 +745,8 @@ void rand::fill (octave_idx_type len, double *v, double a)
     case expon_dist:
       if (m_use_old_generators)
         std::generate_n (v, len, []() { double x; F77_FUNC (dgenexp, DGENEXP) (1.0, x); return x; });
+      else if (m_use_philox)
+        philox_rand_exponential<double> (len, v);
       else
         rand_exponential<double> (len, v);
       break;
@@ -733,6 +801,8 @@ void rand::fill (octave_idx_type len, float *v, float a)
     case uniform_dist:
       if (m_use_old_generators)
         std::generate_n (v, len, []() { float x; F77_FUNC (fgenunf, FGENUNF) (0.0f, 1.0f, x); return x; });
+      else if (m_use_philox)
+        philox_rand_uniform<float> (len, v);
       else
         rand_uniform<float> (len, v);
       break;
@@ -740,6 +810,8 @@ void rand::fill (octave_idx_type len, float *v, float a)
     case normal_dist:
       if (m_use_old_generators)
         std::generate_n (v, len, []() { float x; F77_FUNC (fgennor, FGENNOR) (0.0f, 1.0f, x); return x; });
+      else if (m_use_philox)
+        philox_rand_normal<float> (len, v);
       else
         rand_normal<float> (len, v);
       break;
@@ -747,6 +819,8 @@ void rand::fill (octave_idx_type len, float *v, float a)
     case expon_dist:
       if (m_use_old_generators)
         std::generate_n (v, len, []() { float x; F77_FUNC (fgenexp, FGENEXP) (1.0f, x); return x; });
+      else if (m_use_philox)
+        philox_rand_exponential<float> (len, v);
       else
         rand_exponential<float> (len, v);
       break;
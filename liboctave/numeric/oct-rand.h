@@ -97,6 +97,33 @@ public:
       s_instance->do_reset (d);
   }
 
+  // Return the current Philox generator state.
+  static uint32NDArray philox_state ()
+  {
+    return instance_ok () ? s_instance->do_philox_state () : uint32NDArray ();
+  }
+
+  // Set the Philox generator state and select the Philox generator.
+  static void philox_state (const uint32NDArray& s)
+  {
+    if (instance_ok ())
+      s_instance->do_philox_state (s);
+  }
+
+  // Seed the Philox generator and select it.
+  static void philox_seed (double s)
+  {
+    if (instance_ok ())
+      s_instance->do_philox_seed (s);
+  }
+
+  // Reset the Philox generator and select it.
+  static void philox_reset ()
+  {
+    if (instance_ok ())
+      s_instance->do_philox_reset ();
+  }
+
   // Return the current distribution.
   static std::string distribution ()
   {
@@ -206,6 +233,10 @@ private:
   // Twister generator.
   bool m_use_old_generators;
 
+  // If TRUE, use the counter-based Philox generator for uniform,
+  // normal, and exponential deviates instead of the Mersenne Twister.
+  bool m_use_philox;
+
   // Saved MT states.
   std::map<int, uint32NDArray> m_rand_states;
 
@@ -227,6 +258,18 @@ private:
   // Reset the current state/
   OCTAVE_API void do_reset (const std::string& d);
 
+  // Return the current Philox generator state.
+  OCTAVE_API uint32NDArray do_philox_state ();
+
+  // Set the Philox generator state and select the Philox generator.
+  OCTAVE_API void do_philox_state (const uint32NDArray& s);
+
+  // Seed the Philox generator and select it.
+  OCTAVE_API void do_philox_seed (double s);
+
+  // Reset the Philox generator and select it.
+  OCTAVE_API void do_philox_reset ();
+
   // Return the current distribution.
   OCTAVE_API std::string do_distribution ();
 
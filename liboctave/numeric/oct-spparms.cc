@@ -116,6 +116,8 @@ void sparse_params::do_defaults ()
   m_params(10) = 0.5;   // bandden
   m_params(11) = 1;     // umfpack
   m_params(12) = 0.001; // sym_tol
+  m_params(13) = 0;     // mul_threads (0 = automatic)
+  m_params(14) = 0;     // nd_order
 }
 
 void sparse_params::do_tight ()
@@ -133,6 +135,8 @@ void sparse_params::do_tight ()
   m_params(10) = 0.5;   // bandden
   m_params(11) = 1;     // umfpack
   m_params(12) = 0.001; // sym_tol
+  m_params(13) = 0;     // mul_threads (0 = automatic)
+  m_params(14) = 0;     // nd_order
 }
 
 void sparse_params::init_keys ()
@@ -150,6 +154,8 @@ void sparse_params::init_keys ()
   m_keys(10) = "bandden";
   m_keys(11) = "umfpack";
   m_keys(12) = "sym_tol";
+  m_keys(13) = "mul_threads";
+  m_keys(14) = "nd_order";
 }
 
 double sparse_params::do_get_bandden ()
@@ -35,7 +35,7 @@
 #include "str-vec.h"
 #include "dColVector.h"
 
-#define OCTAVE_SPARSE_CONTROLS_SIZE 13
+#define OCTAVE_SPARSE_CONTROLS_SIZE 15
 
 OCTAVE_BEGIN_NAMESPACE(octave)
 
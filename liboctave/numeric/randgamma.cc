@@ -126,8 +126,18 @@ template <typename T> void rand_gamma (T a, octave_idx_type n, T *r)
     {
       /* Use gamma(a) = gamma(1+a)*U^(1/a) */
       /* Given REXP = -log(U) then U^(1/a) = exp(-REXP/a) */
-      for (i = 0; i < n; i++)
-        r[i] *= exp (-rand_exponential<T> () / a);
+      /* One exponential per element, so draw them in blocks; the
+         draws happen in the same order as one call per element. */
+      T ebuf[256];
+      octave_idx_type j = 0;
+      while (j < n)
+        {
+          octave_idx_type m = (n - j < 256 ? n - j : 256);
+          rand_exponential<T> (m, ebuf);
+          for (i = 0; i < m; i++)
+            r[j+i] *= exp (-ebuf[i] / a);
+          j += m;
+        }
     }
 }
 
@@ -345,20 +345,22 @@ static void next_state ()
   *p = p[MT_M-MT_N] ^ TWIST(p[0], state[0]);
 }
 
+/* Tempering */
+static inline uint32_t temper (uint32_t y)
+{
+  y ^= (y >> 11);
+  y ^= (y << 7) & 0x9d2c5680UL;
+  y ^= (y << 15) & 0xefc60000UL;
+  return (y ^ (y >> 18));
+}
+
 /* generates a random number on [0,0xffffffff]-interval */
 static uint32_t randmt ()
 {
-  uint32_t y;
-
   if (--left == 0)
     next_state ();
-  y = *next++;
 
-  /* Tempering */
-  y ^= (y >> 11);
-  y ^= (y << 7) & 0x9d2c5680UL;
-  y ^= (y << 15) & 0xefc60000UL;
-  return (y ^ (y >> 18));
+  return temper (*next++);
 }
 
 /* ===== Uniform generators ===== */
@@ -672,19 +674,144 @@ template <> OCTAVE_API double rand_exponential<double> ()
     }
 }
 
+/* ===== Array generators =====
+ *
+ * The array fills below consume tempered words directly from the
+ * current twister window in batches instead of calling the scalar
+ * generators element by element.  Words are consumed in exactly the
+ * same order as the scalar code, so the sequence generated from a
+ * given state is unchanged; whenever a candidate is rejected, or too
+ * few words remain before the next state refresh, the loop falls back
+ * to the scalar generator, which re-draws the same words and runs the
+ * usual rejection handling.  The accept path, taken well over 98% of
+ * the time, thus runs as a tight loop free of per-call state checks.
+ */
+
 template <> OCTAVE_API void rand_uniform<double> (octave_idx_type n, double *p)
 {
-                                                  std::generate_n (p, n, []() { return rand_uniform<double> (); });
+  octave_idx_type i = 0;
+
+  while (i < n)
+    {
+      if (left <= 2)
+        {
+          p[i++] = rand_uniform<double> ();
+          continue;
+        }
+
+      octave_idx_type m = (left - 1) / 2;
+      if (m > n - i)
+        m = n - i;
+
+      const uint32_t *q = next;
+      octave_idx_type k;
+      for (k = 0; k < m; k++, q += 2)
+        {
+          const int32_t a = temper (q[0]) >> 5;
+          const int32_t b = temper (q[1]) >> 6;
+          if (a == 0 && b == 0)
+            break;      /* randu53 rejects this pair */
+          p[i+k] = (a*67108864.0 + b) * (1.0/9007199254740992.0);
+        }
+
+      next += 2*k;
+      left -= 2*k;
+      i += k;
+
+      if (k < m)
+        p[i++] = rand_uniform<double> ();
+    }
 }
 
 template <> OCTAVE_API void rand_normal (octave_idx_type n, double *p)
 {
-                                         std::generate_n (p, n, []() { return rand_normal<double> (); });
+  if (initt)
+    create_ziggurat_tables ();
+
+#if defined (HAVE_X86_32)
+  /* The scalar generator maps words to the candidate differently on
+     this target; don't duplicate that variant here. */
+  std::generate_n (p, n, []() { return rand_normal<double> (); });
+#else
+  octave_idx_type i = 0;
+
+  while (i < n)
+    {
+      if (left <= 2)
+        {
+          p[i++] = rand_normal<double> ();
+          continue;
+        }
+
+      octave_idx_type m = (left - 1) / 2;
+      if (m > n - i)
+        m = n - i;
+
+      const uint32_t *q = next;
+      octave_idx_type k;
+      for (k = 0; k < m; k++, q += 2)
+        {
+          /* randi54, as in the scalar generator */
+          const uint32_t lo = temper (q[0]);
+          const uint64_t hi = temper (q[1]) & 0x3FFFFF;
+          const uint64_t r = (hi << 32) | lo;
+          const int64_t rabs = r >> 1;
+          const int idx = static_cast<int> (rabs & 0xFF);
+          if (rabs >= static_cast<int64_t> (ki[idx]))
+            break;      /* tail strip or rejection test needed */
+          p[i+k] = ((r & 1) ? -rabs : rabs) * wi[idx];
+        }
+
+      next += 2*k;
+      left -= 2*k;
+      i += k;
+
+      if (k < m)
+        p[i++] = rand_normal<double> ();
+    }
+#endif
 }
 
 template <> OCTAVE_API void rand_exponential (octave_idx_type n, double *p)
 {
-                                              std::generate_n (p, n, []() { return rand_exponential<double> (); });
+  if (initt)
+    create_ziggurat_tables ();
+
+  octave_idx_type i = 0;
+
+  while (i < n)
+    {
+      if (left <= 2)
+        {
+          p[i++] = rand_exponential<double> ();
+          continue;
+        }
+
+      octave_idx_type m = (left - 1) / 2;
+      if (m > n - i)
+        m = n - i;
+
+      const uint32_t *q = next;
+      octave_idx_type k;
+      for (k = 0; k < m; k++, q += 2)
+        {
+          /* randi53, as in the scalar generator */
+          const uint32_t lo = temper (q[0]);
+          const uint64_t hi = temper (q[1]) & 0x1FFFFF;
+          const uint64_t ri = (hi << 32) | lo;
+          const int idx = static_cast<int> (ri & 0xFF);
+          if (ri >= ke[idx])
+            break;      /* tail strip or rejection test needed */
+          p[i+k] = ri * we[idx];
+        }
+
+      next += 2*k;
+      left -= 2*k;
+      i += k;
+
+      if (k < m)
+        p[i++] = rand_exponential<double> ();
+    }
 }
 
 #undef ZIGINT
@@ -850,19 +977,121 @@ template <> OCTAVE_API float rand_exponential<float> ()
     }
 }
 
+/* Single precision array fills, one twister word per candidate; see
+   the comment before the double precision fills above. */
+
 template <> OCTAVE_API void rand_uniform (octave_idx_type n, float *p)
 {
-                                          std::generate_n (p, n, []() { return rand_uniform<float> (); });
+  octave_idx_type i = 0;
+
+  while (i < n)
+    {
+      if (left <= 1)
+        {
+          p[i++] = rand_uniform<float> ();
+          continue;
+        }
+
+      octave_idx_type m = left - 1;
+      if (m > n - i)
+        m = n - i;
+
+      const uint32_t *q = next;
+      octave_idx_type k;
+      for (k = 0; k < m; k++)
+        {
+          const uint32_t v = temper (q[k]) & static_cast<uint32_t> (0xFFFFFF);
+          if (v == 0)
+            break;      /* randu24 rejects this word */
+          p[i+k] = v * (1.0f / 16777216.0f);
+        }
+
+      next += k;
+      left -= k;
+      i += k;
+
+      if (k < m)
+        p[i++] = rand_uniform<float> ();
+    }
 }
 
 template <> OCTAVE_API void rand_normal (octave_idx_type n, float *p)
 {
-                                         std::generate_n (p, n, []() { return rand_normal<float> (); });
+  if (inittf)
+    create_ziggurat_float_tables ();
+
+  octave_idx_type i = 0;
+
+  while (i < n)
+    {
+      if (left <= 1)
+        {
+          p[i++] = rand_normal<float> ();
+          continue;
+        }
+
+      octave_idx_type m = left - 1;
+      if (m > n - i)
+        m = n - i;
+
+      const uint32_t *q = next;
+      octave_idx_type k;
+      for (k = 0; k < m; k++)
+        {
+          const uint32_t r = temper (q[k]);
+          const uint32_t rabs = r & LMASK;
+          const int idx = static_cast<int> (r & 0xFF);
+          if (rabs >= fki[idx])
+            break;      /* tail strip or rejection test needed */
+          p[i+k] = static_cast<int32_t> (r) * fwi[idx];
+        }
+
+      next += k;
+      left -= k;
+      i += k;
+
+      if (k < m)
+        p[i++] = rand_normal<float> ();
+    }
 }
 
 template <> OCTAVE_API void rand_exponential (octave_idx_type n, float *p)
 {
-                                              std::generate_n (p, n, []() { return rand_exponential<float> (); });
+  if (inittf)
+    create_ziggurat_float_tables ();
+
+  octave_idx_type i = 0;
+
+  while (i < n)
+    {
+      if (left <= 1)
+        {
+          p[i++] = rand_exponential<float> ();
+          continue;
+        }
+
+      octave_idx_type m = left - 1;
+      if (m > n - i)
+        m = n - i;
+
+      const uint32_t *q = next;
+      octave_idx_type k;
+      for (k = 0; k < m; k++)
+        {
+          const uint32_t ri = temper (q[k]);
+          const int idx = static_cast<int> (ri & 0xFF);
+          if (ri >= fke[idx])
+            break;      /* tail strip or rejection test needed */
+          p[i+k] = ri * fwe[idx];
+        }
+
+      next += k;
+      left -= k;
+      i += k;
+
+      if (k < m)
+        p[i++] = rand_exponential<float> ();
+    }
 }
 
 OCTAVE_END_NAMESPACE(octave)
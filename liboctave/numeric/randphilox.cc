@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+/*
+   Philox-4x32-10 counter-based random number generator, following
+
+   J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, "Parallel
+   random numbers: as easy as 1, 2, 3", Proceedings of SC'11.
+
+   Unlike the Mersenne Twister, output block I is a pure function of
+   the key and of counter+I, so any part of the stream can be computed
+   independently.  The bulk fill routines below exploit that to
+   generate in parallel; the result is identical to serial generation
+   regardless of the number of threads.
+
+   Each generated element consumes exactly one 128-bit counter block
+   (four 32-bit outputs):
+
+     uniform double:      53-bit mantissa from words 0 and 1
+     uniform float:       24-bit mantissa from word 0
+     normal:              Box-Muller from two uniforms (words 0-3)
+     exponential:         inversion of the uniform from words 0 and 1
+
+   The uniform deviates are (I + 0.5) / 2^B for a B-bit integer I, so
+   they lie strictly inside (0,1) without the rejection loop used by
+   the twister code; a data-dependent retry would break the fixed
+   element-to-counter mapping that parallel generation relies on.
+*/
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+
+#include "oct-parallel.h"
+#include "oct-time.h"
+#include "randphilox.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Global generator state: 64-bit key and 128-bit counter.
+
+static uint32_t s_key[2];
+static uint32_t s_ctr[4];
+
+// Compute one Philox-4x32-10 output block for the given counter and
+// key.  Constants are from the reference implementation.
+
+static void
+philox_block (const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+  uint32_t x0 = ctr[0], x1 = ctr[1], x2 = ctr[2], x3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int round = 0; round < 10; round++)
+    {
+      uint64_t p0 = UINT64_C (0xD2511F53) * x0;
+      uint64_t p1 = UINT64_C (0xCD9E8D57) * x2;
+
+      uint32_t y0 = static_cast<uint32_t> (p1 >> 32) ^ x1 ^ k0;
+      uint32_t y1 = static_cast<uint32_t> (p1);
+      uint32_t y2 = static_cast<uint32_t> (p0 >> 32) ^ x3 ^ k1;
+      uint32_t y3 = static_cast<uint32_t> (p0);
+
+      x0 = y0; x1 = y1; x2 = y2; x3 = y3;
+
+      k0 += 0x9E3779B9;  // golden ratio
+      k1 += 0xBB67AE85;  // sqrt(3) - 1
+    }
+
+  out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+}
+
+// Store CTR + OFF in OUT, carrying through all four counter words.
+
+static void
+counter_at (const uint32_t ctr[4], uint64_t off, uint32_t out[4])
+{
+  uint64_t t = static_cast<uint64_t> (ctr[0]) + static_cast<uint32_t> (off);
+  out[0] = static_cast<uint32_t> (t);
+  t = static_cast<uint64_t> (ctr[1]) + static_cast<uint32_t> (off >> 32)
+      + (t >> 32);
+  out[1] = static_cast<uint32_t> (t);
+  t = static_cast<uint64_t> (ctr[2]) + (t >> 32);
+  out[2] = static_cast<uint32_t> (t);
+  out[3] = ctr[3] + static_cast<uint32_t> (t >> 32);
+}
+
+static void
+advance_counter (uint64_t n)
+{
+  counter_at (s_ctr, n, s_ctr);
+}
+
+// Map an output block to a deviate in (0,1) with 53-bit resolution.
+
+static double
+philox_u53 (const uint32_t w[4])
+{
+  return (((w[0] >> 5) * 67108864.0 + (w[1] >> 6)) + 0.5)
+         * (1.0 / 9007199254740992.0);
+}
+
+// Map an output block to a deviate in (0,1) with 24-bit resolution.
+
+static float
+philox_u24 (const uint32_t w[4])
+{
+  return ((w[0] >> 8) + 0.5f) * (1.0f / 16777216.0f);
+}
+
+// One standard normal deviate per block via Box-Muller; the second
+// uniform comes from the spare words of the same block.
+
+static double
+philox_n53 (const uint32_t w[4])
+{
+  double u1 = philox_u53 (w);
+  double u2 = (((w[2] >> 5) * 67108864.0 + (w[3] >> 6)) + 0.5)
+              * (1.0 / 9007199254740992.0);
+
+  return std::sqrt (-2.0 * std::log (u1))
+         * std::cos (2.0 * M_PI * u2);
+}
+
+void init_philox ()
+{
+  sys::time now;
+
+  uint64_t seed = static_cast<uint64_t> (now.unix_time ()) << 32;
+  seed ^= static_cast<uint64_t> (now.usec ()) << 12;
+  seed ^= static_cast<uint64_t> (clock ());
+
+  init_philox (seed);
+}
+
+void init_philox (uint64_t seed)
+{
+  s_key[0] = static_cast<uint32_t> (seed);
+  s_key[1] = static_cast<uint32_t> (seed >> 32);
+
+  s_ctr[0] = s_ctr[1] = s_ctr[2] = s_ctr[3] = 0;
+}
+
+void set_philox_state (const uint32_t *save)
+{
+  s_key[0] = save[0];
+  s_key[1] = save[1];
+
+  for (int i = 0; i < 4; i++)
+    s_ctr[i] = save[2+i];
+}
+
+void get_philox_state (uint32_t *save)
+{
+  save[0] = s_key[0];
+  save[1] = s_key[1];
+
+  for (int i = 0; i < 4; i++)
+    save[2+i] = s_ctr[i];
+}
+
+template <>
+OCTAVE_API double
+philox_rand_uniform<double> ()
+{
+  uint32_t w[4];
+  philox_block (s_ctr, s_key, w);
+  advance_counter (1);
+
+  return philox_u53 (w);
+}
+
+template <>
+OCTAVE_API float
+philox_rand_uniform<float> ()
+{
+  uint32_t w[4];
+  philox_block (s_ctr, s_key, w);
+  advance_counter (1);
+
+  return philox_u24 (w);
+}
+
+template <>
+OCTAVE_API double
+philox_rand_normal<double> ()
+{
+  uint32_t w[4];
+  philox_block (s_ctr, s_key, w);
+  advance_counter (1);
+
+  return philox_n53 (w);
+}
+
+template <>
+OCTAVE_API float
+philox_rand_normal<float> ()
+{
+  uint32_t w[4];
+  philox_block (s_ctr, s_key, w);
+  advance_counter (1);
+
+  return static_cast<float> (philox_n53 (w));
+}
+
+template <>
+OCTAVE_API double
+philox_rand_exponential<double> ()
+{
+  uint32_t w[4];
+  philox_block (s_ctr, s_key, w);
+  advance_counter (1);
+
+  return -std::log (philox_u53 (w));
+}
+
+template <>
+OCTAVE_API float
+philox_rand_exponential<float> ()
+{
+  uint32_t w[4];
+  philox_block (s_ctr, s_key, w);
+  advance_counter (1);
+
+  return static_cast<float> (-std::log (philox_u53 (w)));
+}
+
+// Bulk fills.  Workers read a private copy of the key and base
+// counter, so the only shared update is the final counter advance.
+
+template <typename T, typename F>
+static void
+philox_fill (octave_idx_type n, T *p, F block_to_deviate)
+{
+  uint32_t key[2] = { s_key[0], s_key[1] };
+  uint32_t base[4] = { s_ctr[0], s_ctr[1], s_ctr[2], s_ctr[3] };
+
+  chunked_parallel_for (n, n,
+    [=] (octave_idx_type beg, octave_idx_type len)
+    {
+      for (octave_idx_type i = beg; i < beg + len; i++)
+        {
+          uint32_t c[4], w[4];
+          counter_at (base, i, c);
+          philox_block (c, key, w);
+          p[i] = block_to_deviate (w);
+        }
+    });
+
+  advance_counter (n);
+}
+
+template <>
+OCTAVE_API void
+philox_rand_uniform<double> (octave_idx_type n, double *p)
+{
+  philox_fill (n, p, [] (const uint32_t *w) { return philox_u53 (w); });
+}
+
+template <>
+OCTAVE_API void
+philox_rand_uniform<float> (octave_idx_type n, float *p)
+{
+  philox_fill (n, p, [] (const uint32_t *w) { return philox_u24 (w); });
+}
+
+template <>
+OCTAVE_API void
+philox_rand_normal<double> (octave_idx_type n, double *p)
+{
+  philox_fill (n, p, [] (const uint32_t *w) { return philox_n53 (w); });
+}
+
+template <>
+OCTAVE_API void
+philox_rand_normal<float> (octave_idx_type n, float *p)
+{
+  philox_fill (n, p,
+               [] (const uint32_t *w)
+               { return static_cast<float> (philox_n53 (w)); });
+}
+
+template <>
+OCTAVE_API void
+philox_rand_exponential<double> (octave_idx_type n, double *p)
+{
+  philox_fill (n, p,
+               [] (const uint32_t *w)
+               { return -std::log (philox_u53 (w)); });
+}
+
+template <>
+OCTAVE_API void
+philox_rand_exponential<float> (octave_idx_type n, float *p)
+{
+  philox_fill (n, p,
+               [] (const uint32_t *w)
+               { return static_cast<float> (-std::log (philox_u53 (w))); });
+}
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_randphilox_h)
+#define octave_randphilox_h 1
+
+#include "octave-config.h"
+
+// State vector layout: 2 key words followed by the 4 counter words.
+
+#define PHILOX_STATE_LEN 6
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Philox-4x32-10 counter-based generator.  Element I of a bulk fill
+// depends only on the key and on counter+I, so array fills are split
+// across threads with results identical to serial generation.
+
+extern OCTAVE_API void init_philox ();
+extern OCTAVE_API void init_philox (uint64_t seed);
+
+extern OCTAVE_API void set_philox_state (const uint32_t *save);
+extern OCTAVE_API void get_philox_state (uint32_t *save);
+
+template <typename T> OCTAVE_API T philox_rand_uniform ();
+template <typename T> OCTAVE_API T philox_rand_normal ();
+template <typename T> OCTAVE_API T philox_rand_exponential ();
+
+template <typename T> OCTAVE_API void
+philox_rand_uniform (octave_idx_type n, T *p);
+template <typename T> OCTAVE_API void
+philox_rand_normal (octave_idx_type n, T *p);
+template <typename T> OCTAVE_API void
+philox_rand_exponential (octave_idx_type n, T *p);
+
+template <> OCTAVE_API double philox_rand_uniform<double> ();
+template <> OCTAVE_API double philox_rand_normal<double> ();
+template <> OCTAVE_API double philox_rand_exponential<double> ();
+
+template <> OCTAVE_API float philox_rand_uniform<float> ();
+template <> OCTAVE_API float philox_rand_normal<float> ();
+template <> OCTAVE_API float philox_rand_exponential<float> ();
+
+template <> OCTAVE_API void
+philox_rand_uniform<double> (octave_idx_type n, double *p);
+
+template <> OCTAVE_API void
+philox_rand_normal<double> (octave_idx_type n, double *p);
+
+template <> OCTAVE_API void
+philox_rand_exponential<double> (octave_idx_type n, double *p);
+
+template <> OCTAVE_API void
+philox_rand_uniform<float> (octave_idx_type n, float *p);
+
+template <> OCTAVE_API void
+philox_rand_normal<float> (octave_idx_type n, float *p);
+
+template <> OCTAVE_API void
+philox_rand_exponential<float> (octave_idx_type n, float *p);
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -285,6 +285,8 @@ sparse_chol<chol_type>::sparse_chol_rep::init (const chol_type& a,
       cm->method[0].ordering = CHOLMOD_NATURAL;
       cm->postorder = false;
     }
+  else
+    maybe_set_nd_ordering (cm);
 
   cholmod_factor *Lfactor = CHOLMOD_NAME(analyze) (ac, cm);
   CHOLMOD_NAME(factorize) (ac, Lfactor, cm);
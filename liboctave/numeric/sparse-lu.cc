@@ -448,6 +448,8 @@ sparse_lu<lu_type>::sparse_lu (const lu_type& a, const Matrix& piv_thres,
   if (! math::isnan (tmp))
     Control (UMFPACK_FIXQ) = tmp;
 
+  maybe_set_nd_ordering (control);
+
   // Turn-off UMFPACK scaling for LU
   if (scale)
     Control (UMFPACK_SCALE) = UMFPACK_SCALE_SUM;
@@ -673,6 +675,8 @@ sparse_lu<lu_type>::sparse_lu (const lu_type& a,
         Control (UMFPACK_FIXQ) = tmp;
     }
 
+  maybe_set_nd_ordering (control);
+
   // Turn-off UMFPACK scaling for LU
   if (scale)
     Control (UMFPACK_SCALE) = UMFPACK_SCALE_SUM;
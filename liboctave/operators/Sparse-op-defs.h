@@ -28,10 +28,14 @@
 
 #include "octave-config.h"
 
+#include <algorithm>
+
 #include "Array-util.h"
 #include "lo-array-errwarn.h"
 #include "mx-inlines.cc"
 #include "oct-locbuf.h"
+#include "oct-sort.h"
+#include "oct-spparms.h"
 
 // sparse matrix by scalar operations.
 
@@ -1760,6 +1764,257 @@
 
 #define SPARSE_ANY_OP(DIM) SPARSE_ANY_ALL_OP (DIM, false, false, !=, true)
 
+// Number of threads to use for the general sparse-times-sparse product
+// below, honoring the "mul_threads" spparms control (0 = choose
+// automatically, 1 = serial, N = use N threads).  TOTAL_NNZ is the
+// combined nonzero count of the operands; small products always run
+// serially because the per-column work cannot amortize thread startup.
+
+inline int
+sparse_mul_nthreads (octave_idx_type total_nnz)
+{
+#if defined (_OPENMP)
+
+  double val = octave::sparse_params::get_key ("mul_threads");
+
+  int nthreads = (val > 0 ? static_cast<int> (val)
+                          : octave::parallel_num_threads ());
+
+  if (nthreads > 1 && total_nnz >= octave::parallel_numel_threshold ())
+    return nthreads;
+
+#else
+
+  octave_unused_parameter (total_nnz);
+
+#endif
+
+  return 1;
+}
+
+#if defined (_OPENMP)
+
+// Row-sorted CSC SpGEMM computing R = M * A with output columns
+// partitioned across threads.  Each thread keeps a private pattern
+// workspace and dense accumulator column and writes only into the
+// column ranges assigned to it, so the phases need no locking: a first
+// parallel pass computes per-column fill counts, a serial prefix sum
+// sizes the result, and a second parallel pass fills the columns.
+//
+// The marker trick below (w[row] < i+1) relies on each thread visiting
+// its own columns in increasing order, which the static schedule
+// guarantees.  octave_quit is only checked between phases because the
+// interrupt machinery must not run off the main thread.
+
+template <typename RET_TYPE, typename RET_EL_TYPE, typename EL_TYPE,
+          typename M_TYPE, typename A_TYPE>
+RET_TYPE
+sparse_sparse_mul_threaded (const M_TYPE& m, const A_TYPE& a, int nthreads)
+{
+  octave_idx_type nr = m.rows ();
+  octave_idx_type a_nc = a.cols ();
+
+  RET_TYPE retval (nr, a_nc, static_cast<octave_idx_type> (0));
+  retval.xcidx (0) = 0;
+
+#pragma omp parallel num_threads (nthreads)
+  {
+    OCTAVE_LOCAL_BUFFER (octave_idx_type, w, nr);
+    for (octave_idx_type i = 0; i < nr; i++)
+      w[i] = 0;
+
+#pragma omp for schedule (static)
+    for (octave_idx_type i = 0; i < a_nc; i++)
+      {
+        octave_idx_type count = 0;
+        for (octave_idx_type j = a.cidx (i); j < a.cidx (i+1); j++)
+          {
+            octave_idx_type col = a.ridx (j);
+            for (octave_idx_type k = m.cidx (col); k < m.cidx (col+1); k++)
+              {
+                if (w[m.ridx (k)] < i + 1)
+                  {
+                    w[m.ridx (k)] = i + 1;
+                    count++;
+                  }
+              }
+          }
+        retval.xcidx (i+1) = count;
+      }
+  }
+
+  octave_quit ();
+
+  octave_idx_type nel = 0;
+  for (octave_idx_type i = 0; i < a_nc; i++)
+    {
+      nel += retval.xcidx (i+1);
+      retval.xcidx (i+1) = nel;
+    }
+
+  if (nel == 0)
+    return RET_TYPE (nr, a_nc);
+
+  retval.change_capacity (nel);
+
+  octave_idx_type *ri = retval.xridx ();
+
+#pragma omp parallel num_threads (nthreads)
+  {
+    OCTAVE_LOCAL_BUFFER (octave_idx_type, w, nr);
+    for (octave_idx_type i = 0; i < nr; i++)
+      w[i] = 0;
+
+    OCTAVE_LOCAL_BUFFER (RET_EL_TYPE, Xcol, nr);
+
+    octave_sort<octave_idx_type> sort;
+
+#pragma omp for schedule (static)
+    for (octave_idx_type i = 0; i < a_nc; i++)
+      {
+        octave_idx_type ii = retval.xcidx (i);
+
+        for (octave_idx_type j = a.cidx (i); j < a.cidx (i+1); j++)
+          {
+            octave_idx_type col = a.ridx (j);
+            EL_TYPE tmpval = a.data (j);
+            for (octave_idx_type k = m.cidx (col); k < m.cidx (col+1); k++)
+              {
+                octave_idx_type row = m.ridx (k);
+                if (w[row] < i + 1)
+                  {
+                    w[row] = i + 1;
+                    retval.xridx (ii++) = row;
+                    Xcol[row] = tmpval * m.data (k);
+                  }
+                else
+                  Xcol[row] += tmpval * m.data (k);
+              }
+          }
+
+        sort.sort (ri + retval.xcidx (i), ii - retval.xcidx (i));
+        for (octave_idx_type k = retval.xcidx (i); k < ii; k++)
+          retval.xdata (k) = Xcol[retval.xridx (k)];
+      }
+  }
+
+  octave_quit ();
+
+  retval.maybe_compress (true);
+  return retval;
+}
+
+// Sparse-matrix times dense-vector product with the matrix columns
+// partitioned so that each thread covers about the same number of
+// nonzeros.  The compressed-column matvec scatters into the result,
+// so each thread accumulates into a private column which a second,
+// row-partitioned pass sums into the result.  The per-row sums are
+// regrouped relative to the serial loop, so floating point results
+// may differ in the last bits.
+
+template <typename RET_TYPE, typename EL_TYPE,
+          typename M_TYPE, typename A_TYPE>
+RET_TYPE
+sparse_full_vector_mul_threaded (const M_TYPE& m, const A_TYPE& a,
+                                 int nthreads)
+{
+  typedef typename RET_TYPE::element_type RET_EL_TYPE;
+
+  octave_idx_type nr = m.rows ();
+  octave_idx_type nc = m.cols ();
+  octave_idx_type nz = m.nnz ();
+
+  RET_TYPE retval (nr, 1);
+  RET_EL_TYPE *rv = retval.fortran_vec ();
+
+  // Column ranges holding roughly equal numbers of nonzeros; a single
+  // very dense column is not split further.
+
+  const octave_idx_type *cidx = m.cidx ();
+
+  OCTAVE_LOCAL_BUFFER (octave_idx_type, cbound, nthreads + 1);
+
+  cbound[0] = 0;
+  cbound[nthreads] = nc;
+
+  for (int t = 1; t < nthreads; t++)
+    {
+      octave_idx_type target = ((nz / nthreads) * t
+                                + std::min (static_cast<octave_idx_type> (t),
+                                            nz % nthreads));
+      octave_idx_type j = std::lower_bound (cidx, cidx + nc + 1, target) - cidx;
+      cbound[t] = std::max (j, cbound[t-1]);
+    }
+
+  OCTAVE_LOCAL_BUFFER (RET_EL_TYPE, acc, nr * nthreads);
+
+#pragma omp parallel num_threads (nthreads)
+  {
+#pragma omp for schedule (static)
+    for (int t = 0; t < nthreads; t++)
+      {
+        RET_EL_TYPE *y = acc + t * nr;
+
+        for (octave_idx_type i = 0; i < nr; i++)
+          y[i] = RET_EL_TYPE ();
+
+        for (octave_idx_type j = cbound[t]; j < cbound[t+1]; j++)
+          {
+            EL_TYPE tmpval = a.elem (j, 0);
+            for (octave_idx_type k = m.cidx (j); k < m.cidx (j+1); k++)
+              y[m.ridx (k)] += tmpval * m.data (k);
+          }
+      }
+
+#pragma omp for schedule (static)
+    for (octave_idx_type i = 0; i < nr; i++)
+      {
+        RET_EL_TYPE s = acc[i];
+        for (int t = 1; t < nthreads; t++)
+          s += acc[i + t * nr];
+        rv[i] = s;
+      }
+  }
+
+  return retval;
+}
+
+#endif
+
+#if defined (_OPENMP)
+#  define SPARSE_SPARSE_MUL_THREADED(RET_TYPE, RET_EL_TYPE, EL_TYPE)    \
+  {                                                                     \
+    int threads = sparse_mul_nthreads (m.nnz () + a.nnz ());            \
+    if (threads > 1)                                                    \
+      return sparse_sparse_mul_threaded<RET_TYPE, RET_EL_TYPE,          \
+                                        EL_TYPE> (m, a, threads);       \
+  }
+#else
+#  define SPARSE_SPARSE_MUL_THREADED(RET_TYPE, RET_EL_TYPE, EL_TYPE)
+#endif
+
+#if defined (_OPENMP)
+#  define SPARSE_FULL_VECTOR_MUL_THREADED(RET_TYPE, EL_TYPE)            \
+  {                                                                     \
+    int threads = sparse_mul_nthreads (m.nnz () + a.numel ());          \
+    if (threads > 1 && a_nc == 1 && nr > 1)                             \
+      return sparse_full_vector_mul_threaded<RET_TYPE,                  \
+                                             EL_TYPE> (m, a, threads);  \
+  }
+#else
+#  define SPARSE_FULL_VECTOR_MUL_THREADED(RET_TYPE, EL_TYPE)
+#endif
+
+// Work-share the column loop of a product across the worker threads.
+// The loop must use a local variable named "threads" for the count.
+
+#if defined (_OPENMP)
+#  define OCTAVE_SPARSE_OMP_FOR                                         \
+  _Pragma ("omp parallel for schedule (static) num_threads (threads)")
+#else
+#  define OCTAVE_SPARSE_OMP_FOR
+#endif
+
 #define SPARSE_SPARSE_MUL(RET_TYPE, RET_EL_TYPE, EL_TYPE)               \
   octave_idx_type nr = m.rows ();                                       \
   octave_idx_type nc = m.cols ();                                       \
@@ -1813,6 +2068,8 @@
     octave::err_nonconformant ("operator *", nr, nc, a_nr, a_nc);               \
   else                                                                  \
     {                                                                   \
+      SPARSE_SPARSE_MUL_THREADED (RET_TYPE, RET_EL_TYPE, EL_TYPE);      \
+                                                                        \
       OCTAVE_LOCAL_BUFFER (octave_idx_type, w, nr);                     \
       RET_TYPE retval (nr, a_nc, static_cast<octave_idx_type> (0));     \
       for (octave_idx_type i = 0; i < nr; i++)                          \
@@ -1942,19 +2199,42 @@
     octave::err_nonconformant ("operator *", nr, nc, a_nr, a_nc);               \
   else                                                                  \
     {                                                                   \
+      SPARSE_FULL_VECTOR_MUL_THREADED (RET_TYPE, EL_TYPE)               \
+                                                                        \
       RET_TYPE::element_type zero = RET_TYPE::element_type ();          \
                                                                         \
       RET_TYPE retval (nr, a_nc, zero);                                 \
                                                                         \
-      for (octave_idx_type i = 0; i < a_nc ; i++)                       \
+      int threads = sparse_mul_nthreads (m.nnz () + a.numel ());        \
+                                                                        \
+      if (threads > 1)                                                  \
         {                                                               \
-          for (octave_idx_type j = 0; j < a_nr; j++)                    \
+          /* Output columns are disjoint, so no locking is needed.  */  \
+          OCTAVE_SPARSE_OMP_FOR                                         \
+          for (octave_idx_type i = 0; i < a_nc ; i++)                   \
             {                                                           \
-              octave_quit ();                                           \
+              for (octave_idx_type j = 0; j < a_nr; j++)                \
+                {                                                       \
+                  EL_TYPE tmpval = a.elem (j,i);                        \
+                  for (octave_idx_type k = m.cidx (j) ;                 \
+                       k < m.cidx (j+1); k++)                           \
+                    retval.xelem (m.ridx (k),i) += tmpval * m.data (k); \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          for (octave_idx_type i = 0; i < a_nc ; i++)                   \
+            {                                                           \
+              for (octave_idx_type j = 0; j < a_nr; j++)                \
+                {                                                       \
+                  octave_quit ();                                       \
                                                                         \
-              EL_TYPE tmpval = a.elem (j,i);                            \
-              for (octave_idx_type k = m.cidx (j) ; k < m.cidx (j+1); k++) \
-                retval.elem (m.ridx (k),i) += tmpval * m.data (k);      \
+                  EL_TYPE tmpval = a.elem (j,i);                        \
+                  for (octave_idx_type k = m.cidx (j) ;                 \
+                       k < m.cidx (j+1); k++)                           \
+                    retval.elem (m.ridx (k),i) += tmpval * m.data (k);  \
+                }                                                       \
             }                                                           \
         }                                                               \
       return retval;                                                    \
@@ -1978,16 +2258,39 @@
     {                                                                   \
       RET_TYPE retval (nc, a_nc);                                       \
                                                                         \
-      for (octave_idx_type i = 0; i < a_nc ; i++)                       \
+      int threads = sparse_mul_nthreads (m.nnz () + a.numel ());        \
+                                                                        \
+      if (threads > 1)                                                  \
         {                                                               \
-          for (octave_idx_type j = 0; j < nc; j++)                      \
+          /* Each result element is an independent dot product, so */   \
+          /* sharing the row loop does not regroup any sums.  */        \
+          for (octave_idx_type i = 0; i < a_nc ; i++)                   \
             {                                                           \
-              octave_quit ();                                           \
+              OCTAVE_SPARSE_OMP_FOR                                     \
+              for (octave_idx_type j = 0; j < nc; j++)                  \
+                {                                                       \
+                  EL_TYPE acc = EL_TYPE ();                             \
+                  for (octave_idx_type k = m.cidx (j) ;                 \
+                       k < m.cidx (j+1); k++)                           \
+                    acc += a.elem (m.ridx (k),i) * CONJ_OP (m.data (k)); \
+                  retval.xelem (j,i) = acc;                             \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          for (octave_idx_type i = 0; i < a_nc ; i++)                   \
+            {                                                           \
+              for (octave_idx_type j = 0; j < nc; j++)                  \
+                {                                                       \
+                  octave_quit ();                                       \
                                                                         \
-              EL_TYPE acc = EL_TYPE ();                                 \
-              for (octave_idx_type k = m.cidx (j) ; k < m.cidx (j+1); k++) \
-                acc += a.elem (m.ridx (k),i) * CONJ_OP (m.data (k));    \
-              retval.xelem (j,i) = acc;                                 \
+                  EL_TYPE acc = EL_TYPE ();                             \
+                  for (octave_idx_type k = m.cidx (j) ;                 \
+                       k < m.cidx (j+1); k++)                           \
+                    acc += a.elem (m.ridx (k),i) * CONJ_OP (m.data (k)); \
+                  retval.xelem (j,i) = acc;                             \
+                }                                                       \
             }                                                           \
         }                                                               \
       return retval;                                                    \
@@ -56,6 +56,7 @@ LIBOCTAVE_OPERATORS_INC = \
   %reldir%/mx-ext.h \
   %reldir%/mx-op-decl.h \
   %reldir%/mx-op-defs.h \
+  %reldir%/mx-simd.h \
   %reldir%/Sparse-diag-op-defs.h \
   %reldir%/Sparse-op-decls.h \
   %reldir%/Sparse-op-defs.h \
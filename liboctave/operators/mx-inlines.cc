@@ -33,6 +33,8 @@
 #include <cmath>
 
 #include <algorithm>
+#include <limits>
+#include <type_traits>
 
 #include "Array-util.h"
 #include "Array.h"
@@ -40,6 +42,9 @@
 #include "oct-cmplx.h"
 #include "oct-inttypes-fwd.h"
 #include "oct-locbuf.h"
+#include "oct-parallel.h"
+
+#include "mx-simd.h"
 
 // Provides some commonly repeated, basic loop templates.
 
@@ -52,8 +57,10 @@ inline void mx_inline_fill (std::size_t n, R *r, S s)
 
 template <typename R, typename X>
 inline void
-mx_inline_uminus (std::size_t n, R *r, const X *x)
+mx_inline_uminus (std::size_t n, R * OCTAVE_SIMD_RESTRICT r,
+                  const X * OCTAVE_SIMD_RESTRICT x)
 {
+  OCTAVE_SIMD_LOOP
   for (std::size_t i = 0; i < n; i++)
     r[i] = -x[i];
 }
@@ -62,6 +69,7 @@ template <typename R>
 inline void
 mx_inline_uminus2 (std::size_t n, R *r)
 {
+  OCTAVE_SIMD_LOOP
   for (std::size_t i = 0; i < n; i++)
     r[i] = -r[i];
 }
@@ -86,20 +94,27 @@ mx_inline_notzero (std::size_t n, bool *r, const X *x)
 
 #define DEFMXBINOP(F, OP)                                       \
   template <typename R, typename X, typename Y>                 \
-  inline void F (std::size_t n, R *r, const X *x, const Y *y)   \
+  inline void F (std::size_t n, R * OCTAVE_SIMD_RESTRICT r,     \
+                 const X * OCTAVE_SIMD_RESTRICT x,              \
+                 const Y * OCTAVE_SIMD_RESTRICT y)              \
   {                                                             \
+    OCTAVE_SIMD_LOOP                                            \
     for (std::size_t i = 0; i < n; i++)                         \
       r[i] = x[i] OP y[i];                                      \
   }                                                             \
   template <typename R, typename X, typename Y>                 \
-  inline void F (std::size_t n, R *r, const X *x, Y y)          \
+  inline void F (std::size_t n, R * OCTAVE_SIMD_RESTRICT r,     \
+                 const X * OCTAVE_SIMD_RESTRICT x, Y y)         \
   {                                                             \
+    OCTAVE_SIMD_LOOP                                            \
     for (std::size_t i = 0; i < n; i++)                         \
       r[i] = x[i] OP y;                                         \
   }                                                             \
   template <typename R, typename X, typename Y>                 \
-  inline void F (std::size_t n, R *r, X x, const Y *y)          \
+  inline void F (std::size_t n, R * OCTAVE_SIMD_RESTRICT r,     \
+                 X x, const Y * OCTAVE_SIMD_RESTRICT y)         \
   {                                                             \
+    OCTAVE_SIMD_LOOP                                            \
     for (std::size_t i = 0; i < n; i++)                         \
       r[i] = x OP y[i];                                         \
   }
@@ -109,18 +124,110 @@ DEFMXBINOP (mx_inline_sub, -)
 DEFMXBINOP (mx_inline_mul, *)
 DEFMXBINOP (mx_inline_div, /)
 
-#define DEFMXBINOPEQ(F, OP)                             \
-  template <typename R, typename X>                     \
-  inline void F (std::size_t n, R *r, const X *x)       \
-  {                                                     \
-    for (std::size_t i = 0; i < n; i++)                 \
-      r[i] OP x[i];                                     \
-  }                                                     \
-  template <typename R, typename X>                     \
-  inline void F (std::size_t n, R *r, X x)              \
-  {                                                     \
-    for (std::size_t i = 0; i < n; i++)                 \
-      r[i] OP x;                                        \
+// Saturating add and subtract for the 8- and 16-bit integer element
+// types, written branch-free so the vectorizer can map them onto the
+// saturating SIMD instructions (the PADDSB/PADDSW/PADDUSB family).
+// The generic octave_int operators saturate through compare-and-branch
+// logic that defeats vectorization.  Multiplication keeps the generic
+// path; it has no single-instruction saturating form.
+
+template <typename T>
+inline T
+mx_sat_add (T x, T y)
+{
+  if (std::is_signed<T>::value)
+    {
+      int s = int (x) + int (y);
+      int lo = int (std::numeric_limits<T>::min ());
+      int hi = int (std::numeric_limits<T>::max ());
+
+      return T (s < lo ? lo : (s > hi ? hi : s));
+    }
+  else
+    {
+      T s = T (x + y);
+
+      return (s < x ? std::numeric_limits<T>::max () : s);
+    }
+}
+
+template <typename T>
+inline T
+mx_sat_sub (T x, T y)
+{
+  if (std::is_signed<T>::value)
+    {
+      int d = int (x) - int (y);
+      int lo = int (std::numeric_limits<T>::min ());
+      int hi = int (std::numeric_limits<T>::max ());
+
+      return T (d < lo ? lo : (d > hi ? hi : d));
+    }
+  else
+    {
+      T d = T (x - y);
+
+      return (d > x ? T (0) : d);
+    }
+}
+
+// The enable_if constraint lives in a default template parameter, not
+// the return type, so that taking the address of these functions (as
+// the bsxfun loop tables do) still finds a unique best overload.
+
+#define DEFMXSATBINOP(F, SATF)                                          \
+  template <typename T,                                                 \
+            typename std::enable_if<(sizeof (T) <= 2), int>::type = 0>  \
+  inline void                                                           \
+  F (std::size_t n, octave_int<T> * OCTAVE_SIMD_RESTRICT r,             \
+     const octave_int<T> * OCTAVE_SIMD_RESTRICT x,                      \
+     const octave_int<T> * OCTAVE_SIMD_RESTRICT y)                      \
+  {                                                                     \
+    OCTAVE_SIMD_LOOP                                                    \
+    for (std::size_t i = 0; i < n; i++)                                 \
+      r[i] = octave_int<T> (SATF (x[i].value (), y[i].value ()));       \
+  }                                                                     \
+  template <typename T,                                                 \
+            typename std::enable_if<(sizeof (T) <= 2), int>::type = 0>  \
+  inline void                                                           \
+  F (std::size_t n, octave_int<T> * OCTAVE_SIMD_RESTRICT r,             \
+     const octave_int<T> * OCTAVE_SIMD_RESTRICT x, octave_int<T> y)     \
+  {                                                                     \
+    const T yv = y.value ();                                            \
+    OCTAVE_SIMD_LOOP                                                    \
+    for (std::size_t i = 0; i < n; i++)                                 \
+      r[i] = octave_int<T> (SATF (x[i].value (), yv));                  \
+  }                                                                     \
+  template <typename T,                                                 \
+            typename std::enable_if<(sizeof (T) <= 2), int>::type = 0>  \
+  inline void                                                           \
+  F (std::size_t n, octave_int<T> * OCTAVE_SIMD_RESTRICT r,             \
+     octave_int<T> x, const octave_int<T> * OCTAVE_SIMD_RESTRICT y)     \
+  {                                                                     \
+    const T xv = x.value ();                                            \
+    OCTAVE_SIMD_LOOP                                                    \
+    for (std::size_t i = 0; i < n; i++)                                 \
+      r[i] = octave_int<T> (SATF (xv, y[i].value ()));                  \
+  }
+
+DEFMXSATBINOP (mx_inline_add, mx_sat_add)
+DEFMXSATBINOP (mx_inline_sub, mx_sat_sub)
+
+#define DEFMXBINOPEQ(F, OP)                                     \
+  template <typename R, typename X>                             \
+  inline void F (std::size_t n, R * OCTAVE_SIMD_RESTRICT r,     \
+                 const X * OCTAVE_SIMD_RESTRICT x)              \
+  {                                                             \
+    OCTAVE_SIMD_LOOP                                            \
+    for (std::size_t i = 0; i < n; i++)                         \
+      r[i] OP x[i];                                             \
+  }                                                             \
+  template <typename R, typename X>                             \
+  inline void F (std::size_t n, R * OCTAVE_SIMD_RESTRICT r, X x) \
+  {                                                             \
+    OCTAVE_SIMD_LOOP                                            \
+    for (std::size_t i = 0; i < n; i++)                         \
+      r[i] OP x;                                                \
   }
 
 DEFMXBINOPEQ (mx_inline_add2, +=)
@@ -130,20 +237,27 @@ DEFMXBINOPEQ (mx_inline_div2, /=)
 
 #define DEFMXCMPOP(F, OP)                                               \
   template <typename X, typename Y>                                     \
-  inline void F (std::size_t n, bool *r, const X *x, const Y *y)        \
+  inline void F (std::size_t n, bool * OCTAVE_SIMD_RESTRICT r,          \
+                 const X * OCTAVE_SIMD_RESTRICT x,                      \
+                 const Y * OCTAVE_SIMD_RESTRICT y)                      \
   {                                                                     \
+    OCTAVE_SIMD_LOOP                                                    \
     for (std::size_t i = 0; i < n; i++)                                 \
       r[i] = x[i] OP y[i];                                              \
   }                                                                     \
   template <typename X, typename Y>                                     \
-  inline void F (std::size_t n, bool *r, const X *x, Y y)               \
+  inline void F (std::size_t n, bool * OCTAVE_SIMD_RESTRICT r,          \
+                 const X * OCTAVE_SIMD_RESTRICT x, Y y)                 \
   {                                                                     \
+    OCTAVE_SIMD_LOOP                                                    \
     for (std::size_t i = 0; i < n; i++)                                 \
       r[i] = x[i] OP y;                                                 \
   }                                                                     \
   template <typename X, typename Y>                                     \
-  inline void F (std::size_t n, bool *r, X x, const Y *y)               \
+  inline void F (std::size_t n, bool * OCTAVE_SIMD_RESTRICT r,          \
+                 X x, const Y * OCTAVE_SIMD_RESTRICT y)                 \
   {                                                                     \
+    OCTAVE_SIMD_LOOP                                                    \
     for (std::size_t i = 0; i < n; i++)                                 \
       r[i] = x OP y[i];                                                 \
   }
@@ -318,15 +432,19 @@ mx_inline_all_real (std::size_t n, const std::complex<T>* x)
 }
 
 template <typename T>
-inline void mx_inline_real (std::size_t n, T *r, const std::complex<T>* x)
+inline void mx_inline_real (std::size_t n, T * OCTAVE_SIMD_RESTRICT r,
+                            const std::complex<T>* OCTAVE_SIMD_RESTRICT x)
 {
+  OCTAVE_SIMD_LOOP
   for (std::size_t i = 0; i < n; i++)
     r[i] = x[i].real ();
 }
 
 template <typename T>
-inline void mx_inline_imag (std::size_t n, T *r, const std::complex<T>* x)
+inline void mx_inline_imag (std::size_t n, T * OCTAVE_SIMD_RESTRICT r,
+                            const std::complex<T>* OCTAVE_SIMD_RESTRICT x)
 {
+  OCTAVE_SIMD_LOOP
   for (std::size_t i = 0; i < n; i++)
     r[i] = x[i].imag ();
 }
@@ -464,7 +582,11 @@ do_mx_unary_op (const Array<X>& x,
                 void (*op) (std::size_t, R *, const X *))
 {
   Array<R> r (x.dims ());
-  op (r.numel (), r.fortran_vec (), x.data ());
+  R *rv = r.fortran_vec ();
+  const X *xv = x.data ();
+  octave::chunked_parallel_for (r.numel (),
+                                [=] (octave_idx_type beg, octave_idx_type len)
+                                { op (len, rv + beg, xv + beg); });
   return r;
 }
 
@@ -489,7 +611,10 @@ inline Array<R>&
 do_mx_inplace_op (Array<R>& r,
                   void (*op) (std::size_t, R *))
 {
-  op (r.numel (), r.fortran_vec ());
+  R *rv = r.fortran_vec ();
+  octave::chunked_parallel_for (r.numel (),
+                                [=] (octave_idx_type beg, octave_idx_type len)
+                                { op (len, rv + beg); });
   return r;
 }
 
@@ -506,7 +631,14 @@ do_mm_binary_op (const Array<X>& x, const Array<Y>& y,
   if (dx == dy)
     {
       Array<R> r (dx);
-      op (r.numel (), r.fortran_vec (), x.data (), y.data ());
+      R *rv = r.fortran_vec ();
+      const X *xv = x.data ();
+      const Y *yv = y.data ();
+      octave::chunked_parallel_for (r.numel (),
+                                    [=] (octave_idx_type beg,
+                                         octave_idx_type len)
+                                    { op (len, rv + beg, xv + beg,
+                                          yv + beg); });
       return r;
     }
   else if (is_valid_bsxfun (opname, dx, dy))
@@ -523,7 +655,11 @@ do_ms_binary_op (const Array<X>& x, const Y& y,
                  void (*op) (std::size_t, R *, const X *, Y))
 {
   Array<R> r (x.dims ());
-  op (r.numel (), r.fortran_vec (), x.data (), y);
+  R *rv = r.fortran_vec ();
+  const X *xv = x.data ();
+  octave::chunked_parallel_for (r.numel (),
+                                [=] (octave_idx_type beg, octave_idx_type len)
+                                { op (len, rv + beg, xv + beg, y); });
   return r;
 }
 
@@ -533,7 +669,11 @@ do_sm_binary_op (const X& x, const Array<Y>& y,
                  void (*op) (std::size_t, R *, X, const Y *))
 {
   Array<R> r (y.dims ());
-  op (r.numel (), r.fortran_vec (), x, y.data ());
+  R *rv = r.fortran_vec ();
+  const Y *yv = y.data ();
+  octave::chunked_parallel_for (r.numel (),
+                                [=] (octave_idx_type beg, octave_idx_type len)
+                                { op (len, rv + beg, x, yv + beg); });
   return r;
 }
 
@@ -547,7 +687,14 @@ do_mm_inplace_op (Array<R>& r, const Array<X>& x,
   dim_vector dr = r.dims ();
   dim_vector dx = x.dims ();
   if (dr == dx)
-    op (r.numel (), r.fortran_vec (), x.data ());
+    {
+      R *rv = r.fortran_vec ();
+      const X *xv = x.data ();
+      octave::chunked_parallel_for (r.numel (),
+                                    [=] (octave_idx_type beg,
+                                         octave_idx_type len)
+                                    { op (len, rv + beg, xv + beg); });
+    }
   else if (is_valid_inplace_bsxfun (opname, dr, dx))
     do_inplace_bsxfun_op (r, x, op, op1);
   else
@@ -759,6 +906,63 @@ OP_RED_FCN (mx_inline_sumsq, std::complex<T>, T, OP_RED_SUMSQC, 0)
 OP_RED_FCN (mx_inline_any, T, bool, OP_RED_ANYC, false)
 OP_RED_FCN (mx_inline_all, T, bool, OP_RED_ALLC, true)
 
+// Leaf size of the blocked pairwise summation below.
+enum { MX_PAIRWISE_BLOCK = 1024 };
+
+// Blocked pairwise summation.  Within a leaf block, four independent
+// accumulator lanes break the addition dependency chain so the compiler
+// can vectorize; blocks are then combined pairwise, which bounds the
+// rounding error growth by O (log n) instead of the O (n) of a single
+// running accumulator.  This replaces mx_inline_sum for floating-point
+// element types only: integer sums must keep the serial order because
+// octave_int arithmetic saturates, so reassociation could change their
+// result.
+
+template <typename T>
+inline T
+mx_inline_pairwise_sum (const T *v, octave_idx_type n)
+{
+  if (n <= MX_PAIRWISE_BLOCK)
+    {
+      T a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+
+      octave_idx_type n4 = n - (n & 3);
+      octave_idx_type i;
+      for (i = 0; i < n4; i += 4)
+        {
+          a0 += v[i];
+          a1 += v[i+1];
+          a2 += v[i+2];
+          a3 += v[i+3];
+        }
+      for (; i < n; i++)
+        a0 += v[i];
+
+      return (a0 + a1) + (a2 + a3);
+    }
+
+  // Split at a multiple of the leaf size so that recursion produces
+  // full blocks.
+  octave_idx_type nhalf
+    = ((n/2 + MX_PAIRWISE_BLOCK - 1) / MX_PAIRWISE_BLOCK) * MX_PAIRWISE_BLOCK;
+
+  return (mx_inline_pairwise_sum (v, nhalf)
+          + mx_inline_pairwise_sum (v + nhalf, n - nhalf));
+}
+
+#define OP_RED_SUM_PAIRWISE(T)                          \
+  template <>                                           \
+  inline T                                              \
+  mx_inline_sum (const T *v, octave_idx_type n)         \
+  {                                                     \
+    return mx_inline_pairwise_sum (v, n);               \
+  }
+
+OP_RED_SUM_PAIRWISE (double)
+OP_RED_SUM_PAIRWISE (float)
+OP_RED_SUM_PAIRWISE (Complex)
+OP_RED_SUM_PAIRWISE (FloatComplex)
+
 #define OP_RED_FCN2(F, TSRC, TRES, OP, ZERO)                            \
   template <typename T>                                                 \
   inline void                                                           \
@@ -824,7 +1028,67 @@ OP_RED_FCN2 (mx_inline_all_r, T, bool, OP_RED_ALLR, true)
 OP_ROW_SHORT_CIRCUIT (mx_inline_any, xis_true, false)
 OP_ROW_SHORT_CIRCUIT (mx_inline_all, xis_false, true)
 
-#define OP_RED_FCNN(F, TSRC, TRES)              \
+// Combining per-chunk partial results of the reductions above.  Note
+// that the partials of the squared and double-precision sums are
+// combined with a plain addition.
+#define OP_RED_COMB_SUM(ac, el) ac += el
+#define OP_RED_COMB_PROD(ac, el) ac *= el
+#define OP_RED_COMB_OR(ac, el) ac |= el
+#define OP_RED_COMB_AND(ac, el) ac &= el
+
+// Tree-reduction engine for a single flat reduction: compute partial
+// reductions over contiguous chunks, one per thread, then combine the
+// partials in chunk order.  The result is deterministic for a given
+// thread count, but for floating-point sums and products the grouping
+// (and hence the rounding) differs from the serial loop.  Like
+// chunked_parallel_for, this is controlled by the OCTAVE_NUM_THREADS
+// and OCTAVE_PARALLEL_THRESHOLD environment variables.
+
+template <typename TRES, typename TSRC, typename RED, typename COMB>
+inline TRES
+mx_red_flat (const TSRC *v, octave_idx_type n, RED red, COMB comb)
+{
+#if defined (_OPENMP)
+
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+
+  if (threshold > 0 && n >= threshold)
+    {
+      int nthreads = octave::parallel_num_threads ();
+
+      if (nthreads > 1)
+        {
+          octave_idx_type chunk = (n + nthreads - 1) / nthreads;
+          int nchunks = static_cast<int> ((n + chunk - 1) / chunk);
+
+          OCTAVE_LOCAL_BUFFER (TRES, parts, nchunks);
+
+#         pragma omp parallel for num_threads (nthreads) schedule (static)
+          for (int t = 0; t < nchunks; t++)
+            {
+              octave_idx_type beg = t * chunk;
+              octave_idx_type len = (beg + chunk <= n ? chunk : n - beg);
+              parts[t] = red (v + beg, len);
+            }
+
+          TRES ac = parts[0];
+          for (int t = 1; t < nchunks; t++)
+            comb (ac, parts[t]);
+
+          return ac;
+        }
+    }
+
+#else
+
+  octave_unused_parameter (comb);
+
+#endif
+
+  return red (v, n);
+}
+
+#define OP_RED_FCNN(F, TSRC, TRES, COMB)        \
   template <typename T>                         \
   inline void                                   \
   F (const TSRC *v, TRES *r, octave_idx_type l, \
@@ -834,7 +1098,13 @@ OP_ROW_SHORT_CIRCUIT (mx_inline_all, xis_false, true)
       {                                         \
         for (octave_idx_type i = 0; i < u; i++) \
           {                                     \
-            r[i] = F<T> (v, n);                 \
+            r[i] = mx_red_flat<TRES> (v, n,     \
+                     [] (const TSRC *w,         \
+                         octave_idx_type m)     \
+                     { return F<T> (w, m); },   \
+                     [] (TRES& ac,              \
+                         const TRES& el)        \
+                     { COMB (ac, el); });       \
             v += n;                             \
           }                                     \
       }                                         \
@@ -849,51 +1119,113 @@ OP_ROW_SHORT_CIRCUIT (mx_inline_all, xis_false, true)
       }                                         \
   }
 
-OP_RED_FCNN (mx_inline_sum, T, T)
-OP_RED_FCNN (mx_inline_dsum, T, PROMOTE_DOUBLE(T))
-OP_RED_FCNN (mx_inline_count, bool, T)
-OP_RED_FCNN (mx_inline_prod, T, T)
-OP_RED_FCNN (mx_inline_dprod, T, PROMOTE_DOUBLE(T))
-OP_RED_FCNN (mx_inline_sumsq, T, T)
-OP_RED_FCNN (mx_inline_sumsq, std::complex<T>, T)
-OP_RED_FCNN (mx_inline_any, T, bool)
-OP_RED_FCNN (mx_inline_all, T, bool)
-
-#define OP_CUM_FCN(F, TSRC, TRES, OP)           \
-  template <typename T>                         \
-  inline void                                   \
-  F (const TSRC *v, TRES *r, octave_idx_type n) \
-  {                                             \
-    if (n)                                      \
-      {                                         \
-        TRES t = r[0] = v[0];                   \
-        for (octave_idx_type i = 1; i < n; i++) \
-          r[i] = t = t OP v[i];                 \
-      }                                         \
+OP_RED_FCNN (mx_inline_sum, T, T, OP_RED_COMB_SUM)
+OP_RED_FCNN (mx_inline_dsum, T, PROMOTE_DOUBLE(T), OP_RED_COMB_SUM)
+OP_RED_FCNN (mx_inline_count, bool, T, OP_RED_COMB_SUM)
+OP_RED_FCNN (mx_inline_prod, T, T, OP_RED_COMB_PROD)
+OP_RED_FCNN (mx_inline_dprod, T, PROMOTE_DOUBLE(T), OP_RED_COMB_PROD)
+OP_RED_FCNN (mx_inline_sumsq, T, T, OP_RED_COMB_SUM)
+OP_RED_FCNN (mx_inline_sumsq, std::complex<T>, T, OP_RED_COMB_SUM)
+OP_RED_FCNN (mx_inline_any, T, bool, OP_RED_COMB_OR)
+OP_RED_FCNN (mx_inline_all, T, bool, OP_RED_COMB_AND)
+
+// A cumulative scan carries a loop dependency, so a long vector cannot
+// be chunked directly.  The parallel form below scans each block
+// independently, combines the per-block totals into carry-in values,
+// and then folds the carries in over a second pass.  For floating
+// point types, every element beyond the first block absorbs one extra
+// rounding compared with the serial scan.
+
+#define OP_CUM_FCN(F, TSRC, TRES, OP)                                   \
+  template <typename T>                                                 \
+  inline void                                                           \
+  F ## _serial (const TSRC *v, TRES *r, octave_idx_type n)              \
+  {                                                                     \
+    if (n)                                                              \
+      {                                                                 \
+        TRES t = r[0] = v[0];                                           \
+        for (octave_idx_type i = 1; i < n; i++)                         \
+          r[i] = t = t OP v[i];                                         \
+      }                                                                 \
+  }                                                                     \
+  template <typename T>                                                 \
+  inline void                                                           \
+  F (const TSRC *v, TRES *r, octave_idx_type n)                         \
+  {                                                                     \
+    octave_idx_type threshold = octave::parallel_numel_threshold ();    \
+    octave_idx_type nb = octave::parallel_num_threads ();               \
+    if (threshold <= 0 || n < threshold || nb < 2)                      \
+      {                                                                 \
+        F ## _serial (v, r, n);                                         \
+        return;                                                         \
+      }                                                                 \
+    octave_idx_type bsz = (n + nb - 1) / nb;                            \
+    nb = (n + bsz - 1) / bsz;                                           \
+    octave::chunked_parallel_for                                        \
+      (nb, n, [=] (octave_idx_type beg, octave_idx_type len)            \
+       {                                                                \
+         for (octave_idx_type b = beg; b < beg + len; b++)              \
+           {                                                            \
+             octave_idx_type o = b * bsz;                               \
+             octave_idx_type e = (o + bsz <= n ? o + bsz : n);          \
+             F ## _serial (v + o, r + o, e - o);                        \
+           }                                                            \
+       });                                                              \
+    OCTAVE_LOCAL_BUFFER (TRES, carry, nb);                              \
+    carry[0] = r[bsz - 1];                                              \
+    for (octave_idx_type b = 1; b < nb - 1; b++)                        \
+      carry[b] = carry[b-1] OP r[(b + 1) * bsz - 1];                    \
+    octave::chunked_parallel_for                                        \
+      (nb - 1, n, [=] (octave_idx_type beg, octave_idx_type len)        \
+       {                                                                \
+         for (octave_idx_type bb = beg; bb < beg + len; bb++)           \
+           {                                                            \
+             TRES c = carry[bb];                                        \
+             octave_idx_type o = (bb + 1) * bsz;                        \
+             octave_idx_type e = (o + bsz <= n ? o + bsz : n);          \
+             for (octave_idx_type i = o; i < e; i++)                    \
+               r[i] = c OP r[i];                                        \
+           }                                                            \
+       });                                                              \
   }
 
 OP_CUM_FCN (mx_inline_cumsum, T, T, +)
 OP_CUM_FCN (mx_inline_cumprod, T, T, *)
 OP_CUM_FCN (mx_inline_cumcount, bool, T, +)
 
+// Scanning along a non-leading dimension has no dependency between the
+// M interleaved rows, so they are split across threads; the strided
+// core keeps the unit-stride inner loop over the leading dimension for
+// whatever subset of rows a thread is given, producing bitwise
+// identical results regardless of the split.
+
 #define OP_CUM_FCN2(F, TSRC, TRES, OP)                                  \
   template <typename T>                                                 \
   inline void                                                           \
-  F (const TSRC *v, TRES *r, octave_idx_type m, octave_idx_type n)      \
+  F ## _strided (const TSRC *v, TRES *r, octave_idx_type m,             \
+                 octave_idx_type n, octave_idx_type stride)             \
   {                                                                     \
     if (n)                                                              \
       {                                                                 \
         for (octave_idx_type i = 0; i < m; i++)                         \
           r[i] = v[i];                                                  \
-        const T *r0 = r;                                                \
+        const TRES *r0 = r;                                             \
         for (octave_idx_type j = 1; j < n; j++)                         \
           {                                                             \
-            r += m; v += m;                                             \
+            r += stride; v += stride;                                   \
             for (octave_idx_type i = 0; i < m; i++)                     \
               r[i] = r0[i] OP v[i];                                     \
-            r0 += m;                                                    \
+            r0 += stride;                                               \
           }                                                             \
       }                                                                 \
+  }                                                                     \
+  template <typename T>                                                 \
+  inline void                                                           \
+  F (const TSRC *v, TRES *r, octave_idx_type m, octave_idx_type n)      \
+  {                                                                     \
+    octave::chunked_parallel_for                                        \
+      (m, m * n, [=] (octave_idx_type beg, octave_idx_type len)         \
+       { F ## _strided (v + beg, r + beg, len, n, m); });               \
   }
 
 OP_CUM_FCN2 (mx_inline_cumsum, T, T, +)
@@ -1072,6 +1404,107 @@ OP_MINMAX_FCN (mx_inline_max, >)
 OP_MINMAX_FCN2 (mx_inline_min, <)
 OP_MINMAX_FCN2 (mx_inline_max, >)
 
+// Flat min/max reductions parallelize exactly: each thread reduces a
+// contiguous chunk with the serial kernel, and the per-chunk partials
+// are combined with the same kernel, which preserves the NaN handling
+// and the first-occurrence tie-breaking of the serial scan.  The
+// index-returning variant rebases the winning chunk's local index.
+
+template <typename T, typename RED>
+inline bool
+mx_minmax_flat (const T *v, T *r, octave_idx_type n, RED red)
+{
+#if defined (_OPENMP)
+
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+
+  if (threshold > 0 && n >= threshold)
+    {
+      int nthreads = octave::parallel_num_threads ();
+
+      if (nthreads > 1)
+        {
+          octave_idx_type chunk = (n + nthreads - 1) / nthreads;
+          int nchunks = static_cast<int> ((n + chunk - 1) / chunk);
+
+          OCTAVE_LOCAL_BUFFER (T, parts, nchunks);
+
+#         pragma omp parallel for num_threads (nthreads) schedule (static)
+          for (int t = 0; t < nchunks; t++)
+            {
+              octave_idx_type beg = t * chunk;
+              octave_idx_type len = (beg + chunk <= n ? chunk : n - beg);
+              red (v + beg, &parts[t], len);
+            }
+
+          red (parts, r, nchunks);
+
+          return true;
+        }
+    }
+
+#else
+
+  octave_unused_parameter (v);
+  octave_unused_parameter (r);
+  octave_unused_parameter (n);
+  octave_unused_parameter (red);
+
+#endif
+
+  return false;
+}
+
+template <typename T, typename RED>
+inline bool
+mx_minmax_flat (const T *v, T *r, octave_idx_type *ri, octave_idx_type n,
+                RED red)
+{
+#if defined (_OPENMP)
+
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+
+  if (threshold > 0 && n >= threshold)
+    {
+      int nthreads = octave::parallel_num_threads ();
+
+      if (nthreads > 1)
+        {
+          octave_idx_type chunk = (n + nthreads - 1) / nthreads;
+          int nchunks = static_cast<int> ((n + chunk - 1) / chunk);
+
+          OCTAVE_LOCAL_BUFFER (T, parts, nchunks);
+          OCTAVE_LOCAL_BUFFER (octave_idx_type, partsi, nchunks);
+
+#         pragma omp parallel for num_threads (nthreads) schedule (static)
+          for (int t = 0; t < nchunks; t++)
+            {
+              octave_idx_type beg = t * chunk;
+              octave_idx_type len = (beg + chunk <= n ? chunk : n - beg);
+              red (v + beg, &parts[t], &partsi[t], len);
+            }
+
+          octave_idx_type c;
+          red (parts, r, &c, static_cast<octave_idx_type> (nchunks));
+          *ri = c * chunk + partsi[c];
+
+          return true;
+        }
+    }
+
+#else
+
+  octave_unused_parameter (v);
+  octave_unused_parameter (r);
+  octave_unused_parameter (ri);
+  octave_unused_parameter (n);
+  octave_unused_parameter (red);
+
+#endif
+
+  return false;
+}
+
 #define OP_MINMAX_FCNN(F)                                       \
   template <typename T>                                         \
   inline void                                                   \
@@ -1082,6 +1515,12 @@ OP_MINMAX_FCN2 (mx_inline_max, >)
       return;                                                   \
     if (l == 1)                                                 \
       {                                                         \
+        if (u == 1                                              \
+            && mx_minmax_flat (v, r, n,                         \
+                               [] (const T *w, T *s,            \
+                                   octave_idx_type m)           \
+                               { F (w, s, m); }))               \
+          return;                                               \
         for (octave_idx_type i = 0; i < u; i++)                 \
           {                                                     \
             F (v, r, n);                                        \
@@ -1107,6 +1546,13 @@ OP_MINMAX_FCN2 (mx_inline_max, >)
     if (! n) return;                                            \
     if (l == 1)                                                 \
       {                                                         \
+        if (u == 1                                              \
+            && mx_minmax_flat (v, r, ri, n,                     \
+                               [] (const T *w, T *s,            \
+                                   octave_idx_type *si,         \
+                                   octave_idx_type m)           \
+                               { F (w, s, si, m); }))           \
+          return;                                               \
         for (octave_idx_type i = 0; i < u; i++)                 \
           {                                                     \
             F (v, r, ri, n);                                    \
@@ -1401,8 +1847,15 @@ void mx_inline_diff (const T *v, T *r, octave_idx_type n,
   switch (order)
     {
     case 1:
-      for (octave_idx_type i = 0; i < n-1; i++)
-        r[i] = v[i+1] - v[i];
+      // No loop dependency here, just shifted operands.
+      octave::chunked_parallel_for (n-1,
+                                    [=] (octave_idx_type beg,
+                                         octave_idx_type len)
+                                    {
+                                      for (octave_idx_type i = beg;
+                                           i < beg + len; i++)
+                                        r[i] = v[i+1] - v[i];
+                                    });
       break;
     case 2:
       if (n > 1)
@@ -1443,8 +1896,15 @@ void mx_inline_diff (const T *v, T *r,
   switch (order)
     {
     case 1:
-      for (octave_idx_type i = 0; i < m*(n-1); i++)
-        r[i] = v[i+m] - v[i];
+      // No loop dependency here, just shifted operands.
+      octave::chunked_parallel_for (m*(n-1),
+                                    [=] (octave_idx_type beg,
+                                         octave_idx_type len)
+                                    {
+                                      for (octave_idx_type i = beg;
+                                           i < beg + len; i++)
+                                        r[i] = v[i+m] - v[i];
+                                    });
       break;
     case 2:
       for (octave_idx_type i = 0; i < n-2; i++)
@@ -1552,7 +2012,19 @@ do_mx_red_op (const Array<T>& src, int dim,
   dims.chop_trailing_singletons ();
 
   Array<R> ret (dims);
-  mx_red_op (src.data (), ret.fortran_vec (), l, n, u);
+  const T *v = src.data ();
+  R *rv = ret.fortran_vec ();
+
+  if (u > 1)
+    // Pages beyond DIM are reduced independently, so distributing them
+    // over threads does not change any within-page operation order.
+    octave::chunked_parallel_for (u, src.numel (),
+                                  [=] (octave_idx_type beg,
+                                       octave_idx_type len)
+                                  { mx_red_op (v + beg*l*n, rv + beg*l,
+                                               l, n, len); });
+  else
+    mx_red_op (v, rv, l, n, u);
 
   return ret;
 }
@@ -1569,7 +2041,18 @@ do_mx_cum_op (const Array<T>& src, int dim,
 
   // Cumulative operation doesn't reduce the array size.
   Array<R> ret (dims);
-  mx_cum_op (src.data (), ret.fortran_vec (), l, n, u);
+  const T *v = src.data ();
+  R *rv = ret.fortran_vec ();
+
+  if (u > 1)
+    // Pages beyond DIM are independent; see do_mx_red_op.
+    octave::chunked_parallel_for (u, src.numel (),
+                                  [=] (octave_idx_type beg,
+                                       octave_idx_type len)
+                                  { mx_cum_op (v + beg*l*n, rv + beg*l*n,
+                                               l, n, len); });
+  else
+    mx_cum_op (v, rv, l, n, u);
 
   return ret;
 }
@@ -1589,7 +2072,18 @@ do_mx_minmax_op (const Array<R>& src, int dim,
   dims.chop_trailing_singletons ();
 
   Array<R> ret (dims);
-  mx_minmax_op (src.data (), ret.fortran_vec (), l, n, u);
+  const R *v = src.data ();
+  R *rv = ret.fortran_vec ();
+
+  if (u > 1)
+    // Pages beyond DIM are independent; see do_mx_red_op.
+    octave::chunked_parallel_for (u, src.numel (),
+                                  [=] (octave_idx_type beg,
+                                       octave_idx_type len)
+                                  { mx_minmax_op (v + beg*l*n, rv + beg*l,
+                                                  l, n, len); });
+  else
+    mx_minmax_op (v, rv, l, n, u);
 
   return ret;
 }
@@ -1611,8 +2105,19 @@ do_mx_minmax_op (const Array<R>& src, Array<octave_idx_type>& idx, int dim,
   Array<R> ret (dims);
   if (idx.dims () != dims) idx = Array<octave_idx_type> (dims);
 
-  mx_minmax_op (src.data (), ret.fortran_vec (), idx.fortran_vec (),
-                l, n, u);
+  const R *v = src.data ();
+  R *rv = ret.fortran_vec ();
+  octave_idx_type *iv = idx.fortran_vec ();
+
+  if (u > 1)
+    // Pages beyond DIM are independent; see do_mx_red_op.
+    octave::chunked_parallel_for (u, src.numel (),
+                                  [=] (octave_idx_type beg,
+                                       octave_idx_type len)
+                                  { mx_minmax_op (v + beg*l*n, rv + beg*l,
+                                                  iv + beg*l, l, n, len); });
+  else
+    mx_minmax_op (v, rv, iv, l, n, u);
 
   return ret;
 }
@@ -1628,7 +2133,19 @@ do_mx_cumminmax_op (const Array<R>& src, int dim,
   get_extent_triplet (dims, dim, l, n, u);
 
   Array<R> ret (dims);
-  mx_cumminmax_op (src.data (), ret.fortran_vec (), l, n, u);
+  const R *v = src.data ();
+  R *rv = ret.fortran_vec ();
+
+  if (u > 1)
+    // Pages beyond DIM are independent; see do_mx_red_op.
+    octave::chunked_parallel_for (u, src.numel (),
+                                  [=] (octave_idx_type beg,
+                                       octave_idx_type len)
+                                  { mx_cumminmax_op (v + beg*l*n,
+                                                     rv + beg*l*n,
+                                                     l, n, len); });
+  else
+    mx_cumminmax_op (v, rv, l, n, u);
 
   return ret;
 }
@@ -1646,8 +2163,21 @@ do_mx_cumminmax_op (const Array<R>& src, Array<octave_idx_type>& idx, int dim,
   Array<R> ret (dims);
   if (idx.dims () != dims) idx = Array<octave_idx_type> (dims);
 
-  mx_cumminmax_op (src.data (), ret.fortran_vec (), idx.fortran_vec (),
-                   l, n, u);
+  const R *v = src.data ();
+  R *rv = ret.fortran_vec ();
+  octave_idx_type *iv = idx.fortran_vec ();
+
+  if (u > 1)
+    // Pages beyond DIM are independent; see do_mx_red_op.
+    octave::chunked_parallel_for (u, src.numel (),
+                                  [=] (octave_idx_type beg,
+                                       octave_idx_type len)
+                                  { mx_cumminmax_op (v + beg*l*n,
+                                                     rv + beg*l*n,
+                                                     iv + beg*l*n,
+                                                     l, n, len); });
+  else
+    mx_cumminmax_op (v, rv, iv, l, n, u);
 
   return ret;
 }
@@ -1734,6 +2264,6 @@ mx_inline_xsum (const T *v, T *r,
     r[i] += e[i];
 }
 
-OP_RED_FCNN (mx_inline_xsum, T, T)
+OP_RED_FCNN (mx_inline_xsum, T, T, OP_RED_COMB_SUM)
 
 #endif
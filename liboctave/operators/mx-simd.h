@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_mx_simd_h)
+#define octave_mx_simd_h 1
+
+// This file should *not* include config.h.  It is only included in other
+// C++ source files that should have included config.h before including
+// this file.
+
+// Annotations used by the element-wise kernels in mx-inlines.cc so that
+// the compiler can emit SIMD code for them.
+//
+// The plain loops in mx-inlines.cc are written against possibly aliased
+// pointers, which prevents vectorization unless the compiler emits a
+// runtime overlap check for every loop.  The result and operand buffers
+// handed to these kernels by the do_mx_*_op appliers never overlap
+// (except for the in-place variants, where the result *is* one of the
+// operands), so we may promise the compiler as much.
+//
+// OCTAVE_SIMD_LOOP asserts that the following loop has no loop-carried
+// dependencies and should be vectorized.  We prefer the OpenMP "simd"
+// pragma when the compiler provides it (configure already arranges for
+// -fopenmp in that case) and fall back to vendor-specific equivalents.
+// Either way, this only licenses vectorization of the annotated loop;
+// it never introduces threads.
+
+#if defined (_OPENMP) && _OPENMP >= 201307
+#  define OCTAVE_SIMD_LOOP _Pragma ("omp simd")
+#elif defined (__clang__)
+#  define OCTAVE_SIMD_LOOP _Pragma ("clang loop vectorize(enable)")
+#elif defined (__GNUC__)
+#  define OCTAVE_SIMD_LOOP _Pragma ("GCC ivdep")
+#else
+#  define OCTAVE_SIMD_LOOP
+#endif
+
+// OCTAVE_SIMD_RESTRICT marks a kernel pointer argument as free of
+// aliases for the duration of the call.
+
+#if defined (__GNUC__) || defined (__clang__)
+#  define OCTAVE_SIMD_RESTRICT __restrict__
+#elif defined (_MSC_VER)
+#  define OCTAVE_SIMD_RESTRICT __restrict
+#else
+#  define OCTAVE_SIMD_RESTRICT
+#endif
+
+#endif
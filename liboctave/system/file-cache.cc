@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdio>
+
+#include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "file-cache.h"
+#include "file-stat.h"
+#include "lo-sysdep.h"
+#include "oct-env.h"
+#include "oct-time.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+OCTAVE_BEGIN_NAMESPACE(sys)
+
+namespace
+{
+  struct cache_entry
+  {
+    std::string contents;
+    off_t size;
+    sys::time mtime;
+    std::list<std::string>::iterator lru_pos;
+  };
+
+  std::mutex cache_mutex;
+  std::map<std::string, cache_entry> cache_map;
+
+  // Most recently used file names first.
+  std::list<std::string> cache_lru;
+
+  std::size_t cache_bytes = 0;
+
+  std::size_t
+  max_cache_bytes ()
+  {
+    static std::size_t limit = 0;
+    static bool initialized = false;
+
+    if (! initialized)
+      {
+        limit = 32 * 1024 * 1024;
+
+        std::string env_limit
+          = sys::env::getenv ("OCTAVE_FILE_CACHE_BYTES");
+
+        unsigned long val;
+        if (! env_limit.empty ()
+            && std::sscanf (env_limit.c_str (), "%lu", &val) == 1)
+          limit = val;
+
+        initialized = true;
+      }
+
+    return limit;
+  }
+
+  // Caching one huge file would evict everything else for little
+  // benefit, so such files are always read directly.
+
+  std::size_t
+  max_entry_bytes ()
+  {
+    return max_cache_bytes () / 8;
+  }
+
+  // Called with cache_mutex held.
+
+  void
+  evict_lru_until (std::size_t target_bytes)
+  {
+    while (cache_bytes > target_bytes && ! cache_lru.empty ())
+      {
+        auto it = cache_map.find (cache_lru.back ());
+
+        cache_bytes -= it->second.contents.size ();
+        cache_map.erase (it);
+        cache_lru.pop_back ();
+      }
+  }
+
+  bool
+  read_file (const std::string& name, std::string& contents)
+  {
+    std::ifstream file
+      = sys::ifstream (name.c_str (), std::ios::in | std::ios::binary);
+
+    if (! file)
+      return false;
+
+    std::ostringstream buf;
+    buf << file.rdbuf ();
+
+    if (file.bad ())
+      return false;
+
+    contents = buf.str ();
+
+    return true;
+  }
+}
+
+bool
+cached_file_contents (const std::string& name, std::string& contents)
+{
+  contents = "";
+
+  sys::file_stat fs (name);
+
+  if (! fs || ! fs.is_reg ())
+    return false;
+
+  bool cacheable
+    = (static_cast<std::size_t> (fs.size ()) <= max_entry_bytes ()
+       && max_cache_bytes () > 0);
+
+  if (cacheable)
+    {
+      std::lock_guard<std::mutex> guard (cache_mutex);
+
+      auto it = cache_map.find (name);
+
+      if (it != cache_map.end ())
+        {
+          cache_entry& entry = it->second;
+
+          if (entry.size == fs.size () && entry.mtime == fs.mtime ())
+            {
+              cache_lru.splice (cache_lru.begin (), cache_lru,
+                                entry.lru_pos);
+
+              contents = entry.contents;
+
+              return true;
+            }
+
+          // Stale; drop it and re-read below.
+          cache_bytes -= entry.contents.size ();
+          cache_lru.erase (entry.lru_pos);
+          cache_map.erase (it);
+        }
+    }
+
+  if (! read_file (name, contents))
+    {
+      contents = "";
+      return false;
+    }
+
+  if (cacheable && contents.size () <= max_entry_bytes ())
+    {
+      std::lock_guard<std::mutex> guard (cache_mutex);
+
+      evict_lru_until (max_cache_bytes () - contents.size ());
+
+      cache_lru.push_front (name);
+
+      cache_entry& entry = cache_map[name];
+
+      entry.contents = contents;
+      entry.size = fs.size ();
+      entry.mtime = fs.mtime ();
+      entry.lru_pos = cache_lru.begin ();
+
+      cache_bytes += contents.size ();
+    }
+
+  return true;
+}
+
+void
+clear_file_contents_cache ()
+{
+  std::lock_guard<std::mutex> guard (cache_mutex);
+
+  cache_map.clear ();
+  cache_lru.clear ();
+  cache_bytes = 0;
+}
+
+OCTAVE_END_NAMESPACE(sys)
+OCTAVE_END_NAMESPACE(octave)
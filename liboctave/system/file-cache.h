@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_file_cache_h)
+#define octave_file_cache_h 1
+
+#include "octave-config.h"
+
+#include <string>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+OCTAVE_BEGIN_NAMESPACE(sys)
+
+// Size-bounded in-memory cache of whole-file contents for files that
+// are read repeatedly within a session (help texts, small data files).
+// Entries are validated against the file's current size and
+// modification time on every hit, so an edited file is always re-read;
+// files larger than the per-file limit bypass the cache entirely.
+// Over slow filesystems this turns every redundant read after the
+// first into a memory copy.
+
+// Store the contents of NAME in CONTENTS and return true, serving
+// from the cache when the file is unchanged.  Return false (leaving
+// CONTENTS empty) if the file cannot be read.
+
+extern OCTAVE_API bool
+cached_file_contents (const std::string& name, std::string& contents);
+
+// Discard all cached file contents.
+
+extern OCTAVE_API void clear_file_contents_cache ();
+
+OCTAVE_END_NAMESPACE(sys)
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -160,6 +160,61 @@ std::string blas_version ()
   return retval;
 }
 
+// Thread-count control hooks of the optimized BLAS libraries we know
+// how to talk to.  All of them take or return a plain int; the symbols
+// are resolved once and cached.
+
+typedef int (*blas_get_threads_fcn) ();
+typedef void (*blas_set_threads_fcn) (int);
+
+static void *
+find_blas_symbol (const char *const *names)
+{
+  dynamic_library dyn_libs ("");
+
+  if (! dyn_libs)
+    return nullptr;
+
+  for (const char *const *nm = names; *nm; nm++)
+    {
+      void *f = dyn_libs.search (*nm);
+
+      if (f)
+        return f;
+    }
+
+  return nullptr;
+}
+
+int blas_num_threads ()
+{
+  static const char *const names[]
+    = { "flexiblas_get_num_threads", "openblas_get_num_threads",
+        "MKL_Get_Max_Threads", nullptr };
+
+  static blas_get_threads_fcn get_fcn
+    = reinterpret_cast<blas_get_threads_fcn> (find_blas_symbol (names));
+
+  return get_fcn ? get_fcn () : -1;
+}
+
+bool set_blas_num_threads (int nthreads)
+{
+  static const char *const names[]
+    = { "flexiblas_set_num_threads", "openblas_set_num_threads",
+        "MKL_Set_Num_Threads", nullptr };
+
+  static blas_set_threads_fcn set_fcn
+    = reinterpret_cast<blas_set_threads_fcn> (find_blas_symbol (names));
+
+  if (! set_fcn || nthreads < 1)
+    return false;
+
+  set_fcn (nthreads);
+
+  return true;
+}
+
 std::string lapack_version ()
 {
   std::string retval = "unknown LAPACK";
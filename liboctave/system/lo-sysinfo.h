@@ -38,6 +38,16 @@ extern OCTAVE_API std::string blas_version ();
 
 extern OCTAVE_API std::string lapack_version ();
 
+// Number of threads the loaded BLAS uses, or -1 when the library has no
+// control hook we know how to call.
+
+extern OCTAVE_API int blas_num_threads ();
+
+// Ask the loaded BLAS to use NTHREADS threads.  Return false when the
+// library has no control hook we know how to call.
+
+extern OCTAVE_API bool set_blas_num_threads (int nthreads);
+
 OCTAVE_END_NAMESPACE(sys)
 OCTAVE_END_NAMESPACE(octave)
 
@@ -1,6 +1,7 @@
 SYSTEM_INC = \
   %reldir%/child-list.h \
   %reldir%/dir-ops.h \
+  %reldir%/file-cache.h \
   %reldir%/file-ops.h \
   %reldir%/file-stat.h \
   %reldir%/lo-sysdep.h \
@@ -8,7 +9,9 @@ SYSTEM_INC = \
   %reldir%/mach-info.h \
   %reldir%/oct-env.h \
   %reldir%/oct-group.h \
+  %reldir%/oct-mmap.h \
   %reldir%/oct-password.h \
+  %reldir%/oct-shmem.h \
   %reldir%/oct-syscalls.h \
   %reldir%/oct-time.h \
   %reldir%/oct-uname.h
@@ -17,6 +20,7 @@ SYSTEM_SRC = \
   %reldir%/child-list.cc \
   %reldir%/cmach-info.c \
   %reldir%/dir-ops.cc \
+  %reldir%/file-cache.cc \
   %reldir%/file-ops.cc \
   %reldir%/file-stat.cc \
   %reldir%/lo-sysdep.cc \
@@ -24,7 +28,9 @@ SYSTEM_SRC = \
   %reldir%/mach-info.cc \
   %reldir%/oct-env.cc \
   %reldir%/oct-group.cc \
+  %reldir%/oct-mmap.cc \
   %reldir%/oct-password.cc \
+  %reldir%/oct-shmem.cc \
   %reldir%/oct-syscalls.cc \
   %reldir%/oct-time.cc \
   %reldir%/oct-uname.cc
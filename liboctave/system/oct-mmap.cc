@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdint>
+
+#include "oct-mmap.h"
+
+#if defined (HAVE_SYS_MMAN_H)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+OCTAVE_BEGIN_NAMESPACE(sys)
+
+bool
+mapped_file::open (const std::string& name)
+{
+  close ();
+
+#if defined (HAVE_SYS_MMAN_H)
+
+  int fd = ::open (name.c_str (), O_RDONLY);
+
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+
+  if (::fstat (fd, &st) == 0 && S_ISREG (st.st_mode) && st.st_size > 0)
+    {
+      std::size_t len = static_cast<std::size_t> (st.st_size);
+
+      // MAP_PRIVATE, so any stray write through the mapping could
+      // never reach the file.
+
+      void *addr = ::mmap (nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (addr != MAP_FAILED)
+        {
+          m_data = static_cast<char *> (addr);
+          m_size = len;
+        }
+    }
+
+  if (m_data)
+    {
+      // Keep the descriptor so map_range can create further mappings
+      // of the same file.
+      m_fd = fd;
+    }
+  else
+    ::close (fd);
+
+  return m_data != nullptr;
+
+#else
+
+  octave_unused_parameter (name);
+
+  return false;
+
+#endif
+}
+
+void
+mapped_file::close ()
+{
+#if defined (HAVE_SYS_MMAN_H)
+
+  if (m_data)
+    ::munmap (m_data, m_size);
+
+  if (m_fd >= 0)
+    ::close (m_fd);
+
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+  m_fd = -1;
+}
+
+void *
+mapped_file::map_range (std::size_t offset, std::size_t len) const
+{
+#if defined (HAVE_SYS_MMAN_H)
+
+  if (m_fd < 0 || len == 0 || offset + len > m_size)
+    return nullptr;
+
+  std::size_t page = static_cast<std::size_t> (::sysconf (_SC_PAGESIZE));
+
+  // The mapping must start on a page boundary; hand back a pointer to
+  // the first requested byte within it.
+
+  std::size_t aligned_offset = offset - offset % page;
+  std::size_t delta = offset - aligned_offset;
+
+  // PROT_WRITE with MAP_PRIVATE is allowed on a read-only descriptor:
+  // written pages become anonymous copies and never reach the file.
+
+  void *addr = ::mmap (nullptr, len + delta, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE, m_fd, aligned_offset);
+
+  if (addr == MAP_FAILED)
+    return nullptr;
+
+  return static_cast<char *> (addr) + delta;
+
+#else
+
+  octave_unused_parameter (offset);
+  octave_unused_parameter (len);
+
+  return nullptr;
+
+#endif
+}
+
+void
+mapped_file::release_range (void *data, std::size_t len)
+{
+#if defined (HAVE_SYS_MMAN_H)
+
+  std::size_t page = static_cast<std::size_t> (::sysconf (_SC_PAGESIZE));
+
+  std::size_t delta
+    = reinterpret_cast<std::uintptr_t> (data) % page;
+
+  ::munmap (static_cast<char *> (data) - delta, len + delta);
+
+#else
+
+  octave_unused_parameter (data);
+  octave_unused_parameter (len);
+
+#endif
+}
+
+std::streampos
+mapped_streambuf::seekoff (std::streamoff off, std::ios_base::seekdir dir,
+                           std::ios_base::openmode which)
+{
+  if (! (which & std::ios_base::in))
+    return std::streampos (std::streamoff (-1));
+
+  char *beg = eback ();
+  char *cur = gptr ();
+  char *end = egptr ();
+
+  std::streamoff newoff;
+
+  if (dir == std::ios_base::beg)
+    newoff = off;
+  else if (dir == std::ios_base::cur)
+    newoff = (cur - beg) + off;
+  else
+    newoff = (end - beg) + off;
+
+  if (newoff < 0 || newoff > end - beg)
+    return std::streampos (std::streamoff (-1));
+
+  setg (beg, beg + newoff, end);
+
+  return std::streampos (newoff);
+}
+
+std::streampos
+mapped_streambuf::seekpos (std::streampos pos, std::ios_base::openmode which)
+{
+  return seekoff (std::streamoff (pos), std::ios_base::beg, which);
+}
+
+OCTAVE_END_NAMESPACE(sys)
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_mmap_h)
+#define octave_oct_mmap_h 1
+
+#include "octave-config.h"
+
+#include <cstddef>
+
+#include <istream>
+#include <streambuf>
+#include <string>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+OCTAVE_BEGIN_NAMESPACE(sys)
+
+// Read-only private mapping of a regular file.  On systems without
+// mmap, open always fails and callers fall back to ordinary streams.
+
+class OCTAVE_API mapped_file
+{
+public:
+
+  mapped_file () : m_data (nullptr), m_size (0), m_fd (-1) { }
+
+  explicit mapped_file (const std::string& name)
+    : m_data (nullptr), m_size (0), m_fd (-1)
+  {
+    open (name);
+  }
+
+  // No copying!
+
+  mapped_file (const mapped_file&) = delete;
+
+  mapped_file& operator = (const mapped_file&) = delete;
+
+  ~mapped_file () { close (); }
+
+  bool open (const std::string& name);
+
+  void close ();
+
+  bool is_open () const { return m_data != nullptr; }
+
+  const char * data () const { return m_data; }
+
+  std::size_t size () const { return m_size; }
+
+  // Map LEN bytes at OFFSET of the underlying file as an independent
+  // private copy-on-write region that outlives this object.  Return a
+  // pointer to the first requested byte (which need not be page
+  // aligned), or nullptr on failure.  Unmodified pages are shared
+  // with every other process mapping the same file; pages written
+  // through the returned pointer become private to this process.
+  // Release the region with release_range.
+
+  void * map_range (std::size_t offset, std::size_t len) const;
+
+  // Unmap a region of LEN bytes at DATA previously returned by
+  // map_range.
+
+  static void release_range (void *data, std::size_t len);
+
+private:
+
+  char *m_data;
+
+  std::size_t m_size;
+
+  // Kept open for map_range for the lifetime of the mapping.
+  int m_fd;
+};
+
+// Stream buffer reading directly from a mapped_file, so extraction is
+// a copy from the page cache with no intermediate iostream buffer.
+
+class OCTAVE_API mapped_streambuf : public std::streambuf
+{
+public:
+
+  mapped_streambuf () { }
+
+  void attach (const char *data, std::size_t size)
+  {
+    char *beg = const_cast<char *> (data);
+    setg (beg, beg, beg + size);
+  }
+
+protected:
+
+  std::streampos
+  seekoff (std::streamoff off, std::ios_base::seekdir dir,
+           std::ios_base::openmode which
+             = std::ios_base::in | std::ios_base::out);
+
+  std::streampos
+  seekpos (std::streampos pos,
+           std::ios_base::openmode which
+             = std::ios_base::in | std::ios_base::out);
+};
+
+// Input stream over a memory-mapped file, a drop-in replacement for
+// std::ifstream on the binary load paths.
+
+class OCTAVE_API imapstream : public std::istream
+{
+public:
+
+  imapstream () : std::istream (&m_buf), m_file (), m_buf () { }
+
+  explicit imapstream (const std::string& name)
+    : std::istream (&m_buf), m_file (), m_buf ()
+  {
+    open (name);
+  }
+
+  // No copying!
+
+  imapstream (const imapstream&) = delete;
+
+  imapstream& operator = (const imapstream&) = delete;
+
+  ~imapstream () = default;
+
+  bool open (const std::string& name)
+  {
+    if (m_file.open (name))
+      m_buf.attach (m_file.data (), m_file.size ());
+    else
+      setstate (std::ios::failbit);
+
+    return is_open ();
+  }
+
+  bool is_open () const { return m_file.is_open (); }
+
+  const mapped_file& file () const { return m_file; }
+
+private:
+
+  mapped_file m_file;
+
+  mapped_streambuf m_buf;
+};
+
+OCTAVE_END_NAMESPACE(sys)
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
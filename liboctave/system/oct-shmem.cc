@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include "oct-shmem.h"
+
+#if ! defined (OCTAVE_USE_WINDOWS_API)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+OCTAVE_BEGIN_NAMESPACE(sys)
+
+#if ! defined (OCTAVE_USE_WINDOWS_API)
+
+std::size_t
+shmem_page_size ()
+{
+  static std::size_t page_size = sysconf (_SC_PAGESIZE);
+
+  return page_size;
+}
+
+void *
+shmem_create (const std::string& name, std::size_t nbytes)
+{
+  int fd = shm_open (name.c_str (), O_CREAT | O_RDWR, 0600);
+
+  if (fd < 0)
+    return nullptr;
+
+  if (ftruncate (fd, nbytes) != 0)
+    {
+      ::close (fd);
+      shm_unlink (name.c_str ());
+      return nullptr;
+    }
+
+  void *data = mmap (nullptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+
+  // The mapping keeps the segment alive; the descriptor is no longer
+  // needed either way.
+  ::close (fd);
+
+  return (data == MAP_FAILED ? nullptr : data);
+}
+
+void *
+shmem_attach (const std::string& name, std::size_t& nbytes)
+{
+  int fd = shm_open (name.c_str (), O_RDONLY, 0);
+
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+
+  if (fstat (fd, &st) != 0 || st.st_size <= 0)
+    {
+      ::close (fd);
+      return nullptr;
+    }
+
+  nbytes = st.st_size;
+
+  // A private mapping gives the reader copy-on-write pages: it may
+  // modify its view in place without disturbing the producer, and
+  // unmodified pages are never copied.
+  void *data = mmap (nullptr, nbytes, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                     fd, 0);
+
+  ::close (fd);
+
+  return (data == MAP_FAILED ? nullptr : data);
+}
+
+void
+shmem_detach (void *data, std::size_t nbytes)
+{
+  if (data)
+    munmap (data, nbytes);
+}
+
+bool
+shmem_unlink (const std::string& name)
+{
+  return shm_unlink (name.c_str ()) == 0;
+}
+
+#else
+
+// FIXME: a Windows implementation could be built on CreateFileMapping
+// and MapViewOfFile; until then the feature reports itself as
+// unavailable.
+
+std::size_t
+shmem_page_size ()
+{
+  return 4096;
+}
+
+void *
+shmem_create (const std::string&, std::size_t)
+{
+  return nullptr;
+}
+
+void *
+shmem_attach (const std::string&, std::size_t&)
+{
+  return nullptr;
+}
+
+void
+shmem_detach (void *, std::size_t)
+{ }
+
+bool
+shmem_unlink (const std::string&)
+{
+  return false;
+}
+
+#endif
+
+OCTAVE_END_NAMESPACE(sys)
+OCTAVE_END_NAMESPACE(octave)
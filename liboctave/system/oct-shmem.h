@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_shmem_h)
+#define octave_oct_shmem_h 1
+
+#include "octave-config.h"
+
+#include <cstddef>
+
+#include <string>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+OCTAVE_BEGIN_NAMESPACE(sys)
+
+// Named shared memory segments, used to pass large arrays between
+// processes without copying them through a pipe or a file.  On
+// systems without POSIX shared memory every function fails cleanly
+// and callers report the feature as unavailable.
+
+// The system's page size, which callers use to lay out page-aligned
+// data inside a segment.
+extern OCTAVE_API std::size_t shmem_page_size ();
+
+// Create (or replace) the segment NAME of NBYTES bytes and map it
+// read-write and shared.  Returns the mapping address or nullptr.
+extern OCTAVE_API void * shmem_create (const std::string& name,
+                                       std::size_t nbytes);
+
+// Map the existing segment NAME.  The mapping is private
+// (copy-on-write), so the caller may modify the memory without
+// affecting other processes.  On success NBYTES is set to the segment
+// size and the mapping address is returned; otherwise nullptr.
+extern OCTAVE_API void * shmem_attach (const std::string& name,
+                                       std::size_t& nbytes);
+
+// Unmap a mapping returned by shmem_create or shmem_attach.
+extern OCTAVE_API void shmem_detach (void *data, std::size_t nbytes);
+
+// Remove the segment NAME.  Existing mappings stay valid until they
+// are detached.
+extern OCTAVE_API bool shmem_unlink (const std::string& name);
+
+OCTAVE_END_NAMESPACE(sys)
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
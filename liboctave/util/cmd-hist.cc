@@ -30,6 +30,7 @@
 #include <cstring>
 
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <string>
 
@@ -62,7 +63,9 @@ gnu_history : public command_history
 public:
 
   gnu_history ()
-    : command_history (), m_mark (0) { }
+    : command_history (), m_mark (0), m_list_cache (),
+      m_list_cache_valid (false)
+  { }
 
   OCTAVE_DISABLE_COPY_MOVE (gnu_history)
 
@@ -119,6 +122,13 @@ public:
 private:
 
   int m_mark;
+
+  // Cached snapshot of the complete, unnumbered history list.
+  // Copying the list out of the readline library is linear in the
+  // number of entries, so keep the copy until the list changes.
+
+  mutable string_vector m_list_cache;
+  mutable bool m_list_cache_valid;
 };
 
 void
@@ -207,6 +217,7 @@ gnu_history::do_add (const std::string& s)
 
       int added = ::octave_add_history (stmp.c_str (), m_history_control);
       m_lines_this_session += added;
+      m_list_cache_valid = false;
       return added > 0 ? true : false;
     }
   return false;
@@ -216,12 +227,14 @@ void
 gnu_history::do_remove (int n)
 {
   ::octave_remove_history (n);
+  m_list_cache_valid = false;
 }
 
 void
 gnu_history::do_clear ()
 {
   ::octave_clear_history ();
+  m_list_cache_valid = false;
 }
 
 int
@@ -258,6 +271,7 @@ void
 gnu_history::do_stifle (int n)
 {
   ::octave_stifle_history (n);
+  m_list_cache_valid = false;
 }
 
 int
@@ -301,12 +315,56 @@ gnu_history::do_goto_mark ()
   return 0;
 }
 
+// Count the lines in the history file F, or return -1 if it cannot
+// be opened.  Used to skip directly to the tail of a history file
+// that contains more entries than we are going to keep anyway.
+
+static int
+history_file_lines (const std::string& f)
+{
+  std::ifstream file
+    = sys::ifstream (f.c_str (), std::ios::in | std::ios::binary);
+
+  if (! file)
+    return -1;
+
+  int count = 0;
+  char buf[8192];
+
+  while (file.read (buf, sizeof (buf)) || file.gcount () > 0)
+    {
+      std::streamsize n = file.gcount ();
+
+      for (std::streamsize i = 0; i < n; i++)
+        if (buf[i] == '\n')
+          count++;
+    }
+
+  return count;
+}
+
 void
 gnu_history::do_read (const std::string& f, bool must_exist)
 {
   if (! f.empty ())
     {
-      int status = ::octave_read_history (f.c_str ());
+      int status;
+
+      // Inserting every line of a history file that is much larger
+      // than the number of entries we are going to save can dominate
+      // startup time, so read only the most recent M_SIZE entries in
+      // that case.  The lines we skip would be dropped again when the
+      // stifled history is saved at exit.
+
+      int nlines = (m_size > 0) ? history_file_lines (f) : -1;
+
+      if (nlines > m_size)
+        status = ::octave_read_history_range (f.c_str (),
+                                              nlines - m_size, -1);
+      else
+        status = ::octave_read_history (f.c_str ());
+
+      m_list_cache_valid = false;
 
       if (status != 0 && must_exist)
         {
@@ -336,6 +394,8 @@ gnu_history::do_read_range (const std::string& f, int from, int to,
     {
       int status = ::octave_read_history_range (f.c_str (), from, to);
 
+      m_list_cache_valid = false;
+
       if (status != 0 && must_exist)
         {
           std::ostringstream buf;
@@ -460,10 +520,37 @@ gnu_history::do_truncate_file (const std::string& f_arg, int n) const
 string_vector
 gnu_history::do_list (int limit, bool number_lines) const
 {
-  string_vector retval;
+  if (! limit)
+    return string_vector ();
+
+  if (! m_list_cache_valid)
+    {
+      m_list_cache = ::octave_history_list (-1, false);
+      m_list_cache_valid = true;
+    }
+
+  octave_idx_type len = m_list_cache.numel ();
+
+  octave_idx_type beg = (limit < 0 || len < limit) ? 0 : len - limit;
+
+  if (beg == 0 && ! number_lines)
+    return m_list_cache;
 
-  if (limit)
-    retval = ::octave_history_list (limit, number_lines);
+  string_vector retval (len - beg);
+
+  int base = do_base ();
+
+  for (octave_idx_type i = beg; i < len; i++)
+    {
+      if (number_lines)
+        {
+          std::ostringstream buf;
+          buf << std::setw (5) << base + i << ' ' << m_list_cache[i];
+          retval[i-beg] = buf.str ();
+        }
+      else
+        retval[i-beg] = m_list_cache[i];
+    }
 
   return retval;
 }
@@ -485,6 +572,7 @@ void
 gnu_history::do_replace_entry (int which, const std::string& line)
 {
   ::octave_replace_history_entry (which, line.c_str ());
+  m_list_cache_valid = false;
 }
 
 void
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_lo_fasthash_h)
+#define octave_lo_fasthash_h 1
+
+#include "octave-config.h"
+
+#include <cstdint>
+#include <cstring>
+
+// Fast non-cryptographic 64-bit hashing for hash table keys.  Unlike
+// the digests in lo-hash.h these make no security promises; they are
+// meant for in-memory joins and set operations where only uniform
+// distribution and speed matter.
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Finalizer of the splitmix64 generator; a cheap full-avalanche mix.
+
+inline uint64_t
+hash64_mix (uint64_t x)
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+
+  return x;
+}
+
+// Bit pattern of X suitable as a hash key: equal doubles get equal
+// keys, including the two representations of zero.  NaNs are not
+// canonicalized; callers implementing IEEE comparison semantics must
+// handle them separately since NaN compares unequal to everything.
+
+inline uint64_t
+hash64_double_key (double x)
+{
+  if (x == 0)
+    x = 0;  // -0 == 0 must hash alike
+
+  uint64_t key;
+  std::memcpy (&key, &x, sizeof (key));
+
+  return key;
+}
+
+inline uint64_t
+hash64_double (double x)
+{
+  return hash64_mix (hash64_double_key (x));
+}
+
+// FNV-1a over the buffer with a final mix to spread the entropy into
+// the high bits.
+
+inline uint64_t
+hash64_bytes (const void *buf, std::size_t len)
+{
+  const unsigned char *p = static_cast<const unsigned char *> (buf);
+
+  uint64_t h = 0xcbf29ce484222325ULL;
+
+  for (std::size_t i = 0; i < len; i++)
+    {
+      h ^= p[i];
+      h *= 0x100000001b3ULL;
+    }
+
+  return hash64_mix (h);
+}
+
+inline uint64_t
+hash64_combine (uint64_t seed, uint64_t h)
+{
+  return hash64_mix (seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6)));
+}
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
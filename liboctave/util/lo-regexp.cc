@@ -123,6 +123,15 @@ regexp::compile_internal ()
   // If we had a previously compiled pattern, release it.
   free ();
 
+  // A pattern without any regular expression operators that needs no
+  // case folding can be matched with a plain substring search instead
+  // of calling into PCRE.  The pattern is still compiled below so that
+  // invalid patterns are diagnosed exactly as before.
+  m_literal = (! m_pattern.empty ()
+               && ! m_options.case_insensitive ()
+               && ! m_options.freespacing ()
+               && m_pattern.find_first_of ("\\^$.|?*+()[]{}") == std::string::npos);
+
   std::size_t max_length = MAXLOOKBEHIND;
 
   std::size_t pos = 0;
@@ -333,6 +342,38 @@ regexp::match (const std::string& buffer) const
     (*current_liboctave_error_handler)
       ("%s: the input string is invalid UTF-8", m_who.c_str ());
 
+  if (m_literal)
+    {
+      // Literal pattern: a substring search produces the same matches
+      // as PCRE.  Matches of a non-empty literal are never empty, and
+      // the pattern defines no tokens or named patterns.
+
+      std::list<regexp::match_element> lst;
+
+      std::size_t len = m_pattern.length ();
+      std::size_t pos = 0;
+
+      while ((pos = buffer.find (m_pattern, pos)) != std::string::npos)
+        {
+          octave_quit ();
+
+          double dstart = static_cast<double> (pos + 1);
+          double dend = static_cast<double> (pos + len);
+
+          lst.push_back (regexp::match_element (string_vector (),
+                                                string_vector (),
+                                                m_pattern, Matrix (0, 2),
+                                                dstart, dend));
+
+          pos += len;
+
+          if (m_options.once ())
+            break;
+        }
+
+      return regexp::match_data (lst, m_named_pats);
+    }
+
   regexp::match_data retval;
 
   std::list<regexp::match_element> lst;
@@ -51,8 +51,8 @@ public:
   regexp (const std::string& pat = "",
           const regexp::opts& opt = regexp::opts (),
           const std::string& w = "regexp")
-    : m_pattern (pat), m_options (opt), m_code (nullptr), m_named_pats (),
-      m_names (0), m_named_idx (), m_who (w)
+    : m_pattern (pat), m_options (opt), m_code (nullptr), m_literal (false),
+      m_named_pats (), m_names (0), m_named_idx (), m_who (w)
   {
     compile_internal ();
   }
@@ -227,6 +227,10 @@ private:
   // Internal data describing the regular expression.
   void *m_code;
 
+  // True if the pattern contains no regular expression operators and
+  // can be matched with a plain substring search.
+  bool m_literal;
+
   string_vector m_named_pats;
   int m_names;
   Array<int> m_named_idx;
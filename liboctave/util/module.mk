@@ -9,6 +9,7 @@ UTIL_INC = \
   %reldir%/file-info.h \
   %reldir%/glob-match.h \
   %reldir%/lo-array-errwarn.h \
+  %reldir%/lo-fasthash.h \
   %reldir%/lo-hash.h \
   %reldir%/lo-ieee.h \
   %reldir%/lo-regexp.h \
@@ -18,19 +19,25 @@ UTIL_INC = \
   %reldir%/lo-error.h \
   %reldir%/octave-preserve-stream-state.h \
   %reldir%/quit.h \
+  %reldir%/oct-alloc-stats.h \
   %reldir%/oct-atomic.h \
   %reldir%/oct-base64.h \
   %reldir%/oct-binmap.h \
+  %reldir%/oct-block-pool.h \
   %reldir%/oct-cmplx.h \
   %reldir%/oct-glob.h \
+  %reldir%/oct-intern.h \
   %reldir%/oct-inttypes-fwd.h \
   %reldir%/oct-inttypes.h \
   %reldir%/oct-locbuf.h \
   %reldir%/oct-mutex.h \
+  %reldir%/oct-parallel.h \
+  %reldir%/oct-queue.h \
   %reldir%/oct-refcount.h \
   %reldir%/oct-rl-edit.h \
   %reldir%/oct-rl-hist.h \
   %reldir%/oct-shlib.h \
+  %reldir%/oct-small-vector.h \
   %reldir%/oct-sort.h \
   %reldir%/oct-string.h \
   %reldir%/pathsearch.h \
@@ -71,12 +78,16 @@ UTIL_SRC = \
   %reldir%/lo-regexp.cc \
   %reldir%/lo-utils.cc \
   %reldir%/quit.cc \
+  %reldir%/oct-alloc-stats.cc \
   %reldir%/oct-atomic.c \
   %reldir%/oct-base64.cc \
+  %reldir%/oct-block-pool.cc \
   %reldir%/oct-cmplx.cc \
   %reldir%/oct-glob.cc \
+  %reldir%/oct-intern.cc \
   %reldir%/oct-inttypes.cc \
   %reldir%/oct-mutex.cc \
+  %reldir%/oct-parallel.cc \
   %reldir%/oct-shlib.cc \
   %reldir%/oct-sparse.cc \
   %reldir%/oct-string.cc \
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////
 //
-// Copyright (C) 2016-2023 The Octave Project Developers
+// Copyright (C) 2023 The Octave Project Developers
 //
 // See the file COPYRIGHT.md in the top-level directory of this
 // distribution or <https://octave.org/copyright/>.
@@ -23,28 +23,24 @@
 //
 ////////////////////////////////////////////////////////////////////////
 
-// The base64 functions are provided by gnulib.  We don't include gnulib
-// headers directly in Octave's C++ source files to avoid problems that
-// may be caused by the way that gnulib overrides standard library
-// functions.
-
 #if defined (HAVE_CONFIG_H)
 #  include "config.h"
 #endif
 
-#include "base64.h"
+#include "oct-alloc-stats.h"
 
-#include "base64-wrappers.h"
+OCTAVE_BEGIN_NAMESPACE(octave)
 
-ptrdiff_t
-octave_base64_encode_alloc_wrapper (const char *in, ptrdiff_t inlen, char **out)
+namespace alloc_stats
 {
-  return base64_encode_alloc (in, inlen, out);
-}
 
-bool
-octave_base64_decode_alloc_wrapper (const char *in, ptrdiff_t inlen,
-                                    char **out, ptrdiff_t *outlen)
-{
-  return base64_decode_alloc (in, inlen, out, outlen);
+std::atomic<std::uint64_t> bytes_allocated (0);
+std::atomic<std::uint64_t> bytes_freed (0);
+std::atomic<std::uint64_t> peak_bytes (0);
+std::atomic<std::uint64_t> rep_allocations (0);
+std::atomic<std::uint64_t> cow_copies (0);
+std::atomic<std::uint64_t> hugepage_advised (0);
+
 }
+
+OCTAVE_END_NAMESPACE(octave)
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_alloc_stats_h)
+#define octave_oct_alloc_stats_h 1
+
+#include "octave-config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Global allocation counters fed by the Array rep allocator.  The
+// allocated and freed counters are cumulative and monotone, so a
+// reader can attribute allocation deltas to code regions by taking
+// snapshots without any locking.  Updates are relaxed atomic adds and
+// cost a few nanoseconds per (de)allocation.
+
+namespace alloc_stats
+{
+
+extern OCTAVE_API std::atomic<std::uint64_t> bytes_allocated;
+extern OCTAVE_API std::atomic<std::uint64_t> bytes_freed;
+extern OCTAVE_API std::atomic<std::uint64_t> peak_bytes;
+extern OCTAVE_API std::atomic<std::uint64_t> rep_allocations;
+extern OCTAVE_API std::atomic<std::uint64_t> cow_copies;
+extern OCTAVE_API std::atomic<std::uint64_t> hugepage_advised;
+
+inline void
+count_cow_copy ()
+{
+  cow_copies.fetch_add (1, std::memory_order_relaxed);
+}
+
+inline void
+count_hugepage_advice ()
+{
+  hugepage_advised.fetch_add (1, std::memory_order_relaxed);
+}
+
+inline void
+count_allocation (std::size_t nbytes)
+{
+  rep_allocations.fetch_add (1, std::memory_order_relaxed);
+
+  std::uint64_t allocated
+    = (bytes_allocated.fetch_add (nbytes, std::memory_order_relaxed)
+       + nbytes);
+
+  std::uint64_t current
+    = allocated - bytes_freed.load (std::memory_order_relaxed);
+
+  std::uint64_t peak = peak_bytes.load (std::memory_order_relaxed);
+
+  while (current > peak
+         && ! peak_bytes.compare_exchange_weak (peak, current,
+                                                std::memory_order_relaxed))
+    ;
+}
+
+inline void
+count_deallocation (std::size_t nbytes)
+{
+  bytes_freed.fetch_add (nbytes, std::memory_order_relaxed);
+}
+
+}
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -27,70 +27,195 @@
 #  include "config.h"
 #endif
 
+#include <cstdlib>
+
 #include <algorithm>
+#include <limits>
 
 #include "Array.h"
-#include "base64-wrappers.h"
 #include "oct-base64.h"
 
+// RFC 4648 base64, implemented as single-pass block kernels: the
+// encoder packs three input bytes into one 24-bit word and emits four
+// characters per iteration, and the decoder folds four characters back
+// into one word and writes straight into the destination buffer.  This
+// avoids the per-character state machine and the extra
+// allocate-and-copy pass of the gnulib routines used previously.
+
 OCTAVE_BEGIN_NAMESPACE(octave)
 
+static const char base64_table[65]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+namespace
+{
+  struct base64_inverse
+  {
+    signed char tbl[256];
+
+    base64_inverse ()
+    {
+      std::fill_n (tbl, 256, static_cast<signed char> (-1));
+      for (int i = 0; i < 64; i++)
+        tbl[static_cast<unsigned char> (base64_table[i])] = i;
+    }
+  };
+}
+
+static const base64_inverse b64_inv;
+
 bool
 base64_encode (const char *inc, const std::size_t inlen, char **out)
 {
-  bool ret = false;
+  // Three input bytes become four output characters, plus the
+  // terminating NUL expected by the callers.
+
+  if (inlen > (std::numeric_limits<std::size_t>::max () / 4 - 1) * 3)
+    {
+      (*current_liboctave_error_handler)
+        ("base64_encode: input array too large");
+      return false;
+    }
+
+  std::size_t outlen = 4 * ((inlen + 2) / 3);
+
+  *out = static_cast<char *> (std::malloc (outlen + 1));
 
-  std::ptrdiff_t outlen = octave_base64_encode_alloc_wrapper (inc, inlen, out);
+  if (! *out)
+    {
+      (*current_liboctave_error_handler)
+        ("base64_encode: memory allocation error");
+      return false;
+    }
+
+  const unsigned char *in = reinterpret_cast<const unsigned char *> (inc);
+  char *p = *out;
+
+  std::size_t i = 0;
+
+  for (; i + 3 <= inlen; i += 3)
+    {
+      unsigned int v = (in[i] << 16) | (in[i+1] << 8) | in[i+2];
+
+      *p++ = base64_table[(v >> 18) & 0x3f];
+      *p++ = base64_table[(v >> 12) & 0x3f];
+      *p++ = base64_table[(v >> 6) & 0x3f];
+      *p++ = base64_table[v & 0x3f];
+    }
 
-  if (! out)
+  if (i < inlen)
     {
-      if (outlen == 0 && inlen != 0)
-        (*current_liboctave_error_handler)
-          ("base64_encode: input array too large");
+      unsigned int v = in[i] << 16;
+
+      if (i + 1 < inlen)
+        v |= in[i+1] << 8;
+
+      *p++ = base64_table[(v >> 18) & 0x3f];
+      *p++ = base64_table[(v >> 12) & 0x3f];
+      *p++ = (i + 1 < inlen) ? base64_table[(v >> 6) & 0x3f] : '=';
+      *p++ = '=';
+    }
+
+  *p = '\0';
+
+  return true;
+}
+
+// Decode IN into OUT, which must provide room for 3 * (INLEN / 4)
+// bytes.  INLEN must be a multiple of four; '=' padding is accepted in
+// the last quad only.  Returns false on invalid input.
+
+static bool
+do_base64_decode (const char *in, std::size_t inlen, char *out,
+                  std::size_t *outlen)
+{
+  const signed char *tbl = b64_inv.tbl;
+
+  std::size_t nquad = inlen / 4;
+  std::size_t n = 0;
+  std::size_t i = 0;
+
+  for (std::size_t q = 0; q < nquad; q++, i += 4)
+    {
+      int a = tbl[static_cast<unsigned char> (in[i])];
+      int b = tbl[static_cast<unsigned char> (in[i+1])];
+      int c = tbl[static_cast<unsigned char> (in[i+2])];
+      int d = tbl[static_cast<unsigned char> (in[i+3])];
+
+      if ((a | b | c | d) >= 0)
+        {
+          unsigned int v = (a << 18) | (b << 12) | (c << 6) | d;
+
+          out[n++] = static_cast<char> (v >> 16);
+          out[n++] = static_cast<char> (v >> 8);
+          out[n++] = static_cast<char> (v);
+        }
       else
-        (*current_liboctave_error_handler)
-          ("base64_encode: memory allocation error");
+        {
+          // Only '=' padding in the final quad is acceptable here.
+
+          if (q + 1 != nquad || a < 0 || b < 0 || in[i+3] != '=')
+            return false;
+
+          if (in[i+2] == '=')
+            out[n++] = static_cast<char> ((a << 2) | (b >> 4));
+          else
+            {
+              if (c < 0)
+                return false;
+
+              out[n++] = static_cast<char> ((a << 2) | (b >> 4));
+              out[n++] = static_cast<char> ((b << 4) | (c >> 2));
+            }
+        }
     }
-  else
-    ret = true;
 
-  return ret;
+  *outlen = n;
+
+  return true;
 }
 
-Array<double>
-base64_decode (const std::string& str)
+// Number of bytes a valid decode of STR will produce, judging by the
+// trailing padding; the decoder itself verifies validity.
+
+static std::size_t
+base64_decoded_length (const std::string& str)
 {
-  Array<double> retval;
+  std::size_t inlen = str.length ();
+
+  std::size_t npad = 0;
 
-  double *out;
-  std::ptrdiff_t outlen;
+  if (inlen >= 4)
+    npad = (str[inlen-1] == '=') + (str[inlen-2] == '=');
 
-  bool ok
-    = octave_base64_decode_alloc_wrapper (str.data (), str.length (),
-                                          reinterpret_cast<char **> (&out),
-                                          &outlen);
+  return 3 * (inlen / 4) - npad;
+}
 
-  if (! ok)
+Array<double>
+base64_decode (const std::string& str)
+{
+  if (str.length () % 4 != 0)
     (*current_liboctave_error_handler)
       ("base64_decode: input was not valid base64");
 
-  if (! out)
+  std::size_t outlen = base64_decoded_length (str);
+
+  if ((outlen % sizeof (double)) != 0)
     (*current_liboctave_error_handler)
-      ("base64_decode: memory allocation error");
+      ("base64_decode: incorrect input size");
 
-  if ((outlen % (sizeof (double) / sizeof (char))) != 0)
-    {
-      ::free (out);
-      (*current_liboctave_error_handler)
-        ("base64_decode: incorrect input size");
-    }
-  else
-    {
-      octave_idx_type len = (outlen * sizeof (char)) / sizeof (double);
-      retval.resize (dim_vector (1, len));
-      std::copy (out, out + len, retval.fortran_vec ());
-      ::free (out);
-    }
+  octave_idx_type len = outlen / sizeof (double);
+
+  Array<double> retval (dim_vector (1, len));
+
+  std::size_t n;
+
+  if (! do_base64_decode (str.data (), str.length (),
+                          reinterpret_cast<char *> (retval.fortran_vec ()),
+                          &n)
+      || n != outlen)
+    (*current_liboctave_error_handler)
+      ("base64_decode: input was not valid base64");
 
   return retval;
 }
@@ -98,26 +223,22 @@ base64_decode (const std::string& str)
 intNDArray<octave_uint8>
 base64_decode_bytes (const std::string& str)
 {
-  intNDArray<octave_uint8> retval;
+  if (str.length () % 4 != 0)
+    (*current_liboctave_error_handler)
+      ("base64_decode: input was not valid base64");
 
-  char *out;
-  std::ptrdiff_t outlen;
+  std::size_t outlen = base64_decoded_length (str);
 
-  bool ok
-    = octave_base64_decode_alloc_wrapper (str.data (), str.length (),
-                                          &out, &outlen);
+  intNDArray<octave_uint8> retval (dim_vector (1, outlen));
 
-  if (! ok)
-    (*current_liboctave_error_handler)
-      ("base64_decode: input was not valid base64");
+  std::size_t n;
 
-  if (! out)
+  if (! do_base64_decode (str.data (), str.length (),
+                          reinterpret_cast<char *> (retval.fortran_vec ()),
+                          &n)
+      || n != outlen)
     (*current_liboctave_error_handler)
-      ("base64_decode: memory allocation error");
-
-  retval.resize (dim_vector (1, outlen));
-  std::copy (out, out + outlen, retval.fortran_vec ());
-  ::free (out);
+      ("base64_decode: input was not valid base64");
 
   return retval;
 }
@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdio>
+#include <new>
+
+#include "oct-block-pool.h"
+
+#include "oct-env.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+namespace block_pool_stats
+{
+
+std::atomic<std::uint64_t> hits (0);
+std::atomic<std::uint64_t> returns (0);
+
+}
+
+// Blocks below the minimum size go straight back to the allocator,
+// whose own fast paths already handle them well; caching them would
+// just crowd out the large blocks the pool exists for.
+
+static const std::size_t min_block_bytes = 4096;
+
+static const std::size_t default_pool_limit = 16 * 1024 * 1024;
+
+static std::size_t
+initial_pool_limit ()
+{
+  std::string envval = sys::env::getenv ("OCTAVE_BLOCK_POOL_BYTES");
+
+  if (! envval.empty ())
+    {
+      unsigned long n;
+      if (sscanf (envval.c_str (), "%lu", &n) == 1)
+        return n;
+    }
+
+  return default_pool_limit;
+}
+
+namespace
+{
+
+// Each thread keeps its own slots, so no locking is needed; a block
+// freed on one thread simply recirculates there.  Anything still
+// parked when the thread exits is returned to the system.
+
+struct block_pool
+{
+  static const int max_slots = 8;
+
+  struct slot
+  {
+    void *ptr;
+    std::size_t nbytes;
+  };
+
+  slot m_slots[max_slots];
+  int m_used = 0;
+  std::size_t m_total_bytes = 0;
+  std::size_t m_limit;
+
+  block_pool () : m_limit (initial_pool_limit ()) { }
+
+  ~block_pool ()
+  {
+    for (int i = 0; i < m_used; i++)
+      ::operator delete (m_slots[i].ptr);
+  }
+
+  void * acquire (std::size_t nbytes)
+  {
+    for (int i = 0; i < m_used; i++)
+      {
+        if (m_slots[i].nbytes == nbytes)
+          {
+            void *ptr = m_slots[i].ptr;
+            m_total_bytes -= nbytes;
+            m_slots[i] = m_slots[--m_used];
+            return ptr;
+          }
+      }
+
+    return nullptr;
+  }
+
+  bool release (void *ptr, std::size_t nbytes)
+  {
+    if (nbytes < min_block_bytes || m_total_bytes + nbytes > m_limit)
+      return false;
+
+    if (m_used == max_slots)
+      {
+        // Full: evict the oldest entry in favor of the newcomer, so
+        // the pool tracks the sizes the program is using now.
+        ::operator delete (m_slots[0].ptr);
+        m_total_bytes -= m_slots[0].nbytes;
+        for (int i = 1; i < m_used; i++)
+          m_slots[i-1] = m_slots[i];
+        m_used--;
+      }
+
+    m_slots[m_used].ptr = ptr;
+    m_slots[m_used].nbytes = nbytes;
+    m_used++;
+    m_total_bytes += nbytes;
+
+    return true;
+  }
+};
+
+}
+
+static thread_local block_pool the_pool;
+
+void *
+block_pool_acquire (std::size_t nbytes)
+{
+  void *ptr = the_pool.acquire (nbytes);
+
+  if (ptr)
+    block_pool_stats::hits.fetch_add (1, std::memory_order_relaxed);
+
+  return ptr;
+}
+
+bool
+block_pool_release (void *ptr, std::size_t nbytes)
+{
+  if (the_pool.release (ptr, nbytes))
+    {
+      block_pool_stats::returns.fetch_add (1, std::memory_order_relaxed);
+      return true;
+    }
+
+  return false;
+}
+
+OCTAVE_END_NAMESPACE(octave)
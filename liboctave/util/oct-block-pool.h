@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_block_pool_h)
+#define octave_oct_block_pool_h 1
+
+#include "octave-config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A small per-thread cache of recently freed array data blocks, keyed
+// by exact byte size.  Loops that repeatedly build and drop
+// same-shaped temporaries (the common steady state of element-wise
+// expression chains) hand each iteration the block the previous one
+// released instead of going back to the system allocator every time.
+//
+// Blocks are raw storage obtained from operator new through
+// std::allocator, so the pool only serves reps whose allocator is
+// std::allocator (see ArrayRep::allocate).  The cache is bounded both
+// in entries and in total bytes (OCTAVE_BLOCK_POOL_BYTES, 0 disables
+// it) and holds nothing a caller could observe: a block is either
+// owned by exactly one rep or parked here.
+
+// Return a cached block of exactly NBYTES, or a null pointer if none
+// is available.
+
+extern OCTAVE_API void * block_pool_acquire (std::size_t nbytes);
+
+// Offer a block of NBYTES to the pool.  Returns true if the pool took
+// ownership; otherwise the caller must deallocate the block itself.
+
+extern OCTAVE_API bool block_pool_release (void *ptr, std::size_t nbytes);
+
+namespace block_pool_stats
+{
+
+extern OCTAVE_API std::atomic<std::uint64_t> hits;
+extern OCTAVE_API std::atomic<std::uint64_t> returns;
+
+}
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <mutex>
+#include <unordered_set>
+
+#include "oct-intern.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+const std::string *
+interned_string::intern (const std::string& s)
+{
+  // The pool is a node-based container, so element addresses are
+  // stable across rehashing and the returned pointers stay valid for
+  // the life of the process.
+
+  static std::unordered_set<std::string> pool;
+  static std::mutex pool_mutex;
+
+  std::lock_guard<std::mutex> lock (pool_mutex);
+
+  return &*pool.insert (s).first;
+}
+
+const std::string *
+interned_string::empty_string ()
+{
+  static const std::string *s = intern (std::string ());
+
+  return s;
+}
+
+OCTAVE_END_NAMESPACE(octave)
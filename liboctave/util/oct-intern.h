@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_intern_h)
+#define octave_oct_intern_h 1
+
+#include "octave-config.h"
+
+#include <functional>
+#include <string>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A name drawn from a process-lifetime pool of unique strings.
+// Interning a string returns the address of the single pooled copy, so
+// names with equal contents have equal addresses and can be compared
+// and hashed by pointer.  Pooled strings are never deallocated, so
+// this is intended for identifiers, field names, and similar small,
+// recurring vocabularies -- not for arbitrary user data.
+
+class OCTAVE_API interned_string
+{
+public:
+
+  interned_string () : m_str (empty_string ()) { }
+
+  interned_string (const std::string& s) : m_str (intern (s)) { }
+
+  interned_string (const char *s) : m_str (intern (s)) { }
+
+  interned_string (const interned_string&) = default;
+
+  interned_string& operator = (const interned_string&) = default;
+
+  ~interned_string () = default;
+
+  const std::string& str () const { return *m_str; }
+
+  // The pooled copy; valid for the life of the process.
+
+  const std::string * ptr () const { return m_str; }
+
+  operator const std::string& () const { return *m_str; }
+
+  bool empty () const { return m_str->empty (); }
+
+  // Pooled contents are unique, so identity compares contents.
+
+  bool operator == (const interned_string& other) const
+  { return m_str == other.m_str; }
+
+  bool operator != (const interned_string& other) const
+  { return m_str != other.m_str; }
+
+  // Content order, so interned keys sort the same way plain strings
+  // do.
+
+  bool operator < (const interned_string& other) const
+  { return m_str != other.m_str && *m_str < *other.m_str; }
+
+  // Transparent comparator for ordered containers keyed by interned
+  // names: lookups with a plain std::string compare contents directly
+  // instead of interning the query first.
+
+  struct order
+  {
+    typedef void is_transparent;
+
+    bool operator () (const interned_string& a,
+                      const interned_string& b) const
+    { return a < b; }
+
+    bool operator () (const interned_string& a, const std::string& b) const
+    { return a.str () < b; }
+
+    bool operator () (const std::string& a, const interned_string& b) const
+    { return a < b.str (); }
+  };
+
+private:
+
+  static OCTAVE_API const std::string * intern (const std::string& s);
+
+  static OCTAVE_API const std::string * empty_string ();
+
+  const std::string *m_str;
+};
+
+OCTAVE_END_NAMESPACE(octave)
+
+namespace std
+{
+  template <>
+  struct hash<octave::interned_string>
+  {
+    size_t operator () (const octave::interned_string& s) const
+    {
+      return hash<const string *> () (s.ptr ());
+    }
+  };
+}
+
+#endif
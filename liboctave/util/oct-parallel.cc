@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#include <cstdio>
+
+#include "oct-parallel.h"
+
+#include "lo-sysinfo.h"
+#include "lo-utils.h"
+#include "nproc-wrapper.h"
+#include "oct-env.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Splitting an element-wise operation is only profitable once it is
+// large enough that the per-thread startup cost disappears against the
+// memory traffic, so the default threshold is deliberately generous.
+
+static const octave_idx_type default_parallel_threshold = 100000;
+
+static octave_idx_type
+initial_parallel_threshold ()
+{
+  std::string envval = sys::env::getenv ("OCTAVE_PARALLEL_THRESHOLD");
+
+  if (! envval.empty ())
+    {
+      octave_idx_type n;
+      if (sscanf (envval.c_str (), "%" OCTAVE_IDX_TYPE_FORMAT, &n) == 1
+          && n >= 0)
+        return n;
+    }
+
+  return default_parallel_threshold;
+}
+
+static octave_idx_type parallel_threshold = -1;
+
+octave_idx_type
+parallel_numel_threshold ()
+{
+  if (parallel_threshold < 0)
+    parallel_threshold = initial_parallel_threshold ();
+
+  return parallel_threshold;
+}
+
+void
+set_parallel_numel_threshold (octave_idx_type n)
+{
+  parallel_threshold = (n >= 0 ? n : default_parallel_threshold);
+}
+
+static int num_threads = 0;
+
+int
+parallel_num_threads ()
+{
+  if (num_threads == 0)
+    {
+      unsigned long int nproc
+        = octave_num_processors_wrapper (OCTAVE_NPROC_CURRENT_OVERRIDABLE);
+
+      std::string envval = sys::env::getenv ("OCTAVE_NUM_THREADS");
+
+      if (! envval.empty ())
+        {
+          int n;
+          if (sscanf (envval.c_str (), "%d", &n) == 1 && n > 0)
+            nproc = n;
+        }
+
+      num_threads = (nproc > 0 ? static_cast<int> (nproc) : 1);
+    }
+
+  return num_threads;
+}
+
+void
+set_parallel_num_threads (int n)
+{
+  // Zero forces re-detection on the next call.
+
+  num_threads = (n > 0 ? n : 0);
+}
+
+int
+cap_blas_threads ()
+{
+  int prev = sys::blas_num_threads ();
+
+  if (prev > 1)
+    sys::set_blas_num_threads (1);
+
+  return prev;
+}
+
+void
+restore_blas_threads (int nthreads)
+{
+  if (nthreads > 1)
+    sys::set_blas_num_threads (nthreads);
+}
+
+OCTAVE_END_NAMESPACE(octave)
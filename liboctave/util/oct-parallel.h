@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_parallel_h)
+#define octave_oct_parallel_h 1
+
+#include "octave-config.h"
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// Shared helpers for splitting large element-wise operations across
+// threads.  The work is only divided when Octave was built with OpenMP
+// support, when more than one processor is available, and when the
+// number of elements is large enough that the threading overhead is
+// negligible against the memory traffic of the operation itself.
+
+// Number of elements below which chunked_parallel_for runs the whole
+// range on the calling thread.  The default may be overridden with the
+// OCTAVE_PARALLEL_THRESHOLD environment variable (a value of zero
+// disables threading entirely).
+
+extern OCTAVE_API octave_idx_type parallel_numel_threshold ();
+
+extern OCTAVE_API void set_parallel_numel_threshold (octave_idx_type n);
+
+// Number of worker threads to use for chunked operations, normally the
+// number of processors currently available to the process.  The
+// OCTAVE_NUM_THREADS environment variable may be used to reduce it.
+
+extern OCTAVE_API int parallel_num_threads ();
+
+// Override the number of worker threads.  A value of zero (or any
+// non-positive value) returns to automatic detection.
+
+extern OCTAVE_API void set_parallel_num_threads (int n);
+
+// Cap BLAS-level threading to a single thread for the duration of an
+// Octave-level parallel region so the two levels compose instead of
+// oversubscribing the machine.  cap_blas_threads returns the previous
+// BLAS thread count, to be handed to the matching restore_blas_threads
+// call; both are no-ops when the loaded BLAS has no control hook.
+
+extern OCTAVE_API int cap_blas_threads ();
+
+extern OCTAVE_API void restore_blas_threads (int nthreads);
+
+// Apply FCN (START, LEN) over subranges that partition [0, N), possibly
+// concurrently from multiple threads.  FCN must be safe to call
+// concurrently on disjoint subranges and must not throw.  COST is the
+// total number of elements the whole operation touches and is what the
+// split is gated on; it equals N for plain element-wise operations, but
+// callers whose per-index work covers several elements (for example one
+// reduction page per index) should pass the element count explicitly.
+// The partition is deterministic -- subrange T always runs on team
+// thread T -- so on first-touch NUMA systems pages first touched
+// through this function stay local to the thread that revisits the
+// same subrange in later passes.
+
+template <typename F>
+inline void
+chunked_parallel_for (octave_idx_type n, octave_idx_type cost, F fcn)
+{
+#if defined (_OPENMP)
+
+  octave_idx_type threshold = parallel_numel_threshold ();
+
+  if (threshold > 0 && cost >= threshold)
+    {
+      int nthreads = parallel_num_threads ();
+
+      if (nthreads > 1)
+        {
+          octave_idx_type chunk = (n + nthreads - 1) / nthreads;
+
+          int prev_blas_threads = cap_blas_threads ();
+
+#         pragma omp parallel for num_threads (nthreads) schedule (static)
+          for (int t = 0; t < nthreads; t++)
+            {
+              octave_idx_type start = t * chunk;
+              octave_idx_type len = (start + chunk <= n ? chunk : n - start);
+              if (len > 0)
+                fcn (start, len);
+            }
+
+          restore_blas_threads (prev_blas_threads);
+
+          return;
+        }
+    }
+
+#else
+
+  octave_unused_parameter (cost);
+
+#endif
+
+  fcn (0, n);
+}
+
+template <typename F>
+inline void
+chunked_parallel_for (octave_idx_type n, F fcn)
+{
+  chunked_parallel_for (n, n, fcn);
+}
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_queue_h)
+#define octave_oct_queue_h 1
+
+#include "octave-config.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A bounded FIFO connecting producer and consumer threads.  Any
+// number of threads may push and pop concurrently; a full queue
+// blocks producers and an empty queue blocks consumers, which gives
+// streaming pipelines backpressure for free.
+//
+// Waits use a mutex and condition variables rather than a lock-free
+// ring buffer: the payloads stored here (octave_value objects, for
+// example) have copy constructors that touch shared reference
+// counts, so element transfer has to happen under a lock anyway and
+// the queue itself is never a per-element hot path.
+
+template <typename T>
+class bounded_queue
+{
+public:
+
+  explicit bounded_queue (std::size_t capacity)
+    : m_capacity (capacity > 0 ? capacity : 1)
+  { }
+
+  OCTAVE_DISABLE_COPY_MOVE (bounded_queue)
+
+  ~bounded_queue () = default;
+
+  // Append VAL, waiting up to TIMEOUT seconds for space; a TIMEOUT of
+  // zero makes the call non-blocking.  Returns false if the queue is
+  // still full when the timeout expires or if it has been closed.
+
+  bool push (const T& val, double timeout = 0)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+
+    if (! wait_ready (lock, m_not_full, timeout,
+                      [this] () {
+                        return m_closed || m_items.size () < m_capacity;
+                      }))
+      return false;
+
+    if (m_closed)
+      return false;
+
+    m_items.push_back (val);
+
+    m_not_empty.notify_one ();
+
+    return true;
+  }
+
+  // Remove the oldest element into VAL, waiting up to TIMEOUT seconds
+  // for one to arrive.  Returns false if the queue is still empty
+  // when the timeout expires; after close, remaining elements are
+  // still delivered and only then does pop fail.
+
+  bool pop (T& val, double timeout = 0)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+
+    if (! wait_ready (lock, m_not_empty, timeout,
+                      [this] () {
+                        return m_closed || ! m_items.empty ();
+                      }))
+      return false;
+
+    if (m_items.empty ())
+      return false;
+
+    val = m_items.front ();
+    m_items.pop_front ();
+
+    m_not_full.notify_one ();
+
+    return true;
+  }
+
+  // Mark the queue closed and wake all blocked producers and
+  // consumers.  Subsequent pushes fail immediately.
+
+  void close ()
+  {
+    {
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_closed = true;
+    }
+
+    m_not_full.notify_all ();
+    m_not_empty.notify_all ();
+  }
+
+  bool is_closed () const
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    return m_closed;
+  }
+
+  std::size_t size () const
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    return m_items.size ();
+  }
+
+  std::size_t capacity () const { return m_capacity; }
+
+private:
+
+  template <typename P>
+  bool wait_ready (std::unique_lock<std::mutex>& lock,
+                   std::condition_variable& cv, double timeout, P pred)
+  {
+    if (pred ())
+      return true;
+
+    if (timeout <= 0)
+      return false;
+
+    return cv.wait_for (lock, std::chrono::duration<double> (timeout), pred);
+  }
+
+  mutable std::mutex m_mutex;
+
+  std::condition_variable m_not_full;
+  std::condition_variable m_not_empty;
+
+  std::deque<T> m_items;
+
+  std::size_t m_capacity;
+
+  bool m_closed = false;
+};
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
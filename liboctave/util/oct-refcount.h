@@ -33,6 +33,20 @@
 OCTAVE_BEGIN_NAMESPACE(octave)
 
 // Encapsulates a reference counter.
+//
+// The count is atomic, which gives the copy-on-write representations
+// built on top of it (Array<T>, octave_value, ...) the same
+// thread-safety contract as std::shared_ptr: distinct objects may be
+// copied, read, and destroyed concurrently from different threads,
+// even when they share a rep, but concurrent access to a single
+// object, or any non-const access to a shared rep, still requires
+// external synchronization.  In practice that means worker threads
+// may freely operate on (const) copies of an Array handed to them by
+// the main thread without deep-copying the data first.
+//
+// Increments only need to be atomic, so they use relaxed ordering;
+// the decrement that may release the object must order prior writes
+// before the destruction that follows, hence acquire-release.
 
 template <typename T>
 class refcount
@@ -52,22 +66,22 @@ public:
   // Increment/Decrement.  int is postfix.
   count_type operator++ ()
   {
-    return ++m_count;
+    return m_count.fetch_add (1, std::memory_order_relaxed) + 1;
   }
 
   count_type operator++ (int)
   {
-    return m_count++;
+    return m_count.fetch_add (1, std::memory_order_relaxed);
   }
 
   count_type operator-- ()
   {
-    return --m_count;
+    return m_count.fetch_sub (1, std::memory_order_acq_rel) - 1;
   }
 
   count_type operator-- (int)
   {
-    return m_count--;
+    return m_count.fetch_sub (1, std::memory_order_acq_rel);
   }
 
   count_type value () const
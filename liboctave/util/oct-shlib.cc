@@ -29,6 +29,7 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 
 extern "C"
 {
@@ -111,6 +112,8 @@ dynamic_library::dynlib_rep::fake_reload ()
 dynamic_library::dynlib_rep *
 dynamic_library::dynlib_rep::get_instance (const std::string& f, bool fake)
 {
+  std::lock_guard<std::recursive_mutex> lock (s_instances_mutex);
+
   dynlib_rep *retval = nullptr;
   std::map<std::string, dynlib_rep *>::iterator p = s_instances.find (f);
   if (p != s_instances.end ())
@@ -126,6 +129,29 @@ dynamic_library::dynlib_rep::get_instance (const std::string& f, bool fake)
   return retval;
 }
 
+void *
+dynamic_library::dynlib_rep::search_cached (const std::string& sym_name)
+{
+  // A global search across all loaded objects can pick up symbols
+  // from libraries loaded later, so it is not memoized.
+
+  if (m_search_all_loaded)
+    return search (sym_name);
+
+  std::lock_guard<std::mutex> lock (m_symbol_cache_mutex);
+
+  auto p = m_symbol_cache.find (sym_name);
+
+  if (p != m_symbol_cache.end ())
+    return p->second;
+
+  void *f = search (sym_name);
+
+  m_symbol_cache[sym_name] = f;
+
+  return f;
+}
+
 std::list<std::string>
 dynamic_library::dynlib_rep::function_names () const
 {
@@ -164,6 +190,8 @@ dynamic_library::dynlib_rep::remove_fcn_name (const std::string& fcn_name)
   return retval;
 }
 
+std::recursive_mutex dynamic_library::dynlib_rep::s_instances_mutex;
+
 std::map<std::string, dynamic_library::dynlib_rep *>
 dynamic_library::dynlib_rep::s_instances;
 
@@ -31,6 +31,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "oct-time.h"
@@ -65,6 +66,8 @@ public: // FIXME: make this class private?
 
     virtual ~dynlib_rep ()
     {
+      std::lock_guard<std::recursive_mutex> lock (s_instances_mutex);
+
       s_instances.erase (m_file);
     }
 
@@ -75,6 +78,12 @@ public: // FIXME: make this class private?
                           const name_mangler& = name_mangler ())
     { return nullptr; }
 
+    // Like search with an already-mangled name, but memoizing the
+    // result, so repeated lookups of a symbol bypass the system
+    // resolver.  Safe to call from multiple threads.
+
+    OCTAVE_API void * search_cached (const std::string& sym_name);
+
     OCTAVE_API bool is_out_of_date () const;
 
     // This method will be overridden conditionally.
@@ -108,6 +117,10 @@ public: // FIXME: make this class private?
 
     static OCTAVE_API std::map<std::string, dynlib_rep *> s_instances;
 
+    // Guards s_instances; recursive because creating an instance
+    // registers itself from within a locked lookup.
+    static OCTAVE_API std::recursive_mutex s_instances_mutex;
+
     // Set of hooked function names.
     typedef std::map<std::string, std::size_t>::iterator fcn_names_iterator;
     typedef std::map<std::string, std::size_t>::const_iterator fcn_names_const_iterator;
@@ -116,6 +129,12 @@ public: // FIXME: make this class private?
     std::string m_file;
     sys::time m_time_loaded;
     bool m_search_all_loaded;
+
+    // Resolved symbol addresses, hits and misses both.  The symbols
+    // of an open library never change, so entries stay valid for the
+    // life of the rep.
+    std::map<std::string, void *> m_symbol_cache;
+    std::mutex m_symbol_cache_mutex;
   };
 
 private:
@@ -179,7 +198,9 @@ public:
   void * search (const std::string& nm,
                 const name_mangler& mangler = name_mangler ()) const
   {
-    void *f = m_rep->search (nm, mangler);
+    std::string sym_name = (mangler ? mangler (nm) : nm);
+
+    void *f = m_rep->search_cached (sym_name);
     if (f)
       m_rep->add_fcn_name (nm);
 
@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if ! defined (octave_oct_small_vector_h)
+#define octave_oct_small_vector_h 1
+
+#include "octave-config.h"
+
+#include <cstddef>
+
+#include <iterator>
+#include <new>
+#include <utility>
+
+OCTAVE_BEGIN_NAMESPACE(octave)
+
+// A contiguous sequence like std::vector, but the first N elements are
+// stored inside the object itself so short sequences never touch the
+// heap.  Argument and return lists are almost always short, so giving
+// octave_value_list inline storage removes an allocation and a free
+// from every function call.
+//
+// Only the operations octave_value_list needs are provided; this is
+// not a general replacement for std::vector.
+
+template <typename T, std::size_t N>
+class
+small_vector
+{
+public:
+
+  typedef T value_type;
+  typedef T *iterator;
+  typedef const T *const_iterator;
+
+  small_vector ()
+    : m_data (inline_data ()), m_size (0), m_capacity (N)
+  { }
+
+  explicit small_vector (std::size_t n)
+    : small_vector ()
+  {
+    resize (n);
+  }
+
+  small_vector (std::size_t n, const T& val)
+    : small_vector ()
+  {
+    resize (n, val);
+  }
+
+  // The SFINAE guard keeps this constructor out of overload
+  // resolution for integer arguments, which belong to the (N, VAL)
+  // constructor above.
+
+  template <typename InputIterator,
+            typename = typename
+            std::iterator_traits<InputIterator>::iterator_category>
+  small_vector (InputIterator first, InputIterator last)
+    : small_vector ()
+  {
+    for (; first != last; ++first)
+      push_back (*first);
+  }
+
+  small_vector (const small_vector& other)
+    : small_vector ()
+  {
+    reserve (other.m_size);
+
+    for (std::size_t i = 0; i < other.m_size; i++)
+      {
+        ::new (static_cast<void *> (m_data + i)) T (other.m_data[i]);
+        m_size++;
+      }
+  }
+
+  small_vector (small_vector&& other)
+    : small_vector ()
+  {
+    adopt (std::move (other));
+  }
+
+  small_vector& operator = (const small_vector& other)
+  {
+    if (this != &other)
+      {
+        clear ();
+        reserve (other.m_size);
+
+        for (std::size_t i = 0; i < other.m_size; i++)
+          {
+            ::new (static_cast<void *> (m_data + i)) T (other.m_data[i]);
+            m_size++;
+          }
+      }
+
+    return *this;
+  }
+
+  small_vector& operator = (small_vector&& other)
+  {
+    if (this != &other)
+      {
+        clear ();
+        release_heap ();
+
+        adopt (std::move (other));
+      }
+
+    return *this;
+  }
+
+  ~small_vector ()
+  {
+    clear ();
+    release_heap ();
+  }
+
+  std::size_t size () const { return m_size; }
+
+  bool empty () const { return m_size == 0; }
+
+  T& operator [] (std::size_t i) { return m_data[i]; }
+
+  const T& operator [] (std::size_t i) const { return m_data[i]; }
+
+  iterator begin () { return m_data; }
+  iterator end () { return m_data + m_size; }
+
+  const_iterator begin () const { return m_data; }
+  const_iterator end () const { return m_data + m_size; }
+
+  void push_back (const T& val)
+  {
+    reserve (m_size + 1);
+    ::new (static_cast<void *> (m_data + m_size)) T (val);
+    m_size++;
+  }
+
+  void push_back (T&& val)
+  {
+    reserve (m_size + 1);
+    ::new (static_cast<void *> (m_data + m_size)) T (std::move (val));
+    m_size++;
+  }
+
+  void resize (std::size_t n)
+  {
+    if (n <= m_size)
+      shrink (n);
+    else
+      {
+        reserve (n);
+
+        while (m_size < n)
+          {
+            ::new (static_cast<void *> (m_data + m_size)) T ();
+            m_size++;
+          }
+      }
+  }
+
+  void resize (std::size_t n, const T& val)
+  {
+    if (n <= m_size)
+      shrink (n);
+    else
+      {
+        reserve (n);
+
+        while (m_size < n)
+          {
+            ::new (static_cast<void *> (m_data + m_size)) T (val);
+            m_size++;
+          }
+      }
+  }
+
+  void clear () { shrink (0); }
+
+  void reserve (std::size_t n)
+  {
+    if (n <= m_capacity)
+      return;
+
+    // Grow geometrically so repeated append calls stay amortized
+    // constant time.
+
+    std::size_t new_capacity = 2 * m_capacity;
+    if (new_capacity < n)
+      new_capacity = n;
+
+    T *new_data = static_cast<T *>
+      (::operator new (new_capacity * sizeof (T)));
+
+    for (std::size_t i = 0; i < m_size; i++)
+      {
+        ::new (static_cast<void *> (new_data + i)) T (std::move (m_data[i]));
+        m_data[i].~T ();
+      }
+
+    release_heap ();
+
+    m_data = new_data;
+    m_capacity = new_capacity;
+  }
+
+private:
+
+  T * inline_data ()
+  {
+    return reinterpret_cast<T *> (m_inline);
+  }
+
+  void shrink (std::size_t n)
+  {
+    while (m_size > n)
+      {
+        m_size--;
+        m_data[m_size].~T ();
+      }
+  }
+
+  void release_heap ()
+  {
+    if (m_capacity > N)
+      ::operator delete (static_cast<void *> (m_data));
+  }
+
+  // Caller is responsible for leaving *this empty and inline first.
+
+  void adopt (small_vector&& other)
+  {
+    if (other.m_capacity > N)
+      {
+        // Steal the heap buffer.
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_data = other.inline_data ();
+        other.m_size = 0;
+        other.m_capacity = N;
+      }
+    else
+      {
+        // Inline elements must be moved one by one.
+
+        for (std::size_t i = 0; i < other.m_size; i++)
+          {
+            ::new (static_cast<void *> (m_data + i))
+              T (std::move (other.m_data[i]));
+            m_size++;
+          }
+
+        other.clear ();
+      }
+  }
+
+  alignas (T) unsigned char m_inline[N * sizeof (T)];
+
+  T *m_data;
+  std::size_t m_size;
+  std::size_t m_capacity;
+};
+
+OCTAVE_END_NAMESPACE(octave)
+
+#endif
@@ -111,10 +111,13 @@
 #include <algorithm>
 #include <cstring>
 #include <stack>
+#include <type_traits>
 
 #include "lo-error.h"
 #include "lo-mappers.h"
+#include "oct-inttypes-fwd.h"
 #include "quit.h"
+#include "oct-parallel.h"
 #include "oct-sort.h"
 #include "oct-locbuf.h"
 
@@ -1511,26 +1514,352 @@ octave_sort<T>::sort (T *data, octave_idx_type *idx, octave_idx_type nel,
     }
 }
 
+// Stable parallel merge sort.  The array is split into as many
+// contiguous chunks as there are worker threads (rounded down to a
+// power of two so the merge tree stays balanced), each chunk is
+// timsorted by its own octave_sort instance, and adjacent sorted
+// chunks are then merged pairwise, with each round's merges also
+// running concurrently.  Taking the second element only when it
+// compares strictly before the first keeps equal elements in their
+// original order, so the result is identical to the serial sort.
+
+#if defined (_OPENMP)
+
+// Largest power of two not greater than the number of worker threads,
+// or 1 when NEL is too small for threading to pay off.
+
+static inline int
+parallel_sort_nchunks (octave_idx_type nel)
+{
+  octave_idx_type threshold = octave::parallel_numel_threshold ();
+
+  if (threshold <= 0 || nel < 2 * threshold)
+    return 1;
+
+  int nthreads = octave::parallel_num_threads ();
+
+  int nchunks = 1;
+  while (2 * nchunks <= nthreads && 2 * static_cast<octave_idx_type> (nchunks) <= nel / threshold)
+    nchunks *= 2;
+
+  return nchunks;
+}
+
+template <typename T, typename Comp>
+static void
+merge_sorted_chunks (T *data, octave_idx_type *idx,
+                     T *dtmp, octave_idx_type *itmp,
+                     octave_idx_type lo, octave_idx_type mid,
+                     octave_idx_type hi, Comp comp)
+{
+  octave_idx_type i = lo, j = mid, k = lo;
+
+  while (i < mid && j < hi)
+    {
+      if (comp (data[j], data[i]))
+        {
+          dtmp[k] = data[j];
+          if (idx)
+            itmp[k] = idx[j];
+          j++, k++;
+        }
+      else
+        {
+          dtmp[k] = data[i];
+          if (idx)
+            itmp[k] = idx[i];
+          i++, k++;
+        }
+    }
+
+  for (; i < mid; i++, k++)
+    {
+      dtmp[k] = data[i];
+      if (idx)
+        itmp[k] = idx[i];
+    }
+
+  for (; j < hi; j++, k++)
+    {
+      dtmp[k] = data[j];
+      if (idx)
+        itmp[k] = idx[j];
+    }
+
+  std::copy_n (dtmp + lo, hi - lo, data + lo);
+  if (idx)
+    std::copy_n (itmp + lo, hi - lo, idx + lo);
+}
+
+#endif
+
+template <typename T>
+template <typename Comp>
+void
+octave_sort<T>::parallel_sort (T *data, octave_idx_type nel, Comp comp)
+{
+  parallel_sort (data, nullptr, nel, comp);
+}
+
+template <typename T>
+template <typename Comp>
+void
+octave_sort<T>::parallel_sort (T *data, octave_idx_type *idx,
+                               octave_idx_type nel, Comp comp)
+{
+#if defined (_OPENMP)
+
+  int nchunks = parallel_sort_nchunks (nel);
+
+  if (nchunks > 1)
+    {
+      OCTAVE_LOCAL_BUFFER (octave_idx_type, offsets, nchunks + 1);
+
+      octave_idx_type chunk = nel / nchunks;
+      for (int c = 0; c < nchunks; c++)
+        offsets[c] = c * chunk;
+      offsets[nchunks] = nel;
+
+#     pragma omp parallel num_threads (nchunks)
+      {
+        octave_sort<T> chunk_sort (m_compare);
+
+#       pragma omp for schedule (static)
+        for (int c = 0; c < nchunks; c++)
+          {
+            if (idx)
+              chunk_sort.sort (data + offsets[c], idx + offsets[c],
+                               offsets[c+1] - offsets[c], comp);
+            else
+              chunk_sort.sort (data + offsets[c],
+                               offsets[c+1] - offsets[c], comp);
+          }
+      }
+
+      octave_quit ();
+
+      OCTAVE_LOCAL_BUFFER (T, dtmp, nel);
+      OCTAVE_LOCAL_BUFFER (octave_idx_type, itmp, idx ? nel : 0);
+
+      for (int width = 1; width < nchunks; width *= 2)
+        {
+#         pragma omp parallel for schedule (static) num_threads (nchunks / (2 * width))
+          for (int c = 0; c < nchunks; c += 2 * width)
+            merge_sorted_chunks (data, idx, dtmp, idx ? itmp : nullptr,
+                                 offsets[c], offsets[c + width],
+                                 offsets[std::min (c + 2 * width, nchunks)],
+                                 comp);
+
+          octave_quit ();
+        }
+
+      return;
+    }
+
+#endif
+
+  if (idx)
+    sort (data, idx, nel, comp);
+  else
+    sort (data, nel, comp);
+}
+
+
 template <typename T>
 using compare_fcn_ptr = bool (*) (typename ref_param<T>::type,
                                   typename ref_param<T>::type);
 
+// Counting sort for 8- and 16-bit integer keys.  For these types the
+// key space is small enough that two linear passes (histogram, then
+// regeneration) beat any comparison sort, so the public dispatchers
+// below try it first when sorting with the plain ascending or
+// descending order.  The traits map a value to a bucket index such
+// that bucket order equals ascending value order.
+
+template <typename T, typename Enable = void>
+struct counting_sort_key
+{
+  static const bool enabled = false;
+  static const octave_idx_type range = 1;
+  static octave_idx_type index (const T&) { return 0; }
+  static T value (octave_idx_type) { return T (); }
+};
+
+template <typename T>
+struct counting_sort_key<T, typename std::enable_if<std::is_integral<T>::value
+                                                    && ! std::is_same<T, bool>::value
+                                                    && sizeof (T) <= 2>::type>
+{
+  typedef typename std::make_unsigned<T>::type UT;
+
+  static const bool enabled = true;
+  static const octave_idx_type range
+    = static_cast<octave_idx_type> (1) << (8 * sizeof (T));
+
+  // Flipping the sign bit of signed keys makes unsigned bucket order
+  // equal ascending value order.
+  static const UT bias
+    = std::is_signed<T>::value ? (static_cast<UT> (1) << (8 * sizeof (T) - 1))
+                               : 0;
+
+  static octave_idx_type index (T x)
+  { return static_cast<UT> (static_cast<UT> (x) ^ bias); }
+
+  static T value (octave_idx_type i)
+  { return static_cast<T> (static_cast<UT> (i) ^ bias); }
+};
+
+template <typename W>
+struct counting_sort_key<octave_int<W>,
+                         typename std::enable_if<sizeof (W) <= 2>::type>
+{
+  typedef counting_sort_key<W> base_key;
+
+  static const bool enabled = true;
+  static const octave_idx_type range = base_key::range;
+
+  static octave_idx_type index (const octave_int<W>& x)
+  { return base_key::index (x.value ()); }
+
+  static octave_int<W> value (octave_idx_type i)
+  { return octave_int<W> (base_key::value (i)); }
+};
+
+// Counting sort pays off once the slice is long relative to the key
+// range; below that the histogram passes dominate.
+
+template <typename T>
+inline bool
+counting_sort_applicable (octave_idx_type nel)
+{
+  return (counting_sort_key<T>::enabled
+          && nel >= 1024 && nel >= counting_sort_key<T>::range / 8);
+}
+
+template <typename T>
+static void
+counting_sort (T *data, octave_idx_type nel, bool descending)
+{
+  typedef counting_sort_key<T> key;
+
+  OCTAVE_LOCAL_BUFFER (octave_idx_type, counts, key::range);
+  std::fill_n (counts, key::range, 0);
+
+  for (octave_idx_type i = 0; i < nel; i++)
+    counts[key::index (data[i])]++;
+
+  octave_idx_type k = 0;
+
+  if (descending)
+    {
+      for (octave_idx_type b = key::range - 1; b >= 0; b--)
+        for (octave_idx_type c = counts[b]; c > 0; c--)
+          data[k++] = key::value (b);
+    }
+  else
+    {
+      for (octave_idx_type b = 0; b < key::range; b++)
+        for (octave_idx_type c = counts[b]; c > 0; c--)
+          data[k++] = key::value (b);
+    }
+}
+
+// Index-output variant: a stable scatter pass permutes the index
+// vector the same way a stable comparison sort would.
+
+template <typename T>
+static void
+counting_sort (T *data, octave_idx_type *idx, octave_idx_type nel,
+               bool descending)
+{
+  typedef counting_sort_key<T> key;
+
+  OCTAVE_LOCAL_BUFFER (octave_idx_type, pos, key::range);
+  std::fill_n (pos, key::range, 0);
+
+  for (octave_idx_type i = 0; i < nel; i++)
+    pos[key::index (data[i])]++;
+
+  // Turn counts into bucket start offsets in output order.
+  octave_idx_type sum = 0;
+
+  if (descending)
+    {
+      for (octave_idx_type b = key::range - 1; b >= 0; b--)
+        {
+          octave_idx_type c = pos[b];
+          pos[b] = sum;
+          sum += c;
+        }
+    }
+  else
+    {
+      for (octave_idx_type b = 0; b < key::range; b++)
+        {
+          octave_idx_type c = pos[b];
+          pos[b] = sum;
+          sum += c;
+        }
+    }
+
+  OCTAVE_LOCAL_BUFFER (octave_idx_type, tmp_idx, nel);
+
+  for (octave_idx_type i = 0; i < nel; i++)
+    tmp_idx[pos[key::index (data[i])]++] = idx[i];
+
+  std::copy_n (tmp_idx, nel, idx);
+
+  // Regenerate the data from the (now past-the-end) bucket offsets:
+  // after the scatter, pos[b] is the end of bucket b's output region.
+
+  if (descending)
+    {
+      // Buckets were laid out from high to low, so bucket b starts
+      // where bucket b+1 ends.
+      for (octave_idx_type b = 0; b < key::range; b++)
+        {
+          octave_idx_type lo = (b + 1 < key::range) ? pos[b+1] : 0;
+          for (octave_idx_type k = lo; k < pos[b]; k++)
+            data[k] = key::value (b);
+        }
+    }
+  else
+    {
+      for (octave_idx_type b = 0; b < key::range; b++)
+        {
+          octave_idx_type lo = (b > 0) ? pos[b-1] : 0;
+          for (octave_idx_type k = lo; k < pos[b]; k++)
+            data[k] = key::value (b);
+        }
+    }
+}
+
 template <typename T>
 void
 octave_sort<T>::sort (T *data, octave_idx_type nel)
 {
 #if defined (INLINE_ASCENDING_SORT)
   if (*m_compare.template target<compare_fcn_ptr<T>> () == ascending_compare)
-    sort (data, nel, std::less<T> ());
+    {
+      if (counting_sort_applicable<T> (nel))
+        counting_sort (data, nel, false);
+      else
+        parallel_sort (data, nel, std::less<T> ());
+    }
   else
 #endif
 #if defined (INLINE_DESCENDING_SORT)
     if (*m_compare.template target<compare_fcn_ptr<T>> () == descending_compare)
-      sort (data, nel, std::greater<T> ());
+      {
+        if (counting_sort_applicable<T> (nel))
+          counting_sort (data, nel, true);
+        else
+          parallel_sort (data, nel, std::greater<T> ());
+      }
     else
 #endif
       if (m_compare)
-        sort (data, nel, m_compare);
+        parallel_sort (data, nel, m_compare);
 }
 
 template <typename T>
@@ -1539,16 +1868,26 @@ octave_sort<T>::sort (T *data, octave_idx_type *idx, octave_idx_type nel)
 {
 #if defined (INLINE_ASCENDING_SORT)
   if (*m_compare.template target<compare_fcn_ptr<T>> () == ascending_compare)
-    sort (data, idx, nel, std::less<T> ());
+    {
+      if (counting_sort_applicable<T> (nel))
+        counting_sort (data, idx, nel, false);
+      else
+        parallel_sort (data, idx, nel, std::less<T> ());
+    }
   else
 #endif
 #if defined (INLINE_DESCENDING_SORT)
     if (*m_compare.template target<compare_fcn_ptr<T>> () == descending_compare)
-      sort (data, idx, nel, std::greater<T> ());
+      {
+        if (counting_sort_applicable<T> (nel))
+          counting_sort (data, idx, nel, true);
+        else
+          parallel_sort (data, idx, nel, std::greater<T> ());
+      }
     else
 #endif
       if (m_compare)
-        sort (data, idx, nel, m_compare);
+        parallel_sort (data, idx, nel, m_compare);
 }
 
 template <typename T>
@@ -1759,6 +2098,61 @@ octave_sort<T>::is_sorted_rows (const T *data, octave_idx_type rows,
   return retval;
 }
 
+// Interpolation guide for multi-query lookups.  For floating-point
+// tables the first probe of each binary search is predicted from a
+// linear model of the table; on uniform grids (the common interp1 and
+// histc case) this finds the answer in O(1) probes per query instead
+// of O(log N).  The guess is only a starting point -- guided_lookup
+// verifies it with comparisons, so a non-uniform table merely falls
+// back to the usual logarithmic cost.
+
+template <typename T, bool = std::is_floating_point<T>::value>
+class lookup_interp_guide
+{
+public:
+  lookup_interp_guide (const T *, octave_idx_type) { }
+  bool valid () const { return false; }
+  octave_idx_type guess (const T&) const { return 0; }
+};
+
+template <typename T>
+class lookup_interp_guide<T, true>
+{
+public:
+  lookup_interp_guide (const T *data, octave_idx_type nel)
+    : m_origin (0), m_scale (0), m_max (nel - 1)
+  {
+    if (nel > 1)
+      {
+        m_origin = data[0];
+
+        double scale = m_max / (static_cast<double> (data[nel-1]) - m_origin);
+
+        // Degenerate, infinite or NaN endpoints disable the guide.
+        if (octave::math::isfinite (scale) && scale != 0)
+          m_scale = scale;
+      }
+  }
+
+  bool valid () const { return m_scale != 0; }
+
+  octave_idx_type guess (const T& value) const
+  {
+    double g = (static_cast<double> (value) - m_origin) * m_scale;
+
+    // NaN queries fail the first test and start from the table origin.
+    if (! (g > 0))
+      return 0;
+
+    return (g < m_max ? static_cast<octave_idx_type> (g) : m_max);
+  }
+
+private:
+  double m_origin;
+  double m_scale;   // (nel-1) / span; negative for descending tables.
+  octave_idx_type m_max;
+};
+
 // The simple binary lookup.
 
 template <typename T>
@@ -1804,6 +2198,68 @@ octave_sort<T>::lookup (const T *data, octave_idx_type nel,
   return retval;
 }
 
+// Binary lookup that starts from a predicted position: gallop away
+// from GUESS until the answer is bracketed, then bisect the bracket.
+// Equivalent to the plain binary lookup for any sorted table, but
+// costs only O(log (distance from GUESS)) comparisons, which is O(1)
+// when the guess comes from interpolating a uniform grid.
+
+template <typename T>
+template <typename Comp>
+octave_idx_type
+octave_sort<T>::guided_lookup (const T *data, octave_idx_type nel,
+                               const T& value, octave_idx_type guess,
+                               Comp comp)
+{
+  octave_idx_type lo, hi;
+
+  if (comp (value, data[guess]))
+    {
+      // The answer is at or below GUESS.
+      lo = 0;
+      hi = guess;
+
+      for (octave_idx_type ofs = 1; guess - ofs >= 0; ofs <<= 1)
+        {
+          if (comp (value, data[guess - ofs]))
+            hi = guess - ofs;
+          else
+            {
+              lo = guess - ofs + 1;
+              break;
+            }
+        }
+    }
+  else
+    {
+      // The answer is above GUESS.
+      lo = guess + 1;
+      hi = nel;
+
+      for (octave_idx_type ofs = 1; guess + ofs < nel; ofs <<= 1)
+        {
+          if (comp (value, data[guess + ofs]))
+            {
+              hi = guess + ofs;
+              break;
+            }
+          else
+            lo = guess + ofs + 1;
+        }
+    }
+
+  while (lo < hi)
+    {
+      octave_idx_type mid = lo + ((hi-lo) >> 1);
+      if (comp (value, data[mid]))
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+  return lo;
+}
+
 template <typename T>
 template <typename Comp>
 void
@@ -1811,11 +2267,29 @@ octave_sort<T>::lookup (const T *data, octave_idx_type nel,
                         const T *values, octave_idx_type nvalues,
                         octave_idx_type *idx, Comp comp)
 {
-  // Use a sequence of binary lookups.
-  // FIXME: Can this be sped up generally?  The sorted merge case is dealt with
-  // elsewhere.
-  for (octave_idx_type j = 0; j < nvalues; j++)
-    idx[j] = lookup (data, nel, values[j], comp);
+  // Use a sequence of binary lookups, interpolation-guided when the
+  // table looks like a numeric grid.  The sorted merge case is dealt
+  // with elsewhere.  Queries are independent and the comparators are
+  // pure functions of the element values, so large batches are split
+  // across threads.
+
+  lookup_interp_guide<T> guide (data, nel);
+
+  if (guide.valid ())
+    octave::chunked_parallel_for
+      (nvalues, [&] (octave_idx_type beg, octave_idx_type len)
+       {
+         for (octave_idx_type j = beg; j < beg + len; j++)
+           idx[j] = guided_lookup (data, nel, values[j],
+                                   guide.guess (values[j]), comp);
+       });
+  else
+    octave::chunked_parallel_for
+      (nvalues, [&] (octave_idx_type beg, octave_idx_type len)
+       {
+         for (octave_idx_type j = beg; j < beg + len; j++)
+           idx[j] = lookup (data, nel, values[j], comp);
+       });
 }
 
 template <typename T>
@@ -1845,52 +2319,67 @@ octave_sort<T>::lookup_sorted (const T *data, octave_idx_type nel,
                                const T *values, octave_idx_type nvalues,
                                octave_idx_type *idx, bool rev, Comp comp)
 {
-  if (rev)
-    {
-      octave_idx_type i = 0;
-      octave_idx_type j = nvalues - 1;
-
-      if (nvalues > 0 && nel > 0)
-        {
-          while (true)
-            {
-              if (comp (values[j], data[i]))
-                {
-                  idx[j] = i;
-                  if (--j < 0)
-                    break;
-                }
-              else if (++i == nel)
-                break;
-            }
-        }
-
-      for (; j >= 0; j--)
-        idx[j] = i;
-    }
-  else
-    {
-      octave_idx_type i = 0;
-      octave_idx_type j = 0;
-
-      if (nvalues > 0 && nel > 0)
-        {
-          while (true)
-            {
-              if (comp (values[j], data[i]))
-                {
-                  idx[j] = i;
-                  if (++j == nvalues)
-                    break;
-                }
-              else if (++i == nel)
-                break;
-            }
-        }
-
-      for (; j != nvalues; j++)
-        idx[j] = i;
-    }
+  // Each block of queries is independent once its merge position has
+  // been re-anchored with a binary lookup of its smallest element, so
+  // large batches are split across threads, each thread walking the
+  // table sequentially over its own block.
+
+  octave::chunked_parallel_for
+    (nvalues, [&] (octave_idx_type beg, octave_idx_type len)
+     {
+       const T *vals = values + beg;
+       octave_idx_type *bidx = idx + beg;
+
+       octave_idx_type i = 0;
+
+       if (beg > 0 && len > 0 && nel > 0)
+         i = lookup (data, nel, vals[rev ? len-1 : 0], comp);
+
+       if (rev)
+         {
+           octave_idx_type j = len - 1;
+
+           if (len > 0 && i < nel)
+             {
+               while (true)
+                 {
+                   if (comp (vals[j], data[i]))
+                     {
+                       bidx[j] = i;
+                       if (--j < 0)
+                         break;
+                     }
+                   else if (++i == nel)
+                     break;
+                 }
+             }
+
+           for (; j >= 0; j--)
+             bidx[j] = i;
+         }
+       else
+         {
+           octave_idx_type j = 0;
+
+           if (len > 0 && i < nel)
+             {
+               while (true)
+                 {
+                   if (comp (vals[j], data[i]))
+                     {
+                       bidx[j] = i;
+                       if (++j == len)
+                         break;
+                     }
+                   else if (++i == nel)
+                     break;
+                 }
+             }
+
+           for (; j != len; j++)
+             bidx[j] = i;
+         }
+     });
 }
 
 template <typename T>
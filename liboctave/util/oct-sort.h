@@ -306,6 +306,17 @@ private:
   template <typename Comp>
   void sort (T *data, octave_idx_type *idx, octave_idx_type nel, Comp comp);
 
+  // Stable threshold-gated parallel merge sort: the array is split
+  // into contiguous chunks that are timsorted concurrently and then
+  // merged pairwise.  Only used when built with OpenMP.
+
+  template <typename Comp>
+  void parallel_sort (T *data, octave_idx_type nel, Comp comp);
+
+  template <typename Comp>
+  void parallel_sort (T *data, octave_idx_type *idx, octave_idx_type nel,
+                      Comp comp);
+
   template <typename Comp>
   bool issorted (const T *data, octave_idx_type nel, Comp comp);
 
@@ -322,6 +333,11 @@ private:
   octave_idx_type lookup (const T *data, octave_idx_type nel,
                           const T& value, Comp comp);
 
+  template <typename Comp>
+  octave_idx_type guided_lookup (const T *data, octave_idx_type nel,
+                                 const T& value, octave_idx_type guess,
+                                 Comp comp);
+
   template <typename Comp>
   void lookup (const T *data, octave_idx_type nel,
                const T *values, octave_idx_type nvalues,
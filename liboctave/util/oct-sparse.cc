@@ -29,6 +29,7 @@
 
 #include "lo-error.h"
 #include "oct-sparse.h"
+#include "oct-spparms.h"
 
 #if (defined (HAVE_AMD) || defined (HAVE_CCOLAMD)               \
      || defined (HAVE_CHOLMOD) || defined (HAVE_COLAMD)         \
@@ -79,6 +80,47 @@ to_octave_idx_type_ptr (const suitesparse_integer *i)
   return reinterpret_cast<const octave_idx_type *> (i);
 }
 
+#if defined (HAVE_CHOLMOD)
+
+void
+maybe_set_nd_ordering (cholmod_common *cm)
+{
+  if (sparse_params::get_key ("nd_order") == 0.)
+    return;
+
+#if defined (CHOLMOD_NESDIS)
+  // Try nested dissection first; cholmod_analyze silently skips
+  // orderings that are not compiled in (NESDIS requires METIS), so AMD
+  // remains as a fallback.
+  cm->nmethods = 2;
+  cm->method[0].ordering = CHOLMOD_NESDIS;
+  cm->method[1].ordering = CHOLMOD_AMD;
+#else
+  octave_unused_parameter (cm);
+#endif
+}
+
+#endif
+
+#if defined (HAVE_UMFPACK)
+
+void
+maybe_set_nd_ordering (double *control)
+{
+  if (sparse_params::get_key ("nd_order") == 0.)
+    return;
+
+#if defined (UMFPACK_ORDERING) && defined (UMFPACK_ORDERING_METIS)
+  // UMFPACK falls back to its default ordering internally if it was
+  // built without METIS support.
+  control[UMFPACK_ORDERING] = UMFPACK_ORDERING_METIS;
+#else
+  octave_unused_parameter (control);
+#endif
+}
+
+#endif
+
 OCTAVE_END_NAMESPACE(octave)
 
 #endif
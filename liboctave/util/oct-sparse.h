@@ -196,6 +196,27 @@ to_octave_idx_type_ptr (suitesparse_integer *i);
 extern const OCTAVE_API octave_idx_type *
 to_octave_idx_type_ptr (const suitesparse_integer *i);
 
+#  if defined (HAVE_CHOLMOD)
+
+// Apply the fill-reducing ordering selected by the "nd_order" sparse
+// parameter to a CHOLMOD common object: when the flag is nonzero,
+// prefer nested dissection (NESDIS) over the default AMD scheme.
+
+extern OCTAVE_API void
+maybe_set_nd_ordering (cholmod_common *cm);
+
+#  endif
+
+#  if defined (HAVE_UMFPACK)
+
+// Likewise for a UMFPACK control array: when "nd_order" is nonzero,
+// request the METIS column pre-ordering instead of AMD/COLAMD.
+
+extern OCTAVE_API void
+maybe_set_nd_ordering (double *control);
+
+#  endif
+
 inline octave_idx_type
 from_suitesparse_long (SuiteSparse_long x)
 {
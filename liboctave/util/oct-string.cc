@@ -47,10 +47,9 @@ static bool
 str_data_cmp (const typename T::value_type *a, const typename T::value_type *b,
               const typename T::size_type n)
 {
-  for (typename T::size_type i = 0; i < n; ++i)
-    if (a[i] != b[i])
-      return false;
-  return true;
+  // All instantiations use single-byte character types, so equality can
+  // be tested with memcmp, which C libraries typically vectorize.
+  return std::memcmp (a, b, n * sizeof (typename T::value_type)) == 0;
 }
 
 template <typename T>
@@ -59,8 +58,15 @@ str_data_cmpi (const typename T::value_type *a, const typename T::value_type *b,
                const typename T::size_type n)
 {
   for (typename T::size_type i = 0; i < n; ++i)
-    if (std::tolower (a[i]) != std::tolower (b[i]))
-      return false;
+    {
+      // Equal bytes compare equal in any case, so only fold case for
+      // the ones that differ.  The casts avoid passing negative values
+      // to tolower, which is undefined behavior.
+      if (a[i] != b[i]
+          && (std::tolower (static_cast<unsigned char> (a[i]))
+              != std::tolower (static_cast<unsigned char> (b[i]))))
+        return false;
+    }
   return true;
 }
 
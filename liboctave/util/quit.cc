@@ -47,16 +47,17 @@ OCTAVE_BEGIN_NAMESPACE(octave)
 
 std::string execution_exception::stack_trace () const
 {
-  std::size_t nframes = m_stack_info.size ();
+  // Materializes a deferred stack capture.
+  stack_info_type frames = stack_info ();
 
-  if (nframes == 0)
+  if (frames.empty ())
     return std::string ();
 
   std::ostringstream buf;
 
   buf << "error: called from\n";
 
-  for (const auto& frm : m_stack_info)
+  for (const auto& frm : frames)
     {
       buf << "    " << frm.fcn_name ();
 
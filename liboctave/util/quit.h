@@ -32,6 +32,7 @@
 #if defined (__cplusplus)
 #  include <atomic>
 #  include <csignal>
+#  include <functional>
 #  include <iosfwd>
 #  include <list>
 #  include <stdexcept>
@@ -96,12 +97,14 @@ public:
 
   typedef std::list<frame_info> stack_info_type;
 
+  typedef std::function<stack_info_type (void)> stack_info_provider;
+
   execution_exception (const std::string& err_type = "error",
                        const std::string& id = "",
                        const std::string& message = "unspecified error",
                        const stack_info_type& stack_info = stack_info_type ())
     : runtime_error (message), m_err_type (err_type), m_id (id),
-      m_message (message), m_stack_info (stack_info)
+      m_message (message), m_stack_info (stack_info), m_stack_provider ()
   { }
 
   execution_exception (const execution_exception&) = default;
@@ -138,12 +141,29 @@ public:
 
   virtual stack_info_type stack_info (void) const
   {
+    if (m_stack_provider)
+      {
+        m_stack_info = m_stack_provider ();
+        m_stack_provider = nullptr;
+      }
+
     return m_stack_info;
   }
 
   void set_stack_info (const stack_info_type& stack_info)
   {
     m_stack_info = stack_info;
+    m_stack_provider = nullptr;
+  }
+
+  // Defer capturing the stack until someone asks for it.  The
+  // provider is invoked at most once, on the first call to
+  // stack_info; exceptions that are thrown and swallowed without
+  // inspection never pay for building the frame list.
+
+  void set_stack_info_provider (const stack_info_provider& provider)
+  {
+    m_stack_provider = provider;
   }
 
   virtual void display (std::ostream& os) const;
@@ -156,7 +176,11 @@ private:
 
   std::string m_message;
 
-  stack_info_type m_stack_info;
+  // Both mutable so a deferred stack capture can be materialized on
+  // first access from the const accessor.
+  mutable stack_info_type m_stack_info;
+
+  mutable stack_info_provider m_stack_provider;
 };
 
 class OCTAVE_EXCEPTION_API exit_exception : public std::exception
@@ -235,10 +259,20 @@ extern OCTAVE_API void octave_handle_signal (void);
 
 inline void octave_quit (void)
 {
-  bool expected = true;
+  /* Fast path: a single relaxed load of the flag.  The locked
+     compare-exchange that claims the signal runs only after a signal
+     has actually arrived, so sprinkling this check through tight
+     loops costs one predictable-not-taken branch per call.  Relaxed
+     ordering is enough because the flag carries no payload; the
+     handler state is examined under the compare-exchange.  */
+
+  if (octave_signal_caught.load (std::memory_order_relaxed))
+    {
+      bool expected = true;
 
-  if (octave_signal_caught.compare_exchange_strong (expected, false))
-    octave_handle_signal ();
+      if (octave_signal_caught.compare_exchange_strong (expected, false))
+        octave_handle_signal ();
+    }
 }
 
 #define OCTAVE_QUIT octave_quit ()
@@ -250,6 +284,32 @@ extern OCTAVE_API void octave_quit_c (void);
 
 #endif
 
+/* For authors of .oct files and other compiled loops: call
+   OCTAVE_QUIT (or octave_quit in C++) once per iteration so Ctrl-C
+   stays responsive.  The per-call cost is one relaxed atomic load.
+   If even that is visible in a profile, batch the check with a local
+   counter; COUNTER must be an lvalue of integer type and the
+   interrupt is then seen within INTERVAL iterations:
+
+     octave_idx_type chk = 0;
+     for (octave_idx_type i = 0; i < n; i++)
+       {
+         OCTAVE_QUIT_BATCHED (chk, 4096);
+         ...
+       }
+*/
+
+#define OCTAVE_QUIT_BATCHED(counter, interval)  \
+  do                                            \
+    {                                           \
+      if (++(counter) >= (interval))            \
+        {                                       \
+          (counter) = 0;                        \
+          OCTAVE_QUIT;                          \
+        }                                       \
+    }                                           \
+  while (0)
+
 /* The following macros are obsolete.  Interrupting immediately by
    calling siglongjmp or similar from a signal handler is asking for
    trouble.  Rather than remove them, however, please leave them in
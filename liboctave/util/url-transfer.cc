@@ -30,6 +30,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 
 #include "dir-ops.h"
 #include "file-ops.h"
@@ -906,6 +907,156 @@ private:
 
 #undef SETOPT
 
+// Batched concurrent GET over a process-lifetime multi handle.  The
+// multi handle owns libcurl's connection cache, so keeping a single
+// one alive means a batch can reuse connections opened by any earlier
+// batch; the easy handles themselves are per-transfer.
+
+std::vector<url_multi_result>
+url_multi_get (const std::vector<std::string>& urls, int max_connections)
+{
+  std::vector<url_multi_result> results (urls.size ());
+
+  struct multi_handle
+  {
+    multi_handle () : m (curl_multi_init ()) { }
+    ~multi_handle () { if (m) curl_multi_cleanup (m); }
+    CURLM *m;
+  };
+
+  static multi_handle curlm;
+
+  if (! curlm.m)
+    {
+      for (auto& result : results)
+        result.errmsg = "can not create curl multi object";
+      return results;
+    }
+
+  if (max_connections < 1)
+    max_connections = 1;
+
+  curl_multi_setopt (curlm.m, CURLMOPT_MAX_TOTAL_CONNECTIONS,
+                     static_cast<long> (max_connections));
+
+  curl_version_info_data *data = curl_version_info (CURLVERSION_NOW);
+  std::string user_agent
+    ("GNU Octave/"
+     + std::string (OCTAVE_VERSION)
+     + " (https://www.gnu.org/software/octave/ ; help@octave.org) libcurl/"
+     + std::string (data->version));
+
+  std::string cainfo = sys::env::getenv ("CURLOPT_CAINFO");
+  std::string capath = sys::env::getenv ("CURLOPT_CAPATH");
+
+  std::vector<std::ostringstream> sinks (urls.size ());
+  std::vector<CURL *> handles (urls.size (), nullptr);
+
+  for (std::size_t i = 0; i < urls.size (); i++)
+    {
+      CURL *h = curl_easy_init ();
+
+      if (! h)
+        {
+          results[i].errmsg = "can not create curl object";
+          continue;
+        }
+
+      curl_easy_setopt (h, CURLOPT_URL, urls[i].c_str ());
+      curl_easy_setopt (h, CURLOPT_WRITEFUNCTION, write_data);
+      curl_easy_setopt (h, CURLOPT_WRITEDATA,
+                        static_cast<void *> (&sinks[i]));
+      curl_easy_setopt (h, CURLOPT_FOLLOWLOCATION, 1L);
+      curl_easy_setopt (h, CURLOPT_FAILONERROR, 1L);
+      curl_easy_setopt (h, CURLOPT_NOPROGRESS, 1L);
+      curl_easy_setopt (h, CURLOPT_USERAGENT, user_agent.c_str ());
+
+      if (! cainfo.empty ())
+        curl_easy_setopt (h, CURLOPT_CAINFO, cainfo.c_str ());
+      if (! capath.empty ())
+        curl_easy_setopt (h, CURLOPT_CAPATH, capath.c_str ());
+
+      // Smuggle the result index through the private pointer.
+      curl_easy_setopt (h, CURLOPT_PRIVATE,
+                        reinterpret_cast<char *> (i));
+
+      handles[i] = h;
+
+      curl_multi_add_handle (curlm.m, h);
+    }
+
+  int still_running = 0;
+
+  do
+    {
+      CURLMcode mc = curl_multi_perform (curlm.m, &still_running);
+
+      if (mc == CURLM_OK && still_running)
+        mc = curl_multi_wait (curlm.m, nullptr, 0, 1000, nullptr);
+
+      if (mc != CURLM_OK)
+        break;
+
+      CURLMsg *msg;
+      int msgs_left;
+
+      while ((msg = curl_multi_info_read (curlm.m, &msgs_left)))
+        {
+          if (msg->msg != CURLMSG_DONE)
+            continue;
+
+          CURL *h = msg->easy_handle;
+
+          char *priv = nullptr;
+          curl_easy_getinfo (h, CURLINFO_PRIVATE, &priv);
+          std::size_t idx = reinterpret_cast<std::size_t> (priv);
+
+          if (msg->data.result == CURLE_OK)
+            results[idx].ok = true;
+          else
+            results[idx].errmsg = curl_easy_strerror (msg->data.result);
+
+          curl_multi_remove_handle (curlm.m, h);
+          curl_easy_cleanup (h);
+          handles[idx] = nullptr;
+        }
+    }
+  while (still_running > 0);
+
+  // Anything left over hit a multi-level failure.
+  for (std::size_t i = 0; i < handles.size (); i++)
+    {
+      if (handles[i])
+        {
+          if (results[i].errmsg.empty ())
+            results[i].errmsg = "transfer failed";
+
+          curl_multi_remove_handle (curlm.m, handles[i]);
+          curl_easy_cleanup (handles[i]);
+        }
+    }
+
+  for (std::size_t i = 0; i < results.size (); i++)
+    if (results[i].ok)
+      results[i].body = sinks[i].str ();
+
+  return results;
+}
+
+#else
+
+std::vector<url_multi_result>
+url_multi_get (const std::vector<std::string>& urls, int)
+{
+  std::vector<url_multi_result> results (urls.size ());
+
+  for (auto& result : results)
+    result.errmsg
+      = "support for URL transfers was disabled when Octave was built";
+
+  return results;
+}
+
 #endif
 
 #if defined (HAVE_CURL)
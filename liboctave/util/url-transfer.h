@@ -32,6 +32,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "Array-fwd.h"
 #include "str-vec.h"
@@ -291,6 +292,26 @@ private:
   std::shared_ptr<base_url_transfer> m_rep;
 };
 
+// One result of a batched url_multi_get transfer.
+
+struct url_multi_result
+{
+  bool ok = false;
+  std::string body;
+  std::string errmsg;
+};
+
+// Fetch all of URLS concurrently with HTTP GET over a shared
+// curl_multi handle and return the bodies in order.  The multi handle
+// (and therefore its connection cache) persists for the process, so
+// repeated batches against the same hosts reuse connections instead
+// of paying a fresh round trip each.  MAX_CONNECTIONS caps the number
+// of simultaneous transfers.
+
+OCTAVE_API std::vector<url_multi_result>
+url_multi_get (const std::vector<std::string>& urls,
+               int max_connections = 8);
+
 OCTAVE_END_NAMESPACE(octave)
 
 #endif
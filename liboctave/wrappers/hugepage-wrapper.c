@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2023 The Octave Project Developers
+//
+// See the file COPYRIGHT.md in the top-level directory of this
+// distribution or <https://octave.org/copyright/>.
+//
+// This file is part of Octave.
+//
+// Octave is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Octave is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Octave; see the file COPYING.  If not, see
+// <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////
+
+#if defined (HAVE_CONFIG_H)
+#  include "config.h"
+#endif
+
+#if defined (__linux__)
+#  include <stdint.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+#include "hugepage-wrapper.h"
+
+int
+octave_advise_hugepages_wrapper (void *ptr, size_t nbytes)
+{
+#if defined (__linux__) && defined (MADV_HUGEPAGE)
+
+  // madvise requires a page-aligned address, but the buffer comes from
+  // the general-purpose allocator, so round inward to the aligned
+  // subrange it covers.
+
+  long pagesize = sysconf (_SC_PAGESIZE);
+
+  if (pagesize <= 0)
+    return 0;
+
+  uintptr_t mask = (uintptr_t) pagesize - 1;
+  uintptr_t beg = ((uintptr_t) ptr + mask) & ~mask;
+  uintptr_t end = ((uintptr_t) ptr + nbytes) & ~mask;
+
+  if (end > beg && madvise ((void *) beg, end - beg, MADV_HUGEPAGE) == 0)
+    return 1;
+
+  return 0;
+
+#else
+
+  (void) ptr;
+  (void) nbytes;
+
+  return 0;
+
+#endif
+}
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////
 //
-// Copyright (C) 2016-2023 The Octave Project Developers
+// Copyright (C) 2023 The Octave Project Developers
 //
 // See the file COPYRIGHT.md in the top-level directory of this
 // distribution or <https://octave.org/copyright/>.
@@ -23,13 +23,12 @@
 //
 ////////////////////////////////////////////////////////////////////////
 
-#if ! defined (octave_base64_wrappers_h)
-#define octave_base64_wrappers_h 1
+#if ! defined (octave_hugepage_wrapper_h)
+#define octave_hugepage_wrapper_h 1
 
-#if defined (__cplusplus)
+#if defined __cplusplus
 #  include <cstddef>
 #else
-#  include <stdbool.h>
 #  include <stddef.h>
 #endif
 
@@ -37,12 +36,12 @@
 extern "C" {
 #endif
 
-extern OCTAVE_API ptrdiff_t
-octave_base64_encode_alloc_wrapper (const char *in, ptrdiff_t inlen, char **out);
+// Advise the kernel to back the pages covering [PTR, PTR+NBYTES) with
+// transparent huge pages where possible.  Return 1 if the advice was
+// given, 0 when the platform has no such facility or the call failed.
 
-extern OCTAVE_API bool
-octave_base64_decode_alloc_wrapper (const char *in, ptrdiff_t inlen,
-                                    char **out, ptrdiff_t *outlen);
+extern OCTAVE_API int
+octave_advise_hugepages_wrapper (void *ptr, size_t nbytes);
 
 #if defined __cplusplus
 }
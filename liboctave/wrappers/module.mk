@@ -1,7 +1,6 @@
 NOINSTALL_WRAPPERS_INC = \
   %reldir%/areadlink-wrapper.h \
   %reldir%/async-system-wrapper.h \
-  %reldir%/base64-wrappers.h \
   %reldir%/canonicalize-file-name-wrapper.h \
   %reldir%/dirent-wrappers.h \
   %reldir%/fcntl-wrappers.h \
@@ -11,6 +10,7 @@ NOINSTALL_WRAPPERS_INC = \
   %reldir%/getopt-wrapper.h \
   %reldir%/glob-wrappers.h \
   %reldir%/hash-wrappers.h \
+  %reldir%/hugepage-wrapper.h \
   %reldir%/iconv-wrappers.h \
   %reldir%/intprops-wrappers.h \
   %reldir%/localcharset-wrapper.h \
@@ -44,7 +44,6 @@ NOINSTALL_WRAPPERS_INC = \
 WRAPPERS_SRC = \
   %reldir%/areadlink-wrapper.c \
   %reldir%/async-system-wrapper.c \
-  %reldir%/base64-wrappers.c \
   %reldir%/canonicalize-file-name-wrapper.c \
   %reldir%/cxx-signal-helpers.cc \
   %reldir%/dirent-wrappers.c \
@@ -55,6 +54,7 @@ WRAPPERS_SRC = \
   %reldir%/getopt-wrapper.c \
   %reldir%/glob-wrappers.c \
   %reldir%/hash-wrappers.c \
+  %reldir%/hugepage-wrapper.c \
   %reldir%/iconv-wrappers.c \
   %reldir%/intprops-wrappers.c \
   %reldir%/localcharset-wrapper.c \
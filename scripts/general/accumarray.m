@@ -126,8 +126,9 @@
 ## The complexity of accumarray in general for the non-sparse case is
 ## generally O(M+N), where N is the number of subscripts and M is the
 ## maximum subscript (linearized in multi-dimensional case).  If
-## @var{fcn} is one of @code{@@sum} (default), @code{@@max},
-## @code{@@min} or @code{@@(x) @{x@}}, an optimized code path is used.
+## @var{fcn} is one of @code{@@sum} (default), @code{@@mean},
+## @code{@@max}, @code{@@min} or @code{@@(x) @{x@}}, an optimized code
+## path is used.
 ## Note that for general reduction function the interpreter overhead can
 ## play a major part and it may be more efficient to do multiple
 ## accumarray calls and compute the results in a vectorized manner.
@@ -283,6 +284,27 @@ function A = accumarray (subs, vals, sz = [], fcn = [], fillval = [], issparse =
         mask(subs) = false;
         A(mask) = fillval;
       endif
+    elseif (fcn == @mean)
+      ## Fast mean: group sums divided by group counts.
+      if (isempty (sz))
+        A = __accumarray_sum__ (subs, vals);
+        counts = __accumarray_sum__ (subs, 1, numel (A));
+      else
+        A = __accumarray_sum__ (subs, vals, prod (sz));
+        counts = __accumarray_sum__ (subs, 1, prod (sz));
+      endif
+
+      empty = (counts == 0);
+      counts(empty) = 1;  # avoid 0/0 for positions that get FILLVAL
+      A ./= counts;
+
+      if (fillval != 0)
+        A(empty) = fillval;
+      endif
+
+      if (! isempty (sz))
+        A = reshape (A, sz);
+      endif
     elseif (fcn == @max)
       ## Fast maximization.
 
@@ -399,6 +421,12 @@ endfunction
 %!assert (accumarray ({[1 3 3 2 3 1 2 2 3 3 1 2], [3 4 2 1 4 3 4 2 2 4 3 4], [1 1 2 2 1 1 2 1 1 1 2 2]}, 101:112),
 %!        cat (3, [0 0 207 0; 0 108 0 0; 0 109 0 317], [0 0 111 0; 104 0 0 219; 0 103 0 0]))
 
+%!assert (accumarray ([1; 2; 1; 2; 1], 1:5, [], @mean), [3; 3])
+%!assert (accumarray ([1; 3; 1], [2; 4; 6], [4, 1], @mean, 7), [4; 7; 4; 7])
+%!assert (accumarray ([1; 1; 2], single ([1; 2; 3]), [], @mean),
+%!        single ([1.5; 3]))
+%!assert (accumarray ([1 1; 2 1; 2 3; 2 1; 2 3], 101:105, [2 4], @mean, NaN),
+%!        [101 NaN NaN NaN; 103 NaN 104 NaN])
 %!assert (accumarray ([1 1; 2 1; 2 3; 2 1; 2 3], 101:105, [2 4], @max, NaN),
 %!        [101 NaN NaN NaN; 104 NaN 105 NaN])
 
@@ -464,3 +492,22 @@ endfunction
 
 %!error <FCN must be a function handle>
 %! accumarray ([1; 2; 3], [1; 2; 3], [3 1], '@(x) {x}')
+
+## Test a large input, which exercises the parallel scatter-reduce kernels
+%!test
+%! n = 1e5;
+%! subs = mod ((1:n)', 97) + 1;
+%! vals = sin (1:n)';
+%! a = accumarray (subs, vals);
+%! amax = accumarray (subs, vals, [], @max);
+%! amin = accumarray (subs, vals, [], @min);
+%! b = bmax = bmin = zeros (97, 1);
+%! for i = 1:97
+%!   v = vals(subs == i);
+%!   b(i) = sum (v);
+%!   bmax(i) = max (v);
+%!   bmin(i) = min (v);
+%! endfor
+%! assert (a, b, 1e-10);
+%! assert (amax, bmax);
+%! assert (amin, bmin);
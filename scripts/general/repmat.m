@@ -108,6 +108,10 @@ function B = repmat (A, m, varargin)
     ## optimize the scalar fill case.
     if (any (idx == 0))
       B = resize (A, idx);
+    elseif (isa (A, "double") && isreal (A) && ! issparse (A))
+      ## produces a symbolic constant array that is only expanded when
+      ## some operation needs the elements.
+      B = A + zeros (idx);
     else
       B(1:prod (idx)) = A;
       B = reshape (B, idx);
@@ -206,6 +210,8 @@ endfunction
 %!assert (size (repmat (1, [0, 1])), [0, 1])
 %!assert (size (repmat (1, [0, 5])), [0, 5])
 
+%!assert (typeinfo (repmat (7, 3, 3)), "constant matrix")
+%!assert (repmat (pi, 2, 3), pi * ones (2, 3))
 %!assert (size (repmat (ones (0, 3), [2 3])), [0 9])
 %!assert (size (repmat (ones (0, 0, 3), [2 3])), [0 0 3])
 
@@ -976,7 +976,6 @@ function rlist = missing_functions ()
   "makehgtform",
   "mapreduce",
   "mapreducer",
-  "matfile",
   "maxflow",
   "MaximizeCommandWindow",
   "maxk",
@@ -1223,7 +1222,6 @@ function rlist = missing_functions ()
   "throw",
   "throwAsCaller",
   "Tiff",
-  "timeit",
   "timeofday",
   "timer",
   "timerange",
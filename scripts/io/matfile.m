@@ -0,0 +1,167 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+classdef matfile
+
+  ## -*- texinfo -*-
+  ## @deftypefn {} {@var{m} =} matfile (@var{filename})
+  ## Open the data file @var{filename} for variable-at-a-time access.
+  ##
+  ## The returned object reads a variable from the file only when that
+  ## variable is referenced, so inspecting part of a large file does not
+  ## load all of it into memory:
+  ##
+  ## @example
+  ## @group
+  ## m = matfile ("results.mat");
+  ## x = m.X(1:1000, :);   # reads only the variable X
+  ## @end group
+  ## @end example
+  ##
+  ## Only the referenced variable is read from the file; for @sc{matlab}
+  ## binary files the remaining variables are seeked past without being
+  ## decoded or decompressed.  Any format understood by @code{load} may
+  ## be used.
+  ##
+  ## The list of variables stored in the file is available from
+  ## @code{who (@var{m})}, and nothing else of the file is read to
+  ## produce it.  The object is read-only; assigning through it is not
+  ## supported.
+  ## @seealso{load, who, whos}
+  ## @end deftypefn
+
+  properties (GetAccess = public, SetAccess = private, Hidden = true)
+    Filename = "";
+  endproperties
+
+  methods (Access = public)
+
+    function this = matfile (filename)
+
+      if (nargin < 1)
+        print_usage ();
+      endif
+
+      if (! ischar (filename))
+        error ("matfile: FILENAME must be a string");
+      endif
+
+      ## Resolve ".mat" extension and path lookup the same way load
+      ## does, and fail now rather than at the first reference if the
+      ## file does not exist or has an unknown format.
+      names = who ("-file", filename);
+      if (! iscell (names))
+        error ("matfile: unable to read '%s'", filename);
+      endif
+
+      this.Filename = filename;
+
+    endfunction
+
+    function names = who (this)
+      names = who ("-file", this.Filename);
+    endfunction
+
+    function varargout = subsref (this, idx)
+
+      if (! strcmp (idx(1).type, "."))
+        error ("matfile: object must be indexed with '.'");
+      endif
+
+      vname = idx(1).subs;
+
+      if (strcmp (vname, "Filename"))
+        val = this.Filename;
+      else
+        s = load (this.Filename, vname);
+        if (! isfield (s, vname))
+          error ("matfile: no variable '%s' in '%s'", vname, this.Filename);
+        endif
+        val = s.(vname);
+      endif
+
+      if (numel (idx) > 1)
+        varargout = cell (1, max (nargout, 1));
+        [varargout{:}] = subsref (val, idx(2:end));
+      else
+        varargout{1} = val;
+      endif
+
+    endfunction
+
+    function this = subsasgn (this, idx, rhs)
+      error ("matfile: objects are read-only");
+    endfunction
+
+    function disp (this)
+      printf ("  matfile object for '%s'\n", this.Filename);
+    endfunction
+
+  endmethods
+
+endclassdef
+
+
+%!test
+%! a = pi;
+%! b = magic (6);
+%! c = {"foo", [1, 2, 3]};
+%! fname = [tempname(), ".mat"];
+%! unwind_protect
+%!   save (fname, "a", "b", "c");
+%!   m = matfile (fname);
+%!   assert (sort (who (m)), {"a"; "b"; "c"});
+%!   assert (m.a, pi);
+%!   assert (m.b(2:4, [1, 6]), b(2:4, [1, 6]));
+%!   assert (m.c{2}, [1, 2, 3]);
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+
+%!test
+%! x = single (eye (5));
+%! fname = [tempname(), ".mat"];
+%! unwind_protect
+%!   save (fname, "x", "-v7");
+%!   m = matfile (fname);
+%!   assert (m.x(3, :), x(3, :));
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+
+%!test
+%! y = 1:10;
+%! fname = [tempname(), ".mat"];
+%! unwind_protect
+%!   save (fname, "y", "-v6");
+%!   m = matfile (fname);
+%!   fail ("m.z", "no variable 'z'");
+%!   fail ("m.y = 2", "read-only");
+%! unwind_protect_cleanup
+%!   unlink (fname);
+%! end_unwind_protect
+
+%!error <Invalid call> matfile ()
+%!error <FILENAME must be a string> matfile (7)
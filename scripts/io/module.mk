@@ -8,7 +8,8 @@ FCN_FILE_DIRS += %reldir%
   %reldir%/dlmwrite.m \
   %reldir%/fileread.m \
   %reldir%/importdata.m \
-  %reldir%/is_valid_file_id.m
+  %reldir%/is_valid_file_id.m \
+  %reldir%/matfile.m
 
 %canon_reldir%dir = $(fcnfiledir)/io
 
@@ -27,31 +27,29 @@
 ## @deftypefn  {} {@var{n} =} maxNumCompThreads ()
 ## @deftypefnx {} {@var{n_old} =} maxNumCompThreads (@var{n})
 ## @deftypefnx {} {@var{n_old} =} maxNumCompThreads ("automatic")
-## This function is provided for @sc{matlab} compatibility only.
+## Query or set the maximum number of computational threads.
 ##
-## The output @var{n} is the number of available processors as determined by
-## the @code{nproc} function.
+## With no argument, return the current limit, by default the number of
+## available processors as determined by the @code{nproc} function.
 ##
-## Programming Note: The function may be called with an argument to set the
-## number of computational threads, but that setting has @strong{no effect}.
+## When called with a positive integer @var{n}, limit both Octave's own
+## threaded operations and the loaded BLAS library to @var{n} threads and
+## return the previous limit.  @qcode{"automatic"} returns to the default.
+## Lowering the limit before starting parallel workers of your own avoids
+## oversubscribing the machine.
 ## @seealso{nproc}
 ## @end deftypefn
 
 function retval = maxNumCompThreads (arg)
 
-  persistent nthreads = nproc ();
-
-  retval = nthreads;
+  retval = __num_comp_threads__ ();
 
   if (nargin == 1)
     if (isnumeric (arg) && isscalar (arg) && arg == fix (arg)
         && arg > 0 && isfinite (arg))
-      ## FIXME: Should there be an upper limit?
-      nthreads = arg;
-      warning ("Octave:maxNumCompThreads:no-effect",
-               "maxNumCompThreads: setting number of threads has no effect");
+      __num_comp_threads__ (arg);
     elseif (ischar (arg) && strcmpi (arg, "automatic"))
-      nthreads = nproc ();
+      __num_comp_threads__ (0);
     else
       error ("maxNumCompThreads: invalid input argument");
     endif
@@ -61,13 +59,18 @@ endfunction
 
 
 %!test
-%! maxNumCompThreads ("automatic");
-%! assert (maxNumCompThreads (), nproc ());
-
-%!test
-%! warning ("off", "Octave:maxNumCompThreads:no-effect", "local");
-%! maxNumCompThreads (4);
-%! assert (maxNumCompThreads ("automatic"), 4);
+%! old = maxNumCompThreads (2);
+%! unwind_protect
+%!   assert (maxNumCompThreads (), 2);
+%!   assert (maxNumCompThreads ("automatic"), 2);
+%!   assert (maxNumCompThreads () >= 1);
+%! unwind_protect_cleanup
+%!   if (old == nproc ())
+%!     maxNumCompThreads ("automatic");
+%!   else
+%!     maxNumCompThreads (old);
+%!   endif
+%! end_unwind_protect
 
 %!error <invalid input argument> maxNumCompThreads ([1, 2])
 %!error <invalid input argument> maxNumCompThreads ("foobar")
@@ -0,0 +1,312 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+classdef decomposition
+
+  ## -*- texinfo -*-
+  ## @deftypefn  {} {@var{dA} =} decomposition (@var{A})
+  ## @deftypefnx {} {@var{dA} =} decomposition (@var{A}, @var{type})
+  ## Return a reusable factorization of the square matrix @var{A}.
+  ##
+  ## The returned object stores the factors of @var{A} so that repeated
+  ## linear solves with the same matrix,
+  ##
+  ## @example
+  ## @group
+  ## dA = decomposition (A);
+  ## x1 = dA \ b1;
+  ## x2 = dA \ b2;
+  ## @end group
+  ## @end example
+  ##
+  ## @noindent
+  ## factorize @var{A} only once, unlike @code{x = A \ b} which
+  ## refactorizes on every call.  Both @code{mldivide} (@code{dA \ b})
+  ## and @code{mrdivide} (@code{b / dA}) are supported, and the
+  ## right-hand side may have any number of columns.
+  ##
+  ## The optional argument @var{type} selects the factorization:
+  ##
+  ## @table @asis
+  ## @item @qcode{"auto"} (default)
+  ## Choose automatically: triangular matrices are stored as-is,
+  ## Hermitian matrices with a positive real diagonal are tried with
+  ## @code{chol} first, and anything else uses @code{lu}.
+  ##
+  ## @item @qcode{"lu"}
+  ## LU factorization with partial pivoting (and column scaling and
+  ## reordering for sparse matrices).
+  ##
+  ## @item @qcode{"chol"}
+  ## Cholesky factorization; @var{A} must be Hermitian positive
+  ## definite.
+  ##
+  ## @item @qcode{"triangular"}
+  ## @var{A} is already triangular and is used directly.
+  ## @end table
+  ##
+  ## For sparse matrices the factors come from the same @sc{umfpack}
+  ## and @sc{cholmod} based routines that @code{lu} and @code{chol}
+  ## use.
+  ## @seealso{mldivide, lu, chol, linsolve}
+  ## @end deftypefn
+
+  properties (GetAccess = public, SetAccess = private)
+    MatrixSize = [0, 0];
+    Type = "";
+  endproperties
+
+  properties (Access = private, Hidden = true)
+    ## Factors as produced by lu or chol; unused ones stay empty.
+    ## Dense lu:     P*A = L*U
+    ## Sparse lu:    P*(R\A)*Q = L*U
+    ## Dense chol:   A = R'*R
+    ## Sparse chol:  Q'*A*Q = R'*R
+    ## Triangular:   A itself is stored in L or U.
+    L = [];
+    U = [];
+    R = [];
+    P = [];
+    Q = [];
+  endproperties
+
+  methods (Access = public)
+
+    function this = decomposition (A, type)
+
+      if (nargin < 1)
+        print_usage ();
+      endif
+
+      if (nargin < 2)
+        type = "auto";
+      endif
+
+      if (! isnumeric (A) || ndims (A) != 2 || rows (A) != columns (A))
+        error ("decomposition: A must be a square numeric matrix");
+      endif
+
+      this.MatrixSize = size (A);
+
+      switch (type)
+        case "auto"
+          if (istriu (A) || istril (A))
+            type = "triangular";
+          elseif (ishermitian (A) && all (real (diag (A)) > 0))
+            type = "chol";
+          else
+            type = "lu";
+          endif
+          auto_requested = true;
+        case {"lu", "chol", "triangular"}
+          auto_requested = false;
+        otherwise
+          error ("decomposition: invalid TYPE '%s'", type);
+      endswitch
+
+      switch (type)
+
+        case "triangular"
+          if (istriu (A))
+            this.U = A;
+          elseif (istril (A))
+            this.L = A;
+          else
+            error ("decomposition: A is not triangular");
+          endif
+
+        case "chol"
+          if (issparse (A))
+            [R, fail, Q] = chol (A);
+            this.Q = Q;
+          else
+            [R, fail] = chol (A);
+          endif
+          if (fail)
+            if (auto_requested)
+              ## Not positive definite after all; fall back to lu.
+              this = decomposition (A, "lu");
+              return;
+            else
+              error ("decomposition: A is not positive definite");
+            endif
+          endif
+          this.R = R;
+
+        case "lu"
+          if (issparse (A))
+            [this.L, this.U, this.P, this.Q, this.R] = lu (A);
+          else
+            [this.L, this.U, this.P] = lu (A);
+          endif
+
+      endswitch
+
+      this.Type = type;
+
+    endfunction
+
+    function x = mldivide (this, b)
+
+      if (! isa (this, "decomposition"))
+        ## b \ dA with numeric b makes no sense.
+        error ("decomposition: left operand of '\\' must be the factorization");
+      endif
+      if (! isnumeric (b) || ndims (b) != 2)
+        error ("decomposition: B must be a numeric matrix");
+      endif
+      if (rows (b) != this.MatrixSize(1))
+        error ("decomposition: nonconformant arguments (A is %dx%d, B is %dx%d)",
+               this.MatrixSize(1), this.MatrixSize(2), rows (b), columns (b));
+      endif
+
+      switch (this.Type)
+        case "triangular"
+          if (isempty (this.L))
+            x = this.U \ b;
+          else
+            x = this.L \ b;
+          endif
+        case "chol"
+          if (isempty (this.Q))
+            x = this.R \ (this.R' \ b);
+          else
+            x = this.Q * (this.R \ (this.R' \ (this.Q' * b)));
+          endif
+        case "lu"
+          if (isempty (this.Q))
+            x = this.U \ (this.L \ (this.P * b));
+          else
+            x = this.Q * (this.U \ (this.L \ (this.P * (this.R \ b))));
+          endif
+      endswitch
+
+    endfunction
+
+    function x = mrdivide (b, this)
+
+      if (! isa (this, "decomposition"))
+        error ("decomposition: right operand of '/' must be the factorization");
+      endif
+      if (! isnumeric (b) || ndims (b) != 2)
+        error ("decomposition: B must be a numeric matrix");
+      endif
+      if (columns (b) != this.MatrixSize(1))
+        error ("decomposition: nonconformant arguments (A is %dx%d, B is %dx%d)",
+               this.MatrixSize(1), this.MatrixSize(2), rows (b), columns (b));
+      endif
+
+      ## Solve x*A = b as A'*x' = b' with the stored factors.
+
+      y = b';
+
+      switch (this.Type)
+        case "triangular"
+          if (isempty (this.L))
+            x = (this.U' \ y)';
+          else
+            x = (this.L' \ y)';
+          endif
+        case "chol"
+          ## A' == A.
+          x = mldivide (this, y)';
+        case "lu"
+          if (isempty (this.Q))
+            ## A' = U'*L'*P, so x' = P'*(L'\(U'\y)).
+            x = (this.P' * (this.L' \ (this.U' \ y)))';
+          else
+            ## A' = Q*U'*L'*P*R', so x' = R'\(P'*(L'\(U'\(Q'*y)))).
+            x = (this.R' \ (this.P' * (this.L' \ (this.U' \ (this.Q' * y)))))';
+          endif
+      endswitch
+
+    endfunction
+
+  endmethods
+
+endclassdef
+
+
+%!test
+%! A = [4, 1; 2, 5];
+%! b = [1; 2];
+%! dA = decomposition (A);
+%! assert (dA \ b, A \ b, 1e-14);
+%! assert (dA.Type, "lu");
+%! assert (dA.MatrixSize, [2, 2]);
+
+%!test
+%! A = [4, 1; 1, 5];  # Hermitian positive definite
+%! dA = decomposition (A);
+%! assert (dA.Type, "chol");
+%! assert (dA \ [1; 2], A \ [1; 2], 1e-14);
+
+%!test
+%! A = [1, 2; 2, 1];  # Hermitian but indefinite; auto must fall back
+%! dA = decomposition (A);
+%! assert (dA.Type, "lu");
+%! assert (dA \ [1; 2], A \ [1; 2], 1e-14);
+
+%!test
+%! A = triu (magic (4)) + 4*eye (4);
+%! dA = decomposition (A);
+%! assert (dA.Type, "triangular");
+%! b = magic (4);
+%! assert (dA \ b, A \ b, 1e-13);  # multiple right-hand sides
+
+%!test
+%! n = 50;
+%! A = sprandn (n, n, 0.1) + 10*speye (n);
+%! b = randn (n, 3);
+%! dA = decomposition (A, "lu");
+%! assert (dA \ b, A \ b, 1e-10);
+
+%!test
+%! n = 50;
+%! B = sprandn (n, n, 0.1);
+%! A = B*B' + 10*speye (n);  # sparse positive definite
+%! dA = decomposition (A);
+%! assert (dA.Type, "chol");
+%! b = randn (n, 2);
+%! assert (dA \ b, A \ b, 1e-10);
+
+%!test
+%! A = randn (6) + 1i*randn (6) + 8*eye (6);
+%! b = randn (2, 6);
+%! dA = decomposition (A);
+%! assert (b / dA, b / A, 1e-12);
+
+%!test
+%! n = 40;
+%! A = sprandn (n, n, 0.1) + 10*speye (n);
+%! b = randn (3, n);
+%! dA = decomposition (A);
+%! assert (b / dA, b / A, 1e-10);
+
+%!error <square numeric matrix> decomposition (ones (2, 3))
+%!error <invalid TYPE> decomposition (eye (2), "qr")
+%!error <not positive definite> decomposition ([1, 2; 2, 1], "chol")
+%!error <not triangular> decomposition (magic (3), "triangular")
+%!error <nonconformant> decomposition (eye (3)) \ ones (2, 1)
@@ -68,6 +68,14 @@
 ##
 ## @item TRANSA
 ##   Solve @code{A'*x = b} if true rather than @code{A*x = b}
+##
+## @item MIXED
+##   Factor @var{A} in single precision and refine the solution back to
+##   double accuracy iteratively (an Octave extension).  The
+##   factorization runs twice as fast and touches half the memory; for
+##   well-conditioned systems a few refinement steps recover full
+##   double-precision accuracy.  Ignored for sparse or single-precision
+##   inputs and for non-square @var{A}.
 ## @end table
 ##
 ## The optional second output @var{R} is the inverse condition number of
@@ -86,6 +94,7 @@ function [x, R] = linsolve (A, b, opts)
   endif
 
   trans_A = false;
+  mixed = false;
 
   ## Process any opts
   if (nargin > 2)
@@ -95,19 +104,27 @@ function [x, R] = linsolve (A, b, opts)
     if (isfield (opts, "TRANSA") && opts.TRANSA)
       trans_A = true;
     endif
+    if (isfield (opts, "MIXED") && opts.MIXED)
+      mixed = true;
+    endif
     if (isfield (opts, "POSDEF") && opts.POSDEF)
       A = matrix_type (A, "positive definite");
     endif
     if (isfield (opts, "LT") && opts.LT)
       A = matrix_type (A, "lower");
+      mixed = false;  # triangular solves are cheaper than refinement
     elseif (isfield (opts, "UT") && opts.UT)
       A = matrix_type (A, "upper");
+      mixed = false;
     endif
   endif
 
-  ## This way is faster as the transpose is not calculated in Octave,
-  ## but forwarded as a flag option to BLAS.
-  if (trans_A)
+  if (mixed && ! issparse (A) && ! issparse (b) && issquare (A)
+      && ! (isa (A, "single") || isa (b, "single")))
+    x = mixed_solve (A, b, trans_A);
+  elseif (trans_A)
+    ## This way is faster as the transpose is not calculated in Octave,
+    ## but forwarded as a flag option to BLAS.
     x = A' \ b;
   else
     x = A \ b;
@@ -123,6 +140,48 @@ function [x, R] = linsolve (A, b, opts)
 
 endfunction
 
+## Factor in single precision and refine the solution back to double
+## accuracy; residuals are always evaluated in double.
+
+function x = mixed_solve (A, b, trans_A)
+
+  [L, U, p] = lu (single (A), "vector");
+
+  if (trans_A)
+    ## With A(p,:) = L*U, the system A'*x = b becomes U'*L'*x(p) = b.
+    v = L' \ (U' \ single (b));
+    x = zeros (size (v));
+    x(p,:) = double (v);
+  else
+    x = double (U \ (L \ single (b(p,:))));
+  endif
+
+  tol = 2 * eps * norm (A, inf);
+
+  for iter = 1:5
+    if (trans_A)
+      r = b - A' * x;
+    else
+      r = b - A * x;
+    endif
+
+    if (norm (r, inf) <= tol * max (norm (x, inf), 1))
+      break;
+    endif
+
+    if (trans_A)
+      dv = L' \ (U' \ single (r));
+      dx = zeros (size (dv));
+      dx(p,:) = double (dv);
+    else
+      dx = double (U \ (L \ single (r(p,:))));
+    endif
+
+    x += dx;
+  endfor
+
+endfunction
+
 
 %!test
 %! n = 10;
@@ -141,6 +200,22 @@ endfunction
 %! opts.TRANSA = true;
 %! assert (linsolve (A, b, opts), A' \ b);
 
+%!test
+%! n = 50;
+%! A = rand (n) + n * eye (n);
+%! b = A * [ones(n, 1), (1:n)'];
+%! opts.MIXED = true;
+%! assert (linsolve (A, b, opts), A \ b, 1e-10);
+%! opts.TRANSA = true;
+%! assert (linsolve (A, b, opts), A' \ b, 1e-10);
+
+%!test
+%! ## MIXED must not disturb the single-precision path
+%! A = single (rand (10) + 10 * eye (10));
+%! b = single (rand (10, 1));
+%! opts.MIXED = true;
+%! assert (linsolve (A, b, opts), A \ b);
+
 %!error <Invalid call> linsolve ()
 %!error <Invalid call> linsolve (1)
 %!error linsolve (1,2,3)
@@ -8,6 +8,7 @@ FCN_FILE_DIRS += %reldir%
   %reldir%/condeig.m \
   %reldir%/condest.m \
   %reldir%/cross.m \
+  %reldir%/decomposition.m \
   %reldir%/duplication_matrix.m \
   %reldir%/expm.m \
   %reldir%/gls.m \
@@ -29,11 +30,14 @@ FCN_FILE_DIRS += %reldir%
   %reldir%/ols.m \
   %reldir%/ordeig.m \
   %reldir%/orth.m \
+  %reldir%/pagectranspose.m \
+  %reldir%/pagetranspose.m \
   %reldir%/planerot.m \
   %reldir%/qzhess.m \
   %reldir%/rank.m \
   %reldir%/rref.m \
   %reldir%/subspace.m \
+  %reldir%/svdsketch.m \
   %reldir%/trace.m \
   %reldir%/tensorprod.m \
   %reldir%/vech.m \
@@ -0,0 +1,51 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {@var{Y} =} pagectranspose (@var{X})
+## Complex-conjugate transpose each 2-D page of the N-D array @var{X}.
+##
+## Page @code{@var{Y}(:,:,i)} of the result is
+## @code{@var{X}(:,:,i)'}.  This is equivalent to
+## @code{conj (permute (@var{X}, [2, 1, 3:ndims(@var{X})]))}.
+## @seealso{pagetranspose, pagemtimes, ctranspose, permute}
+## @end deftypefn
+
+function Y = pagectranspose (X)
+
+  if (nargin < 1)
+    print_usage ();
+  endif
+
+  Y = conj (permute (X, [2, 1, 3:ndims(X)]));
+
+endfunction
+
+
+%!assert (pagectranspose (reshape (1:8, 2, 2, 2)),
+%!        cat (3, [1, 2; 3, 4], [5, 6; 7, 8]))
+%!assert (pagectranspose ([1i, 2i]), [-1i; -2i])
+
+%!error <Invalid call> pagectranspose ()
@@ -0,0 +1,250 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn  {} {[@var{U}, @var{S}, @var{V}] =} svdsketch (@var{A})
+## @deftypefnx {} {[@var{U}, @var{S}, @var{V}] =} svdsketch (@var{A}, @var{epstol})
+## @deftypefnx {} {[@var{U}, @var{S}, @var{V}] =} svdsketch (@dots{}, "@var{property}", @var{value}, @dots{})
+## @deftypefnx {} {[@var{U}, @var{S}, @var{V}, @var{apxerr}] =} svdsketch (@dots{})
+## Compute a low-rank singular value decomposition sketch of @var{A}.
+##
+## The factors satisfy
+## @code{norm (@var{A} - @var{U}*@var{S}*@var{V}', "fro") <=
+## @var{epstol} * norm (@var{A}, "fro")} up to the accuracy of the
+## randomized error estimate, with a rank chosen adaptively.  The
+## default tolerance is @code{eps (class (@var{A}))^(1/4)}.
+##
+## The factorization is built with a blocked randomized range finder:
+## each step multiplies @var{A} with a block of Gaussian test vectors,
+## so the work is dominated by matrix-matrix products and only a few
+## passes over @var{A} are needed.  This is much faster than
+## @code{svds} when a low-rank approximation of a large (possibly
+## sparse) matrix is wanted and moderate accuracy suffices.
+##
+## The following property/value pairs tune the process:
+##
+## @table @asis
+## @item @qcode{"MaxSubspaceDimension"}
+## Upper bound on the rank of the sketch
+## (default: @code{min (size (@var{A}))}).
+##
+## @item @qcode{"BlockSize"}
+## Number of Gaussian test vectors added per iteration (default:
+## roughly a tenth of the smaller matrix dimension, at least 5).
+##
+## @item @qcode{"MaxIterations"}
+## Maximum number of blocks (default: enough to reach
+## @qcode{"MaxSubspaceDimension"}).
+##
+## @item @qcode{"NumPowerIterations"}
+## Number of power iterations applied to each block (default 1).
+## More power iterations improve accuracy for matrices with slowly
+## decaying spectra at the cost of extra passes over @var{A}.
+## @end table
+##
+## The optional output @var{apxerr} is the estimated relative
+## approximation error
+## @code{norm (@var{A} - @var{U}*@var{S}*@var{V}', "fro") /
+## norm (@var{A}, "fro")}.
+## @seealso{svds, svd, eigs, qr}
+## @end deftypefn
+
+function [U, S, V, apxerr] = svdsketch (A, epstol, varargin)
+
+  if (nargin < 1 || mod (numel (varargin), 2) != 0)
+    print_usage ();
+  endif
+
+  if (! isnumeric (A) || ndims (A) != 2)
+    error ("svdsketch: A must be a numeric matrix");
+  endif
+
+  if (isinteger (A))
+    error ("svdsketch: A must be a floating point matrix");
+  endif
+
+  if (nargin < 2 || isempty (epstol))
+    epstol = eps (class (A)) ^ (1/4);
+  elseif (! (isscalar (epstol) && isreal (epstol) && epstol > 0))
+    error ("svdsketch: EPSTOL must be a positive real scalar");
+  endif
+
+  [m, n] = size (A);
+  mindim = min (m, n);
+
+  ## Defaults for the tuning properties.
+  maxdim = mindim;
+  blksz = [];
+  maxit = [];
+  npower = 1;
+
+  for i = 1:2:numel (varargin)
+    prop = varargin{i};
+    val = varargin{i+1};
+    if (! (ischar (prop) || isstring (prop)))
+      error ("svdsketch: PROPERTY name must be a string");
+    endif
+    if (! (isscalar (val) && isreal (val) && val >= 0))
+      error ("svdsketch: %s must be a non-negative real scalar", char (prop));
+    endif
+    switch (lower (char (prop)))
+      case "maxsubspacedimension"
+        maxdim = min (val, mindim);
+      case "blocksize"
+        blksz = val;
+      case "maxiterations"
+        maxit = val;
+      case "numpoweriterations"
+        npower = val;
+      otherwise
+        error ("svdsketch: unknown property '%s'", char (prop));
+    endswitch
+  endfor
+
+  if (isempty (blksz))
+    blksz = min (max (floor (mindim / 10), 5), maxdim);
+  endif
+  blksz = max (1, min (blksz, maxdim));
+  if (isempty (maxit))
+    maxit = ceil (maxdim / blksz);
+  endif
+
+  if (mindim == 0)
+    U = zeros (m, 0);
+    S = zeros (0, 0);
+    V = zeros (n, 0);
+    apxerr = 0;
+    return;
+  endif
+
+  normA = norm (A, "fro");
+
+  if (normA == 0)
+    U = zeros (m, 0);
+    S = zeros (0, 0);
+    V = zeros (n, 0);
+    apxerr = 0;
+    return;
+  endif
+
+  ## Blocked randomized QB factorization with an error indicator
+  ## (randQB_EI): accumulate an orthonormal basis Q of the range of A
+  ## block by block and track norm(A - Q*B, "fro")^2 incrementally as
+  ## normA^2 - norm(B, "fro")^2, which is cheap and does not touch A.
+
+  Q = zeros (m, 0);
+  B = zeros (0, n);
+
+  E = normA ^ 2;
+
+  for i = 1:maxit
+    b = min (blksz, maxdim - columns (Q));
+    if (b < 1)
+      break;
+    endif
+
+    W = randn (n, b);
+    Y = A*W - Q*(B*W);
+    [Qi, ~] = qr (Y, 0);
+
+    for j = 1:npower
+      Z = A'*Qi - B'*(Q'*Qi);
+      Y = A*Z - Q*(B*Z);
+      [Qi, ~] = qr (Y, 0);
+    endfor
+
+    ## Reorthogonalize against the basis accumulated so far.
+    Qi = Qi - Q*(Q'*Qi);
+    [Qi, ~] = qr (Qi, 0);
+
+    Bi = Qi' * A;
+
+    Q = [Q, Qi];
+    B = [B; Bi];
+
+    E = max (E - norm (Bi, "fro")^2, 0);
+
+    if (sqrt (E) <= epstol * normA)
+      break;
+    endif
+  endfor
+
+  [U, S, V] = svd (B, "econ");
+  U = Q * U;
+
+  ## Drop trailing singular values whose removal keeps the estimated
+  ## error within the tolerance.
+  sv = diag (S);
+  k = numel (sv);
+  while (k > 1 && sqrt (E + sum (sv(k:end).^2)) <= epstol * normA)
+    k--;
+  endwhile
+  if (k < numel (sv))
+    E += sum (sv(k+1:end).^2);
+    U = U(:, 1:k);
+    S = S(1:k, 1:k);
+    V = V(:, 1:k);
+  endif
+
+  apxerr = sqrt (E) / normA;
+
+endfunction
+
+
+%!test
+%! rand ("state", 42);  randn ("state", 42);
+%! A = randn (60, 20) * randn (20, 50);  # exact rank 20
+%! [U, S, V, err] = svdsketch (A, 1e-10);
+%! assert (norm (A - U*S*V', "fro") / norm (A, "fro") <= 1e-8);
+%! assert (err <= 1e-8);
+%! assert (U'*U, eye (columns (U)), 1e-12);
+%! assert (V'*V, eye (columns (V)), 1e-12);
+
+%!test
+%! randn ("state", 7);
+%! A = sprandn (200, 150, 0.05);
+%! [U, S, V] = svdsketch (A, 0.3);
+%! assert (norm (full (A) - U*S*V', "fro") <= 0.3 * norm (full (A), "fro") * 1.5);
+
+%!test
+%! randn ("state", 13);
+%! A = randn (40, 30) + 1i*randn (40, 30);
+%! [U, S, V, err] = svdsketch (A, 1e-10);
+%! assert (norm (A - U*S*V', "fro") / norm (A, "fro") <= 1e-8);
+
+%!test
+%! randn ("state", 3);
+%! A = randn (50, 8) * randn (8, 50);
+%! [U, S, V] = svdsketch (A, 1e-8, "MaxSubspaceDimension", 5);
+%! assert (columns (U) <= 5);
+
+%!test
+%! [U, S, V, err] = svdsketch (zeros (4, 3));
+%! assert (isempty (U) && isempty (S) && isempty (V));
+%! assert (err, 0);
+
+%!error <A must be a numeric matrix> svdsketch ({1})
+%!error <EPSTOL must be a positive real scalar> svdsketch (eye (3), -1)
+%!error <unknown property> svdsketch (eye (3), 0.1, "FooBar", 1)
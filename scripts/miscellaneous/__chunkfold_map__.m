@@ -0,0 +1,52 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {@var{p} =} __chunkfold_map__ (@var{mapfcn}, @var{file}, @var{precision}, @var{byte_offset}, @var{count})
+## Undocumented internal function.
+##
+## Run inside a @code{chunkfold} worker: read @var{count} elements of
+## class @var{precision} from @var{file} starting at @var{byte_offset}
+## and apply @var{mapfcn} to the chunk.
+## @seealso{chunkfold}
+## @end deftypefn
+
+function p = __chunkfold_map__ (mapfcn, file, precision, byte_offset, count)
+
+  fid = fopen (file, "r");
+  if (fid < 0)
+    error ("__chunkfold_map__: unable to open %s", file);
+  endif
+
+  unwind_protect
+    fseek (fid, byte_offset, "bof");
+    chunk = fread (fid, count, ["*", precision]);
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+  p = mapfcn (chunk);
+
+endfunction
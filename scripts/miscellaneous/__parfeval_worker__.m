@@ -0,0 +1,55 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {} __parfeval_worker__ (@var{infile}, @var{outfile})
+## Undocumented internal function.
+##
+## Run inside the background process started by @code{parfeval}: load
+## the serialized call from @var{infile}, evaluate it, and write the
+## outputs (or the error) to @var{outfile}.
+## @end deftypefn
+
+function __parfeval_worker__ (infile, outfile)
+
+  s = load (infile);
+
+  out = cell (1, s.numout);
+  err = [];
+
+  try
+    [out{1:s.numout}] = feval (s.fcn, s.args{:});
+  catch exception
+    err = struct ("identifier", exception.identifier, ...
+                  "message", exception.message);
+  end_try_catch
+
+  ## Write under a temporary name and rename so that fetchOutputs never
+  ## sees a partially written file.
+  tmpfile = [outfile, "-tmp"];
+  save ("-binary", tmpfile, "out", "err");
+  rename (tmpfile, outfile);
+
+endfunction
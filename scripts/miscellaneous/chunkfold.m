@@ -0,0 +1,269 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn  {} {@var{r} =} chunkfold (@var{mapfcn}, @var{redfcn}, @var{x})
+## @deftypefnx {} {@var{r} =} chunkfold (@var{mapfcn}, @var{redfcn}, @var{x}, @var{chunksize})
+## @deftypefnx {} {@var{r} =} chunkfold (@var{mapfcn}, @var{redfcn}, @var{file}, @var{precision})
+## @deftypefnx {} {@var{r} =} chunkfold (@var{mapfcn}, @var{redfcn}, @var{file}, @var{precision}, @var{chunksize})
+## @deftypefnx {} {@var{r} =} chunkfold (@dots{}, "workers", @var{n})
+## Stream data through @var{mapfcn} in chunks and combine the partial
+## results with @var{redfcn}, without ever holding more than one chunk
+## in memory.
+##
+## The data source is either an in-memory array @var{x}, processed in
+## chunks of @var{chunksize} consecutive elements (default 1e6), or the
+## name of a file containing raw binary values of class @var{precision}
+## (one of the type names accepted by @code{fread}, for example
+## @qcode{"double"} or @qcode{"int32"}), read @var{chunksize} elements
+## at a time.
+##
+## @var{mapfcn} is applied to each chunk; the chunk partials are then
+## folded in order:
+##
+## @example
+## r = redfcn (redfcn (mapfcn (chunk1), mapfcn (chunk2)), @dots{})
+## @end example
+##
+## @var{redfcn} should therefore be associative if the result is to be
+## independent of the chunk size.  An empty source yields @code{r = []}.
+##
+## With the option @qcode{"workers"}, up to @var{n} chunks are mapped
+## concurrently in background processes via @code{parfeval}; for file
+## sources each worker reads only its own byte range.  Partials are
+## still folded in chunk order, so the result is the same as the serial
+## evaluation.
+##
+## For example, the sum of a large on-disk vector:
+##
+## @example
+## @group
+## r = chunkfold (@@sum, @@plus, "big.dat", "double")
+## @end group
+## @end example
+## @seealso{parfeval, fread, arrayfun}
+## @end deftypefn
+
+function r = chunkfold (mapfcn, redfcn, src, varargin)
+
+  if (nargin < 3)
+    print_usage ();
+  endif
+
+  if (! is_function_handle (mapfcn))
+    error ("chunkfold: MAPFCN must be a function handle");
+  endif
+
+  if (! is_function_handle (redfcn))
+    error ("chunkfold: REDFCN must be a function handle");
+  endif
+
+  ## Strip the "workers" option off the argument list.
+  nworkers = 0;
+  iw = find (cellfun (@(a) ischar (a) && strcmpi (a, "workers"), varargin));
+  if (! isempty (iw))
+    if (numel (iw) > 1 || iw == numel (varargin))
+      print_usage ();
+    endif
+    nworkers = varargin{iw+1};
+    if (! (isnumeric (nworkers) && isscalar (nworkers)
+           && nworkers >= 1 && nworkers == fix (nworkers)))
+      error ("chunkfold: workers value must be a positive integer");
+    endif
+    varargin([iw, iw+1]) = [];
+  endif
+
+  if (ischar (src))
+    ## Raw binary file source.
+    if (isempty (varargin))
+      error ("chunkfold: PRECISION is required for a file source");
+    endif
+    precision = varargin{1};
+    elsize = element_size (precision);
+
+    chunksize = 1e6;
+    if (numel (varargin) > 1)
+      chunksize = varargin{2};
+    endif
+    check_chunksize (chunksize);
+
+    [info, err, msg] = stat (src);
+    if (err != 0)
+      error ("chunkfold: cannot stat %s: %s", src, msg);
+    endif
+    n = floor (info.size / elsize);
+
+    nchunks = ceil (n / chunksize);
+
+    if (nworkers > 1 && nchunks > 1)
+      ## Each worker reads its own byte range of the file.
+      launch = @(c) parfeval (@__chunkfold_map__, 1, mapfcn, src, ...
+                              precision, (c-1) * chunksize * elsize, ...
+                              min (chunksize, n - (c-1)*chunksize));
+      r = fold_parallel (redfcn, launch, nchunks, nworkers);
+    else
+      fid = fopen (src, "r");
+      if (fid < 0)
+        error ("chunkfold: unable to open %s", src);
+      endif
+      r = [];
+      unwind_protect
+        for c = 1:nchunks
+          chunk = fread (fid, min (chunksize, n - (c-1)*chunksize), ...
+                         ["*", precision]);
+          r = fold_partial (redfcn, r, mapfcn (chunk), c);
+        endfor
+      unwind_protect_cleanup
+        fclose (fid);
+      end_unwind_protect
+    endif
+
+  elseif (isnumeric (src) || islogical (src))
+    chunksize = 1e6;
+    if (! isempty (varargin))
+      chunksize = varargin{1};
+    endif
+    check_chunksize (chunksize);
+
+    n = numel (src);
+    nchunks = ceil (n / chunksize);
+
+    if (nworkers > 1 && nchunks > 1)
+      launch = @(c) parfeval (mapfcn, 1, ...
+                              src((c-1)*chunksize + 1 : min (c*chunksize, n)));
+      r = fold_parallel (redfcn, launch, nchunks, nworkers);
+    else
+      r = [];
+      for c = 1:nchunks
+        chunk = src((c-1)*chunksize + 1 : min (c*chunksize, n));
+        r = fold_partial (redfcn, r, mapfcn (chunk), c);
+      endfor
+    endif
+
+  else
+    error ("chunkfold: SRC must be a numeric array or a filename");
+  endif
+
+endfunction
+
+function r = fold_partial (redfcn, r, partial, c)
+  if (c == 1)
+    r = partial;
+  else
+    r = redfcn (r, partial);
+  endif
+endfunction
+
+## Keep at most NWORKERS futures in flight and fold the partials in
+## chunk order as the oldest future completes.
+function r = fold_parallel (redfcn, launch, nchunks, nworkers)
+  futs = cell (1, nchunks);
+  inflight = min (nworkers, nchunks);
+  for c = 1:inflight
+    futs{c} = launch (c);
+  endfor
+
+  r = [];
+  for c = 1:nchunks
+    partial = fetchOutputs (futs{c});
+    if (c + inflight <= nchunks)
+      futs{c + inflight} = launch (c + inflight);
+    endif
+    r = fold_partial (redfcn, r, partial, c);
+  endfor
+endfunction
+
+function check_chunksize (chunksize)
+  if (! (isnumeric (chunksize) && isscalar (chunksize)
+         && chunksize >= 1 && chunksize == fix (chunksize)))
+    error ("chunkfold: CHUNKSIZE must be a positive integer");
+  endif
+endfunction
+
+function elsize = element_size (precision)
+  if (! ischar (precision))
+    error ("chunkfold: PRECISION must be a class name accepted by fread");
+  endif
+  switch (precision)
+    case {"int8", "uint8", "char", "logical"}
+      elsize = 1;
+    case {"int16", "uint16"}
+      elsize = 2;
+    case {"int32", "uint32", "single", "float32"}
+      elsize = 4;
+    case {"int64", "uint64", "double", "float64"}
+      elsize = 8;
+    otherwise
+      error ("chunkfold: unsupported PRECISION '%s'", precision);
+  endswitch
+endfunction
+
+
+%!assert (chunkfold (@sum, @plus, 1:1000, 128), 500500)
+%!assert (chunkfold (@sum, @plus, 1:1000), 500500)
+%!assert (chunkfold (@max, @max, [3 1 4 1 5 9 2 6], 3), 9)
+%!assert (chunkfold (@sum, @plus, []), [])
+
+%!test
+%! tmp = tempname ();
+%! fid = fopen (tmp, "w");
+%! fwrite (fid, 1:1000, "double");
+%! fclose (fid);
+%! unwind_protect
+%!   assert (chunkfold (@sum, @plus, tmp, "double", 128), 500500);
+%!   assert (chunkfold (@sum, @plus, tmp, "double"), 500500);
+%! unwind_protect_cleanup
+%!   unlink (tmp);
+%! end_unwind_protect
+
+%!test
+%! ## chunks keep the on-disk class
+%! tmp = tempname ();
+%! fid = fopen (tmp, "w");
+%! fwrite (fid, 1:100, "int32");
+%! fclose (fid);
+%! unwind_protect
+%!   assert (chunkfold (@class, @(a, b) a, tmp, "int32", 30), "int32");
+%! unwind_protect_cleanup
+%!   unlink (tmp);
+%! end_unwind_protect
+
+## The parallel path needs an installed interpreter to start workers,
+## so skip it when the binary is not available.
+%!test
+%! bin = fullfile (__octave_config_info__ ("bindir"), ...
+%!                 sprintf ("octave-%s%s", version (), ...
+%!                          __octave_config_info__ ("EXEEXT")));
+%! if (exist (bin, "file"))
+%!   assert (chunkfold (@sum, @plus, 1:1000, 300, "workers", 2), 500500);
+%! endif
+
+%!error <Invalid call> chunkfold ()
+%!error <MAPFCN must be a function handle> chunkfold (1, @plus, 1:10)
+%!error <REDFCN must be a function handle> chunkfold (@sum, 1, 1:10)
+%!error <PRECISION is required> chunkfold (@sum, @plus, "somefile")
+%!error <unsupported PRECISION> chunkfold (@sum, @plus, "somefile", "foo")
+%!error <CHUNKSIZE must be a positive integer> chunkfold (@sum, @plus, 1:10, 0)
+%!error <workers value must be a positive integer> chunkfold (@sum, @plus, 1:10, "workers", 0)
@@ -123,24 +123,20 @@ function list = dir (directory = ".")
     last_dir = last_absdir = "";
     info(nf,1).name = "";  # pre-declare size of struct array
 
+    ## Stat all files in one batched call rather than one lstat call
+    ## per file; links that point to something are already resolved to
+    ## their targets.
+    [sts, errs, msgs] = __batch_lstat__ (flst);
+
     ## Collect results.
     cnt = 0;
     for i = 1:nf
       fn = flst{i};
-      [st, err, msg] = lstat (fn);
-      if (err < 0)
-        warning ("dir: 'lstat (%s)' failed: %s", fn, msg);
+      if (errs(i) < 0)
+        warning ("dir: 'lstat (%s)' failed: %s", fn, msgs{i});
         continue;
       else
-        ## If we are looking at a link that points to something,
-        ## return info about the target of the link, otherwise, return
-        ## info about the link itself.
-        if (S_ISLNK (st.mode))
-          [xst, err] = stat (fn);
-          if (! err)
-            st = xst;
-          endif
-        endif
+        st = sts(i);
         tmpdir = regexprep (fn, re, '$1');
         if (is_same_file (fn, tmpdir))
           ## regexrep failed to match, no directory component.
@@ -0,0 +1,108 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {[@var{out1}, @dots{}] =} fetchOutputs (@var{fut})
+## Wait for the future @var{fut} created by @code{parfeval} to finish
+## and return the outputs of the evaluated function.
+##
+## If the function raised an error in the worker, that error is
+## re-raised here.  Fetching releases the worker's temporary files, so
+## each future can be fetched only once.
+## @seealso{parfeval}
+## @end deftypefn
+
+function varargout = fetchOutputs (fut)
+
+  if (nargin != 1)
+    print_usage ();
+  endif
+
+  if (! (isstruct (fut) && isfield (fut, "outfile")
+         && isfield (fut, "pid")))
+    error ("fetchOutputs: FUT must be a future created by parfeval");
+  endif
+
+  ## The worker writes the output file as the final step, under a
+  ## temporary name renamed into place, so its existence means the
+  ## results are complete.
+  while (! isfile (fut.outfile))
+    if (isunix ())
+      [pid, status] = waitpid (fut.pid, WNOHANG);
+      if (pid == fut.pid && ! isfile (fut.outfile))
+        cleanup_workdir (fut.workdir);
+        error ("fetchOutputs: worker process exited with status %d without producing results", ...
+               status);
+      endif
+    endif
+    pause (0.05);
+  endwhile
+
+  if (isunix ())
+    ## Reap the worker so it does not linger as a zombie.
+    waitpid (fut.pid);
+  endif
+
+  results = load (fut.outfile);
+
+  cleanup_workdir (fut.workdir);
+
+  if (! isempty (results.err))
+    error (results.err.identifier, "%s", results.err.message);
+  endif
+
+  varargout = results.out;
+
+endfunction
+
+function cleanup_workdir (workdir)
+
+  ## Best effort only; a stale temporary directory is not worth an
+  ## error on the fetch path.
+  try
+    confirm_recursive_rmdir (false, "local");
+    rmdir (workdir, "s");
+  catch
+  end_try_catch
+
+endfunction
+
+
+%!error <Invalid call> fetchOutputs ()
+%!error <FUT must be a future> fetchOutputs (1)
+%!error <FUT must be a future> fetchOutputs (struct ("pid", 1))
+
+%!test
+%! bin = fullfile (__octave_config_info__ ("bindir"), ...
+%!                 sprintf ("octave-%s%s", version (), ...
+%!                          __octave_config_info__ ("EXEEXT")));
+%! if (exist (bin, "file"))
+%!   fut = parfeval (@size, 2, zeros (3, 7));
+%!   [r, c] = fetchOutputs (fut);
+%!   assert ([r, c], [3, 7]);
+%!   ## Errors in the worker surface at fetch time.
+%!   fut = parfeval (@() error ("Octave:parfeval-test", "boom"), 0);
+%!   fail ("fetchOutputs (fut)", "boom");
+%! endif
@@ -12,9 +12,12 @@ FCN_FILE_DIRS += \
 
 %canon_reldir%_FCN_FILES = \
   %reldir%/.oct-config \
+  %reldir%/__chunkfold_map__.m \
+  %reldir%/__parfeval_worker__.m \
   %reldir%/bug_report.m \
   %reldir%/bunzip2.m \
   %reldir%/cast.m \
+  %reldir%/chunkfold.m \
   %reldir%/citation.m \
   %reldir%/clearAllMemoizedCaches.m \
   %reldir%/clearvars.m \
@@ -25,6 +28,7 @@ FCN_FILE_DIRS += \
   %reldir%/dir.m \
   %reldir%/dos.m \
   %reldir%/edit.m \
+  %reldir%/fetchOutputs.m \
   %reldir%/fieldnames.m \
   %reldir%/fileattrib.m \
   %reldir%/fileparts.m \
@@ -85,6 +89,7 @@ FCN_FILE_DIRS += \
   %reldir%/open.m \
   %reldir%/orderfields.m \
   %reldir%/pack.m \
+  %reldir%/parfeval.m \
   %reldir%/parseparams.m \
   %reldir%/perl.m \
   %reldir%/publish.m \
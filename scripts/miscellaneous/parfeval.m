@@ -0,0 +1,126 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {@var{fut} =} parfeval (@var{fcn}, @var{numout}, @dots{})
+## Evaluate the function handle @var{fcn} asynchronously in a background
+## Octave process.
+##
+## The call returns immediately with a future @var{fut} while
+## @code{@var{fcn} (@dots{})} runs in a separate worker started with the
+## asynchronous mode of @code{system}.  @var{numout} is the number of
+## output arguments to request from @var{fcn}; any remaining arguments
+## are passed to it as inputs.  The inputs are serialized for the
+## worker, so the worker operates on copies and cannot see later changes
+## to the caller's variables.
+##
+## Use @code{fetchOutputs} to wait for the evaluation to finish and
+## collect its results:
+##
+## @example
+## @group
+## fut = parfeval (@@eig, 1, A);
+## ## ... do other work while the worker runs ...
+## e = fetchOutputs (fut);
+## @end group
+## @end example
+##
+## The future is a struct and must be passed to @code{fetchOutputs}
+## exactly once; fetching also releases the temporary files that carry
+## inputs and outputs to and from the worker.
+##
+## Anonymous function inputs are supported, but the variables they
+## capture are serialized along with them.  The worker does not share
+## global variables or the caller's function search path modifications.
+## @seealso{fetchOutputs, system}
+## @end deftypefn
+
+function fut = parfeval (fcn, numout, varargin)
+
+  if (nargin < 2)
+    print_usage ();
+  endif
+
+  if (! is_function_handle (fcn))
+    error ("parfeval: FCN must be a function handle");
+  endif
+
+  if (! (isnumeric (numout) && isscalar (numout)
+         && numout >= 0 && numout == fix (numout)))
+    error ("parfeval: NUMOUT must be a non-negative integer");
+  endif
+
+  workdir = tempname ();
+  if (! mkdir (workdir))
+    error ("parfeval: unable to create temporary directory for worker");
+  endif
+
+  infile = fullfile (workdir, "in.mat");
+  outfile = fullfile (workdir, "out.mat");
+
+  args = varargin;
+  save ("-binary", infile, "fcn", "numout", "args");
+
+  bindir = __octave_config_info__ ("bindir");
+  exeext = __octave_config_info__ ("EXEEXT");
+  octave_binary = fullfile (bindir, sprintf ("octave-%s%s", version (),
+                                             exeext));
+  if (! exist (octave_binary, "file"))
+    octave_binary = fullfile (bindir, sprintf ("octave%s", exeext));
+  endif
+
+  evalstr = sprintf ("__parfeval_worker__ ('%s', '%s');", infile, outfile);
+  cmd = sprintf ('"%s" --norc --no-history --quiet --eval "%s"', ...
+                 octave_binary, evalstr);
+
+  pid = system (cmd, false, "async");
+
+  fut = struct ("pid", pid, ...
+                "Function", fcn, ...
+                "NumOutputArguments", numout, ...
+                "State", "running", ...
+                "workdir", workdir, ...
+                "outfile", outfile);
+
+endfunction
+
+
+%!error <Invalid call> parfeval ()
+%!error <Invalid call> parfeval (@sin)
+%!error <FCN must be a function handle> parfeval ("sin", 1, pi)
+%!error <NUMOUT must be a non-negative integer> parfeval (@sin, -1, pi)
+%!error <NUMOUT must be a non-negative integer> parfeval (@sin, 1.5, pi)
+
+## The round-trip test needs an installed interpreter to start the
+## worker, so skip it when the binary is not available.
+%!test
+%! bin = fullfile (__octave_config_info__ ("bindir"), ...
+%!                 sprintf ("octave-%s%s", version (), ...
+%!                          __octave_config_info__ ("EXEEXT")));
+%! if (exist (bin, "file"))
+%!   fut = parfeval (@plus, 1, 1, 2);
+%!   assert (fut.State, "running");
+%!   assert (fetchOutputs (fut), 3);
+%! endif
@@ -535,6 +535,11 @@ endfunction
 %! opt = odeset ("Jpattern", S);
 %! sol = ode23s (@fpol, [0 2], [2 0], opt);
 %! assert ([sol.x(end); sol.y(:,end)], [2; fref'], 1e-3);
+%!testif HAVE_UMFPACK  # Jpattern with structurally orthogonal columns
+%! S = sparse ([1 0; 0 1]);
+%! opt = odeset ("Jpattern", S);
+%! sol = ode23s (@(t, y) -y, [0 1], [1; 2], opt);
+%! assert (sol.y(:,end), [1; 2] * exp (-1), 1e-3);
 
 ## Note: The following options have no effect on this solver
 ##       therefore it makes no sense to test them here:
@@ -191,14 +191,25 @@ function prt = __dfxpdp__ (p, fcn, rtol, pattern)
   ps = p;
   if (nargin > 3 && issparse (pattern))
     prt = pattern;  # initialize Jacobian
-    for j = find (any (pattern, 1))
-      ps(j) = p1(j);
+
+    ## Structurally orthogonal columns (columns that share no row in
+    ## the pattern) can be perturbed simultaneously, so the number of
+    ## function evaluations is twice the number of column groups
+    ## instead of twice the number of columns.
+
+    group = __color_columns__ (pattern);
+
+    for c = 1:max ([group, 0])
+      cols = find (group == c);
+      ps(cols) = p1(cols);
       tp1 = fcn (ps);
-      ps(j) = p2(j);
+      ps(cols) = p2(cols);
       tp2 = fcn (ps);
-      pattern_nnz = find (pattern(:, j));
-      prt(pattern_nnz, j) = (tp1(pattern_nnz) - tp2(pattern_nnz)) / absdel(j);
-      ps(j) = p(j);
+      for j = cols
+        pattern_nnz = find (pattern(:, j));
+        prt(pattern_nnz, j) = (tp1(pattern_nnz) - tp2(pattern_nnz)) / absdel(j);
+      endfor
+      ps(cols) = p(cols);
     endfor
   else
     prt = zeros (m, n); # initialize Jacobian
@@ -213,3 +224,26 @@ function prt = __dfxpdp__ (p, fcn, rtol, pattern)
   endif
 
 endfunction
+
+function group = __color_columns__ (pattern)
+
+  ## Greedy Curtis-Powell-Reid grouping: assign each column the first
+  ## group whose columns do not touch any of its rows.  Columns with an
+  ## empty pattern keep group 0 and are never perturbed.
+
+  n = columns (pattern);
+  group = zeros (1, n);
+  used = false (rows (pattern), 0);  # rows covered by each group
+
+  for j = find (any (pattern, 1))
+    r = find (pattern(:, j));
+    c = find (! any (used(r, :), 1), 1);
+    if (isempty (c))
+      used(:, end+1) = false;
+      c = columns (used);
+    endif
+    group(j) = c;
+    used(r, c) = true;
+  endfor
+
+endfunction
@@ -0,0 +1,104 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn  {} {} memprofile on
+## @deftypefnx {} {} memprofile off
+## @deftypefnx {} {} memprofile clear
+## @deftypefnx {} {@var{T} =} memprofile ("report")
+## Control the memory accounting side of the built-in profiler.
+##
+## While the profiler is running, the bytes allocated for array data are
+## attributed to the function that allocated them, alongside the timing
+## statistics.
+##
+## @table @code
+## @item memprofile on
+## Start the profiler, including allocation accounting.
+##
+## @item memprofile off
+## Stop profiling.
+##
+## @item memprofile clear
+## Clear all collected profiler data.
+##
+## @item @var{T} = memprofile ("report")
+## Return the collected allocation statistics in the structure @var{T}.
+## The field @code{FunctionTable} is a structure array with one entry per
+## profiled function, containing the fields @code{FunctionName},
+## @code{AllocatedBytes} (bytes allocated directly in that function,
+## excluding its callees), and @code{NumCalls}.  The fields
+## @code{PeakBytes} and @code{CurrentBytes} give the peak and current
+## number of bytes held in array data over the whole session.
+## @seealso{profile, profshow}
+## @end table
+## @end deftypefn
+
+function retval = memprofile (arg)
+
+  if (nargin < 1)
+    print_usage ();
+  endif
+
+  switch (arg)
+    case "on"
+      __profiler_enable__ (true);
+
+    case "off"
+      __profiler_enable__ (false);
+
+    case "clear"
+      __profiler_reset__ ();
+
+    case "report"
+      [tbl, peak, current] = __profiler_memory_data__ ();
+      retval = struct ("FunctionTable", tbl, "PeakBytes", peak,
+                       "CurrentBytes", current);
+
+    otherwise
+      warning ("memprofile: Unrecognized option '%s'", arg);
+      print_usage ();
+
+  endswitch
+
+endfunction
+
+
+%!test
+%! memprofile ("on");
+%! A = rand (100);
+%! B = A * A';
+%! memprofile ("off");
+%! T = memprofile ("report");
+%! assert (isstruct (T));
+%! assert (fieldnames (T), {"FunctionTable"; "PeakBytes"; "CurrentBytes"});
+%! ftbl = T.FunctionTable;
+%! assert (fieldnames (ftbl), {"FunctionName"; "AllocatedBytes"; "NumCalls"});
+%! assert (T.PeakBytes >= T.CurrentBytes);
+%! memprofile ("clear");
+
+## Test input validation
+%!error <Invalid call> memprofile ()
+%!error memprofile ("INVALID_OPTION")
@@ -2,6 +2,7 @@ FCN_FILE_DIRS += %reldir%
 
 %canon_reldir%_FCN_FILES = \
   %reldir%/.oct-config \
+  %reldir%/memprofile.m \
   %reldir%/profexplore.m \
   %reldir%/profexport.m \
   %reldir%/profile.m \
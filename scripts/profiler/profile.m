@@ -28,8 +28,10 @@
 ## @deftypefnx {} {} profile off
 ## @deftypefnx {} {} profile resume
 ## @deftypefnx {} {} profile clear
+## @deftypefnx {} {} profile ("sample", @var{interval})
 ## @deftypefnx {} {@var{S} =} profile ("status")
 ## @deftypefnx {} {@var{T} =} profile ("info")
+## @deftypefnx {} {@var{F} =} profile ("folded")
 ## Control the built-in profiler.
 ##
 ## @table @code
@@ -47,6 +49,14 @@
 ## Restart profiling without clearing the old data.  All newly collected
 ## statistics are added to the existing ones.
 ##
+## @item profile ("sample", @var{interval})
+## Switch the profiler to sampling mode.  Instead of tracing every call,
+## the interpreter call stack is recorded approximately every
+## @var{interval} seconds, which has a fixed low cost and does not skew
+## hot call sites.  An @var{interval} of zero selects the default tracing
+## mode.  The mode can only be changed while the profiler is off.  Called
+## with just @qcode{"sample"}, return the current sampling interval.
+##
 ## @item @var{S} = profile ("status")
 ## Return a structure with information about the current status of the
 ## profiler.  At the moment, the only field is @code{ProfilerStatus} which is
@@ -61,16 +71,28 @@
 ## index into the @code{FunctionTable} identifying the function it corresponds
 ## to as well as data fields for number of calls and time spent at this level
 ## in the call tree.
+##
+## @item @var{F} = profile ("folded")
+## Return the call-stack samples collected in sampling mode as a structure
+## array with the fields @code{FoldedStack} (the semicolon-joined call
+## stack, outermost function first) and @code{NumSamples}.  Printing one
+## line per entry as @qcode{"@var{stack} @var{count}"} produces the folded
+## format consumed by flame graph tools.
 ## @seealso{profshow, profexplore}
 ## @end table
 ## @end deftypefn
 
-function retval = profile (arg)
+function retval = profile (arg, interval)
 
   if (nargin < 1)
     print_usage ();
   endif
 
+  ## Only the "sample" option takes a second argument.
+  if (nargin == 2 && ! strcmp (arg, "sample"))
+    print_usage ();
+  endif
+
   switch (arg)
     case "on"
       __profiler_enable__ (true);
@@ -84,6 +106,13 @@ function retval = profile (arg)
     case "resume"
       __profiler_enable__ (true);
 
+    case "sample"
+      if (nargin == 2)
+        __profiler_sample_interval__ (interval);
+      else
+        retval = __profiler_sample_interval__ ();
+      endif
+
     case "status"
       enabled = __profiler_enable__ ();
       if (enabled)
@@ -97,6 +126,9 @@ function retval = profile (arg)
       [flat, tree] = __profiler_data__ ();
       retval = struct ("FunctionTable", flat, "Hierarchical", tree);
 
+    case "folded"
+      retval = __profiler_folded_data__ ();
+
     otherwise
       warning ("profile: Unrecognized option '%s'", arg);
       print_usage ();
@@ -149,7 +181,18 @@ endfunction
 %! assert (size (hier), [0, 1]);
 %! assert (fieldnames (hier), {"Index"; "SelfTime"; "TotalTime"; "NumCalls"; "Children"});
 
+%!test
+%! assert (profile ("sample"), 0);
+%! profile ("sample", 0.01);
+%! assert (profile ("sample"), 0.01);
+%! folded = profile ("folded");
+%! assert (isstruct (folded));
+%! assert (fieldnames (folded), {"FoldedStack"; "NumSamples"});
+%! profile ("sample", 0);
+%! assert (profile ("sample"), 0);
+
 ## Test input validation
 %!error <Invalid call> profile ()
 %!error profile ("on", 2)
 %!error profile ("INVALID_OPTION")
+%!error profile ("sample", -1)
@@ -87,6 +87,22 @@ function [c, ia, ib] = intersect (a, b, varargin)
     isrowvec = isrow (a) && isrow (b);
   endif
 
+  ## Hash fast path: membership of A's elements in B avoids sorting
+  ## either full input; only the matching values reach unique.
+  if (nargout <= 1 && optsorted && ! by_rows && ! optlegacy
+      && (numel (a) > 8192 || numel (b) > 8192)
+      && ! issparse (a) && ! issparse (b)
+      && ((iscellstr (a) && iscellstr (b))
+          || (strcmp (class (a), class (b))
+              && (ischar (a) || (isfloat (a) && isreal (a) && isreal (b))))))
+    c = unique (a(ismember (a, b)));
+    c = c(:);
+    if (isrowvec)
+      c = c.';
+    endif
+    return;
+  endif
+
   ## Form A and B into sets
   if (nargout > 1 || ! optsorted)
     [a, ia] = unique (a, varargin{:});
@@ -286,3 +302,7 @@ endfunction
 %!assert (intersect ([], ['a', 'b']), "")
 %!assert (intersect ({}, []), {})
 %!assert (intersect (['a', 'b'], []), "")
+
+## Test the hash-based path taken for large input
+%!assert (intersect (mod (1e4:-1:1, 100), [5, 42, 150]), [5, 42])
+%!assert (intersect (mod (1e4:-1:1, 100)', [5, 42, 150]'), [5; 42])
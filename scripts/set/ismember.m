@@ -126,6 +126,24 @@ function [tf, s_idx] = ismember (a, s, varargin)
 
   if (! by_rows)
     s = s(:);
+
+    ## Hash join fast path: for a large unsorted table, building a hash
+    ## table over S is linear while the sort below is O(n log n).
+    if (numel (s) > 8192 && ! issparse (a) && ! issparse (s)
+        && ! issorted (s)
+        && ((iscellstr (a) && iscellstr (s))
+            || ((isinteger (a) || isinteger (s))
+                && strcmp (class (a), class (s)))
+            || ((isfloat (a) || ischar (a)) && (isfloat (s) || ischar (s))
+                && isreal (a) && isreal (s))))
+      if (nargout > 1)
+        [tf, s_idx] = __hash_ismember__ (a, s);
+      else
+        tf = __hash_ismember__ (a, s);
+      endif
+      return;
+    endif
+
     ## Check sort status, because we expect the array will often be sorted.
     if (issorted (s))
       is = [];
@@ -156,6 +174,12 @@ function [tf, s_idx] = ismember (a, s, varargin)
       if (rows (s) == 1)
         tf = all (bsxfun (@eq, a, s), 2);
         s_idx = double (tf);
+      elseif (! issparse (a) && ! issparse (s)
+              && isreal (a) && isreal (s)
+              && ! (isa (a, "int64") || isa (a, "uint64")
+                    || isa (s, "int64") || isa (s, "uint64")))
+        ## Hash the rows of S; linear and touches each row only once.
+        [tf, s_idx] = __hash_ismember__ (a, s, "rows");
       else
         ## FIXME: lookup does not support "rows", so we just use unique.
         [~, ii, jj] = unique ([a; s], "rows", "last");
@@ -308,3 +332,24 @@ endfunction
 %!error <Invalid call> ismember (1,2,3,4)
 %!error <"stable" or "sorted" are not valid options> ismember (1,2, "sorted")
 %!error <"stable" or "sorted" are not valid options> ismember (1,2, "stable")
+
+## Test the hash join path taken for large unsorted tables
+%!test
+%! s = [1e5:-1:1, 5e4](:);
+%! a = [0, 1, 5e4, 1e5, 17.5];
+%! [tf, s_idx] = ismember (a, s);
+%! assert (tf, logical ([0, 1, 1, 1, 0]));
+%! assert (s_idx, [0, 1e5, 5e4+1, 1, 0]);
+
+%!test
+%! s = int64 (1e5:-1:1)';
+%! [tf, s_idx] = ismember (int64 ([0, 3]), s);
+%! assert (tf, logical ([0, 1]));
+%! assert (s_idx, [0, 1e5-2]);
+
+%!test
+%! ## Complex values must stay on the sort path; the hash backend is
+%! ## real-only.
+%! s = (9000:-1:1) + 1i * (1:9000);
+%! assert (ismember (s(17), s), true);
+%! assert (ismember (complex (0, 0), s), false);
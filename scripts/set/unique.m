@@ -186,6 +186,23 @@ function [y, i, j] = unique (x, varargin)
     return;
   endif
 
+  ## Hash-based fast path: collect the distinct values in linear time so
+  ## that only those need sorting.  Covers the plain unique(x) call; the
+  ## index outputs still require the full sort below.
+  if (nargout <= 1 && optsorted && ! optrows && ! optlegacy
+      && n > 8192 && ! issparse (x) && ! iscomplex (x)
+      && (isnumeric (x) || ischar (x) || islogical (x) || iscellstr (x))
+      && ! issorted (x(:)))
+    y = __hash_unique__ (x);
+    if (! iscellstr (x) && ! strcmp (class (y), class (x)))
+      y = cast (y, class (x));
+    endif
+    if (isrowvec)
+      y = y.';
+    endif
+    return;
+  endif
+
   ## Calculate y output
   if (optrows)
     if (nargout > 1 || ! optsorted)
@@ -379,3 +396,8 @@ endfunction
 %!warning <third output J is not yet implemented>
 %! [y,i,j] = unique ([2,1], "stable");
 %! assert (j, []);
+
+## Test the hash-based path taken for large unsorted input
+%!assert (unique ([mod(1e4:-1:1, 37), NaN, -0, NaN]), [0:36, NaN, NaN])
+%!assert (unique (single (mod (9000:-1:1, 10))), single (0:9))
+%!assert (unique (uint16 (mod (9000:-1:1, 10))'), uint16 (0:9)')
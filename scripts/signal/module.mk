@@ -34,6 +34,7 @@ FCN_FILE_DIRS += \
   %reldir%/ifftshift.m \
   %reldir%/movfun.m \
   %reldir%/movslice.m \
+  %reldir%/nufft.m \
   %reldir%/periodogram.m \
   %reldir%/sinc.m \
   %reldir%/sinetone.m \
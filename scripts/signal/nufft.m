@@ -0,0 +1,180 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn  {} {@var{y} =} nufft (@var{x}, @var{t})
+## @deftypefnx {} {@var{y} =} nufft (@var{x}, @var{t}, @var{f})
+## @deftypefnx {} {@var{y} =} nufft (@var{x}, @var{t}, @var{f}, @var{dim})
+## Compute the nonuniform discrete Fourier transform of @var{x} sampled
+## at the points @var{t}, evaluated at the frequencies @var{f}.
+##
+## The transform is defined as
+##
+## @example
+## @group
+## @var{y}(k) = SUM_j @var{x}(j) * exp (-2*pi*i * @var{t}(j) * @var{f}(k))
+## @end group
+## @end example
+##
+## @noindent
+## so for the equispaced defaults @code{@var{t} = 0:@var{n}-1} and
+## @code{@var{f} = (0:@var{n}-1)/@var{n}} it reduces to @code{fft (@var{x})}.
+## Either or both of @var{t} and @var{f} may be given as an empty matrix
+## to select the default.
+##
+## The number of sample points must match the length of @var{x}; the
+## number of frequencies is free, so the spectrum of an irregularly
+## sampled signal can be evaluated directly on any frequency grid
+## without first interpolating the signal onto a uniform grid.
+##
+## If @var{x} is a matrix or N-dimensional array, the transform is
+## applied along the first non-singleton dimension, or along @var{dim}
+## if given.
+##
+## The evaluation is blocked so that the matrix of complex exponentials
+## never exceeds a few megabytes, and each block is a single
+## matrix-matrix product.
+## @seealso{fft, stft, periodogram}
+## @end deftypefn
+
+function y = nufft (x, t = [], f = [], dim = [])
+
+  if (nargin < 1)
+    print_usage ();
+  endif
+
+  if (! (isnumeric (x) || islogical (x)))
+    error ("nufft: X must be numeric");
+  endif
+
+  if (! isempty (t) && ! (isnumeric (t) && isvector (t) && isreal (t)))
+    error ("nufft: T must be a real vector");
+  endif
+
+  if (! isempty (f) && ! (isnumeric (f) && isvector (f) && isreal (f)))
+    error ("nufft: F must be a real vector");
+  endif
+
+  if (isempty (dim))
+    dim = find (size (x) != 1, 1);
+    if (isempty (dim))
+      dim = 1;
+    endif
+  elseif (! (isscalar (dim) && dim == fix (dim) && dim >= 1))
+    error ("nufft: DIM must be a positive integer");
+  endif
+
+  n = size (x, dim);
+
+  if (isempty (t) && isempty (f))
+    ## Equispaced samples and frequencies: this is the ordinary DFT.
+    y = fft (x, [], dim);
+    return;
+  endif
+
+  if (isempty (t))
+    t = (0:n-1).';
+  else
+    t = t(:);
+    if (numel (t) != n)
+      error ("nufft: T must have one sample point per element of X along DIM");
+    endif
+  endif
+
+  if (isempty (f))
+    f = ((0:n-1) / n).';
+  else
+    f = f(:);
+  endif
+
+  m = numel (f);
+
+  if (isa (x, "single") || isa (t, "single") || isa (f, "single"))
+    t = single (t);
+    f = single (f);
+  else
+    t = double (t);
+    f = double (f);
+  endif
+
+  ## Work on columns of a 2-D view with DIM first.
+  nd = max (ndims (x), dim);
+  perm = [dim, 1:dim-1, dim+1:nd];
+  x = permute (x, perm);
+  sz = size (x);
+  x = reshape (x, n, []);
+
+  y = complex (zeros (m, columns (x), class (t)));
+
+  ## Evaluate the transform in blocks of frequencies so that the matrix
+  ## of complex exponentials stays small; each block is one GEMM.
+  blk = max (1, floor (2^20 / max (n, 1)));
+  for b = 1:blk:m
+    k = b : min (b+blk-1, m);
+    y(k,:) = exp ((-2i * pi) * (f(k) * t.')) * x;
+  endfor
+
+  sz(1) = m;
+  y = ipermute (reshape (y, sz), perm);
+
+endfunction
+
+
+%!testif HAVE_FFTW
+%! x = rand (8, 1);
+%! assert (nufft (x, 0:7), fft (x), 100*eps);
+%! assert (nufft (x, [], []), fft (x), 100*eps);
+
+%!test
+%! t = sort (rand (6, 1));
+%! f = linspace (-3, 3, 11);
+%! x = rand (6, 1) + 1i * rand (6, 1);
+%! y0 = zeros (11, 1);
+%! for k = 1:11
+%!   y0(k) = sum (x .* exp (-2i * pi * t * f(k)));
+%! endfor
+%! assert (nufft (x, t, f), y0, 100*eps);
+
+%!test
+%! ## DIM argument and matrix input
+%! t = [0; 0.3; 1.1; 2];
+%! x = rand (4, 3);
+%! y = nufft (x, t);
+%! for j = 1:3
+%!   assert (nufft (x(:,j), t), y(:,j), 100*eps);
+%! endfor
+%! assert (nufft (x.', t, [], 2), y.', 100*eps);
+
+%!test
+%! y = nufft (single ([1 2 3 4]), single ([0 1 2 3]));
+%! assert (class (y), "single");
+%! assert (y, single (fft ([1 2 3 4])), 10*eps ("single"));
+
+## Test input validation
+%!error <Invalid call> nufft ()
+%!error <X must be numeric> nufft ("abc", 1:3)
+%!error <T must be a real vector> nufft (1:3, ones (2))
+%!error <one sample point per element> nufft (1:4, 1:3)
+%!error <DIM must be a positive integer> nufft (1:4, 1:4, [], 1.5)
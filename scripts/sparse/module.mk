@@ -23,6 +23,7 @@ FCN_FILE_DIRS += \
   %reldir%/pcg.m \
   %reldir%/pcr.m \
   %reldir%/qmr.m \
+  %reldir%/sparse_builder.m \
   %reldir%/spaugment.m \
   %reldir%/spconvert.m \
   %reldir%/spdiags.m \
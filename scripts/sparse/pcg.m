@@ -272,6 +272,21 @@ function [x_min, flag, relres, iter_min, resvec, eigest] =...
     warning ("Input tol may not be achievable by pcg. \n Try to use a bigger tolerance");
   endif
 
+  ## The common case of a real sparse matrix without preconditioning is
+  ## handled by a compiled kernel that follows this loop step for step,
+  ## avoiding the interpreter overhead around each matrix-vector
+  ## product.  The eigenvalue estimate still needs the interpreted loop.
+
+  if (nargout >= 2 && nargout <= 5
+      && issparse (A) && isreal (A) && ! islogical (A)
+      && iscolumn (b) && isreal (b) && ! issparse (b)
+      && isempty (M1) && isempty (M2) && isempty (varargin)
+      && iscolumn (x0) && isreal (x0) && ! issparse (x0))
+    [x_min, flag, relres, iter_min, resvec] = __pcg__ (A, b, tol, maxit, x0);
+    eigest = [NaN, NaN];
+    return;
+  endif
+
   ## Check if the input data A,b,m1,m2 are consistent (i.e. if they are
   ## matrix or function handle)
 
@@ -0,0 +1,228 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+classdef sparse_builder < handle
+
+  ## -*- texinfo -*-
+  ## @deftypefn  {} {@var{b} =} sparse_builder (@var{m}, @var{n})
+  ## @deftypefnx {} {@var{b} =} sparse_builder (@var{m}, @var{n}, @var{nzmax})
+  ## Assemble a sparse matrix incrementally from triplets.
+  ##
+  ## Assigning individual elements of a sparse matrix inside a loop
+  ## (@code{@var{s}(@var{i},@var{j}) = @var{v}}) rebuilds the compressed
+  ## column form on every insertion, so each assignment costs time
+  ## proportional to the number of stored elements.  A
+  ## @code{sparse_builder} instead queues the triplets in amortized
+  ## constant time per entry and builds the compressed form once:
+  ##
+  ## @example
+  ## @group
+  ## b = sparse_builder (ndof, ndof);
+  ## for e = 1:nelem
+  ##   insert (b, dof(e,:), dof(e,:), ke);
+  ## endfor
+  ## s = sparse (b);
+  ## @end group
+  ## @end example
+  ##
+  ## @code{sparse_builder} is a handle class, so @code{insert} updates
+  ## @var{b} in place.  As with @code{sparse}, entries queued for the
+  ## same position are added together when the matrix is built.  The
+  ## optional argument @var{nzmax} preallocates space for that many
+  ## entries; the buffers grow automatically as needed.
+  ## @seealso{sparse, spalloc, spconvert, accumarray}
+  ## @end deftypefn
+
+  properties (Access = private)
+    rows = 0;
+    cols = 0;
+    ridx = [];
+    cidx = [];
+    data = [];
+    nent = 0;
+  endproperties
+
+  methods
+
+    function b = sparse_builder (m, n, nzmax)
+
+      if (nargin < 2)
+        print_usage ();
+      endif
+
+      if (! (isscalar (m) && isscalar (n) && m >= 0 && n >= 0
+             && m == fix (m) && n == fix (n)))
+        error ("sparse_builder: M and N must be non-negative integers");
+      endif
+
+      if (nargin < 3)
+        nzmax = 16;
+      elseif (! (isscalar (nzmax) && nzmax >= 0 && nzmax == fix (nzmax)))
+        error ("sparse_builder: NZMAX must be a non-negative integer");
+      endif
+
+      b.rows = m;
+      b.cols = n;
+      b.ridx = zeros (max (nzmax, 1), 1);
+      b.cidx = zeros (max (nzmax, 1), 1);
+      b.data = zeros (max (nzmax, 1), 1);
+      b.nent = 0;
+
+    endfunction
+
+    function insert (b, i, j, v)
+
+      ## Queue the triplets (I, J, V).  Each argument may be a scalar or
+      ## an array; non-scalar arguments must have the same number of
+      ## elements.
+
+      if (nargin != 4)
+        print_usage ();
+      endif
+
+      i = i(:);
+      j = j(:);
+      v = v(:);
+
+      n = max ([numel(i), numel(j), numel(v)]);
+
+      if ((numel (i) != n && ! isscalar (i))
+          || (numel (j) != n && ! isscalar (j))
+          || (numel (v) != n && ! isscalar (v)))
+        error ("sparse_builder: I, J, and V must be scalars or have the same number of elements");
+      endif
+
+      if (any (i < 1) || any (i > b.rows) || any (j < 1) || any (j > b.cols))
+        error ("sparse_builder: index out of bound");
+      endif
+
+      if (n == 0)
+        return;
+      endif
+
+      need = b.nent + n;
+      cap = numel (b.data);
+      if (need > cap)
+        ## Amortized doubling; indexed assignment past the end zero-fills.
+        cap = max (2*cap, need);
+        b.ridx(cap, 1) = 0;
+        b.cidx(cap, 1) = 0;
+        b.data(cap, 1) = 0;
+      endif
+
+      k = b.nent + (1:n);
+      b.ridx(k) = i;
+      b.cidx(k) = j;
+      b.data(k) = v;
+      b.nent = need;
+
+    endfunction
+
+    function s = sparse (b)
+
+      ## Build the compressed column matrix from the queued triplets.
+      ## The builder is left unchanged and may continue to accumulate.
+
+      k = 1:b.nent;
+      s = sparse (b.ridx(k), b.cidx(k), b.data(k), b.rows, b.cols);
+
+    endfunction
+
+    function varargout = size (b, dim)
+
+      if (nargin > 1)
+        if (! (isscalar (dim) && dim >= 1 && dim == fix (dim)))
+          error ("size: requested dimension DIM out of range");
+        endif
+        if (dim == 1)
+          varargout{1} = b.rows;
+        elseif (dim == 2)
+          varargout{1} = b.cols;
+        else
+          varargout{1} = 1;
+        endif
+      elseif (nargout <= 1)
+        varargout{1} = [b.rows, b.cols];
+      else
+        varargout{1} = b.rows;
+        varargout{2} = b.cols;
+        varargout(3:nargout) = {1};
+      endif
+
+    endfunction
+
+    function disp (b)
+      printf ("  sparse_builder: %d x %d, %d queued entries\n",
+              b.rows, b.cols, b.nent);
+    endfunction
+
+  endmethods
+
+endclassdef
+
+
+%!test
+%! b = sparse_builder (5, 4);
+%! insert (b, 1, 1, 2);
+%! insert (b, [2 3], [2 3], [4 5]);
+%! insert (b, 1, 1, 3);
+%! s = sparse (b);
+%! assert (s, sparse ([1 2 3 1], [1 2 3 1], [2 4 5 3], 5, 4));
+%! assert (nnz (s), 3);
+
+%!test
+%! ## buffer growth past the default capacity
+%! b = sparse_builder (10, 10, 4);
+%! for k = 1:100
+%!   insert (b, mod (k-1, 10) + 1, mod (7*k, 10) + 1, k);
+%! endfor
+%! i = mod ((1:100)-1, 10) + 1;
+%! j = mod (7*(1:100), 10) + 1;
+%! assert (sparse (b), sparse (i, j, 1:100, 10, 10));
+
+%!test
+%! ## scalar expansion, block insertion, and incremental reuse
+%! b = sparse_builder (6, 6);
+%! insert (b, 1:3, 2, 7);
+%! s1 = sparse (b);
+%! assert (s1, sparse (1:3, 2, 7, 6, 6));
+%! insert (b, 4, 1:2, [1 2]);
+%! assert (sparse (b), s1 + sparse ([4 4], [1 2], [1 2], 6, 6));
+%! assert (size (b), [6, 6]);
+
+%!test
+%! b = sparse_builder (3, 3);
+%! assert (sparse (b), sparse (3, 3));
+%! insert (b, 2, 2, 1 + 2i);
+%! assert (sparse (b), sparse (2, 2, 1 + 2i, 3, 3));
+
+%!error sparse_builder ()
+%!error <non-negative integers> sparse_builder (-1, 2)
+%!error <out of bound>
+%! b = sparse_builder (2, 2);
+%! insert (b, 3, 1, 1);
+%!error <same number of elements>
+%! b = sparse_builder (5, 5);
+%! insert (b, [1 2], [1 2 3], 1);
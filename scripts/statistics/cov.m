@@ -74,7 +74,7 @@
 ## @var{x} and @var{y} are equal.  This will result in a 2x2 matrix.
 ## Code relying on @sc{matlab}'s definition will need to be changed when
 ## running in Octave.
-## @seealso{corr}
+## @seealso{corr, streamcov}
 ## @end deftypefn
 
 function c = cov (x, y = [], opt = 0)
@@ -143,6 +143,19 @@ function [n, idx] = histc (x, edges, dim)
 
   else
 
+    if (isvector (x) && ! issparse (x)
+        && isa (x, "double") && isa (edges, "double"))
+      ## Compiled counting engine for the common vector case, with a
+      ## uniform-bin fast path and parallel per-thread count arrays.
+      if (nargout > 1)
+        [n, idx] = __histc__ (x, edges);
+      else
+        n = __histc__ (x, edges);
+      endif
+      n = reshape (n, nsz);
+      return;
+    endif
+
     ## This is the O(M*log(N) + N) algorithm.
 
     ## Look-up indices.
@@ -313,7 +313,17 @@ function m = median (x, varargin)
     omitnan = false;
   endif
 
-  x = sort (x, dim); # Note: pushes any NaN's to end for omitnan compatibility
+  n = szx(dim);
+  k = floor ((n + 1) / 2);
+
+  if (! omitnan && isnumeric (x) && n > 1000)
+    ## Large arrays: only the one or two middle order statistics are
+    ## needed, so partial selection replaces the full sort.
+    x = nth_element (x, k : k + ! mod (n, 2), dim);
+    k = 1;
+  else
+    x = sort (x, dim); # Note: pushes any NaN's to end for omitnan compatibility
+  endif
 
   if (omitnan)
     ## Ignore any NaN's in data.  Each operating vector might have a
@@ -365,9 +375,6 @@ function m = median (x, varargin)
 
     else
       if (isvector (x))
-        n = numel (x);
-        k = floor ((n + 1) / 2);
-
         m = x(k);
         if (! mod (n, 2))
           ## Even
@@ -387,9 +394,6 @@ function m = median (x, varargin)
 
       else
         ## Nonvector, all operations were permuted to be along dim 1
-        n = szx(1);
-        k = floor ((n + 1) / 2);
-
         if (isfloat (x))
           m = NaN ([1, szx(2 : end)]);
         else
@@ -671,6 +675,22 @@ endfunction
 %!assert <*54567> (median ([intmax("uint64"), intmax("uint64")-2], "native"), ...
 %!  intmax("uint64")-1)
 
+## Test selection path used for large arrays
+%!test
+%! x = randperm (2001);
+%! assert (median (x), 1001);
+%! assert (median (x(1:2000)), mean (sort (x(1:2000))(1000:1001)));
+%!test
+%! x = rand (1500, 3);
+%! xs = sort (x, 1);
+%! assert (median (x, 1), (xs(750,:) + xs(751,:)) / 2);
+%! x(1, 2) = NaN;
+%! assert (median (x, 1)(2), NaN);
+%!test
+%! x = int32 (randperm (4001));
+%! assert (median (x), int32 (2001));
+%! assert (class (median (x)), "int32");
+
 ## Test input case insensitivity
 %!assert (median ([1 2 3], "aLL"), 2)
 %!assert (median ([1 2 3], "OmitNan"), 2)
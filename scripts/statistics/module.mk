@@ -45,6 +45,7 @@ FCN_FILE_DIRS += %reldir%
   %reldir%/spearman.m \
   %reldir%/statistics.m \
   %reldir%/std.m \
+  %reldir%/streamcov.m \
   %reldir%/var.m \
   %reldir%/zscore.m
 
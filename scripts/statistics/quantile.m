@@ -386,6 +386,15 @@ endfunction
 %!assert <*54421> (quantile ([1:10], [0.25, 0.75]'), [3; 8])
 %!assert (quantile ([1:10], 1, 3), [1:10])
 
+## Test selection path used for large samples: probing 0 and 1 widens the
+## order-statistic band to the whole sample, which forces the sort path.
+%!test
+%! x = rand (5001, 2);
+%! p = [0.1, 0.25, 0.5, 0.9];
+%! for m = 1:9
+%!   assert (quantile (x, p, 1, m), quantile (x, [p, 0, 1], 1, m)(1:4,:));
+%! endfor
+
 ## Test input validation
 %!error <Invalid call> quantile ()
 %!error quantile (['A'; 'B'], 10)
@@ -418,8 +427,28 @@ function inv = __quantile__ (x, p, method = 5)
   p = p(:);
 
   ## Save length and set shape of samples.
-  x = sort (x, 1);
-  m = sum (! isnan (x));
+  xr0 = size (x, 1);
+  sel_off = 0;
+  pb = p((p >= 0) & (p <= 1));
+  if (xr0 > 1000 && ! isempty (pb) && ! any (isnan (x(:))))
+    ## Large NaN-free samples only need a contiguous band of order
+    ## statistics around the requested probabilities, so partial
+    ## selection replaces the full sort.  The band bounds cover the
+    ## index formulas of every interpolation method below.
+    kmin = max (floor (min (pb) * (xr0 + 1)) - 1, 1);
+    kmax = min (ceil (max (pb) * (xr0 + 1)) + 2, xr0);
+    if (2 * (kmax - kmin + 1) < xr0)
+      x = nth_element (x, kmin:kmax, 1);
+      sel_off = kmin - 1;
+    endif
+  endif
+  if (sel_off)
+    ## Order statistic k of the sample is row k - sel_off of the band.
+    m = repmat (xr0, 1, size (x, 2));
+  else
+    x = sort (x, 1);
+    m = sum (! isnan (x));
+  endif
   [xr, xc] = size (x);
 
   ## Initialize output values.
@@ -444,20 +473,20 @@ function inv = __quantile__ (x, p, method = 5)
         switch (method)
           case 1
             p = max (ceil (kron (p, m)), 1);
-            inv(k,:) = x(p + pcd);
+            inv(k,:) = x(p - sel_off + pcd);
 
           case 2
             p = kron (p, m);
             p_lr = max (ceil (p), 1);
             p_rl = min (floor (p + 1), mm);
-            inv(k,:) = (x(p_lr + pcd) + x(p_rl + pcd))/2;
+            inv(k,:) = (x(p_lr - sel_off + pcd) + x(p_rl - sel_off + pcd))/2;
 
           case 3
            ## Used by SAS, method PCTLDEF=2.
            ## http://support.sas.com/onlinedoc/913/getDoc/en/statug.hlp/stdize_sect14.htm
             t = max (kron (p, m), 1);
             t = roundb (t);
-            inv(k,:) = x(t + pcd);
+            inv(k,:) = x(t - sel_off + pcd);
         endswitch
 
       otherwise
@@ -496,7 +525,7 @@ function inv = __quantile__ (x, p, method = 5)
         ## Interval indices.
         pi = max (min (floor (p), mm-1), 1);
         pr = max (min (p - pi, 1), 0);
-        pi += pcd;
+        pi += pcd - sel_off;
         inv(k,:) = (1-pr) .* x(pi) + pr .* x(pi+1);
     endswitch
   endif
@@ -0,0 +1,176 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {@var{acc} =} streamcov ()
+## Accumulate the mean and covariance of a data set fed in blocks of
+## observations.
+##
+## A @code{streamcov} object computes the same result as @code{cov} and
+## @code{mean} applied to the vertical concatenation of all blocks, but
+## only ever holds one block and the running @math{N \times N}
+## accumulators in memory, so the data set may be far larger than RAM.
+##
+## Each call to the @code{update} method adds a block of observations
+## (one observation per row, one variable per column).  The running
+## estimates are available at any time from the @code{mean} and
+## @code{cov} methods; like @code{cov}, the latter takes an optional
+## normalization argument @var{opt} that defaults to 0 (normalize by
+## the number of observations minus one).
+##
+## Example: covariance of a data set read in chunks
+##
+## @example
+## @group
+## acc = streamcov ();
+## while (! feof (fid))
+##   acc.update (fscanf (fid, "%f", [nvar, chunk]).');
+## endwhile
+## c = acc.cov ();
+## @end group
+## @end example
+##
+## Within one block the centered cross product is a single matrix-matrix
+## multiplication, and blocks are merged with the pairwise update of
+## @nospell{Chan, Golub, and LeVeque}, which stays accurate when the
+## mean is large compared to the spread of the data.
+## @seealso{cov, mean, var}
+## @end deftypefn
+
+classdef streamcov < handle
+
+  properties (SetAccess = private)
+    ## Number of observations accumulated so far.
+    count = 0;
+    ## Running mean of the observations (row vector).
+    center = [];
+    ## Sum of squares of the centered observations.
+    comoment = [];
+  endproperties
+
+  methods
+
+    function update (acc, x)
+
+      if (! (isnumeric (x) || islogical (x)) || ndims (x) != 2)
+        error ("streamcov: X must be a numeric matrix or vector");
+      endif
+
+      ## Unlike cov, a row vector is a single observation here, so that
+      ## blocks of any height down to one row accumulate consistently.
+
+      nb = rows (x);
+
+      if (nb == 0)
+        return;
+      endif
+
+      mub = sum (x, 1) / nb;
+      xc = x - mub;
+      cb = xc' * xc;
+
+      if (acc.count == 0)
+        acc.count = nb;
+        acc.center = mub;
+        acc.comoment = cb;
+      else
+        if (columns (x) != columns (acc.center))
+          error ("streamcov: X must have %d columns like previous blocks",
+                 columns (acc.center));
+        endif
+
+        n = acc.count;
+        ntot = n + nb;
+        delta = mub - acc.center;
+
+        acc.comoment += cb + (n * nb / ntot) * (delta' * delta);
+        acc.center += (nb / ntot) * delta;
+        acc.count = ntot;
+      endif
+
+    endfunction
+
+    function m = mean (acc)
+
+      if (acc.count == 0)
+        error ("streamcov: no observations accumulated yet");
+      endif
+
+      m = acc.center;
+
+    endfunction
+
+    function c = cov (acc, opt = 0)
+
+      if (acc.count == 0)
+        error ("streamcov: no observations accumulated yet");
+      endif
+
+      if (opt != 0 && opt != 1)
+        error ("streamcov: normalization OPT must be 0 or 1");
+      endif
+
+      c = acc.comoment / (acc.count - 1 + opt);
+
+    endfunction
+
+  endmethods
+
+endclassdef
+
+
+%!test
+%! x = reshape (1:12, 4, 3) .^ 2;
+%! acc = streamcov ();
+%! acc.update (x(1:2,:));
+%! acc.update (x(3,:));
+%! acc.update (x(4,:));
+%! assert (acc.mean (), mean (x), 1e-12);
+%! assert (acc.cov (), cov (x), 1e-10);
+%! assert (acc.cov (1), cov (x, 1), 1e-10);
+
+%!test
+%! ## large offset exercises the numerical quality of the merge
+%! x = 1e9 + [1 2; 4 3; 2 2; 3 1];
+%! acc = streamcov ();
+%! acc.update (x(1:3,:));
+%! acc.update (x(4,:));
+%! assert (acc.cov (), cov (x), 1e-6);
+
+%!test
+%! ## vector observations fed as rows
+%! acc = streamcov ();
+%! acc.update ([1 2 3]);
+%! acc.update ([4 6 8]);
+%! assert (acc.mean (), [2.5 4 5.5]);
+%! assert (acc.cov (), cov ([1 2 3; 4 6 8]), 1e-12);
+
+%!error <no observations accumulated>
+%! acc = streamcov ();
+%! acc.cov ();
+%!error <must have 2 columns>
+%! acc = streamcov ();
+%! acc.update (ones (2));
+%! acc.update (ones (2, 3));
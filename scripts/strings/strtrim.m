@@ -72,7 +72,7 @@ function s = strtrim (s)
 
     ## Divide work load.  Recursive cellfun strtrim call is slow
     ## and avoided where possible.
-    s(char_idx) = regexprep (s(char_idx), "^[\\s\v]+|[\\s\v]+$", '');
+    s(char_idx) = __strtrim_cellstr__ (s(char_idx));
     s(cell_idx) = cellfun ("strtrim", s(cell_idx), "UniformOutput", false);
 
   else
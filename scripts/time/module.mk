@@ -15,6 +15,7 @@ FCN_FILE_DIRS += %reldir%
   %reldir%/etime.m \
   %reldir%/is_leap_year.m \
   %reldir%/now.m \
+  %reldir%/timeit.m \
   %reldir%/weekday.m
 
 %canon_reldir%dir = $(fcnfiledir)/time
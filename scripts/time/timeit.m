@@ -0,0 +1,169 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn  {} {@var{t} =} timeit (@var{f})
+## @deftypefnx {} {@var{t} =} timeit (@var{f}, @var{num_outputs})
+## @deftypefnx {} {[@var{t}, @var{details}] =} timeit (@dots{})
+## Measure the typical time required to run the function handle @var{f}.
+##
+## The function is called several times after a warm-up phase, with each
+## sample repeating the call often enough to be reliably measurable.  The
+## returned time @var{t} is the median time for one call, in seconds, with
+## the overhead of calling an empty function handle subtracted.
+##
+## If @var{num_outputs} is given, the function is called requesting that
+## many output arguments; the default is none.
+##
+## The optional output @var{details} is a structure with the fields
+##
+## @table @code
+## @item Samples
+## The vector of per-call times measured, without overhead correction.
+##
+## @item Median
+## The median of @code{Samples}.
+##
+## @item MAD
+## The median absolute deviation of @code{Samples}, a robust measure of
+## how noisy the measurement was.
+##
+## @item Overhead
+## The estimated per-call overhead that was subtracted.
+##
+## @item InnerIterations
+## The number of calls made per sample.
+## @end table
+##
+## @seealso{tic, toc, cputime}
+## @end deftypefn
+
+function [t, details] = timeit (f, num_outputs)
+
+  if (nargin < 1)
+    print_usage ();
+  endif
+
+  if (! is_function_handle (f))
+    error ("timeit: F must be a function handle");
+  endif
+
+  if (nargin < 2)
+    num_outputs = 0;
+  elseif (! (isnumeric (num_outputs) && isscalar (num_outputs)
+             && num_outputs >= 0 && num_outputs == fix (num_outputs)))
+    error ("timeit: NUM_OUTPUTS must be a non-negative integer");
+  endif
+
+  ## Warm up caches, the JIT-less evaluator's lookup paths, and any
+  ## first-call initialization inside F itself.
+  call_fcn (f, num_outputs, 2);
+
+  ## Find a repetition count large enough that one sample is comfortably
+  ## above the timer granularity.
+  min_sample_time = 1e-3;
+  n = 1;
+  while (true)
+    id = tic ();
+    call_fcn (f, num_outputs, n);
+    elapsed = toc (id);
+    if (elapsed >= min_sample_time || n >= 2^30)
+      break;
+    endif
+    if (elapsed <= 0.1 * min_sample_time)
+      n *= 10;
+    else
+      n *= 2;
+    endif
+  endwhile
+
+  num_samples = 11;
+  samples = zeros (num_samples, 1);
+  for i = 1:num_samples
+    id = tic ();
+    call_fcn (f, num_outputs, n);
+    samples(i) = toc (id) / n;
+  endfor
+
+  ## Estimate the cost of the measurement loop and the function-handle
+  ## dispatch itself with an empty handle, and subtract it.
+  empty_fcn = @() [];
+  overhead_samples = zeros (num_samples, 1);
+  for i = 1:num_samples
+    id = tic ();
+    call_fcn (empty_fcn, 0, n);
+    overhead_samples(i) = toc (id) / n;
+  endfor
+
+  med = median (samples);
+  overhead = median (overhead_samples);
+
+  t = max (med - overhead, 0);
+
+  if (nargout > 1)
+    details = struct ("Samples", samples,
+                      "Median", med,
+                      "MAD", median (abs (samples - med)),
+                      "Overhead", overhead,
+                      "InnerIterations", n);
+  endif
+
+endfunction
+
+function call_fcn (f, num_outputs, reps)
+
+  if (num_outputs == 0)
+    for k = 1:reps
+      f ();
+    endfor
+  else
+    outputs = cell (1, num_outputs);
+    for k = 1:reps
+      [outputs{1:num_outputs}] = f ();
+    endfor
+  endif
+
+endfunction
+
+
+%!test
+%! t = timeit (@() sin (pi / 4));
+%! assert (isscalar (t) && isreal (t));
+%! assert (t >= 0);
+
+%!test
+%! [t, details] = timeit (@() rand (10), 1);
+%! assert (t >= 0);
+%! assert (fieldnames (details),
+%!         {"Samples"; "Median"; "MAD"; "Overhead"; "InnerIterations"});
+%! assert (numel (details.Samples), 11);
+%! assert (details.InnerIterations >= 1);
+%! assert (details.MAD >= 0);
+
+## Test input validation
+%!error <Invalid call> timeit ()
+%!error <F must be a function handle> timeit (1)
+%!error <NUM_OUTPUTS must be a non-negative integer> timeit (@sin, -1)
+%!error <NUM_OUTPUTS must be a non-negative integer> timeit (@sin, 1.5)
@@ -0,0 +1,118 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## Default values
+
+%!function r = f_default (x)
+%!  arguments
+%!    x = 42
+%!  endarguments
+%!  r = x;
+%!endfunction
+%!assert (f_default (), 42)
+%!assert (f_default (7), 7)
+
+## Defaults may reference earlier arguments
+
+%!function r = f_default_ref (a, b)
+%!  arguments
+%!    a
+%!    b = 2 * a
+%!  endarguments
+%!  r = b;
+%!endfunction
+%!assert (f_default_ref (3), 6)
+%!assert (f_default_ref (3, 10), 10)
+
+## Missing argument without a default
+
+%!function f_missing (x)
+%!  arguments
+%!    x
+%!  endarguments
+%!endfunction
+%!error <not enough input arguments> f_missing ()
+
+## Class checks and conversion
+
+%!function r = f_class (x)
+%!  arguments
+%!    x double
+%!  endarguments
+%!  r = x;
+%!endfunction
+%!assert (f_class (pi), pi)
+%!assert (f_class (int8 (3)), 3)
+%!assert (class (f_class (int8 (3))), "double")
+%!error <must be of class double> f_class ({1})
+
+## Size checks, including vector reorientation
+
+%!function r = f_size (x)
+%!  arguments
+%!    x (1, :)
+%!  endarguments
+%!  r = x;
+%!endfunction
+%!assert (f_size ([1, 2, 3]), [1, 2, 3])
+%!assert (f_size ([1; 2; 3]), [1, 2, 3])
+%!assert (f_size (5), 5)
+%!error <must be of size 1x:> f_size (magic (3))
+
+## Validation functions, by name and as call expressions
+
+%!function f_valid (x)
+%!  arguments
+%!    x (1, 1) double {mustBePositive}
+%!  endarguments
+%!endfunction
+%!test
+%! f_valid (3);
+%!error <positive> f_valid (-1)
+%!error <must be of size 1x1> f_valid ([1, 2])
+
+%!function f_valid_expr (x)
+%!  arguments
+%!    x {mustBeGreaterThan(x, 10)}
+%!  endarguments
+%!endfunction
+%!test
+%! f_valid_expr (11);
+%!error <greater than> f_valid_expr (5)
+
+## Repeated calls reuse the compiled spec
+
+%!function r = f_loop (x)
+%!  arguments
+%!    x (1, 1) double {mustBeFinite}
+%!  endarguments
+%!  r = x + 1;
+%!endfunction
+%!test
+%! s = 0;
+%! for i = 1:100
+%!   s += f_loop (i);
+%! endfor
+%! assert (s, sum (2:101));
@@ -0,0 +1,43 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## Element-wise operations (the mx-inlines kernels).
+
+function cases = bench_elementwise ()
+
+  a = rand (2000);
+  b = rand (2000);
+  c = rand (2000);
+
+  cases = {
+    "add 2000x2000", @() a + b;
+    "multiply 2000x2000", @() a .* b;
+    "chain a.*b + c.*a - b", @() a .* b + c .* a - b;
+    "compare a < b", @() a < b;
+    "scalar multiply", @() pi * a;
+    "broadcast row + matrix", @() a + b(1, :);
+  };
+
+endfunction
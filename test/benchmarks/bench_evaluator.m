@@ -0,0 +1,87 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## The evaluator loop itself: scalar arithmetic, function calls, and
+## control flow with negligible array work per statement.
+
+function cases = bench_evaluator ()
+
+  cases = {
+    "scalar for loop 1e5", @() scalar_loop (1e5);
+    "while loop 1e5", @() while_loop (1e5);
+    "function call 1e4", @() call_loop (1e4);
+    "recursion depth 400", @() recurse (400);
+    "if/else chain 1e5", @() branch_loop (1e5);
+  };
+
+endfunction
+
+function s = scalar_loop (n)
+  s = 0;
+  for i = 1:n
+    s += i * 2 - 1;
+  endfor
+endfunction
+
+function s = while_loop (n)
+  s = 0;
+  i = 0;
+  while (i < n)
+    i += 1;
+    s += i;
+  endwhile
+endfunction
+
+function s = call_loop (n)
+  s = 0;
+  for i = 1:n
+    s += tiny_helper (i);
+  endfor
+endfunction
+
+function y = tiny_helper (x)
+  y = x + 1;
+endfunction
+
+function y = recurse (n)
+  if (n <= 0)
+    y = 0;
+  else
+    y = 1 + recurse (n - 1);
+  endif
+endfunction
+
+function s = branch_loop (n)
+  s = 0;
+  for i = 1:n
+    if (mod (i, 3) == 0)
+      s += 1;
+    elseif (mod (i, 3) == 1)
+      s += 2;
+    else
+      s -= 1;
+    endif
+  endfor
+endfunction
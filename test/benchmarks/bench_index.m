@@ -0,0 +1,50 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## Indexing (Array<T>::index and indexed assignment).
+
+function cases = bench_index ()
+
+  x = rand (1e6, 1);
+  contiguous = 1000:900000;
+  scattered = randperm (1e6, 1e5);
+  mask = x > 0.5;
+  m = rand (2000);
+
+  cases = {
+    "contiguous range x(a:b)", @() x(contiguous);
+    "scattered x(randperm)", @() x(scattered);
+    "logical mask x(x > 0.5)", @() x(mask);
+    "matrix row m(777, :)", @() m(777, :);
+    "matrix column m(:, 777)", @() m(:, 777);
+    "indexed assignment", @() assign_range (x, contiguous);
+  };
+
+endfunction
+
+function y = assign_range (x, idx)
+  y = x;
+  y(idx) = 0;
+endfunction
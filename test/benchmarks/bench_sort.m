@@ -0,0 +1,47 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## Sorting (oct-sort).
+
+function cases = bench_sort ()
+
+  random_data = rand (1e6, 1);
+  sorted_data = sort (random_data);
+  reversed_data = flipud (sorted_data);
+  int_data = int32 (1e6 * rand (1e6, 1));
+
+  cases = {
+    "sort random 1e6", @() sort (random_data);
+    "sort sorted 1e6", @() sort (sorted_data);
+    "sort reversed 1e6", @() sort (reversed_data);
+    "sort int32 1e6", @() sort (int_data);
+    "sort with index output", @() sort_with_index (random_data);
+  };
+
+endfunction
+
+function [s, i] = sort_with_index (x)
+  [s, i] = sort (x);
+endfunction
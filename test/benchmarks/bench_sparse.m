@@ -0,0 +1,42 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## Sparse matrix operations.
+
+function cases = bench_sparse ()
+
+  A = sprand (20000, 20000, 1e-3);
+  B = sprand (20000, 20000, 1e-3);
+  x = rand (20000, 1);
+
+  cases = {
+    "sparse matvec A*x", @() A * x;
+    "sparse add A+B", @() A + B;
+    "sparse transpose", @() A';
+    "sparse scale 2*A", @() 2 * A;
+    "sparse extract diag", @() diag (A);
+  };
+
+endfunction
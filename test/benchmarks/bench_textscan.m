@@ -0,0 +1,43 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## Text scanning (textscan and str2double).
+
+function cases = bench_textscan ()
+
+  ## Build the input once, in memory, so the benchmark measures parsing
+  ## rather than file system behavior.
+  n = 1e5;
+  lines = sprintf ("%d,%.6f,label%d\n", [1:n; rand(1, n); 1:n]);
+  numbers = arrayfun (@(x) sprintf ("%.6f", x), rand (1e4, 1),
+                      "UniformOutput", false);
+
+  cases = {
+    "textscan 1e5 csv rows", @() textscan (lines, "%d,%f,%s");
+    "textscan numeric only", @() textscan (lines, "%d,%f,%*s");
+    "str2double 1e4 strings", @() str2double (numbers);
+  };
+
+endfunction
@@ -0,0 +1,10 @@
+benchmarks_FILES = \
+  %reldir%/bench_elementwise.m \
+  %reldir%/bench_evaluator.m \
+  %reldir%/bench_index.m \
+  %reldir%/bench_sort.m \
+  %reldir%/bench_sparse.m \
+  %reldir%/bench_textscan.m \
+  %reldir%/runbenchmarks.m
+
+EXTRA_DIST += $(benchmarks_FILES)
@@ -0,0 +1,64 @@
+########################################################################
+##
+## Copyright (C) 2023 The Octave Project Developers
+##
+## See the file COPYRIGHT.md in the top-level directory of this
+## distribution or <https://octave.org/copyright/>.
+##
+## This file is part of Octave.
+##
+## Octave is free software: you can redistribute it and/or modify it
+## under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## Octave is distributed in the hope that it will be useful, but
+## WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with Octave; see the file COPYING.  If not, see
+## <https://www.gnu.org/licenses/>.
+##
+########################################################################
+
+## -*- texinfo -*-
+## @deftypefn {} {@var{results} =} runbenchmarks ()
+## Run the interpreter benchmark suite and print a timing table.
+##
+## Each benchmark is measured with @code{timeit}, so the reported numbers
+## are medians over repeated samples with call overhead subtracted.  The
+## results are returned as a struct array with the fields @code{suite},
+## @code{name}, @code{seconds}, and @code{mad} so successive runs (for
+## instance before and after an upgrade) can be compared
+## programmatically.
+## @end deftypefn
+
+function results = runbenchmarks ()
+
+  suites = {@bench_elementwise, @bench_index, @bench_sort, ...
+            @bench_sparse, @bench_textscan, @bench_evaluator};
+
+  results = struct ("suite", {}, "name", {}, "seconds", {}, "mad", {});
+
+  for i = 1:numel (suites)
+    suite_fcn = suites{i};
+    suite_name = func2str (suite_fcn);
+
+    cases = suite_fcn ();
+
+    for j = 1:rows (cases)
+      [t, details] = timeit (cases{j, 2});
+
+      results(end+1) = struct ("suite", suite_name, ...
+                               "name", cases{j, 1}, ...
+                               "seconds", t, ...
+                               "mad", details.MAD);
+
+      printf ("%-18s %-38s %12.6f s  (mad %.2e)\n",
+              suite_name, cases{j, 1}, t, details.MAD);
+    endfor
+  endfor
+
+endfunction
@@ -203,3 +203,37 @@
 %!   endif
 %! endfor
 %! assert (i, zeros (1,0));
+
+## The evaluator updates a range loop variable in place when it can;
+## check that bodies which share, retype, or clear the variable still
+## see a fresh value on the next iteration.
+%!test
+%! c = {};
+%! for i = 1:3
+%!   c{end+1} = i;
+%! endfor
+%! assert (c, {1, 2, 3});
+
+%!test
+%! v = [];
+%! for i = 1:3
+%!   i = "reset";
+%!   v(end+1) = exist ("i");
+%! endfor
+%! assert (v, [1, 1, 1]);
+%! assert (i, "reset");
+
+%!test
+%! for i = 1:3
+%!   clear i;
+%! endfor
+%! assert (exist ("i"), 0);
+
+%!test
+%! s = 0;
+%! for i = 1:3
+%!   f = @() i;
+%!   s += f ();
+%! endfor
+%! assert (s, 6);
+%! assert (class (i), "double");
@@ -365,3 +365,30 @@
 %! fail ("1:5*i", "warning", "imaginary part of complex colon arguments is ignored");
 %! fail ("1:i:5", "warning", "imaginary part of complex colon arguments is ignored");
 
+
+## Literal expressions are folded at parse time; check that the folded
+## values match run-time evaluation for each operator class and that
+## errors from unfoldable expressions are still reported at run time.
+%!assert (1 + 1, 2)
+%!assert (2 * 3 + 4 ^ 2, 22)
+%!assert (-2 ^ 2, -4)
+%!assert (1 / 0, Inf)
+%!assert (10 / 4, 2.5)
+%!assert (7 == 7, true)
+%!assert (3 < 2, false)
+%!assert (1 & 0, false)
+%!assert (! 0, true)
+%!assert ('a' + 1, 98)
+%!assert (2i * 2i, -4 + 0i)
+%!assert (eval ("5'"), 5)
+%!test
+%! f = str2func ("@(x) x + 2 * 3");
+%! assert (f (1), 7);
+%!test
+%! ## Folding keeps the source text, so anonymous functions display
+%! ## and round-trip through func2str/str2func without losing
+%! ## precision for results like 1/3.
+%! f = @(x) x + 1/3;
+%! assert (func2str (f), "@(x) x + 1 / 3");
+%! g = str2func (func2str (f));
+%! assert (g (1), f (1));